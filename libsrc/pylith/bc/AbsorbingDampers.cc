@@ -70,7 +70,8 @@ public:
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::bc::AbsorbingDampers::AbsorbingDampers(void) :
-    _auxiliaryFactory(new pylith::bc::AbsorbingDampersAuxiliaryFactory) {
+    _auxiliaryFactory(new pylith::bc::AbsorbingDampersAuxiliaryFactory),
+    _impedanceFilename("") {
     PyreComponent::setName(_AbsorbingDampers::pyreComponent);
 
     _subfieldName = "velocity";
@@ -98,6 +99,24 @@ pylith::bc::AbsorbingDampers::deallocate(void) {
 } // deallocate
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of file holding stored impedance operator.
+void
+pylith::bc::AbsorbingDampers::setImpedanceFilename(const char* value) {
+    PYLITH_COMPONENT_DEBUG("setImpedanceFilename(value="<<value<<")");
+
+    _impedanceFilename = value ? value : "";
+} // setImpedanceFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of file holding stored impedance operator.
+const char*
+pylith::bc::AbsorbingDampers::getImpedanceFilename(void) const {
+    return _impedanceFilename.c_str();
+} // getImpedanceFilename
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -129,6 +148,10 @@ pylith::bc::AbsorbingDampers::createIntegrator(const pylith::topology::Field& so
     integrator->setSubfieldName(getSubfieldName());
     integrator->setLabelName(getLabelName());
     integrator->setLabelValue(getLabelValue());
+    integrator->mergeBoundaryLabels(getExtraBoundaries(), solution);
+    if (!_impedanceFilename.empty()) {
+        integrator->useStoredImpedance(_impedanceFilename.c_str(), pylith::fekernels::AbsorbingDampers::Jg0vv);
+    } // if
 
     _AbsorbingDampers::setKernelsResidual(integrator, *this, solution);
 
@@ -43,6 +43,22 @@ public:
     /// Deallocate PETSc and local data structures.
     void deallocate(void);
 
+    /** Set name of file holding stored impedance operator.
+     *
+     * If set, the impedance operator relating boundary velocities to tractions is assembled once
+     * and stored to the file; subsequent runs on the same mesh and number of processes load the
+     * operator and apply it as a matrix-vector product instead of evaluating the kernels.
+     *
+     * @param[in] value Name of impedance operator file (empty string turns off stored operator).
+     */
+    void setImpedanceFilename(const char* value);
+
+    /** Get name of file holding stored impedance operator.
+     *
+     * @returns Name of impedance operator file.
+     */
+    const char* getImpedanceFilename(void) const;
+
     /** Verify configuration is acceptable.
      *
      * @param[in] solution Solution field.
@@ -102,6 +118,7 @@ protected:
 private:
 
     pylith::bc::AbsorbingDampersAuxiliaryFactory* _auxiliaryFactory; ///< Factory for auxiliary subfields.
+    std::string _impedanceFilename; ///< Name of file holding stored impedance operator (empty if unused).
     PylithReal _refDir1[3]; ///< First choice reference direction used to compute boundary tangential directions.
     PylithReal _refDir2[3]; ///< Second choice reference direction used to compute boundary tangential directions.
 
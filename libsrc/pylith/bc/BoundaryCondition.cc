@@ -79,6 +79,30 @@ pylith::bc::BoundaryCondition::getSubfieldName(void) const {
 } // getSubfieldName
 
 
+// ------------------------------------------------------------------------------------------------
+// Set names of additional boundaries merged into this boundary condition.
+void
+pylith::bc::BoundaryCondition::setExtraBoundaries(const char* labelNames[],
+                                                  const int numNames) {
+    PYLITH_COMPONENT_DEBUG("setExtraBoundaries(labelNames="<<labelNames<<", numNames="<<numNames<<")");
+
+    assert((labelNames && numNames > 0) || (!labelNames && (0 == numNames)));
+
+    _extraBoundaries.resize(numNames);
+    for (int i = 0; i < numNames; ++i) {
+        _extraBoundaries[i] = labelNames[i];
+    } // for
+} // setExtraBoundaries
+
+
+// ------------------------------------------------------------------------------------------------
+// Get names of additional boundaries merged into this boundary condition.
+const pylith::string_vector&
+pylith::bc::BoundaryCondition::getExtraBoundaries(void) const {
+    return _extraBoundaries;
+} // getExtraBoundaries
+
+
 // ------------------------------------------------------------------------------------------------
 // Set first choice for reference direction to discriminate among tangential directions in 3-D.
 void
@@ -143,6 +167,17 @@ pylith::bc::BoundaryCondition::verifyConfiguration(const pylith::topology::Field
         throw std::runtime_error(msg.str());
     } // if
 
+    const size_t numExtra = _extraBoundaries.size();
+    for (size_t i = 0; i < numExtra; ++i) {
+        err = DMHasLabel(dmSoln, _extraBoundaries[i].c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+        if (!hasLabel) {
+            std::ostringstream msg;
+            msg << "Could not find group of points '" << _extraBoundaries[i] << "' in boundary condition '"
+                << PyreComponent::getIdentifier() <<"'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
     PYLITH_METHOD_END;
 } // verifyConfiguration
 
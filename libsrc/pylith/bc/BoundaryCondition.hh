@@ -28,6 +28,8 @@
 
 #include "pylith/problems/Physics.hh" // ISA Physics
 
+#include "pylith/utils/arrayfwd.hh" // HASA string_vector
+
 #include <string> // HASA std::string
 
 class pylith::bc::BoundaryCondition : public pylith::problems::Physics {
@@ -58,6 +60,24 @@ public:
      */
     const char* getSubfieldName(void) const;
 
+    /** Set names of additional boundaries merged into this boundary condition.
+     *
+     * The surfaces must be mutually exclusive, share the label value of this boundary condition,
+     * and use the same physics. Integrator-based boundary conditions (Neumann, absorbing) assemble
+     * the merged boundaries in a single sweep, collapsing per-boundary fixed costs.
+     *
+     * @param[in] labelNames Array of names of labels for additional boundaries.
+     * @param[in] numNames Number of labels.
+     */
+    void setExtraBoundaries(const char* labelNames[],
+                            const int numNames);
+
+    /** Get names of additional boundaries merged into this boundary condition.
+     *
+     * @returns Array of names of labels for additional boundaries.
+     */
+    const pylith::string_vector& getExtraBoundaries(void) const;
+
     /** Set first choice for reference direction to discriminate among tangential directions in 3-D.
      *
      * @param vec Reference direction unit vector.
@@ -83,6 +103,7 @@ protected:
     PylithReal _refDir1[3]; ///< First choice reference direction used to compute boundary tangential directions.
     PylithReal _refDir2[3]; ///< Second choice reference direction used to compute boundary tangential directions.
     std::string _subfieldName; ///< Name of solution subfield for boundary condition.
+    pylith::string_vector _extraBoundaries; ///< Names of labels for additional boundaries merged into this one.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -209,6 +209,13 @@ pylith::bc::DirichletTimeDependent::verifyConfiguration(const pylith::topology::
         throw std::runtime_error(msg.str());
     } // if
 
+    if (!getExtraBoundaries().empty()) {
+        std::ostringstream msg;
+        msg << "Merging boundaries (extra_boundaries) is not supported for Dirichlet boundary condition '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
     const topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(_subfieldName.c_str());
     const int numComponents = info.description.numComponents;
     const int numConstrained = _constrainedDOF.size();
@@ -251,6 +258,10 @@ pylith::bc::DirichletTimeDependent::createConstraints(const pylith::topology::Fi
     constraint->setLabelValue(getLabelValue());
     constraint->setConstrainedDOF(&_constrainedDOF[0], _constrainedDOF.size());
 
+    // Constrained values with only an initial amplitude are static; apply them once instead of
+    // reapplying every time step.
+    constraint->setTimeDependent(_useRate || _useTimeHistory);
+
     _DirichletTimeDependent::setKernelConstraint(constraint, *this, solution);
 
     constraintArray.resize(1);
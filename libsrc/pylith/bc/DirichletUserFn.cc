@@ -27,6 +27,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include "pylith/utils/Expression.hh" // USES Expression
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
@@ -39,7 +40,8 @@
 // Default constructor.
 pylith::bc::DirichletUserFn::DirichletUserFn(void) :
     _fn(NULL),
-    _fnDot(NULL) {
+    _fnDot(NULL),
+    _compiledExpressions(NULL) {
     PyreComponent::setName("dirichletuserfn");
 } // constructor
 
@@ -59,6 +61,8 @@ pylith::bc::DirichletUserFn::deallocate(void) {
 
     BoundaryCondition::deallocate();
 
+    delete[] _compiledExpressions;_compiledExpressions = NULL;
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -122,6 +126,29 @@ pylith::bc::DirichletUserFn::getUserFnDot(void) const {
 } // getUserFnDot
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set expressions specifying field on boundary.
+void
+pylith::bc::DirichletUserFn::setExpressions(const char* const* expressions,
+                                            const int numExpressions) {
+    PYLITH_COMPONENT_DEBUG("setExpressions(expressions="<<expressions<<", numExpressions="<<numExpressions<<")");
+
+    assert((expressions && numExpressions > 0) || (!expressions && 0 == numExpressions));
+    _expressions.resize(numExpressions);
+    for (int i = 0; i < numExpressions; ++i) {
+        _expressions[i] = expressions[i];
+    } // for
+} // setExpressions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get expressions specifying field on boundary.
+const pylith::string_vector&
+pylith::bc::DirichletUserFn::getExpressions(void) const {
+    return _expressions;
+} // getExpressions
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -139,6 +166,22 @@ pylith::bc::DirichletUserFn::verifyConfiguration(const pylith::topology::Field&
 
     const topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(_subfieldName.c_str());
     const int numComponents = info.description.numComponents;
+
+    if (!_expressions.empty() && _fn) {
+        std::ostringstream msg;
+        msg << "Both a user function and expressions given for field on boundary"
+            << " in component '" << PyreComponent::getIdentifier() << "'; use one or the other.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!_expressions.empty() && (int(_expressions.size()) != numComponents)) {
+        std::ostringstream msg;
+        msg << "Number of expressions (" << _expressions.size() << ") for field on boundary"
+            << " in component '" << PyreComponent::getIdentifier() << "'"
+            << " does not match number of components (" << numComponents << ") of solution field '"
+            << _subfieldName << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
     const int numConstrained = _constrainedDOF.size();
     for (int iConstrained = 0; iConstrained < numConstrained; ++iConstrained) {
         if (_constrainedDOF[iConstrained] >= numComponents) {
@@ -177,8 +220,32 @@ pylith::bc::DirichletUserFn::createConstraints(const pylith::topology::Field& so
     constraint->setLabelName(getLabelName());
     constraint->setLabelValue(getLabelValue());
     constraint->setConstrainedDOF(&_constrainedDOF[0], _constrainedDOF.size());
-    constraint->setUserFn(_fn);
-    constraint->setUserFnDot(_fnDot);
+
+    if (!_expressions.empty()) { // Compile expressions once; kernels evaluate the compiled programs.
+        pylith::string_vector variableNames(4);
+        variableNames[0] = "x";
+        variableNames[1] = "y";
+        variableNames[2] = "z";
+        variableNames[3] = "t";
+
+        const size_t numExpressions = _expressions.size();
+        delete[] _compiledExpressions;_compiledExpressions = new pylith::utils::Expression[numExpressions];
+        for (size_t i = 0; i < numExpressions; ++i) {
+            try {
+                _compiledExpressions[i].compile(_expressions[i].c_str(), variableNames);
+            } catch (const std::exception& err) {
+                std::ostringstream msg;
+                msg << "Error compiling expression for component " << i << " of field on boundary"
+                    << " in component '" << PyreComponent::getIdentifier() << "'.\n" << err.what();
+                throw std::runtime_error(msg.str());
+            } // try/catch
+        } // for
+        constraint->setUserFn(_evaluateExpressions);
+        constraint->setUserFnContext(this);
+    } else {
+        constraint->setUserFn(_fn);
+        constraint->setUserFnDot(_fnDot);
+    } // if/else
 
     constraintArray.resize(1);
     constraintArray[0] = constraint;
@@ -218,4 +285,34 @@ pylith::bc::DirichletUserFn::_getAuxiliaryFactory(void) {
 } // _getAuxiliaryFactory
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Kernel evaluating compiled expressions.
+PetscErrorCode
+pylith::bc::DirichletUserFn::_evaluateExpressions(PetscInt spaceDim,
+                                                  PetscReal t,
+                                                  const PetscReal x[],
+                                                  PetscInt numComponents,
+                                                  PetscScalar* values,
+                                                  void* context) {
+    assert(x);
+    assert(values);
+    assert(context);
+    const DirichletUserFn* bc = (const DirichletUserFn*) context;
+    assert(bc->_compiledExpressions);
+    assert(numComponents == PetscInt(bc->_expressions.size()));
+
+    double variableValues[4] = { 0.0, 0.0, 0.0, 0.0 }; // x, y, z, t
+    for (PetscInt i = 0; i < spaceDim; ++i) {
+        variableValues[i] = x[i];
+    } // for
+    variableValues[3] = t;
+
+    for (PetscInt i = 0; i < numComponents; ++i) {
+        values[i] = bc->_compiledExpressions[i].evaluate(variableValues);
+    } // for
+
+    return 0;
+} // _evaluateExpressions
+
+
 // End of file
@@ -28,6 +28,7 @@
 #include "pylith/bc/BoundaryCondition.hh" // ISA BoundaryCondition
 
 #include "pylith/utils/types.hh" // HASA PetscUserFieldFunc
+#include "pylith/utils/utilsfwd.hh" // HASA Expression
 
 #include "pylith/topology/topologyfwd.hh" // USES Field
 
@@ -87,6 +88,25 @@ public:
      */
     PetscUserFieldFunc getUserFnDot(void) const;
 
+    /** Set expressions specifying field on boundary.
+     *
+     * Alternative to setUserFn() that does not require a compiled C callback. The expressions
+     * are compiled at the start of the simulation and evaluated at native speed; one expression
+     * per component of the solution subfield, in terms of the nondimensional coordinates x, y,
+     * and z and nondimensional time t.
+     *
+     * @param[in] expressions Array of expressions for components of field on boundary.
+     * @param[in] numExpressions Number of expressions.
+     */
+    void setExpressions(const char* const* expressions,
+                        const int numExpressions);
+
+    /** Get expressions specifying field on boundary.
+     *
+     * @returns Array of expressions for components of field on boundary.
+     */
+    const pylith::string_vector& getExpressions(void) const;
+
     /** Verify configuration is acceptable.
      *
      * @param[in] solution Solution field.
@@ -136,12 +156,33 @@ protected:
      */
     pylith::feassemble::AuxiliaryFactory* _getAuxiliaryFactory(void);
 
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Kernel evaluating compiled expressions (context is the DirichletUserFn object).
+     *
+     * @param[in] spaceDim Spatial dimension.
+     * @param[in] t Current time.
+     * @param[in] x Coordinates of point evaluation.
+     * @param[in] numComponents Number of components of field at point.
+     * @param[out] values Values of field at point.
+     * @param[in] context User context (DirichletUserFn object holding compiled expressions).
+     */
+    static PetscErrorCode _evaluateExpressions(PetscInt spaceDim,
+                                               PetscReal t,
+                                               const PetscReal x[],
+                                               PetscInt numComponents,
+                                               PetscScalar* values,
+                                               void* context);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     int_array _constrainedDOF; ///< List of constrained degrees of freedom at each location.
     PetscUserFieldFunc _fn; ///< Function specifying field on boundary.
     PetscUserFieldFunc _fnDot; ///< Function specifying time derivative of field on boundary.
+    pylith::string_vector _expressions; ///< Expressions for components of field on boundary.
+    pylith::utils::Expression* _compiledExpressions; ///< Compiled expressions (one per component).
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
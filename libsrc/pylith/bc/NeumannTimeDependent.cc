@@ -209,6 +209,13 @@ pylith::bc::NeumannTimeDependent::createIntegrator(const pylith::topology::Field
     integrator->setSubfieldName(getSubfieldName());
     integrator->setLabelName(getLabelName());
     integrator->setLabelValue(getLabelValue());
+    integrator->mergeBoundaryLabels(getExtraBoundaries(), solution);
+
+    pylith::string_vector amplitudeSubfields;
+    if (_useInitial) { amplitudeSubfields.push_back("initial_amplitude"); }
+    if (_useRate) { amplitudeSubfields.push_back("rate_amplitude"); }
+    if (_useTimeHistory) { amplitudeSubfields.push_back("time_history_amplitude"); }
+    integrator->setAmplitudeSubfields(amplitudeSubfields);
 
     _NeumannTimeDependent::setKernelsResidual(integrator, *this, solution, _formulation);
 
@@ -124,6 +124,7 @@ pylith::bc::NeumannUserFn::createIntegrator(const pylith::topology::Field& solut
     integrator->setSubfieldName(getSubfieldName());
     integrator->setLabelName(getLabelName());
     integrator->setLabelValue(getLabelValue());
+    integrator->mergeBoundaryLabels(getExtraBoundaries(), solution);
 
     _NeumannUserFn::setKernelsResidual(integrator, *this, solution, _formulation);
 
@@ -0,0 +1,229 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "PerfectlyMatchedLayer.hh" // implementation of object methods
+
+#include "PerfectlyMatchedLayerAuxiliaryFactory.hh" // USES AuxiliaryFactory
+
+#include "pylith/fekernels/PerfectlyMatchedLayer.hh" // USES PerfectlyMatchedLayer kernels
+
+#include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <typeinfo> // USES typeid
+
+// ---------------------------------------------------------------------------------------------------------------------
+typedef pylith::feassemble::IntegratorDomain::ResidualKernels ResidualKernels;
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace bc {
+        class _PerfectlyMatchedLayer {
+            // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /** Set kernels for RHS residual.
+             *
+             * @param[out] integrator Integrator for perfectly matched layer region.
+             * @param[in] bc Perfectly matched layer absorbing region.
+             * @param[in] solution Solution field.
+             */
+            static
+            void setKernelsResidual(pylith::feassemble::IntegratorDomain* integrator,
+                                    const pylith::bc::PerfectlyMatchedLayer& bc,
+                                    const pylith::topology::Field& solution);
+
+            static const char* pyreComponent;
+        };
+        const char* _PerfectlyMatchedLayer::pyreComponent = "perfectlymatchedlayer";
+
+    } // bc
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::bc::PerfectlyMatchedLayer::PerfectlyMatchedLayer(void) :
+    _auxiliaryFactory(new pylith::bc::PerfectlyMatchedLayerAuxiliaryFactory) {
+    PyreComponent::setName(_PerfectlyMatchedLayer::pyreComponent);
+
+    _subfieldName = "velocity";
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::bc::PerfectlyMatchedLayer::~PerfectlyMatchedLayer(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::bc::PerfectlyMatchedLayer::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    BoundaryCondition::deallocate();
+
+    delete _auxiliaryFactory;_auxiliaryFactory = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::bc::PerfectlyMatchedLayer::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    BoundaryCondition::verifyConfiguration(solution);
+
+    const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(_subfieldName.c_str());
+    if (pylith::topology::Field::VECTOR != info.description.vectorFieldType) {
+        std::ostringstream msg;
+        msg << "Perfectly matched layer cannot be applied to non-vector field '"<< _subfieldName << "' in solution.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create integrator and set kernels.
+pylith::feassemble::Integrator*
+pylith::bc::PerfectlyMatchedLayer::createIntegrator(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createIntegrator(solution="<<solution.getLabel()<<")");
+
+    // The damping term is integrated over the cells in the layer, so we use a domain integrator
+    // (like a material) with the label marking the layer cells.
+    pylith::feassemble::IntegratorDomain* integrator = new pylith::feassemble::IntegratorDomain(this);assert(integrator);
+    integrator->setLabelName(getLabelName());
+    integrator->setLabelValue(getLabelValue());
+
+    _PerfectlyMatchedLayer::setKernelsResidual(integrator, *this, solution);
+
+    PYLITH_METHOD_RETURN(integrator);
+} // createIntegrator
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create constraint and set kernels.
+std::vector<pylith::feassemble::Constraint*>
+pylith::bc::PerfectlyMatchedLayer::createConstraints(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createConstraints(solution="<<solution.getLabel()<<") empty method");
+    std::vector<pylith::feassemble::Constraint*> constraintArray;
+
+    PYLITH_METHOD_RETURN(constraintArray);
+} // createConstraints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create auxiliary field.
+pylith::topology::Field*
+pylith::bc::PerfectlyMatchedLayer::createAuxiliaryField(const pylith::topology::Field& solution,
+                                                        const pylith::topology::Mesh& domainMesh) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createAuxiliaryField(solution="<<solution.getLabel()<<", domainMesh=)"<<typeid(domainMesh).name()<<")");
+
+    pylith::topology::Field* auxiliaryField = new pylith::topology::Field(domainMesh);assert(auxiliaryField);
+    auxiliaryField->setLabel("PerfectlyMatchedLayer auxiliary field");
+
+    assert(_auxiliaryFactory);
+    assert(_normalizer);
+    _auxiliaryFactory->initialize(auxiliaryField, *_normalizer, domainMesh.getDimension());
+
+    // :ATTENTION: The order for adding subfields must match the order of the auxiliary fields in the FE kernels.
+
+    _auxiliaryFactory->addDensity(); // 0
+    _auxiliaryFactory->addDampingCoefficient(); // 1
+
+    auxiliaryField->subfieldsSetup();
+    auxiliaryField->createDiscretization();
+    pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
+    auxiliaryField->allocate();
+    auxiliaryField->createOutputVector();
+
+    assert(_auxiliaryFactory);
+    _auxiliaryFactory->setValuesFromDB();
+
+    PYLITH_METHOD_RETURN(auxiliaryField);
+} // createAuxiliaryField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create derived field.
+pylith::topology::Field*
+pylith::bc::PerfectlyMatchedLayer::createDerivedField(const pylith::topology::Field& solution,
+                                                      const pylith::topology::Mesh& domainMesh) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createDerivedField(solution="<<solution.getLabel()<<", domainMesh=)"<<typeid(domainMesh).name()<<") empty method");
+
+    PYLITH_METHOD_RETURN(NULL);
+} // createDerivedField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get auxiliary field factory associated with physics.
+pylith::feassemble::AuxiliaryFactory*
+pylith::bc::PerfectlyMatchedLayer::_getAuxiliaryFactory(void) {
+    return _auxiliaryFactory;
+} // _getAuxiliaryFactory
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set kernels for residual.
+void
+pylith::bc::_PerfectlyMatchedLayer::setKernelsResidual(pylith::feassemble::IntegratorDomain* integrator,
+                                                       const pylith::bc::PerfectlyMatchedLayer& bc,
+                                                       const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_PerfectlyMatchedLayer::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "_PerfectlyMatchedLayer::setKernelsResidual(integrator="<<integrator<<", bc="<<typeid(bc).name()
+          <<", solution="<<solution.getLabel()<<")"<<pythia::journal::endl;
+
+    PetscPointFunc g0 = pylith::fekernels::PerfectlyMatchedLayer::g0v;
+    PetscPointFunc g1 = NULL;
+
+    std::vector<ResidualKernels> kernels(1);
+    kernels[0] = ResidualKernels(bc.getSubfieldName(), pylith::feassemble::Integrator::RHS, g0, g1);
+
+    assert(integrator);
+    integrator->setKernelsResidual(kernels, solution);
+
+    PYLITH_METHOD_END;
+} // setKernelsResidual
+
+
+// End of file
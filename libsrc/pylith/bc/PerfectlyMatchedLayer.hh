@@ -0,0 +1,118 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/bc/PerfectlyMatchedLayer.hh
+ *
+ * @brief C++ implementation of a perfectly matched layer absorbing region for dynamic problems.
+ *
+ * Unlike AbsorbingDampers, which acts on the boundary surface, the perfectly matched layer acts
+ * on a volumetric region of cells adjacent to the boundary (marked with a label, like a material)
+ * and damps waves with a coefficient profile graded from zero at the interior edge of the layer
+ * to its maximum at the exterior boundary. The graded profile absorbs waves over a much thinner
+ * layer than the unstructured sponge zones used with first-order absorbing boundaries.
+ */
+
+#if !defined(pylith_bc_perfectlymatchedlayer_hh)
+#define pylith_bc_perfectlymatchedlayer_hh
+
+#include "pylith/bc/BoundaryCondition.hh" // ISA Physics
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+
+class pylith::bc::PerfectlyMatchedLayer : public pylith::bc::BoundaryCondition {
+    friend class TestPerfectlyMatchedLayer; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    PerfectlyMatchedLayer(void);
+
+    /// Destructor.
+    ~PerfectlyMatchedLayer(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Verify configuration is acceptable.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Create integrator and set kernels.
+     *
+     * @param[in] solution Solution field.
+     * @returns Integrator if applicable, otherwise NULL.
+     */
+    pylith::feassemble::Integrator* createIntegrator(const pylith::topology::Field& solution);
+
+    /** Create constraint and set kernels.
+     *
+     * @param[in] solution Solution field.
+     * @returns Constraint if applicable, otherwise NULL.
+     */
+    std::vector<pylith::feassemble::Constraint*> createConstraints(const pylith::topology::Field& solution);
+
+    /** Create auxiliary field.
+     *
+     * @param[in] solution Solution field.
+     * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+     *
+     * @returns Auxiliary field if applicable, otherwise NULL.
+     */
+    pylith::topology::Field* createAuxiliaryField(const pylith::topology::Field& solution,
+                                                  const pylith::topology::Mesh& domainMesh);
+
+    /** Create derived field.
+     *
+     * @param[in] solution Solution field.
+     * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+     *
+     * @returns Derived field if applicable, otherwise NULL.
+     */
+    pylith::topology::Field* createDerivedField(const pylith::topology::Field& solution,
+                                                const pylith::topology::Mesh& domainMesh);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Get auxiliary factory associated with physics.
+     *
+     * @return Auxiliary factory for physics object.
+     */
+    pylith::feassemble::AuxiliaryFactory* _getAuxiliaryFactory(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::bc::PerfectlyMatchedLayerAuxiliaryFactory* _auxiliaryFactory; ///< Factory for auxiliary subfields.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    PerfectlyMatchedLayer(const PerfectlyMatchedLayer&); ///< Not implemented.
+    const PerfectlyMatchedLayer& operator=(const PerfectlyMatchedLayer&); ///< Not implemented.
+
+};
+
+// class PerfectlyMatchedLayer
+
+#endif // pylith_bc_perfectlymatchedlayer_hh
+
+// End of file
@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "PerfectlyMatchedLayerAuxiliaryFactory.hh" // implementation of object methods
+
+#include "pylith/topology/Field.hh" // HOLDSA AuxiliaryField
+#include "pylith/topology/FieldQuery.hh" // USES FieldQuery
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD*
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
+
+#include <cassert>
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::bc::PerfectlyMatchedLayerAuxiliaryFactory::PerfectlyMatchedLayerAuxiliaryFactory(void) {
+    GenericComponent::setName("perfectlymatchedlayerauxiliaryfactory");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::bc::PerfectlyMatchedLayerAuxiliaryFactory::~PerfectlyMatchedLayerAuxiliaryFactory(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add density field to auxiliary fields.
+void
+pylith::bc::PerfectlyMatchedLayerAuxiliaryFactory::addDensity(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addDensity(void)");
+
+    const char* subfieldName = "density";
+    const PylithReal densityScale = _normalizer->getDensityScale();
+
+    pylith::topology::Field::Description description;
+    description.label = subfieldName;
+    description.alias = subfieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = subfieldName;
+    description.scale = densityScale;
+    description.validator = pylith::topology::FieldQuery::validatorPositive;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(subfieldName));
+    this->setSubfieldQuery(subfieldName);
+
+    PYLITH_METHOD_END;
+} // addDensity
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add damping coefficient (coordinate stretching) profile field to auxiliary fields.
+void
+pylith::bc::PerfectlyMatchedLayerAuxiliaryFactory::addDampingCoefficient(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addDampingCoefficient(void)");
+
+    const char* subfieldName = "damping_coefficient";
+    const char* componentNames[3] = {
+        "damping_coefficient_x",
+        "damping_coefficient_y",
+        "damping_coefficient_z",
+    };
+
+    const PylithReal dampingScale = 1.0 / _normalizer->getTimeScale();
+
+    pylith::topology::Field::Description description;
+    description.label = subfieldName;
+    description.alias = subfieldName;
+    description.vectorFieldType = pylith::topology::Field::VECTOR;
+    description.numComponents = _spaceDim;
+    description.componentNames.resize(_spaceDim);
+    for (int i = 0; i < _spaceDim; ++i) {
+        description.componentNames[i] = componentNames[i];
+    } // for
+    description.scale = dampingScale;
+    description.validator = pylith::topology::FieldQuery::validatorNonnegative;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(subfieldName));
+    this->setSubfieldQuery(subfieldName);
+
+    PYLITH_METHOD_END;
+} // addDampingCoefficient
+
+
+// End of file
@@ -0,0 +1,58 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/bc/PerfectlyMatchedLayerAuxiliaryFactory.hh
+ *
+ * @brief C++ helper class for setting up auxiliary fields for perfectly matched layer absorbing regions.
+ */
+
+#if !defined(pylith_bc_perfectlymatchedlayerauxiliaryfactory_hh)
+#define pylith_bc_perfectlymatchedlayerauxiliaryfactory_hh
+
+#include "bcfwd.hh" // forward declarations
+#include "pylith/feassemble/AuxiliaryFactory.hh" // ISA AuxiliaryFactory
+
+class pylith::bc::PerfectlyMatchedLayerAuxiliaryFactory : public pylith::feassemble::AuxiliaryFactory {
+    friend class TestPerfectlyMatchedLayerAuxiliaryFactory; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    PerfectlyMatchedLayerAuxiliaryFactory(void);
+
+    /// Destructor.
+    virtual ~PerfectlyMatchedLayerAuxiliaryFactory(void);
+
+    /// Add density field to auxiliary fields.
+    void addDensity(void);
+
+    /// Add damping coefficient (coordinate stretching) profile field to auxiliary fields.
+    void addDampingCoefficient(void);
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    PerfectlyMatchedLayerAuxiliaryFactory(const PerfectlyMatchedLayerAuxiliaryFactory &); ///< Not implemented.
+    const PerfectlyMatchedLayerAuxiliaryFactory& operator=(const PerfectlyMatchedLayerAuxiliaryFactory&); ///< Not implemented
+
+}; // class PerfectlyMatchedLayerAuxiliaryFactory
+
+#endif // pylith_bc_perfectlymatchedlayerauxiliaryfactory_hh
+
+// End of file
@@ -29,14 +29,75 @@
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
 
+#include <algorithm> // USES std::max
 #include <cassert>
+#include <cmath> // USES floor()
+#include <map> // USES std::map
+#include <vector> // USES std::vector
 
 // ---------------------------------------------------------------------------------------------------------------------
 namespace pylith {
     namespace bc {
+        /// Uniform-knot table compiled from a time history database for search-free evaluation.
+        class _TimeHistoryTable {
+public:
+
+            _TimeHistoryTable(void) :
+                dtKnot(0.0),
+                tEnd(-1.0),
+                isValid(false),
+                compileFailed(false) {}
+
+
+            /** Compile table covering [0, tTarget], refining the knot spacing until linear
+             * interpolation matches the database at the knot midpoints.
+             *
+             * @param[in] dbTimeHistory Time history database.
+             * @param[in] tTarget End of time interval covered by table (dimensioned).
+             * @returns True if compilation succeeded, false if the time history does not cover
+             * the interval.
+             */
+            bool compile(spatialdata::spatialdb::TimeHistory* const dbTimeHistory,
+                         const double tTarget);
+
+            /** Evaluate table at time t via indexed linear interpolation.
+             *
+             * @param[in] t Time for evaluation (dimensioned); must be in [0, tEnd].
+             * @returns Normalized amplitude.
+             */
+            double evaluate(const double t) const;
+
+            std::vector<double> knots; ///< Amplitudes at uniformly spaced times.
+            double dtKnot; ///< Spacing between knots.
+            double tEnd; ///< Time of last knot.
+            bool isValid; ///< True if table can be used for evaluation.
+            bool compileFailed; ///< True if compilation failed; use direct queries.
+        }; // _TimeHistoryTable
+
         class _TimeDependentAuxiliaryFactory {
 public:
 
+            /** Query time history database for normalized amplitude at relative time.
+             *
+             * Evaluation uses a uniform-knot table compiled lazily from the time history, so
+             * the common case is an indexed linear interpolation (one fused multiply-add)
+             * instead of an interval search in the database.
+             *
+             * @param[in] dbTimeHistory Time history database.
+             * @param[in] tRel Nondimensional time relative to start time.
+             * @param[in] timeScale Time scale for nondimensionalization.
+             * @returns Normalized amplitude (0 if tRel < 0).
+             */
+            static PylithScalar queryTimeHistory(spatialdata::spatialdb::TimeHistory* const dbTimeHistory,
+                                                 const PylithScalar tRel,
+                                                 const PylithReal timeScale);
+
+            ///< Maximum number of distinct start times for batched time history queries.
+            static const size_t maxDistinctStartTimes;
+
+            ///< Tables compiled from time history databases, keyed by database.
+            static std::map<spatialdata::spatialdb::TimeHistory*, _TimeHistoryTable> timeHistoryTables;
+
             ///< Names of field components in XYZ coordinate system.
             static const char* componentsXYZ[3];
 
@@ -53,10 +114,111 @@ public:
         const char* _TimeDependentAuxiliaryFactory::componentsTN[2] = { "_tangential", "_normal" };
         const char* _TimeDependentAuxiliaryFactory::componentsTTN[3] = { "_tangential_1", "_tangential_2", "_normal" };
 
+        const size_t _TimeDependentAuxiliaryFactory::maxDistinctStartTimes = 64;
+
+        std::map<spatialdata::spatialdb::TimeHistory*, pylith::bc::_TimeHistoryTable> _TimeDependentAuxiliaryFactory::timeHistoryTables;
+
         const char* _TimeDependentAuxiliaryFactory::genericComponent = "timedependentauxiliaryfactory";
     } // bc
 } // pylith
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compile table covering [0, tTarget] from time history database.
+bool
+pylith::bc::_TimeHistoryTable::compile(spatialdata::spatialdb::TimeHistory* const dbTimeHistory,
+                                       const double tTarget) {
+    assert(dbTimeHistory);
+    assert(tTarget > 0.0);
+
+    const size_t numKnotsMin = 64;
+    const size_t numKnotsMax = 65536;
+    const double tolerance = 1.0e-6;
+
+    isValid = false;
+    for (size_t numKnots = numKnotsMin; numKnots <= numKnotsMax; numKnots *= 2) {
+        const double dt = tTarget / (numKnots - 1);
+        std::vector<double> values(numKnots);
+        double maxAbs = 0.0;
+        for (size_t i = 0; i < numKnots; ++i) {
+            PylithScalar value = 0.0;
+            if (dbTimeHistory->query(&value, i*dt)) {
+                return false; // Time history does not cover [0, tTarget].
+            } // if
+            values[i] = value;
+            maxAbs = std::max(maxAbs, fabs(values[i]));
+        } // for
+
+        // Refine the knot spacing until linear interpolation between knots matches the database
+        // at the knot midpoints, so the table reproduces nonuniformly spaced time history points.
+        double maxError = 0.0;
+        for (size_t i = 0; i+1 < numKnots; ++i) {
+            PylithScalar value = 0.0;
+            if (dbTimeHistory->query(&value, (i+0.5)*dt)) {
+                return false;
+            } // if
+            maxError = std::max(maxError, fabs(0.5*(values[i]+values[i+1]) - value));
+        } // for
+        if ((maxError <= tolerance * std::max(1.0, maxAbs)) || (2*numKnots > numKnotsMax)) {
+            knots.swap(values);
+            dtKnot = dt;
+            tEnd = tTarget;
+            isValid = true;
+            return true;
+        } // if
+    } // for
+
+    return false;
+} // compile
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Evaluate table at time t via indexed linear interpolation.
+double
+pylith::bc::_TimeHistoryTable::evaluate(const double t) const {
+    assert(isValid);
+    assert(knots.size() >= 2);
+    assert((t >= 0.0) && (t <= tEnd));
+
+    const double x = t / dtKnot;
+    size_t i = size_t(floor(x));
+    if (i+1 >= knots.size()) { i = knots.size() - 2;}
+    const double frac = x - double(i);
+    return knots[i] + frac * (knots[i+1] - knots[i]);
+} // evaluate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Query time history database for normalized amplitude at relative time.
+PylithScalar
+pylith::bc::_TimeDependentAuxiliaryFactory::queryTimeHistory(spatialdata::spatialdb::TimeHistory* const dbTimeHistory,
+                                                             const PylithScalar tRel,
+                                                             const PylithReal timeScale) {
+    PylithScalar value = 0.0;
+    if (tRel >= 0.0) {
+        const PylithScalar tDim = tRel * timeScale;
+
+        _TimeHistoryTable& table = timeHistoryTables[dbTimeHistory];
+        if ((tDim > 0.0) && !table.compileFailed && (!table.isValid || (tDim > table.tEnd))) {
+            // Compile with some margin so coverage grows geometrically; if the margin extends
+            // past the end of the time history, compile exactly to the requested time.
+            if (!table.compile(dbTimeHistory, 1.25*tDim) && !table.compile(dbTimeHistory, tDim)) {
+                table.compileFailed = true;
+            } // if
+        } // if
+        if (table.isValid && (tDim <= table.tEnd)) {
+            value = table.evaluate(tDim);
+        } else {
+            const int err = dbTimeHistory->query(&value, tDim);
+            if (err) {
+                std::ostringstream msg;
+                msg << "Error querying for time '" << tDim << "' in time history database '" << dbTimeHistory->getDescription() << "'.";
+                throw std::runtime_error(msg.str());
+            } // if
+        } // if/else
+    } // if
+    return value;
+} // queryTimeHistory
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::bc::TimeDependentAuxiliaryFactory::TimeDependentAuxiliaryFactory(const ReferenceEnum reference) :
@@ -331,33 +493,85 @@ pylith::bc::TimeDependentAuxiliaryFactory::updateAuxiliaryField(pylith::topology
     const PetscInt i_startTime = auxiliaryField->getSubfieldInfo("time_history_start_time").index;
     const PetscInt i_value = auxiliaryField->getSubfieldInfo("time_history_value").index;
 
-    // Loop over all points in section.
+    // Gather distinct start times so that the time history database is queried once per distinct
+    // relative time instead of once per point. Boundary sections typically have a single uniform
+    // start time or a handful of distinct values, so the number of queries scales with the number
+    // of distinct start times rather than the size of the boundary.
+    std::vector<PylithScalar> startTimes;
+    bool useBatchedQueries = true;
     for (PetscInt p = pStart; p < pEnd; ++p) {
         // Skip points without values in section.
         if (!auxiliaryFieldVisitor.sectionDof(p)) {continue;}
 
-        // Get starting time and compute relative time for point.
         const PetscInt offStartTime = auxiliaryFieldVisitor.sectionSubfieldOffset(i_startTime, p);
         const PylithScalar tStart = auxiliaryFieldArray[offStartTime];
-        const PylithScalar tRel = t - tStart;
-
-        // Query time history for value (normalized amplitude).
-        PylithScalar value = 0.0;
-        if (tRel >= 0.0) {
-            PylithScalar tDim = tRel * timeScale;
-            const int err = dbTimeHistory->query(&value, tDim);
-            if (err) {
-                std::ostringstream msg;
-                msg << "Error querying for time '" << tDim << "' in time history database '" << dbTimeHistory->getDescription() << "'.";
-                throw std::runtime_error(msg.str());
+        size_t iStartTime = 0;
+        for (; iStartTime < startTimes.size(); ++iStartTime) {
+            if (startTimes[iStartTime] == tStart) {break;}
+        } // for
+        if (iStartTime == startTimes.size()) {
+            if (startTimes.size() >= _TimeDependentAuxiliaryFactory::maxDistinctStartTimes) {
+                // Spatially varying start times; batching provides no benefit.
+                useBatchedQueries = false;
+                break;
             } // if
+            startTimes.push_back(tStart);
         } // if
-
-        // Update value (normalized amplitude) in auxiliary field.
-        const PetscInt offValue = auxiliaryFieldVisitor.sectionSubfieldOffset(i_value, p);
-        auxiliaryFieldArray[offValue] = value;
     } // for
 
+    bool valuesChanged = false;
+    if (useBatchedQueries) {
+        // Query time history once per distinct start time for value (normalized amplitude).
+        std::vector<PylithScalar> values(startTimes.size(), 0.0);
+        for (size_t iStartTime = 0; iStartTime < startTimes.size(); ++iStartTime) {
+            values[iStartTime] = _TimeDependentAuxiliaryFactory::queryTimeHistory(dbTimeHistory, t - startTimes[iStartTime], timeScale);
+        } // for
+
+        // Update value (normalized amplitude) in auxiliary field. Writes are skipped when the
+        // value is unchanged (constant time history over the step) to avoid dirtying pages.
+        for (PetscInt p = pStart; p < pEnd; ++p) {
+            if (!auxiliaryFieldVisitor.sectionDof(p)) {continue;}
+
+            const PetscInt offStartTime = auxiliaryFieldVisitor.sectionSubfieldOffset(i_startTime, p);
+            const PylithScalar tStart = auxiliaryFieldArray[offStartTime];
+            size_t iStartTime = 0;
+            for (; iStartTime < startTimes.size(); ++iStartTime) {
+                if (startTimes[iStartTime] == tStart) {break;}
+            } // for
+            assert(iStartTime < startTimes.size());
+
+            const PetscInt offValue = auxiliaryFieldVisitor.sectionSubfieldOffset(i_value, p);
+            if (auxiliaryFieldArray[offValue] != values[iStartTime]) {
+                auxiliaryFieldArray[offValue] = values[iStartTime];
+                valuesChanged = true;
+            } // if
+        } // for
+    } else {
+        // Loop over all points in section, querying pointwise.
+        for (PetscInt p = pStart; p < pEnd; ++p) {
+            // Skip points without values in section.
+            if (!auxiliaryFieldVisitor.sectionDof(p)) {continue;}
+
+            // Get starting time and compute relative time for point.
+            const PetscInt offStartTime = auxiliaryFieldVisitor.sectionSubfieldOffset(i_startTime, p);
+            const PylithScalar tStart = auxiliaryFieldArray[offStartTime];
+
+            // Query time history for value (normalized amplitude).
+            const PylithScalar value = _TimeDependentAuxiliaryFactory::queryTimeHistory(dbTimeHistory, t - tStart, timeScale);
+
+            // Update value (normalized amplitude) in auxiliary field.
+            const PetscInt offValue = auxiliaryFieldVisitor.sectionSubfieldOffset(i_value, p);
+            if (auxiliaryFieldArray[offValue] != value) {
+                auxiliaryFieldArray[offValue] = value;
+                valuesChanged = true;
+            } // if
+        } // for
+    } // if/else
+
+    if (valuesChanged) {
+        auxiliaryField->markSubfieldDirty("time_history_value");
+    } // if
+
     PYLITH_METHOD_END;
 } // updateAuxiliaryField
 
@@ -40,8 +40,10 @@ namespace pylith {
         class NeumannTimeDependent;
         class NeumannUserFn;
         class AbsorbingDampers;
+        class PerfectlyMatchedLayer;
 
         class AbsorbingDampersAuxiliaryFactory;
+        class PerfectlyMatchedLayerAuxiliaryFactory;
 
     } // bc
 } // pylith
@@ -0,0 +1,262 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "AuxiliaryFactoryRateState.hh" // implementation of object methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldQuery.hh" // HOLDSA FieldQuery
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD*
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
+
+#include <cassert>
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::faults::AuxiliaryFactoryRateState::AuxiliaryFactoryRateState(void) {
+    GenericComponent::setName("auxiliaryfactoryratestate");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::faults::AuxiliaryFactoryRateState::~AuxiliaryFactoryRateState(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add fault slip rate subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addSlipRate(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addSlipRate(void)");
+
+    const char* fieldName = "slip_rate";
+    const char* componentNames[3] = { "slip_rate_opening", "slip_rate_left_lateral", "slip_rate_reverse" };
+
+    const PylithReal velocityScale = _normalizer->getLengthScale() / _normalizer->getTimeScale();
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::VECTOR;
+    description.numComponents = _spaceDim;
+    description.componentNames.resize(_spaceDim);
+    for (int i = 0; i < _spaceDim; ++i) {
+        description.componentNames[i] = componentNames[i];
+    } // for
+    description.scale = velocityScale;
+    description.validator = NULL;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    // No query; updated from the velocity jump at beginning of time step.
+
+    PYLITH_METHOD_END;
+} // addSlipRate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add state variable subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addStateVariable(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addStateVariable(void)");
+
+    const char* fieldName = "state_variable";
+    const PylithReal timeScale = _normalizer->getTimeScale();
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = fieldName;
+    description.scale = timeScale;
+    description.validator = pylith::topology::FieldQuery::validatorPositive;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    setSubfieldQuery(fieldName);
+
+    PYLITH_METHOD_END;
+} // addStateVariable
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add reference friction coefficient subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addReferenceFrictionCoefficient(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addReferenceFrictionCoefficient(void)");
+
+    const char* fieldName = "reference_friction_coefficient";
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = fieldName;
+    description.scale = 1.0;
+    description.validator = pylith::topology::FieldQuery::validatorPositive;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    setSubfieldQuery(fieldName);
+
+    PYLITH_METHOD_END;
+} // addReferenceFrictionCoefficient
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add reference slip rate subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addReferenceSlipRate(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addReferenceSlipRate(void)");
+
+    const char* fieldName = "reference_slip_rate";
+    const PylithReal velocityScale = _normalizer->getLengthScale() / _normalizer->getTimeScale();
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = fieldName;
+    description.scale = velocityScale;
+    description.validator = pylith::topology::FieldQuery::validatorPositive;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    setSubfieldQuery(fieldName);
+
+    PYLITH_METHOD_END;
+} // addReferenceSlipRate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add characteristic slip distance subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addCharacteristicSlipDistance(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addCharacteristicSlipDistance(void)");
+
+    const char* fieldName = "characteristic_slip_distance";
+    const PylithReal lengthScale = _normalizer->getLengthScale();
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = fieldName;
+    description.scale = lengthScale;
+    description.validator = pylith::topology::FieldQuery::validatorPositive;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    setSubfieldQuery(fieldName);
+
+    PYLITH_METHOD_END;
+} // addCharacteristicSlipDistance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add constitutive parameter a subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addConstitutiveParameterA(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addConstitutiveParameterA(void)");
+
+    const char* fieldName = "constitutive_parameter_a";
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = fieldName;
+    description.scale = 1.0;
+    description.validator = pylith::topology::FieldQuery::validatorPositive;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    setSubfieldQuery(fieldName);
+
+    PYLITH_METHOD_END;
+} // addConstitutiveParameterA
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add constitutive parameter b subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addConstitutiveParameterB(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addConstitutiveParameterB(void)");
+
+    const char* fieldName = "constitutive_parameter_b";
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = fieldName;
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    setSubfieldQuery(fieldName);
+
+    PYLITH_METHOD_END;
+} // addConstitutiveParameterB
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add cohesion subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryRateState::addCohesion(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addCohesion(void)");
+
+    const char* fieldName = "cohesion";
+    const PylithReal pressureScale = _normalizer->getPressureScale();
+
+    pylith::topology::Field::Description description;
+    description.label = fieldName;
+    description.alias = fieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = fieldName;
+    description.scale = pressureScale;
+    description.validator = NULL;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(fieldName));
+    setSubfieldQuery(fieldName);
+
+    PYLITH_METHOD_END;
+} // addCohesion
+
+
+// End of file
@@ -0,0 +1,76 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/faults/AuxiliaryFactoryRateState.hh
+ *
+ * @brief C++ helper class for setting up auxiliary subfields for faults with rate-state friction.
+ */
+
+#if !defined(pylith_faults_auxiliaryfactoryratestate_hh)
+#define pylith_faults_auxiliaryfactoryratestate_hh
+
+#include "faultsfwd.hh" // forward declarations
+#include "pylith/feassemble/AuxiliaryFactory.hh" // ISA AuxiliaryFactory
+
+class pylith::faults::AuxiliaryFactoryRateState : public pylith::feassemble::AuxiliaryFactory {
+    friend class TestAuxiliaryFactoryRateState; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    AuxiliaryFactoryRateState(void);
+
+    /// Destructor.
+    ~AuxiliaryFactoryRateState(void);
+
+    /// Add slip rate subfield to auxiliary field.
+    void addSlipRate(void);
+
+    /// Add state variable subfield to auxiliary field.
+    void addStateVariable(void);
+
+    /// Add reference friction coefficient subfield to auxiliary field.
+    void addReferenceFrictionCoefficient(void);
+
+    /// Add reference slip rate subfield to auxiliary field.
+    void addReferenceSlipRate(void);
+
+    /// Add characteristic slip distance subfield to auxiliary field.
+    void addCharacteristicSlipDistance(void);
+
+    /// Add constitutive parameter a subfield to auxiliary field.
+    void addConstitutiveParameterA(void);
+
+    /// Add constitutive parameter b subfield to auxiliary field.
+    void addConstitutiveParameterB(void);
+
+    /// Add cohesion subfield to auxiliary field.
+    void addCohesion(void);
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    AuxiliaryFactoryRateState(const AuxiliaryFactoryRateState &); ///< Not implemented.
+    const AuxiliaryFactoryRateState& operator=(const AuxiliaryFactoryRateState&); ///< Not implemented
+
+}; // class AuxiliaryFactoryRateState
+
+#endif // pylith_faults_auxiliaryfactoryratestate_hh
+
+// End of file
@@ -0,0 +1,399 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "FaultCohesiveDyn.hh" // implementation of object methods
+
+#include "pylith/faults/AuxiliaryFactoryRateState.hh" // USES AuxiliaryFactoryRateState
+#include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
+#include "pylith/feassemble/InterfacePatches.hh" // USES InterfacePatches
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::checkDiscretization()
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/fekernels/RateStateFriction.hh" // USES RateStateFriction
+
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <cmath> // USES sqrt()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <typeinfo> // USES typeid()
+
+// ------------------------------------------------------------------------------------------------
+typedef pylith::feassemble::IntegratorInterface::ResidualKernels ResidualKernels;
+typedef pylith::feassemble::IntegratorInterface::JacobianKernels JacobianKernels;
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        class _FaultCohesiveDyn {
+            // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////
+public:
+
+            static const char* pyreComponent;
+
+        };
+        const char* _FaultCohesiveDyn::pyreComponent = "faultcohesivedyn";
+
+    } // faults
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
+    _auxiliaryFactory(new pylith::faults::AuxiliaryFactoryRateState),
+    _tState(0.0) {
+    pylith::utils::PyreComponent::setName(_FaultCohesiveDyn::pyreComponent);
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::faults::FaultCohesiveDyn::~FaultCohesiveDyn(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::faults::FaultCohesiveDyn::deallocate(void) {
+    FaultCohesive::deallocate();
+
+    delete _auxiliaryFactory;_auxiliaryFactory = NULL;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::faults::FaultCohesiveDyn::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    if (!solution.hasSubfield("lagrange_multiplier_fault")) {
+        std::ostringstream msg;
+        msg << "Cannot find 'lagrange_multiplier_fault' subfield in solution field for fault implementation in component '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    switch (_formulation) {
+    case QUASISTATIC:
+        PYLITH_COMPONENT_LOGICERROR("Fault implementation with rate-state friction is incompatible with 'quasistatic' formulation. Use 'dynamic_imex'.");
+        break;
+    case DYNAMIC_IMEX:
+        if (!solution.hasSubfield("velocity")) {
+            std::ostringstream msg;
+            msg << "Cannot find 'velocity' subfield in solution field for fault implementation in component '"
+                << PyreComponent::getIdentifier() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        break;
+    case DYNAMIC:
+        PYLITH_COMPONENT_LOGICERROR("Fault implementation is incompatible with 'dynamic' formulation. Use 'dynamic_imex'.");
+        break;
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
+    } // switch
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Create integrator and set kernels.
+pylith::feassemble::Integrator*
+pylith::faults::FaultCohesiveDyn::createIntegrator(const pylith::topology::Field& solution,
+                                                   const std::vector<pylith::materials::Material*>& materials) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createIntegrator(solution="<<solution.getLabel()<<")");
+
+    pylith::feassemble::IntegratorInterface* integrator = new pylith::feassemble::IntegratorInterface(this);assert(integrator);
+    integrator->setLabelName(getCohesiveLabelName());
+    integrator->setLabelValue(getCohesiveLabelValue());
+    integrator->setSurfaceLabelName(getSurfaceLabelName());
+
+    pylith::feassemble::InterfacePatches* patches =
+        pylith::feassemble::InterfacePatches::createMaterialPairs(this, solution.getDM());
+    integrator->setIntegrationPatches(patches);
+
+    _setKernelsResidual(integrator, solution, materials);
+    _setKernelsJacobian(integrator, solution, materials);
+
+    PYLITH_METHOD_RETURN(integrator);
+} // createIntegrator
+
+
+// ------------------------------------------------------------------------------------------------
+// Create auxiliary field.
+pylith::topology::Field*
+pylith::faults::FaultCohesiveDyn::createAuxiliaryField(const pylith::topology::Field& solution,
+                                                       const pylith::topology::Mesh& domainMesh) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createAuxiliaryField(solution="<<solution.getLabel()<<", domainMesh=)"<<typeid(domainMesh).name()<<")");
+
+    assert(_normalizer);
+
+    pylith::topology::Field* auxiliaryField = new pylith::topology::Field(domainMesh);assert(auxiliaryField);
+    auxiliaryField->setLabel("FaultCohesiveDyn auxiliary field");
+
+    // Set default discretization of auxiliary subfields to match lagrange_multiplier_fault subfield in solution.
+    const pylith::topology::FieldBase::Discretization& discretization = solution.getSubfieldInfo("lagrange_multiplier_fault").fe;
+    const PylithInt dimension = -1;
+    const bool isFaultOnly = false;
+    assert(_auxiliaryFactory);
+    _auxiliaryFactory->setSubfieldDiscretization("default", discretization.basisOrder, discretization.quadOrder, dimension,
+                                                 isFaultOnly, discretization.cellBasis, discretization.feSpace,
+                                                 discretization.isBasisContinuous);
+
+    assert(_normalizer);
+    _auxiliaryFactory->initialize(auxiliaryField, *_normalizer, solution.getSpaceDim());
+
+    // :ATTENTION: The order for adding subfields must match the order of the auxiliary fields in the FE kernels.
+
+    _auxiliaryFactory->addSlipRate(); // 0
+    _auxiliaryFactory->addStateVariable(); // 1
+    _auxiliaryFactory->addReferenceFrictionCoefficient(); // 2
+    _auxiliaryFactory->addReferenceSlipRate(); // 3
+    _auxiliaryFactory->addCharacteristicSlipDistance(); // 4
+    _auxiliaryFactory->addConstitutiveParameterA(); // 5
+    _auxiliaryFactory->addConstitutiveParameterB(); // 6
+    _auxiliaryFactory->addCohesion(); // 7
+
+    auxiliaryField->subfieldsSetup();
+    auxiliaryField->createDiscretization();
+    pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
+    auxiliaryField->allocate();
+    auxiliaryField->createOutputVector();
+
+    assert(_auxiliaryFactory);
+    _auxiliaryFactory->setValuesFromDB();
+
+    pythia::journal::debug_t debug(PyreComponent::getName());
+    if (debug.state()) {
+        PYLITH_COMPONENT_DEBUG("Displaying auxiliary field");
+        auxiliaryField->view("FaultCohesiveDyn auxiliary field");
+    } // if
+
+    PYLITH_METHOD_RETURN(auxiliaryField);
+} // createAuxiliaryField
+
+
+// ------------------------------------------------------------------------------------------------
+// Update auxiliary fields at beginning of time step.
+void
+pylith::faults::FaultCohesiveDyn::updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
+                                                       const double t) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("updateAuxiliaryField(auxiliaryField="<<auxiliaryField<<", t="<<t<<")");
+
+    assert(auxiliaryField);
+    assert(_normalizer);
+
+    switch (_formulation) {
+    case DYNAMIC_IMEX: {
+        const double dt = t - _tState;
+        if (dt > 0.0) {
+            this->_updateStateVariable(auxiliaryField, dt);
+        } // if
+        _tState = t;
+        break;
+    } // DYNAMIC_IMEX
+    case QUASISTATIC:
+    case DYNAMIC:
+        PYLITH_COMPONENT_LOGICERROR("Fault implementation with rate-state friction requires 'dynamic_imex' formulation.");
+        break;
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
+    } // switch
+
+    PYLITH_METHOD_END;
+} // updateAuxiliaryField
+
+
+// ------------------------------------------------------------------------------------------------
+// Get auxiliary factory associated with physics.
+pylith::feassemble::AuxiliaryFactory*
+pylith::faults::FaultCohesiveDyn::_getAuxiliaryFactory(void) {
+    return _auxiliaryFactory;
+} // _getAuxiliaryFactory
+
+
+// ------------------------------------------------------------------------------------------------
+// Update state variable subfield in auxiliary field at beginning of time step.
+void
+pylith::faults::FaultCohesiveDyn::_updateStateVariable(pylith::topology::Field* auxiliaryField,
+                                                       const double dt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_updateStateVariable(auxiliaryField="<<auxiliaryField<<", dt="<<dt<<")");
+
+    assert(auxiliaryField);
+
+    PetscErrorCode err = 0;
+    PetscSection auxiliaryFieldSection = auxiliaryField->getLocalSection();assert(auxiliaryFieldSection);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(auxiliaryFieldSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::VecVisitorMesh stateVisitor(*auxiliaryField, "state_variable");
+    pylith::topology::VecVisitorMesh slipRateVisitor(*auxiliaryField, "slip_rate");
+    pylith::topology::VecVisitorMesh charDistanceVisitor(*auxiliaryField, "characteristic_slip_distance");
+
+    PylithScalar* stateArray = stateVisitor.localArray();
+    const PylithScalar* slipRateArray = slipRateVisitor.localArray();
+    const PylithScalar* charDistanceArray = charDistanceVisitor.localArray();
+
+    const size_t spaceDim = auxiliaryField->getSpaceDim();
+
+    // Gather points with state into contiguous arrays so the ageing law integrates in one
+    // vectorizable batch instead of point-by-point dispatch.
+    scalar_array stateBatch(size_t(pEnd-pStart));
+    scalar_array slipRateBatch(size_t(pEnd-pStart));
+    scalar_array charDistanceBatch(size_t(pEnd-pStart));
+    int_array batchPoints(size_t(pEnd-pStart));
+
+    PylithInt numPoints = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        if (!stateVisitor.sectionDof(point)) { continue; }
+        const PetscInt stateOff = stateVisitor.sectionOffset(point);
+        const PetscInt slipRateOff = slipRateVisitor.sectionOffset(point);
+        const PetscInt charDistanceOff = charDistanceVisitor.sectionOffset(point);
+
+        PylithScalar slipRateMag = 0.0;
+        for (size_t i = 0; i < spaceDim; ++i) {
+            slipRateMag += slipRateArray[slipRateOff+i] * slipRateArray[slipRateOff+i];
+        } // for
+        slipRateMag = sqrt(slipRateMag);
+
+        batchPoints[numPoints] = point;
+        stateBatch[numPoints] = stateArray[stateOff];
+        slipRateBatch[numPoints] = slipRateMag;
+        charDistanceBatch[numPoints] = charDistanceArray[charDistanceOff];
+        ++numPoints;
+    } // for
+
+    pylith::fekernels::RateStateFriction::Batch batch;
+    batch.numPoints = numPoints;
+    batch.slipRate = &slipRateBatch[0];
+    batch.charDistance = &charDistanceBatch[0];
+    pylith::fekernels::RateStateFriction::stateAgeingBatched(batch, dt, &stateBatch[0]);
+
+    for (PylithInt i = 0; i < numPoints; ++i) {
+        const PetscInt stateOff = stateVisitor.sectionOffset(batchPoints[i]);
+        stateArray[stateOff] = stateBatch[i];
+    } // for
+    auxiliaryField->markSubfieldDirty("state_variable");
+
+    PYLITH_METHOD_END;
+} // _updateStateVariable
+
+
+// ------------------------------------------------------------------------------------------------
+// Set kernels for residual.
+void
+pylith::faults::FaultCohesiveDyn::_setKernelsResidual(pylith::feassemble::IntegratorInterface* integrator,
+                                                      const pylith::topology::Field& solution,
+                                                      const std::vector<pylith::materials::Material*>& materials) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setKernelsResidual(integrator="<<integrator<<", solution="<<solution.getLabel()<<")");
+    typedef pylith::feassemble::IntegratorInterface integrator_t;
+
+    std::vector<ResidualKernels> kernels;
+    switch (_formulation) {
+    case pylith::problems::Physics::DYNAMIC_IMEX: {
+        // Elasticity equation (velocity) for negative side of the fault.
+        const PetscBdPointFunc g0v_neg = pylith::fekernels::FaultCohesiveKin::f0u_neg;
+        const PetscBdPointFunc g1v_neg = NULL;
+
+        // Elasticity equation (velocity) for positive side of the fault.
+        const PetscBdPointFunc g0v_pos = pylith::fekernels::FaultCohesiveKin::f0u_pos;
+        const PetscBdPointFunc g1v_pos = NULL;
+
+        // Friction constraint equation.
+        const PetscBdPointFunc f0l = pylith::fekernels::RateStateFriction::f0l_ratestate;
+        const PetscBdPointFunc f1l = NULL;
+
+        kernels.resize(3);
+        kernels[0] = ResidualKernels("velocity", integrator_t::LHS, integrator_t::NEGATIVE_FACE, g0v_neg, g1v_neg);
+        kernels[1] = ResidualKernels("velocity", integrator_t::LHS, integrator_t::POSITIVE_FACE, g0v_pos, g1v_pos);
+        kernels[2] = ResidualKernels("lagrange_multiplier_fault", integrator_t::LHS, integrator_t::FAULT_FACE, f0l, f1l);
+        break;
+    } // DYNAMIC_IMEX
+    case pylith::problems::Physics::QUASISTATIC:
+    case pylith::problems::Physics::DYNAMIC:
+        PYLITH_COMPONENT_LOGICERROR("Fault implementation with rate-state friction requires 'dynamic_imex' formulation.");
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown formulation '"<<_formulation<<"'.");
+    } // switch
+
+    assert(integrator);
+    integrator->setKernels(kernels, solution, materials);
+
+    PYLITH_METHOD_END;
+} // _setKernelsResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Set kernels for Jacobian.
+void
+pylith::faults::FaultCohesiveDyn::_setKernelsJacobian(pylith::feassemble::IntegratorInterface* integrator,
+                                                      const pylith::topology::Field& solution,
+                                                      const std::vector<pylith::materials::Material*>& materials) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setKernelsJacobian(integrator="<<integrator<<", solution="<<solution.getLabel()<<")");
+    typedef pylith::feassemble::IntegratorInterface integrator_t;
+
+    std::vector<JacobianKernels> kernels;
+    switch (_formulation) {
+    case pylith::problems::Physics::DYNAMIC_IMEX: {
+        const PetscBdPointJac Jf0lu = pylith::fekernels::FaultCohesiveKin::Jf0lu;
+        const PetscBdPointJac Jf1lu = NULL;
+        const PetscBdPointJac Jf2lu = NULL;
+        const PetscBdPointJac Jf3lu = NULL;
+
+        kernels.resize(1);
+        const char* nameDisplacement = "displacement";
+        const char* nameLagrangeMultiplier = "lagrange_multiplier_fault";
+        kernels[0] = JacobianKernels(nameLagrangeMultiplier, nameDisplacement, integrator_t::LHS,
+                                     integrator_t::FAULT_FACE, Jf0lu, Jf1lu, Jf2lu, Jf3lu);
+        break;
+    } // DYNAMIC_IMEX
+    case pylith::problems::Physics::QUASISTATIC:
+    case pylith::problems::Physics::DYNAMIC:
+        PYLITH_COMPONENT_LOGICERROR("Fault implementation with rate-state friction requires 'dynamic_imex' formulation.");
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown formulation '"<<_formulation<<"'.");
+    } // switch
+
+    assert(integrator);
+    integrator->setKernels(kernels, solution, materials);
+
+    PYLITH_METHOD_END;
+} // _setKernelsJacobian
+
+
+// End of file
@@ -0,0 +1,136 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/faults/FaultCohesiveDyn.hh
+ *
+ * @brief C++ implementation for a fault surface with spontaneous (dynamic)
+ * rupture governed by rate- and state-dependent friction implemented with cohesive elements.
+ */
+
+#if !defined(pylith_faults_faultcohesivedyn_hh)
+#define pylith_faults_faultcohesivedyn_hh
+
+#include "FaultCohesive.hh" // ISA FaultCohesive
+
+class pylith::faults::FaultCohesiveDyn : public pylith::faults::FaultCohesive {
+    friend class TestFaultCohesiveDyn; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    FaultCohesiveDyn(void);
+
+    /// Destructor.
+    ~FaultCohesiveDyn(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Verify configuration is acceptable.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Create integrator and set kernels.
+     *
+     * @param[in] solution Solution field.
+     * @param[in] materials Materials in problem.
+     * @returns Integrator if applicable, otherwise NULL.
+     */
+    pylith::feassemble::Integrator* createIntegrator(const pylith::topology::Field& solution,
+                                                     const std::vector<pylith::materials::Material*>& materials);
+
+    /** Create auxiliary field.
+     *
+     * @param[in] solution Solution field.
+     * @param[in] domainMesh Finite-element mesh associated with integration domain.
+     *
+     * @returns Auxiliary field if applicable, otherwise NULL.
+     */
+    pylith::topology::Field* createAuxiliaryField(const pylith::topology::Field& solution,
+                                                  const pylith::topology::Mesh& domainMesh);
+
+    /** Update auxiliary subfields at beginning of time step.
+     *
+     * Integrates the ageing law for the friction state variable over the previous time step.
+     *
+     * @param[out] auxiliaryField Auxiliary field.
+     * @param[in] t Current time.
+     */
+    void updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
+                              const double t);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Get auxiliary factory associated with physics.
+     *
+     * @return Auxiliary factory for physics object.
+     */
+    pylith::feassemble::AuxiliaryFactory* _getAuxiliaryFactory(void);
+
+    /** Update state variable subfield in auxiliary field at beginning of time step.
+     *
+     * Gathers the slip rate, state, and friction parameters for all fault points into
+     * contiguous arrays and integrates the ageing law in a single vectorizable batch.
+     *
+     * @param[out] auxiliaryField Auxiliary field.
+     * @param[in] dt Time step over which to integrate the ageing law.
+     */
+    void _updateStateVariable(pylith::topology::Field* auxiliaryField,
+                              const double dt);
+
+    /** Set kernels for residual.
+     *
+     * @param[out] integrator Integrator for material.
+     * @param[in] solution Solution field.
+     * @param[in] materials Materials in problem.
+     */
+    void _setKernelsResidual(pylith::feassemble::IntegratorInterface* integrator,
+                             const pylith::topology::Field& solution,
+                             const std::vector<pylith::materials::Material*>& materials) const;
+
+    /** Set kernels for Jacobian.
+     *
+     * @param[out] integrator Integrator for material.
+     * @param[in] solution Solution field.
+     * @param[in] materials Materials in problem.
+     */
+    void _setKernelsJacobian(pylith::feassemble::IntegratorInterface* integrator,
+                             const pylith::topology::Field& solution,
+                             const std::vector<pylith::materials::Material*>& materials) const;
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::faults::AuxiliaryFactoryRateState* _auxiliaryFactory; ///< Factory for auxiliary subfields.
+    PylithReal _tState; ///< Time of last state variable update.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    FaultCohesiveDyn(const FaultCohesiveDyn&); ///< Not implemented
+    const FaultCohesiveDyn& operator=(const FaultCohesiveDyn&); ///< Not implemented.
+
+}; // class FaultCohesiveDyn
+
+#endif // pylith_faults_faultcohesivedyn_hh
+
+// End of file
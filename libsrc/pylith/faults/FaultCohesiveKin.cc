@@ -32,6 +32,7 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/fekernels/BoundaryDirections.hh" // USES BoundaryDirections
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
@@ -62,9 +63,82 @@ public:
 
             static const char* pyreComponent;
 
+            /** Accumulate surface displacements at a station from an Okada (1985) point
+             * dislocation in a homogeneous elastic half space.
+             *
+             * The station is at (x, y, 0) in the Okada frame (x along strike, y = z cross
+             * strike, z up) with the source at (0, 0, -d); see Okada (BSSA, 1985) equations
+             * (1)-(5) and (7)-(11) for a point source.
+             *
+             * @param[inout] disp Station displacements in the Okada frame.
+             * @param[in] x Along-strike coordinate of station relative to source.
+             * @param[in] y Horizontal across-strike coordinate of station relative to source.
+             * @param[in] d Depth of source below station (must be positive).
+             * @param[in] sinDip Sine of dip angle.
+             * @param[in] cosDip Cosine of dip angle.
+             * @param[in] potencyStrikeSlip Strike-slip component of slip times cell area.
+             * @param[in] potencyDipSlip Dip-slip component of slip times cell area.
+             * @param[in] potencyOpening Opening component of slip times cell area.
+             * @param[in] poissonRatio Poisson's ratio for the half space.
+             */
+            static void okadaPointSourceDisp(PylithScalar disp[3],
+                                             const PylithReal x,
+                                             const PylithReal y,
+                                             const PylithReal d,
+                                             const PylithReal sinDip,
+                                             const PylithReal cosDip,
+                                             const PylithReal potencyStrikeSlip,
+                                             const PylithReal potencyDipSlip,
+                                             const PylithReal potencyOpening,
+                                             const PylithReal poissonRatio);
+
         };
         const char* _FaultCohesiveKin::pyreComponent = "faultcohesivekin";
 
+        void
+        _FaultCohesiveKin::okadaPointSourceDisp(PylithScalar disp[3],
+                                                const PylithReal x,
+                                                const PylithReal y,
+                                                const PylithReal d,
+                                                const PylithReal sinDip,
+                                                const PylithReal cosDip,
+                                                const PylithReal potencyStrikeSlip,
+                                                const PylithReal potencyDipSlip,
+                                                const PylithReal potencyOpening,
+                                                const PylithReal poissonRatio) {
+            const PylithReal R2 = x*x + y*y + d*d;
+            const PylithReal R = sqrt(R2);
+            if (R <= 0.0) { return; } // Station coincides with source; contribution is singular.
+            const PylithReal R3 = R * R2;
+            const PylithReal R5 = R3 * R2;
+            const PylithReal Rd = R + d;
+
+            const PylithReal p = y*cosDip + d*sinDip;
+            const PylithReal q = y*sinDip - d*cosDip;
+            const PylithReal alpha = 1.0 - 2.0*poissonRatio; // mu / (lambda + mu)
+
+            const PylithReal I1 = alpha * y * (1.0/(R*Rd*Rd) - x*x*(3.0*R+d)/(R3*Rd*Rd*Rd));
+            const PylithReal I2 = alpha * x * (1.0/(R*Rd*Rd) - y*y*(3.0*R+d)/(R3*Rd*Rd*Rd));
+            const PylithReal I3 = alpha * x/R3 - I2;
+            const PylithReal I4 = alpha * (-x*y*(2.0*R+d)/(R3*Rd*Rd));
+            const PylithReal I5 = alpha * (1.0/(R*Rd) - x*x*(2.0*R+d)/(R3*Rd*Rd));
+
+            const PylithReal factorStrikeSlip = -potencyStrikeSlip / (2.0*M_PI);
+            disp[0] += factorStrikeSlip * (3.0*x*x*q/R5 + I1*sinDip);
+            disp[1] += factorStrikeSlip * (3.0*x*y*q/R5 + I2*sinDip);
+            disp[2] += factorStrikeSlip * (3.0*x*d*q/R5 + I4*sinDip);
+
+            const PylithReal factorDipSlip = -potencyDipSlip / (2.0*M_PI);
+            disp[0] += factorDipSlip * (3.0*x*p*q/R5 - I3*sinDip*cosDip);
+            disp[1] += factorDipSlip * (3.0*y*p*q/R5 - I1*sinDip*cosDip);
+            disp[2] += factorDipSlip * (3.0*d*p*q/R5 - I5*sinDip*cosDip);
+
+            const PylithReal factorOpening = potencyOpening / (2.0*M_PI);
+            disp[0] += factorOpening * (3.0*x*q*q/R5 - I3*sinDip*sinDip);
+            disp[1] += factorOpening * (3.0*y*q*q/R5 - I1*sinDip*sinDip);
+            disp[2] += factorOpening * (3.0*d*q*q/R5 - I5*sinDip*sinDip);
+        } // okadaPointSourceDisp
+
         // _FaultCohesiveKin
 
     } // faults
@@ -74,6 +148,7 @@ public:
 // Default constructor.
 pylith::faults::FaultCohesiveKin::FaultCohesiveKin(void) :
     _auxiliaryFactory(new pylith::faults::AuxiliaryFactoryKinematic),
+    _slipDM(NULL),
     _slipVecRupture(NULL),
     _slipVecTotal(NULL) {
     pylith::utils::PyreComponent::setName(_FaultCohesiveKin::pyreComponent);
@@ -95,6 +170,7 @@ pylith::faults::FaultCohesiveKin::deallocate(void) {
 
     PetscErrorCode err = VecDestroy(&_slipVecRupture);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_slipVecTotal);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&_slipDM);PYLITH_CHECK_ERROR(err);
     delete _auxiliaryFactory;_auxiliaryFactory = NULL;
     _ruptures.clear(); // :TODO: Use shared pointers for earthquake ruptures
 } // deallocate
@@ -235,6 +311,12 @@ pylith::faults::FaultCohesiveKin::createAuxiliaryField(const pylith::topology::F
     default:
         PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
     } // switch
+    if (3 == solution.getSpaceDim()) {
+        // Cached fault tangential directions; computed during initialization. The FE kernels assume
+        // these are the last two subfields.
+        _auxiliaryFactory->addStrikeDir();
+        _auxiliaryFactory->addUpDipDir();
+    } // if
 
     auxiliaryField->subfieldsSetup();
     auxiliaryField->createDiscretization();
@@ -245,6 +327,10 @@ pylith::faults::FaultCohesiveKin::createAuxiliaryField(const pylith::topology::F
     // We don't populate the auxiliary field via a spatial database, because they will be set from
     // the earthquake rupture.
 
+    if (3 == solution.getSpaceDim()) {
+        _computeTangentialDirections(auxiliaryField);
+    } // if
+
     // Initialize auxiliary fields for kinematic ruptures.
     assert(auxiliaryField);
     const srcs_type::const_iterator rupturesEnd = _ruptures.end();
@@ -254,10 +340,25 @@ pylith::faults::FaultCohesiveKin::createAuxiliaryField(const pylith::topology::F
         src->initialize(*auxiliaryField, *_normalizer, solution.getMesh().getCoordSys());
     } // for
 
-    // Create local PETSc vector to hold current slip.
+    // Create sub-DM holding only the slip-related subfields for evaluating the slip time
+    // functions; the auxiliary field also holds cached subfields that are not set by the
+    // earthquake ruptures.
     PetscErrorCode err = 0;
-    err = DMCreateLocalVector(auxiliaryField->getDM(), &_slipVecRupture);PYLITH_CHECK_ERROR(err);
-    err = DMCreateLocalVector(auxiliaryField->getDM(), &_slipVecTotal);PYLITH_CHECK_ERROR(err);
+    PetscInt numSlipSubfields = 0;
+    PetscInt slipSubfieldIndices[2];
+    slipSubfieldIndices[numSlipSubfields++] = auxiliaryField->getSubfieldInfo("slip").index;
+    if (DYNAMIC_IMEX == _formulation) {
+        slipSubfieldIndices[numSlipSubfields++] = auxiliaryField->getSubfieldInfo("slip_acceleration").index;
+    } // if
+    PetscIS slipSubfieldIS = NULL;
+    err = DMDestroy(&_slipDM);PYLITH_CHECK_ERROR(err);
+    err = DMCreateSubDM(auxiliaryField->getDM(), numSlipSubfields, slipSubfieldIndices, &slipSubfieldIS,
+                        &_slipDM);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&slipSubfieldIS);PYLITH_CHECK_ERROR(err);
+
+    // Create local PETSc vector to hold current slip.
+    err = DMCreateLocalVector(_slipDM, &_slipVecRupture);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLocalVector(_slipDM, &_slipVecTotal);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_RETURN(auxiliaryField);
 } // createAuxiliaryField
@@ -295,6 +396,211 @@ pylith::faults::FaultCohesiveKin::updateAuxiliaryField(pylith::topology::Field*
 } // updateAuxiliaryField
 
 
+// ------------------------------------------------------------------------------------------------
+// Re-query kinematic rupture parameters from the spatial databases.
+void
+pylith::faults::FaultCohesiveKin::reinitializeRuptureParameters(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("reinitializeRuptureParameters()");
+
+    const srcs_type::const_iterator rupturesEnd = _ruptures.end();
+    for (srcs_type::iterator r_iter = _ruptures.begin(); r_iter != rupturesEnd; ++r_iter) {
+        KinSrc* src = r_iter->second;assert(src);
+        src->reinitializeParameters();
+    } // for
+
+    PYLITH_METHOD_END;
+} // reinitializeRuptureParameters
+
+
+// ------------------------------------------------------------------------------------------------
+// Pre-tabulate slip subfields of kinematic ruptures for uniform time stepping.
+void
+pylith::faults::FaultCohesiveKin::tabulateSlipTimeSeries(const PylithReal tStart,
+                                                         const PylithReal dt,
+                                                         const size_t numSteps) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("tabulateSlipTimeSeries(tStart="<<tStart<<", dt="<<dt<<", numSteps="<<numSteps<<")");
+
+    assert(_slipDM);
+
+    int bitSlipSubfields = 0x0;
+    switch (_formulation) {
+    case QUASISTATIC:
+        bitSlipSubfields = pylith::faults::KinSrc::GET_SLIP;
+        break;
+    case DYNAMIC_IMEX:
+        bitSlipSubfields = pylith::faults::KinSrc::GET_SLIP | pylith::faults::KinSrc::GET_SLIP_ACC;
+        break;
+    case DYNAMIC:
+        PYLITH_COMPONENT_LOGICERROR("Fault implementation is incompatible with 'dynamic' formulation. Use 'dynamic_imex'.");
+        break;
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
+    } // switch
+
+    const srcs_type::const_iterator rupturesEnd = _ruptures.end();
+    for (srcs_type::iterator r_iter = _ruptures.begin(); r_iter != rupturesEnd; ++r_iter) {
+        KinSrc* src = r_iter->second;assert(src);
+        src->tabulateSlipSubfields(_slipDM, tStart, dt, numSteps, bitSlipSubfields);
+    } // for
+
+    PYLITH_METHOD_END;
+} // tabulateSlipTimeSeries
+
+
+// ------------------------------------------------------------------------------------------------
+// Accumulate analytic half-space estimates of surface displacements at stations (3D only).
+void
+pylith::faults::FaultCohesiveKin::estimateSurfaceDisplacements(PylithScalar* displacements,
+                                                               const PylithReal* stationCoords,
+                                                               const int numStations,
+                                                               const int spaceDim,
+                                                               const PylithReal t,
+                                                               const PylithReal poissonRatio) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("estimateSurfaceDisplacements(displacements="<<displacements<<", stationCoords="<<stationCoords<<", numStations="<<numStations<<", spaceDim="<<spaceDim<<", t="<<t<<", poissonRatio="<<poissonRatio<<")");
+
+    assert(displacements);
+    assert(stationCoords);
+    assert(_normalizer);
+    assert(_slipDM);
+
+    if (3 != spaceDim) {
+        std::ostringstream msg;
+        msg << "Analytic half-space surface displacement estimates are implemented for 3D domains only "
+            << "(space dimension is " << spaceDim << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Evaluate the total prescribed slip at time t, using the same slip vector machinery as
+    // _updateSlip().
+    PetscErrorCode err = VecSet(_slipVecTotal, 0.0);PYLITH_CHECK_ERROR(err);
+    const srcs_type::const_iterator rupturesEnd = _ruptures.end();
+    for (srcs_type::iterator r_iter = _ruptures.begin(); r_iter != rupturesEnd; ++r_iter) {
+        err = VecSet(_slipVecRupture, 0.0);PYLITH_CHECK_ERROR(err);
+        KinSrc* src = r_iter->second;assert(src);
+        src->getSlipSubfields(_slipVecRupture, _slipDM, t, _normalizer->getTimeScale(), pylith::faults::KinSrc::GET_SLIP);
+        err = VecAYPX(_slipVecTotal, 1.0, _slipVecRupture);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PetscSection slipSection = NULL;
+    err = DMGetLocalSection(_slipDM, &slipSection);PYLITH_CHECK_ERROR(err);
+    const PylithScalar* slipArray = NULL;
+    err = VecGetArrayRead(_slipVecTotal, &slipArray);PYLITH_CHECK_ERROR(err);
+
+    // Skip cells owned by other processes so that each cell contributes exactly once when the
+    // caller sums the station displacements across processes.
+    PetscIS globalCellNumbersIS = NULL;
+    err = DMPlexGetCellNumbering(_slipDM, &globalCellNumbersIS);PYLITH_CHECK_ERROR(err);
+    const PetscInt* globalCellNumbers = NULL;
+    err = ISGetIndices(globalCellNumbersIS, &globalCellNumbers);PYLITH_CHECK_ERROR(err);
+
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(_slipDM, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        if (globalCellNumbers[cell-cStart] < 0) { continue; }
+
+        PylithReal area = 0.0;
+        PylithReal centroid[3];
+        PylithReal normalDir[3];
+        err = DMPlexComputeCellGeometryFVM(_slipDM, cell, &area, centroid, normalDir);PYLITH_CHECK_ERROR(err);
+
+        // Cell-average slip (opening, left-lateral, reverse) from the points in the cell closure.
+        PylithScalar slipAvg[3] = { 0.0, 0.0, 0.0 };
+        PetscInt numPoints = 0;
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(_slipDM, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = 0; p < closureSize*2; p += 2) {
+            const PetscInt point = closure[p];
+            PetscInt dof = 0, off = 0;
+            // Slip is always the first subfield of _slipDM.
+            err = PetscSectionGetFieldDof(slipSection, point, 0, &dof);PYLITH_CHECK_ERROR(err);
+            if (!dof) { continue; }
+            assert(spaceDim == dof);
+            err = PetscSectionGetFieldOffset(slipSection, point, 0, &off);PYLITH_CHECK_ERROR(err);
+            for (PetscInt i = 0; i < spaceDim; ++i) {
+                slipAvg[i] += slipArray[off+i];
+            } // for
+            ++numPoints;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(_slipDM, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        if (!numPoints) { continue; }
+        for (int i = 0; i < spaceDim; ++i) {
+            slipAvg[i] /= numPoints;
+        } // for
+
+        // Slip vector in global coordinates from the same frame the FE kernels use for the slip
+        // components; (strike, up-dip, normal) is a right-handed triple.
+        PylithScalar strikeDir[3], upDipDir[3];
+        pylith::fekernels::BoundaryDirections::tangential_directions(strikeDir, upDipDir, _refDir1, _refDir2, normalDir);
+        PylithScalar slipGlobal[3];
+        for (int i = 0; i < spaceDim; ++i) {
+            slipGlobal[i] = slipAvg[0]*normalDir[i] + slipAvg[1]*strikeDir[i] + slipAvg[2]*upDipDir[i];
+        } // for
+
+        // Okada frame for the cell: x along the horizontal strike direction, z up. A negative
+        // cosine of the dip corresponds to the fault normal pointing downward (dip angle beyond
+        // 90 degrees), which the point-source formulas handle without special cases.
+        const PylithReal sinDip = sqrt(normalDir[0]*normalDir[0] + normalDir[1]*normalDir[1]);
+        const PylithReal cosDip = normalDir[2];
+        PylithReal strikeOkada[3];
+        if (sinDip > 1.0e-8) {
+            strikeOkada[0] = -normalDir[1] / sinDip;
+            strikeOkada[1] = +normalDir[0] / sinDip;
+            strikeOkada[2] = 0.0;
+        } else { // Horizontal fault; strike direction is arbitrary.
+            strikeOkada[0] = 1.0;
+            strikeOkada[1] = 0.0;
+            strikeOkada[2] = 0.0;
+        } // if/else
+        const PylithReal upDipOkada[3] = {
+            normalDir[1]*strikeOkada[2] - normalDir[2]*strikeOkada[1],
+            normalDir[2]*strikeOkada[0] - normalDir[0]*strikeOkada[2],
+            normalDir[0]*strikeOkada[1] - normalDir[1]*strikeOkada[0],
+        };
+        const PylithReal acrossOkada[3] = { -strikeOkada[1], strikeOkada[0], 0.0 }; // z cross strike
+
+        const PylithReal potencyStrikeSlip =
+            (slipGlobal[0]*strikeOkada[0] + slipGlobal[1]*strikeOkada[1] + slipGlobal[2]*strikeOkada[2]) * area;
+        const PylithReal potencyDipSlip =
+            (slipGlobal[0]*upDipOkada[0] + slipGlobal[1]*upDipOkada[1] + slipGlobal[2]*upDipOkada[2]) * area;
+        const PylithReal potencyOpening =
+            (slipGlobal[0]*normalDir[0] + slipGlobal[1]*normalDir[1] + slipGlobal[2]*normalDir[2]) * area;
+
+        for (int iStation = 0; iStation < numStations; ++iStation) {
+            const PylithReal* coords = &stationCoords[iStation*spaceDim];
+            const PylithReal relative[3] = {
+                coords[0] - centroid[0],
+                coords[1] - centroid[1],
+                coords[2] - centroid[2],
+            };
+            const PylithReal depth = relative[2]; // Source depth below the station.
+            if (depth <= 0.0) { continue; } // Half-space solution requires the source below the station.
+            const PylithReal xOkada =
+                relative[0]*strikeOkada[0] + relative[1]*strikeOkada[1] + relative[2]*strikeOkada[2];
+            const PylithReal yOkada =
+                relative[0]*acrossOkada[0] + relative[1]*acrossOkada[1];
+
+            PylithScalar dispOkada[3] = { 0.0, 0.0, 0.0 };
+            _FaultCohesiveKin::okadaPointSourceDisp(dispOkada, xOkada, yOkada, depth, sinDip, cosDip,
+                                                    potencyStrikeSlip, potencyDipSlip, potencyOpening, poissonRatio);
+
+            PylithScalar* disp = &displacements[iStation*spaceDim];
+            disp[0] += dispOkada[0]*strikeOkada[0] + dispOkada[1]*acrossOkada[0];
+            disp[1] += dispOkada[0]*strikeOkada[1] + dispOkada[1]*acrossOkada[1];
+            disp[2] += dispOkada[2];
+        } // for
+    } // for
+
+    err = ISRestoreIndices(globalCellNumbersIS, &globalCellNumbers);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(_slipVecTotal, &slipArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // estimateSurfaceDisplacements
+
+
 // ------------------------------------------------------------------------------------------------
 // Get auxiliary factory associated with physics.
 pylith::feassemble::AuxiliaryFactory*
@@ -322,7 +628,7 @@ pylith::faults::FaultCohesiveKin::_updateSlip(pylith::topology::Field* auxiliary
         err = VecSet(_slipVecRupture, 0.0);PYLITH_CHECK_ERROR(err);
 
         KinSrc* src = r_iter->second;assert(src);
-        src->getSlipSubfields(_slipVecRupture, auxiliaryField, t, _normalizer->getTimeScale(), bitSlipSubfields);
+        src->getSlipSubfields(_slipVecRupture, _slipDM, t, _normalizer->getTimeScale(), bitSlipSubfields);
         err = VecAYPX(_slipVecTotal, 1.0, _slipVecRupture);
     } // for
 
@@ -333,12 +639,15 @@ pylith::faults::FaultCohesiveKin::_updateSlip(pylith::topology::Field* auxiliary
     PetscInt numSubfields = 0;
     if (bitSlipSubfields & KinSrc::GET_SLIP) {
         subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip").index;
+        auxiliaryField->markSubfieldDirty("slip");
     } // if
     if (bitSlipSubfields & KinSrc::GET_SLIP_RATE) {
         subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip_rate").index;
+        auxiliaryField->markSubfieldDirty("slip_rate");
     } // if
     if (bitSlipSubfields & KinSrc::GET_SLIP_ACC) {
         subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip_acceleration").index;
+        auxiliaryField->markSubfieldDirty("slip_acceleration");
     } // if
 
     pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField);
@@ -368,6 +677,101 @@ pylith::faults::FaultCohesiveKin::_updateSlip(pylith::topology::Field* auxiliary
 } // _updateSlip
 
 
+// ------------------------------------------------------------------------------------------------
+// Precompute fault tangential directions in auxiliary field (3D only).
+void
+pylith::faults::FaultCohesiveKin::_computeTangentialDirections(pylith::topology::Field* auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeTangentialDirections(auxiliaryField="<<auxiliaryField<<")");
+
+    assert(auxiliaryField);
+    const int spaceDim = 3;
+
+    const PetscInt indexStrikeDir = auxiliaryField->getSubfieldInfo("strike_dir").index;
+    const PetscInt indexUpDipDir = auxiliaryField->getSubfieldInfo("up_dip_dir").index;
+
+    PetscErrorCode err = 0;
+    PetscDM dmAux = auxiliaryField->getDM();
+
+    { // Accumulate per-cell directions at the points in the cell closure; points shared by multiple
+      // cells get the average direction (renormalized below), matching the FE interpolation of the
+      // cached subfields to the quadrature points.
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField);
+        PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+
+        PetscInt cStart = 0, cEnd = 0;
+        err = DMPlexGetHeightStratum(dmAux, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PylithReal area = 0.0;
+            PylithReal centroid[3];
+            PylithReal normalDir[3];
+            err = DMPlexComputeCellGeometryFVM(dmAux, cell, &area, centroid, normalDir);PYLITH_CHECK_ERROR(err);
+
+            // The fault surface cells are oriented so that the normal points from the negative side
+            // of the fault to the positive side, matching the normal passed to the FE kernels.
+            PylithScalar strikeDir[3], upDipDir[3];
+            pylith::fekernels::BoundaryDirections::tangential_directions(strikeDir, upDipDir, _refDir1, _refDir2, normalDir);
+
+            PetscInt* closure = NULL;
+            PetscInt closureSize = 0;
+            err = DMPlexGetTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt p = 0; p < closureSize*2; p += 2) {
+                const PetscInt point = closure[p];
+                const PetscInt strikeDof = auxiliaryVisitor.sectionSubfieldDof(indexStrikeDir, point);
+                if (!strikeDof) { continue; }
+                assert(spaceDim == strikeDof);
+                const PetscInt strikeOff = auxiliaryVisitor.sectionSubfieldOffset(indexStrikeDir, point);
+                const PetscInt upDipOff = auxiliaryVisitor.sectionSubfieldOffset(indexUpDipDir, point);
+                for (PetscInt i = 0; i < spaceDim; ++i) {
+                    auxiliaryArray[strikeOff+i] += strikeDir[i];
+                    auxiliaryArray[upDipOff+i] += upDipDir[i];
+                } // for
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // Accumulate
+
+    // Combine contributions from cells on other processes so that points shared across processes
+    // have consistent directions.
+    PetscVec globalVec = NULL;
+    err = DMGetGlobalVector(dmAux, &globalVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(globalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmAux, auxiliaryField->getLocalVector(), ADD_VALUES, globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmAux, auxiliaryField->getLocalVector(), ADD_VALUES, globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmAux, globalVec, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmAux, globalVec, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMRestoreGlobalVector(dmAux, &globalVec);PYLITH_CHECK_ERROR(err);
+
+    { // Renormalize the accumulated directions.
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField);
+        PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+
+        PetscInt pStart = 0, pEnd = 0;
+        err = PetscSectionGetChart(auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        const PetscInt subfieldIndices[2] = { indexStrikeDir, indexUpDipDir };
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            for (size_t iSubfield = 0; iSubfield < 2; ++iSubfield) {
+                const PetscInt subfieldIndex = subfieldIndices[iSubfield];
+                if (!auxiliaryVisitor.sectionSubfieldDof(subfieldIndex, point)) { continue; }
+                const PetscInt subfieldOff = auxiliaryVisitor.sectionSubfieldOffset(subfieldIndex, point);
+                PylithScalar mag = 0.0;
+                for (PetscInt i = 0; i < spaceDim; ++i) {
+                    mag += auxiliaryArray[subfieldOff+i] * auxiliaryArray[subfieldOff+i];
+                } // for
+                mag = sqrt(mag);
+                if (mag > 0.0) {
+                    for (PetscInt i = 0; i < spaceDim; ++i) {
+                        auxiliaryArray[subfieldOff+i] /= mag;
+                    } // for
+                } // if
+            } // for
+        } // for
+    } // Renormalize
+
+    PYLITH_METHOD_END;
+} // _computeTangentialDirections
+
+
 // ------------------------------------------------------------------------------------------------
 // Set kernels for residual.
 void
@@ -91,6 +91,51 @@ public:
     void updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
                               const double t);
 
+    /// Re-query kinematic rupture parameters from the spatial databases.
+    ///
+    /// Fast path for parameter sweeps in which only the slip distributions change; keeps the
+    /// mesh, discretization, and matrix structure.
+    void reinitializeRuptureParameters(void);
+
+    /** Pre-tabulate slip subfields of kinematic ruptures for uniform time stepping.
+     *
+     * Turns per-step evaluation of the slip time functions into table reads for explicit
+     * dynamic runs with a uniform time step; see KinSrc::tabulateSlipSubfields().
+     *
+     * @param[in] tStart Nondimensional time of first step.
+     * @param[in] dt Nondimensional time step (must be positive).
+     * @param[in] numSteps Number of time steps.
+     */
+    void tabulateSlipTimeSeries(const PylithReal tStart,
+                                const PylithReal dt,
+                                const size_t numSteps);
+
+    /** Accumulate analytic half-space estimates of surface displacements at stations (3D only).
+     *
+     * Sums Okada (1985) point-source contributions for the kinematic slip of this fault at
+     * time t, treating each fault cell as a point dislocation in a homogeneous elastic
+     * half space with a free surface at z=0. Intended for screening candidate rupture
+     * models against the same station set used for OutputSolnPoints without running the
+     * finite-element problem; not a substitute for the finite-element solution when the
+     * domain has heterogeneous properties or topography.
+     *
+     * Only contributions from fault cells owned by this process are accumulated; the
+     * caller is responsible for summing across processes.
+     *
+     * @param[inout] displacements Array of station displacements [numStations * spaceDim].
+     * @param[in] stationCoords Array of station coordinates [numStations * spaceDim].
+     * @param[in] numStations Number of stations.
+     * @param[in] spaceDim Spatial dimension for coordinates and displacements.
+     * @param[in] t Nondimensional time at which to evaluate slip.
+     * @param[in] poissonRatio Poisson's ratio for the half space.
+     */
+    void estimateSurfaceDisplacements(PylithScalar* displacements,
+                                      const PylithReal* stationCoords,
+                                      const int numStations,
+                                      const int spaceDim,
+                                      const PylithReal t,
+                                      const PylithReal poissonRatio);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -110,6 +155,16 @@ protected:
                      const double t,
                      const int bitSlipSubfields);
 
+    /** Precompute fault tangential directions in auxiliary field (3D only).
+     *
+     * The fault geometry is fixed after initialization, so we compute the along-strike and up-dip
+     * directions once and cache them in auxiliary subfields instead of rebuilding the orthonormal
+     * frame from the reference directions at every quadrature point in the residual kernels.
+     *
+     * @param[out] auxiliaryField Auxiliary field.
+     */
+    void _computeTangentialDirections(pylith::topology::Field* auxiliaryField) const;
+
     /** Set kernels for residual.
      *
      * @param[out] integrator Integrator for material.
@@ -140,6 +195,7 @@ protected:
 
     pylith::faults::AuxiliaryFactoryKinematic* _auxiliaryFactory; ///< Factory for auxiliary subfields.
     srcs_type _ruptures; ///< Array of kinematic earthquake ruptures.
+    PetscDM _slipDM; ///< PETSc DM holding only the slip-related subfields of the auxiliary field.
     PetscVec _slipVecRupture; ///< PETSc local Vec to hold slip for one kinematic rupture.
     PetscVec _slipVecTotal; ///< PETSc local Vec to hold slip for all kinematic ruptures.
 
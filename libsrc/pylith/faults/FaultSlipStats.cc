@@ -0,0 +1,335 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "FaultSlipStats.hh" // implementation of class methods
+
+#include "pylith/feassemble/PhysicsImplementation.hh" // USES PhysicsImplementation
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "petscdmplex.h" // USES DMPlex*
+
+#include <cassert> // USES assert()
+#include <cmath> // USES sqrt(), log10()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+namespace pylith {
+    namespace faults {
+        namespace _FaultSlipStats {
+            /// Moment magnitude when the seismic moment is not positive (no slip yet).
+            static const double magnitudeUndefined = -99.0;
+        } // _FaultSlipStats
+    } // faults
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::faults::FaultSlipStats::FaultSlipStats(void) :
+    _filename(""),
+    _h5(new pylith::meshio::HDF5),
+    _shearModulus(3.0e+10),
+    _slipThreshold(0.0),
+    _timeScale(1.0),
+    _numRecords(0) {
+    PyreComponent::setName("faultslipstats");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::faults::FaultSlipStats::~FaultSlipStats(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::faults::FaultSlipStats::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_h5 && _h5->isOpen()) {
+        _h5->close();
+    } // if
+    delete _h5;_h5 = NULL;
+
+    ObserverPhysics::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set filename for HDF5 slip statistics file.
+void
+pylith::faults::FaultSlipStats::setFilename(const char* filename) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setFilename(filename="<<filename<<")");
+
+    _filename = filename;
+
+    PYLITH_METHOD_END;
+} // setFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get filename for HDF5 slip statistics file.
+const char*
+pylith::faults::FaultSlipStats::getFilename(void) const {
+    return _filename.c_str();
+} // getFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set shear modulus used to compute the seismic moment.
+void
+pylith::faults::FaultSlipStats::setShearModulus(const PylithReal value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setShearModulus(value="<<value<<")");
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Shear modulus (" << value << ") for fault slip statistics '"
+            << PyreComponent::getIdentifier() << "' must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _shearModulus = value;
+
+    PYLITH_METHOD_END;
+} // setShearModulus
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set slip threshold defining the rupture area.
+void
+pylith::faults::FaultSlipStats::setSlipThreshold(const PylithReal value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setSlipThreshold(value="<<value<<")");
+
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Slip threshold (" << value << ") for fault slip statistics '"
+            << PyreComponent::getIdentifier() << "' must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _slipThreshold = value;
+
+    PYLITH_METHOD_END;
+} // setSlipThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set time scale.
+void
+pylith::faults::FaultSlipStats::setTimeScale(const PylithReal value) {
+    _timeScale = value;
+} // setTimeScale
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify observer is compatible with solution.
+void
+pylith::faults::FaultSlipStats::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    if (_filename.empty()) {
+        std::ostringstream msg;
+        msg << "No filename given for fault slip statistics '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Receive update (subject of observer).
+void
+pylith::faults::FaultSlipStats::update(const PylithReal t,
+                                       const PylithInt tindex,
+                                       const pylith::topology::Field& solution,
+                                       const bool infoOnly) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("update(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<", infoOnly="<<infoOnly<<")");
+
+    if (infoOnly) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_physics);
+    const pylith::topology::Field* auxiliaryField = _physics->getAuxiliaryField();assert(auxiliaryField);
+    if (!auxiliaryField->hasSubfield("slip")) {
+        std::ostringstream msg;
+        msg << "Fault slip statistics '" << PyreComponent::getIdentifier() << "' requires a fault with a slip "
+            << "auxiliary subfield; physics '" << _physics->getName() << "' has no slip subfield.";
+        throw std::runtime_error(msg.str());
+    } // if
+    const pylith::topology::Field::SubfieldInfo& slipInfo = auxiliaryField->getSubfieldInfo("slip");
+    const PetscInt indexSlip = slipInfo.index;
+    const PylithReal lengthScale = slipInfo.description.scale;
+    const bool hasSlipRate = auxiliaryField->hasSubfield("slip_rate");
+    const PetscInt indexSlipRate = hasSlipRate ? auxiliaryField->getSubfieldInfo("slip_rate").index : -1;
+
+    const PylithReal slipThreshold = _slipThreshold / lengthScale; // nondimensional
+
+    PetscErrorCode err = 0;
+    PetscDM dmAux = auxiliaryField->getDM();
+    PetscInt cellDim = 0;
+    err = DMGetDimension(dmAux, &cellDim);PYLITH_CHECK_ERROR(err);
+
+    // Cells in the overlap are owned by another process; skip them so each fault cell
+    // contributes exactly once.
+    PetscSF sf = NULL;
+    err = DMGetPointSF(dmAux, &sf);PYLITH_CHECK_ERROR(err);
+    const PetscInt* leaves = NULL;
+    PetscInt numLeaves = 0;
+    err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Area-weighted sums over the fault cells owned by this process. The slip magnitude uses the
+    // shear components only (the opening component is excluded).
+    double sumsLocal[3] = { 0.0, 0.0, 0.0 }; // potency (area*slip), potency rate, rupture area
+    pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField);
+    const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmAux, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt loc = -1;
+        err = PetscFindInt(cell, numLeaves, leaves, &loc);PYLITH_CHECK_ERROR(err);
+        if (loc >= 0) { continue; } // cell in overlap
+
+        PylithReal area = 0.0;
+        PylithReal centroid[3];
+        err = DMPlexComputeCellGeometryFVM(dmAux, cell, &area, centroid, NULL);PYLITH_CHECK_ERROR(err);
+
+        // Average the slip magnitude over the points in the cell closure with slip degrees of
+        // freedom (discrete approximation of the integral over the cell).
+        double slipSum = 0.0;
+        double slipRateSum = 0.0;
+        PetscInt numPoints = 0;
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = 0; p < closureSize*2; p += 2) {
+            const PetscInt point = closure[p];
+            const PetscInt slipDof = auxiliaryVisitor.sectionSubfieldDof(indexSlip, point);
+            if (!slipDof) { continue; }
+            const PetscInt slipOff = auxiliaryVisitor.sectionSubfieldOffset(indexSlip, point);
+            double slipMagSq = 0.0;
+            for (PetscInt i = 1; i < slipDof; ++i) { // skip opening component
+                slipMagSq += auxiliaryArray[slipOff+i] * auxiliaryArray[slipOff+i];
+            } // for
+            slipSum += sqrt(slipMagSq);
+            if (hasSlipRate) {
+                const PetscInt slipRateOff = auxiliaryVisitor.sectionSubfieldOffset(indexSlipRate, point);
+                double slipRateMagSq = 0.0;
+                for (PetscInt i = 1; i < slipDof; ++i) {
+                    slipRateMagSq += auxiliaryArray[slipRateOff+i] * auxiliaryArray[slipRateOff+i];
+                } // for
+                slipRateSum += sqrt(slipRateMagSq);
+            } // if
+            ++numPoints;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        if (!numPoints) { continue; }
+
+        const double slipMean = slipSum / numPoints;
+        if (slipMean > slipThreshold) {
+            sumsLocal[0] += area * slipMean;
+            sumsLocal[1] += area * slipRateSum / numPoints;
+            sumsLocal[2] += area;
+        } // if
+    } // for
+
+    MPI_Comm comm = PetscObjectComm((PetscObject)dmAux);
+    int rank = 0;
+    err = MPI_Comm_rank(comm, &rank);PYLITH_CHECK_ERROR(err);
+    const bool isMaster = 0 == rank;
+    double sums[3] = { 0.0, 0.0, 0.0 };
+    err = MPI_Reduce(sumsLocal, sums, 3, MPI_DOUBLE, MPI_SUM, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (!isMaster) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Dimensionalize. Cell areas are length^cellDim and slip is length, so the potency is
+    // length^(cellDim+1).
+    const double areaScale = pow(lengthScale, cellDim);
+    const double potency = sums[0] * areaScale * lengthScale;
+    const double potencyRate = sums[1] * areaScale * lengthScale / _timeScale;
+    const double ruptureArea = sums[2] * areaScale;
+
+    const double moment = _shearModulus * potency;
+    const double magnitude = (moment > 0.0) ? 2.0/3.0*(log10(moment) - 9.05) : _FaultSlipStats::magnitudeUndefined;
+    const double meanSlip = (ruptureArea > 0.0) ? potency / ruptureArea : 0.0;
+    const double meanSlipRate = (ruptureArea > 0.0) ? potencyRate / ruptureArea : 0.0;
+
+    _appendRecord(t*_timeScale, moment, magnitude, ruptureArea, meanSlip, meanSlipRate);
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Append record to HDF5 slip statistics file, creating the file for the first record.
+void
+pylith::faults::FaultSlipStats::_appendRecord(const double t,
+                                              const double moment,
+                                              const double magnitude,
+                                              const double area,
+                                              const double meanSlip,
+                                              const double meanSlipRate) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_h5);
+
+    static const size_t numDatasets = 6;
+    const char* datasetNames[numDatasets] = {
+        "time", "seismic_moment", "moment_magnitude", "rupture_area", "mean_slip", "mean_slip_rate",
+    };
+    const double values[numDatasets] = { t, moment, magnitude, area, meanSlip, meanSlipRate };
+
+    const int ndims = 2;
+    const hsize_t dimsChunk[2] = { 1, 1 };
+    if (!_h5->isOpen()) {
+        assert(0 == _numRecords);
+        _h5->open(_filename.c_str(), H5F_ACC_TRUNC);
+        const hsize_t maxDims[2] = { H5S_UNLIMITED, 1 };
+        for (size_t i = 0; i < numDatasets; ++i) {
+            _h5->createDataset("/", datasetNames[i], maxDims, dimsChunk, ndims, H5T_NATIVE_DOUBLE);
+        } // for
+    } // if
+
+    const hsize_t dims[2] = { hsize_t(_numRecords+1), 1 };
+    for (size_t i = 0; i < numDatasets; ++i) {
+        _h5->writeDatasetChunk("/", datasetNames[i], &values[i], dims, dimsChunk, ndims, int(_numRecords), H5T_NATIVE_DOUBLE);
+    } // for
+    ++_numRecords;
+
+    PYLITH_METHOD_END;
+} // _appendRecord
+
+
+// End of file
@@ -0,0 +1,153 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/faults/FaultSlipStats.hh
+ *
+ * @brief Observer of a fault that writes scalar slip statistics (seismic moment, moment
+ * magnitude, rupture area, mean slip, mean slip rate) as time series.
+ *
+ * Computes the statistics during the run from the slip in the fault auxiliary field, which is
+ * in memory at update time, so deriving the scalars is essentially free compared with
+ * post-processing the full fault output archives. The statistics use the magnitude of the
+ * shear components of slip (the opening component is excluded); the seismic moment uses a
+ * uniform shear modulus. The time series are appended to a small HDF5 file as the simulation
+ * runs.
+ */
+
+#if !defined(pylith_faults_faultslipstats_hh)
+#define pylith_faults_faultslipstats_hh
+
+#include "faultsfwd.hh" // forward declarations
+
+#include "pylith/problems/ObserverPhysics.hh" // ISA ObserverPhysics
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/meshio/meshiofwd.hh" // HOLDSA HDF5
+#include "pylith/topology/topologyfwd.hh" // USES Field
+
+#include <string> // HASA std::string
+
+class pylith::faults::FaultSlipStats : public pylith::problems::ObserverPhysics, public pylith::utils::PyreComponent {
+    friend class TestFaultSlipStats; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    FaultSlipStats(void);
+
+    /// Destructor
+    virtual ~FaultSlipStats(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename for HDF5 slip statistics file.
+     *
+     * @param[in] filename Name of HDF5 slip statistics file.
+     */
+    void setFilename(const char* filename);
+
+    /** Get filename for HDF5 slip statistics file.
+     *
+     * @returns Name of HDF5 slip statistics file.
+     */
+    const char* getFilename(void) const;
+
+    /** Set shear modulus used to compute the seismic moment.
+     *
+     * @param[in] value Uniform shear modulus (Pa).
+     */
+    void setShearModulus(const PylithReal value);
+
+    /** Set slip threshold defining the rupture area.
+     *
+     * Cells with shear slip magnitude above the threshold contribute to the rupture area, mean
+     * slip, and mean slip rate.
+     *
+     * @param[in] value Slip threshold (m).
+     */
+    void setSlipThreshold(const PylithReal value);
+
+    /** Set time scale.
+     *
+     * @param[in] value Time scale for dimensionalizing time.
+     */
+    void setTimeScale(const PylithReal value);
+
+    /** Verify observer is compatible with solution.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Receive update (subject of observer).
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after initialization).
+     */
+    void update(const PylithReal t,
+                const PylithInt tindex,
+                const pylith::topology::Field& solution,
+                const bool infoOnly);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Append record to HDF5 slip statistics file, creating the file for the first record.
+     *
+     * Only the master process writes the file.
+     *
+     * @param[in] t Dimensional time (s).
+     * @param[in] moment Seismic moment (N*m).
+     * @param[in] magnitude Moment magnitude.
+     * @param[in] area Rupture area (m^2).
+     * @param[in] meanSlip Mean slip over the rupture area (m).
+     * @param[in] meanSlipRate Mean slip rate over the rupture area (m/s).
+     */
+    void _appendRecord(const double t,
+                       const double moment,
+                       const double magnitude,
+                       const double area,
+                       const double meanSlip,
+                       const double meanSlipRate);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of HDF5 slip statistics file.
+    pylith::meshio::HDF5* _h5; ///< HDF5 slip statistics file (master process only).
+    PylithReal _shearModulus; ///< Uniform shear modulus (Pa).
+    PylithReal _slipThreshold; ///< Slip threshold defining the rupture area (m).
+    PylithReal _timeScale; ///< Time scale for dimensionalizing time.
+    size_t _numRecords; ///< Number of records written.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    FaultSlipStats(const FaultSlipStats&); ///< Not implemented.
+    const FaultSlipStats& operator=(const FaultSlipStats&); ///< Not implemented
+
+}; // FaultSlipStats
+
+#endif // pylith_faults_faultslipstats_hh
+
+// End of file
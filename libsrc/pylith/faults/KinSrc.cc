@@ -21,8 +21,10 @@
 #include "KinSrc.hh" // implementation of object methods
 
 #include "pylith/faults/KinSrcAuxiliaryFactory.hh" // USES KinSrcAuxiliaryFactory
+#include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps::checkDisretization()
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN
@@ -31,6 +33,7 @@
 
 #include <typeinfo> // USES typeid()
 #include <cassert> // USES assert()
+#include <cmath> // USES HUGE_VAL
 
 // ------------------------------------------------------------------------------------------------
 const int pylith::faults::KinSrc::GET_SLIP = 0x1;
@@ -45,7 +48,13 @@ pylith::faults::KinSrc::KinSrc(void) :
     _slipRateFnKernel(NULL),
     _slipAccFnKernel(NULL),
     _auxiliaryField(NULL),
-    _originTime(0.0) {}
+    _originTime(0.0),
+    _steadyTime(HUGE_VAL),
+    _slipVecSteady(NULL),
+    _slipVecSteadyBits(0),
+    _tableTStart(0.0),
+    _tableDt(0.0),
+    _tableBits(0) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -61,6 +70,12 @@ void
 pylith::faults::KinSrc::deallocate(void) {
     delete _auxiliaryField;_auxiliaryField = NULL;
     delete _auxiliaryFactory;_auxiliaryFactory = NULL;
+
+    PetscErrorCode err = VecDestroy(&_slipVecSteady);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < _slipVecsTable.size(); ++i) {
+        err = VecDestroy(&_slipVecsTable[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _slipVecsTable.clear();
 } // deallocate
 
 
@@ -133,6 +148,11 @@ pylith::faults::KinSrc::initialize(const pylith::topology::Field& faultAuxField,
 
     _auxiliaryFactory->setValuesFromDB();
 
+    _steadyTime = _getSteadyTime();
+    if (_steadyTime < HUGE_VAL) {
+        PYLITH_COMPONENT_DEBUG("Slip subfields are constant after nondimensional time "<<_steadyTime<<".");
+    } // if
+
     pythia::journal::debug_t debug(PyreComponent::getName());
     if (debug.state()) {
         PYLITH_COMPONENT_DEBUG("Displaying kinematic earthquake source auxiliary field");
@@ -143,16 +163,53 @@ pylith::faults::KinSrc::initialize(const pylith::topology::Field& faultAuxField,
 } // initialize
 
 
+// ------------------------------------------------------------------------------------------------
+// Re-query auxiliary field values from the spatial database.
+void
+pylith::faults::KinSrc::reinitializeParameters(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("reinitializeParameters()");
+
+    if (!_auxiliaryField) {
+        PYLITH_COMPONENT_LOGICERROR("Cannot reinitialize parameters for earthquake source before it is initialized.");
+    } // if
+
+    assert(_auxiliaryFactory);
+    _auxiliaryFactory->setValuesFromDB();
+
+    // Invalidate cached values that depend on the rupture parameters.
+    PetscErrorCode err = VecDestroy(&_slipVecSteady);PYLITH_CHECK_ERROR(err);
+    _slipVecSteadyBits = 0;
+    for (size_t i = 0; i < _slipVecsTable.size(); ++i) {
+        err = VecDestroy(&_slipVecsTable[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _slipVecsTable.clear();
+    _tableBits = 0;
+    _steadyTime = _getSteadyTime();
+    if (_steadyTime < HUGE_VAL) {
+        PYLITH_COMPONENT_DEBUG("Slip subfields are constant after nondimensional time "<<_steadyTime<<".");
+    } // if
+
+    pythia::journal::debug_t debug(PyreComponent::getName());
+    if (debug.state()) {
+        PYLITH_COMPONENT_DEBUG("Displaying kinematic earthquake source auxiliary field");
+        _auxiliaryField->view("KinSrc auxiliary field");
+    } // if
+
+    PYLITH_METHOD_END;
+} // reinitializeParameters
+
+
 // ------------------------------------------------------------------------------------------------
 // Get requested slip subfields at time t.
 void
 pylith::faults::KinSrc::getSlipSubfields(PetscVec slipLocalVec,
-                                         pylith::topology::Field* faultAuxiliaryField,
+                                         PetscDM slipDM,
                                          const PylithScalar t,
                                          const PylithScalar timeScale,
                                          const int bitSlipSubfields) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("getSlipSubfields(slipLocalVec="<<slipLocalVec<<", faultAuxiliaryField="<<faultAuxiliaryField
+    PYLITH_COMPONENT_DEBUG("getSlipSubfields(slipLocalVec="<<slipLocalVec<<", slipDM="<<slipDM
                                                            <<", t="<<t<<", timeScale="<<timeScale<<")");
 
     if (!_slipFnKernel || (t < _originTime)) {
@@ -162,7 +219,25 @@ pylith::faults::KinSrc::getSlipSubfields(PetscVec slipLocalVec,
     assert(slipLocalVec);
     assert(_auxiliaryField);
 
-    _setFEConstants(*faultAuxiliaryField); // Constants are attached to the auxiliary field for the slip vector.
+    PetscErrorCode err = 0;
+    if (!_slipVecsTable.empty() && (bitSlipSubfields == _tableBits) && (_tableDt > 0.0)) {
+        // Uniform-dt time stepping with pre-tabulated slip subfields; read the table instead
+        // of evaluating the slip time function.
+        const PylithReal stepFloat = (t - _tableTStart) / _tableDt;
+        const PetscInt step = PetscInt(round(stepFloat));
+        if ((step >= 0) && (size_t(step) < _slipVecsTable.size()) && (fabs(stepFloat - step) < 1.0e-4)) {
+            err = VecCopy(_slipVecsTable[step], slipLocalVec);PYLITH_CHECK_ERROR(err);
+            PYLITH_METHOD_END;
+        } // if
+    } // if
+    if ((t >= _steadyTime) && _slipVecSteady && (bitSlipSubfields == _slipVecSteadyBits)) {
+        // Rupture has completed and the constant slip subfields are cached; skip evaluating
+        // the slip time function.
+        err = VecCopy(_slipVecSteady, slipLocalVec);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    _setFEConstants(slipDM); // Constants are attached to the DM for the slip vector.
 
     PetscPointFunc subfieldKernels[3];
     size_t numSubfields = 0;
@@ -175,35 +250,129 @@ pylith::faults::KinSrc::getSlipSubfields(PetscVec slipLocalVec,
     if (bitSlipSubfields & GET_SLIP_ACC) {
         subfieldKernels[numSubfields++] = _slipAccFnKernel;
     } // if
-    assert(faultAuxiliaryField->getSubfieldNames().size() == numSubfields);
+    PetscInt numFields = 0;
+    err = DMGetNumFields(slipDM, &numFields);PYLITH_CHECK_ERROR(err);
+    assert(size_t(numFields) == numSubfields);
 
     // Create local vector for slip for this source.
-    PetscErrorCode err = 0;
-    PetscDM faultAuxiliaryDM = faultAuxiliaryField->getDM();
     PetscDMLabel dmLabel = NULL;
     PetscInt labelValue = 0;
     const PetscInt part = 0;
-    err = DMSetAuxiliaryVec(faultAuxiliaryDM, dmLabel, labelValue, part,
+    err = DMSetAuxiliaryVec(slipDM, dmLabel, labelValue, part,
                             _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMProjectFieldLocal(faultAuxiliaryDM, t, slipLocalVec, subfieldKernels, INSERT_VALUES,
+    err = DMProjectFieldLocal(slipDM, t, slipLocalVec, subfieldKernels, INSERT_VALUES,
                               slipLocalVec);PYLITH_CHECK_ERROR(err);
 
+    if (t >= _steadyTime) {
+        // Cache the now-constant slip subfields for subsequent time steps.
+        if (!_slipVecSteady) {
+            err = VecDuplicate(slipLocalVec, &_slipVecSteady);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecCopy(slipLocalVec, _slipVecSteady);PYLITH_CHECK_ERROR(err);
+        _slipVecSteadyBits = bitSlipSubfields;
+    } // if
+
     PYLITH_METHOD_END;
 } // getSlipSubfields
 
 
+// ------------------------------------------------------------------------------------------------
+// Pre-tabulate slip subfields for uniform time stepping.
+void
+pylith::faults::KinSrc::tabulateSlipSubfields(PetscDM slipDM,
+                                              const PylithReal tStart,
+                                              const PylithReal dt,
+                                              const size_t numSteps,
+                                              const int bitSlipSubfields) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("tabulateSlipSubfields(slipDM="<<slipDM<<", tStart="<<tStart<<", dt="<<dt
+                                                          <<", numSteps="<<numSteps<<", bitSlipSubfields="<<bitSlipSubfields<<")");
+
+    assert(slipDM);
+    assert(dt > 0.0);
+    assert(_auxiliaryField);
+
+    PetscErrorCode err = 0;
+    for (size_t i = 0; i < _slipVecsTable.size(); ++i) {
+        err = VecDestroy(&_slipVecsTable[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _slipVecsTable.clear();
+    _tableBits = 0;
+
+    if (!_slipFnKernel) {
+        PYLITH_METHOD_END;
+    } // if
+    if (_steadyTime >= HUGE_VAL) {
+        // Slip subfields never become constant; tabulating the full run would be unbounded in
+        // memory, so keep per-step evaluation of the slip time function.
+        PYLITH_COMPONENT_DEBUG("Slip subfields never become constant; skipping slip table.");
+        PYLITH_METHOD_END;
+    } // if
+
+    // Tabulate only the active time window of the rupture; the steady cache in
+    // getSlipSubfields() covers later times.
+    size_t numStepsTable = numSteps;
+    if (tStart + (numStepsTable-1)*dt > _steadyTime) {
+        numStepsTable = size_t(ceil((_steadyTime - tStart) / dt)) + 1;
+    } // if
+    if (numStepsTable < 1) {
+        PYLITH_METHOD_END;
+    } // if
+
+    _setFEConstants(slipDM); // Constants are attached to the DM for the slip vector.
+
+    PetscPointFunc subfieldKernels[3];
+    size_t numSubfields = 0;
+    if (bitSlipSubfields & GET_SLIP) {
+        subfieldKernels[numSubfields++] = _slipFnKernel;
+    } // if
+    if (bitSlipSubfields & GET_SLIP_RATE) {
+        subfieldKernels[numSubfields++] = _slipRateFnKernel;
+    } // if
+    if (bitSlipSubfields & GET_SLIP_ACC) {
+        subfieldKernels[numSubfields++] = _slipAccFnKernel;
+    } // if
+    PetscInt numFields = 0;
+    err = DMGetNumFields(slipDM, &numFields);PYLITH_CHECK_ERROR(err);
+    assert(size_t(numFields) == numSubfields);
+
+    PetscDMLabel dmLabel = NULL;
+    PetscInt labelValue = 0;
+    const PetscInt part = 0;
+    err = DMSetAuxiliaryVec(slipDM, dmLabel, labelValue, part,
+                            _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+
+    _slipVecsTable.resize(numStepsTable);
+    for (size_t iStep = 0; iStep < numStepsTable; ++iStep) {
+        const PylithReal t = tStart + iStep*dt;
+        err = DMCreateLocalVector(slipDM, &_slipVecsTable[iStep]);PYLITH_CHECK_ERROR(err);
+        err = VecSet(_slipVecsTable[iStep], 0.0);PYLITH_CHECK_ERROR(err);
+        if (t < _originTime) { continue; } // Match getSlipSubfields(); entry is never read.
+        err = DMProjectFieldLocal(slipDM, t, _slipVecsTable[iStep], subfieldKernels, INSERT_VALUES,
+                                  _slipVecsTable[iStep]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _tableTStart = tStart;
+    _tableDt = dt;
+    _tableBits = bitSlipSubfields;
+
+    PYLITH_COMPONENT_DEBUG("Tabulated slip subfields for "<<numStepsTable<<" uniform time steps.");
+
+    PYLITH_METHOD_END;
+} // tabulateSlipSubfields
+
+
 // ------------------------------------------------------------------------------------------------
 // Set constants used in finite-element integrations.
 void
-pylith::faults::KinSrc::_setFEConstants(const pylith::topology::Field& faultAuxField) const {
+pylith::faults::KinSrc::_setFEConstants(PetscDM slipDM) const {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("_setFEConstants(faultAuxField="<<faultAuxField.getLabel()<<")");
+    PYLITH_COMPONENT_DEBUG("_setFEConstants(slipDM="<<slipDM<<")");
 
     // :KLUDGE: Potentially we may have multiple PetscDS objects. This assumes that the first one (with a NULL label) is
     // the correct one.
     PetscDS ds = NULL;
-    PetscDM dmAux = faultAuxField.getDM();assert(dmAux);
-    PetscErrorCode err = DMGetDS(dmAux, &ds);PYLITH_CHECK_ERROR(err);assert(ds);
+    assert(slipDM);
+    PetscErrorCode err = DMGetDS(slipDM, &ds);PYLITH_CHECK_ERROR(err);assert(ds);
 
     // Pointwise functions have been set in DS
     const int numConstants = 1;
@@ -215,4 +384,47 @@ pylith::faults::KinSrc::_setFEConstants(const pylith::topology::Field& faultAuxF
 } // _setFEConstants
 
 
+// ------------------------------------------------------------------------------------------------
+// Get time after which slip subfields no longer change.
+PylithReal
+pylith::faults::KinSrc::_getSteadyTime(void) const {
+    return HUGE_VAL;
+} // _getSteadyTime
+
+
+// ------------------------------------------------------------------------------------------------
+// Get maximum value of auxiliary subfield over the fault.
+PylithReal
+pylith::faults::KinSrc::_getMaxSubfieldValue(const char* subfieldName) const {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_auxiliaryField);
+    assert(_auxiliaryField->hasSubfield(subfieldName));
+    const PetscInt subfieldIndex = _auxiliaryField->getSubfieldInfo(subfieldName).index;
+
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(_auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::VecVisitorMesh auxiliaryVisitor(*_auxiliaryField);
+    const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+
+    PylithReal valueMax = -HUGE_VAL;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt subfieldDof = auxiliaryVisitor.sectionSubfieldDof(subfieldIndex, point);
+        const PetscInt subfieldOff = auxiliaryVisitor.sectionSubfieldOffset(subfieldIndex, point);
+        for (PetscInt iDof = 0; iDof < subfieldDof; ++iDof) {
+            if (auxiliaryArray[subfieldOff+iDof] > valueMax) { valueMax = auxiliaryArray[subfieldOff+iDof]; }
+        } // for
+    } // for
+
+    // All processes must agree on the value so that all processes make the same decision
+    // about skipping evaluation of the slip time function.
+    PylithReal valueMaxGlobal = -HUGE_VAL;
+    err = MPI_Allreduce(&valueMax, &valueMaxGlobal, 1, MPIU_REAL, MPI_MAX,
+                        _auxiliaryField->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(valueMaxGlobal);
+} // _getMaxSubfieldValue
+
+
 // End of file
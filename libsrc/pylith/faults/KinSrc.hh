@@ -38,6 +38,8 @@
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 #include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
 
+#include <vector> // HASA std::vector
+
 // KinSrc -------------------------------------------------------------
 /** @brief Kinematic earthquake source.
  *
@@ -104,21 +106,50 @@ public:
                     const spatialdata::units::Nondimensional& normalizer,
                     const spatialdata::geocoords::CoordSys* cs);
 
+    /** Re-query auxiliary field values from the spatial database.
+     *
+     * Fast path for parameter sweeps in which only the slip distribution changes: the auxiliary
+     * field discretization is kept and only the values are re-queried from the (possibly updated)
+     * spatial database. The earthquake source must already be initialized.
+     */
+    void reinitializeParameters(void);
+
     /** Get requested slip subfields at time t.
      *
      * @param[inout] slipLocalVec Local PETSc vector for slip, slip rate, or slip accelerationvalues.
-     * @param[in] faultAuxiliaryField Auxiliary field for fault.
+     * @param[in] slipDM PETSc DM holding only the slip-related subfields of the fault auxiliary field.
      * @param[in] t Time t.
      * @param[in] timeScale Time scale for nondimensionalization.
      * @param[in] bitSlipSubfields Slip subfields to compute.
      */
     virtual
     void getSlipSubfields(PetscVec slipLocalVec,
-                          pylith::topology::Field* faultAuxiliaryField,
+                          PetscDM slipDM,
                           const PylithScalar t,
                           const PylithScalar timeScale,
                           const int bitSlipSubfields);
 
+    /** Pre-tabulate slip subfields for uniform time stepping.
+     *
+     * Evaluates the slip time function at times tStart + i*dt and caches the resulting slip
+     * subfield vectors so that getSlipSubfields() becomes a table read, trading memory for
+     * the per-step, per-point evaluation cost in explicit dynamic runs. The table covers only
+     * the active time window of the rupture; once the slip subfields are constant the cached
+     * steady values are used instead. Sources whose slip subfields never become constant
+     * (unbounded active window) are not tabulated.
+     *
+     * @param[in] slipDM PETSc DM holding only the slip-related subfields of the fault auxiliary field.
+     * @param[in] tStart Nondimensional time of first step.
+     * @param[in] dt Nondimensional time step (must be positive).
+     * @param[in] numSteps Number of time steps.
+     * @param[in] bitSlipSubfields Slip subfields to compute.
+     */
+    void tabulateSlipSubfields(PetscDM slipDM,
+                               const PylithReal tStart,
+                               const PylithReal dt,
+                               const size_t numSteps,
+                               const int bitSlipSubfields);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -141,9 +172,30 @@ protected:
 
     /** Set constants used in finite-element integrations.
      *
-     * @param[in] auxField Auxiliary field associated with fault finite-element integration.
+     * @param[in] slipDM PETSc DM for the slip subfields used to evaluate the slip time function.
+     */
+    void _setFEConstants(PetscDM slipDM) const;
+
+    /** Get time after which slip subfields no longer change.
+     *
+     * Outside the active time window the slip subfields are constant, so evaluation of the
+     * slip time function is skipped and cached values are used. The default implementation
+     * returns HUGE_VAL (slip subfields never become constant).
+     *
+     * @returns Nondimensional time after which slip subfields are constant.
+     */
+    virtual
+    PylithReal _getSteadyTime(void) const;
+
+    /** Get maximum value of auxiliary subfield over the fault.
+     *
+     * The maximum is over all processes, so all processes make the same decision about
+     * skipping evaluation of the slip time function.
+     *
+     * @param[in] subfieldName Name of auxiliary subfield.
+     * @returns Maximum value of subfield (-HUGE_VAL if fault has no points).
      */
-    void _setFEConstants(const pylith::topology::Field& auxField) const;
+    PylithReal _getMaxSubfieldValue(const char* subfieldName) const;
 
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
@@ -158,6 +210,13 @@ protected:
 private:
 
     PylithReal _originTime; ///< Origin time for earthquake source
+    PylithReal _steadyTime; ///< Time after which slip subfields are constant (HUGE_VAL if never).
+    PetscVec _slipVecSteady; ///< Cached constant slip subfields for completed rupture.
+    int _slipVecSteadyBits; ///< Slip subfields in cached slip vector.
+    std::vector<PetscVec> _slipVecsTable; ///< Pre-tabulated slip subfields for uniform time stepping.
+    PylithReal _tableTStart; ///< Nondimensional time of first table entry.
+    PylithReal _tableDt; ///< Nondimensional time step between table entries.
+    int _tableBits; ///< Slip subfields in pre-tabulated slip vectors.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
@@ -302,4 +302,12 @@ pylith::faults::KinSrcLiuCos::_auxiliaryFieldSetup(const spatialdata::units::Non
 } // _auxiliaryFieldSetup
 
 
+// ------------------------------------------------------------------------------------------------
+// Get time after which slip subfields no longer change.
+PylithReal
+pylith::faults::KinSrcLiuCos::_getSteadyTime(void) const {
+    return getOriginTime() + _getMaxSubfieldValue("initiation_time") + _getMaxSubfieldValue("rise_time");
+} // _getSteadyTime
+
+
 // End of file
@@ -346,4 +346,12 @@ pylith::faults::_KinSrcRamp::maxAcc(const double finalSlip,
 } // maxAcc
 
 
+// ------------------------------------------------------------------------------------------------
+// Get time after which slip subfields no longer change.
+PylithReal
+pylith::faults::KinSrcRamp::_getSteadyTime(void) const {
+    return getOriginTime() + _getMaxSubfieldValue("initiation_time") + _getMaxSubfieldValue("rise_time");
+} // _getSteadyTime
+
+
 // End of file
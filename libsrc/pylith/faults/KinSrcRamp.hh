@@ -192,6 +192,14 @@ protected:
     void _auxiliaryFieldSetup(const spatialdata::units::Nondimensional& normalizer,
                               const spatialdata::geocoords::CoordSys* cs);
 
+    /** Get time after which slip subfields no longer change.
+     *
+     * Slip is constant once the ramp has completed everywhere on the fault.
+     *
+     * @returns Nondimensional time after which slip subfields are constant.
+     */
+    PylithReal _getSteadyTime(void) const;
+
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
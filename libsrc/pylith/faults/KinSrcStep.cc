@@ -118,4 +118,12 @@ pylith::faults::KinSrcStep::_auxiliaryFieldSetup(const spatialdata::units::Nondi
 } // _auxiliaryFieldSetup
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get time after which slip subfields no longer change.
+PylithReal
+pylith::faults::KinSrcStep::_getSteadyTime(void) const {
+    return getOriginTime() + _getMaxSubfieldValue("initiation_time");
+} // _getSteadyTime
+
+
 // End of file
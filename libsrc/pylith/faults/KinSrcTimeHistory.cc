@@ -65,16 +65,16 @@ pylith::faults::KinSrcTimeHistory::getTimeHistoryDB(void) {
 // Get requested slip subfields at time t.
 void
 pylith::faults::KinSrcTimeHistory::getSlipSubfields(PetscVec slipLocalVec,
-                                                    pylith::topology::Field* faultAuxiliaryField,
+                                                    PetscDM slipDM,
                                                     const PylithScalar t,
                                                     const PylithScalar timeScale,
                                                     const int bitSlipSubfields) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("getSlipSubfields="<<slipLocalVec<<", faultAuxiliaryField="<<faultAuxiliaryField
+    PYLITH_COMPONENT_DEBUG("getSlipSubfields="<<slipLocalVec<<", slipDM="<<slipDM
                                               <<", t="<<t<<", timeScale="<<timeScale
                                               <<", bitSlipSubfields="<<bitSlipSubfields<<")");
     KinSrcAuxiliaryFactory::updateTimeHistoryValue(_auxiliaryField, t, timeScale, _dbTimeHistory);
-    KinSrc::getSlipSubfields(slipLocalVec, faultAuxiliaryField, t, timeScale, bitSlipSubfields);
+    KinSrc::getSlipSubfields(slipLocalVec, slipDM, t, timeScale, bitSlipSubfields);
 
     PYLITH_METHOD_END;
 } // getSlipSubfields
@@ -68,9 +68,12 @@ pylith::faults::TopologyOps::createFault(pylith::topology::Mesh* faultMesh,
     if (surfaceLabel) {
         IS subpointIS;
         const PetscInt *dmpoints;
-        PetscInt defaultValue, cStart, cEnd, vStart, vEnd;
+        PetscInt pStart, pEnd, cStart, cEnd, vStart, vEnd;
 
-        err = DMLabelGetDefaultValue(surfaceLabel, &defaultValue);PYLITH_CHECK_ERROR(err);
+        // Index the label so membership tests in the loop are O(1) bitmap queries instead of
+        // hashed searches; the label is not modified while the index exists.
+        err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        err = DMLabelCreateIndex(surfaceLabel, pStart, pEnd);PYLITH_CHECK_ERROR(err);
         err = DMPlexGetSubpointIS(subdm, &subpointIS);PYLITH_CHECK_ERROR(err);
         err = DMPlexGetHeightStratum(subdm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
         err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
@@ -82,22 +85,24 @@ pylith::faults::TopologyOps::createFault(pylith::topology::Mesh* faultMesh,
 
             err = DMPlexGetTransitiveClosure(dmMesh, dmpoints[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
             for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
-                PetscInt value = 0;
+                PetscBool hasPoint = PETSC_FALSE;
 
                 if ((closure[cl] < vStart) || (closure[cl] >= vEnd)) { continue;}
-                err = DMLabelGetValue(surfaceLabel, closure[cl], &value);PYLITH_CHECK_ERROR(err);
-                if (value == defaultValue) {invalidCell = PETSC_FALSE;break;}
+                err = DMLabelHasPoint(surfaceLabel, closure[cl], &hasPoint);PYLITH_CHECK_ERROR(err);
+                if (!hasPoint) {invalidCell = PETSC_FALSE;break;}
             } // for
             err = DMPlexRestoreTransitiveClosure(dmMesh, dmpoints[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
             if (invalidCell) {
                 std::ostringstream msg;
                 msg << "Ambiguous fault surface. Cell "<<dmpoints[c]<<" has all of its vertices on the fault.";
                 err = ISRestoreIndices(subpointIS, &dmpoints);PYLITH_CHECK_ERROR(err);
+                err = DMLabelDestroyIndex(surfaceLabel);PYLITH_CHECK_ERROR(err);
                 err = DMDestroy(&subdm);PYLITH_CHECK_ERROR(err);
                 throw std::runtime_error(msg.str());
             } // if
         } // for
         err = ISRestoreIndices(subpointIS, &dmpoints);PYLITH_CHECK_ERROR(err);
+        err = DMLabelDestroyIndex(surfaceLabel);PYLITH_CHECK_ERROR(err);
     } // if
     err = DMPlexOrient(subdm);PYLITH_CHECK_ERROR(err);
 
@@ -138,8 +143,12 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
     if (faultBdLabel && (dim > 2)) {
         PetscIS bdIS;
         const PetscInt *bd;
-        PetscInt fStart, fEnd, n, i;
+        PetscInt pStart, pEnd, fStart, fEnd, n, i;
 
+        // Index the fault label for O(1) membership tests; only faultBdLabel is modified in
+        // the loop below, so the index stays valid.
+        err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        err = DMLabelCreateIndex(label, pStart, pEnd);PYLITH_CHECK_ERROR(err);
         err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
         err = DMLabelGetStratumIS(faultBdLabel, faultBdLabelValue, &bdIS);PYLITH_CHECK_ERROR(err);
         err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
@@ -150,8 +159,8 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
             // Remove faces
             if ((p >= fStart) && (p < fEnd)) {
                 const PetscInt *edges,   *verts, *supportA, *supportB;
-                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, val, bval, e, s;
-                PetscBool found = PETSC_FALSE;
+                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, bval, e, s;
+                PetscBool hasPoint, found = PETSC_FALSE;
 
                 err = DMLabelClearValue(faultBdLabel, p, faultBdLabelValue);PYLITH_CHECK_ERROR(err);
                 // Remove the cross edge
@@ -173,16 +182,16 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
                     err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
                     err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
                     for (s = 0, sA = 0; s < supportSizeA; ++s) {
-                        err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
+                        err = DMLabelHasPoint(label, supportA[s], &hasPoint);PYLITH_CHECK_ERROR(err);
                         err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sA;}
+                        if (hasPoint && ( bval >= 0) ) { ++sA;}
                     }
                     err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
                     err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
                     for (s = 0, sB = 0; s < supportSizeB; ++s) {
-                        err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
+                        err = DMLabelHasPoint(label, supportB[s], &hasPoint);PYLITH_CHECK_ERROR(err);
                         err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sB;}
+                        if (hasPoint && ( bval >= 0) ) { ++sB;}
                     }
                     if ((sA > 2) && (sB > 2)) {
                         err = DMLabelClearValue(faultBdLabel, edges[e], faultBdLabelValue);PYLITH_CHECK_ERROR(err);
@@ -199,6 +208,7 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
         }
         err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
         err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+        err = DMLabelDestroyIndex(label);PYLITH_CHECK_ERROR(err);
     }
     // Completes the set of cells scheduled to be replaced
     err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, faultBdLabelValue, PETSC_FALSE, faultMesh.getDM());PYLITH_CHECK_ERROR(err);
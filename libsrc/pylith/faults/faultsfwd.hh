@@ -32,7 +32,9 @@ namespace pylith {
         class FaultCohesive;
         class FaultCohesiveKin;
         class FaultCohesiveImpulses;
+        class FaultCohesiveDyn;
         class AuxiliaryFactoryKinematic;
+        class AuxiliaryFactoryRateState;
 
         class KinSrc;
         class KinSrcConstRate;
@@ -45,6 +47,7 @@ namespace pylith {
 
         class TopologyOps;
         class FaultOps;
+        class FaultSlipStats;
     } // faults
 } // pylith
 
@@ -22,19 +22,28 @@
 
 #include "pylith/topology/Field.hh" // HOLDSA AuxiliaryField
 #include "pylith/topology/FieldQuery.hh" // USES FieldQuery
+#include "pylith/topology/Mesh.hh" // USES Mesh
 
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD*
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
 
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5Open()
+
+#include <sys/stat.h> // USES stat()
+#include <sstream> // USES std::ostringstream
 #include <cassert>
 
+std::string pylith::feassemble::AuxiliaryFactory::_cacheDir;
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::feassemble::AuxiliaryFactory::AuxiliaryFactory(void) :
     _queryDB(NULL),
-    _fieldQuery(NULL) {
+    _fieldQuery(NULL),
+    _queryResolution(0.0) {
     GenericComponent::setName("auxiliaryfactory");
 } // constructor
 
@@ -64,6 +73,14 @@ pylith::feassemble::AuxiliaryFactory::getQueryDB(void) const {
 } // getQueryDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get database for filling auxiliary subfields.
+spatialdata::spatialdb::SpatialDB*
+pylith::feassemble::AuxiliaryFactory::getQueryDB(void) {
+    return _queryDB;
+} // getQueryDB
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialie factory for setting up auxiliary subfields.
 void
@@ -81,6 +98,38 @@ pylith::feassemble::AuxiliaryFactory::initialize(pylith::topology::Field* field,
 } // initialize
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set resolution for spatial database queries.
+void
+pylith::feassemble::AuxiliaryFactory::setQueryResolution(const PylithReal value) {
+    _queryResolution = value;
+} // setQueryResolution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get resolution for spatial database queries.
+PylithReal
+pylith::feassemble::AuxiliaryFactory::getQueryResolution(void) const {
+    return _queryResolution;
+} // getQueryResolution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set directory for caching auxiliary field values across runs.
+void
+pylith::feassemble::AuxiliaryFactory::setCacheDir(const char* value) {
+    _cacheDir = (value) ? value : "";
+} // setCacheDir
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get directory for caching auxiliary field values across runs.
+const char*
+pylith::feassemble::AuxiliaryFactory::getCacheDir(void) {
+    return _cacheDir.c_str();
+} // getCacheDir
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize subfields.
 void
@@ -92,9 +141,20 @@ pylith::feassemble::AuxiliaryFactory::setValuesFromDB(void) {
 
     if (_queryDB) {
         assert(_fieldQuery);
-        _fieldQuery->openDB(_queryDB, _normalizer->getLengthScale());
-        _fieldQuery->queryDB();
-        _fieldQuery->closeDB(_queryDB);
+        const std::string& cacheFilename = (!_cacheDir.empty()) ? _cacheFilename() : std::string();
+        struct stat cacheStat;
+        if (!cacheFilename.empty() && (0 == stat(cacheFilename.c_str(), &cacheStat))) {
+            PYLITH_JOURNAL_DEBUG("Loading auxiliary field values from cache '"<<cacheFilename<<"'.");
+            _loadFromCache(cacheFilename.c_str());
+        } else {
+            _fieldQuery->setQueryResolution(_queryResolution);
+            _fieldQuery->openDB(_queryDB, _normalizer->getLengthScale());
+            _fieldQuery->queryDB();
+            _fieldQuery->closeDB(_queryDB);
+            if (!cacheFilename.empty()) {
+                _saveToCache(cacheFilename.c_str());
+            } // if
+        } // if/else
     } else {
         PYLITH_JOURNAL_ERROR("Unknown case for filling auxiliary subfields.");
         throw std::logic_error("Unknown case for filling auxiliary subfields.");
@@ -123,8 +183,151 @@ pylith::feassemble::AuxiliaryFactory::setSubfieldQuery(const char* subfieldName,
     assert(_fieldQuery);
     _fieldQuery->setQuery(subfieldName, namesDBValues, numDBValues, convertFn, db);
 
+    if (db) { // Per-subfield database; include in cache fingerprint.
+        _subfieldDBKeys += subfieldName;
+        _subfieldDBKeys += "=";
+        _subfieldDBKeys += db->getDescription();
+        _subfieldDBKeys += "|";
+    } // if
+
     PYLITH_METHOD_END;
 } // _setSubfieldQueryFn
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute name of cache file from fingerprint of mesh, field layout, and spatial database description.
+std::string
+pylith::feassemble::AuxiliaryFactory::_cacheFilename(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_field);
+    assert(_queryDB);
+
+    PetscErrorCode err = 0;
+
+    // Mesh fingerprint: number of ranks, total size of the (stacked) local
+    // vectors, and coordinate checksums. Cache entries are specific to the
+    // partition, so ensemble members must use the same number of processes.
+    MPI_Comm comm = _field->getMesh().getComm();
+    int commSize = 0;
+    MPI_Comm_size(comm, &commSize);
+
+    PetscInt localSize = 0;
+    err = VecGetLocalSize(_field->getLocalVector(), &localSize);PYLITH_CHECK_ERROR(err);
+    PetscInt totalSize = 0;
+    MPI_Allreduce(&localSize, &totalSize, 1, MPIU_INT, MPI_SUM, comm);
+
+    PetscVec coordsVec = NULL;
+    err = DMGetCoordinates(_field->getDM(), &coordsVec);PYLITH_CHECK_ERROR(err);assert(coordsVec);
+    PetscScalar coordsSum = 0.0;
+    PetscReal coordsNorm = 0.0;
+    err = VecSum(coordsVec, &coordsSum);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(coordsVec, NORM_1, &coordsNorm);PYLITH_CHECK_ERROR(err);
+
+    std::ostringstream key;
+    key.precision(17);
+    key << _queryDB->getDescription() << "|" << _subfieldDBKeys << _field->getLabel();
+    const pylith::string_vector& subfieldNames = _field->getSubfieldNames();
+    for (size_t i = 0; i < subfieldNames.size(); ++i) {
+        key << "|" << subfieldNames[i];
+    } // for
+    key << "|" << commSize << "|" << totalSize << "|" << coordsSum << "|" << coordsNorm
+        << "|" << _queryResolution;
+
+    // FNV-1a hash of fingerprint.
+    const std::string& keyString = key.str();
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < keyString.length(); ++i) {
+        hash ^= uint64_t(keyString[i]);
+        hash *= 0x100000001b3ULL;
+    } // for
+
+    std::ostringstream filename;
+    filename << _cacheDir << "/auxfield_" << std::hex << hash << ".h5";
+
+    PYLITH_METHOD_RETURN(filename.str());
+} // _cacheFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Load auxiliary field values from cache file.
+void
+pylith::feassemble::AuxiliaryFactory::_loadFromCache(const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(filename);
+    assert(_field);
+
+    PetscErrorCode err = 0;
+
+    PetscVec fieldVec = _field->getLocalVector();assert(fieldVec);
+    PetscInt localSize = 0;
+    err = VecGetLocalSize(fieldVec, &localSize);PYLITH_CHECK_ERROR(err);
+
+    PetscVec cacheVec = NULL;
+    err = VecCreateMPI(_field->getMesh().getComm(), localSize, PETSC_DETERMINE, &cacheVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)cacheVec, "auxiliary_field");PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(_field->getMesh().getComm(), filename, FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    err = VecLoad(cacheVec, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* cacheArray = NULL;
+    PetscScalar* fieldArray = NULL;
+    err = VecGetArrayRead(cacheVec, &cacheArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(fieldVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < localSize; ++i) {
+        fieldArray[i] = cacheArray[i];
+    } // for
+    err = VecRestoreArray(fieldVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(cacheVec, &cacheArray);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&cacheVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _loadFromCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Save auxiliary field values to cache file.
+void
+pylith::feassemble::AuxiliaryFactory::_saveToCache(const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(filename);
+    assert(_field);
+
+    PetscErrorCode err = 0;
+
+    PetscVec fieldVec = _field->getLocalVector();assert(fieldVec);
+    PetscInt localSize = 0;
+    err = VecGetLocalSize(fieldVec, &localSize);PYLITH_CHECK_ERROR(err);
+
+    // Stack the per-rank local vectors (including ghost values) into one
+    // parallel vector so a single collective HDF5 write captures the values
+    // for the partition.
+    PetscVec cacheVec = NULL;
+    err = VecCreateMPI(_field->getMesh().getComm(), localSize, PETSC_DETERMINE, &cacheVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)cacheVec, "auxiliary_field");PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* fieldArray = NULL;
+    PetscScalar* cacheArray = NULL;
+    err = VecGetArrayRead(fieldVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(cacheVec, &cacheArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < localSize; ++i) {
+        cacheArray[i] = fieldArray[i];
+    } // for
+    err = VecRestoreArray(cacheVec, &cacheArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(fieldVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(_field->getMesh().getComm(), filename, FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = VecView(cacheVec, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&cacheVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _saveToCache
+
+
 // End of file
@@ -57,6 +57,12 @@ public:
      */
     const spatialdata::spatialdb::SpatialDB* getQueryDB(void) const;
 
+    /** Get spatial database for filling auxiliary subfields.
+     *
+     * @returns Pointer to database.
+     */
+    spatialdata::spatialdb::SpatialDB* getQueryDB(void);
+
     /** Initialize factory for setting up auxiliary subfields.
      *
      * @param[inout] field Auxiliary field for which subfields are to be created.
@@ -69,6 +75,42 @@ public:
                     const int spaceDim,
                     const pylith::topology::FieldBase::Description* defaultDescription=NULL);
 
+    /** Set directory for caching auxiliary field values across runs.
+     *
+     * Cache files are keyed by a fingerprint of the mesh, field layout, and
+     * spatial database description, so runs with the same mesh and databases
+     * (for example, ensemble members) load the values directly instead of
+     * querying the databases. An empty string disables caching (default).
+     *
+     * @param[in] value Name of cache directory.
+     */
+    static
+    void setCacheDir(const char* value);
+
+    /** Get directory for caching auxiliary field values across runs.
+     *
+     * @returns Name of cache directory (empty string if caching is disabled).
+     */
+    static
+    const char* getCacheDir(void);
+
+    /** Set resolution for spatial database queries.
+     *
+     * With a positive resolution, the databases are queried on a coarse grid
+     * with the given spacing and the values are interpolated to the
+     * evaluation points with a gradient-limited estimate. A nonpositive
+     * resolution (the default) queries every evaluation point.
+     *
+     * @param[in] value Grid spacing (dimensioned length) for coarse queries.
+     */
+    void setQueryResolution(const PylithReal value);
+
+    /** Get resolution for spatial database queries.
+     *
+     * @returns Grid spacing (dimensioned length) for coarse queries.
+     */
+    PylithReal getQueryResolution(void) const;
+
     /// Set subfield values using spatial database.
     void setValuesFromDB(void);
 
@@ -99,6 +141,36 @@ protected:
     /// Field query for filling subfield values via spatial database.
     pylith::topology::FieldQuery* _fieldQuery;
 
+    PylithReal _queryResolution; ///< Grid spacing for coarse queries (nonpositive queries every evaluation point).
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Compute name of cache file from fingerprint of mesh, field layout, and spatial database description.
+     *
+     * @returns Name of cache file.
+     */
+    std::string _cacheFilename(void) const;
+
+    /** Load auxiliary field values from cache file.
+     *
+     * @param[in] filename Name of HDF5 cache file.
+     */
+    void _loadFromCache(const char* filename);
+
+    /** Save auxiliary field values to cache file.
+     *
+     * @param[in] filename Name of HDF5 cache file.
+     */
+    void _saveToCache(const char* filename);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    static std::string _cacheDir; ///< Directory for caching auxiliary field values (empty string disables caching).
+
+    std::string _subfieldDBKeys; ///< Descriptions of per-subfield databases (part of cache fingerprint).
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -21,11 +21,9 @@
 #include "pylith/feassemble/Constraint.hh" // implementation of object methods
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
-#include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
 #include "pylith/problems/Physics.hh" // USES Physics
-#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
@@ -58,7 +56,7 @@ void
 pylith::feassemble::Constraint::deallocate(void) {
     PYLITH_METHOD_BEGIN;
 
-    delete _boundaryMesh;_boundaryMesh = NULL;
+    _boundaryMesh = NULL; // Memory managed by domain mesh.
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -176,9 +174,7 @@ pylith::feassemble::Constraint::initialize(const pylith::topology::Field& soluti
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("initialize(solution="<<solution.getLabel()<<")");
 
-    delete _boundaryMesh;_boundaryMesh = pylith::topology::MeshOps::createLowerDimMesh(solution.getMesh(), _labelName.c_str(), _labelValue);assert(_boundaryMesh);
-    PetscDM dmBoundary = _boundaryMesh->getDM();assert(dmBoundary);
-    pylith::topology::CoordsVisitor::optimizeClosure(dmBoundary);
+    _boundaryMesh = solution.getMesh().getSubmesh(_labelName.c_str(), _labelValue);assert(_boundaryMesh);
 
     assert(_physics);
     _observers = _physics->getObservers(); // Memory managed by Physics
@@ -153,7 +153,7 @@ protected:
     int _labelValue; ///< Value of label associated with integration domain.
 
     int_array _constrainedDOF; ///< List of constrained degrees of freedom at each location.
-    pylith::topology::Mesh* _boundaryMesh; ///< Boundary mesh.
+    pylith::topology::Mesh* _boundaryMesh; ///< Boundary mesh (shared; memory managed by domain mesh).
     PylithReal _tSolution; ///< Time used for current solution.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
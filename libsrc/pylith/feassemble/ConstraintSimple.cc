@@ -23,6 +23,7 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::getStratumIS()
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
 #include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
@@ -79,8 +80,7 @@ pylith::feassemble::ConstraintSimple::initialize(const pylith::topology::Field&
     PetscIS pointIS;
     const PetscInt *points;
     PetscInt point, cStart, cEnd, clSize;
-    err = DMGetLabel(dm, _labelName.c_str(), &label);PYLITH_CHECK_ERROR(err);
-    err = DMLabelGetStratumIS(label, _labelValue, &pointIS);PYLITH_CHECK_ERROR(err);
+    pointIS = pylith::topology::MeshOps::getStratumIS(dm, _labelName.c_str(), _labelValue);
     if (!pointIS) {
         PYLITH_METHOD_END;
     } // if
@@ -145,9 +145,9 @@ pylith::feassemble::ConstraintSimple::setSolution(pylith::feassemble::Integratio
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("setSolution(integrationData="<<integrationData->str()<<")");
 
-    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData->getSolution();
     assert(solution);
-    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::time);
+    const PylithReal t = integrationData->getTime();
 
     PetscErrorCode err = 0;
     PetscDM dmSoln = solution->getDM();
@@ -37,7 +37,10 @@
 // Default constructor.
 pylith::feassemble::ConstraintSpatialDB::ConstraintSpatialDB(pylith::problems::Physics* const physics) :
     Constraint(physics),
-    _kernelConstraint(NULL) {
+    _kernelConstraint(NULL),
+    _solutionLocalVec(NULL),
+    _constraintLabel(NULL),
+    _isTimeDependent(true) {
     GenericComponent::setName("constraintspatialdb");
 } // constructor
 
@@ -49,6 +52,20 @@ pylith::feassemble::ConstraintSpatialDB::~ConstraintSpatialDB(void) {
 } // destructor
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::feassemble::ConstraintSpatialDB::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Constraint::deallocate();
+
+    PetscErrorCode err = DMLabelDestroy(&_constraintLabel);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set constraint kernel.
 void
@@ -57,6 +74,22 @@ pylith::feassemble::ConstraintSpatialDB::setKernelConstraint(const PetscBdPointF
 } // setkernelConstraint
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag indicating whether constrained values vary with time.
+void
+pylith::feassemble::ConstraintSpatialDB::setTimeDependent(const bool value) {
+    _isTimeDependent = value;
+} // setTimeDependent
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag indicating whether constrained values vary with time.
+bool
+pylith::feassemble::ConstraintSpatialDB::isTimeDependent(void) const {
+    return _isTimeDependent;
+} // isTimeDependent
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize constraint domain, auxiliary field, and derived field. Update observers.
 void
@@ -90,6 +123,20 @@ pylith::feassemble::ConstraintSpatialDB::initialize(const pylith::topology::Fiel
     err = PetscDSAddBoundary(prob, DM_BC_ESSENTIAL_BD_FIELD, _labelName.c_str(), label, 1, &_labelValue, i_field,
                              numConstrained, &_constrainedDOF[0], (void (*)()) _kernelConstraint, NULL, context, NULL);PYLITH_CHECK_ERROR(err);
 
+    // Duplicate the constraint label and add the cells bounding the constrained faces once.
+    // Inserting boundary values requires the face cells, and rebuilding them in the original label
+    // with DMPlexLabelAddFaceCells()/DMPlexLabelClearCells() sweeps the boundary every time step.
+    err = DMLabelDestroy(&_constraintLabel);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDuplicate(label, &_constraintLabel);PYLITH_CHECK_ERROR(err);
+    err = DMPlexLabelAddFaceCells(dmSoln, _constraintLabel);PYLITH_CHECK_ERROR(err);
+
+    // Register the auxiliary field under both labels; the local vector does not change between
+    // time steps, so registering it here removes that work from setSolution().
+    const PetscInt part = 0;
+    assert(_auxiliaryField);
+    err = DMSetAuxiliaryVec(dmSoln, label, _labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMSetAuxiliaryVec(dmSoln, _constraintLabel, _labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+
     PYLITH_METHOD_END;
 } // initialize
 
@@ -103,6 +150,8 @@ pylith::feassemble::ConstraintSpatialDB::setState(const double t) {
 
     assert(_physics);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
+    assert(_auxiliaryField);
+    _auxiliaryField->clearDirtySubfields();
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
@@ -128,30 +177,32 @@ pylith::feassemble::ConstraintSpatialDB::setSolution(pylith::feassemble::Integra
     assert(_auxiliaryField);
     assert(_physics);
 
-    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData->getSolution();
     assert(solution);
-    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::time);
+    const PylithReal t = integrationData->getTime();
+
+    // Static constrained values persist in the solution local vector (constrained degrees of
+    // freedom are not in the global vector, so scatters do not overwrite them); applying them
+    // once at the first call suffices.
+    if (!_isTimeDependent && (solution->getLocalVector() == _solutionLocalVec)) {
+        PYLITH_METHOD_END;
+    } // if
 
     PetscErrorCode err = 0;
     PetscDM dmSoln = solution->getDM();
 
-    // Get label for constraint.
-    PetscDMLabel dmLabel = NULL;
-    err = DMGetLabel(dmSoln, _labelName.c_str(), &dmLabel);PYLITH_CHECK_ERROR(err);
-
-    // Set auxiliary data
-    const PetscInt part = 0;
-    err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-
+    // Evaluate the constraint kernel over the constrained points and scatter the values into the
+    // solution in one pass. The label with the face cells and the auxiliary field registration are
+    // set up once in initialize(), so this is the only per-step work.
     void* context = NULL;
     const int fieldIndex = solution->getSubfieldInfo(_subfieldName.c_str()).index;
     const PylithInt numConstrained = _constrainedDOF.size();
     assert(solution->getLocalVector());
-    err = DMPlexLabelAddFaceCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
+    assert(_constraintLabel);
     err = DMPlexInsertBoundaryValuesEssentialBdField(dmSoln, t, solution->getLocalVector(), fieldIndex,
-                                                     numConstrained, &_constrainedDOF[0], dmLabel, 1, &_labelValue,
+                                                     numConstrained, &_constrainedDOF[0], _constraintLabel, 1, &_labelValue,
                                                      _kernelConstraint, context, solution->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMPlexLabelClearCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
+    _solutionLocalVec = solution->getLocalVector();
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
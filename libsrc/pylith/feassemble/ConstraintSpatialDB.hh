@@ -31,6 +31,7 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 
 #include "pylith/utils/array.hh" // HASA int_array
+#include "pylith/utils/petscfwd.h" // HASA PetscVec
 #include "pylith/utils/utilsfwd.hh" // HOLDSA Logger
 
 class pylith::feassemble::ConstraintSpatialDB : public pylith::feassemble::Constraint {
@@ -48,12 +49,30 @@ public:
     /// Destructor.
     ~ConstraintSpatialDB(void);
 
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
     /** Set constraint kernel.
      *
      * @param kernel Kernel to compute constrained value from auxiliary field.
      */
     void setKernelConstraint(const PetscBdPointFunc kernel);
 
+    /** Set flag indicating whether constrained values vary with time.
+     *
+     * Static constraints are applied to the solution once; reapplying them each time step is
+     * skipped because constrained values persist in the solution local vector.
+     *
+     * @param[in] value True if constrained values vary with time, false if static.
+     */
+    void setTimeDependent(const bool value);
+
+    /** Get flag indicating whether constrained values vary with time.
+     *
+     * @returns True if constrained values vary with time, false if static.
+     */
+    bool isTimeDependent(void) const;
+
     /** Initialize constraint.
      *
      * @param[in] solution Solution field (layout).
@@ -87,6 +106,9 @@ protected:
 protected:
 
     PetscBdPointFunc _kernelConstraint; ///< Kernel for computing constrained values from auxiliary field.
+    PetscVec _solutionLocalVec; ///< Local solution vector to which static constrained values were applied.
+    PetscDMLabel _constraintLabel; ///< Copy of constraint label with cells bounding the constrained faces added.
+    bool _isTimeDependent; ///< True if constrained values vary with time, false if static.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -54,7 +54,8 @@ public:
 pylith::feassemble::ConstraintUserFn::ConstraintUserFn(pylith::problems::Physics* const physics) :
     Constraint(physics),
     _fn(NULL),
-    _fnDot(NULL) {
+    _fnDot(NULL),
+    _fnContext(NULL) {
     GenericComponent::setName("constraintuserfn");
 } // constructor
 
@@ -82,6 +83,14 @@ pylith::feassemble::ConstraintUserFn::setUserFnDot(const PetscUserFieldFunc fnDo
 } // setUserFnDot
 
 
+// ------------------------------------------------------------------------------------------------
+// Set context passed to user functions.
+void
+pylith::feassemble::ConstraintUserFn::setUserFnContext(void* context) {
+    _fnContext = context;
+} // setUserFnContext
+
+
 // ------------------------------------------------------------------------------------------------
 // Initialize constraint domain, auxiliary field, and derived field. Update observers.
 void
@@ -99,7 +108,7 @@ pylith::feassemble::ConstraintUserFn::initialize(const pylith::topology::Field&
     PetscErrorCode err = 0;
     PetscDS prob = NULL;
     DMLabel label = NULL;
-    void* context = NULL;
+    void* context = _fnContext;
     err = DMGetDS(solution.getDM(), &prob);PYLITH_CHECK_ERROR(err);
     const PetscInt i_field = solution.getSubfieldInfo(_subfieldName.c_str()).index;
     err = DMGetLabel(solution.getDM(), _labelName.c_str(), &label);PYLITH_CHECK_ERROR(err);
@@ -119,14 +128,14 @@ pylith::feassemble::ConstraintUserFn::setSolution(pylith::feassemble::Integratio
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setSolution(integrationData="<<integrationData->str()<<")");
 
-    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData->getSolution();
     assert(solution);
-    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::time);
+    const PylithReal t = integrationData->getTime();
 
     _ConstraintUserFn::setSolution(solution, t, _fn, *this);
 
     if (_fnDot && integrationData->hasField(pylith::feassemble::IntegrationData::solution_dot)) {
-        const pylith::topology::Field* solutionDot = integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);
+        const pylith::topology::Field* solutionDot = integrationData->getSolutionDot();
         assert(solutionDot);
         _ConstraintUserFn::setSolution(solutionDot, t, _fnDot, *this);
     } // if
@@ -152,7 +161,7 @@ pylith::feassemble::_ConstraintUserFn::setSolution(const pylith::topology::Field
     PetscDMLabel dmLabel = NULL;
     err = DMGetLabel(dmField, constraint._labelName.c_str(), &dmLabel);PYLITH_CHECK_ERROR(err);
 
-    void* context = NULL;
+    void* context = constraint._fnContext;
     const int fieldIndex = field->getSubfieldInfo(constraint._subfieldName.c_str()).index;
     const PylithInt numConstrained = constraint._constrainedDOF.size();
     assert(field->getLocalVector());
@@ -60,6 +60,12 @@ public:
      */
     void setUserFnDot(const PetscUserFieldFunc fnDot);
 
+    /** Set context passed to user functions.
+     *
+     * @param[in] context User context passed to functions specifying constrained values.
+     */
+    void setUserFnContext(void* context);
+
     /** Initialize constraint.
      *
      * @param[in] solution Solution field (layout).
@@ -78,6 +84,7 @@ private:
 
     PetscUserFieldFunc _fn; ///< Function for computing constrained values.
     PetscUserFieldFunc _fnDot; ///< Function for computing constrained values.
+    void* _fnContext; ///< Context passed to functions for computing constrained values.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
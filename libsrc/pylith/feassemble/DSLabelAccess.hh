@@ -32,6 +32,7 @@
 #include "pylith/utils/petscfwd.h" // HASA PetscDM, PetscDS, PetscWeakForm
 
 #include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 class pylith::feassemble::DSLabelAccess {
     friend class TestDSLabelAccess; // unit testing
@@ -97,6 +98,49 @@ public:
     /// Remove overlap from list of cells in label.
     void removeOverlap(void);
 
+    /** Remove cells with fully constrained closures from list of cells in label.
+     *
+     * Cells with every degree of freedom in their closure constrained contribute only to
+     * constrained rows, which global assembly discards. Requires the local section of the DM, so
+     * it must be called after the solution field has been allocated.
+     */
+    void removeFullyConstrained(void);
+
+    /** Tabulate combined solution and auxiliary closure indices for the cells in the label.
+     *
+     * Builds one flat index table (cells x (solution dofs + auxiliary dofs)) so that cell
+     * loops gather both closures with a single indirection instead of resolving the closure
+     * indices per cell per pass. Requires the local section of the DM, so it must be called
+     * after the solution field has been allocated; call it after any removeOverlap() or
+     * removeFullyConstrained() so the table matches the final cell index set.
+     *
+     * @param[in] auxiliaryDM PETSc DM of auxiliary field (NULL if no auxiliary field).
+     */
+    void tabulateClosureIndices(const PetscDM auxiliaryDM);
+
+    /** Get combined closure indices for a cell.
+     *
+     * The first numClosureSolnIndices() entries are the solution closure indices (into the
+     * local solution vector; negative entries are constrained) followed by the
+     * numClosureAuxIndices() auxiliary closure indices (into the local auxiliary vector).
+     *
+     * @param[in] cellIndex Index of cell in cells index set (0 to numCells()-1).
+     * @returns Pointer to combined closure indices for cell.
+     */
+    const PetscInt* closureIndices(const PetscInt cellIndex) const;
+
+    /** Get number of solution closure indices per cell.
+     *
+     * @returns Number of solution closure indices.
+     */
+    PetscInt numClosureSolnIndices(void) const;
+
+    /** Get number of auxiliary closure indices per cell.
+     *
+     * @returns Number of auxiliary closure indices.
+     */
+    PetscInt numClosureAuxIndices(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -108,6 +152,9 @@ private:
     PetscInt _numCells; ///< Number of cells in PETSc IS.
     PetscInt _value; ///< Label value.
     std::string _name; ///< Name of label;
+    std::vector<PetscInt> _closureIndices; ///< Combined solution+auxiliary closure indices per cell.
+    PetscInt _numClosureSolnIndices; ///< Number of solution closure indices per cell.
+    PetscInt _numClosureAuxIndices; ///< Number of auxiliary closure indices per cell.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
@@ -0,0 +1,133 @@
+// -*- C++ -*-
+//
+// ------------------------------------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ------------------------------------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "FEGeometryCache.hh" // implementation of object methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+
+#include "petscdmplex.h" // USES DMPlexComputeCellGeometryAffineFEM()
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::feassemble::FEGeometryCache::FEGeometryCache(void) {
+    GenericComponent::setName("fegeometrycache");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::feassemble::FEGeometryCache::~FEGeometryCache(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate data.
+void
+pylith::feassemble::FEGeometryCache::deallocate(void) {
+    _cache.clear();
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute and cache geometry for cells of an integration domain.
+void
+pylith::feassemble::FEGeometryCache::computeGeometry(PetscDM dm,
+                                                     PetscIS cellsIS,
+                                                     const char* labelName,
+                                                     const int labelValue) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeGeometry(dm="<<dm<<", cellsIS="<<cellsIS<<", labelName="<<labelName<<", labelValue="<<labelValue<<")");
+
+    assert(dm);
+    if (!cellsIS) { PYLITH_METHOD_END; }
+
+    PetscErrorCode err;
+    PetscInt cellDim = 0;
+    PetscInt spaceDim = 0;
+    err = DMGetDimension(dm, &cellDim);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateDim(dm, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numCells = 0;
+    const PetscInt* cells = NULL;
+    err = ISGetSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+
+    CellGeometry& geometry = _cache[_key(labelName, labelValue)];
+    geometry.numCells = numCells;
+    geometry.cellDim = cellDim;
+    geometry.spaceDim = spaceDim;
+    geometry.v0.resize(numCells*spaceDim);
+    geometry.jacobian.resize(numCells*cellDim*spaceDim);
+    geometry.jacobianInv.resize(numCells*cellDim*spaceDim);
+    geometry.jacobianDet.resize(numCells);
+
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        err = DMPlexComputeCellGeometryAffineFEM(dm, cells[iCell],
+                                                 &geometry.v0[iCell*spaceDim],
+                                                 &geometry.jacobian[iCell*cellDim*spaceDim],
+                                                 &geometry.jacobianInv[iCell*cellDim*spaceDim],
+                                                 &geometry.jacobianDet[iCell]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Get cached geometry for an integration domain.
+const pylith::feassemble::FEGeometryCache::CellGeometry*
+pylith::feassemble::FEGeometryCache::getGeometry(const char* labelName,
+                                                 const int labelValue) const {
+    const cache_t::const_iterator iter = _cache.find(_key(labelName, labelValue));
+    return (iter != _cache.end()) ? &iter->second : NULL;
+} // getGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Clear cached geometry (call when mesh changes).
+void
+pylith::feassemble::FEGeometryCache::clear(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("clear()");
+
+    _cache.clear();
+
+    PYLITH_METHOD_END;
+} // clear
+
+
+// ------------------------------------------------------------------------------------------------
+// Create cache key from label name and value.
+std::string
+pylith::feassemble::FEGeometryCache::_key(const char* labelName,
+                                          const int labelValue) {
+    std::ostringstream key;
+    key << labelName << "=" << labelValue;
+    return key.str();
+} // _key
+
+
+// End of file
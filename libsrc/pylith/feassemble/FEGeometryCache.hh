@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/feassemble/FEGeometryCache.hh
+ *
+ * @brief Cache of cell geometry (reference map Jacobians) shared across integrators.
+ *
+ * For static meshes the geometry of the reference map is constant, so we compute it once at
+ * initialization and reuse it until the mesh changes.
+ */
+
+#if !defined(pylith_feassemble_fegeometrycache_hh)
+#define pylith_feassemble_fegeometrycache_hh
+
+#include "feassemblefwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+#include "pylith/utils/array.hh" // HASA scalar_array
+#include "pylith/utils/petscfwd.h" // USES PetscDM, PetscIS
+
+#include <string> // USES std::string
+#include <map> // HASA std::map
+
+class pylith::feassemble::FEGeometryCache : public pylith::utils::GenericComponent {
+    friend class TestFEGeometryCache; // unit testing
+
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Geometry of the reference map for cells of an integration domain.
+    struct CellGeometry {
+        PylithInt numCells; ///< Number of cells in integration domain.
+        PylithInt cellDim; ///< Dimension of cells.
+        PylithInt spaceDim; ///< Spatial dimension of coordinates.
+        scalar_array v0; ///< Coordinates of first vertex of cells [numCells*spaceDim].
+        scalar_array jacobian; ///< Jacobian of reference map [numCells*cellDim*spaceDim].
+        scalar_array jacobianInv; ///< Inverse of Jacobian of reference map [numCells*cellDim*spaceDim].
+        scalar_array jacobianDet; ///< Determinant of Jacobian of reference map [numCells].
+
+        CellGeometry(void) :
+            numCells(0),
+            cellDim(0),
+            spaceDim(0) {}
+
+
+    }; // CellGeometry
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    FEGeometryCache(void);
+
+    /// Destructor.
+    ~FEGeometryCache(void);
+
+    /// Deallocate data.
+    void deallocate(void);
+
+    /** Compute and cache geometry for cells of an integration domain.
+     *
+     * Assumes an affine reference map (constant Jacobian within a cell).
+     *
+     * @param[in] dm PETSc DM holding cells.
+     * @param[in] cellsIS PETSc IS with cells of integration domain.
+     * @param[in] labelName Name of label associated with integration domain.
+     * @param[in] labelValue Value of label associated with integration domain.
+     */
+    void computeGeometry(PetscDM dm,
+                         PetscIS cellsIS,
+                         const char* labelName,
+                         const int labelValue);
+
+    /** Get cached geometry for an integration domain.
+     *
+     * @param[in] labelName Name of label associated with integration domain.
+     * @param[in] labelValue Value of label associated with integration domain.
+     * @returns Cached cell geometry or NULL if not in cache.
+     */
+    const CellGeometry* getGeometry(const char* labelName,
+                                    const int labelValue) const;
+
+    /// Clear cached geometry (call when mesh changes).
+    void clear(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create cache key from label name and value.
+     *
+     * @param[in] labelName Name of label associated with integration domain.
+     * @param[in] labelValue Value of label associated with integration domain.
+     * @returns Key for cache entry.
+     */
+    static
+    std::string _key(const char* labelName,
+                     const int labelValue);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    typedef std::map<std::string, CellGeometry> cache_t; ///< Map of integration domain to geometry.
+    cache_t _cache; ///< Cached geometry for integration domains.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    FEGeometryCache(const FEGeometryCache&); ///< Not implemented.
+    const FEGeometryCache& operator=(const FEGeometryCache&); ///< Not implemented.
+
+}; // FEGeometryCache
+
+#endif // pylith_feassemble_fegeometrycache_hh
+
+// End of file
@@ -20,6 +20,8 @@
 
 #include "IntegrationData.hh" // implementation of class methods
 
+#include "pylith/feassemble/FEGeometryCache.hh" // HOLDSA FEGeometryCache
+#include "pylith/feassemble/WorkVectorPool.hh" // HOLDSA WorkVectorPool
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
@@ -46,7 +48,15 @@ const std::string pylith::feassemble::IntegrationData::dae_mass_weighting = "dae
 
 // ------------------------------------------------------------------------------------------------
 // Constructor
-pylith::feassemble::IntegrationData::IntegrationData(void) {
+pylith::feassemble::IntegrationData::IntegrationData(void) :
+    _solution(NULL),
+    _solutionDot(NULL),
+    _residual(NULL),
+    _t(0.0),
+    _dt(0.0),
+    _sTshift(0.0),
+    _geometryCache(new pylith::feassemble::FEGeometryCache),
+    _workVectorPool(new pylith::feassemble::WorkVectorPool) {
     GenericComponent::setName("integrationdata");
 }
 
@@ -76,9 +86,32 @@ pylith::feassemble::IntegrationData::deallocate(void) {
         delete iter->second;iter->second = NULL;
     } // for
     _meshes.clear();
+
+    _solution = NULL;
+    _solutionDot = NULL;
+    _residual = NULL;
+
+    delete _geometryCache;_geometryCache = NULL;
+    delete _workVectorPool;_workVectorPool = NULL;
 } // deallocate
 
 
+// ------------------------------------------------------------------------------------------------
+// Get cache of cell geometry shared across integrators.
+pylith::feassemble::FEGeometryCache*
+pylith::feassemble::IntegrationData::getGeometryCache(void) {
+    return _geometryCache;
+} // getGeometryCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Get pool of preallocated work vectors shared across integrators.
+pylith::feassemble::WorkVectorPool*
+pylith::feassemble::IntegrationData::getWorkVectorPool(void) const {
+    return _workVectorPool;
+} // getWorkVectorPool
+
+
 // ------------------------------------------------------------------------------------------------
 // Set scalar quantity.
 void
@@ -89,6 +122,15 @@ pylith::feassemble::IntegrationData::setScalar(const std::string& name,
 
     _scalars[name] = value;
 
+    // Mirror hot entries into typed slots read by residual and Jacobian evaluations.
+    if (name == time) {
+        _t = value;
+    } else if (name == time_step) {
+        _dt = value;
+    } else if (name == s_tshift) {
+        _sTshift = value;
+    } // if/else
+
     PYLITH_METHOD_END;
 }
 
@@ -147,6 +189,15 @@ pylith::feassemble::IntegrationData::setField(const std::string& name,
         _fields[name] = field;
     } // if/else
 
+    // Mirror hot entries into typed slots read by residual and Jacobian evaluations.
+    if (name == solution) {
+        _solution = field;
+    } else if (name == solution_dot) {
+        _solutionDot = field;
+    } else if (name == residual) {
+        _residual = field;
+    } // if/else
+
     PYLITH_METHOD_END;
 }
 
@@ -180,10 +231,66 @@ pylith::feassemble::IntegrationData::removeField(const std::string& name) {
         _fields.erase(name);
     } // if
 
+    if (name == solution) {
+        _solution = NULL;
+    } else if (name == solution_dot) {
+        _solutionDot = NULL;
+    } else if (name == residual) {
+        _residual = NULL;
+    } // if/else
+
     PYLITH_METHOD_END;
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Get solution field from typed slot.
+pylith::topology::Field*
+pylith::feassemble::IntegrationData::getSolution(void) const {
+    return _solution;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Get time derivative of solution field from typed slot.
+pylith::topology::Field*
+pylith::feassemble::IntegrationData::getSolutionDot(void) const {
+    return _solutionDot;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Get residual field from typed slot.
+pylith::topology::Field*
+pylith::feassemble::IntegrationData::getResidual(void) const {
+    return _residual;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Get current time from typed slot.
+PylithReal
+pylith::feassemble::IntegrationData::getTime(void) const {
+    return _t;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Get current time step from typed slot.
+PylithReal
+pylith::feassemble::IntegrationData::getTimeStep(void) const {
+    return _dt;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Get time shift for LHS Jacobian from typed slot.
+PylithReal
+pylith::feassemble::IntegrationData::getTimeShift(void) const {
+    return _sTshift;
+}
+
+
 // ------------------------------------------------------------------------------------------------
 // Set mesh.
 void
@@ -114,6 +114,46 @@ public:
      */
     void removeField(const std::string& name);
 
+    /** Get solution field from typed slot.
+     *
+     * The hot entries (solution, solution_dot, residual, t, dt, s_tshift) are mirrored into
+     * typed slots by the setters, so residual and Jacobian evaluations avoid the string-keyed
+     * map lookups. The map remains the access path for cold and extension data.
+     *
+     * @returns Solution field.
+     */
+    pylith::topology::Field* getSolution(void) const;
+
+    /** Get time derivative of solution field from typed slot.
+     *
+     * @returns Time derivative of solution field.
+     */
+    pylith::topology::Field* getSolutionDot(void) const;
+
+    /** Get residual field from typed slot.
+     *
+     * @returns Residual field.
+     */
+    pylith::topology::Field* getResidual(void) const;
+
+    /** Get current time from typed slot.
+     *
+     * @returns Current time.
+     */
+    PylithReal getTime(void) const;
+
+    /** Get current time step from typed slot.
+     *
+     * @returns Current time step.
+     */
+    PylithReal getTimeStep(void) const;
+
+    /** Get time shift for LHS Jacobian from typed slot.
+     *
+     * @returns Time shift.
+     */
+    PylithReal getTimeShift(void) const;
+
     /** Set mesh.
      *
      * @param[in] name Name of mesh.
@@ -129,6 +169,18 @@ public:
      */
     pylith::topology::Mesh* getMesh(const std::string& name) const;
 
+    /** Get cache of cell geometry shared across integrators.
+     *
+     * @returns Geometry cache.
+     */
+    pylith::feassemble::FEGeometryCache* getGeometryCache(void);
+
+    /** Get pool of preallocated work vectors shared across integrators.
+     *
+     * @returns Work vector pool.
+     */
+    pylith::feassemble::WorkVectorPool* getWorkVectorPool(void) const;
+
     /** Dump integration data to std::string.
      *
      * @returns Integration data information as string.
@@ -145,6 +197,14 @@ private:
     scalars_map_t _scalars;
     fields_map_t _fields;
     meshes_map_t _meshes;
+    pylith::topology::Field* _solution; ///< Typed slot for solution field.
+    pylith::topology::Field* _solutionDot; ///< Typed slot for time derivative of solution field.
+    pylith::topology::Field* _residual; ///< Typed slot for residual field.
+    PylithReal _t; ///< Typed slot for current time.
+    PylithReal _dt; ///< Typed slot for current time step.
+    PylithReal _sTshift; ///< Typed slot for LHS Jacobian time shift.
+    pylith::feassemble::FEGeometryCache* _geometryCache; ///< Cache of cell geometry shared across integrators.
+    pylith::feassemble::WorkVectorPool* _workVectorPool; ///< Pool of preallocated work vectors shared across integrators.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
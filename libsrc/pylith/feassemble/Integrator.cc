@@ -28,6 +28,7 @@
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -35,12 +36,29 @@
 #include <typeinfo> // USES typeid()
 #include <stdexcept> // USES std::runtime_error
 
+namespace pylith {
+    namespace feassemble {
+        namespace _Integrator {
+            // Constants last pushed to the PetscDS objects of a solution DM. Every call to
+            // _setKernelConstants() sets all DS objects of the DM to one array, so the DS state is
+            // fully determined by the last array pushed; when the new array matches, the PETSc
+            // calls are skipped. Comparing the assembled array catches changes from any source
+            // (time step, physics parameters) without separate dirty tracking.
+            // The cache is thread local so that independent problem instances running on
+            // disjoint threads within one process each track the DS state of their own DM.
+            static thread_local PetscDM constantsDM = NULL; ///< Solution DM holding the pushed constants.
+            static thread_local pylith::real_array constantsPushed; ///< Constants last pushed to the DS objects.
+        } // _Integrator
+    } // feassemble
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor
 pylith::feassemble::Integrator::Integrator(pylith::problems::Physics* const physics) :
     PhysicsImplementation(physics),
     _labelName(""),
     _labelValue(1),
+    _stepCadence(1),
     _lhsJacobianTriggers(NEW_JACOBIAN_NEVER),
     _lhsJacobianLumpedTriggers(NEW_JACOBIAN_NEVER),
     _hasRHSResidual(false),
@@ -55,6 +73,7 @@ pylith::feassemble::Integrator::Integrator(pylith::problems::Physics* const phys
 // Destructor
 pylith::feassemble::Integrator::~Integrator(void) {
     deallocate();
+    _Integrator::constantsDM = NULL; // Solution DM may go away; do not skip the next constants push.
 } // destructor
 
 
@@ -97,6 +116,36 @@ pylith::feassemble::Integrator::getLabelValue(void) const {
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get signature identifying the kernels and discretization used by the integrator.
+size_t
+pylith::feassemble::Integrator::getKernelSignature(void) const {
+    return 0;
+} // getKernelSignature
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of global time steps between updates of the residual contribution.
+void
+pylith::feassemble::Integrator::setStepCadence(const size_t value) {
+    PYLITH_JOURNAL_DEBUG("setStepCadence(value="<<value<<")");
+
+    if (value < 1) {
+        throw std::runtime_error("Step cadence for integrator must be positive.");
+    } // if
+
+    _stepCadence = value;
+} // setStepCadence
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of global time steps between updates of the residual contribution.
+size_t
+pylith::feassemble::Integrator::getStepCadence(void) const {
+    return _stepCadence;
+} // getStepCadence
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Check whether LHS Jacobian needs to be recomputed.
 bool
@@ -133,6 +182,24 @@ pylith::feassemble::Integrator::setLHSJacobianTriggers(const int value) {
 } // setLHSJacobianTriggers
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether a time step change can be applied to the LHS Jacobian in place.
+bool
+pylith::feassemble::Integrator::hasLHSJacobianTimeShift(void) const {
+    return 0 != (_lhsJacobianTriggers & NEW_JACOBIAN_TIME_STEP_SHIFT);
+} // hasLHSJacobianTimeShift
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update time-derivative shift values in LHS Jacobian for current time step.
+void
+pylith::feassemble::Integrator::updateLHSJacobianTimeShift(PetscMat jacobianMat,
+                                                           PetscMat precondMat,
+                                                           const pylith::feassemble::IntegrationData& integrationData) {
+    // Default is to do nothing.
+} // updateLHSJacobianTimeShift
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set LHS lumped Jacobian trigger.
 void
@@ -141,6 +208,33 @@ pylith::feassemble::Integrator::setLHSJacobianLumpedTriggers(const int value) {
 } // setLHSJacobianLumpedTriggers
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Mark LHS lumped Jacobian as stale, forcing recomputation at the next request.
+void
+pylith::feassemble::Integrator::markLHSJacobianLumpedStale(void) {
+    PYLITH_JOURNAL_DEBUG("markLHSJacobianLumpedStale()");
+    _needNewLHSJacobianLumped = true;
+} // markLHSJacobianLumpedStale
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Apply action of LHS Jacobian for F(t,s,\dot{s}) without assembling a matrix (matrix-free).
+void
+pylith::feassemble::Integrator::computeLHSJacobianAction(PetscVec vecInLocal,
+                                                         PetscVec vecOutLocal,
+                                                         const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeLHSJacobianAction(vecInLocal="<<vecInLocal<<", vecOutLocal="<<vecOutLocal<<")");
+
+    if (_hasLHSJacobian) {
+        PYLITH_JOURNAL_LOGICERROR("Matrix-free application of LHS Jacobian is not implemented for integrator '"
+                                  << typeid(*this).name() << "'.");
+    } // if
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize integration domain, auxiliary field, and derived field. Update observers.
 void
@@ -152,6 +246,12 @@ pylith::feassemble::Integrator::initialize(const pylith::topology::Field& soluti
 
     delete _auxiliaryField;_auxiliaryField = _physics->createAuxiliaryField(solution, physicsDomainMesh);
     delete _derivedField;_derivedField = _physics->createDerivedField(solution, physicsDomainMesh);
+    if (_auxiliaryField) {
+        pylith::utils::MemoryLogger::addField("auxiliary-fields", *_auxiliaryField);
+    } // if
+    if (_derivedField) {
+        pylith::utils::MemoryLogger::addField("derived-fields", *_derivedField);
+    } // if
     _observers = _physics->getObservers();assert(_observers); // Memory managed by Physics
     _observers->setPhysicsImplementation(this);
 
@@ -163,6 +263,28 @@ pylith::feassemble::Integrator::initialize(const pylith::topology::Field& soluti
 } // initialize
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Cache cell geometry for integration domain.
+void
+pylith::feassemble::Integrator::cacheGeometry(pylith::feassemble::FEGeometryCache* geometryCache) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("cacheGeometry(geometryCache="<<geometryCache<<") empty method");
+
+    PYLITH_METHOD_END;
+} // cacheGeometry
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Remove cells with fully constrained closures from the integration domain.
+void
+pylith::feassemble::Integrator::removeFullyConstrainedCells(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("removeFullyConstrainedCells() empty method");
+
+    PYLITH_METHOD_END;
+} // removeFullyConstrainedCells
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set auxiliary field values for current time.
 void
@@ -186,7 +308,9 @@ pylith::feassemble::Integrator::poststep(const PylithReal t,
 
     _updateStateVars(t, dt, solution);
 
-    _computeDerivedField(t, dt, solution);
+    if (observersExpectDataOutput(t, tindex)) {
+        _computeDerivedField(t, dt, solution);
+    } // if
     notifyObservers(t, tindex, solution);
 
     PYLITH_METHOD_END;
@@ -205,6 +329,22 @@ pylith::feassemble::Integrator::_setKernelConstants(const pylith::topology::Fiel
     const pylith::real_array& constants = _physics->getKernelConstants(dt);
 
     PetscDM dmSoln = solution.getDM();assert(dmSoln);
+
+    // Skip the PETSc calls when the constants match those already held by the DS objects.
+    if (dmSoln == _Integrator::constantsDM) {
+        const size_t numConstants = constants.size();
+        bool matches = numConstants == _Integrator::constantsPushed.size();
+        for (size_t i = 0; matches && (i < numConstants); ++i) {
+            matches = constants[i] == _Integrator::constantsPushed[i];
+        } // for
+        if (matches) {
+            PYLITH_METHOD_END;
+        } // if
+    } // if
+    _Integrator::constantsDM = dmSoln;
+    _Integrator::constantsPushed.resize(constants.size());
+    _Integrator::constantsPushed = constants;
+
     PetscInt numDS = 0;
     PetscErrorCode err = DMGetNumDS(dmSoln, &numDS);PYLITH_CHECK_ERROR(err);
     for (PetscInt i = 0; i < numDS; ++i) {
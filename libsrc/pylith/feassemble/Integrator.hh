@@ -51,6 +51,10 @@ public:
         NEW_JACOBIAN_ALWAYS=0x1, // Always needs new Jacobian.
         NEW_JACOBIAN_TIME_STEP_CHANGE=0x2, // Needs new Jacobian if time step changes.
         NEW_JACOBIAN_UPDATE_STATE_VARS=0x4, // Needs new Jacobian after updating state variables.
+        // Time step enters Jacobian only through time-derivative shift values set by
+        // JacobianValues kernels; a time step change is applied in place via
+        // updateLHSJacobianTimeShift() without finite-element reassembly.
+        NEW_JACOBIAN_TIME_STEP_SHIFT=0x8,
     };
 
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
@@ -89,6 +93,33 @@ public:
      */
     int getLabelValue(void) const;
 
+    /** Get signature identifying the kernels and discretization used by the integrator.
+     *
+     * Integrators with the same signature use identical kernels, so scheduling them
+     * back-to-back reuses warm instruction and data caches. The default implementation
+     * returns 0 (no signature; integrator is not grouped).
+     *
+     * @returns Signature of kernels (0 if integrator has no signature).
+     */
+    virtual
+    size_t getKernelSignature(void) const;
+
+    /** Set number of global time steps between updates of the residual contribution.
+     *
+     * A cadence greater than 1 lags the contribution: it is recomputed only on scheduled
+     * steps and the cached contribution is reused in between (operator splitting), so
+     * stiff-but-slow physics need not be reassembled at the resolution of faster physics.
+     *
+     * @param[in] value Number of time steps between updates (1 means every step).
+     */
+    void setStepCadence(const size_t value);
+
+    /** Get number of global time steps between updates of the residual contribution.
+     *
+     * @returns Number of time steps between updates.
+     */
+    size_t getStepCadence(void) const;
+
     /** Check whether LHS Jacobian needs to be recomputed.
      *
      * @param[in] dtChanged True if time step has changed since previous Jacobian computation.
@@ -115,6 +146,35 @@ public:
      */
     void setLHSJacobianLumpedTriggers(const int value);
 
+    /** Mark LHS lumped Jacobian as stale, forcing recomputation at the next request.
+     *
+     * Invalidation hook for inputs to the lumped Jacobian (e.g., auxiliary field values
+     * such as density) that change outside the rebuild triggers. The lumped Jacobian is
+     * cached until this is called, so runs with constant properties compute it once.
+     */
+    void markLHSJacobianLumpedStale(void);
+
+    /** Check whether a time step change can be applied to the LHS Jacobian in place.
+     *
+     * @returns True if time step enters the Jacobian only through time-derivative shift values
+     * that updateLHSJacobianTimeShift() overwrites without reassembly.
+     */
+    bool hasLHSJacobianTimeShift(void) const;
+
+    /** Update time-derivative shift values in LHS Jacobian for current time step.
+     *
+     * Overwrites the Jacobian entries set by JacobianValues kernels without finite-element
+     * reassembly. The default implementation does nothing.
+     *
+     * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
+     * @param[out] precondMat PETSc Mat with Jacobian preconditioning sparse matrix.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    virtual
+    void updateLHSJacobianTimeShift(PetscMat jacobianMat,
+                                    PetscMat precondMat,
+                                    const pylith::feassemble::IntegrationData& integrationData);
+
     /** Initialize integration domain, auxiliary field, and derived field. Update observers.
      *
      * @param[in] solution Solution field (layout).
@@ -122,6 +182,26 @@ public:
     virtual
     void initialize(const pylith::topology::Field& solution);
 
+    /** Cache cell geometry for integration domain.
+     *
+     * Called once after initialization; the cached geometry is reused until the mesh changes.
+     * The default implementation caches nothing.
+     *
+     * @param[inout] geometryCache Cache of cell geometry shared across integrators.
+     */
+    virtual
+    void cacheGeometry(pylith::feassemble::FEGeometryCache* geometryCache);
+
+    /** Remove cells with fully constrained closures from the integration domain.
+     *
+     * Cells with every degree of freedom constrained contribute nothing to the global residual
+     * or Jacobian, so assembling them is wasted work. Must be called after the solution field
+     * has been allocated and before caching cell geometry. The default implementation removes
+     * nothing.
+     */
+    virtual
+    void removeFullyConstrainedCells(void);
+
     /** Update at end of time step.
      *
      * @param[in] t Current time.
@@ -171,6 +251,20 @@ public:
                             PetscMat precondMat,
                             const pylith::feassemble::IntegrationData& integrationData) = 0;
 
+    /** Apply action of LHS Jacobian for F(t,s,\dot{s}) without assembling a matrix (matrix-free).
+     *
+     * The default implementation generates an error if the integrator has LHS Jacobian kernels;
+     * integrators without LHS Jacobian kernels contribute nothing to the action.
+     *
+     * @param[in] vecInLocal Local PETSc Vec with vector the Jacobian acts on.
+     * @param[out] vecOutLocal Local PETSc Vec accumulating the Jacobian action.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    virtual
+    void computeLHSJacobianAction(PetscVec vecInLocal,
+                                  PetscVec vecOutLocal,
+                                  const pylith::feassemble::IntegrationData& integrationData);
+
     /** Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) with explicit time-stepping.
      *
      * @param[out] jacobianInv Inverse of lumped Jacobian as a field.
@@ -219,6 +313,7 @@ protected:
 
     std::string _labelName; ///< Name of label associated with integration domain.
     int _labelValue; ///< Value of label associated with integration domain.
+    size_t _stepCadence; ///< Number of time steps between updates of residual contribution.
 
     int _lhsJacobianTriggers; // Triggers for needing new LHS Jacobian.
     int _lhsJacobianLumpedTriggers; // Triggers for needing new LHS lumped Jacobian.
@@ -21,15 +21,15 @@
 
 #include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
 #include "pylith/topology/Mesh.hh" // USES Mesh
-#include "pylith/topology/MeshOps.hh" // USES createLowerDimMesh()
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::getStratumIS()
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/problems/Physics.hh" // USES Physics
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
-#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor::optimizeClosure()
 
 #include "spatialdata/spatialdb/GravityField.hh" // HASA GravityField
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/PerfLogger.hh" // USES PerfLogger
 
 #include "petscds.h" // USES PetscDS
 
@@ -55,8 +55,15 @@ public:
 pylith::feassemble::IntegratorBoundary::IntegratorBoundary(pylith::problems::Physics* const physics) :
     Integrator(physics),
     _boundaryMesh(NULL),
+    _dsLabel(NULL),
     _boundarySurfaceLabel(""),
-    _subfieldName("") {
+    _subfieldName(""),
+    _impedanceFilename(""),
+    _impedanceKernel(NULL),
+    _impedanceMat(NULL),
+    _impedanceTmpGlobal(NULL),
+    _impedanceTmpLocal(NULL),
+    _hasNonzeroAmplitude(true) {
     GenericComponent::setName(_IntegratorBoundary::genericComponent);
 } // constructor
 
@@ -76,7 +83,13 @@ pylith::feassemble::IntegratorBoundary::deallocate(void) {
 
     Integrator::deallocate();
 
-    delete _boundaryMesh;_boundaryMesh = NULL;
+    _boundaryMesh = NULL; // Memory managed by domain mesh.
+    delete _dsLabel;_dsLabel = NULL;
+
+    PetscErrorCode err = 0;
+    err = MatDestroy(&_impedanceMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_impedanceTmpGlobal);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_impedanceTmpLocal);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -115,6 +128,85 @@ pylith::feassemble::IntegratorBoundary::getPhysicsDomainMesh(void) const {
 } // domainMesh
 
 
+// ------------------------------------------------------------------------------------------------
+// Use a stored boundary impedance operator instead of kernel evaluation for the residual.
+void
+pylith::feassemble::IntegratorBoundary::useStoredImpedance(const char* filename,
+                                                           const PetscBdPointJac jacobianKernel) {
+    PYLITH_JOURNAL_DEBUG("useStoredImpedance(filename="<<filename<<", jacobianKernel="<<jacobianKernel<<")");
+
+    if (!filename || (0 == strlen(filename))) {
+        std::ostringstream msg;
+        msg << "Empty string given for name of impedance operator file for boundary condition '"
+            << _boundarySurfaceLabel << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    assert(jacobianKernel);
+    _impedanceFilename = filename;
+    _impedanceKernel = jacobianKernel;
+} // useStoredImpedance
+
+
+// ------------------------------------------------------------------------------------------------
+// Set auxiliary subfields holding the amplitude of the boundary condition.
+void
+pylith::feassemble::IntegratorBoundary::setAmplitudeSubfields(const pylith::string_vector& subfieldNames) {
+    PYLITH_JOURNAL_DEBUG("setAmplitudeSubfields(# subfieldNames="<<subfieldNames.size()<<")");
+
+    _amplitudeSubfields = subfieldNames;
+} // setAmplitudeSubfields
+
+
+// ------------------------------------------------------------------------------------------------
+// Merge additional boundaries into the integration domain.
+void
+pylith::feassemble::IntegratorBoundary::mergeBoundaryLabels(const pylith::string_vector& labelNames,
+                                                            const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" mergeBoundaryLabels(# labelNames="<<labelNames.size()<<")");
+
+    if (labelNames.empty()) { PYLITH_METHOD_END;}
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+
+    const std::string mergedName = _labelName + "_merged";
+    err = DMCreateLabel(dmSoln, mergedName.c_str());PYLITH_CHECK_ERROR(err);
+    PetscDMLabel mergedLabel = NULL;
+    err = DMGetLabel(dmSoln, mergedName.c_str(), &mergedLabel);PYLITH_CHECK_ERROR(err);assert(mergedLabel);
+
+    pylith::string_vector allNames(labelNames);
+    allNames.push_back(_labelName);
+    const size_t numLabels = allNames.size();
+    for (size_t i = 0; i < numLabels; ++i) {
+        PetscBool hasLabel = PETSC_FALSE;
+        err = DMHasLabel(dmSoln, allNames[i].c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+        if (!hasLabel) {
+            std::ostringstream msg;
+            msg << "Could not find group of points '" << allNames[i] << "' when merging boundaries for '"
+                << _labelName << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        PetscIS pointsIS = pylith::topology::MeshOps::getStratumIS(dmSoln, allNames[i].c_str(), _labelValue);
+        if (!pointsIS) { continue;} // No points with label value on this process.
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = 0; p < numPoints; ++p) {
+            err = DMLabelSetValue(mergedLabel, points[p], _labelValue);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Use merged label for kernel registration, boundary mesh, and assembly sweeps.
+    setLabelName(mergedName.c_str());
+
+    PYLITH_METHOD_END;
+} // mergeBoundaryLabels
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::feassemble::IntegratorBoundary::setKernelsResidual(const std::vector<ResidualKernels>& kernels,
@@ -160,10 +252,11 @@ pylith::feassemble::IntegratorBoundary::initialize(const pylith::topology::Field
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" intialize(solution="<<solution.getLabel()<<")");
 
-    delete _boundaryMesh;
-    _boundaryMesh = pylith::topology::MeshOps::createLowerDimMesh(solution.getMesh(), _labelName.c_str(), _labelValue);
+    _boundaryMesh = solution.getMesh().getSubmesh(_labelName.c_str(), _labelValue);
     assert(_boundaryMesh);
-    pylith::topology::CoordsVisitor::optimizeClosure(_boundaryMesh->getDM());
+
+    // Cache DS and label information; lookups are string-keyed and too slow for per-step access.
+    delete _dsLabel;_dsLabel = new DSLabelAccess(solution.getDM(), _labelName.c_str(), _labelValue);assert(_dsLabel);
 
     Integrator::initialize(solution);
 
@@ -175,6 +268,11 @@ pylith::feassemble::IntegratorBoundary::initialize(const pylith::topology::Field
     err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, LHS, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
     err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, RHS, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
 
+    if (!_impedanceFilename.empty()) {
+        _setupImpedance(solution);
+    } // if
+    _updateAmplitudeBound();
+
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing auxiliary field.");
@@ -195,7 +293,26 @@ pylith::feassemble::IntegratorBoundary::setState(const double t) {
     Integrator::setState(t);
 
     assert(_physics);
+    assert(_auxiliaryField);
+    PetscObjectState auxiliaryStateBefore = 0;
+    PetscErrorCode err = PetscObjectStateGet((PetscObject)_auxiliaryField->getLocalVector(), &auxiliaryStateBefore);PYLITH_CHECK_ERROR(err);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
+    PetscObjectState auxiliaryStateAfter = 0;
+    err = PetscObjectStateGet((PetscObject)_auxiliaryField->getLocalVector(), &auxiliaryStateAfter);PYLITH_CHECK_ERROR(err);
+    if (auxiliaryStateAfter != auxiliaryStateBefore) {
+        // Rescan the amplitude bound only if an amplitude subfield changed. Updates mark the
+        // subfields they touch; an update without marks is treated conservatively as touching
+        // everything.
+        bool amplitudeChanged = !_auxiliaryField->hasDirtySubfields();
+        const size_t numSubfields = _amplitudeSubfields.size();
+        for (size_t i = 0; i < numSubfields; ++i) {
+            if (_auxiliaryField->isSubfieldDirty(_amplitudeSubfields[i].c_str())) { amplitudeChanged = true;}
+        } // for
+        if (amplitudeChanged) {
+            _updateAmplitudeBound();
+        } // if
+    } // if
+    _auxiliaryField->clearDirtySubfields();
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
@@ -218,19 +335,26 @@ pylith::feassemble::IntegratorBoundary::computeRHSResidual(pylith::topology::Fie
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
+    if (!_hasNonzeroAmplitude) { PYLITH_METHOD_END;} // Amplitude is uniformly zero; residual contribution is zero.
     assert(residual);
+    pylith::utils::PerfLogger::Scope perfScope(_physics->getIdentifier());
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
 
-    DSLabelAccess dsLabel(solution->getDM(), _labelName.c_str(), _labelValue);
+    if (_impedanceMat) { // Stored impedance operator replaces kernel evaluation.
+        _applyImpedance(residual, *solution);
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_dsLabel);
     _setKernelConstants(*solution, dt);
 
     PetscFormKey key;
-    key.label = dsLabel.label();
-    key.value = dsLabel.value();
+    key.label = _dsLabel->label();
+    key.value = _dsLabel->value();
     key.field = solution->getSubfieldInfo(_subfieldName.c_str()).index;
     key.part = pylith::feassemble::Integrator::RHS;
 
@@ -238,7 +362,7 @@ pylith::feassemble::IntegratorBoundary::computeRHSResidual(pylith::topology::Fie
     assert(solution->getLocalVector());
     assert(residual->getLocalVector());
     PetscVec solutionDotVec = NULL;
-    err = DMPlexComputeBdResidualSingle(dsLabel.dm(), t, dsLabel.weakForm(), key, solution->getLocalVector(), solutionDotVec,
+    err = DMPlexComputeBdResidualSingle(_dsLabel->dm(), t, _dsLabel->weakForm(), key, solution->getLocalVector(), solutionDotVec,
                                         residual->getLocalVector());PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
@@ -253,28 +377,30 @@ pylith::feassemble::IntegratorBoundary::computeLHSResidual(pylith::topology::Fie
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END;}
+    if (!_hasNonzeroAmplitude) { PYLITH_METHOD_END;} // Amplitude is uniformly zero; residual contribution is zero.
     assert(residual);
+    pylith::utils::PerfLogger::Scope perfScope(_physics->getIdentifier());
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+    const pylith::topology::Field* solutionDot = integrationData.getSolutionDot();
     assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
 
-    DSLabelAccess dsLabel(solution->getDM(), _labelName.c_str(), _labelValue);
+    assert(_dsLabel);
     _setKernelConstants(*solution, dt);
 
     PetscFormKey key;
-    key.label = dsLabel.label();
-    key.value = dsLabel.value();
+    key.label = _dsLabel->label();
+    key.value = _dsLabel->value();
     key.field = solution->getSubfieldInfo(_subfieldName.c_str()).index;
     key.part = pylith::feassemble::Integrator::LHS;
 
     PetscErrorCode err;
     assert(solution->getLocalVector());
     assert(residual->getLocalVector());
-    err = DMPlexComputeBdResidualSingle(dsLabel.dm(), t, dsLabel.weakForm(), key, solution->getLocalVector(),
+    err = DMPlexComputeBdResidualSingle(_dsLabel->dm(), t, _dsLabel->weakForm(), key, solution->getLocalVector(),
                                         solutionDot->getLocalVector(), residual->getLocalVector());PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
@@ -312,4 +438,164 @@ pylith::feassemble::IntegratorBoundary::computeLHSJacobianLumpedInv(pylith::topo
 } // computeLHSJacobianLumpedInv
 
 
+// ------------------------------------------------------------------------------------------------
+// Load impedance operator from file or assemble it from the Jacobian kernel and store it.
+void
+pylith::feassemble::IntegratorBoundary::_setupImpedance(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" _setupImpedance(solution="<<solution.getLabel()<<")");
+
+    assert(_impedanceKernel);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+
+    err = MatDestroy(&_impedanceMat);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(dmSoln, &_impedanceMat);PYLITH_CHECK_ERROR(err);
+
+    PetscBool fileExists = PETSC_FALSE;
+    err = PetscTestFile(_impedanceFilename.c_str(), 'r', &fileExists);PYLITH_CHECK_ERROR(err);
+    if (fileExists) { // Load stored operator (mesh and number of processes must match).
+        PetscViewer viewer = NULL;
+        err = PetscViewerBinaryOpen(solution.getMesh().getComm(), _impedanceFilename.c_str(), FILE_MODE_READ,
+                                    &viewer);PYLITH_CHECK_ERROR(err);
+        err = MatLoad(_impedanceMat, viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    } else { // Assemble operator from Jacobian kernel and store it for subsequent runs.
+        DSLabelAccess dsLabel(dmSoln, _labelName.c_str(), _labelValue);
+        const PetscInt i_field = solution.getSubfieldInfo(_subfieldName.c_str()).index;
+        err = PetscWeakFormAddBdJacobian(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), i_field, i_field,
+                                         pylith::feassemble::Integrator::RHS, _impedanceKernel, NULL, NULL,
+                                         NULL);PYLITH_CHECK_ERROR(err);
+
+        const PylithReal t = 0.0;
+        const PylithReal s_tshift = 0.0;
+        const PetscInt labelValues[1] = { _labelValue };
+        err = MatZeroEntries(_impedanceMat);PYLITH_CHECK_ERROR(err);
+        err = DMPlexComputeBdJacobianSingle(dsLabel.dm(), t, dsLabel.weakForm(), dsLabel.label(), 1, labelValues,
+                                            i_field, solution.getLocalVector(), NULL, s_tshift, _impedanceMat,
+                                            _impedanceMat);PYLITH_CHECK_ERROR(err);
+
+        PetscViewer viewer = NULL;
+        err = PetscViewerBinaryOpen(solution.getMesh().getComm(), _impedanceFilename.c_str(), FILE_MODE_WRITE,
+                                    &viewer);PYLITH_CHECK_ERROR(err);
+        err = MatView(_impedanceMat, viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    err = VecDestroy(&_impedanceTmpGlobal);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_impedanceTmpLocal);PYLITH_CHECK_ERROR(err);
+    err = DMCreateGlobalVector(dmSoln, &_impedanceTmpGlobal);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLocalVector(dmSoln, &_impedanceTmpLocal);PYLITH_CHECK_ERROR(err);
+
+    // Record local indices of unowned degrees of freedom. The matrix-vector product is fully
+    // assembled in the global scratch vector, so entries scattered to unowned points must be
+    // zeroed before accumulating into the residual to avoid adding them twice when the residual
+    // is assembled.
+    PetscInt ownStart = 0, ownEnd = 0;
+    err = VecGetOwnershipRange(_impedanceTmpGlobal, &ownStart, &ownEnd);PYLITH_CHECK_ERROR(err);
+    ISLocalToGlobalMapping l2g = NULL;
+    err = DMGetLocalToGlobalMapping(dmSoln, &l2g);PYLITH_CHECK_ERROR(err);assert(l2g);
+    PetscInt numLocal = 0;
+    const PetscInt* globalIndices = NULL;
+    err = ISLocalToGlobalMappingGetSize(l2g, &numLocal);PYLITH_CHECK_ERROR(err);
+    err = ISLocalToGlobalMappingGetIndices(l2g, &globalIndices);PYLITH_CHECK_ERROR(err);
+    size_t numUnowned = 0;
+    for (PetscInt i = 0; i < numLocal; ++i) {
+        if ((globalIndices[i] >= 0) && ((globalIndices[i] < ownStart) || (globalIndices[i] >= ownEnd))) {
+            ++numUnowned;
+        } // if
+    } // for
+    _impedanceGhostIndices.resize(numUnowned);
+    for (PetscInt i = 0, iUnowned = 0; i < numLocal; ++i) {
+        if ((globalIndices[i] >= 0) && ((globalIndices[i] < ownStart) || (globalIndices[i] >= ownEnd))) {
+            _impedanceGhostIndices[iUnowned++] = i;
+        } // if
+    } // for
+    err = ISLocalToGlobalMappingRestoreIndices(l2g, &globalIndices);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupImpedance
+
+
+// ------------------------------------------------------------------------------------------------
+// Apply impedance operator to solution and add result to residual.
+void
+pylith::feassemble::IntegratorBoundary::_applyImpedance(pylith::topology::Field* residual,
+                                                        const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" _applyImpedance(residual="<<residual<<", solution="<<solution.getLabel()<<")");
+
+    assert(residual);
+    assert(_impedanceMat);
+    assert(_impedanceTmpGlobal);
+    assert(_impedanceTmpLocal);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+
+    solution.scatterLocalToVector(solution.getGlobalVector());
+    err = MatMult(_impedanceMat, solution.getGlobalVector(), _impedanceTmpGlobal);PYLITH_CHECK_ERROR(err);
+
+    err = VecSet(_impedanceTmpLocal, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSoln, _impedanceTmpGlobal, INSERT_VALUES, _impedanceTmpLocal);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, _impedanceTmpGlobal, INSERT_VALUES, _impedanceTmpLocal);PYLITH_CHECK_ERROR(err);
+
+    const size_t numUnowned = _impedanceGhostIndices.size();
+    if (numUnowned > 0) {
+        PetscScalar* localArray = NULL;
+        err = VecGetArray(_impedanceTmpLocal, &localArray);PYLITH_CHECK_ERROR(err);
+        for (size_t i = 0; i < numUnowned; ++i) {
+            localArray[_impedanceGhostIndices[i]] = 0.0;
+        } // for
+        err = VecRestoreArray(_impedanceTmpLocal, &localArray);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    err = VecAXPY(residual->getLocalVector(), 1.0, _impedanceTmpLocal);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _applyImpedance
+
+
+// ------------------------------------------------------------------------------------------------
+// Update cached bound on magnitude of amplitude auxiliary subfields.
+void
+pylith::feassemble::IntegratorBoundary::_updateAmplitudeBound(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_amplitudeSubfields.empty()) { PYLITH_METHOD_END;}
+    assert(_auxiliaryField);
+
+    PetscErrorCode err = 0;
+    PetscSection section = _auxiliaryField->getLocalSection();assert(section);
+    PetscVec auxiliaryVec = _auxiliaryField->getLocalVector();assert(auxiliaryVec);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* auxiliaryArray = NULL;
+    err = VecGetArrayRead(auxiliaryVec, &auxiliaryArray);PYLITH_CHECK_ERROR(err);
+    PylithReal boundLocal = 0.0;
+    const size_t numSubfields = _amplitudeSubfields.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const PetscInt i_field = _auxiliaryField->getSubfieldInfo(_amplitudeSubfields[i].c_str()).index;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt dof = 0, offset = 0;
+            err = PetscSectionGetFieldDof(section, point, i_field, &dof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(section, point, i_field, &offset);PYLITH_CHECK_ERROR(err);
+            for (PetscInt d = 0; d < dof; ++d) {
+                const PylithReal value = PetscAbsScalar(auxiliaryArray[offset+d]);
+                if (value > boundLocal) { boundLocal = value;}
+            } // for
+        } // for
+    } // for
+    err = VecRestoreArrayRead(auxiliaryVec, &auxiliaryArray);PYLITH_CHECK_ERROR(err);
+
+    PylithReal bound = 0.0;
+    err = MPI_Allreduce(&boundLocal, &bound, 1, MPIU_REAL, MPIU_MAX, _auxiliaryField->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+    _hasNonzeroAmplitude = bound > 0.0;
+
+    PYLITH_METHOD_END;
+} // _updateAmplitudeBound
+
+
 // End of file
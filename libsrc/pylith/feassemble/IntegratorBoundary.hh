@@ -94,6 +94,45 @@ public:
      */
     const pylith::topology::Mesh& getPhysicsDomainMesh(void) const;
 
+    /** Use a stored boundary impedance operator instead of kernel evaluation for the residual.
+     *
+     * The residual contribution of linear boundary conditions (e.g., absorbing dampers) is a
+     * constant operator applied to the solution. The operator is assembled once from the
+     * Jacobian kernel and stored to a file; subsequent runs on the same mesh and process count
+     * load it and apply it as a matrix-vector product, skipping kernel evaluation.
+     *
+     * @param[in] filename Name of file holding impedance operator.
+     * @param[in] jacobianKernel Kernel computing the derivative of the residual kernel with
+     * respect to the solution subfield.
+     */
+    void useStoredImpedance(const char* filename,
+                            const PetscBdPointJac jacobianKernel);
+
+    /** Set auxiliary subfields holding the amplitude of the boundary condition.
+     *
+     * When amplitude subfields are set, the integrator caches a bound on their magnitude each
+     * time the auxiliary field is updated and skips the residual assembly sweep over the
+     * boundary while the bound is exactly zero (e.g., staged loading before a Neumann boundary
+     * condition is switched on).
+     *
+     * @param[in] subfieldNames Names of auxiliary subfields holding amplitudes.
+     */
+    void setAmplitudeSubfields(const pylith::string_vector& subfieldNames);
+
+    /** Merge additional boundaries into the integration domain.
+     *
+     * Creates a label marking the union of the points of the current boundary and the additional
+     * boundaries, so that kernel registration, the boundary mesh, the auxiliary field, and the
+     * residual assembly sweep are all done once for the merged boundary instead of once per
+     * boundary. The boundaries must be mutually exclusive and share the label value. Must be
+     * called before setting kernels.
+     *
+     * @param[in] labelNames Names of labels for additional boundaries.
+     * @param[in] solution Solution field.
+     */
+    void mergeBoundaryLabels(const pylith::string_vector& labelNames,
+                             const pylith::topology::Field& solution);
+
     /** Set kernels for RHS residual.
      *
      * @param[in] kernels Array of kernerls for computing the RHS residual.
@@ -148,13 +187,44 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData);
 
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Load impedance operator from file or assemble it from the Jacobian kernel and store it.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _setupImpedance(const pylith::topology::Field& solution);
+
+    /** Apply impedance operator to solution and add result to residual.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] solution Solution field.
+     */
+    void _applyImpedance(pylith::topology::Field* residual,
+                         const pylith::topology::Field& solution);
+
+    /// Update cached bound on magnitude of amplitude auxiliary subfields.
+    void _updateAmplitudeBound(void);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
-    pylith::topology::Mesh* _boundaryMesh; ///< Boundary mesh.
+    pylith::topology::Mesh* _boundaryMesh; ///< Boundary mesh (shared; memory managed by domain mesh).
+    pylith::feassemble::DSLabelAccess* _dsLabel; ///< Information about integration (PETSc DS, Label, label value, etc); rebuilt in initialize() when the mesh or DS changes.
     std::string _boundarySurfaceLabel; ///< Name of label identifying boundary surface.
     std::string _subfieldName; ///< Name of solution subfield for boundary condition.
 
+    std::string _impedanceFilename; ///< Name of file holding impedance operator (empty if unused).
+    PetscBdPointJac _impedanceKernel; ///< Kernel for assembling impedance operator.
+    PetscMat _impedanceMat; ///< Impedance operator.
+    PetscVec _impedanceTmpGlobal; ///< Scratch global vector for impedance product.
+    PetscVec _impedanceTmpLocal; ///< Scratch local vector for impedance product.
+    pylith::int_array _impedanceGhostIndices; ///< Local indices of unowned points, zeroed after scatter.
+
+    pylith::string_vector _amplitudeSubfields; ///< Auxiliary subfields holding amplitudes (empty if unused).
+    bool _hasNonzeroAmplitude; ///< Cached flag for nonzero bound on amplitude subfields.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
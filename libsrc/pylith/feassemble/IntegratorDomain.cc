@@ -24,6 +24,8 @@
 #include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
 #include "pylith/problems/Physics.hh" // USES Physics
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/FEGeometryCache.hh" // USES FEGeometryCache
+#include "pylith/feassemble/WorkVectorPool.hh" // USES WorkVectorPool
 #include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface::FaceEnum
 #include "pylith/feassemble/InterfacePatches.hh" // USES InterfacePatches
 #include "pylith/topology/Mesh.hh" // USES Mesh
@@ -35,8 +37,11 @@
 #include "petscds.h" // USES PetscDS
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/PerfLogger.hh" // USES PerfLogger
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 
 #include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
 extern "C" PetscErrorCode DMPlexComputeResidual_Internal(PetscDM dm,
@@ -86,6 +91,30 @@ public:
             static
             PetscIS createIntegrationList(void);
 
+            /** Combine value into signature identifying kernels (FNV-1a style hash).
+             *
+             * @param[in] signature Current signature.
+             * @param[in] value Value to combine into signature.
+             * @returns Updated signature.
+             */
+            static
+            size_t mixSignature(const size_t signature,
+                                const size_t value);
+
+            /** Fill array with small pseudo-random perturbations.
+             *
+             * @param[out] values Array to fill.
+             * @param[in] size Number of values.
+             * @param[in] scale Magnitude of perturbations.
+             */
+            static
+            void fillPerturbation(PylithScalar* values,
+                                  const size_t size,
+                                  const PylithScalar scale);
+
+            static const PetscInt autotuneNumPoints; ///< Number of quadrature points in autotuning sample batch.
+            static const PetscInt autotuneNumReps; ///< Number of sweeps over the sample batch.
+
         };
     }
 }
@@ -94,10 +123,16 @@ public:
 // Default constructor.
 pylith::feassemble::IntegratorDomain::IntegratorDomain(pylith::problems::Physics* const physics) :
     Integrator(physics),
+    _logger(NULL),
+    _autotuneKernels(false),
     _materialMesh(NULL),
     _updateState(NULL),
+    _stateVarsChangeThreshold(0.0),
+    _stateVarsRefreshInterval(0),
+    _stateVarsRestorePending(false),
     _jacobianValues(NULL),
-    _dsLabel(NULL) {
+    _dsLabel(NULL),
+    _kernelSignature(0) {
     GenericComponent::setName("integratordomain");
 } // constructor
 
@@ -121,6 +156,7 @@ pylith::feassemble::IntegratorDomain::deallocate(void) {
     delete _updateState;_updateState = NULL;
     delete _jacobianValues;_jacobianValues = NULL;
     delete _dsLabel;_dsLabel = NULL;
+    delete _logger;_logger = NULL;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -135,6 +171,14 @@ pylith::feassemble::IntegratorDomain::getPhysicsDomainMesh(void) const {
 } // domainMesh
 
 
+// ------------------------------------------------------------------------------------------------
+// Get signature identifying the kernels and discretization used by the integrator.
+size_t
+pylith::feassemble::IntegratorDomain::getKernelSignature(void) const {
+    return _kernelSignature;
+} // getKernelSignature
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::feassemble::IntegratorDomain::setKernelsResidual(const std::vector<ResidualKernels>& kernels,
@@ -142,6 +186,9 @@ pylith::feassemble::IntegratorDomain::setKernelsResidual(const std::vector<Resid
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setKernelsResidual(# kernels="<<kernels.size()<<")");
 
+    // Keep a copy of the kernels as the reference set for autotuning kernel variants.
+    _kernelsResidual.insert(_kernelsResidual.end(), kernels.begin(), kernels.end());
+
     PetscErrorCode err;
     DSLabelAccess dsLabel(solution.getDM(), _labelName.c_str(), _labelValue);
     for (size_t i = 0; i < kernels.size(); ++i) {
@@ -151,6 +198,10 @@ pylith::feassemble::IntegratorDomain::setKernelsResidual(const std::vector<Resid
             err = PetscWeakFormAddResidual(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), i_field, i_part,
                                            kernels[i].r0, kernels[i].r1);PYLITH_CHECK_ERROR(err);
         } // if
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_field));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_part));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].r0));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].r1));
 
         switch (kernels[i].part) {
         case LHS:
@@ -173,6 +224,39 @@ pylith::feassemble::IntegratorDomain::setKernelsResidual(const std::vector<Resid
 } // setKernelsResidual
 
 
+// ------------------------------------------------------------------------------------------------
+// Register alternate residual kernels for measurement-based selection (autotuning).
+void
+pylith::feassemble::IntegratorDomain::addKernelsResidualVariant(const char* name,
+                                                                const std::vector<ResidualKernels>& kernels) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" addKernelsResidualVariant(name="<<name<<", # kernels="<<kernels.size()<<")");
+
+    if (kernels.size() != _kernelsResidual.size()) {
+        PYLITH_JOURNAL_LOGICERROR("Kernel variant '" << name << "' with " << kernels.size()
+                                                     << " kernels does not parallel the " << _kernelsResidual.size()
+                                                     << " residual kernels set for the integration domain.");
+    } // if
+
+    ResidualKernelsVariant variant;
+    variant.name = name;
+    variant.kernels = kernels;
+    _kernelVariants.push_back(variant);
+
+    PYLITH_METHOD_END;
+} // addKernelsResidualVariant
+
+
+// ------------------------------------------------------------------------------------------------
+// Set whether to benchmark registered kernel variants at initialization and select the fastest.
+void
+pylith::feassemble::IntegratorDomain::setAutotuneKernels(const bool value) {
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setAutotuneKernels(value="<<value<<")");
+
+    _autotuneKernels = value;
+} // setAutotuneKernels
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<JacobianKernels>& kernels,
@@ -190,6 +274,13 @@ pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<Jacob
             err = PetscWeakFormAddJacobian(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), i_fieldTrial, i_fieldBasis,
                                            i_part, kernels[i].j0, kernels[i].j1, kernels[i].j2, kernels[i].j3);PYLITH_CHECK_ERROR(err);
         } // if
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_fieldTrial));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_fieldBasis));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_part));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j0));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j1));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j2));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j3));
 
         switch (kernels[i].part) {
         case LHS:
@@ -212,6 +303,43 @@ pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<Jacob
 } // setKernelsJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+// Set kernels for preconditioning matrix.
+void
+pylith::feassemble::IntegratorDomain::setKernelsJacobianPrecond(const std::vector<JacobianKernels>& kernels,
+                                                                const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setKernelsJacobianPrecond(# kernels="<<kernels.size()<<")");
+
+    PetscErrorCode err;
+    DSLabelAccess dsLabel(solution.getDM(), _labelName.c_str(), _labelValue);
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const PetscInt i_fieldTrial = solution.getSubfieldInfo(kernels[i].subfieldTrial.c_str()).index;
+        const PetscInt i_fieldBasis = solution.getSubfieldInfo(kernels[i].subfieldBasis.c_str()).index;
+        const PetscInt i_part = kernels[i].part;
+        if (dsLabel.weakForm()) {
+            err = PetscWeakFormAddJacobianPreconditioner(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(),
+                                                         i_fieldTrial, i_fieldBasis, i_part, kernels[i].j0,
+                                                         kernels[i].j1, kernels[i].j2, kernels[i].j3);PYLITH_CHECK_ERROR(err);
+        } // if
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_fieldTrial));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_fieldBasis));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, size_t(i_part));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j0));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j1));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j2));
+        _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernels[i].j3));
+    } // for
+
+    pythia::journal::debug_t debug(GenericComponent::getName());
+    if (debug.state()) {
+        err = PetscDSView(dsLabel.ds(), PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setKernelsJacobianPrecond
+
+
 // ------------------------------------------------------------------------------------------------
 // Set kernels for Jacobian without finite-element integration.
 void
@@ -235,6 +363,21 @@ pylith::feassemble::IntegratorDomain::setKernelsUpdateStateVars(const std::vecto
 } // setKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Set parameters for incremental update of state variables.
+void
+pylith::feassemble::IntegratorDomain::setIncrementalStateVarsUpdate(const PylithReal changeThreshold,
+                                                                    const int refreshInterval) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setIncrementalStateVarsUpdate(changeThreshold="<<changeThreshold<<", refreshInterval="<<refreshInterval<<")");
+
+    _stateVarsChangeThreshold = changeThreshold;
+    _stateVarsRefreshInterval = refreshInterval;
+
+    PYLITH_METHOD_END;
+} // setIncrementalStateVarsUpdate
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::feassemble::IntegratorDomain::setKernelsDerivedField(const std::vector<ProjectKernels>& kernels) {
@@ -271,12 +414,17 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
 
     if (_kernelsUpdateStateVars.size() > 0) {
         delete _updateState;_updateState = new pylith::feassemble::UpdateStateVars;assert(_updateState);
+        _updateState->setIncrementalUpdate(_stateVarsChangeThreshold, _stateVarsRefreshInterval);
         _updateState->initialize(*_auxiliaryField);
     } // if
 
     delete _dsLabel;_dsLabel = new DSLabelAccess(solution.getDM(), _labelName.c_str(), _labelValue);assert(_dsLabel);
     _dsLabel->removeOverlap();
 
+    if (_autotuneKernels && !_kernelVariants.empty()) {
+        _autotuneResidualKernels(solution);
+    } // if
+
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing auxiliary field.");
@@ -287,6 +435,223 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
 } // initialize
 
 
+// ------------------------------------------------------------------------------------------------
+// Benchmark registered residual kernel variants and install the fastest set.
+void
+pylith::feassemble::IntegratorDomain::_autotuneResidualKernels(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" _autotuneResidualKernels(# variants="<<_kernelVariants.size()<<")");
+
+    assert(_dsLabel);
+    assert(_auxiliaryField);
+    PetscErrorCode err = 0;
+
+    if (!_logger) {
+        _logger = new pylith::utils::EventLogger();assert(_logger);
+        _logger->setClassName("IntegratorDomain");
+        _logger->initialize();
+    } // if
+
+    const size_t numVariants = 1 + _kernelVariants.size();
+    std::vector<double> elapsed(numVariants, 0.0);
+
+    const PetscDS ds = _dsLabel->ds();
+    if (ds) {
+        // The sample batch follows the discretization: the per-point solution and auxiliary
+        // arrays hold the concatenated subfield components with the offsets the kernels expect.
+        PetscInt dim = 0, numFieldsSoln = 0, numCompSoln = 0;
+        err = PetscDSGetSpatialDimension(ds, &dim);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetNumFields(ds, &numFieldsSoln);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetTotalComponents(ds, &numCompSoln);PYLITH_CHECK_ERROR(err);
+        PetscInt* sOff = NULL;
+        PetscInt* sOffDer = NULL;
+        PetscInt* numCompFields = NULL;
+        err = PetscDSGetComponentOffsets(ds, &sOff);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetComponentDerivativeOffsets(ds, &sOffDer);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetComponents(ds, &numCompFields);PYLITH_CHECK_ERROR(err);
+
+        PetscDS dsAux = NULL;
+        err = DMGetDS(_auxiliaryField->getDM(), &dsAux);PYLITH_CHECK_ERROR(err);assert(dsAux);
+        PetscInt numFieldsAux = 0, numCompAux = 0;
+        err = PetscDSGetNumFields(dsAux, &numFieldsAux);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetTotalComponents(dsAux, &numCompAux);PYLITH_CHECK_ERROR(err);
+        PetscInt* aOff = NULL;
+        PetscInt* aOffDer = NULL;
+        err = PetscDSGetComponentOffsets(dsAux, &aOff);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetComponentDerivativeOffsets(dsAux, &aOffDer);PYLITH_CHECK_ERROR(err);
+
+        // Use the auxiliary values of this material (e.g., its moduli) so the sample batch
+        // exercises the same code paths as the real assembly.
+        std::vector<PylithScalar> auxTemplate(numCompAux, 1.0);
+        PetscSection auxSection = _auxiliaryField->getLocalSection();assert(auxSection);
+        PetscInt pStart = 0, pEnd = 0;
+        err = PetscSectionGetChart(auxSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        const PetscScalar* auxArray = NULL;
+        err = VecGetArrayRead(_auxiliaryField->getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt dof = 0;
+            err = PetscSectionGetDof(auxSection, point, &dof);PYLITH_CHECK_ERROR(err);
+            if (dof != numCompAux) { continue; }
+            PetscInt off = 0;
+            err = PetscSectionGetOffset(auxSection, point, &off);PYLITH_CHECK_ERROR(err);
+            for (PetscInt i = 0; i < numCompAux; ++i) {
+                auxTemplate[i] = auxArray[off+i];
+            } // for
+            break;
+        } // for
+        err = VecRestoreArrayRead(_auxiliaryField->getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+
+        assert(_physics);
+        const pylith::real_array& constants = _physics->getKernelConstants(1.0);
+        const PetscInt numConstants = constants.size();
+        const PylithScalar* constantsArray = (numConstants > 0) ? &constants[0] : NULL;
+
+        const PetscInt numPoints = _IntegratorDomian::autotuneNumPoints;
+        const PetscInt numReps = _IntegratorDomian::autotuneNumReps;
+        const PylithScalar perturbScale = 1.0e-4;
+
+        std::vector<PylithScalar> s(numPoints*numCompSoln);
+        std::vector<PylithScalar> s_t(numPoints*numCompSoln, 0.0);
+        std::vector<PylithScalar> s_x(numPoints*numCompSoln*dim);
+        std::vector<PylithScalar> a(numPoints*numCompAux);
+        std::vector<PylithScalar> a_t(numPoints*numCompAux, 0.0);
+        std::vector<PylithScalar> a_x(numPoints*numCompAux*dim, 0.0);
+        std::vector<PylithScalar> x(dim, 0.0);
+        _IntegratorDomian::fillPerturbation(&s[0], s.size(), perturbScale);
+        _IntegratorDomian::fillPerturbation(&s_x[0], s_x.size(), perturbScale);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            for (PetscInt i = 0; i < numCompAux; ++i) {
+                a[iPoint*numCompAux+i] = auxTemplate[i];
+            } // for
+        } // for
+
+        PetscInt maxCompField = 0;
+        for (PetscInt i = 0; i < numFieldsSoln; ++i) {
+            if (numCompFields[i] > maxCompField) { maxCompField = numCompFields[i]; }
+        } // for
+        const PetscInt fStride = maxCompField*(1+dim);
+        std::vector<PylithScalar> f(numPoints*fStride, 0.0);
+
+        volatile PylithScalar checksum = 0.0;
+        for (size_t iVariant = 0; iVariant < numVariants; ++iVariant) {
+            const std::vector<ResidualKernels>& kernels = (0 == iVariant) ? _kernelsResidual : _kernelVariants[iVariant-1].kernels;
+            const char* variantName = (0 == iVariant) ? "reference" : _kernelVariants[iVariant-1].name.c_str();
+
+            std::ostringstream eventName;
+            eventName << "Py-Tune-" << _labelName << "=" << _labelValue << "-" << variantName;
+            const int eventId = _logger->registerEvent(eventName.str().c_str());
+
+            _logger->eventBegin(eventId);
+            double variantElapsed = 0.0;
+            for (PetscInt iRep = 0; iRep < 1+numReps; ++iRep) { // First sweep warms up the caches.
+                const double tStart = MPI_Wtime();
+                for (size_t iKernel = 0; iKernel < kernels.size(); ++iKernel) {
+                    const PetscPointFunc r0 = kernels[iKernel].r0;
+                    const PetscPointFunc r1 = kernels[iKernel].r1;
+                    if (!r0 && !r1) { continue; }
+                    for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+                        const PylithScalar* sP = &s[iPoint*numCompSoln];
+                        const PylithScalar* s_tP = &s_t[iPoint*numCompSoln];
+                        const PylithScalar* s_xP = &s_x[iPoint*numCompSoln*dim];
+                        const PylithScalar* aP = &a[iPoint*numCompAux];
+                        const PylithScalar* a_tP = &a_t[iPoint*numCompAux];
+                        const PylithScalar* a_xP = &a_x[iPoint*numCompAux*dim];
+                        PylithScalar* fP = &f[iPoint*fStride];
+                        if (r0) {
+                            r0(dim, numFieldsSoln, numFieldsAux, sOff, sOffDer, sP, s_tP, s_xP,
+                               aOff, aOffDer, aP, a_tP, a_xP, 0.0, &x[0], numConstants, constantsArray, fP);
+                        } // if
+                        if (r1) {
+                            r1(dim, numFieldsSoln, numFieldsAux, sOff, sOffDer, sP, s_tP, s_xP,
+                               aOff, aOffDer, aP, a_tP, a_xP, 0.0, &x[0], numConstants, constantsArray, fP);
+                        } // if
+                    } // for
+                } // for
+                if (iRep > 0) { variantElapsed += MPI_Wtime() - tStart; }
+                checksum += f[0];
+            } // for
+            _logger->eventEnd(eventId);
+            elapsed[iVariant] = variantElapsed;
+        } // for
+    } // if
+
+    // Combine the timings so every process selects the same winner; processes without cells of
+    // this material contribute zero.
+    std::vector<double> elapsedTotal(numVariants, 0.0);
+    MPI_Comm comm = PetscObjectComm((PetscObject)solution.getDM());
+    err = MPI_Allreduce(&elapsed[0], &elapsedTotal[0], numVariants, MPI_DOUBLE, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+    size_t winner = 0;
+    for (size_t iVariant = 1; iVariant < numVariants; ++iVariant) {
+        if (elapsedTotal[iVariant] < elapsedTotal[winner]) { winner = iVariant; }
+    } // for
+
+    std::ostringstream report;
+    report << "Autotuned residual kernels for " << _labelName << "=" << _labelValue
+           << ": reference=" << elapsedTotal[0] << "s";
+    for (size_t iVariant = 1; iVariant < numVariants; ++iVariant) {
+        report << ", " << _kernelVariants[iVariant-1].name << "=" << elapsedTotal[iVariant] << "s";
+    } // for
+    report << "; selected '" << ((0 == winner) ? "reference" : _kernelVariants[winner-1].name.c_str()) << "'.";
+    PYLITH_JOURNAL_INFO_ROOT(report.str());
+
+    if (winner > 0) {
+        const std::vector<ResidualKernels>& kernelsWinner = _kernelVariants[winner-1].kernels;
+        for (size_t i = 0; i < kernelsWinner.size(); ++i) {
+            if ((kernelsWinner[i].r0 == _kernelsResidual[i].r0) && (kernelsWinner[i].r1 == _kernelsResidual[i].r1)) { continue; }
+            const PetscInt i_field = solution.getSubfieldInfo(kernelsWinner[i].subfield.c_str()).index;
+            if (_dsLabel->weakForm()) {
+                err = PetscWeakFormSetIndexResidual(_dsLabel->weakForm(), _dsLabel->label(), _dsLabel->value(), i_field,
+                                                    kernelsWinner[i].part, 0, kernelsWinner[i].r0,
+                                                    0, kernelsWinner[i].r1);PYLITH_CHECK_ERROR(err);
+            } // if
+            _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernelsWinner[i].r0));
+            _kernelSignature = _IntegratorDomian::mixSignature(_kernelSignature, reinterpret_cast<size_t>(kernelsWinner[i].r1));
+            _kernelsResidual[i] = kernelsWinner[i];
+        } // for
+    } // if
+
+    PYLITH_METHOD_END;
+} // _autotuneResidualKernels
+
+
+// ------------------------------------------------------------------------------------------------
+// Cache cell geometry for integration domain.
+void
+pylith::feassemble::IntegratorDomain::cacheGeometry(pylith::feassemble::FEGeometryCache* geometryCache) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" cacheGeometry(geometryCache="<<geometryCache<<")");
+
+    assert(geometryCache);
+    assert(_dsLabel);
+    geometryCache->computeGeometry(_dsLabel->dm(), _dsLabel->cellsIS(), _labelName.c_str(), _labelValue);
+
+    PYLITH_METHOD_END;
+} // cacheGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Remove cells with fully constrained closures from the integration domain.
+void
+pylith::feassemble::IntegratorDomain::removeFullyConstrainedCells(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" removeFullyConstrainedCells()");
+
+    assert(_dsLabel);
+    const PetscInt numCellsOrig = _dsLabel->numCells();
+    _dsLabel->removeFullyConstrained();
+    PYLITH_JOURNAL_DEBUG("Removed "<<numCellsOrig - _dsLabel->numCells()<<" of "<<numCellsOrig
+                                   <<" cells with fully constrained closures from integration domain.");
+
+    // Cell index set is final; tabulate the combined solution+auxiliary closure indices so cell
+    // loops gather both closures with a single indirection.
+    const PetscDM auxiliaryDM = (_auxiliaryField) ? _auxiliaryField->getDM() : NULL;
+    _dsLabel->tabulateClosureIndices(auxiliaryDM);
+
+    PYLITH_METHOD_END;
+} // removeFullyConstrainedCells
+
+
 // ------------------------------------------------------------------------------------------------
 // Set data needed for integrating faces on interior interfaces.
 void
@@ -373,10 +738,23 @@ pylith::feassemble::IntegratorDomain::setState(const PylithReal t) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("setState(t="<<t<<")");
 
+    _finishStateVarsUpdate();
     Integrator::setState(t);
 
     assert(_physics);
+    assert(_auxiliaryField);
+    PetscObjectState auxiliaryStateBefore = 0;
+    PetscErrorCode err = PetscObjectStateGet((PetscObject)_auxiliaryField->getLocalVector(), &auxiliaryStateBefore);PYLITH_CHECK_ERROR(err);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
+    PetscObjectState auxiliaryStateAfter = 0;
+    err = PetscObjectStateGet((PetscObject)_auxiliaryField->getLocalVector(), &auxiliaryStateAfter);PYLITH_CHECK_ERROR(err);
+    if (auxiliaryStateAfter != auxiliaryStateBefore) {
+        // Auxiliary field values changed (e.g., time-dependent properties); lumped Jacobian
+        // entries derived from them are stale. Otherwise the cached lumped Jacobian is
+        // reused, so dynamic runs with constant properties compute it exactly once.
+        markLHSJacobianLumpedStale();
+    } // if
+    _auxiliaryField->clearDirtySubfields();
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
@@ -391,6 +769,29 @@ pylith::feassemble::IntegratorDomain::setState(const PylithReal t) {
 } // setState
 
 
+// ------------------------------------------------------------------------------------------------
+// Update auxiliary field at end of time step.
+void
+pylith::feassemble::IntegratorDomain::poststep(const PylithReal t,
+                                               const PylithInt tindex,
+                                               const PylithReal dt,
+                                               const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("poststep(t="<<t<<", dt="<<dt<<")");
+
+    _updateStateVars(t, dt, solution); // May leave transfer into auxiliary field in flight.
+
+    if (observersExpectDataOutput(t, tindex)) {
+        // Observers read the auxiliary field, so complete any pending transfer first.
+        _finishStateVarsUpdate();
+        _computeDerivedField(t, dt, solution);
+    } // if
+    notifyObservers(t, tindex, solution);
+
+    PYLITH_METHOD_END;
+} // poststep
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute RHS residual for G(t,s).
 void
@@ -400,11 +801,14 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
     assert(residual);
+    pylith::utils::PerfLogger::Scope perfScope(_physics->getIdentifier());
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    _finishStateVarsUpdate();
+
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
 
     _setKernelConstants(*solution, dt);
 
@@ -421,6 +825,14 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
     err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
                                          solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
 
+    if (pylith::utils::PerfLogger::isEnabled()) {
+        // Estimated memory traffic of the sweep for roofline analysis: solution and
+        // auxiliary field read, residual updated.
+        pylith::utils::PerfLogger::addBytes(double(sizeof(PylithScalar)) *
+                                            (solution->getStorageSize() + residual->getStorageSize() +
+                                             ((_auxiliaryField) ? _auxiliaryField->getStorageSize() : 0)));
+    } // if
+
     PYLITH_METHOD_END;
 } // computeRHSResidual
 
@@ -433,13 +845,16 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END; }
+    pylith::utils::PerfLogger::Scope perfScope(_physics->getIdentifier());
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    _finishStateVarsUpdate();
+
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+    const pylith::topology::Field* solutionDot = integrationData.getSolutionDot();
     assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
 
     _setKernelConstants(*solution, dt);
 
@@ -456,6 +871,15 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
     err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
                                          solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
 
+    if (pylith::utils::PerfLogger::isEnabled()) {
+        // Estimated memory traffic of the sweep for roofline analysis: solution, solution
+        // time derivative, and auxiliary field read, residual updated.
+        pylith::utils::PerfLogger::addBytes(double(sizeof(PylithScalar)) *
+                                            (solution->getStorageSize() + solutionDot->getStorageSize() +
+                                             residual->getStorageSize() +
+                                             ((_auxiliaryField) ? _auxiliaryField->getStorageSize() : 0)));
+    } // if
+
     PYLITH_METHOD_END;
 } // computeLHSResidual
 
@@ -471,14 +895,17 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
 
     _needNewLHSJacobian = false;
     if (!_hasLHSJacobian) { PYLITH_METHOD_END;}
+    pylith::utils::PerfLogger::Scope perfScope(_physics->getIdentifier());
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    _finishStateVarsUpdate();
+
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+    const pylith::topology::Field* solutionDot = integrationData.getSolutionDot();
     assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
-    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::s_tshift);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
+    const PylithReal s_tshift = integrationData.getTimeShift();
 
     _setKernelConstants(*solution, dt);
 
@@ -496,6 +923,14 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
     err = DMPlexComputeJacobian_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), t, s_tshift, solution->getLocalVector(),
                                          solutionDot->getLocalVector(), jacobianMat, precondMat, NULL);PYLITH_CHECK_ERROR(err);
 
+    if (pylith::utils::PerfLogger::isEnabled()) {
+        // Estimated memory traffic of the field sweeps for roofline analysis; matrix
+        // insertion traffic is not included.
+        pylith::utils::PerfLogger::addBytes(double(sizeof(PylithScalar)) *
+                                            (solution->getStorageSize() + solutionDot->getStorageSize() +
+                                             ((_auxiliaryField) ? _auxiliaryField->getStorageSize() : 0)));
+    } // if
+
     if (_jacobianValues) {
         _jacobianValues->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, *solution, *_dsLabel);
         err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
@@ -510,6 +945,76 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
 } // computeLHSJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+// Update time-derivative shift values in LHS Jacobian for current time step.
+void
+pylith::feassemble::IntegratorDomain::updateLHSJacobianTimeShift(PetscMat jacobianMat,
+                                                                 PetscMat precondMat,
+                                                                 const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" updateLHSJacobianTimeShift(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<")");
+
+    if (!_jacobianValues) { PYLITH_METHOD_END;}
+
+    const pylith::topology::Field* solution = integrationData.getSolution();
+    assert(solution);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
+    const PylithReal s_tshift = integrationData.getTimeShift();
+
+    assert(_dsLabel);
+    _jacobianValues->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, *solution, *_dsLabel);
+    PetscErrorCode err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    if (precondMat && (precondMat != jacobianMat)) {
+        err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+        err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // updateLHSJacobianTimeShift
+
+
+// ------------------------------------------------------------------------------------------------
+// Apply action of LHS Jacobian for F(t,s,\dot{s}) without assembling a matrix (matrix-free).
+void
+pylith::feassemble::IntegratorDomain::computeLHSJacobianAction(PetscVec vecInLocal,
+                                                               PetscVec vecOutLocal,
+                                                               const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobianAction(vecInLocal="<<vecInLocal<<", vecOutLocal="<<vecOutLocal<<", integrationData="<<integrationData.str()<<")");
+    if (!_hasLHSJacobian) { PYLITH_METHOD_END;}
+
+    _finishStateVarsUpdate();
+
+    const pylith::topology::Field* solution = integrationData.getSolution();
+    assert(solution);
+    const pylith::topology::Field* solutionDot = integrationData.getSolutionDot();
+    assert(solutionDot);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
+    const PylithReal s_tshift = integrationData.getTimeShift();
+
+    _setKernelConstants(*solution, dt);
+
+    assert(_dsLabel);
+    PetscFormKey key;
+    key.label = _dsLabel->label();
+    key.value = _dsLabel->value();
+    key.part = pylith::feassemble::Integrator::LHS;
+
+    PetscErrorCode err;
+    assert(solution->getLocalVector());
+    assert(vecInLocal);
+    assert(vecOutLocal);
+    err = DMPlexComputeJacobian_Action_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), t, s_tshift,
+                                                solution->getLocalVector(), solutionDot->getLocalVector(),
+                                                vecInLocal, vecOutLocal, NULL);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}).
 void
@@ -521,11 +1026,13 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
     _needNewLHSJacobianLumped = false;
     if (!_hasLHSJacobianLumped) { PYLITH_METHOD_END;}
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    _finishStateVarsUpdate();
+
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
-    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::s_tshift);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
+    const PylithReal s_tshift = integrationData.getTimeShift();
 
     _setKernelConstants(*solution, dt);
 
@@ -535,9 +1042,10 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
     key.value = _dsLabel->value();
     key.part = pylith::feassemble::Integrator::LHS_LUMPED_INV;
 
+    pylith::feassemble::WorkVectorPool* workVectorPool = integrationData.getWorkVectorPool();assert(workVectorPool);
+
     PetscErrorCode err;
-    PetscVec vecRowSum = NULL;
-    err = DMGetLocalVector(_dsLabel->dm(), &vecRowSum);PYLITH_CHECK_ERROR(err);
+    PetscVec vecRowSum = workVectorPool->checkout(solution->getLocalVector());
     err = VecSet(vecRowSum, 1.0);PYLITH_CHECK_ERROR(err);
 
     assert(jacobianInv);
@@ -545,7 +1053,7 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
     err = DMPlexComputeJacobian_Action_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), t, s_tshift, vecRowSum, NULL,
                                                 vecRowSum, jacobianInv->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
 
-    err = DMRestoreLocalVector(_dsLabel->dm(), &vecRowSum);PYLITH_CHECK_ERROR(err);
+    workVectorPool->restore(&vecRowSum);
     // Compute the Jacobian inverse.
     err = VecReciprocal(jacobianInv->getLocalVector());PYLITH_CHECK_ERROR(err);
 
@@ -586,9 +1094,23 @@ pylith::feassemble::IntegratorDomain::_updateStateVars(const PylithReal t,
     PetscInt labelValue = 0;
     const PetscInt part = 0;
     err = DMSetAuxiliaryVec(stateVarsDM, dmLabel, labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMProjectFieldLocal(stateVarsDM, t, solution.getLocalVector(), kernelsStateVars, INSERT_VALUES,
-                              _updateState->stateVarsLocalVector());PYLITH_CHECK_ERROR(err);
-    _updateState->restore(_auxiliaryField);
+    const bool fullUpdate = _updateState->useFullUpdate();
+    if (fullUpdate) {
+        err = DMProjectFieldLocal(stateVarsDM, t, solution.getLocalVector(), kernelsStateVars, INSERT_VALUES,
+                                  _updateState->stateVarsLocalVector());PYLITH_CHECK_ERROR(err);
+    } else {
+        // Incremental update; project only over cells whose state vars changed in the previous update.
+        const PetscInt changedValue = pylith::feassemble::UpdateStateVars::changedCellsLabelValue;
+        err = DMProjectFieldLabelLocal(stateVarsDM, t, _updateState->changedCellsLabel(), 1, &changedValue,
+                                       PETSC_DETERMINE, NULL, solution.getLocalVector(), kernelsStateVars,
+                                       INSERT_VALUES, _updateState->stateVarsLocalVector());PYLITH_CHECK_ERROR(err);
+    } // if/else
+    // Start the transfer back into the auxiliary field; the change tally runs on the state-vars
+    // vectors while the communication is in flight, and poststep() defers the completion until
+    // the auxiliary field is next read.
+    _updateState->restoreBegin(_auxiliaryField);
+    _stateVarsRestorePending = true;
+    _updateState->updateChangeTally(fullUpdate);
 
     delete[] kernelsStateVars;kernelsStateVars = NULL;
 
@@ -610,6 +1132,7 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
     } // if
 
     assert(_derivedField);
+    _finishStateVarsUpdate();
     _setKernelConstants(solution, dt);
 
     const size_t numKernels = _kernelsDerivedField.size();
@@ -640,4 +1163,49 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
 } // _computeDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Finish any pending transfer of updated state variables into the auxiliary field.
+void
+pylith::feassemble::IntegratorDomain::_finishStateVarsUpdate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_stateVarsRestorePending) {
+        assert(_updateState);
+        assert(_auxiliaryField);
+        _updateState->restoreEnd(_auxiliaryField);
+        _stateVarsRestorePending = false;
+    } // if
+
+    PYLITH_METHOD_END;
+} // _finishStateVarsUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Combine value into signature identifying kernels (FNV-1a style hash).
+size_t
+pylith::feassemble::_IntegratorDomian::mixSignature(const size_t signature,
+                                                    const size_t value) {
+    const size_t offsetBasis = size_t(14695981039346656037ULL);
+    const size_t prime = size_t(1099511628211ULL);
+    return ((signature ? signature : offsetBasis) ^ value) * prime;
+} // mixSignature
+
+
+// ------------------------------------------------------------------------------------------------
+// Fill array with small pseudo-random perturbations.
+void
+pylith::feassemble::_IntegratorDomian::fillPerturbation(PylithScalar* values,
+                                                        const size_t size,
+                                                        const PylithScalar scale) {
+    static unsigned int state = 0x2468aceu;
+    for (size_t i = 0; i < size; ++i) {
+        state = state*1664525u + 1013904223u;
+        values[i] = scale * (PylithScalar((state >> 8) & 0xffffffu) / PylithScalar(0x1000000u) - 0.5);
+    } // for
+} // fillPerturbation
+
+
+const PetscInt pylith::feassemble::_IntegratorDomian::autotuneNumPoints = 4096;
+const PetscInt pylith::feassemble::_IntegratorDomian::autotuneNumReps = 32;
+
 // End of file
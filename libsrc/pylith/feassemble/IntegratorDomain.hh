@@ -30,6 +30,7 @@
 #include "pylith/feassemble/Integrator.hh" // ISA Integrator
 #include "pylith/feassemble/JacobianValues.hh" // USES JacobianValues::JacobianKernels
 #include "pylith/utils/arrayfwd.hh" // HASA std::vector
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
 
 class pylith::feassemble::IntegratorDomain : public pylith::feassemble::Integrator {
     friend class TestIntegratorDomain; // unit testing
@@ -138,6 +139,15 @@ public:
      */
     const pylith::topology::Mesh& getPhysicsDomainMesh(void) const;
 
+    /** Get signature identifying the kernels and discretization used by the integrator.
+     *
+     * The signature combines the residual and Jacobian kernels with the solution subfields
+     * they act on, so integrators for materials with identical physics share a signature.
+     *
+     * @returns Signature of kernels (0 if no kernels have been set).
+     */
+    size_t getKernelSignature(void) const;
+
     /** Set kernels for residual.
      *
      * @param[in] kernels Array of kernels for computing the residual.
@@ -146,6 +156,25 @@ public:
     void setKernelsResidual(const std::vector<ResidualKernels>& kernels,
                             const pylith::topology::Field& solution);
 
+    /** Register alternate residual kernels for measurement-based selection (autotuning).
+     *
+     * The variant must be semantically equivalent to the kernels set with setKernelsResidual()
+     * and parallel them entry for entry (same subfields and equation parts in the same order).
+     * With autotuning enabled, initialize() benchmarks the variants against the primary kernels
+     * on a sample batch of quadrature points and installs the fastest set.
+     *
+     * @param[in] name Name identifying the variant in the autotuning report.
+     * @param[in] kernels Array of kernels for computing the residual.
+     */
+    void addKernelsResidualVariant(const char* name,
+                                   const std::vector<ResidualKernels>& kernels);
+
+    /** Set whether to benchmark registered kernel variants at initialization and select the fastest.
+     *
+     * @param[in] value True if kernel variants should be autotuned.
+     */
+    void setAutotuneKernels(const bool value);
+
     /** Set kernels for Jacobian.
      *
      * @param[in] kernels Array of kernels for computing the Jacobian.
@@ -154,6 +183,18 @@ public:
     void setKernelsJacobian(const std::vector<JacobianKernels>& kernels,
                             const pylith::topology::Field& solution);
 
+    /** Set kernels for preconditioning matrix.
+     *
+     * Registers dedicated kernels for assembling the preconditioning matrix (e.g.,
+     * approximate Schur-complement blocks for fieldsplit preconditioners). Without them
+     * the preconditioning matrix is assembled with the Jacobian kernels.
+     *
+     * @param[in] kernels Array of kernels for computing the preconditioning matrix.
+     * @param[in] solution Solution field.
+     */
+    void setKernelsJacobianPrecond(const std::vector<JacobianKernels>& kernels,
+                                   const pylith::topology::Field& solution);
+
     /** Set kernels for Jacobian without finite-element integration.
      *
      * @param[in] kernelsJacobian Array of kernels for computing the Jacobian values without integration.
@@ -169,6 +210,15 @@ public:
      */
     void setKernelsUpdateStateVars(const std::vector<ProjectKernels>& kernels);
 
+    /** Set parameters for incremental update of state variables.
+     *
+     * @param[in] changeThreshold Relative change in state variables below which cells are
+     * skipped in the update (<= 0 updates all cells every time step).
+     * @param[in] refreshInterval Number of time steps between full updates (0 means never).
+     */
+    void setIncrementalStateVarsUpdate(const PylithReal changeThreshold,
+                                       const int refreshInterval);
+
     /** Set kernels for computing derived field.
      *
      * @param kernels Array of kernels for computing derived field.
@@ -181,6 +231,15 @@ public:
      */
     void initialize(const pylith::topology::Field& solution);
 
+    /** Cache cell geometry for integration domain.
+     *
+     * @param[inout] geometryCache Cache of cell geometry shared across integrators.
+     */
+    void cacheGeometry(pylith::feassemble::FEGeometryCache* geometryCache);
+
+    /// Remove cells with fully constrained closures from the integration domain.
+    void removeFullyConstrainedCells(void);
+
     /** Set data needed for integrating faces on interior interfaces.
      *
      * @param[in] solution Solution field.
@@ -195,6 +254,23 @@ public:
      */
     void setState(const PylithReal t);
 
+    /** Update auxiliary field at end of time step.
+     *
+     * Overlaps the transfer of the updated state variables back into the auxiliary field
+     * with the change tally and, when no observer will consume output this step, with the
+     * observer notification; the transfer is completed before the auxiliary field is next
+     * read.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] dt Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void poststep(const PylithReal t,
+                  const PylithInt tindex,
+                  const PylithReal dt,
+                  const pylith::topology::Field& solution);
+
     /** Compute RHS residual for G(t,s).
      *
      * @param[out] residual Field for residual.
@@ -221,6 +297,31 @@ public:
                             PetscMat precondMat,
                             const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Update time-derivative shift values in LHS Jacobian for current time step.
+     *
+     * Reruns the JacobianValues kernels, overwriting the shift entries in place without
+     * finite-element reassembly.
+     *
+     * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
+     * @param[out] precondMat PETSc Mat with Jacobian preconditioning sparse matrix.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    void updateLHSJacobianTimeShift(PetscMat jacobianMat,
+                                    PetscMat precondMat,
+                                    const pylith::feassemble::IntegrationData& integrationData);
+
+    /** Apply action of LHS Jacobian for F(t,s,\dot{s}) without assembling a matrix (matrix-free).
+     *
+     * The action is computed directly from the Jf kernels; the Jacobian matrix is never formed.
+     *
+     * @param[in] vecInLocal Local PETSc Vec with vector the Jacobian acts on.
+     * @param[out] vecOutLocal Local PETSc Vec accumulating the Jacobian action.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    void computeLHSJacobianAction(PetscVec vecInLocal,
+                                  PetscVec vecOutLocal,
+                                  const pylith::feassemble::IntegrationData& integrationData);
+
     /** Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) with explicit time-stepping.
      *
      * @param[out] jacobianInv Inverse of lumped Jacobian as a field.
@@ -252,17 +353,52 @@ protected:
                               const PylithReal dt,
                               const pylith::topology::Field& solution);
 
+    /// Finish any pending transfer of updated state variables into the auxiliary field.
+    void _finishStateVarsUpdate(void);
+
+    // PRIVATE STRUCTS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Alternate residual kernels registered for autotuning.
+    struct ResidualKernelsVariant {
+        std::string name; ///< Name identifying the variant in the autotuning report.
+        std::vector<ResidualKernels> kernels; ///< Kernels for computing the residual.
+    }; // ResidualKernelsVariant
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Benchmark registered residual kernel variants and install the fastest set.
+     *
+     * Each variant (and the primary kernels) is timed on a sample batch of synthetic
+     * quadrature-point data with the auxiliary values of this material, the timings are
+     * combined across processes so all processes select the same winner, and the winning
+     * kernels are installed in the weak form. Timings are recorded through the event logger
+     * and the selection is reported on the info journal.
+     *
+     * @param[in] solution Solution field (layout).
+     */
+    void _autotuneResidualKernels(const pylith::topology::Field& solution);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     std::vector<ProjectKernels> _kernelsUpdateStateVars; ///< kernels for updating state variables.
+    std::vector<ResidualKernels> _kernelsResidual; ///< Residual kernels in the order they were set.
+    std::vector<ResidualKernelsVariant> _kernelVariants; ///< Alternate residual kernels for autotuning.
+    pylith::utils::EventLogger* _logger; ///< Event logger for kernel autotuning.
+    bool _autotuneKernels; ///< True if kernel variants should be benchmarked at initialization.
     std::vector<ProjectKernels> _kernelsDerivedField; ///< kernels for computing derived field.
 
     pylith::topology::Mesh* _materialMesh; ///< Mesh associated with material.
 
     pylith::feassemble::UpdateStateVars* _updateState; ///< Data structure for layout needed to update state vars.
+    PylithReal _stateVarsChangeThreshold; ///< Relative change below which cells skip state var update.
+    int _stateVarsRefreshInterval; ///< Number of time steps between full state var updates.
+    bool _stateVarsRestorePending; ///< True if transfer of updated state vars into auxiliary field is in flight.
     pylith::feassemble::JacobianValues* _jacobianValues; ///< Jacobian values without finite-element integration.
     pylith::feassemble::DSLabelAccess* _dsLabel; ///< Information about integration (PETSc DS, Label, label value, etc).
+    size_t _kernelSignature; ///< Signature of residual and Jacobian kernels for grouping integrators.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -35,6 +35,7 @@
 #include "petscds.h" // USES PetscDS
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/PerfLogger.hh" // USES PerfLogger
 
 #include <cassert> // USES assert()
 #include <typeinfo> // USES typeid()
@@ -192,6 +193,11 @@ pylith::feassemble::IntegratorInterface::deallocate(void) {
 
     delete _interfaceMesh;_interfaceMesh = NULL;
     delete _integrationPatches;_integrationPatches = NULL;
+    for (std::map<PetscInt, PetscIS>::iterator iter = _patchCellsIS.begin(); iter != _patchCellsIS.end(); ++iter) {
+        ISDestroy(&iter->second);
+    } // for
+    _patchCellsIS.clear();
+    _patchWeakFormKeys.clear();
     DMDestroy(&_weightingDM);
     VecDestroy(&_weightingVec);
 
@@ -463,6 +469,30 @@ pylith::feassemble::IntegratorInterface::initialize(const pylith::topology::Fiel
             err = DMSetAuxiliaryVec(dmSoln, key.label, key.value, part,
                                     auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
         } // for
+
+        // Cache cohesive cells for patch; the patch label is fixed after initialization, so we avoid
+        // rebuilding the stratum index set in every residual and Jacobian evaluation.
+        if (_patchCellsIS.count(patchValue)) {
+            err = ISDestroy(&_patchCellsIS[patchValue]);PYLITH_CHECK_ERROR(err);
+        } // if
+        PetscIS patchCellsIS = pylith::topology::MeshOps::getStratumIS(dmSoln, _integrationPatches->getLabelName(),
+                                                                       patchValue);
+        _patchCellsIS[patchValue] = patchCellsIS;
+
+        // Resolve weak form keys for every equation part once; residual and Jacobian evaluations
+        // index this table directly instead of repeating label lookups every time step.
+        const PetscInt numEquationParts = 4; // LHS, RHS, LHS_LUMPED_INV, LHS_WEIGHTED
+        std::vector<WeakFormKeys>& patchWeakFormKeys = _patchWeakFormKeys[patchValue];
+        patchWeakFormKeys.resize(numEquationParts);
+        for (PetscInt iPart = 0; iPart < numEquationParts; ++iPart) {
+            WeakFormKeys& weakFormKeys = patchWeakFormKeys[iPart];
+            weakFormKeys.faces[NEGATIVE_FACE] = iter->second.negative.getPetscKey(solution, iPart);
+            weakFormKeys.faces[NEGATIVE_FACE].part = getWeakFormPart(iPart, IntegratorInterface::NEGATIVE_FACE, patchValue);
+            weakFormKeys.faces[POSITIVE_FACE] = iter->second.positive.getPetscKey(solution, iPart);
+            weakFormKeys.faces[POSITIVE_FACE].part = getWeakFormPart(iPart, IntegratorInterface::POSITIVE_FACE, patchValue);
+            weakFormKeys.faces[FAULT_FACE] = iter->second.cohesive.getPetscKey(solution, iPart);
+            weakFormKeys.faces[FAULT_FACE].part = getWeakFormPart(iPart, IntegratorInterface::FAULT_FACE, patchValue);
+        } // for
     } // for
 
     PYLITH_METHOD_END;
@@ -480,6 +510,8 @@ pylith::feassemble::IntegratorInterface::setState(const double t) {
 
     assert(_physics);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
+    assert(_auxiliaryField);
+    _auxiliaryField->clearDirtySubfields();
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
@@ -502,6 +534,7 @@ pylith::feassemble::IntegratorInterface::computeRHSResidual(pylith::topology::Fi
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
+    pylith::utils::PerfLogger::Scope perfScope(_physics->getIdentifier());
 
     _IntegratorInterface::computeResidual(residual, this, pylith::feassemble::Integrator::RHS, integrationData);
 
@@ -517,6 +550,7 @@ pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Fi
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END;}
+    pylith::utils::PerfLogger::Scope perfScope(_physics->getIdentifier());
 
     if (_hasLHSResidual) {
         const pylith::feassemble::Integrator::EquationPart equationPart = pylith::feassemble::Integrator::LHS;
@@ -529,22 +563,22 @@ pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Fi
             const pylith::topology::Field* daeWeighting =
                 integrationData.getField(pylith::feassemble::IntegrationData::dae_mass_weighting);
             const pylith::topology::Field* solution =
-                integrationData.getField(pylith::feassemble::IntegrationData::solution);
+                integrationData.getSolution();
             PetscDM dmSoln = solution->getDM();
             typedef InterfacePatches::keysmap_t keysmap_t;
             const keysmap_t& keysmap = _integrationPatches->getKeys();
 
             for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter) {
                 const PetscInt patchValue = iter->second.cohesive.getValue();
-                const PetscFormKey key = iter->second.cohesive.getPetscKey(*solution, LHS_WEIGHTED);
-                PetscInt part = getWeakFormPart(key.part, IntegratorInterface::FAULT_FACE, patchValue);
-                err = DMSetAuxiliaryVec(dmSoln, key.label, -key.value, part, daeWeighting->getLocalVector());PYLITH_CHECK_ERROR(err);
-
-                part = getWeakFormPart(key.part, IntegratorInterface::NEGATIVE_FACE, patchValue);
-                err = DMSetAuxiliaryVec(dmSoln, key.label, -key.value, part, daeWeighting->getLocalVector());PYLITH_CHECK_ERROR(err);
 
-                part = getWeakFormPart(key.part, IntegratorInterface::POSITIVE_FACE, patchValue);
-                err = DMSetAuxiliaryVec(dmSoln, key.label, -key.value, part, daeWeighting->getLocalVector());PYLITH_CHECK_ERROR(err);
+                // Use weak form keys resolved at initialization; the table is indexed by equation part.
+                assert(_patchWeakFormKeys.count(patchValue));
+                const WeakFormKeys& weakFormKeys = _patchWeakFormKeys.find(patchValue)->second[LHS_WEIGHTED];
+                const PetscInt faces[3] = { FAULT_FACE, NEGATIVE_FACE, POSITIVE_FACE };
+                for (size_t i = 0; i < 3; ++i) {
+                    const PetscFormKey& key = weakFormKeys.faces[faces[i]];
+                    err = DMSetAuxiliaryVec(dmSoln, key.label, -key.value, key.part, daeWeighting->getLocalVector());PYLITH_CHECK_ERROR(err);
+                } // for
             } // for
         } // KLUDGE
 
@@ -615,14 +649,14 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
     assert(integrator);
     assert(residual);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
     PetscVec solutionDotVec = NULL;
     if ((equationPart == pylith::feassemble::Integrator::LHS) ||
         (equationPart == pylith::feassemble::Integrator::LHS_WEIGHTED) ) {
-        const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+        const pylith::topology::Field* solutionDot = integrationData.getSolutionDot();
         assert(solutionDot);
         solutionDotVec = solutionDot->getLocalVector();
     } // if
@@ -637,20 +671,21 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
     for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter) {
         const PetscInt patchValue = iter->second.cohesive.getValue();
 
+        // Use weak form keys resolved at initialization; the table is indexed by equation part.
+        assert(integrator->_patchWeakFormKeys.count(patchValue));
+        const std::vector<IntegratorInterface::WeakFormKeys>& patchWeakFormKeys =
+            integrator->_patchWeakFormKeys.find(patchValue)->second;
+        assert(size_t(equationPart) < patchWeakFormKeys.size());
         PetscFormKey weakFormKeys[3];
-        weakFormKeys[0] = iter->second.negative.getPetscKey(*solution, equationPart);
-        weakFormKeys[0].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::NEGATIVE_FACE, patchValue);
+        weakFormKeys[0] = patchWeakFormKeys[equationPart].faces[IntegratorInterface::NEGATIVE_FACE];
+        weakFormKeys[1] = patchWeakFormKeys[equationPart].faces[IntegratorInterface::POSITIVE_FACE];
+        weakFormKeys[2] = patchWeakFormKeys[equationPart].faces[IntegratorInterface::FAULT_FACE];
 
-        weakFormKeys[1] = iter->second.positive.getPetscKey(*solution, equationPart);
-        weakFormKeys[1].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::POSITIVE_FACE, patchValue);
-
-        weakFormKeys[2] = iter->second.cohesive.getPetscKey(*solution, equationPart);
-        weakFormKeys[2].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::FAULT_FACE, patchValue);
-
-        PetscIS patchCellsIS = NULL;
+        // Use cohesive cells cached at initialization instead of rebuilding the stratum index set.
+        assert(integrator->_patchCellsIS.count(patchValue));
+        PetscIS patchCellsIS = integrator->_patchCellsIS.find(patchValue)->second;
         PetscInt numPatchCells = 0;
         const PetscInt* patchCells = NULL;
-        err = DMGetStratumIS(dmSoln, patches->getLabelName(), weakFormKeys[2].value, &patchCellsIS);PYLITH_CHECK_ERROR(err);
         err = ISGetSize(patchCellsIS, &numPatchCells);PYLITH_CHECK_ERROR(err);assert(numPatchCells > 0);
         err = ISGetIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);assert(patchCells);
         assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, patchCells[0]));
@@ -660,7 +695,6 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
         err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, weakFormKeys, patchCellsIS, t, solution->getLocalVector(),
                                                     solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
         err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
-        err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
     } // for
 
     PYLITH_METHOD_END;
@@ -688,13 +722,13 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
     assert(precondMat);
     assert(integrator);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getSolution();
     assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+    const pylith::topology::Field* solutionDot = integrationData.getSolutionDot();
     assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
-    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::s_tshift);
+    const PylithReal t = integrationData.getTime();
+    const PylithReal dt = integrationData.getTimeStep();
+    const PylithReal s_tshift = integrationData.getTimeShift();
 
     integrator->_setKernelConstants(*solution, dt);
 
@@ -705,20 +739,21 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
     for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter) {
         const PetscInt patchValue = iter->second.cohesive.getValue();
 
+        // Use weak form keys resolved at initialization; the table is indexed by equation part.
+        assert(integrator->_patchWeakFormKeys.count(patchValue));
+        const std::vector<IntegratorInterface::WeakFormKeys>& patchWeakFormKeys =
+            integrator->_patchWeakFormKeys.find(patchValue)->second;
+        assert(size_t(equationPart) < patchWeakFormKeys.size());
         PetscFormKey weakFormKeys[3];
-        weakFormKeys[0] = iter->second.negative.getPetscKey(*solution, equationPart);
-        weakFormKeys[0].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::NEGATIVE_FACE, patchValue);
-
-        weakFormKeys[1] = iter->second.positive.getPetscKey(*solution, equationPart);
-        weakFormKeys[1].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::POSITIVE_FACE, patchValue);
-
-        weakFormKeys[2] = iter->second.cohesive.getPetscKey(*solution, equationPart);
-        weakFormKeys[2].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::FAULT_FACE, patchValue);
+        weakFormKeys[0] = patchWeakFormKeys[equationPart].faces[IntegratorInterface::NEGATIVE_FACE];
+        weakFormKeys[1] = patchWeakFormKeys[equationPart].faces[IntegratorInterface::POSITIVE_FACE];
+        weakFormKeys[2] = patchWeakFormKeys[equationPart].faces[IntegratorInterface::FAULT_FACE];
 
-        PetscIS patchCellsIS = NULL;
+        // Use cohesive cells cached at initialization instead of rebuilding the stratum index set.
+        assert(integrator->_patchCellsIS.count(patchValue));
+        PetscIS patchCellsIS = integrator->_patchCellsIS.find(patchValue)->second;
         PetscInt numPatchCells = 0;
         const PetscInt* patchCells = NULL;
-        err = DMGetStratumIS(dmSoln, patches->getLabelName(), weakFormKeys[2].value, &patchCellsIS);PYLITH_CHECK_ERROR(err);
         err = ISGetSize(patchCellsIS, &numPatchCells);PYLITH_CHECK_ERROR(err);assert(numPatchCells > 0);
         err = ISGetIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);assert(patchCells);
         assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, patchCells[0]));
@@ -728,7 +763,6 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
                                                     solutionDot->getLocalVector(), jacobianMat, precondMat,
                                                     NULL);PYLITH_CHECK_ERROR(err);
         err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
-        err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
     }
     PYLITH_METHOD_END;
 } // computeJacobian
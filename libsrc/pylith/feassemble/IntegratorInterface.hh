@@ -31,6 +31,9 @@
 #include "pylith/feassemble/FEKernelKey.hh" // HASA FEKernelKey
 #include "pylith/materials/materialsfwd.hh" // USES Material
 #include "pylith/utils/arrayfwd.hh" // HASA std::vector
+#include "pylith/utils/types.hh" // HASA PetscFormKey
+
+#include <map> // HASA std::map
 
 class pylith::feassemble::IntegratorInterface : public pylith::feassemble::Integrator {
     friend class _IntegratorInterface; // private utility class
@@ -247,7 +250,14 @@ private:
     pylith::topology::Mesh* _interfaceMesh; ///< Boundary mesh.
     std::string _surfaceLabelName; ///< Name of label identifying interface surface.
 
+    /// Weak form keys for the three integration faces of a patch, resolved once in initialize().
+    struct WeakFormKeys {
+        PetscFormKey faces[3]; ///< Keys indexed by FaceEnum (negative, positive, fault).
+    }; // WeakFormKeys
+
     pylith::feassemble::InterfacePatches* _integrationPatches; ///< Face patches.
+    std::map<PetscInt, PetscIS> _patchCellsIS; ///< Cohesive cells for each integration patch.
+    std::map<PetscInt, std::vector<WeakFormKeys> > _patchWeakFormKeys; ///< Keys for each integration patch, indexed by equation part.
 
     PetscDM _weightingDM; ///< PETSc DM for weighting.
     PetscVec _weightingVec; ///< PETSc Vec for weighting values.
@@ -95,13 +95,21 @@ pylith::feassemble::InterfacePatches::createMaterialPairs(const pylith::faults::
 
     PetscErrorCode err = DMCreateLabel(dmSoln, patchLabelName.c_str());PYLITH_CHECK_ERROR(err);
 
-    std::map<std::pair<int,int>, int> integrationPatches;
+    // Look up label handles once; by-name label queries search the DM label list and become a
+    // scaling bottleneck at startup for meshes with many faults (one patch label per fault).
+    PetscDMLabel cellsLabel = NULL;
+    err = DMGetLabel(dmSoln, cellsLabelName, &cellsLabel);PYLITH_CHECK_ERROR(err);assert(cellsLabel);
+    PetscDMLabel patchLabel = NULL;
+    err = DMGetLabel(dmSoln, patchLabelName.c_str(), &patchLabel);PYLITH_CHECK_ERROR(err);assert(patchLabel);
+
+    typedef std::map<std::pair<int,int>, int> patchesmap_t;
+    patchesmap_t integrationPatches;
     PylithInt patchLabelValue = 0;
 
     PetscIS cohesiveCellsIS = NULL;
     PylithInt numCohesiveCells = 0;
     const PylithInt* cohesiveCells = NULL;
-    err = DMGetStratumIS(dmSoln, cellsLabelName, fault->getCohesiveLabelValue(), &cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
+    cohesiveCellsIS = pylith::topology::MeshOps::getStratumIS(dmSoln, cellsLabelName, fault->getCohesiveLabelValue());
     if (!cohesiveCellsIS) {PYLITH_METHOD_RETURN(patches);}
     err = ISGetSize(cohesiveCellsIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);assert(numCohesiveCells > 0);
     err = ISGetIndices(cohesiveCellsIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);assert(cohesiveCells);
@@ -117,10 +125,11 @@ pylith::feassemble::InterfacePatches::createMaterialPairs(const pylith::faults::
         assert(adjacentCellPositive >= 0);
 
         std::pair<int, int> matPair;
-        err = DMGetLabelValue(dmSoln, cellsLabelName, adjacentCellNegative, &matPair.first);
-        err = DMGetLabelValue(dmSoln, cellsLabelName, adjacentCellPositive, &matPair.second);
-        if (0 == integrationPatches.count(matPair)) {
-            integrationPatches[matPair] = ++patchLabelValue;
+        err = DMLabelGetValue(cellsLabel, adjacentCellNegative, &matPair.first);PYLITH_CHECK_ERROR(err);
+        err = DMLabelGetValue(cellsLabel, adjacentCellPositive, &matPair.second);PYLITH_CHECK_ERROR(err);
+        patchesmap_t::const_iterator patchIter = integrationPatches.find(matPair);
+        if (integrationPatches.end() == patchIter) {
+            patchIter = integrationPatches.insert(std::make_pair(matPair, ++patchLabelValue)).first;
             pythia::journal::debug_t debug("interfacepatches");
             // debug.activate();
             debug << pythia::journal::at(__HERE__)
@@ -145,7 +154,7 @@ pylith::feassemble::InterfacePatches::createMaterialPairs(const pylith::faults::
             weakFormKeys.positive = *key;delete key;key = NULL;
             patches->_keys[patchLabelValue] = weakFormKeys;
         } // if
-        err = DMSetLabelValue(dmSoln, patchLabelName.c_str(), cohesiveCell, integrationPatches[matPair]);
+        err = DMLabelSetValue(patchLabel, cohesiveCell, patchIter->second);PYLITH_CHECK_ERROR(err);
     } // for
     err = ISRestoreIndices(cohesiveCellsIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
     err = ISDestroy(&cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
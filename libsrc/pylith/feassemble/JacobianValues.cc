@@ -97,28 +97,28 @@ pylith::feassemble::JacobianValues::computeLHSJacobian(PetscMat jacobianMat,
     err = PetscDSGetTotalDimension(dsLabel.ds(), &totalDof);PYLITH_CHECK_ERROR(err);
     scalar_array cellMat(totalDof*totalDof);
 
+    // The kernels depend only on the DS layout and the time shift, not on cell data, so the cell
+    // matrix is identical for every cell. Fill each block once and reuse it across the closure
+    // loop instead of re-running the kernel callbacks per cell; a dt change in adaptive runs then
+    // costs one block fill plus block inserts.
     if (jacobianMat) {
+        cellMat = 0.0;
+        for (size_t i = 0; i < _kernelsJacobian.size(); ++i) {
+            _JacobianValues::evaluateKernel(&cellMat, _kernelsJacobian[i], t, dt, s_tshift, solution, dsLabel);
+        } // for
         for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
-            const PetscInt cell = cellIndices[iCell];
-            cellMat = 0.0;
-
-            for (size_t i = 0; i < _kernelsJacobian.size(); ++i) {
-                _JacobianValues::evaluateKernel(&cellMat, _kernelsJacobian[i], t, dt, s_tshift, solution, dsLabel);
-            } // for
-            err = DMPlexMatSetClosure(dsLabel.dm(), NULL, NULL, jacobianMat, cell, &cellMat[0],
+            err = DMPlexMatSetClosure(dsLabel.dm(), NULL, NULL, jacobianMat, cellIndices[iCell], &cellMat[0],
                                       INSERT_VALUES);PYLITH_CHECK_ERROR(err);
         } // for
     } // if
 
     if (precondMat && (jacobianMat != precondMat)) {
+        cellMat = 0.0;
+        for (size_t i = 0; i < _kernelsPrecond.size(); ++i) {
+            _JacobianValues::evaluateKernel(&cellMat, _kernelsPrecond[i], t, dt, s_tshift, solution, dsLabel);
+        } // for
         for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
-            const PetscInt cell = cellIndices[iCell];
-            cellMat = 0.0;
-
-            for (size_t i = 0; i < _kernelsPrecond.size(); ++i) {
-                _JacobianValues::evaluateKernel(&cellMat, _kernelsPrecond[i], t, dt, s_tshift, solution, dsLabel);
-            } // for
-            err = DMPlexMatSetClosure(dsLabel.dm(), NULL, NULL, precondMat, cell, &cellMat[0],
+            err = DMPlexMatSetClosure(dsLabel.dm(), NULL, NULL, precondMat, cellIndices[iCell], &cellMat[0],
                                       INSERT_VALUES);PYLITH_CHECK_ERROR(err);
         } // for
     } // if
@@ -90,6 +90,14 @@ pylith::feassemble::PhysicsImplementation::getAuxiliaryField(void) const {
 } // getAuxiliaryField
 
 
+// ------------------------------------------------------------------------------------------------
+// Get auxiliary field (mutable).
+pylith::topology::Field*
+pylith::feassemble::PhysicsImplementation::getAuxiliaryField(void) {
+    return _auxiliaryField;
+} // getAuxiliaryField
+
+
 // ------------------------------------------------------------------------------------------------
 // Get derived field.
 const pylith::topology::Field*
@@ -114,4 +122,24 @@ pylith::feassemble::PhysicsImplementation::notifyObservers(const PylithReal t,
 } // _notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer would consume a data update at time t.
+bool
+pylith::feassemble::PhysicsImplementation::observersExpectDataOutput(const PylithReal t,
+                                                                     const PylithInt tindex) const {
+    return (_observers) ? _observers->expectsDataOutput(t, tindex) : false;
+} // observersExpectDataOutput
+
+
+// ------------------------------------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation in observers.
+void
+pylith::feassemble::PhysicsImplementation::setObserversExpectedTimeSteps(const size_t numTimeSteps,
+                                                                         const PylithReal duration) {
+    if (_observers) {
+        _observers->setExpectedTimeSteps(numTimeSteps, duration);
+    } // if
+} // setObserversExpectedTimeSteps
+
+
 // End of file
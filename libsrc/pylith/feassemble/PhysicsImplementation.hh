@@ -78,6 +78,12 @@ public:
      */
     const pylith::topology::Field* getAuxiliaryField(void) const;
 
+    /** Get auxiliary field (mutable).
+     *
+     * @returns field Field over boundary.
+     */
+    pylith::topology::Field* getAuxiliaryField(void);
+
     /** Get derived field.
      *
      * @return field Field over integrator domain.
@@ -94,6 +100,23 @@ public:
                          const PylithInt tindex,
                          const pylith::topology::Field& solution);
 
+    /** Check whether any observer would consume a data update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if at least one observer would consume a data update at time t, false otherwise.
+     */
+    bool observersExpectDataOutput(const PylithReal t,
+                                   const PylithInt tindex) const;
+
+    /** Set expected number of time steps and duration of the simulation in observers.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    void setObserversExpectedTimeSteps(const size_t numTimeSteps,
+                                       const PylithReal duration);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
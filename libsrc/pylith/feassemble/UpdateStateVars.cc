@@ -26,6 +26,8 @@
 
 #include <cassert> // USES assert()
 
+const PetscInt pylith::feassemble::UpdateStateVars::changedCellsLabelValue = 1;
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::feassemble::UpdateStateVars::UpdateStateVars(void) :
@@ -33,7 +35,12 @@ pylith::feassemble::UpdateStateVars::UpdateStateVars(void) :
     _stateVarsDM(NULL),
     _stateVarsVecLocal(NULL),
     _stateVarsVecGlobal(NULL),
-    _auxiliaryFieldVecGlobal(NULL) {}
+    _auxiliaryFieldVecGlobal(NULL),
+    _stateVarsVecBefore(NULL),
+    _changedCellsLabel(NULL),
+    _changeThreshold(0.0),
+    _refreshInterval(0),
+    _stepsSinceFullUpdate(0) {}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -55,6 +62,8 @@ pylith::feassemble::UpdateStateVars::deallocate(void) {
     err = VecDestroy(&_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_stateVarsVecBefore);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDestroy(&_changedCellsLabel);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -127,6 +136,18 @@ pylith::feassemble::UpdateStateVars::prepare(pylith::topology::Field* auxiliaryF
     err = DMLocalToGlobalBegin(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
     err = DMLocalToGlobalEnd(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
 
+    if (_changeThreshold > 0.0) {
+        // Seed the state vars with the current values so that cells skipped by an incremental
+        // update keep them, and snapshot the values to measure the change after the update.
+        err = VecISCopy(_auxiliaryFieldVecGlobal, _stateVarsIS, SCATTER_REVERSE, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalBegin(_stateVarsDM, _stateVarsVecGlobal, INSERT_VALUES, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalEnd(_stateVarsDM, _stateVarsVecGlobal, INSERT_VALUES, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+        if (!_stateVarsVecBefore) {
+            err = VecDuplicate(_stateVarsVecLocal, &_stateVarsVecBefore);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecCopy(_stateVarsVecLocal, _stateVarsVecBefore);PYLITH_CHECK_ERROR(err);
+    } // if
+
     PYLITH_METHOD_END;
 } // prepare
 
@@ -137,6 +158,19 @@ void
 pylith::feassemble::UpdateStateVars::restore(pylith::topology::Field* auxiliaryField) {
     PYLITH_METHOD_BEGIN;
 
+    restoreBegin(auxiliaryField);
+    restoreEnd(auxiliaryField);
+
+    PYLITH_METHOD_END;
+} // restore
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Start moving updated state variables back into the auxiliary field.
+void
+pylith::feassemble::UpdateStateVars::restoreBegin(pylith::topology::Field* auxiliaryField) {
+    PYLITH_METHOD_BEGIN;
+
     PetscErrorCode err = 0;
     assert(auxiliaryField);
     PetscDM auxiliaryDM = auxiliaryField->getDM();
@@ -148,12 +182,130 @@ pylith::feassemble::UpdateStateVars::restore(pylith::topology::Field* auxiliaryF
     // Copy global data from stateVars to auxiliaryField
     err = VecISCopy(_auxiliaryFieldVecGlobal, _stateVarsIS, SCATTER_FORWARD, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
 
-    // Move auxiliaryDM data to local vector
+    // Start moving auxiliaryDM data to local vector; communication overlaps with work between
+    // restoreBegin() and restoreEnd().
     err = DMGlobalToLocalBegin(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // restoreBegin
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Finish moving updated state variables back into the auxiliary field.
+void
+pylith::feassemble::UpdateStateVars::restoreEnd(pylith::topology::Field* auxiliaryField) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    assert(auxiliaryField);
+    PetscDM auxiliaryDM = auxiliaryField->getDM();
+
     err = DMGlobalToLocalEnd(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
-} // restore
+} // restoreEnd
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set parameters for incremental update of state variables.
+void
+pylith::feassemble::UpdateStateVars::setIncrementalUpdate(const PylithReal changeThreshold,
+                                                          const int refreshInterval) {
+    _changeThreshold = changeThreshold;
+    _refreshInterval = refreshInterval;
+} // setIncrementalUpdate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Determine if the next update must project the state variables over the entire domain.
+bool
+pylith::feassemble::UpdateStateVars::useFullUpdate(void) const {
+    if (_changeThreshold <= 0.0) { return true; } // Incremental mode disabled.
+    if (!_changedCellsLabel) { return true; } // No change tally yet.
+    if ((_refreshInterval > 0) && (_stepsSinceFullUpdate >= _refreshInterval)) { return true; }
+
+    return false;
+} // useFullUpdate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get label with cells whose state variables changed by more than the threshold.
+PetscDMLabel
+pylith::feassemble::UpdateStateVars::changedCellsLabel(void) {
+    return _changedCellsLabel;
+} // changedCellsLabel
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update per-cell change tally after projecting the state variables.
+void
+pylith::feassemble::UpdateStateVars::updateChangeTally(const bool fullUpdate) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_changeThreshold <= 0.0) {
+        PYLITH_METHOD_END;
+    } // if
+    assert(_stateVarsVecBefore);
+
+    PetscErrorCode err = 0;
+    if (!_changedCellsLabel) {
+        err = DMLabelCreate(PETSC_COMM_SELF, "state vars changed", &_changedCellsLabel);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = DMLabelReset(_changedCellsLabel);PYLITH_CHECK_ERROR(err);
+
+    PetscSection section = NULL;
+    err = DMGetLocalSection(_stateVarsDM, &section);PYLITH_CHECK_ERROR(err);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(_stateVarsDM, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* stateVarsAfter = NULL;
+    const PetscScalar* stateVarsBefore = NULL;
+    err = VecGetArrayRead(_stateVarsVecLocal, &stateVarsAfter);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(_stateVarsVecBefore, &stateVarsBefore);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, offset = 0;
+        err = PetscSectionGetDof(section, point, &dof);PYLITH_CHECK_ERROR(err);
+        if (!dof) { continue; }
+        err = PetscSectionGetOffset(section, point, &offset);PYLITH_CHECK_ERROR(err);
+
+        bool hasChanged = false;
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            const PylithReal valueAfter = PetscAbsScalar(stateVarsAfter[offset+iDof]);
+            const PylithReal valueBefore = PetscAbsScalar(stateVarsBefore[offset+iDof]);
+            const PylithReal change = PetscAbsScalar(stateVarsAfter[offset+iDof] - stateVarsBefore[offset+iDof]);
+            const PylithReal scale = PetscMax(valueAfter, valueBefore);
+            if (change > _changeThreshold * scale) {
+                hasChanged = true;
+                break;
+            } // if
+        } // for
+        if (!hasChanged) { continue; }
+
+        if ((point >= cStart) && (point < cEnd)) {
+            err = DMLabelSetValue(_changedCellsLabel, point, changedCellsLabelValue);PYLITH_CHECK_ERROR(err);
+        } else {
+            // Mark all cells in the star of the point (state vars with dof on vertices, edges, or faces).
+            PetscInt* star = NULL;
+            PetscInt starSize = 0;
+            err = DMPlexGetTransitiveClosure(_stateVarsDM, point, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iStar = 0; iStar < starSize; ++iStar) {
+                const PetscInt starPoint = star[2*iStar];
+                if ((starPoint >= cStart) && (starPoint < cEnd)) {
+                    err = DMLabelSetValue(_changedCellsLabel, starPoint, changedCellsLabelValue);PYLITH_CHECK_ERROR(err);
+                } // if
+            } // for
+            err = DMPlexRestoreTransitiveClosure(_stateVarsDM, point, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+        } // if/else
+    } // for
+    err = VecRestoreArrayRead(_stateVarsVecLocal, &stateVarsAfter);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(_stateVarsVecBefore, &stateVarsBefore);PYLITH_CHECK_ERROR(err);
+
+    _stepsSinceFullUpdate = (fullUpdate) ? 1 : _stepsSinceFullUpdate + 1;
+
+    PYLITH_METHOD_END;
+} // updateChangeTally
 
 
 // End of file
@@ -73,11 +73,72 @@ public:
     void prepare(pylith::topology::Field* auxiliaryField);
 
     /** Update state variables in auxiliary field after computing them.
+     *
+     * Equivalent to restoreBegin() followed immediately by restoreEnd().
      *
      * @param[inout] auxiliaryField Auxiliary field containing state variables.
      */
     void restore(pylith::topology::Field* auxiliaryField);
 
+    /** Start moving updated state variables back into the auxiliary field.
+     *
+     * Copies the updated state variables into the global auxiliary vector and starts the
+     * global-to-local transfer of the auxiliary field, which may involve parallel
+     * communication. Independent work (e.g., tallying changed cells or notifying observers
+     * that will not read the auxiliary field) can run between restoreBegin() and
+     * restoreEnd(); the auxiliary field must not be read or written until restoreEnd().
+     *
+     * @param[inout] auxiliaryField Auxiliary field containing state variables.
+     */
+    void restoreBegin(pylith::topology::Field* auxiliaryField);
+
+    /** Finish moving updated state variables back into the auxiliary field.
+     *
+     * @param[inout] auxiliaryField Auxiliary field containing state variables.
+     */
+    void restoreEnd(pylith::topology::Field* auxiliaryField);
+
+    /** Set parameters for incremental update of state variables.
+     *
+     * In the incremental mode, cells whose state variables changed by less than the threshold
+     * (relative change) in the previous update are skipped until the next full update. A
+     * nonpositive threshold (the default) updates the state variables over the entire domain
+     * every time step.
+     *
+     * @param[in] changeThreshold Relative change in state variables below which cells are skipped.
+     * @param[in] refreshInterval Number of time steps between full updates (0 means never).
+     */
+    void setIncrementalUpdate(const PylithReal changeThreshold,
+                              const int refreshInterval);
+
+    /** Determine if the next update must project the state variables over the entire domain.
+     *
+     * @returns True if a full update is required, false if the update can be restricted to
+     * cells marked in changedCellsLabel().
+     */
+    bool useFullUpdate(void) const;
+
+    /** Get label with cells whose state variables changed by more than the threshold.
+     *
+     * @returns PETSc DMLabel with changed cells marked with value 1.
+     */
+    PetscDMLabel changedCellsLabel(void);
+
+    /** Update per-cell change tally after projecting the state variables.
+     *
+     * Marks cells whose state variables changed by more than the threshold relative to the
+     * values before the update and advances the full-update counter. No-op unless the
+     * incremental mode is enabled via setIncrementalUpdate().
+     *
+     * @param[in] fullUpdate True if the update projected over the entire domain.
+     */
+    void updateChangeTally(const bool fullUpdate);
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    static const PetscInt changedCellsLabelValue; ///< Label value marking changed cells.
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -87,6 +148,12 @@ private:
     PetscVec _stateVarsVecGlobal; ///< Petsc Vec with global vector for state vars.
     PetscVec _auxiliaryFieldVecGlobal; ///< Petsc Vec with global vector for auxiliary field.
 
+    PetscVec _stateVarsVecBefore; ///< Petsc Vec with state vars before update (incremental mode).
+    PetscDMLabel _changedCellsLabel; ///< Label with cells whose state vars changed (incremental mode).
+    PylithReal _changeThreshold; ///< Relative change below which cells are skipped (<= 0 disables).
+    int _refreshInterval; ///< Number of time steps between full updates.
+    int _stepsSinceFullUpdate; ///< Number of incremental updates since last full update.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,111 @@
+// -*- C++ -*-
+//
+// ------------------------------------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ------------------------------------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "WorkVectorPool.hh" // implementation of object methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::feassemble::WorkVectorPool::WorkVectorPool(void) {
+    GenericComponent::setName("workvectorpool");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::feassemble::WorkVectorPool::~WorkVectorPool(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate pooled vectors.
+void
+pylith::feassemble::WorkVectorPool::deallocate(void) {
+    PetscErrorCode err;
+    for (pool_t::iterator iter = _available.begin(); iter != _available.end(); ++iter) {
+        std::vector<PetscVec>& vectors = iter->second;
+        for (size_t i = 0; i < vectors.size(); ++i) {
+            err = VecDestroy(&vectors[i]);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+    _available.clear();
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Check out a work vector with the same layout as a template vector.
+PetscVec
+pylith::feassemble::WorkVectorPool::checkout(PetscVec templateVec) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(templateVec);
+
+    PetscVec workVec = NULL;
+    std::vector<PetscVec>& available = _available[_key(templateVec)];
+    if (!available.empty()) {
+        workVec = available.back();
+        available.pop_back();
+    } else {
+        PYLITH_JOURNAL_DEBUG("Allocating work vector for pool.");
+        PetscErrorCode err = VecDuplicate(templateVec, &workVec);PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    PYLITH_METHOD_RETURN(workVec);
+} // checkout
+
+
+// ------------------------------------------------------------------------------------------------
+// Return a work vector to the pool.
+void
+pylith::feassemble::WorkVectorPool::restore(PetscVec* workVec) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(workVec);
+    if (!*workVec) { PYLITH_METHOD_END; }
+
+    _available[_key(*workVec)].push_back(*workVec);
+    *workVec = NULL;
+
+    PYLITH_METHOD_END;
+} // restore
+
+
+// ------------------------------------------------------------------------------------------------
+// Create pool key from vector layout.
+pylith::feassemble::WorkVectorPool::key_t
+pylith::feassemble::WorkVectorPool::_key(PetscVec vec) {
+    assert(vec);
+
+    PetscInt localSize = 0;
+    PetscInt globalSize = 0;
+    PetscErrorCode err;
+    err = VecGetLocalSize(vec, &localSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(vec, &globalSize);PYLITH_CHECK_ERROR(err);
+
+    return key_t(localSize, globalSize);
+} // _key
+
+
+// End of file
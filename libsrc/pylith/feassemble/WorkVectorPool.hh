@@ -0,0 +1,102 @@
+// -*- C++ -*-
+//
+// ------------------------------------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ------------------------------------------------------------------------------------------------
+//
+
+/** @file libsrc/feassemble/WorkVectorPool.hh
+ *
+ * @brief Pool of preallocated PETSc work vectors reused across evaluations.
+ *
+ * Integrators check out scratch vectors per residual/Jacobian evaluation and return them
+ * afterwards, so steady-state time stepping performs no vector allocation. Vectors are pooled
+ * by layout; the first checkout for a layout allocates the vector and later checkouts reuse it.
+ */
+
+#if !defined(pylith_feassemble_workvectorpool_hh)
+#define pylith_feassemble_workvectorpool_hh
+
+#include "feassemblefwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+#include "pylith/utils/petscfwd.h" // USES PetscVec
+#include "pylith/utils/types.hh" // USES PylithInt
+
+#include <map> // HASA std::map
+#include <utility> // HASA std::pair
+#include <vector> // HASA std::vector
+
+class pylith::feassemble::WorkVectorPool : public pylith::utils::GenericComponent {
+    friend class TestWorkVectorPool; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    WorkVectorPool(void);
+
+    /// Destructor.
+    ~WorkVectorPool(void);
+
+    /// Deallocate pooled vectors.
+    void deallocate(void);
+
+    /** Check out a work vector with the same layout as a template vector.
+     *
+     * Every checkout must be matched by a restore() before the pool is deallocated.
+     *
+     * @param[in] templateVec Vector with the desired layout.
+     * @returns Work vector (contents undefined).
+     */
+    PetscVec checkout(PetscVec templateVec);
+
+    /** Return a work vector to the pool.
+     *
+     * @param[inout] workVec Work vector from checkout(); set to NULL.
+     */
+    void restore(PetscVec* workVec);
+
+    // PRIVATE TYPEDEFS ///////////////////////////////////////////////////////////////////////////
+private:
+
+    typedef std::pair<PylithInt, PylithInt> key_t; ///< (local size, global size) of vector layout.
+    typedef std::map<key_t, std::vector<PetscVec> > pool_t;
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create pool key from vector layout.
+     *
+     * @param[in] vec Vector.
+     * @returns Key with local and global sizes.
+     */
+    static key_t _key(PetscVec vec);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    pool_t _available; ///< Work vectors available for checkout, by layout.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    WorkVectorPool(const WorkVectorPool&); ///< Not implemented.
+    const WorkVectorPool& operator=(const WorkVectorPool&); ///< Not implemented.
+
+}; // class WorkVectorPool
+
+#endif // pylith_feassemble_workvectorpool_hh
+
+// End of file
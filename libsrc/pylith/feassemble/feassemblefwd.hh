@@ -40,6 +40,8 @@ namespace pylith {
         class IntegratorBoundary; ///< Abstract base class for finite-element integration over a boundary.
         class IntegratorInterface; ///< Abstract base class for finite-element integration over an interior interface.
         class IntegrationData; ///< Data used in finite-element integration (residual, solution, t, dt, ...)
+        class FEGeometryCache; ///< Cache of cell geometry shared across integrators.
+        class WorkVectorPool; ///< Pool of preallocated PETSc work vectors reused across evaluations.
         class InterfacePatches; ///< Interface integration patches.
         class UpdateStateVars; ///< Manager for updating state variables.
         class JacobianValues; ///< Manager for setting Jacobian values without finite-element integration.
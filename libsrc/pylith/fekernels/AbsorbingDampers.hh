@@ -109,21 +109,22 @@ public:
         assert(numS >= _numS);
         const PylithInt i_vel = sOff[1];
 
-        const PylithScalar density = a[i_density];
-        const PylithScalar vp = a[i_vp];
-        const PylithScalar vs = a[i_vs];
-
-        PylithScalar velN[3];
-        PylithScalar velT[3];
-        PylithScalar velNMag = 0;
+        // Kernel arithmetic in PylithKernelScalar with accumulation into g0 in storage precision.
+        const PylithKernelScalar density = a[i_density];
+        const PylithKernelScalar vp = a[i_vp];
+        const PylithKernelScalar vs = a[i_vs];
+
+        PylithKernelScalar velN[3];
+        PylithKernelScalar velT[3];
+        PylithKernelScalar velNMag = 0;
         for (PylithInt i = 0; i < dim; ++i) {
-            velNMag += s[i_vel+i] * n[i];
+            velNMag += PylithKernelScalar(s[i_vel+i]) * PylithKernelScalar(n[i]);
         } // for
         for (PylithInt i = 0; i < dim; ++i) {
-            velN[i] = velNMag * n[i];
+            velN[i] = velNMag * PylithKernelScalar(n[i]);
         } // for
         for (PylithInt i = 0; i < dim; ++i) {
-            velT[i] = s[i_vel+i] - velN[i];
+            velT[i] = PylithKernelScalar(s[i_vel+i]) - velN[i];
         } // for
 
         for (PylithInt i = 0; i < dim; ++i) {
@@ -131,6 +132,56 @@ public:
         } // for
     } // g0
 
+    /** Jg0 function for absorbing dampers boundary condition.
+     *
+     * The damping traction is linear in velocity, so this is the exact operator relating
+     * boundary velocities to tractions (boundary impedance),
+     *
+     * Jg0_{ij} = -rho (v_s (\delta_{ij} - n_i n_j) + v_p n_i n_j)
+     */
+    static inline
+    void Jg0vv(const PylithInt dim,
+               const PylithInt numS,
+               const PylithInt numA,
+               const PylithInt sOff[],
+               const PylithInt sOff_x[],
+               const PylithScalar s[],
+               const PylithScalar s_t[],
+               const PylithScalar s_x[],
+               const PylithInt aOff[],
+               const PylithInt aOff_x[],
+               const PylithScalar a[],
+               const PylithScalar a_t[],
+               const PylithScalar a_x[],
+               const PylithReal t,
+               const PylithReal s_tshift,
+               const PylithReal x[],
+               const PylithReal n[],
+               const PylithInt numConstants,
+               const PylithScalar constants[],
+               PylithScalar Jg0[]) {
+        assert(2 == dim || 3 == dim);
+
+        const PylithInt _numA = 3;
+        assert(_numA == numA);
+        assert(aOff);
+        assert(a);
+        const PylithInt i_density = aOff[0];
+        const PylithInt i_vp = aOff[1];
+        const PylithInt i_vs = aOff[2];
+
+        const PylithScalar density = a[i_density];
+        const PylithScalar vp = a[i_vp];
+        const PylithScalar vs = a[i_vs];
+
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                const PylithScalar delta = (i == j) ? 1.0 : 0.0;
+                Jg0[i*dim+j] -= density * (vs * (delta - n[i]*n[j]) + vp * n[i]*n[j]);
+            } // for
+        } // for
+    } // Jg0vv
+
 }; // AbsorbingDampers
 
 #endif // pylith_fekernels_absorbingdampers_hh
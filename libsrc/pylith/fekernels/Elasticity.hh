@@ -168,13 +168,66 @@ public:
         assert(a);
 
         const PylithScalar* vel_t = &s_t[sOff[i_vel]]; // acceleration
-        const PylithScalar density = a[aOff[i_density]];
+        const PylithKernelScalar density = a[aOff[i_density]];
 
         for (PylithInt i = 0; i < dim; ++i) {
-            f0[i] += vel_t[i] * density;
+            f0[i] += PylithKernelScalar(vel_t[i]) * density;
         } // for
     } // f0v
 
+    // --------------------------------------------------------------------------------------------
+    /** f0 function for elasticity equation for velocity field with compile-time spatial dimension.
+     *
+     * ISA PetscPointFunc (via instantiation with Dim=2 or Dim=3)
+     *
+     * The compile-time trip count lets the compiler fully unroll the component loop. The
+     * dimension-specific entry points are ElasticityPlaneStrain::f0v and Elasticity3D::f0v,
+     * selected once at kernel registration time.
+     *
+     * Solution fields: [disp(dim), vel(dim)]
+     * Auxiliary fields: [density(1), ...]
+     */
+    template<int Dim>
+    static inline
+    void f0v_dim(const PylithInt dim,
+                 const PylithInt numS,
+                 const PylithInt numA,
+                 const PylithInt sOff[],
+                 const PylithInt sOff_x[],
+                 const PylithScalar s[],
+                 const PylithScalar s_t[],
+                 const PylithScalar s_x[],
+                 const PylithInt aOff[],
+                 const PylithInt aOff_x[],
+                 const PylithScalar a[],
+                 const PylithScalar a_t[],
+                 const PylithScalar a_x[],
+                 const PylithReal t,
+                 const PylithScalar x[],
+                 const PylithInt numConstants,
+                 const PylithScalar constants[],
+                 PylithScalar f0[]) {
+        const PylithInt i_vel = 1;
+        const PylithInt i_density = 0;
+
+        assert(Dim == dim);
+        assert(2 == numS);
+        assert(numA >= 1);
+        assert(sOff);
+        assert(sOff[i_vel] >= 0);
+        assert(s_t);
+        assert(aOff);
+        assert(aOff[i_density] >= 0);
+        assert(a);
+
+        const PylithScalar* vel_t = &s_t[sOff[i_vel]]; // acceleration
+        const PylithKernelScalar density = a[aOff[i_density]];
+
+        for (PylithInt i = 0; i < Dim; ++i) {
+            f0[i] += PylithKernelScalar(vel_t[i]) * density;
+        } // for
+    } // f0v_dim
+
     // --------------------------------------------------------------------------------------------
     // f1 function for elasticity for velocity field (dynamic) and displacement field (quasi-static).
     static inline
@@ -199,6 +252,36 @@ public:
         } // for
     } // f1v
 
+    // --------------------------------------------------------------------------------------------
+    /** f1 function for elasticity with compile-time spatial dimension.
+     *
+     * Same as f1v() with a compile-time trip count so the compiler fully unrolls the tensor
+     * accumulation loop.
+     */
+    template<int Dim>
+    static inline
+    void f1v_dim(const StrainContext& strainContext,
+                 void* rheologyContext,
+                 strainfn_type strainFn,
+                 stressfn_type stressFn,
+                 const TensorOps& tensorOps,
+                 PylithScalar f1[]) {
+        assert(Dim == strainContext.dim);
+
+        Tensor strain;
+        strainFn(strainContext, &strain);
+
+        Tensor stress;
+        stressFn(rheologyContext, strain, tensorOps, &stress);
+
+        PylithScalar stressTensor[9] = {0.0, 0.0, 0.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0 };
+        tensorOps.toTensor(stress, stressTensor);
+
+        for (PylithInt i = 0; i < Dim*Dim; ++i) {
+            f1[i] -= stressTensor[i];
+        } // for
+    } // f1v_dim
+
     // --------------------------------------------------------------------------------------------
     /** Jf0 function for elasticity for the velocity/velocity block.
      *
@@ -237,13 +320,58 @@ public:
         assert(aOff[i_density] >= 0);
         assert(a);
 
-        const PylithScalar density = a[aOff[i_density]];
+        const PylithKernelScalar density = a[aOff[i_density]];
 
         for (PetscInt i = 0; i < dim; ++i) {
-            Jf0[i*dim+i] += s_tshift * density;
+            Jf0[i*dim+i] += PylithKernelScalar(s_tshift) * density;
         } // for
     } // Jf0vv
 
+    // --------------------------------------------------------------------------------------------
+    /** Jf0 function for elasticity for the velocity/velocity block with compile-time spatial
+     * dimension.
+     *
+     * ISA PetscJacobianFunc (via instantiation with Dim=2 or Dim=3)
+     *
+     * Solution fields: [...]
+     * Auxiliary fields: [density(1), ...]
+     */
+    template<int Dim>
+    static inline
+    void Jf0vv_dim(const PylithInt dim,
+                   const PylithInt numS,
+                   const PylithInt numA,
+                   const PylithInt sOff[],
+                   const PylithInt sOff_x[],
+                   const PylithScalar s[],
+                   const PylithScalar s_t[],
+                   const PylithScalar s_x[],
+                   const PylithInt aOff[],
+                   const PylithInt aOff_x[],
+                   const PylithScalar a[],
+                   const PylithScalar a_t[],
+                   const PylithScalar a_x[],
+                   const PylithReal t,
+                   const PylithReal s_tshift,
+                   const PylithScalar x[],
+                   const PylithInt numConstants,
+                   const PylithScalar constants[],
+                   PylithScalar Jf0[]) {
+        const PylithInt i_density = 0;
+
+        assert(Dim == dim);
+        assert(numA >= 1);
+        assert(aOff);
+        assert(aOff[i_density] >= 0);
+        assert(a);
+
+        const PylithKernelScalar density = a[aOff[i_density]];
+
+        for (PetscInt i = 0; i < Dim; ++i) {
+            Jf0[i*Dim+i] += PylithKernelScalar(s_tshift) * density;
+        } // for
+    } // Jf0vv_dim
+
     // --------------------------------------------------------------------------------------------
     /** g0 function for elasticity equation with gravitational body force.
      *
@@ -464,6 +592,78 @@ public:
         tensorOps.toVector(stress, stressVector);
     } // cauchyStress_asVector
 
+    // --------------------------------------------------------------------------------------------
+    /** f1 function for elasticity with small-strain (finite deformation) formulation.
+     *
+     * The strain function computes the Green-Lagrange strain E and the stress function maps it
+     * to the second Piola-Kirchhoff stress S; the residual uses the first Piola-Kirchhoff
+     * stress P = F S with deformation gradient F = I + grad u, so the weak form is integrated
+     * over the undeformed configuration without mesh updates.
+     */
+    static inline
+    void f1v_smallStrain(const StrainContext& strainContext,
+                         void* rheologyContext,
+                         strainfn_type strainFn,
+                         stressfn_type stressFn,
+                         const TensorOps& tensorOps,
+                         PylithScalar f1[]) {
+        Tensor strain;
+        strainFn(strainContext, &strain); // Green-Lagrange strain
+
+        Tensor stress;
+        stressFn(rheologyContext, strain, tensorOps, &stress); // second Piola-Kirchhoff stress
+
+        PylithScalar stressTensor[9] = {0.0, 0.0, 0.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0 };
+        tensorOps.toTensor(stress, stressTensor);
+
+        const PylithInt dim = strainContext.dim;
+        const PylithScalar* disp_x = strainContext.disp_x;
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                PylithScalar pk1 = stressTensor[i*dim+j];
+                for (PylithInt k = 0; k < dim; ++k) {
+                    pk1 += disp_x[i*dim+k] * stressTensor[k*dim+j];
+                } // for
+                f1[i*dim+j] -= pk1;
+            } // for
+        } // for
+    } // f1v_smallStrain
+
+    // --------------------------------------------------------------------------------------------
+    /** Geometric (initial stress) stiffness for the small-strain formulation.
+     *
+     * Adds the d(F)/du S contribution of d(F S)/du to Jf3; the material contribution
+     * F dS/dE dE/du F^T is left to the rheology so the two parts can be registered as separate
+     * kernels. The geometric part depends only on the current stress (dim^2 entries per point),
+     * so it is cheap to reassemble every Newton iteration, while the much more expensive
+     * material stiffness can be reassembled on the integrator's Jacobian triggers.
+     *
+     * @param[in] dim Spatial dimension.
+     * @param[in] stress Second Piola-Kirchhoff stress.
+     * @param[in] tensorOps Tensor operations matching spatial dimension.
+     * @param[out] Jf3 Jacobian coefficients [dim*dim*dim*dim].
+     */
+    static inline
+    void Jf3vu_geometricStress(const PylithInt dim,
+                               const Tensor& stress,
+                               const TensorOps& tensorOps,
+                               PylithScalar Jf3[]) {
+        assert(Jf3);
+
+        PylithScalar stressTensor[9] = {0.0, 0.0, 0.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0 };
+        tensorOps.toTensor(stress, stressTensor);
+
+        // j(f,g,df,dg) with dP_fdf/du_{g,dg} = delta_fg S_dgdf; only the f == g entries are
+        // nonzero.
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                for (PylithInt l = 0; l < dim; ++l) {
+                    Jf3[((i*dim+i)*dim+j)*dim+l] -= stressTensor[l*dim+j];
+                } // for
+            } // for
+        } // for
+    } // Jf3vu_geometricStress
+
 }; // Elasticity
 
 // ------------------------------------------------------------------------------------------------
@@ -535,6 +735,70 @@ public:
         Elasticity::strain_asVector(context, infinitesimalStrain, Tensor::ops2D, strainVector);
     } // infinitesimalStrain_asVector3D
 
+    // --------------------------------------------------------------------------------------------
+    /** Calculate Green-Lagrange strain tensor for 2D plane strain elasticity.
+     *
+     * E = 1/2 (grad u + grad u^T + grad u^T grad u)
+     *
+     * Solution fields: [disp(dim)]
+     */
+    static inline
+    void greenLagrangeStrain(const pylith::fekernels::Elasticity::StrainContext& context,
+                             pylith::fekernels::Tensor* strain) {
+        const PylithInt _dim = 2;
+
+        assert(_dim == context.dim);
+        assert(strain);
+
+        // Incoming solution field.
+        const PylithScalar* disp_x = context.disp_x;
+
+        strain->xx = disp_x[0*_dim+0] + 0.5*(disp_x[0*_dim+0]*disp_x[0*_dim+0] + disp_x[1*_dim+0]*disp_x[1*_dim+0]);
+        strain->yy = disp_x[1*_dim+1] + 0.5*(disp_x[0*_dim+1]*disp_x[0*_dim+1] + disp_x[1*_dim+1]*disp_x[1*_dim+1]);
+        strain->zz = 0.0;
+        strain->xy = 0.5*(disp_x[0*_dim+1] + disp_x[1*_dim+0]
+                          + disp_x[0*_dim+0]*disp_x[0*_dim+1] + disp_x[1*_dim+0]*disp_x[1*_dim+1]);
+        strain->yz = 0.0;
+        strain->xz = 0.0;
+    } // greenLagrangeStrain
+
+    // --------------------------------------------------------------------------------------------
+    /** Calculate vector with Green-Lagrange strain for 2D plane strain elasticity.
+     *
+     * ISA PetscPointFunc
+     *
+     * Order of output components is xx, yy, zz, xy.
+     *
+     * Solution fields: [disp(dim)]
+     */
+    static inline
+    void greenLagrangeStrain_asVector(const PylithInt dim,
+                                      const PylithInt numS,
+                                      const PylithInt numA,
+                                      const PylithInt sOff[],
+                                      const PylithInt sOff_x[],
+                                      const PylithScalar s[],
+                                      const PylithScalar s_t[],
+                                      const PylithScalar s_x[],
+                                      const PylithInt aOff[],
+                                      const PylithInt aOff_x[],
+                                      const PylithScalar a[],
+                                      const PylithScalar a_t[],
+                                      const PylithScalar a_x[],
+                                      const PylithReal t,
+                                      const PylithScalar x[],
+                                      const PylithInt numConstants,
+                                      const PylithScalar constants[],
+                                      PylithScalar strainVector[]) {
+        const PylithInt _dim = 2;
+        assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext context;
+        pylith::fekernels::Elasticity::setStrainContext(&context, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        Elasticity::strain_asVector(context, greenLagrangeStrain, Tensor::ops2D, strainVector);
+    } // greenLagrangeStrain_asVector
+
     // --------------------------------------------------------------------------------------------
     /** Calculate traction vector from stress for 2D plane strain elasticity.
      *
@@ -620,6 +884,74 @@ public:
         Elasticity::strain_asVector(context, infinitesimalStrain, Tensor::ops3D, strainVector);
     } // infinitesimalStrain_asVector
 
+    // --------------------------------------------------------------------------------------------
+    /** Calculate Green-Lagrange strain for 3D elasticity.
+     *
+     * E = 1/2 (grad u + grad u^T + grad u^T grad u)
+     *
+     * Order of output components is xx, yy, zz, xy, yz, xz.
+     */
+    static inline
+    void greenLagrangeStrain(const pylith::fekernels::Elasticity::StrainContext& context,
+                             pylith::fekernels::Tensor* strain) {
+        const PylithInt _dim = 3;
+
+        assert(_dim == context.dim);
+        assert(strain);
+
+        const PylithScalar* disp_x = context.disp_x;
+
+        strain->xx = disp_x[0*_dim+0]
+                     + 0.5*(disp_x[0*_dim+0]*disp_x[0*_dim+0] + disp_x[1*_dim+0]*disp_x[1*_dim+0] + disp_x[2*_dim+0]*disp_x[2*_dim+0]);
+        strain->yy = disp_x[1*_dim+1]
+                     + 0.5*(disp_x[0*_dim+1]*disp_x[0*_dim+1] + disp_x[1*_dim+1]*disp_x[1*_dim+1] + disp_x[2*_dim+1]*disp_x[2*_dim+1]);
+        strain->zz = disp_x[2*_dim+2]
+                     + 0.5*(disp_x[0*_dim+2]*disp_x[0*_dim+2] + disp_x[1*_dim+2]*disp_x[1*_dim+2] + disp_x[2*_dim+2]*disp_x[2*_dim+2]);
+        strain->xy = 0.5*(disp_x[0*_dim+1] + disp_x[1*_dim+0]
+                          + disp_x[0*_dim+0]*disp_x[0*_dim+1] + disp_x[1*_dim+0]*disp_x[1*_dim+1] + disp_x[2*_dim+0]*disp_x[2*_dim+1]);
+        strain->yz = 0.5*(disp_x[1*_dim+2] + disp_x[2*_dim+1]
+                          + disp_x[0*_dim+1]*disp_x[0*_dim+2] + disp_x[1*_dim+1]*disp_x[1*_dim+2] + disp_x[2*_dim+1]*disp_x[2*_dim+2]);
+        strain->xz = 0.5*(disp_x[0*_dim+2] + disp_x[2*_dim+0]
+                          + disp_x[0*_dim+0]*disp_x[0*_dim+2] + disp_x[1*_dim+0]*disp_x[1*_dim+2] + disp_x[2*_dim+0]*disp_x[2*_dim+2]);
+    } // greenLagrangeStrain
+
+    // --------------------------------------------------------------------------------------------
+    /** Calculate vector with Green-Lagrange strain for 3D elasticity.
+     *
+     * ISA PetscPointFunc
+     *
+     * Order of output components is xx, yy, zz, xy, yz, xz.
+     *
+     * Solution fields: [disp(dim)]
+     */
+    static inline
+    void greenLagrangeStrain_asVector(const PylithInt dim,
+                                      const PylithInt numS,
+                                      const PylithInt numA,
+                                      const PylithInt sOff[],
+                                      const PylithInt sOff_x[],
+                                      const PylithScalar s[],
+                                      const PylithScalar s_t[],
+                                      const PylithScalar s_x[],
+                                      const PylithInt aOff[],
+                                      const PylithInt aOff_x[],
+                                      const PylithScalar a[],
+                                      const PylithScalar a_t[],
+                                      const PylithScalar a_x[],
+                                      const PylithReal t,
+                                      const PylithScalar x[],
+                                      const PylithInt numConstants,
+                                      const PylithScalar constants[],
+                                      PylithScalar strainVector[]) {
+        const PylithInt _dim = 3;
+        assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext context;
+        pylith::fekernels::Elasticity::setStrainContext(&context, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        Elasticity::strain_asVector(context, greenLagrangeStrain, Tensor::ops3D, strainVector);
+    } // greenLagrangeStrain_asVector
+
     // --------------------------------------------------------------------------------------------
     /** Calculate traction vector from stress for 3D elasticity.
      *
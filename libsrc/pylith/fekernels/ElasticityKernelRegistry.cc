@@ -0,0 +1,54 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+#include <portinfo>
+
+#include "pylith/fekernels/ElasticityKernelRegistry.hh"
+
+#include <cstring> // USES strcmp()
+
+// ------------------------------------------------------------------------------------------------
+// Get monomorphized batched loops for a rheology.
+pylith::fekernels::ElasticityKernelRegistry::KernelBlock
+pylith::fekernels::ElasticityKernelRegistry::getKernels(const char* rheology,
+                                                        const int spaceDim) {
+    KernelBlock block;
+    if (!rheology) {
+        return block;
+    } // if
+
+    if (0 == strcmp(rheology, "isotropiclinearelasticity")) {
+        switch (spaceDim) {
+        case 2:
+            block.f1v = pylith::fekernels::IsotropicLinearElasticityBatched::f1v_infinitesimalStrain2D;
+            block.Jf3vu = pylith::fekernels::IsotropicLinearElasticityBatched::Jf3vu_infinitesimalStrain2D;
+            break;
+        case 3:
+            block.f1v = pylith::fekernels::IsotropicLinearElasticityBatched::f1v_infinitesimalStrain3D;
+            block.Jf3vu = pylith::fekernels::IsotropicLinearElasticityBatched::Jf3vu_infinitesimalStrain3D;
+            break;
+        default:
+            break;
+        } // switch
+    } // if
+
+    return block;
+} // getKernels
+
+
+// End of file
@@ -0,0 +1,93 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/ElasticityKernelRegistry.hh
+ *
+ * Registry of monomorphized batched elasticity loops keyed by (rheology, spatial dimension).
+ *
+ * The bulk rheologies select their pointwise kernels through virtual methods on
+ * pylith::materials::RheologyElasticity, and within a material the selected kernel never
+ * changes. The batched kernels (e.g., IsotropicLinearElasticityBatched.hh) already inline the
+ * rheology-specific point computation into the block loop, so each instantiation is a complete
+ * loop with no per-point indirect call. This registry maps a rheology identifier and spatial
+ * dimension to those concrete instantiations so the lookup happens once per material when
+ * kernels are selected instead of through a function pointer at every quadrature point.
+ *
+ * Rheologies without batched kernels return a block with NULL entries; callers fall back to
+ * the pointwise kernels.
+ */
+
+#if !defined(pylith_fekernels_elasticitykernelregistry_hh)
+#define pylith_fekernels_elasticitykernelregistry_hh
+
+#include "fekernelsfwd.hh" // forward declarations
+
+#include "pylith/fekernels/IsotropicLinearElasticityBatched.hh" // USES IsotropicLinearElasticityBatched
+
+#include "pylith/utils/types.hh"
+
+// ------------------------------------------------------------------------------------------------
+/// Registry of monomorphized batched elasticity loops.
+class pylith::fekernels::ElasticityKernelRegistry {
+    // PUBLIC TYPEDEFS ////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Block of quadrature points shared by the batched elasticity kernels (SoA layout).
+    typedef pylith::fekernels::IsotropicLinearElasticityBatched::Batch Batch;
+
+    /// Signature of a monomorphized batched loop (residual term or Jacobian entries).
+    typedef void (*batchedfn_type)(const Batch& batch,
+                                   PylithScalar* values);
+
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Monomorphized batched loops for one (rheology, spatial dimension) combination.
+    struct KernelBlock {
+        batchedfn_type f1v; ///< Batched f1 residual loop; NULL if not available.
+        batchedfn_type Jf3vu; ///< Batched Jf3 Jacobian loop; NULL if not available.
+
+        KernelBlock(void) :
+            f1v(NULL),
+            Jf3vu(NULL) {}
+
+
+    }; // KernelBlock
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Get monomorphized batched loops for a rheology.
+     *
+     * The returned function pointers are concrete compile-time instantiations with the
+     * rheology's point computation inlined into the block loop, so resolving them once per
+     * material removes the per-point indirect call from the batched assembly paths.
+     *
+     * @param[in] rheology Component name of bulk rheology (e.g., "isotropiclinearelasticity").
+     * @param[in] spaceDim Spatial dimension of problem.
+     * @returns Kernel block; entries are NULL if no batched loops exist for the combination.
+     */
+    static
+    KernelBlock getKernels(const char* rheology,
+                           const int spaceDim);
+
+}; // ElasticityKernelRegistry
+
+#endif // pylith_fekernels_elasticitykernelregistry_hh
+
+/* End of file */
@@ -22,7 +22,12 @@
  *
  * Solution fields: [disp(dim), vel(dim, optional), lagrange(dim)]
  *
- * Auxiliary fields: [...] (not used)
+ * Auxiliary fields: [slip(dim), slip_acceleration(dim, optional),
+ *                    strike_dir(dim, 3D only), up_dip_dir(dim, 3D only)]
+ *
+ * In 3D the fault tangential directions are precomputed during initialization and cached in the
+ * last two auxiliary subfields, so the kernels do not rebuild the orthonormal frame from the
+ * reference directions at each quadrature point.
  *
  * LHS Residual
  *
@@ -220,10 +225,19 @@ public:
         } // case 2
         case 3: {
             const PylithInt _spaceDim = 3;
-            const PylithScalar* refDir1 = &constants[0];
-            const PylithScalar* refDir2 = &constants[3];
-            PylithScalar tanDir1[3], tanDir2[3];
-            pylith::fekernels::BoundaryDirections::tangential_directions(tanDir1, tanDir2, refDir1, refDir2, n);
+            const PylithScalar* tanDir1 = NULL;
+            const PylithScalar* tanDir2 = NULL;
+            PylithScalar tanDirsComputed[6];
+            if (numA >= 3) { // Tangential directions cached in last two auxiliary subfields.
+                tanDir1 = &a[aOff[numA-2]]; // strike_dir
+                tanDir2 = &a[aOff[numA-1]]; // up_dip_dir
+            } else { // No cache (fault with only slip subfield); rebuild frame from reference directions.
+                const PylithScalar* refDir1 = &constants[0];
+                const PylithScalar* refDir2 = &constants[3];
+                pylith::fekernels::BoundaryDirections::tangential_directions(&tanDirsComputed[0], &tanDirsComputed[3], refDir1, refDir2, n);
+                tanDir1 = &tanDirsComputed[0];
+                tanDir2 = &tanDirsComputed[3];
+            } // if/else
 
             for (PylithInt i = 0; i < _spaceDim; ++i) {
                 const PylithScalar slipXYZ = n[i]*slip[0] + tanDir1[i]*slip[1] + tanDir2[i]*slip[2];
@@ -271,7 +285,7 @@ public:
         assert(numA >= 1);
 
         const PylithInt spaceDim = dim + 1; // :KLUDGE: dim passed in is spaceDim-1
-        const PylithInt i_slipAcc = numA-1;
+        const PylithInt i_slipAcc = 1;
 
         const PylithScalar* slipAcc = &a[aOff[i_slipAcc]];
 
@@ -287,10 +301,9 @@ public:
         } // case 2
         case 3: {
             const PylithInt _spaceDim = 3;
-            const PylithScalar* refDir1 = &constants[0];
-            const PylithScalar* refDir2 = &constants[3];
-            PylithScalar tanDir1[3], tanDir2[3];
-            pylith::fekernels::BoundaryDirections::BoundaryDirections::tangential_directions(tanDir1, tanDir2, refDir1, refDir2, n);
+            assert(numA >= 4);
+            const PylithScalar* tanDir1 = &a[aOff[numA-2]]; // strike_dir (cached)
+            const PylithScalar* tanDir2 = &a[aOff[numA-1]]; // up_dip_dir (cached)
 
             for (PylithInt i = 0; i < _spaceDim; ++i) {
                 const PylithScalar slipAccXYZ = n[i]*slipAcc[0] + tanDir1[i]*slipAcc[1] + tanDir2[i]*slipAcc[2];
@@ -88,6 +88,7 @@ public:
         PylithReal bulkModulus;
         pylith::fekernels::Tensor refStress;
         pylith::fekernels::Tensor refStrain;
+        pylith::fekernels::Tensor refContrib; ///< Cached constant reference-state contribution to stress.
 
         Context(void) :
             shearModulus(0.0),
@@ -178,6 +179,64 @@ public:
         tensorOps.fromVector(&a[aOff[i_refStrain]], &context->refStrain);
     } // createContext
 
+    // --------------------------------------------------------------------------------------------
+    /** Set context from kernel constants for spatially uniform elastic moduli.
+     *
+     * When a material block has uniform moduli, the material registers the shear modulus and
+     * bulk modulus as the last two kernel constants so that the kernels avoid loading the moduli
+     * from the auxiliary field at every quadrature point.
+     */
+    static inline
+    void setContext_constModuli(Context* context,
+                                const PylithInt numConstants,
+                                const PylithScalar constants[]) {
+        assert(context);
+
+        const PylithInt i_shearModulus = numConstants-2;
+        const PylithInt i_bulkModulus = numConstants-1;
+
+        assert(numConstants >= 2);
+        assert(constants);
+
+        context->shearModulus = constants[i_shearModulus];assert(context->shearModulus > 0.0);
+        context->bulkModulus = constants[i_bulkModulus];assert(context->bulkModulus > 0.0);
+    } // setContext_constModuli
+
+    // --------------------------------------------------------------------------------------------
+    /** Set context from kernel constants for a spatially uniform reference state.
+     *
+     * When a material block has uniform moduli and a uniform reference stress/strain, the
+     * constant contribution of the reference state to the Cauchy stress is precomputed once at
+     * initialization and registered as kernel constants together with the moduli, so the
+     * kernels avoid reloading the reference subfields and redoing the reference-state algebra
+     * at every quadrature point.
+     *
+     * Constants: [..., refContrib(6), shear_modulus, bulk_modulus]
+     */
+    static inline
+    void setContext_constRefState(Context* context,
+                                  const PylithInt numConstants,
+                                  const PylithScalar constants[]) {
+        assert(context);
+
+        const PylithInt i_refContrib = numConstants-8;
+        const PylithInt i_shearModulus = numConstants-2;
+        const PylithInt i_bulkModulus = numConstants-1;
+
+        assert(numConstants >= 8);
+        assert(constants);
+
+        context->shearModulus = constants[i_shearModulus];assert(context->shearModulus > 0.0);
+        context->bulkModulus = constants[i_bulkModulus];assert(context->bulkModulus > 0.0);
+
+        context->refContrib.xx = constants[i_refContrib+0];
+        context->refContrib.yy = constants[i_refContrib+1];
+        context->refContrib.zz = constants[i_refContrib+2];
+        context->refContrib.xy = constants[i_refContrib+3];
+        context->refContrib.yz = constants[i_refContrib+4];
+        context->refContrib.xz = constants[i_refContrib+5];
+    } // setContext_constRefState
+
     // --------------------------------------------------------------------------------------------
     /** Helper function for calculating Cauchy stress for WITHOUT a reference stress and strain.
      *
@@ -224,6 +283,39 @@ public:
         deviatoricStress_refState(context->shearModulus, refStress, refStrain, strain, stress);
     } // cauchyStress_refState
 
+    // --------------------------------------------------------------------------------------------
+    /** Helper function for calculating Cauchy stress WITH a reference stress/strain whose
+     * constant contribution has been precomputed into the context (uniform reference state).
+     *
+     * Adds the cached reference contribution to the stress computed from the current strain,
+     * which is algebraically identical to cauchyStress_refState().
+     *
+     * @param[in] rheologyContext IsotropicLinearElasticity context.
+     * @param[in] strain Strain tensor.
+     * @param[in] tensorOps Tensor operations.
+     * @param[out] stress Stress tensor.
+     */
+    static inline
+    void cauchyStress_constRefState(void* rheologyContext,
+                                    const pylith::fekernels::Tensor& strain,
+                                    const pylith::fekernels::TensorOps& tensorOps,
+                                    pylith::fekernels::Tensor* stress) {
+        Context* context = (Context*)(rheologyContext);
+        assert(context);
+        assert(stress);
+
+        meanStress(context->bulkModulus, strain, stress);
+        deviatoricStress(context->shearModulus, strain, stress);
+
+        const pylith::fekernels::Tensor& refContrib = context->refContrib;
+        stress->xx += refContrib.xx;
+        stress->yy += refContrib.yy;
+        stress->zz += refContrib.zz;
+        stress->xy += refContrib.xy;
+        stress->yz += refContrib.yz;
+        stress->xz += refContrib.xz;
+    } // cauchyStress_constRefState
+
     // --------------------------------------------------------------------------------------------
     /** Calculate mean stress WITHOUT reference stress and reference strain.
      */
@@ -360,7 +452,7 @@ public:
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
             t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
 
-        pylith::fekernels::Elasticity::f1v(
+        pylith::fekernels::Elasticity::f1v_dim<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
@@ -404,7 +496,7 @@ public:
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
             t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
 
-        pylith::fekernels::Elasticity::f1v(
+        pylith::fekernels::Elasticity::f1v_dim<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
@@ -502,6 +594,152 @@ public:
         Jf3[15] -= C2222; // j1111
     } // Jf3vu
 
+    // --------------------------------------------------------------------------------------------
+    /** f1 entry function for isotropic linear elasticity plane strain with infinitesimal strain
+     * and spatially uniform elastic moduli taken from the kernel constants.
+     *
+     * Solution fields: [disp(dim), ...]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)] (not read)
+     * Constants: [..., shear_modulus, bulk_modulus]
+     */
+    static inline
+    void f1v_infinitesimalStrain_constModuli(const PylithInt dim,
+                                             const PylithInt numS,
+                                             const PylithInt numA,
+                                             const PylithInt sOff[],
+                                             const PylithInt sOff_x[],
+                                             const PylithScalar s[],
+                                             const PylithScalar s_t[],
+                                             const PylithScalar s_x[],
+                                             const PylithInt aOff[],
+                                             const PylithInt aOff_x[],
+                                             const PylithScalar a[],
+                                             const PylithScalar a_t[],
+                                             const PylithScalar a_x[],
+                                             const PylithReal t,
+                                             const PylithScalar x[],
+                                             const PylithInt numConstants,
+                                             const PylithScalar constants[],
+                                             PylithScalar f1[]) {
+        const PylithInt _dim = 2;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
+        pylith::fekernels::IsotropicLinearElasticity::setContext_constModuli(
+            &rheologyContext, numConstants, constants);
+
+        pylith::fekernels::Elasticity::f1v_dim<2>(
+            strainContext, &rheologyContext,
+            pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
+            pylith::fekernels::Tensor::ops2D,
+            f1);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** f1 entry function for isotropic linear elasticity plane strain with infinitesimal strain
+     * and a spatially uniform reference state whose constant stress contribution is taken from
+     * the kernel constants.
+     *
+     * Solution fields: [disp(dim), ...]
+     * Auxiliary fields: [..., refstress(4), refstrain(4), shear_modulus(1), bulk_modulus(1)] (not read)
+     * Constants: [..., refContrib(6), shear_modulus, bulk_modulus]
+     */
+    static inline
+    void f1v_infinitesimalStrain_constRefState(const PylithInt dim,
+                                               const PylithInt numS,
+                                               const PylithInt numA,
+                                               const PylithInt sOff[],
+                                               const PylithInt sOff_x[],
+                                               const PylithScalar s[],
+                                               const PylithScalar s_t[],
+                                               const PylithScalar s_x[],
+                                               const PylithInt aOff[],
+                                               const PylithInt aOff_x[],
+                                               const PylithScalar a[],
+                                               const PylithScalar a_t[],
+                                               const PylithScalar a_x[],
+                                               const PylithReal t,
+                                               const PylithScalar x[],
+                                               const PylithInt numConstants,
+                                               const PylithScalar constants[],
+                                               PylithScalar f1[]) {
+        const PylithInt _dim = 2;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
+        pylith::fekernels::IsotropicLinearElasticity::setContext_constRefState(
+            &rheologyContext, numConstants, constants);
+
+        pylith::fekernels::Elasticity::f1v_dim<2>(
+            strainContext, &rheologyContext,
+            pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_constRefState,
+            pylith::fekernels::Tensor::ops2D,
+            f1);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Jf3_vu entry function for 2D plane strain isotropic linear elasticity with spatially
+     * uniform elastic moduli taken from the kernel constants.
+     *
+     * Solution fields: [...]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)] (not read)
+     * Constants: [..., shear_modulus, bulk_modulus]
+     */
+    static inline
+    void Jf3vu_infinitesimalStrain_constModuli(const PylithInt dim,
+                                               const PylithInt numS,
+                                               const PylithInt numA,
+                                               const PylithInt sOff[],
+                                               const PylithInt sOff_x[],
+                                               const PylithScalar s[],
+                                               const PylithScalar s_t[],
+                                               const PylithScalar s_x[],
+                                               const PylithInt aOff[],
+                                               const PylithInt aOff_x[],
+                                               const PylithScalar a[],
+                                               const PylithScalar a_t[],
+                                               const PylithScalar a_x[],
+                                               const PylithReal t,
+                                               const PylithReal s_tshift,
+                                               const PylithScalar x[],
+                                               const PylithInt numConstants,
+                                               const PylithScalar constants[],
+                                               PylithScalar Jf3[]) {
+        const PylithInt _dim = 2;assert(_dim == dim);
+        pylith::fekernels::IsotropicLinearElasticity::Context context;
+        pylith::fekernels::IsotropicLinearElasticity::setContext_constModuli(
+            &context, numConstants, constants);
+
+        assert(Jf3);
+
+        const PylithScalar shearModulus = context.shearModulus;
+        const PylithScalar bulkModulus = context.bulkModulus;
+
+        const PylithScalar lambda = bulkModulus - 2.0/3.0*shearModulus;
+        const PylithScalar lambda2mu = lambda + 2.0*shearModulus;
+
+        const PylithReal C1111 = lambda2mu;
+        const PylithReal C2222 = lambda2mu;
+        const PylithReal C1122 = lambda;
+        const PylithReal C1212 = shearModulus;
+
+        // See Jf3vu_infinitesimalStrain for the mapping from C_ijkl to Jf3 entries.
+        Jf3[ 0] -= C1111; // j0000
+        Jf3[ 3] -= C1212; // j0011
+        Jf3[ 5] -= C1122; // j0101
+        Jf3[ 6] -= C1212; // j0110, C1221
+        Jf3[ 9] -= C1212; // j1001, C2112
+        Jf3[10] -= C1122; // j1010, C2211
+        Jf3[12] -= C1212; // j1100, C2121
+        Jf3[15] -= C2222; // j1111
+    } // Jf3vu_constModuli
+
     // ===========================================================================================
     // Kernels for fault interfaces and elasticity
     // ===========================================================================================
@@ -838,7 +1076,7 @@ public:
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
             t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
 
-        pylith::fekernels::Elasticity::f1v(
+        pylith::fekernels::Elasticity::f1v_dim<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
@@ -882,7 +1120,7 @@ public:
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
             t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
 
-        pylith::fekernels::Elasticity::f1v(
+        pylith::fekernels::Elasticity::f1v_dim<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
@@ -1043,6 +1281,165 @@ public:
         Jf3[80] -= C1111; // j2222
     } // Jf3vu_infinitesimalStrain
 
+    // --------------------------------------------------------------------------------------------
+    /** f1 entry function for 3D isotropic linear elasticity with infinitesimal strain and
+     * spatially uniform elastic moduli taken from the kernel constants.
+     *
+     * Solution fields: [disp(dim), ...]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)] (not read)
+     * Constants: [..., shear_modulus, bulk_modulus]
+     */
+    static inline
+    void f1v_infinitesimalStrain_constModuli(const PylithInt dim,
+                                             const PylithInt numS,
+                                             const PylithInt numA,
+                                             const PylithInt sOff[],
+                                             const PylithInt sOff_x[],
+                                             const PylithScalar s[],
+                                             const PylithScalar s_t[],
+                                             const PylithScalar s_x[],
+                                             const PylithInt aOff[],
+                                             const PylithInt aOff_x[],
+                                             const PylithScalar a[],
+                                             const PylithScalar a_t[],
+                                             const PylithScalar a_x[],
+                                             const PylithReal t,
+                                             const PylithScalar x[],
+                                             const PylithInt numConstants,
+                                             const PylithScalar constants[],
+                                             PylithScalar f1[]) {
+        const PylithInt _dim = 3;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
+        pylith::fekernels::IsotropicLinearElasticity::setContext_constModuli(
+            &rheologyContext, numConstants, constants);
+
+        pylith::fekernels::Elasticity::f1v_dim<3>(
+            strainContext, &rheologyContext,
+            pylith::fekernels::Elasticity3D::infinitesimalStrain,
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
+            pylith::fekernels::Tensor::ops3D,
+            f1);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** f1 entry function for 3D isotropic linear elasticity with infinitesimal strain and a
+     * spatially uniform reference state whose constant stress contribution is taken from the
+     * kernel constants.
+     *
+     * Solution fields: [disp(dim), ...]
+     * Auxiliary fields: [..., refstress(6), refstrain(6), shear_modulus(1), bulk_modulus(1)] (not read)
+     * Constants: [..., refContrib(6), shear_modulus, bulk_modulus]
+     */
+    static inline
+    void f1v_infinitesimalStrain_constRefState(const PylithInt dim,
+                                               const PylithInt numS,
+                                               const PylithInt numA,
+                                               const PylithInt sOff[],
+                                               const PylithInt sOff_x[],
+                                               const PylithScalar s[],
+                                               const PylithScalar s_t[],
+                                               const PylithScalar s_x[],
+                                               const PylithInt aOff[],
+                                               const PylithInt aOff_x[],
+                                               const PylithScalar a[],
+                                               const PylithScalar a_t[],
+                                               const PylithScalar a_x[],
+                                               const PylithReal t,
+                                               const PylithScalar x[],
+                                               const PylithInt numConstants,
+                                               const PylithScalar constants[],
+                                               PylithScalar f1[]) {
+        const PylithInt _dim = 3;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
+        pylith::fekernels::IsotropicLinearElasticity::setContext_constRefState(
+            &rheologyContext, numConstants, constants);
+
+        pylith::fekernels::Elasticity::f1v_dim<3>(
+            strainContext, &rheologyContext,
+            pylith::fekernels::Elasticity3D::infinitesimalStrain,
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_constRefState,
+            pylith::fekernels::Tensor::ops3D,
+            f1);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Jf3_vu entry function for 3D isotropic linear elasticity with spatially uniform elastic
+     * moduli taken from the kernel constants.
+     *
+     * Solution fields: [...]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)] (not read)
+     * Constants: [..., shear_modulus, bulk_modulus]
+     */
+    static inline
+    void Jf3vu_infinitesimalStrain_constModuli(const PylithInt dim,
+                                               const PylithInt numS,
+                                               const PylithInt numA,
+                                               const PylithInt sOff[],
+                                               const PylithInt sOff_x[],
+                                               const PylithScalar s[],
+                                               const PylithScalar s_t[],
+                                               const PylithScalar s_x[],
+                                               const PylithInt aOff[],
+                                               const PylithInt aOff_x[],
+                                               const PylithScalar a[],
+                                               const PylithScalar a_t[],
+                                               const PylithScalar a_x[],
+                                               const PylithReal t,
+                                               const PylithReal s_tshift,
+                                               const PylithScalar x[],
+                                               const PylithInt numConstants,
+                                               const PylithScalar constants[],
+                                               PylithScalar Jf3[]) {
+        const PylithInt _dim = 3;assert(_dim == dim);
+        pylith::fekernels::IsotropicLinearElasticity::Context context;
+        pylith::fekernels::IsotropicLinearElasticity::setContext_constModuli(
+            &context, numConstants, constants);
+
+        assert(Jf3);
+
+        const PylithScalar shearModulus = context.shearModulus;
+        const PylithScalar bulkModulus = context.bulkModulus;
+
+        const PylithScalar lambda = bulkModulus - 2.0/3.0*shearModulus;
+        const PylithScalar lambda2mu = lambda + 2.0*shearModulus;
+
+        // All other values are either zero or equal to one of these.
+        const PylithReal C1111 = lambda2mu;
+        const PylithReal C1122 = lambda;
+        const PylithReal C1212 = shearModulus;
+
+        // See Jf3vu_infinitesimalStrain for the mapping from C_ijkl to Jf3 entries.
+        Jf3[ 0] -= C1111; // j0000
+        Jf3[ 4] -= C1212; // j0011
+        Jf3[ 8] -= C1212; // j0022
+        Jf3[10] -= C1122; // j0101
+        Jf3[12] -= C1212; // j0110
+        Jf3[20] -= C1122; // j0202
+        Jf3[24] -= C1212; // j0220
+        Jf3[28] -= C1212; // j1001
+        Jf3[30] -= C1122; // j1010
+        Jf3[36] -= C1212; // j1100
+        Jf3[40] -= C1111; // j1111
+        Jf3[44] -= C1212; // j1122
+        Jf3[50] -= C1122; // j1212
+        Jf3[52] -= C1212; // j1221
+        Jf3[56] -= C1212; // j2002
+        Jf3[60] -= C1122; // j2020
+        Jf3[68] -= C1212; // j2112
+        Jf3[70] -= C1122; // j2121
+        Jf3[72] -= C1212; // j2200
+        Jf3[76] -= C1212; // j2211
+        Jf3[80] -= C1111; // j2222
+    } // Jf3vu_infinitesimalStrain_constModuli
+
     // ===========================================================================================
     // Kernels for fault interfaces and elasticity
     // ===========================================================================================
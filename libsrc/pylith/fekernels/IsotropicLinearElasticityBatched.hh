@@ -0,0 +1,259 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/IsotropicLinearElasticityBatched.hh
+ *
+ * Batched kernels for isotropic, linear elasticity operating on blocks of quadrature points.
+ *
+ * The pointwise kernels in IsotropicLinearElasticity.hh are invoked one quadrature point at a
+ * time through PETSc callbacks, which prevents the compiler from vectorizing across points.
+ * The kernels in this file evaluate the f1 residual term and the Jf3 Jacobian entries for a
+ * contiguous block of quadrature points with the displacement gradient and elastic moduli laid
+ * out structure-of-arrays (SoA), so the point loops vectorize with AVX2/AVX-512 when compiled
+ * with the appropriate -march flags.
+ *
+ * These kernels are used where PyLith owns the quadrature-point loop (batched assembly paths
+ * and kernel benchmarks); the pointwise kernels remain the entry points registered with the
+ * PETSc weak form.
+ *
+ * SoA layout: component c of quadrature point q of array v is v[c*numPoints+q].
+ */
+
+#if !defined(pylith_fekernels_isotropiclinearelasticitybatched_hh)
+#define pylith_fekernels_isotropiclinearelasticitybatched_hh
+
+#include "fekernelsfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh"
+
+#include <cassert> // USES assert()
+
+#if defined(_OPENMP)
+#define PYLITH_BATCHED_SIMD _Pragma("omp simd")
+// Quadrature points in a batch are independent, so large batches thread without write conflicts
+// (each thread writes disjoint ranges of the SoA output arrays).
+#define PYLITH_BATCHED_PARALLEL_SIMD _Pragma("omp parallel for simd")
+#else
+#define PYLITH_BATCHED_SIMD
+#define PYLITH_BATCHED_PARALLEL_SIMD
+#endif
+
+// ------------------------------------------------------------------------------------------------
+/// Batched (SoA) kernels specific to isotropic, linear elasticity.
+class pylith::fekernels::IsotropicLinearElasticityBatched {
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Block of quadrature points with SoA solution gradient and elastic moduli.
+    struct Batch {
+        PylithInt numPoints; ///< Number of quadrature points in block.
+        const PylithScalar* dispGrad; ///< Displacement gradient, SoA [dim*dim][numPoints].
+        const PylithScalar* shearModulus; ///< Shear modulus [numPoints].
+        const PylithScalar* bulkModulus; ///< Bulk modulus [numPoints].
+
+        Batch(void) :
+            numPoints(0),
+            dispGrad(NULL),
+            shearModulus(NULL),
+            bulkModulus(NULL) {}
+
+
+    }; // Batch
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched f1 function for isotropic linear elasticity plane strain with infinitesimal strain
+     * WITHOUT reference stress and reference strain.
+     *
+     * Writes the negative Cauchy stress (the f1 term of the elasticity residual) for each
+     * quadrature point in the block, SoA with tensor components ordered (xx, yy, xy).
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[out] f1 f1 term, SoA [3][numPoints].
+     */
+    static inline
+    void f1v_infinitesimalStrain2D(const Batch& batch,
+                                   PylithScalar* f1) {
+        assert(batch.dispGrad);
+        assert(batch.shearModulus);
+        assert(batch.bulkModulus);
+        assert(f1);
+
+        const PylithInt nq = batch.numPoints;
+        const PylithScalar* du_xx = &batch.dispGrad[0*nq]; // du0/dx0
+        const PylithScalar* du_xy = &batch.dispGrad[1*nq]; // du0/dx1
+        const PylithScalar* du_yx = &batch.dispGrad[2*nq]; // du1/dx0
+        const PylithScalar* du_yy = &batch.dispGrad[3*nq]; // du1/dx1
+        const PylithScalar* shearModulus = batch.shearModulus;
+        const PylithScalar* bulkModulus = batch.bulkModulus;
+
+        PylithScalar* f1_xx = &f1[0*nq];
+        PylithScalar* f1_yy = &f1[1*nq];
+        PylithScalar* f1_xy = &f1[2*nq];
+
+        PYLITH_BATCHED_PARALLEL_SIMD
+        for (PylithInt q = 0; q < nq; ++q) {
+            const PylithScalar strain_xx = du_xx[q];
+            const PylithScalar strain_yy = du_yy[q];
+            const PylithScalar strain_xy = 0.5*(du_xy[q] + du_yx[q]);
+            const PylithScalar strainTrace = strain_xx + strain_yy;
+            const PylithScalar meanStress = bulkModulus[q] * strainTrace;
+            const PylithScalar traceTerm = -2.0/3.0*shearModulus[q] * strainTrace;
+
+            f1_xx[q] = -(meanStress + 2.0*shearModulus[q]*strain_xx + traceTerm);
+            f1_yy[q] = -(meanStress + 2.0*shearModulus[q]*strain_yy + traceTerm);
+            f1_xy[q] = -(2.0*shearModulus[q]*strain_xy);
+        } // for
+    } // f1v_infinitesimalStrain2D
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched f1 function for 3D isotropic linear elasticity with infinitesimal strain WITHOUT
+     * reference stress and reference strain.
+     *
+     * Writes the negative Cauchy stress for each quadrature point in the block, SoA with tensor
+     * components ordered (xx, yy, zz, xy, yz, xz).
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[out] f1 f1 term, SoA [6][numPoints].
+     */
+    static inline
+    void f1v_infinitesimalStrain3D(const Batch& batch,
+                                   PylithScalar* f1) {
+        assert(batch.dispGrad);
+        assert(batch.shearModulus);
+        assert(batch.bulkModulus);
+        assert(f1);
+
+        const PylithInt nq = batch.numPoints;
+        const PylithScalar* du_xx = &batch.dispGrad[0*nq];
+        const PylithScalar* du_xy = &batch.dispGrad[1*nq];
+        const PylithScalar* du_xz = &batch.dispGrad[2*nq];
+        const PylithScalar* du_yx = &batch.dispGrad[3*nq];
+        const PylithScalar* du_yy = &batch.dispGrad[4*nq];
+        const PylithScalar* du_yz = &batch.dispGrad[5*nq];
+        const PylithScalar* du_zx = &batch.dispGrad[6*nq];
+        const PylithScalar* du_zy = &batch.dispGrad[7*nq];
+        const PylithScalar* du_zz = &batch.dispGrad[8*nq];
+        const PylithScalar* shearModulus = batch.shearModulus;
+        const PylithScalar* bulkModulus = batch.bulkModulus;
+
+        PylithScalar* f1_xx = &f1[0*nq];
+        PylithScalar* f1_yy = &f1[1*nq];
+        PylithScalar* f1_zz = &f1[2*nq];
+        PylithScalar* f1_xy = &f1[3*nq];
+        PylithScalar* f1_yz = &f1[4*nq];
+        PylithScalar* f1_xz = &f1[5*nq];
+
+        PYLITH_BATCHED_PARALLEL_SIMD
+        for (PylithInt q = 0; q < nq; ++q) {
+            const PylithScalar strain_xx = du_xx[q];
+            const PylithScalar strain_yy = du_yy[q];
+            const PylithScalar strain_zz = du_zz[q];
+            const PylithScalar strain_xy = 0.5*(du_xy[q] + du_yx[q]);
+            const PylithScalar strain_yz = 0.5*(du_yz[q] + du_zy[q]);
+            const PylithScalar strain_xz = 0.5*(du_xz[q] + du_zx[q]);
+            const PylithScalar strainTrace = strain_xx + strain_yy + strain_zz;
+            const PylithScalar meanStress = bulkModulus[q] * strainTrace;
+            const PylithScalar traceTerm = -2.0/3.0*shearModulus[q] * strainTrace;
+
+            f1_xx[q] = -(meanStress + 2.0*shearModulus[q]*strain_xx + traceTerm);
+            f1_yy[q] = -(meanStress + 2.0*shearModulus[q]*strain_yy + traceTerm);
+            f1_zz[q] = -(meanStress + 2.0*shearModulus[q]*strain_zz + traceTerm);
+            f1_xy[q] = -(2.0*shearModulus[q]*strain_xy);
+            f1_yz[q] = -(2.0*shearModulus[q]*strain_yz);
+            f1_xz[q] = -(2.0*shearModulus[q]*strain_xz);
+        } // for
+    } // f1v_infinitesimalStrain3D
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched Jf3 function for isotropic linear elasticity plane strain with infinitesimal strain.
+     *
+     * Writes the nonzero entries of -C_ikjl for each quadrature point in the block, SoA with
+     * the independent entries ordered (C1111, C1122, C1212, C2222); the caller expands the
+     * symmetric entries when scattering into the dim*dim*dim*dim Jf3 block.
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[out] Jf3 Independent elasticity tensor entries, SoA [4][numPoints].
+     */
+    static inline
+    void Jf3vu_infinitesimalStrain2D(const Batch& batch,
+                                     PylithScalar* Jf3) {
+        assert(batch.shearModulus);
+        assert(batch.bulkModulus);
+        assert(Jf3);
+
+        const PylithInt nq = batch.numPoints;
+        const PylithScalar* shearModulus = batch.shearModulus;
+        const PylithScalar* bulkModulus = batch.bulkModulus;
+
+        PylithScalar* C1111 = &Jf3[0*nq];
+        PylithScalar* C1122 = &Jf3[1*nq];
+        PylithScalar* C1212 = &Jf3[2*nq];
+        PylithScalar* C2222 = &Jf3[3*nq];
+
+        PYLITH_BATCHED_SIMD
+        for (PylithInt q = 0; q < nq; ++q) {
+            const PylithScalar lambda2mu = bulkModulus[q] + 4.0/3.0*shearModulus[q];
+
+            C1111[q] = -lambda2mu;
+            C1122[q] = -(bulkModulus[q] - 2.0/3.0*shearModulus[q]);
+            C1212[q] = -shearModulus[q];
+            C2222[q] = -lambda2mu;
+        } // for
+    } // Jf3vu_infinitesimalStrain2D
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched Jf3 function for 3D isotropic linear elasticity with infinitesimal strain.
+     *
+     * Writes the nonzero entries of -C_ikjl for each quadrature point in the block, SoA with
+     * the independent entries ordered (C1111, C1122, C1212); isotropy gives
+     * C2222 = C3333 = C1111, C1133 = C2233 = C1122, and C1313 = C2323 = C1212.
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[out] Jf3 Independent elasticity tensor entries, SoA [3][numPoints].
+     */
+    static inline
+    void Jf3vu_infinitesimalStrain3D(const Batch& batch,
+                                     PylithScalar* Jf3) {
+        assert(batch.shearModulus);
+        assert(batch.bulkModulus);
+        assert(Jf3);
+
+        const PylithInt nq = batch.numPoints;
+        const PylithScalar* shearModulus = batch.shearModulus;
+        const PylithScalar* bulkModulus = batch.bulkModulus;
+
+        PylithScalar* C1111 = &Jf3[0*nq];
+        PylithScalar* C1122 = &Jf3[1*nq];
+        PylithScalar* C1212 = &Jf3[2*nq];
+
+        PYLITH_BATCHED_SIMD
+        for (PylithInt q = 0; q < nq; ++q) {
+            C1111[q] = -(bulkModulus[q] + 4.0/3.0*shearModulus[q]);
+            C1122[q] = -(bulkModulus[q] - 2.0/3.0*shearModulus[q]);
+            C1212[q] = -shearModulus[q];
+        } // for
+    } // Jf3vu_infinitesimalStrain3D
+
+}; // IsotropicLinearElasticityBatched
+
+#endif // pylith_fekernels_isotropiclinearelasticitybatched_hh
+
+/* End of file */
@@ -100,6 +100,7 @@ public:
         PylithReal bulkModulus;
         const PylithReal* maxwellTime; // size is numParallel
         const PylithReal* shearModulusRatio; // size is numParallel
+        const PylithScalar* decayFactors; // [exp(-dt/tau_i), dq_i] per Maxwell element; NULL if not precomputed
         PylithReal dt;
         pylith::fekernels::Tensor viscousStrain[3]; // Size must match numParallel
         pylith::fekernels::Tensor totalStrain;
@@ -111,6 +112,7 @@ public:
             bulkModulus(0.0),
             maxwellTime(nullptr),
             shearModulusRatio(nullptr),
+            decayFactors(nullptr),
             dt(0.0) {}
 
 
@@ -158,7 +160,7 @@ public:
         assert(aOff[i_shearModulusRatio] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_totalStrain] >= 0);
-        assert(1 == numConstants);
+        assert(numConstants >= 1);
         assert(constants);
 
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
@@ -166,6 +168,7 @@ public:
         context->maxwellTime = &a[aOff[i_maxwellTime]];assert(context->maxwellTime);
         context->shearModulusRatio = &a[aOff[i_shearModulusRatio]];assert(context->shearModulusRatio);
         context->dt = constants[0];
+        context->decayFactors = (numConstants >= 1 + 2*numParallel) ? &constants[1] : nullptr;
 
         for (PylithInt i = 0; i < numParallel; ++i) {
             const PylithInt offset = i*tensorOps.vectorSize;
@@ -217,7 +220,7 @@ public:
         assert(aOff[i_shearModulusRatio] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_totalStrain] >= 0);
-        assert(1 == numConstants);
+        assert(numConstants >= 1);
         assert(constants);
 
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
@@ -225,6 +228,7 @@ public:
         context->maxwellTime = &a[aOff[i_maxwellTime]];assert(context->maxwellTime);
         context->shearModulusRatio = &a[aOff[i_shearModulusRatio]];assert(context->shearModulusRatio);
         context->dt = constants[0];
+        context->decayFactors = (numConstants >= 1 + 2*numParallel) ? &constants[1] : nullptr;
 
         for (PylithInt i = 0; i < numParallel; ++i) {
             const PylithInt offset = i*tensorOps.vectorSize;
@@ -255,11 +259,17 @@ public:
         const PylithReal dt = rheologyContext.dt;
         const pylith::fekernels::Tensor& totalStrain = rheologyContext.totalStrain;
         for (PylithInt i = 0; i < numParallel; ++i ) {
-            const PylithReal maxwellTime = rheologyContext.maxwellTime[i];
             const pylith::fekernels::Tensor& viscousStrainPrev = rheologyContext.viscousStrain[i];
             pylith::fekernels::Tensor viscousStrainTensor;
 
-            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrainTensor);
+            if (rheologyContext.decayFactors) {
+                pylith::fekernels::IsotropicLinearMaxwell::viscousStrain_decayFactors(
+                    rheologyContext.decayFactors[2*i+0], rheologyContext.decayFactors[2*i+1],
+                    viscousStrainPrev, totalStrain, strain, &viscousStrainTensor);
+            } else {
+                const PylithReal maxwellTime = rheologyContext.maxwellTime[i];
+                pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrainTensor);
+            } // if/else
 
             const PylithInt offset = i*tensorOps.vectorSize;
             tensorOps.toVector(viscousStrainTensor, &viscousStrainVector[offset]);
@@ -290,9 +300,15 @@ public:
 
         pylith::fekernels::Tensor viscousStrain[numParallel];
         for (PylithInt i = 0; i < numParallel; ++i ) {
-            const PylithReal maxwellTime = context->maxwellTime[i];
             const pylith::fekernels::Tensor& viscousStrainPrev = context->viscousStrain[i];
-            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain[i]);
+            if (context->decayFactors) {
+                pylith::fekernels::IsotropicLinearMaxwell::viscousStrain_decayFactors(
+                    context->decayFactors[2*i+0], context->decayFactors[2*i+1],
+                    viscousStrainPrev, totalStrain, strain, &viscousStrain[i]);
+            } else {
+                const PylithReal maxwellTime = context->maxwellTime[i];
+                pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain[i]);
+            } // if/else
         } // for
 
         pylith::fekernels::Tensor devStrain;
@@ -329,9 +345,15 @@ public:
 
         pylith::fekernels::Tensor viscousStrain[numParallel];
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithReal maxwellTime = context->maxwellTime[i];
             const pylith::fekernels::Tensor& viscousStrainPrev = context->viscousStrain[i];
-            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain[i]);
+            if (context->decayFactors) {
+                pylith::fekernels::IsotropicLinearMaxwell::viscousStrain_decayFactors(
+                    context->decayFactors[2*i+0], context->decayFactors[2*i+1],
+                    viscousStrainPrev, totalStrain, strain, &viscousStrain[i]);
+            } else {
+                const PylithReal maxwellTime = context->maxwellTime[i];
+                pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain[i]);
+            } // if/else
         } // for
 
         pylith::fekernels::Tensor devStrain;
@@ -657,8 +679,8 @@ public:
         const PylithReal shearModulusRatio_0 = 1.0 - shearModulusRatio[0] - shearModulusRatio[1] - shearModulusRatio[2];
         PylithReal shearFactor = shearModulus * shearModulusRatio_0;
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithReal maxwellTime = context.maxwellTime[i];
-            const PylithReal dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+            const PylithReal dq = (context.decayFactors) ? context.decayFactors[2*i+1] :
+                                  pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, context.maxwellTime[i]);
             shearFactor += shearModulus * dq * shearModulusRatio[i];
         } // for
 
@@ -1186,8 +1208,8 @@ public:
         const PylithReal shearModulusRatio_0 = 1.0 - shearModulusRatio[0] - shearModulusRatio[1] - shearModulusRatio[2];
         PylithReal shearFactor = shearModulus * shearModulusRatio_0;
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithReal maxwellTime = context.maxwellTime[i];
-            const PylithReal dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+            const PylithReal dq = (context.decayFactors) ? context.decayFactors[2*i+1] :
+                                  pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, context.maxwellTime[i]);
             shearFactor += shearModulus * dq * shearModulusRatio[i];
         } // for
 
@@ -265,6 +265,24 @@ public:
                        const pylith::fekernels::Tensor& strain,
                        const PylithReal dt,
                        pylith::fekernels::Tensor* viscousStrain) {
+        const PylithScalar expFac = exp(-dt/maxwellTime);
+        const PylithScalar dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+        viscousStrain_decayFactors(expFac, dq, viscousStrainPrev, totalStrain, strain, viscousStrain);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Calculate viscous strain with precomputed decay factors.
+     *
+     * @param[in] expFac Precomputed exp(-dt/maxwellTime).
+     * @param[in] dq Precomputed viscousStrainCoeff(dt, maxwellTime).
+     */
+    static inline
+    void viscousStrain_decayFactors(const PylithScalar expFac,
+                                    const PylithScalar dq,
+                                    const pylith::fekernels::Tensor& viscousStrainPrev,
+                                    const pylith::fekernels::Tensor& totalStrain,
+                                    const pylith::fekernels::Tensor& strain,
+                                    pylith::fekernels::Tensor* viscousStrain) {
         assert(viscousStrain);
 
         pylith::fekernels::Tensor devStrain;
@@ -273,8 +291,6 @@ public:
         pylith::fekernels::Tensor devTotalStrain;
         pylith::fekernels::Elasticity::deviatoric(totalStrain, &devTotalStrain);
 
-        const PylithScalar dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
-        const PylithScalar expFac = exp(-dt/maxwellTime);
         viscousStrain->xx = expFac * viscousStrainPrev.xx + dq * (devStrain.xx - devTotalStrain.xx);
         viscousStrain->yy = expFac * viscousStrainPrev.yy + dq * (devStrain.yy - devTotalStrain.yy);
         viscousStrain->zz = expFac * viscousStrainPrev.zz + dq * (devStrain.zz - devTotalStrain.zz);
@@ -0,0 +1,280 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/IsotropicLinearPoroelasticityBatched.hh
+ *
+ * Batched fused kernels for isotropic, linear poroelasticity operating on blocks of quadrature
+ * points.
+ *
+ * The pointwise kernels in IsotropicLinearPoroelasticity.cc evaluate the displacement, pressure,
+ * and trace-strain residual contributions in separate PETSc callbacks that each re-read the
+ * material properties from the auxiliary field. The kernels in this file compute all residual
+ * blocks of the quasistatic poroelasticity equation (effective stress f1u, storage f0p, Darcy
+ * flux f1p, and trace-strain constraint f0e) in one pass per quadrature point with solution and
+ * property data laid out structure-of-arrays (SoA), so properties are fetched once and the point
+ * loop vectorizes.
+ *
+ * These kernels are used where PyLith owns the quadrature-point loop (batched assembly paths and
+ * kernel benchmarks); the pointwise kernels remain the entry points registered with the PETSc
+ * weak form, which invokes one solution field at a time.
+ *
+ * SoA layout: component c of quadrature point q of array v is v[c*numPoints+q].
+ */
+
+#if !defined(pylith_fekernels_isotropiclinearporoelasticitybatched_hh)
+#define pylith_fekernels_isotropiclinearporoelasticitybatched_hh
+
+#include "fekernelsfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh"
+
+#include <cassert> // USES assert()
+
+#if !defined(PYLITH_BATCHED_SIMD)
+#if defined(_OPENMP)
+#define PYLITH_BATCHED_SIMD _Pragma("omp simd")
+// Quadrature points in a batch are independent, so large batches thread without write conflicts
+// (each thread writes disjoint ranges of the SoA output arrays).
+#define PYLITH_BATCHED_PARALLEL_SIMD _Pragma("omp parallel for simd")
+#else
+#define PYLITH_BATCHED_SIMD
+#define PYLITH_BATCHED_PARALLEL_SIMD
+#endif
+#endif
+
+// ------------------------------------------------------------------------------------------------
+/// Batched (SoA) fused kernels specific to isotropic, linear poroelasticity.
+class pylith::fekernels::IsotropicLinearPoroelasticityBatched {
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Block of quadrature points with SoA solution data and poroelastic properties.
+    struct Batch {
+        PylithInt numPoints; ///< Number of quadrature points in block.
+        const PylithScalar* dispGrad; ///< Displacement gradient, SoA [dim*dim][numPoints].
+        const PylithScalar* pressure; ///< Fluid pressure [numPoints].
+        const PylithScalar* pressure_t; ///< Time derivative of fluid pressure [numPoints].
+        const PylithScalar* pressureGrad; ///< Fluid pressure gradient, SoA [dim][numPoints].
+        const PylithScalar* traceStrain; ///< Trace strain [numPoints].
+        const PylithScalar* traceStrain_t; ///< Time derivative of trace strain [numPoints].
+        const PylithScalar* shearModulus; ///< Shear modulus [numPoints].
+        const PylithScalar* drainedBulkModulus; ///< Drained bulk modulus [numPoints].
+        const PylithScalar* biotCoefficient; ///< Biot coefficient [numPoints].
+        const PylithScalar* biotModulus; ///< Biot modulus [numPoints].
+        const PylithScalar* fluidViscosity; ///< Fluid viscosity [numPoints].
+        const PylithScalar* isotropicPermeability; ///< Isotropic permeability [numPoints].
+
+        Batch(void) :
+            numPoints(0),
+            dispGrad(NULL),
+            pressure(NULL),
+            pressure_t(NULL),
+            pressureGrad(NULL),
+            traceStrain(NULL),
+            traceStrain_t(NULL),
+            shearModulus(NULL),
+            drainedBulkModulus(NULL),
+            biotCoefficient(NULL),
+            biotModulus(NULL),
+            fluidViscosity(NULL),
+            isotropicPermeability(NULL) {}
+
+
+    }; // Batch
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched fused residual for quasistatic plane strain isotropic linear poroelasticity with
+     * infinitesimal strain WITHOUT reference stress/strain, gravity, body forces, sources, and
+     * tensor permeability.
+     *
+     * Computes all residual blocks in one pass per quadrature point:
+     * - f1u: negative effective stress, SoA with tensor components ordered (xx, yy, xy).
+     * - f0p: storage term \alpha \dot{\epsilon}_v + \dot{p}/M.
+     * - f1p: Darcy flux (k/\mu_f) \nabla p, SoA [2][numPoints].
+     * - f0e: trace-strain constraint \nabla \cdot u - \epsilon_v.
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[out] f1u f1 term for displacement, SoA [3][numPoints].
+     * @param[out] f0p f0 term for pressure [numPoints].
+     * @param[out] f1p f1 term for pressure, SoA [2][numPoints].
+     * @param[out] f0e f0 term for trace strain [numPoints].
+     */
+    static inline
+    void residual_quasistatic2D(const Batch& batch,
+                                PylithScalar* f1u,
+                                PylithScalar* f0p,
+                                PylithScalar* f1p,
+                                PylithScalar* f0e) {
+        assert(batch.dispGrad);
+        assert(batch.pressure);
+        assert(batch.pressure_t);
+        assert(batch.pressureGrad);
+        assert(batch.traceStrain);
+        assert(batch.traceStrain_t);
+        assert(batch.shearModulus);
+        assert(batch.drainedBulkModulus);
+        assert(batch.biotCoefficient);
+        assert(batch.biotModulus);
+        assert(batch.fluidViscosity);
+        assert(batch.isotropicPermeability);
+        assert(f1u);
+        assert(f0p);
+        assert(f1p);
+        assert(f0e);
+
+        const PylithInt nq = batch.numPoints;
+        const PylithScalar* du_xx = &batch.dispGrad[0*nq]; // du0/dx0
+        const PylithScalar* du_xy = &batch.dispGrad[1*nq]; // du0/dx1
+        const PylithScalar* du_yx = &batch.dispGrad[2*nq]; // du1/dx0
+        const PylithScalar* du_yy = &batch.dispGrad[3*nq]; // du1/dx1
+        const PylithScalar* dp_x = &batch.pressureGrad[0*nq];
+        const PylithScalar* dp_y = &batch.pressureGrad[1*nq];
+
+        PylithScalar* f1u_xx = &f1u[0*nq];
+        PylithScalar* f1u_yy = &f1u[1*nq];
+        PylithScalar* f1u_xy = &f1u[2*nq];
+        PylithScalar* f1p_x = &f1p[0*nq];
+        PylithScalar* f1p_y = &f1p[1*nq];
+
+        PYLITH_BATCHED_PARALLEL_SIMD
+        for (PylithInt q = 0; q < nq; ++q) {
+            const PylithScalar shearModulus = batch.shearModulus[q];
+            const PylithScalar drainedBulkModulus = batch.drainedBulkModulus[q];
+            const PylithScalar biotCoefficient = batch.biotCoefficient[q];
+            const PylithScalar biotModulus = batch.biotModulus[q];
+            const PylithScalar mobility = batch.isotropicPermeability[q] / batch.fluidViscosity[q];
+
+            const PylithScalar pressure = batch.pressure[q];
+            const PylithScalar traceStrain = batch.traceStrain[q];
+            const PylithScalar traceTerm = (drainedBulkModulus - 2.0*shearModulus/3.0) * traceStrain;
+
+            f1u_xx[q] = -(2.0*shearModulus*du_xx[q] + traceTerm) + biotCoefficient*pressure;
+            f1u_yy[q] = -(2.0*shearModulus*du_yy[q] + traceTerm) + biotCoefficient*pressure;
+            f1u_xy[q] = -shearModulus*(du_xy[q] + du_yx[q]);
+
+            f0p[q] = biotCoefficient*batch.traceStrain_t[q] + batch.pressure_t[q]/biotModulus;
+
+            f1p_x[q] = mobility * dp_x[q];
+            f1p_y[q] = mobility * dp_y[q];
+
+            f0e[q] = du_xx[q] + du_yy[q] - traceStrain;
+        } // for
+    } // residual_quasistatic2D
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched fused residual for quasistatic 3D isotropic linear poroelasticity with
+     * infinitesimal strain WITHOUT reference stress/strain, gravity, body forces, sources, and
+     * tensor permeability.
+     *
+     * Computes all residual blocks in one pass per quadrature point:
+     * - f1u: negative effective stress, SoA with tensor components ordered
+     *   (xx, yy, zz, xy, yz, xz).
+     * - f0p: storage term \alpha \dot{\epsilon}_v + \dot{p}/M.
+     * - f1p: Darcy flux (k/\mu_f) \nabla p, SoA [3][numPoints].
+     * - f0e: trace-strain constraint \nabla \cdot u - \epsilon_v.
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[out] f1u f1 term for displacement, SoA [6][numPoints].
+     * @param[out] f0p f0 term for pressure [numPoints].
+     * @param[out] f1p f1 term for pressure, SoA [3][numPoints].
+     * @param[out] f0e f0 term for trace strain [numPoints].
+     */
+    static inline
+    void residual_quasistatic3D(const Batch& batch,
+                                PylithScalar* f1u,
+                                PylithScalar* f0p,
+                                PylithScalar* f1p,
+                                PylithScalar* f0e) {
+        assert(batch.dispGrad);
+        assert(batch.pressure);
+        assert(batch.pressure_t);
+        assert(batch.pressureGrad);
+        assert(batch.traceStrain);
+        assert(batch.traceStrain_t);
+        assert(batch.shearModulus);
+        assert(batch.drainedBulkModulus);
+        assert(batch.biotCoefficient);
+        assert(batch.biotModulus);
+        assert(batch.fluidViscosity);
+        assert(batch.isotropicPermeability);
+        assert(f1u);
+        assert(f0p);
+        assert(f1p);
+        assert(f0e);
+
+        const PylithInt nq = batch.numPoints;
+        const PylithScalar* du_xx = &batch.dispGrad[0*nq];
+        const PylithScalar* du_xy = &batch.dispGrad[1*nq];
+        const PylithScalar* du_xz = &batch.dispGrad[2*nq];
+        const PylithScalar* du_yx = &batch.dispGrad[3*nq];
+        const PylithScalar* du_yy = &batch.dispGrad[4*nq];
+        const PylithScalar* du_yz = &batch.dispGrad[5*nq];
+        const PylithScalar* du_zx = &batch.dispGrad[6*nq];
+        const PylithScalar* du_zy = &batch.dispGrad[7*nq];
+        const PylithScalar* du_zz = &batch.dispGrad[8*nq];
+        const PylithScalar* dp_x = &batch.pressureGrad[0*nq];
+        const PylithScalar* dp_y = &batch.pressureGrad[1*nq];
+        const PylithScalar* dp_z = &batch.pressureGrad[2*nq];
+
+        PylithScalar* f1u_xx = &f1u[0*nq];
+        PylithScalar* f1u_yy = &f1u[1*nq];
+        PylithScalar* f1u_zz = &f1u[2*nq];
+        PylithScalar* f1u_xy = &f1u[3*nq];
+        PylithScalar* f1u_yz = &f1u[4*nq];
+        PylithScalar* f1u_xz = &f1u[5*nq];
+        PylithScalar* f1p_x = &f1p[0*nq];
+        PylithScalar* f1p_y = &f1p[1*nq];
+        PylithScalar* f1p_z = &f1p[2*nq];
+
+        PYLITH_BATCHED_PARALLEL_SIMD
+        for (PylithInt q = 0; q < nq; ++q) {
+            const PylithScalar shearModulus = batch.shearModulus[q];
+            const PylithScalar drainedBulkModulus = batch.drainedBulkModulus[q];
+            const PylithScalar biotCoefficient = batch.biotCoefficient[q];
+            const PylithScalar biotModulus = batch.biotModulus[q];
+            const PylithScalar mobility = batch.isotropicPermeability[q] / batch.fluidViscosity[q];
+
+            const PylithScalar pressure = batch.pressure[q];
+            const PylithScalar traceStrain = batch.traceStrain[q];
+            const PylithScalar traceTerm = (drainedBulkModulus - 2.0*shearModulus/3.0) * traceStrain;
+
+            f1u_xx[q] = -(2.0*shearModulus*du_xx[q] + traceTerm) + biotCoefficient*pressure;
+            f1u_yy[q] = -(2.0*shearModulus*du_yy[q] + traceTerm) + biotCoefficient*pressure;
+            f1u_zz[q] = -(2.0*shearModulus*du_zz[q] + traceTerm) + biotCoefficient*pressure;
+            f1u_xy[q] = -shearModulus*(du_xy[q] + du_yx[q]);
+            f1u_yz[q] = -shearModulus*(du_yz[q] + du_zy[q]);
+            f1u_xz[q] = -shearModulus*(du_xz[q] + du_zx[q]);
+
+            f0p[q] = biotCoefficient*batch.traceStrain_t[q] + batch.pressure_t[q]/biotModulus;
+
+            f1p_x[q] = mobility * dp_x[q];
+            f1p_y[q] = mobility * dp_y[q];
+            f1p_z[q] = mobility * dp_z[q];
+
+            f0e[q] = du_xx[q] + du_yy[q] + du_zz[q] - traceStrain;
+        } // for
+    } // residual_quasistatic3D
+
+}; // IsotropicLinearPoroelasticityBatched
+
+#endif // pylith_fekernels_isotropiclinearporoelasticitybatched_hh
+
+/* End of file */
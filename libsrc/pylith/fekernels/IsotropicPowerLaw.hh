@@ -88,6 +88,8 @@
 // ------------------------------------------------------------------------------------------------
 /// Kernels for isotropic power-law viscoelasticity (dimension independent).
 class pylith::fekernels::IsotropicPowerLaw {
+    friend class IsotropicPowerLawBatched; // batched effective-stress solve reuses scalar helpers
+
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -0,0 +1,299 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/IsotropicPowerLawBatched.hh
+ *
+ * Batched effective-stress solve for isotropic power-law viscoelasticity.
+ *
+ * The pointwise kernels in IsotropicPowerLaw.hh perform an independent scalar Newton solve
+ * (with bracketing and bisection safeguards) for the effective stress at each quadrature point.
+ * The solve in this file carries one point per SIMD lane across a block of quadrature points
+ * laid out structure-of-arrays (SoA): all lanes take bracketing and Newton iterations in
+ * lockstep, with converged lanes masked out, so the iteration cost is amortized across the
+ * block instead of being paid serially point by point.
+ *
+ * These kernels are used where PyLith owns the quadrature-point loop (batched assembly paths
+ * and kernel benchmarks); the pointwise kernels remain the entry points registered with the
+ * PETSc weak form. The per-lane function evaluations reuse the scalar helpers in
+ * IsotropicPowerLaw so both paths solve the identical effective-stress equation.
+ *
+ * SoA layout: value for quadrature point q of array v is v[q].
+ */
+
+#if !defined(pylith_fekernels_isotropicpowerlawbatched_hh)
+#define pylith_fekernels_isotropicpowerlawbatched_hh
+
+#include "fekernelsfwd.hh" // forward declarations
+
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw scalar helpers
+
+#include "pylith/utils/types.hh"
+
+#include <algorithm> // USES std::max(), std::min()
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+#if !defined(PYLITH_BATCHED_SIMD)
+#if defined(_OPENMP)
+#define PYLITH_BATCHED_SIMD _Pragma("omp simd")
+#else
+#define PYLITH_BATCHED_SIMD
+#endif
+#endif
+
+// ------------------------------------------------------------------------------------------------
+/// Batched (SoA) effective-stress solve for isotropic power-law viscoelasticity.
+class pylith::fekernels::IsotropicPowerLawBatched {
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Block of quadrature points with SoA parameters for the effective-stress equation.
+    ///
+    /// The parameters match the arguments of IsotropicPowerLaw::_effectiveStress(); see
+    /// IsotropicPowerLaw::deviatoricStress() for how they are formed from the deviatoric
+    /// strain and stress state.
+    struct Batch {
+        PylithInt numPoints; ///< Number of quadrature points in block.
+        const PylithScalar* j2InitialGuess; ///< Initial guess for sqrt(J2) [numPoints].
+        const PylithScalar* stressScale; ///< Stress scale for initial guess fallback [numPoints].
+        const PylithScalar* ae; ///< 1/(2*shearModulus) [numPoints].
+        const PylithScalar* b; ///< Strain invariant term [numPoints].
+        const PylithScalar* c; ///< Strain-stress invariant term [numPoints].
+        const PylithScalar* d; ///< Stress invariant term [numPoints].
+        const PylithScalar* j2T; ///< sqrt(J2) of deviatoric stress at time t [numPoints].
+        const PylithScalar* powerLawExponent; ///< Power-law exponent [numPoints].
+        const PylithScalar* powerLawRefStrainRate; ///< Reference strain rate [numPoints].
+        const PylithScalar* powerLawRefStress; ///< Reference stress [numPoints].
+        PylithReal dt; ///< Time step.
+
+        Batch(void) :
+            numPoints(0),
+            j2InitialGuess(NULL),
+            stressScale(NULL),
+            ae(NULL),
+            b(NULL),
+            c(NULL),
+            d(NULL),
+            j2T(NULL),
+            powerLawExponent(NULL),
+            powerLawRefStrainRate(NULL),
+            powerLawRefStress(NULL),
+            dt(0.0) {}
+
+
+    }; // Batch
+
+    // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    static const PylithInt laneBlockSize = 64; ///< Points solved per lockstep sweep.
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched effective stress solve for a power-law material.
+     *
+     * Solves the effective-stress equation for every quadrature point in the block; points with
+     * zero deviatoric state (b == c == d == 0) get an effective stress of zero, matching the
+     * pointwise kernels.
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[out] j2Tpdt Effective stress sqrt(J2) at time t+dt [numPoints].
+     */
+    static inline
+    void effectiveStress(const Batch& batch,
+                         PylithScalar* j2Tpdt) {
+        assert(j2Tpdt);
+
+        for (PylithInt qStart = 0; qStart < batch.numPoints; qStart += laneBlockSize) {
+            const PylithInt numLanes = std::min(laneBlockSize, batch.numPoints - qStart);
+            _effectiveStressBlock(batch, qStart, numLanes, &j2Tpdt[qStart]);
+        } // for
+    } // effectiveStress
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    // --------------------------------------------------------------------------------------------
+    /** Lockstep bracket + Newton-with-bisection solve for one block of SIMD lanes.
+     *
+     * Mirrors IsotropicPowerLaw::_effectiveStress()/_bracket()/_search() with the iteration
+     * loops hoisted outside a vectorizable lane loop; converged or bracketed lanes are masked.
+     *
+     * @param[in] batch Block of quadrature points (SoA).
+     * @param[in] qStart Index of first quadrature point in block of lanes.
+     * @param[in] numLanes Number of lanes (<= laneBlockSize).
+     * @param[out] j2Tpdt Effective stress for the lanes [numLanes].
+     */
+    static inline
+    void _effectiveStressBlock(const Batch& batch,
+                               const PylithInt qStart,
+                               const PylithInt numLanes,
+                               PylithScalar* j2Tpdt) {
+        const size_t maxBracketIterations = 50;
+        const size_t maxNewtonIterations = 100;
+        const PylithReal bracketFactor = 2; // Factor by which to increase the brackets.
+        const PylithReal guessMin = 1.0e-10; // Below this, use stress scale as initial guess.
+        const PylithReal xMin = 0.0; // Minimum allowed value for effective stress.
+        const PylithReal accuracy = 1.0e-16; // Desired accuracy for root.
+
+        const PylithScalar* ae = &batch.ae[qStart];
+        const PylithScalar* b = &batch.b[qStart];
+        const PylithScalar* c = &batch.c[qStart];
+        const PylithScalar* d = &batch.d[qStart];
+        const PylithScalar* j2T = &batch.j2T[qStart];
+        const PylithScalar* powerLawExponent = &batch.powerLawExponent[qStart];
+        const PylithScalar* powerLawRefStrainRate = &batch.powerLawRefStrainRate[qStart];
+        const PylithScalar* powerLawRefStress = &batch.powerLawRefStress[qStart];
+        const PylithReal dt = batch.dt;
+
+        PylithReal x1[laneBlockSize];
+        PylithReal x2[laneBlockSize];
+        PylithReal funcValue1[laneBlockSize];
+        PylithReal funcValue2[laneBlockSize];
+        bool active[laneBlockSize]; // Lane has nonzero deviatoric state.
+        bool bracketed[laneBlockSize];
+
+        // Bracket the root, all lanes in lockstep.
+        PYLITH_BATCHED_SIMD
+        for (PylithInt q = 0; q < numLanes; ++q) {
+            active[q] = (b[q] != 0.0) || (c[q] != 0.0) || (d[q] != 0.0);
+            const PylithReal guess = batch.j2InitialGuess[qStart+q];
+            const PylithReal x0 = (guess > guessMin) ? guess : batch.stressScale[qStart+q];
+            x1[q] = 0.5 * x0;
+            x2[q] = 1.5 * x0;
+            funcValue1[q] = pylith::fekernels::IsotropicPowerLaw::_effectiveStressFn(
+                x1[q], ae[q], b[q], c[q], d[q], dt, j2T[q], powerLawExponent[q],
+                powerLawRefStrainRate[q], powerLawRefStress[q]);
+            funcValue2[q] = pylith::fekernels::IsotropicPowerLaw::_effectiveStressFn(
+                x2[q], ae[q], b[q], c[q], d[q], dt, j2T[q], powerLawExponent[q],
+                powerLawRefStrainRate[q], powerLawRefStress[q]);
+            bracketed[q] = !active[q] || (funcValue1[q] * funcValue2[q] < 0.0);
+        } // for
+        for (size_t iter = 0; iter < maxBracketIterations; ++iter) {
+            bool allBracketed = true;
+            for (PylithInt q = 0; q < numLanes; ++q) {
+                allBracketed = allBracketed && bracketed[q];
+            } // for
+            if (allBracketed) { break; }
+
+            PYLITH_BATCHED_SIMD
+            for (PylithInt q = 0; q < numLanes; ++q) {
+                if (bracketed[q]) { continue; }
+                if (fabs(funcValue1[q]) < fabs(funcValue2[q])) {
+                    x1[q] += bracketFactor * (x1[q] - x2[q]);
+                    x1[q] = std::max(x1[q], xMin);
+                    funcValue1[q] = pylith::fekernels::IsotropicPowerLaw::_effectiveStressFn(
+                        x1[q], ae[q], b[q], c[q], d[q], dt, j2T[q], powerLawExponent[q],
+                        powerLawRefStrainRate[q], powerLawRefStress[q]);
+                } else {
+                    x2[q] += bracketFactor * (x1[q] - x2[q]);
+                    x2[q] = std::max(x2[q], xMin);
+                    funcValue2[q] = pylith::fekernels::IsotropicPowerLaw::_effectiveStressFn(
+                        x2[q], ae[q], b[q], c[q], d[q], dt, j2T[q], powerLawExponent[q],
+                        powerLawRefStrainRate[q], powerLawRefStress[q]);
+                } // if/else
+                bracketed[q] = (funcValue1[q] * funcValue2[q] < 0.0);
+            } // for
+        } // for
+        for (PylithInt q = 0; q < numLanes; ++q) {
+            if (!bracketed[q]) {
+                throw std::runtime_error("Unable to bracket effective stress.");
+            } // if
+        } // for
+
+        // Find effective stress using Newton's method with bisection, all lanes in lockstep.
+        PylithReal xLow[laneBlockSize];
+        PylithReal xHigh[laneBlockSize];
+        PylithReal effStress[laneBlockSize];
+        PylithReal dx[laneBlockSize];
+        PylithReal funcValue[laneBlockSize];
+        PylithReal funcDeriv[laneBlockSize];
+        bool converged[laneBlockSize];
+
+        PYLITH_BATCHED_SIMD
+        for (PylithInt q = 0; q < numLanes; ++q) {
+            // Organize search so that the function is less than zero at xLow.
+            if (funcValue1[q] < 0.0) {
+                xLow[q] = x1[q];
+                xHigh[q] = x2[q];
+            } else {
+                xLow[q] = x2[q];
+                xHigh[q] = x1[q];
+            } // if/else
+            effStress[q] = 0.5 * (x1[q] + x2[q]);
+            dx[q] = fabs(x2[q] - x1[q]);
+            funcValue[q] = 0.0;
+            funcDeriv[q] = 0.0;
+            pylith::fekernels::IsotropicPowerLaw::_effectiveStressFnDerivative(
+                &funcValue[q], &funcDeriv[q], effStress[q], ae[q], b[q], c[q], d[q], dt, j2T[q],
+                powerLawExponent[q], powerLawRefStrainRate[q], powerLawRefStress[q]);
+            converged[q] = !active[q];
+        } // for
+        for (size_t iter = 0; iter < maxNewtonIterations; ++iter) {
+            bool allConverged = true;
+            for (PylithInt q = 0; q < numLanes; ++q) {
+                allConverged = allConverged && converged[q];
+            } // for
+            if (allConverged) { break; }
+
+            PYLITH_BATCHED_SIMD
+            for (PylithInt q = 0; q < numLanes; ++q) {
+                if (converged[q]) { continue; }
+                if (fabs(funcValue[q]) < accuracy) {
+                    converged[q] = true;
+                    continue;
+                } // if
+                const PylithReal funcXHigh = (effStress[q] - xHigh[q]) * funcDeriv[q] - funcValue[q];
+                const PylithReal funcXLow = (effStress[q] - xLow[q]) * funcDeriv[q] - funcValue[q];
+                // Use bisection if solution goes out of bounds.
+                if (funcXHigh * funcXLow >= 0.0) {
+                    dx[q] = 0.5 * (xHigh[q] - xLow[q]);
+                    effStress[q] = xLow[q] + dx[q];
+                } else {
+                    dx[q] = funcValue[q] / funcDeriv[q];
+                    effStress[q] = effStress[q] - dx[q];
+                } // if/else
+                pylith::fekernels::IsotropicPowerLaw::_effectiveStressFnDerivative(
+                    &funcValue[q], &funcDeriv[q], effStress[q], ae[q], b[q], c[q], d[q], dt, j2T[q],
+                    powerLawExponent[q], powerLawRefStrainRate[q], powerLawRefStress[q]);
+                if (funcValue[q] < 0.0) {
+                    xLow[q] = effStress[q];
+                } else {
+                    xHigh[q] = effStress[q];
+                } // if/else
+            } // for
+        } // for
+        for (PylithInt q = 0; q < numLanes; ++q) {
+            if (!converged[q]) {
+                throw std::runtime_error("Cannot find root of effective stress function.");
+            } // if
+        } // for
+
+        PYLITH_BATCHED_SIMD
+        for (PylithInt q = 0; q < numLanes; ++q) {
+            j2Tpdt[q] = (active[q]) ? effStress[q] : 0.0;
+        } // for
+    } // _effectiveStressBlock
+
+}; // IsotropicPowerLawBatched
+
+#endif // pylith_fekernels_isotropicpowerlawbatched_hh
+
+/* End of file */
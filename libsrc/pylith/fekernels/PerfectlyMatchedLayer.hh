@@ -0,0 +1,98 @@
+/* -*- C -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/PerfectlyMatchedLayer.hh
+ *
+ * Kernels for perfectly matched layer absorbing regions.
+ *
+ * \int_{\Omega_{pml}} \trialvec[u] \left( -\rho(\vec{x}) \sigma_i(\vec{x}) v_i \right) d\Omega
+ *
+ * where \sigma_i is the damping coefficient profile for the i-th coordinate axis, graded from
+ * zero at the interior edge of the layer to its maximum at the exterior boundary.
+ *
+ * Solution fields: [disp(dim), vel(dim), ...]
+ *
+ * Auxiliary fields:
+ * - 0: density(1)
+ * - 1: damping_coefficient(dim)
+ */
+
+#if !defined(pylith_fekernels_perfectlymatchedlayer_hh)
+#define pylith_fekernels_perfectlymatchedlayer_hh
+
+// Include directives ---------------------------------------------------
+#include "fekernelsfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh"
+
+#include <cassert> // USES assert()
+
+class pylith::fekernels::PerfectlyMatchedLayer {
+public:
+
+    /** g0 function for damping term in perfectly matched layer region.
+     *
+     * g0_v(x) = -\rho \sigma_i v_i (no summation over i)
+     */
+    static inline
+    void g0v(const PylithInt dim,
+             const PylithInt numS,
+             const PylithInt numA,
+             const PylithInt sOff[],
+             const PylithInt sOff_x[],
+             const PylithScalar s[],
+             const PylithScalar s_t[],
+             const PylithScalar s_x[],
+             const PylithInt aOff[],
+             const PylithInt aOff_x[],
+             const PylithScalar a[],
+             const PylithScalar a_t[],
+             const PylithScalar a_x[],
+             const PylithReal t,
+             const PylithReal x[],
+             const PylithInt numConstants,
+             const PylithScalar constants[],
+             PylithScalar g0[]) {
+        assert(2 == dim || 3 == dim);
+
+        const PylithInt _numA = 2;
+        assert(_numA == numA);
+        assert(aOff);
+        assert(a);
+        const PylithInt i_density = aOff[0];
+        const PylithInt i_damping = aOff[1];
+
+        const PylithInt _numS = 2;
+        assert(sOff);
+        assert(s);
+        assert(numS >= _numS);
+        const PylithInt i_vel = sOff[1];
+
+        const PylithKernelScalar density = a[i_density];
+
+        for (PylithInt i = 0; i < dim; ++i) {
+            const PylithKernelScalar damping = a[i_damping+i];
+            g0[i] -= density * damping * PylithKernelScalar(s[i_vel+i]);
+        } // for
+    } // g0v
+
+}; // PerfectlyMatchedLayer
+
+#endif // pylith_fekernels_perfectlymatchedlayer_hh
+
+// End of file
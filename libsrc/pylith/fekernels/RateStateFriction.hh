@@ -0,0 +1,361 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/RateStateFriction.hh
+ *
+ * Kernels for a fault surface governed by rate- and state-dependent friction with the ageing law.
+ *
+ * Solution fields: [disp(dim), vel(dim), lagrange(dim)]
+ *
+ * Auxiliary fields: [slip_rate(dim), state_variable(1),
+ *                    reference_friction_coefficient(1), reference_slip_rate(1),
+ *                    characteristic_slip_distance(1), constitutive_parameter_a(1),
+ *                    constitutive_parameter_b(1), cohesion(1)]
+ *
+ * We use the regularized form of the friction coefficient,
+ *
+ *   mu(V, theta) = a asinh[ V/(2 V0) exp( (f0 + b ln(V0 theta / L)) / a ) ],
+ *
+ * which is well-behaved as V -> 0, and the ageing law for the state variable,
+ *
+ *   dtheta/dt = 1 - V theta / L.
+ *
+ * The Lagrange multiplier is the traction on the fault surface, so the friction constraint
+ * replaces the prescribed-slip constraint of the kinematic fault: the tangential components of
+ * the multiplier must equal the frictional traction for the current slip rate and state, and the
+ * normal component of the velocity jump must vanish (no interpenetration).
+ *
+ * The state-variable update is batched: FaultCohesiveDyn gathers the slip rate and state for all
+ * fault points into contiguous arrays and integrates the ageing law with the closed-form
+ * exponential update in a single vectorizable loop, instead of the per-vertex virtual dispatch
+ * of the former friction subsystem.
+ */
+
+#if !defined(pylith_fekernels_ratestatefriction_hh)
+#define pylith_fekernels_ratestatefriction_hh
+
+// Include directives ---------------------------------------------------
+#include "fekernelsfwd.hh" // forward declarations
+
+#include "pylith/fekernels/BoundaryDirections.hh" // USES BoundaryDirections
+
+#include "pylith/utils/types.hh"
+
+#include <algorithm> // USES std::max()
+#include <cassert> // USES assert()
+#include <cmath> // USES std::exp(), std::asinh(), std::sqrt()
+
+#if !defined(PYLITH_BATCHED_SIMD)
+#if defined(_OPENMP)
+#define PYLITH_BATCHED_SIMD _Pragma("omp simd")
+#else
+#define PYLITH_BATCHED_SIMD
+#endif
+#endif
+
+class pylith::fekernels::RateStateFriction {
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Block of fault points with slip rate, state, and friction parameters in contiguous arrays.
+    struct Batch {
+        PylithInt numPoints; ///< Number of fault points in block.
+        const PylithScalar* slipRate; ///< Slip rate magnitude [numPoints].
+        const PylithScalar* state; ///< State variable [numPoints].
+        const PylithScalar* refCoefficient; ///< Reference friction coefficient [numPoints].
+        const PylithScalar* refSlipRate; ///< Reference slip rate [numPoints].
+        const PylithScalar* charDistance; ///< Characteristic slip distance [numPoints].
+        const PylithScalar* parameterA; ///< Constitutive parameter a [numPoints].
+        const PylithScalar* parameterB; ///< Constitutive parameter b [numPoints].
+
+        Batch(void) :
+            numPoints(0),
+            slipRate(NULL),
+            state(NULL),
+            refCoefficient(NULL),
+            refSlipRate(NULL),
+            charDistance(NULL),
+            parameterA(NULL),
+            parameterB(NULL) {}
+
+
+    }; // Batch
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    // --------------------------------------------------------------------------------------------
+    /** Compute regularized rate-state friction coefficient for a single point.
+     *
+     * @param[in] slipRate Slip rate magnitude.
+     * @param[in] state State variable.
+     * @param[in] refCoefficient Reference friction coefficient.
+     * @param[in] refSlipRate Reference slip rate.
+     * @param[in] charDistance Characteristic slip distance.
+     * @param[in] parameterA Constitutive parameter a.
+     * @param[in] parameterB Constitutive parameter b.
+     * @returns Friction coefficient.
+     */
+    static inline
+    PylithScalar frictionCoefficient(const PylithScalar slipRate,
+                                     const PylithScalar state,
+                                     const PylithScalar refCoefficient,
+                                     const PylithScalar refSlipRate,
+                                     const PylithScalar charDistance,
+                                     const PylithScalar parameterA,
+                                     const PylithScalar parameterB) {
+        assert(refSlipRate > 0.0);
+        assert(charDistance > 0.0);
+        assert(parameterA > 0.0);
+        assert(state > 0.0);
+
+        const PylithScalar expTerm = std::exp((refCoefficient + parameterB * std::log(refSlipRate*state/charDistance)) / parameterA);
+        return parameterA * std::asinh(0.5 * slipRate/refSlipRate * expTerm);
+    } // frictionCoefficient
+
+    // --------------------------------------------------------------------------------------------
+    /** Integrate ageing law over one time step for a single point.
+     *
+     * Uses the closed-form exponential update for dtheta/dt = 1 - V theta / L with V constant
+     * over the step, which is unconditionally stable.
+     *
+     * @param[in] state State variable at beginning of time step.
+     * @param[in] slipRate Slip rate magnitude.
+     * @param[in] charDistance Characteristic slip distance.
+     * @param[in] dt Time step.
+     * @returns State variable at end of time step.
+     */
+    static inline
+    PylithScalar stateAgeing(const PylithScalar state,
+                             const PylithScalar slipRate,
+                             const PylithScalar charDistance,
+                             const PylithScalar dt) {
+        assert(charDistance > 0.0);
+
+        const PylithScalar vDtL = slipRate * dt / charDistance;
+        if (vDtL > 1.0e-20) {
+            const PylithScalar steadyState = charDistance / slipRate;
+            return steadyState + (state - steadyState) * std::exp(-vDtL);
+        } // if
+        return state + dt; // Locked patch; state grows linearly with time.
+    } // stateAgeing
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched friction coefficient for a block of fault points.
+     *
+     * @param[in] batch Block of fault points.
+     * @param[out] coefficient Friction coefficient [numPoints].
+     */
+    static inline
+    void frictionCoefficientBatched(const Batch& batch,
+                                    PylithScalar* coefficient) {
+        assert(batch.slipRate);
+        assert(batch.state);
+        assert(batch.refCoefficient);
+        assert(batch.refSlipRate);
+        assert(batch.charDistance);
+        assert(batch.parameterA);
+        assert(batch.parameterB);
+        assert(coefficient);
+
+        const PylithInt numPoints = batch.numPoints;
+        PYLITH_BATCHED_SIMD
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            const PylithScalar expTerm =
+                std::exp((batch.refCoefficient[p] + batch.parameterB[p] * std::log(batch.refSlipRate[p]*batch.state[p]/batch.charDistance[p])) / batch.parameterA[p]);
+            coefficient[p] = batch.parameterA[p] * std::asinh(0.5 * batch.slipRate[p]/batch.refSlipRate[p] * expTerm);
+        } // for
+    } // frictionCoefficientBatched
+
+    // --------------------------------------------------------------------------------------------
+    /** Batched ageing-law update for a block of fault points.
+     *
+     * @param[in] batch Block of fault points (slipRate and charDistance used).
+     * @param[in] dt Time step.
+     * @param[inout] state State variable [numPoints], updated in place.
+     */
+    static inline
+    void stateAgeingBatched(const Batch& batch,
+                            const PylithScalar dt,
+                            PylithScalar* state) {
+        assert(batch.slipRate);
+        assert(batch.charDistance);
+        assert(state);
+
+        const PylithInt numPoints = batch.numPoints;
+        PYLITH_BATCHED_SIMD
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            const PylithScalar vDtL = batch.slipRate[p] * dt / batch.charDistance[p];
+            const PylithScalar steadyState = (vDtL > 1.0e-20) ? batch.charDistance[p] / batch.slipRate[p] : 0.0;
+            state[p] = (vDtL > 1.0e-20) ?
+                       steadyState + (state[p] - steadyState) * std::exp(-vDtL) :
+                       state[p] + dt;
+        } // for
+    } // stateAgeingBatched
+
+    // --------------------------------------------------------------------------------------------
+    /** f0 function for friction constraint equation.
+     *
+     * The tangential components of the Lagrange multiplier (fault traction) must equal the
+     * frictional traction for the current slip rate and state; the normal component of the
+     * velocity jump must vanish.
+     *
+     * Solution fields: [disp(dim), vel(dim), lagrange(dim)]
+     */
+    static inline
+    void f0l_ratestate(const PylithInt dim,
+                       const PylithInt numS,
+                       const PylithInt numA,
+                       const PylithInt sOff[],
+                       const PylithInt sOff_x[],
+                       const PylithScalar s[],
+                       const PylithScalar s_t[],
+                       const PylithScalar s_x[],
+                       const PylithInt aOff[],
+                       const PylithInt aOff_x[],
+                       const PylithScalar a[],
+                       const PylithScalar a_t[],
+                       const PylithScalar a_x[],
+                       const PylithReal t,
+                       const PylithScalar x[],
+                       const PylithReal n[],
+                       const PylithInt numConstants,
+                       const PylithScalar constants[],
+                       PylithScalar f0[]) {
+        assert(sOff);
+        assert(aOff);
+        assert(s);
+        assert(a);
+        assert(f0);
+
+        assert(numS >= 3);
+        assert(numA >= 8);
+
+        const PylithInt spaceDim = dim + 1; // :KLUDGE: dim passed in is spaceDim-1
+        const PylithInt i_vel = 1;
+
+        // Auxiliary field layout; slip_rate is updated at the beginning of the time step.
+        const PylithInt i_state = 1;
+        const PylithInt i_refCoefficient = 2;
+        const PylithInt i_refSlipRate = 3;
+        const PylithInt i_charDistance = 4;
+        const PylithInt i_parameterA = 5;
+        const PylithInt i_parameterB = 6;
+        const PylithInt i_cohesion = 7;
+
+        const PylithScalar state = a[aOff[i_state]];
+        const PylithScalar refCoefficient = a[aOff[i_refCoefficient]];
+        const PylithScalar refSlipRate = a[aOff[i_refSlipRate]];
+        const PylithScalar charDistance = a[aOff[i_charDistance]];
+        const PylithScalar parameterA = a[aOff[i_parameterA]];
+        const PylithScalar parameterB = a[aOff[i_parameterB]];
+        const PylithScalar cohesion = a[aOff[i_cohesion]];
+
+        const PylithInt sOffVelN = sOff[i_vel];
+        const PylithInt sOffVelP = sOffVelN + spaceDim;
+        const PylithInt sOffLagrange = sOff[numS-1];
+
+        const PylithScalar* velN = &s[sOffVelN];
+        const PylithScalar* velP = &s[sOffVelP];
+        const PylithScalar* lagrange = &s[sOffLagrange];
+
+        switch (spaceDim) {
+        case 2: {
+            const PylithInt _spaceDim = 2;
+            const PylithScalar tanDir[2] = { -n[1], n[0] };
+
+            PylithScalar slipRateVel = 0.0;
+            PylithScalar slipRateNormal = 0.0;
+            PylithScalar tractionNormal = 0.0;
+            PylithScalar tractionShear = 0.0;
+            for (PylithInt i = 0; i < _spaceDim; ++i) {
+                slipRateVel += tanDir[i] * (velP[i] - velN[i]);
+                slipRateNormal += n[i] * (velP[i] - velN[i]);
+                tractionNormal += n[i] * lagrange[i];
+                tractionShear += tanDir[i] * lagrange[i];
+            } // for
+            const PylithScalar slipRateMag = std::abs(slipRateVel);
+            const PylithScalar coefficient = frictionCoefficient(slipRateMag, state, refCoefficient, refSlipRate,
+                                                                 charDistance, parameterA, parameterB);
+            // Fault strength; compression is negative normal traction.
+            const PylithScalar strength = cohesion + coefficient * std::max(0.0, -tractionNormal);
+            const PylithScalar slipDir = (slipRateVel >= 0.0) ? 1.0 : -1.0;
+
+            for (PylithInt i = 0; i < _spaceDim; ++i) {
+                f0[i] += n[i] * slipRateNormal + tanDir[i] * (tractionShear + slipDir * strength);
+            } // for
+            break;
+        } // case 2
+        case 3: {
+            const PylithInt _spaceDim = 3;
+            assert(numConstants >= 6);
+            const PylithScalar* refDir1 = &constants[0];
+            const PylithScalar* refDir2 = &constants[3];
+            PylithScalar tanDir1[3], tanDir2[3];
+            pylith::fekernels::BoundaryDirections::tangential_directions(tanDir1, tanDir2, refDir1, refDir2, n);
+
+            PylithScalar slipRateVel1 = 0.0;
+            PylithScalar slipRateVel2 = 0.0;
+            PylithScalar slipRateNormal = 0.0;
+            PylithScalar tractionNormal = 0.0;
+            PylithScalar tractionShear1 = 0.0;
+            PylithScalar tractionShear2 = 0.0;
+            for (PylithInt i = 0; i < _spaceDim; ++i) {
+                slipRateVel1 += tanDir1[i] * (velP[i] - velN[i]);
+                slipRateVel2 += tanDir2[i] * (velP[i] - velN[i]);
+                slipRateNormal += n[i] * (velP[i] - velN[i]);
+                tractionNormal += n[i] * lagrange[i];
+                tractionShear1 += tanDir1[i] * lagrange[i];
+                tractionShear2 += tanDir2[i] * lagrange[i];
+            } // for
+            const PylithScalar slipRateMag = std::sqrt(slipRateVel1*slipRateVel1 + slipRateVel2*slipRateVel2);
+            const PylithScalar coefficient = frictionCoefficient(slipRateMag, state, refCoefficient, refSlipRate,
+                                                                 charDistance, parameterA, parameterB);
+            const PylithScalar strength = cohesion + coefficient * std::max(0.0, -tractionNormal);
+
+            // Frictional traction opposes slip; for vanishing slip rate the direction is taken
+            // from the current shear traction so sticking is enforced consistently.
+            PylithScalar dir1 = 0.0, dir2 = 0.0;
+            if (slipRateMag > 0.0) {
+                dir1 = slipRateVel1 / slipRateMag;
+                dir2 = slipRateVel2 / slipRateMag;
+            } else {
+                const PylithScalar shearMag = std::sqrt(tractionShear1*tractionShear1 + tractionShear2*tractionShear2);
+                if (shearMag > 0.0) {
+                    dir1 = -tractionShear1 / shearMag;
+                    dir2 = -tractionShear2 / shearMag;
+                } // if
+            } // if/else
+
+            for (PylithInt i = 0; i < _spaceDim; ++i) {
+                f0[i] += n[i] * slipRateNormal
+                         + tanDir1[i] * (tractionShear1 + dir1 * strength)
+                         + tanDir2[i] * (tractionShear2 + dir2 * strength);
+            } // for
+            break;
+        } // case 3
+        default:
+            assert(0);
+        } // switch
+    } // f0l_ratestate
+
+}; // RateStateFriction
+
+#endif // pylith_fekernels_ratestatefriction_hh
+
+/* End of file */
@@ -0,0 +1,332 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/fekernels/benchmark_fekernels.cc
+ *
+ * Microbenchmark driver for pointwise finite-element kernels.
+ *
+ * Drives representative residual kernels (isotropic linear elasticity,
+ * generalized Maxwell viscoelasticity, power-law viscoelasticity, and the
+ * fault cohesive kinematic slip constraint) over synthetic quadrature-point
+ * data with controlled working-set sizes and reports throughput (points/sec
+ * and GB/s) per kernel. The working-set sweep distinguishes cache-resident
+ * from memory-bound behavior so kernel-level regressions show up without
+ * running a full simulation.
+ *
+ * Usage: benchmark_fekernels [numPoints [numReps]]
+ *
+ * With no arguments, sweeps working sets of 4096, 65536, and 262144 points,
+ * scaling the repetition count to keep the total work roughly constant.
+ */
+
+#include <portinfo>
+
+#include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity3D
+#include "pylith/fekernels/IsotropicLinearGenMaxwell.hh" // USES IsotropicLinearGenMaxwell3D
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw3D
+#include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include "pylith/utils/types.hh" // USES PylithInt, PylithScalar
+
+#include <petsc.h> // USES PetscInitialize(), MPI_Wtime()
+
+#include <cstdio> // USES printf()
+#include <cstdlib> // USES atol()
+#include <iostream> // USES std::cerr
+#include <vector> // USES std::vector
+
+namespace pylith {
+    namespace fekernels {
+        class _BenchmarkFEKernels {
+public:
+
+            /// ISA PetscPointFunc (volume residual kernel).
+            typedef void (*residual_fn)(const PylithInt,
+                                        const PylithInt,
+                                        const PylithInt,
+                                        const PylithInt[],
+                                        const PylithInt[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithInt[],
+                                        const PylithInt[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithReal,
+                                        const PylithScalar[],
+                                        const PylithInt,
+                                        const PylithScalar[],
+                                        PylithScalar[]);
+
+            /// ISA PetscBdPointFunc (boundary/cohesive residual kernel with face normal).
+            typedef void (*bd_residual_fn)(const PylithInt,
+                                           const PylithInt,
+                                           const PylithInt,
+                                           const PylithInt[],
+                                           const PylithInt[],
+                                           const PylithScalar[],
+                                           const PylithScalar[],
+                                           const PylithScalar[],
+                                           const PylithInt[],
+                                           const PylithInt[],
+                                           const PylithScalar[],
+                                           const PylithScalar[],
+                                           const PylithScalar[],
+                                           const PylithReal,
+                                           const PylithScalar[],
+                                           const PylithReal[],
+                                           const PylithInt,
+                                           const PylithScalar[],
+                                           PylithScalar[]);
+
+            /// Description of one kernel benchmark case with its synthetic field layout.
+            struct KernelSpec {
+                const char* name; ///< Kernel name for report.
+                residual_fn kernel; ///< Volume kernel; NULL if boundary kernel.
+                bd_residual_fn bdKernel; ///< Boundary kernel; NULL if volume kernel.
+                PylithInt dim; ///< Spatial dimension argument passed to kernel.
+                PylithInt spaceDim; ///< Spatial dimension of coordinates.
+                PylithInt numS; ///< Number of solution subfields.
+                const PylithInt* sOff; ///< Solution subfield offsets [numS].
+                PylithInt sSize; ///< Number of solution scalars per point.
+                PylithInt sxSize; ///< Number of solution gradient scalars per point.
+                PylithInt numA; ///< Number of auxiliary subfields.
+                const PylithInt* aOff; ///< Auxiliary subfield offsets [numA].
+                PylithInt aSize; ///< Number of auxiliary scalars per point.
+                const PylithScalar* aValues; ///< Template auxiliary values [aSize].
+                PylithInt numConstants; ///< Number of kernel constants.
+                const PylithScalar* constants; ///< Kernel constants [numConstants].
+                PylithInt fSize; ///< Number of residual scalars per point.
+            };
+
+            /** Fill array with small pseudo-random perturbations.
+             *
+             * @param[out] values Array to fill.
+             * @param[in] size Number of values.
+             * @param[in] scale Magnitude of perturbations.
+             */
+            static void fillRandom(PylithScalar* values,
+                                   const size_t size,
+                                   const PylithScalar scale) {
+                static unsigned int state = 0x12345u;
+                for (size_t i = 0; i < size; ++i) {
+                    state = state*1664525u + 1013904223u;
+                    values[i] = scale * (PylithScalar((state >> 8) & 0xffffffu) / PylithScalar(0x1000000u) - 0.5);
+                } // for
+            } // fillRandom
+
+            /** Run one kernel over a synthetic working set and report throughput.
+             *
+             * @param[in] spec Kernel benchmark case.
+             * @param[in] numPoints Number of quadrature points in working set.
+             * @param[in] numReps Number of sweeps over the working set.
+             */
+            static void run(const KernelSpec& spec,
+                            const PylithInt numPoints,
+                            const PylithInt numReps) {
+                const PylithScalar strainScale = 1.0e-4;
+
+                std::vector<PylithScalar> s(numPoints*spec.sSize);
+                std::vector<PylithScalar> s_t(numPoints*spec.sSize, 0.0);
+                std::vector<PylithScalar> s_x(numPoints*spec.sxSize, 0.0);
+                std::vector<PylithScalar> a(numPoints*spec.aSize);
+                std::vector<PylithScalar> a_t(numPoints*spec.aSize, 0.0);
+                std::vector<PylithScalar> x(numPoints*spec.spaceDim, 0.0);
+                std::vector<PylithScalar> f(numPoints*spec.fSize, 0.0);
+
+                fillRandom(&s[0], s.size(), strainScale);
+                if (spec.sxSize > 0) {
+                    fillRandom(&s_x[0], s_x.size(), strainScale);
+                } // if
+                for (PylithInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+                    for (PylithInt i = 0; i < spec.aSize; ++i) {
+                        a[iPoint*spec.aSize+i] = spec.aValues[i];
+                    } // for
+                } // for
+
+                const PylithInt* sOff = spec.sOff;
+                const PylithInt* aOff = spec.aOff;
+                const PylithReal normal[3] = { 1.0, 0.0, 0.0 };
+                const PylithReal t = 0.0;
+
+                // Warm up the working set and instruction cache with a single sweep.
+                const PylithInt numSweeps = 1 + numReps;
+                volatile PylithScalar checksum = 0.0;
+                double elapsed = 0.0;
+                for (PylithInt iRep = 0; iRep < numSweeps; ++iRep) {
+                    const double tStart = MPI_Wtime();
+                    for (PylithInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+                        const PylithScalar* sP = &s[iPoint*spec.sSize];
+                        const PylithScalar* s_tP = &s_t[iPoint*spec.sSize];
+                        const PylithScalar* s_xP = &s_x[iPoint*spec.sxSize];
+                        const PylithScalar* aP = &a[iPoint*spec.aSize];
+                        const PylithScalar* a_tP = &a_t[iPoint*spec.aSize];
+                        const PylithScalar* xP = &x[iPoint*spec.spaceDim];
+                        PylithScalar* fP = &f[iPoint*spec.fSize];
+                        if (spec.kernel) {
+                            spec.kernel(spec.dim, spec.numS, spec.numA, sOff, sOff, sP, s_tP, s_xP,
+                                        aOff, aOff, aP, a_tP, NULL, t, xP,
+                                        spec.numConstants, spec.constants, fP);
+                        } else {
+                            spec.bdKernel(spec.dim, spec.numS, spec.numA, sOff, sOff, sP, s_tP, s_xP,
+                                          aOff, aOff, aP, a_tP, NULL, t, xP, normal,
+                                          spec.numConstants, spec.constants, fP);
+                        } // if/else
+                    } // for
+                    if (iRep > 0) { // Skip warm-up sweep in timing.
+                        elapsed += MPI_Wtime() - tStart;
+                    } // if
+                    checksum += f[0];
+                } // for
+
+                const double bytesPerPoint = double(spec.sSize + spec.sxSize + spec.aSize + spec.fSize) * sizeof(PylithScalar);
+                const double totalPoints = double(numPoints) * numReps;
+                const double pointsPerSec = (elapsed > 0.0) ? totalPoints / elapsed : 0.0;
+                const double gbPerSec = pointsPerSec * bytesPerPoint / 1.0e+9;
+
+                printf("%-44s %9d %6d %10.4f %10.2f %7.2f\n",
+                       spec.name, int(numPoints), int(numReps), elapsed, pointsPerSec/1.0e+6, gbPerSec);
+            } // run
+
+            /** Run all kernel cases for one working-set size.
+             *
+             * @param[in] numPoints Number of quadrature points in working set.
+             * @param[in] numReps Number of sweeps over the working set.
+             */
+            static void runAll(const PylithInt numPoints,
+                               const PylithInt numReps) {
+                // Isotropic linear elasticity, 3D.
+                // Auxiliary fields: [density(1), shear_modulus(1), bulk_modulus(1)]
+                static const PylithInt elasticitySOff[1] = { 0 };
+                static const PylithInt elasticityAOff[3] = { 0, 1, 2 };
+                static const PylithScalar elasticityAValues[3] = { 2500.0, 1.0, 1.6667 };
+                KernelSpec elasticity = {
+                    "IsotropicLinearElasticity3D::f1v",
+                    pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain, NULL,
+                    3, 3, 1, elasticitySOff, 3, 9,
+                    3, elasticityAOff, 3, elasticityAValues,
+                    0, NULL, 9,
+                };
+                run(elasticity, numPoints, numReps);
+
+                // Generalized Maxwell viscoelasticity, 3D, 3 Maxwell elements.
+                // Auxiliary fields: [density(1), shear_modulus(1), bulk_modulus(1), maxwell_time(3),
+                //                    shear_modulus_ratio(3), viscous_strain(18), total_strain(6)]
+                static const PylithInt genMaxwellSOff[1] = { 0 };
+                static const PylithInt genMaxwellAOff[7] = { 0, 1, 2, 3, 6, 9, 27 };
+                static PylithScalar genMaxwellAValues[33] = {
+                    2500.0, 1.0, 1.6667,
+                    1.0, 10.0, 100.0,
+                    0.25, 0.25, 0.25,
+                };
+                fillRandom(&genMaxwellAValues[9], 24, 1.0e-4);
+                static const PylithScalar genMaxwellConstants[1] = { 0.01 }; // dt
+                KernelSpec genMaxwell = {
+                    "IsotropicLinearGenMaxwell3D::f1v",
+                    pylith::fekernels::IsotropicLinearGenMaxwell3D::f1v_infinitesimalStrain, NULL,
+                    3, 3, 1, genMaxwellSOff, 3, 9,
+                    7, genMaxwellAOff, 33, genMaxwellAValues,
+                    1, genMaxwellConstants, 9,
+                };
+                run(genMaxwell, numPoints, numReps);
+
+                // Power-law viscoelasticity, 3D.
+                // Auxiliary fields: [density(1), shear_modulus(1), bulk_modulus(1),
+                //                    power_law_reference_strain_rate(1), power_law_reference_stress(1),
+                //                    power_law_exponent(1), viscous_strain(6), deviatoric_stress(6)]
+                static const PylithInt powerLawSOff[1] = { 0 };
+                static const PylithInt powerLawAOff[8] = { 0, 1, 2, 3, 4, 5, 6, 12 };
+                static PylithScalar powerLawAValues[18] = {
+                    2500.0, 1.0, 1.6667,
+                    1.0e-6, 1.0, 3.0,
+                };
+                fillRandom(&powerLawAValues[6], 12, 1.0e-4);
+                static const PylithScalar powerLawConstants[1] = { 0.01 }; // dt
+                KernelSpec powerLaw = {
+                    "IsotropicPowerLaw3D::f1v",
+                    pylith::fekernels::IsotropicPowerLaw3D::f1v_infinitesimalStrain, NULL,
+                    3, 3, 1, powerLawSOff, 3, 9,
+                    8, powerLawAOff, 18, powerLawAValues,
+                    1, powerLawConstants, 9,
+                };
+                run(powerLaw, numPoints, numReps);
+
+                // Fault cohesive kinematic slip constraint, 3D.
+                // Solution fields: [disp_neg(3) + disp_pos(3), lagrange(3)]
+                // Auxiliary fields: [slip(3)]; reference directions passed as kernel constants.
+                static const PylithInt faultSOff[2] = { 0, 6 };
+                static const PylithInt faultAOff[1] = { 0 };
+                static const PylithScalar faultAValues[3] = { 1.0e-2, 0.0, 0.0 };
+                static const PylithScalar faultConstants[6] = {
+                    0.0, 1.0, 0.0, // ref_dir_1
+                    0.0, 0.0, 1.0, // ref_dir_2
+                };
+                KernelSpec fault = {
+                    "FaultCohesiveKin::f0l_slip",
+                    NULL, pylith::fekernels::FaultCohesiveKin::f0l_slip,
+                    2, 3, 2, faultSOff, 9, 0, // dim passed in is spaceDim-1
+                    1, faultAOff, 3, faultAValues,
+                    6, faultConstants, 3,
+                };
+                run(fault, numPoints, numReps);
+            } // runAll
+
+        }; // _BenchmarkFEKernels
+    } // fekernels
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char** argv) {
+    typedef pylith::fekernels::_BenchmarkFEKernels _BenchmarkFEKernels;
+
+    try {
+        PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+
+        printf("%-44s %9s %6s %10s %10s %7s\n",
+               "kernel", "points", "reps", "time (s)", "Mpoints/s", "GB/s");
+
+        if (argc > 1) {
+            const PylithInt numPoints = atol(argv[1]);
+            const PylithInt numReps = (argc > 2) ? atol(argv[2]) : 64;
+            _BenchmarkFEKernels::runAll(numPoints, numReps);
+        } else {
+            // Sweep working sets from cache-resident to memory-bound, keeping total work constant.
+            const PylithInt workingSets[3] = { 4096, 65536, 262144 };
+            const PylithInt totalPoints = 8388608;
+            for (int i = 0; i < 3; ++i) {
+                _BenchmarkFEKernels::runAll(workingSets[i], totalPoints / workingSets[i]);
+            } // for
+        } // if/else
+
+        err = PetscFinalize();CHKERRQ(err);
+    } catch (const std::exception& err) {
+        std::cerr << err.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Unknown error occurred." << std::endl;
+        return 1;
+    } // try/catch
+
+    return 0;
+} // main
+
+// End of file
@@ -42,6 +42,10 @@ namespace pylith {
         class IsotropicLinearElasticity;
         class IsotropicLinearElasticityPlaneStrain;
         class IsotropicLinearElasticity3D;
+        class IsotropicLinearElasticityBatched;
+        class IsotropicLinearPoroelasticityBatched;
+        class IsotropicPowerLawBatched;
+        class ElasticityKernelRegistry;
 
         class IsotropicLinearMaxwell;
         class IsotropicLinearMaxwellPlaneStrain;
@@ -71,8 +75,10 @@ namespace pylith {
         class TimeDependentFn;
         class NeumannTimeDependent;
         class AbsorbingDampers;
+        class PerfectlyMatchedLayer;
 
         class FaultCohesiveKin;
+        class RateStateFriction;
 
         class BoundaryDirections;
     } // fekernels
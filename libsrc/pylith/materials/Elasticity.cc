@@ -28,6 +28,7 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field::SubfieldInfo
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/utils/PetscOptions.hh" // USES PetscOptions
 
@@ -35,6 +36,7 @@
 #include "pylith/fekernels/DispVel.hh" // USES DispVel kernels
 #include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin kernels
 
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
@@ -42,6 +44,8 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
 #include <typeinfo> // USES typeid()
 
 // ------------------------------------------------------------------------------------------------
@@ -53,6 +57,7 @@ typedef pylith::feassemble::Integrator::EquationPart EquationPart;
 // ------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::materials::Elasticity::Elasticity(void) :
+    _interfaceContrastThreshold(0.0),
     _useBodyForce(false),
     _rheology(NULL),
     _derivedFactory(new pylith::materials::DerivedFactoryElasticity) {
@@ -96,6 +101,16 @@ pylith::materials::Elasticity::useBodyForce(void) const {
 } // useBodyForce
 
 
+// ------------------------------------------------------------------------------------------------
+// Set within-cell contrast in elastic moduli that marks a material interface cell.
+void
+pylith::materials::Elasticity::setInterfaceContrastThreshold(const double value) {
+    PYLITH_COMPONENT_DEBUG("setInterfaceContrastThreshold(value="<<value<<")");
+
+    _interfaceContrastThreshold = value;
+} // setInterfaceContrastThreshold
+
+
 // ------------------------------------------------------------------------------------------------
 // Set bulk rheology.
 void
@@ -112,6 +127,15 @@ pylith::materials::Elasticity::getBulkRheology(void) const {
 } // getBulkRheology
 
 
+// ------------------------------------------------------------------------------------------------
+// Determine if the material response is linear in the solution.
+bool
+pylith::materials::Elasticity::isLinear(void) const {
+    assert(_rheology);
+    return _rheology->isLinear();
+} // isLinear
+
+
 // ------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -152,12 +176,15 @@ pylith::materials::Elasticity::createIntegrator(const pylith::topology::Field& s
     pylith::feassemble::IntegratorDomain* integrator = new pylith::feassemble::IntegratorDomain(this);assert(integrator);
     integrator->setLabelName(getLabelName());
     integrator->setLabelValue(getLabelValue());
+    integrator->setIncrementalStateVarsUpdate(_stateVarsUpdateThreshold, _stateVarsRefreshInterval);
 
     _setKernelsResidual(integrator, solution);
     _setKernelsJacobian(integrator, solution);
     _setKernelsUpdateStateVars(integrator, solution);
     _setKernelsDerivedField(integrator, solution);
 
+    _integrationDomain = integrator; // Borrowed reference for state exchange.
+
     PYLITH_METHOD_RETURN(integrator);
 } // createIntegrator
 
@@ -203,8 +230,15 @@ pylith::materials::Elasticity::createAuxiliaryField(const pylith::topology::Fiel
     auxiliaryField->createOutputVector();
 
     assert(auxiliaryFactory);
+    auxiliaryFactory->setQueryResolution(_dbQueryResolution);
     auxiliaryFactory->setValuesFromDB();
 
+    if (_interfaceContrastThreshold > 1.0) {
+        _homogenizeInterfaceCells(auxiliaryField);
+    } // if
+
+    _rheology->detectConstantCoefficients(*auxiliaryField);
+
     PYLITH_METHOD_RETURN(auxiliaryField);
 } // createAuxiliaryField
 
@@ -414,6 +448,155 @@ pylith::materials::Elasticity::_getDerivedFactory(void) {
 } // _getDerivedFactory
 
 
+// ------------------------------------------------------------------------------------------------
+// Replace elastic moduli in high-contrast cells with the within-cell harmonic mean.
+void
+pylith::materials::Elasticity::_homogenizeInterfaceCells(pylith::topology::Field* auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_homogenizeInterfaceCells(auxiliaryField="<<auxiliaryField<<")");
+
+    assert(auxiliaryField);
+    assert(_interfaceContrastThreshold > 1.0);
+
+    // Elastic moduli entering the stress kernels; density and other subfields are left unchanged.
+    const size_t numModuliSubfields = 2;
+    const char* moduliSubfields[numModuliSubfields] = { "shear_modulus", "bulk_modulus" };
+    PetscInt subfieldIndices[numModuliSubfields];
+    size_t numSubfields = 0;
+    for (size_t i = 0; i < numModuliSubfields; ++i) {
+        if (auxiliaryField->hasSubfield(moduliSubfields[i])) {
+            subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo(moduliSubfields[i]).index;
+        } // if
+    } // for
+    if (!numSubfields) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode err = 0;
+    PetscDM dmAux = auxiliaryField->getDM();
+
+    // Accumulate harmonic means of flagged cells in scratch vectors so that points shared by
+    // several flagged cells get the average of the cell values (same pattern as the cached
+    // fault directions); points not touched by any flagged cell keep their queried values.
+    PetscVec sumVec = NULL;
+    PetscVec countVec = NULL;
+    err = VecDuplicate(auxiliaryField->getLocalVector(), &sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(auxiliaryField->getLocalVector(), &countVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(sumVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecSet(countVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    size_t numInterfaceCells = 0;
+    { // Flag high-contrast cells and accumulate their harmonic means.
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField);
+        PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+        PylithScalar* sumArray = NULL;
+        PylithScalar* countArray = NULL;
+        err = VecGetArray(sumVec, &sumArray);PYLITH_CHECK_ERROR(err);
+        err = VecGetArray(countVec, &countArray);PYLITH_CHECK_ERROR(err);
+
+        PetscInt cStart = 0, cEnd = 0;
+        err = DMPlexGetHeightStratum(dmAux, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscInt* closure = NULL;
+            PetscInt closureSize = 0;
+            err = DMPlexGetTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            bool isInterfaceCell = false;
+            for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+                const PetscInt subfieldIndex = subfieldIndices[iSubfield];
+
+                PylithScalar valueMin = PYLITH_MAXSCALAR;
+                PylithScalar valueMax = 0.0;
+                PylithScalar harmonicSum = 0.0;
+                PetscInt numPoints = 0;
+                for (PetscInt p = 0; p < closureSize*2; p += 2) {
+                    const PetscInt point = closure[p];
+                    if (!auxiliaryVisitor.sectionSubfieldDof(subfieldIndex, point)) { continue; }
+                    const PetscInt off = auxiliaryVisitor.sectionSubfieldOffset(subfieldIndex, point);
+                    const PylithScalar value = auxiliaryArray[off];
+                    valueMin = std::min(valueMin, value);
+                    valueMax = std::max(valueMax, value);
+                    if (value > 0.0) {
+                        harmonicSum += 1.0 / value;
+                    } // if
+                    ++numPoints;
+                } // for
+                if ((numPoints < 2) || (valueMin <= 0.0) ||
+                    (valueMax < _interfaceContrastThreshold * valueMin)) { continue; }
+                isInterfaceCell = true;
+
+                const PylithScalar harmonicMean = numPoints / harmonicSum;
+                for (PetscInt p = 0; p < closureSize*2; p += 2) {
+                    const PetscInt point = closure[p];
+                    if (!auxiliaryVisitor.sectionSubfieldDof(subfieldIndex, point)) { continue; }
+                    const PetscInt off = auxiliaryVisitor.sectionSubfieldOffset(subfieldIndex, point);
+                    sumArray[off] += harmonicMean;
+                    countArray[off] += 1.0;
+                } // for
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            if (isInterfaceCell) {
+                ++numInterfaceCells;
+            } // if
+        } // for
+
+        err = VecRestoreArray(sumVec, &sumArray);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArray(countVec, &countArray);PYLITH_CHECK_ERROR(err);
+    } // Flag and accumulate
+
+    // Combine contributions from cells on other processes so that points shared across processes
+    // have consistent values.
+    PetscVec globalVec = NULL;
+    err = DMGetGlobalVector(dmAux, &globalVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(globalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmAux, sumVec, ADD_VALUES, globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmAux, sumVec, ADD_VALUES, globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmAux, globalVec, INSERT_VALUES, sumVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmAux, globalVec, INSERT_VALUES, sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(globalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmAux, countVec, ADD_VALUES, globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmAux, countVec, ADD_VALUES, globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmAux, globalVec, INSERT_VALUES, countVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmAux, globalVec, INSERT_VALUES, countVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreGlobalVector(dmAux, &globalVec);PYLITH_CHECK_ERROR(err);
+
+    { // Replace values at points touched by at least one flagged cell.
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField);
+        PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+        const PylithScalar* sumArray = NULL;
+        const PylithScalar* countArray = NULL;
+        err = VecGetArrayRead(sumVec, &sumArray);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(countVec, &countArray);PYLITH_CHECK_ERROR(err);
+
+        PetscInt pStart = 0, pEnd = 0;
+        err = PetscSectionGetChart(auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+                const PetscInt subfieldIndex = subfieldIndices[iSubfield];
+                if (!auxiliaryVisitor.sectionSubfieldDof(subfieldIndex, point)) { continue; }
+                const PetscInt off = auxiliaryVisitor.sectionSubfieldOffset(subfieldIndex, point);
+                if (countArray[off] > 0.0) {
+                    auxiliaryArray[off] = sumArray[off] / countArray[off];
+                } // if
+            } // for
+        } // for
+
+        err = VecRestoreArrayRead(sumVec, &sumArray);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArrayRead(countVec, &countArray);PYLITH_CHECK_ERROR(err);
+    } // Replace
+
+    err = VecDestroy(&sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&countVec);PYLITH_CHECK_ERROR(err);
+
+    if (numInterfaceCells > 0) {
+        PYLITH_COMPONENT_INFO("Replaced elastic moduli in "<<numInterfaceCells<<" high-contrast cells "
+                                                           <<"on this process with within-cell harmonic means (contrast threshold "
+                                                           <<_interfaceContrastThreshold<<").");
+    } // if
+
+    PYLITH_METHOD_END;
+} // _homogenizeInterfaceCells
+
+
 // ------------------------------------------------------------------------------------------------
 // Set kernels for residual.
 void
@@ -463,8 +646,10 @@ pylith::materials::Elasticity::_setKernelsResidual(pylith::feassemble::Integrato
         const PetscPointFunc g0u = pylith::fekernels::DispVel::g0u;
         const PetscPointFunc g1u = NULL;
 
-        // Velocity
-        const PetscPointFunc f0v = pylith::fekernels::Elasticity::f0v;
+        // Velocity; select kernel specialized for spatial dimension so component loops unroll.
+        const PetscPointFunc f0v = (3 == coordsys->getSpaceDim()) ?
+                                   pylith::fekernels::Elasticity::f0v_dim<3> :
+                                   pylith::fekernels::Elasticity::f0v_dim<2>;
         const PetscPointFunc f1v = NULL;
         const PetscPointFunc g0v = r0;
         const PetscPointFunc g1v = r1;
@@ -506,6 +691,17 @@ pylith::materials::Elasticity::_setKernelsResidual(pylith::feassemble::Integrato
     assert(integrator);
     integrator->setKernelsResidual(kernels, solution);
 
+    // Register any semantically equivalent stress kernel offered by the rheology as a variant
+    // for measurement-based selection (autotuning) at initialization.
+    const PetscPointFunc r1Alt = _rheology->getKernelf1vAlternate(coordsys);
+    if (r1Alt) {
+        std::vector<ResidualKernels> kernelsAlt(kernels);
+        for (size_t i = 0; i < kernelsAlt.size(); ++i) {
+            if (kernelsAlt[i].r1 == r1) { kernelsAlt[i].r1 = r1Alt; }
+        } // for
+        integrator->addKernelsResidualVariant("field_moduli", kernelsAlt);
+    } // if
+
     PYLITH_METHOD_END;
 } // _setKernelsResidual
 
@@ -550,7 +746,9 @@ pylith::materials::Elasticity::_setKernelsJacobian(pylith::feassemble::Integrato
         const PetscPointJac Jf2uu = NULL;
         const PetscPointJac Jf3uu = NULL;
 
-        const PetscPointJac Jf0vv = pylith::fekernels::Elasticity::Jf0vv;
+        const PetscPointJac Jf0vv = (3 == coordsys->getSpaceDim()) ?
+                                    pylith::fekernels::Elasticity::Jf0vv_dim<3> :
+                                    pylith::fekernels::Elasticity::Jf0vv_dim<2>;
         const PetscPointJac Jf1vv = NULL;
         const PetscPointJac Jf2vv = NULL;
         const PetscPointJac Jf3vv = NULL;
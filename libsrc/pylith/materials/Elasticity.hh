@@ -55,6 +55,19 @@ public:
      */
     bool useBodyForce(void) const;
 
+    /** Set within-cell contrast in elastic moduli that marks a material interface cell.
+     *
+     * After the auxiliary field is populated from the spatial databases, cells in which
+     * the ratio of the maximum to minimum value of an elastic modulus subfield exceeds
+     * the threshold (e.g., cells straddling a sediment/basement contact after querying a
+     * gridded database) have the modulus values replaced by the within-cell harmonic
+     * mean, the effective series coefficient across an interface. This targets the cells
+     * that otherwise degrade convergence without refining the whole mesh.
+     *
+     * @param[in] value Contrast ratio above which a cell is treated as an interface cell (<= 1 disables).
+     */
+    void setInterfaceContrastThreshold(const double value);
+
     /** Set bulk rheology.
      *
      * @param[in] rheology Bulk rheology for elasticity.
@@ -67,6 +80,12 @@ public:
      */
     pylith::materials::RheologyElasticity* getBulkRheology(void) const;
 
+    /** Determine if the material response is linear in the solution.
+     *
+     * @returns True if the bulk rheology is linear in the solution.
+     */
+    bool isLinear(void) const;
+
     /** Verify configuration is acceptable.
      *
      * @param[in] solution Solution field.
@@ -184,9 +203,16 @@ private:
     void _setKernelsDerivedField(pylith::feassemble::IntegratorDomain* integrator,
                                  const pylith::topology::Field& solution) const;
 
+    /** Replace elastic moduli in high-contrast cells with the within-cell harmonic mean.
+     *
+     * @param[inout] auxiliaryField Auxiliary field populated from the spatial databases.
+     */
+    void _homogenizeInterfaceCells(pylith::topology::Field* auxiliaryField) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
+    double _interfaceContrastThreshold; ///< Within-cell moduli contrast marking an interface cell (<= 1 disables).
     bool _useBodyForce; ///< Flag to include body force term.
     pylith::materials::RheologyElasticity* _rheology; ///< Bulk rheology for elasticity.
     pylith::materials::DerivedFactoryElasticity* _derivedFactory; ///< Factory for creating derived fields.
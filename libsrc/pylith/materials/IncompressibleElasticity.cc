@@ -146,6 +146,8 @@ pylith::materials::IncompressibleElasticity::createIntegrator(const pylith::topo
     // No state variables.
     _setKernelsDerivedField(integrator, solution);
 
+    _integrationDomain = integrator; // Borrowed reference for state exchange.
+
     PYLITH_METHOD_RETURN(integrator);
 } // createIntegrator
 
@@ -191,6 +193,7 @@ pylith::materials::IncompressibleElasticity::createAuxiliaryField(const pylith::
     auxiliaryField->createOutputVector();
 
     assert(auxiliaryFactory);
+    auxiliaryFactory->setQueryResolution(_dbQueryResolution);
     auxiliaryFactory->setValuesFromDB();
 
     PYLITH_METHOD_RETURN(auxiliaryField);
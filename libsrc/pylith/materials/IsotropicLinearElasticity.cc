@@ -22,10 +22,12 @@
 
 #include "pylith/materials/AuxiliaryFactoryElastic.hh" // USES AuxiliaryFactoryElastic
 #include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity kernels
+#include "pylith/topology/Field.hh" // USES Field
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 
 #include <typeinfo> // USES typeid()
 
@@ -33,8 +35,15 @@
 // Default constructor.
 pylith::materials::IsotropicLinearElasticity::IsotropicLinearElasticity(void) :
     _auxiliaryFactory(new pylith::materials::AuxiliaryFactoryElastic),
-    _useReferenceState(false) {
+    _constantShearModulus(0.0),
+    _constantBulkModulus(0.0),
+    _useReferenceState(false),
+    _useConstantModuli(false),
+    _useConstantRefState(false) {
     pylith::utils::PyreComponent::setName("isotropiclinearelasticity");
+    for (size_t i = 0; i < 6; ++i) {
+        _constantRefContribution[i] = 0.0;
+    } // for
 } // constructor
 
 
@@ -112,7 +121,14 @@ pylith::materials::IsotropicLinearElasticity::getKernelf1v(const spatialdata::ge
     PYLITH_COMPONENT_DEBUG("getKernelResidualStress(coordsys="<<typeid(coordsys).name()<<")");
 
     const int spaceDim = coordsys->getSpaceDim();
+    const bool uniformCoefficients = _hasUniformModuli();
+    const bool constModuli = !_useReferenceState && uniformCoefficients;
+    const bool constRefState = _useReferenceState && uniformCoefficients;
     PetscPointFunc f1v =
+        (constModuli && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain_constModuli :
+        (constModuli && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain_constModuli :
+        (constRefState && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain_constRefState :
+        (constRefState && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain_constRefState :
         (!_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain :
         (!_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain :
         (_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain_refState :
@@ -123,6 +139,26 @@ pylith::materials::IsotropicLinearElasticity::getKernelf1v(const spatialdata::ge
 } // getKernelf1v
 
 
+// ------------------------------------------------------------------------------------------------
+// Get alternate stress kernel for RHS residual, G(t,s), for autotuning.
+PetscPointFunc
+pylith::materials::IsotropicLinearElasticity::getKernelf1vAlternate(const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("getKernelf1vAlternate(coordsys="<<typeid(coordsys).name()<<")");
+
+    // The general kernel reloads the moduli from the auxiliary field at every quadrature point;
+    // it is interchangeable with the constant-moduli kernel only when the moduli are uniform.
+    const int spaceDim = coordsys->getSpaceDim();
+    const bool constModuli = !_useReferenceState && _hasUniformModuli();
+    PetscPointFunc f1v =
+        (constModuli && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain :
+        (constModuli && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain :
+        NULL;
+
+    PYLITH_METHOD_RETURN(f1v);
+} // getKernelf1vAlternate
+
+
 // ------------------------------------------------------------------------------------------------
 // Get elastic constants kernel for LHS Jacobian F(t,s,\dot{s}).
 PetscPointJac
@@ -131,7 +167,11 @@ pylith::materials::IsotropicLinearElasticity::getKernelJf3vu(const spatialdata::
     PYLITH_COMPONENT_DEBUG("getKernelJacobianElasticConstants(coordsys="<<typeid(coordsys).name()<<")");
 
     const int spaceDim = coordsys->getSpaceDim();
+    // The reference state does not enter the Jacobian, so uniform moduli suffice.
+    const bool constModuli = _hasUniformModuli();
     PetscPointJac Jf3vu =
+        (constModuli && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::Jf3vu_infinitesimalStrain_constModuli :
+        (constModuli && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::Jf3vu_infinitesimalStrain_constModuli :
         (3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::Jf3vu_infinitesimalStrain :
         (2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::Jf3vu_infinitesimalStrain :
         NULL;
@@ -197,4 +237,134 @@ pylith::materials::IsotropicLinearElasticity::getKernelCauchyStressVector(const
 } // getKernelDerivedCauchyStress
 
 
+// ------------------------------------------------------------------------------------------------
+// Update kernel constants.
+void
+pylith::materials::IsotropicLinearElasticity::updateKernelConstants(pylith::real_array* kernelConstants,
+                                                                    const PylithReal dt) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("updateKernelConstants(kernelConstants"<<kernelConstants<<", dt="<<dt<<")");
+
+    assert(kernelConstants);
+
+    if (_useConstantRefState) {
+        // Kernels selected for a uniform reference state read the cached reference-state stress
+        // contribution followed by the moduli; the moduli remain the last two constants so the
+        // Jacobian kernels for uniform moduli find them in the same place.
+        if (8 != kernelConstants->size()) { kernelConstants->resize(8);}
+        for (size_t i = 0; i < 6; ++i) {
+            (*kernelConstants)[i] = _constantRefContribution[i];
+        } // for
+        (*kernelConstants)[6] = _constantShearModulus;
+        (*kernelConstants)[7] = _constantBulkModulus;
+    } else if (_useConstantModuli) {
+        // Kernels selected for uniform moduli read the moduli from the last two constants.
+        if (2 != kernelConstants->size()) { kernelConstants->resize(2);}
+        (*kernelConstants)[0] = _constantShearModulus;
+        (*kernelConstants)[1] = _constantBulkModulus;
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // updateKernelConstants
+
+
+// ------------------------------------------------------------------------------------------------
+// Cache values of spatially uniform elastic moduli for constant-coefficient kernels.
+void
+pylith::materials::IsotropicLinearElasticity::detectConstantCoefficients(const pylith::topology::Field& auxiliaryField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("detectConstantCoefficients(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    const bool uniformCoefficients = _hasUniformModuli();
+    _useConstantModuli = uniformCoefficients && !_useReferenceState;
+    _useConstantRefState = uniformCoefficients && _useReferenceState;
+    if (!uniformCoefficients) { PYLITH_METHOD_END; }
+
+    // Coefficients are spatially uniform, so caching the values at the first local point
+    // suffices. Processes without points for this material never run its kernels, so the cached
+    // values are used only where they have been set.
+    const PylithInt i_shearModulus = auxiliaryField.getSubfieldInfo("shear_modulus").index;
+    const PylithInt i_bulkModulus = auxiliaryField.getSubfieldInfo("bulk_modulus").index;
+    const PylithInt i_refStress = (_useConstantRefState) ? auxiliaryField.getSubfieldInfo("reference_stress").index : -1;
+    const PylithInt i_refStrain = (_useConstantRefState) ? auxiliaryField.getSubfieldInfo("reference_strain").index : -1;
+
+    PetscErrorCode err;
+    PetscDM dmAux = auxiliaryField.getDM();assert(dmAux);
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dmAux, &section);PYLITH_CHECK_ERROR(err);assert(section);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* auxArray = NULL;
+    err = VecGetArrayRead(auxiliaryField.getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0;
+        err = PetscSectionGetFieldDof(section, point, i_shearModulus, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; }
+        PetscInt offShear = 0;
+        PetscInt offBulk = 0;
+        err = PetscSectionGetFieldOffset(section, point, i_shearModulus, &offShear);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(section, point, i_bulkModulus, &offBulk);PYLITH_CHECK_ERROR(err);
+        _constantShearModulus = auxArray[offShear];
+        _constantBulkModulus = auxArray[offBulk];
+
+        if (_useConstantRefState) {
+            // Vector components are ordered (xx, yy, zz, xy) in 2D and (xx, yy, zz, xy, yz, xz)
+            // in 3D; out-of-plane shear components are zero in 2D.
+            PetscInt stressSize = 0;
+            PetscInt offStress = 0;
+            PetscInt offStrain = 0;
+            err = PetscSectionGetFieldDof(section, point, i_refStress, &stressSize);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(section, point, i_refStress, &offStress);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(section, point, i_refStrain, &offStrain);PYLITH_CHECK_ERROR(err);
+            assert((4 == stressSize) || (6 == stressSize));
+
+            PylithReal refStress[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+            PylithReal refStrain[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+            for (PetscInt i = 0; i < stressSize; ++i) {
+                refStress[i] = auxArray[offStress+i];
+                refStrain[i] = auxArray[offStrain+i];
+            } // for
+
+            // Constant contribution of the reference state to the Cauchy stress:
+            // sigma = refContrib + C:strain with
+            // refContrib_ii = refStress_ii - 2G*refStrain_ii + (2/3 G - K)*tr(refStrain) and
+            // refContrib_ij = refStress_ij - 2G*refStrain_ij for the shear components.
+            const PylithReal shearModulus = _constantShearModulus;
+            const PylithReal bulkModulus = _constantBulkModulus;
+            const PylithReal refStrainTrace = refStrain[0] + refStrain[1] + refStrain[2];
+            const PylithReal traceTerm = (2.0/3.0*shearModulus - bulkModulus) * refStrainTrace;
+            for (size_t i = 0; i < 3; ++i) {
+                _constantRefContribution[i] = refStress[i] - 2.0*shearModulus*refStrain[i] + traceTerm;
+            } // for
+            for (size_t i = 3; i < 6; ++i) {
+                _constantRefContribution[i] = refStress[i] - 2.0*shearModulus*refStrain[i];
+            } // for
+        } // if
+        break;
+    } // for
+    err = VecRestoreArrayRead(auxiliaryField.getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // detectConstantCoefficients
+
+
+// ------------------------------------------------------------------------------------------------
+// Determine if the rheology response is linear in the solution.
+bool
+pylith::materials::IsotropicLinearElasticity::isLinear(void) const {
+    return true;
+} // isLinear
+
+
+// ------------------------------------------------------------------------------------------------
+// Determine if elastic moduli are spatially uniform over the material.
+bool
+pylith::materials::IsotropicLinearElasticity::_hasUniformModuli(void) const {
+    assert(_auxiliaryFactory);
+    const spatialdata::spatialdb::SpatialDB* queryDB = _auxiliaryFactory->getQueryDB();
+    return dynamic_cast<const spatialdata::spatialdb::UniformDB*>(queryDB) != NULL;
+} // _hasUniformModuli
+
+
 // End of file
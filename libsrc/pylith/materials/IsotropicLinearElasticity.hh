@@ -77,6 +77,18 @@ public:
      */
     PetscPointFunc getKernelf1v(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+    /** Get alternate stress kernel for RHS residual, G(t,s), for autotuning.
+     *
+     * With uniform moduli the constant-moduli and general stress kernels are interchangeable;
+     * the general kernel is offered as the alternate so the integrator can measure which one
+     * is faster on the hardware at hand.
+     *
+     * @param[in] coordsys Coordinate system.
+     *
+     * @return Alternate RHS residual kernel for stress; NULL if none.
+     */
+    PetscPointFunc getKernelf1vAlternate(const spatialdata::geocoords::CoordSys* coordsys) const;
+
     /** Get elastic constants kernel for LHS Jacobian F(t,s,\dot{s}).
      *
      * @param[in] coordsys Coordinate system.
@@ -109,11 +121,53 @@ public:
      */
     PetscPointFunc getKernelCauchyStressVector(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+    /** Update kernel constants.
+     *
+     * @param[inout] kernelConstants Array of constants used in integration kernels.
+     * @param[in] dt Current time step.
+     */
+    void updateKernelConstants(pylith::real_array* kernelConstants,
+                               const PylithReal dt) const;
+
+    /** Cache values of spatially uniform coefficients for constant-coefficient kernels.
+     *
+     * Caches the elastic moduli and, when a reference state is used, the constant contribution
+     * of the reference stress/strain to the Cauchy stress so that the per-step kernels only add
+     * the cached values instead of reloading the reference subfields.
+     *
+     * @param[in] auxiliaryField Auxiliary field with populated values.
+     */
+    void detectConstantCoefficients(const pylith::topology::Field& auxiliaryField);
+
+    /** Determine if the rheology response is linear in the solution.
+     *
+     * @returns True (isotropic linear elasticity is linear in the solution).
+     */
+    bool isLinear(void) const;
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Determine if elastic moduli are spatially uniform over the material.
+     *
+     * The moduli are uniform if the auxiliary field values come from a spatial database with a
+     * single point (UniformDB). Detection must not depend on the auxiliary field values, because
+     * kernels are selected before the auxiliary field is populated.
+     *
+     * @returns True if moduli are spatially uniform, false otherwise.
+     */
+    bool _hasUniformModuli(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
     pylith::materials::AuxiliaryFactoryElastic* _auxiliaryFactory; ///< Factory for creating auxiliary subfields.
+    PylithReal _constantShearModulus; ///< Shear modulus for uniform moduli (nondimensional).
+    PylithReal _constantBulkModulus; ///< Bulk modulus for uniform moduli (nondimensional).
+    PylithReal _constantRefContribution[6]; ///< Constant reference-state stress contribution for uniform reference state.
     bool _useReferenceState; ///< Flag to use reference stress and strain.
+    bool _useConstantModuli; ///< Flag to pass uniform moduli to kernels as constants.
+    bool _useConstantRefState; ///< Flag to pass cached uniform reference-state contribution to kernels as constants.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
@@ -23,10 +23,12 @@
 #include "pylith/materials/AuxiliaryFactoryViscoelastic.hh" // USES AuxiliaryFactoryViscoelastic
 #include "pylith/fekernels/IsotropicLinearGenMaxwell.hh" // USES IsotropicLinearGenMaxwell kernels
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/topology/Field.hh" // USES Field
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 
 #include <typeinfo> // USES typeid()
 
@@ -37,7 +39,12 @@ typedef pylith::feassemble::IntegratorDomain::ProjectKernels ProjectKernels;
 // Default constructor.
 pylith::materials::IsotropicLinearGenMaxwell::IsotropicLinearGenMaxwell(void) :
     _auxiliaryFactory(new pylith::materials::AuxiliaryFactoryViscoelastic),
-    _useReferenceState(false) {
+    _useReferenceState(false),
+    _useDecayFactorConstants(false) {
+    const PylithInt numParallel = pylith::fekernels::IsotropicLinearGenMaxwell::numParallel;
+    for (PylithInt i = 0; i < numParallel; ++i) {
+        _constantMaxwellTime[i] = 0.0;
+    } // for
     _lhsJacobianTriggers = pylith::feassemble::Integrator::NEW_JACOBIAN_TIME_STEP_CHANGE;
     pylith::utils::PyreComponent::setName("isotropiclineargenmaxwell");
 } // constructor
@@ -216,13 +223,88 @@ pylith::materials::IsotropicLinearGenMaxwell::updateKernelConstants(pylith::real
 
     assert(kernelConstants);
 
-    if (1 != kernelConstants->size()) { kernelConstants->resize(1);}
-    (*kernelConstants)[0] = dt;
+    if (!_useDecayFactorConstants) {
+        if (1 != kernelConstants->size()) { kernelConstants->resize(1);}
+        (*kernelConstants)[0] = dt;
+    } else {
+        // Relaxation times are spatially uniform, so precompute the viscous strain decay
+        // factors once per time step instead of per quadrature point in the kernels.
+        const PylithInt numParallel = pylith::fekernels::IsotropicLinearGenMaxwell::numParallel;
+        const size_t numConstants = 1 + 2*numParallel;
+        if (numConstants != kernelConstants->size()) { kernelConstants->resize(numConstants);}
+        (*kernelConstants)[0] = dt;
+        for (PylithInt i = 0; i < numParallel; ++i) {
+            const PylithReal maxwellTime = _constantMaxwellTime[i];assert(maxwellTime > 0.0);
+            (*kernelConstants)[1+2*i+0] = exp(-dt/maxwellTime);
+            (*kernelConstants)[1+2*i+1] = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+        } // for
+    } // if/else
 
     PYLITH_METHOD_END;
 } // updateKernelConstants
 
 
+// ------------------------------------------------------------------------------------------------
+// Determine if the rheology response is linear in the solution.
+bool
+pylith::materials::IsotropicLinearGenMaxwell::isLinear(void) const {
+    return true; // Linear viscoelastic; residual is linear in the solution for a given dt.
+} // isLinear
+
+
+// ------------------------------------------------------------------------------------------------
+// Detect spatially constant coefficients after auxiliary field has been populated.
+void
+pylith::materials::IsotropicLinearGenMaxwell::detectConstantCoefficients(const pylith::topology::Field& auxiliaryField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("detectConstantCoefficients(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    _useDecayFactorConstants = _hasUniformRelaxationTimes();
+    if (!_useDecayFactorConstants) { PYLITH_METHOD_END; }
+
+    // Relaxation times are spatially uniform, so caching the values at the first local point
+    // suffices. Processes without points for this material never run its kernels, so the cached
+    // values are used only where they have been set.
+    const PylithInt numParallel = pylith::fekernels::IsotropicLinearGenMaxwell::numParallel;
+    const PylithInt i_maxwellTime = auxiliaryField.getSubfieldInfo("maxwell_time").index;
+
+    PetscErrorCode err;
+    PetscDM dmAux = auxiliaryField.getDM();assert(dmAux);
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dmAux, &section);PYLITH_CHECK_ERROR(err);assert(section);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* auxArray = NULL;
+    err = VecGetArrayRead(auxiliaryField.getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0;
+        err = PetscSectionGetFieldDof(section, point, i_maxwellTime, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; }
+        assert(numParallel == dof);
+        PetscInt offset = 0;
+        err = PetscSectionGetFieldOffset(section, point, i_maxwellTime, &offset);PYLITH_CHECK_ERROR(err);
+        for (PylithInt i = 0; i < numParallel; ++i) {
+            _constantMaxwellTime[i] = auxArray[offset+i];
+        } // for
+        break;
+    } // for
+    err = VecRestoreArrayRead(auxiliaryField.getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // detectConstantCoefficients
+
+
+// ------------------------------------------------------------------------------------------------
+// Determine if relaxation times are spatially uniform over the material.
+bool
+pylith::materials::IsotropicLinearGenMaxwell::_hasUniformRelaxationTimes(void) const {
+    assert(_auxiliaryFactory);
+    const spatialdata::spatialdb::SpatialDB* queryDB = _auxiliaryFactory->getQueryDB();
+    return dynamic_cast<const spatialdata::spatialdb::UniformDB*>(queryDB) != NULL;
+} // _hasUniformRelaxationTimes
+
+
 // ------------------------------------------------------------------------------------------------
 // Add kernels for updating state variables.
 void
@@ -125,11 +125,41 @@ public:
     void updateKernelConstants(pylith::real_array* kernelConstants,
                                const PylithReal dt) const;
 
+    /** Detect spatially constant coefficients after auxiliary field has been populated.
+     *
+     * With spatially uniform relaxation times the viscous strain decay factors exp(-dt/tau_i)
+     * and the viscous strain coefficients are identical at every point, so they are precomputed
+     * when the time step changes and passed to the kernels as constants.
+     *
+     * @param[in] auxiliaryField Auxiliary field with values from spatial database.
+     */
+    void detectConstantCoefficients(const pylith::topology::Field& auxiliaryField);
+
+    /** Determine if the rheology response is linear in the solution.
+     *
+     * @returns True (linear viscoelastic response is linear in the solution for a given dt).
+     */
+    bool isLinear(void) const;
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Determine if relaxation times are spatially uniform over the material.
+     *
+     * Detection relies on the query spatial database, not the populated auxiliary field values,
+     * because kernels are selected before the auxiliary field is populated.
+     *
+     * @returns True if relaxation times are spatially uniform.
+     */
+    bool _hasUniformRelaxationTimes(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
     pylith::materials::AuxiliaryFactoryViscoelastic* _auxiliaryFactory; ///< Factory for creating auxiliary subfields.
     bool _useReferenceState; ///< Flag to use reference stress and strain.
+    PylithReal _constantMaxwellTime[3]; ///< Uniform relaxation times; size matches fekernels numParallel.
+    bool _useDecayFactorConstants; ///< Flag to pass precomputed decay factors as kernel constants.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
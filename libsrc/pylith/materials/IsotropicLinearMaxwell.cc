@@ -222,6 +222,14 @@ pylith::materials::IsotropicLinearMaxwell::updateKernelConstants(pylith::real_ar
 } // updateKernelConstants
 
 
+// ------------------------------------------------------------------------------------------------
+// Determine if the rheology response is linear in the solution.
+bool
+pylith::materials::IsotropicLinearMaxwell::isLinear(void) const {
+    return true; // Linear viscoelastic; residual is linear in the solution for a given dt.
+} // isLinear
+
+
 // ------------------------------------------------------------------------------------------------
 // Add kernels for updating state variables.
 void
@@ -125,6 +125,12 @@ public:
     void updateKernelConstants(pylith::real_array* kernelConstants,
                                const PylithReal dt) const;
 
+    /** Determine if the rheology response is linear in the solution.
+     *
+     * @returns True (linear viscoelastic response is linear in the solution for a given dt).
+     */
+    bool isLinear(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
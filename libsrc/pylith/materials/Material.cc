@@ -19,16 +19,24 @@
 
 #include "Material.hh" // implementation of object methods
 
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include <cassert> // USES assert()
-#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::out_of_range
 
 // ------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::materials::Material::Material(void) :
     _gravityField(NULL),
+    _integrationDomain(NULL),
+    _stateVarsUpdateThreshold(0.0),
+    _stateVarsRefreshInterval(0),
+    _dbQueryResolution(0.0),
     _description("") {}
 
 
@@ -48,6 +56,7 @@ pylith::materials::Material::deallocate(void) {
     pylith::problems::Physics::deallocate();
 
     _gravityField = NULL; // :TODO: Use shared pointer.
+    _integrationDomain = NULL; // Memory managed by problem.
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -79,6 +88,42 @@ pylith::materials::Material::setGravityField(spatialdata::spatialdb::GravityFiel
 } // setGravityField
 
 
+// ------------------------------------------------------------------------------------------------
+// Set threshold for incremental update of state variables.
+void
+pylith::materials::Material::setStateVarsUpdateThreshold(const double value) {
+    PYLITH_COMPONENT_DEBUG("setStateVarsUpdateThreshold(value="<<value<<")");
+
+    _stateVarsUpdateThreshold = value;
+} // setStateVarsUpdateThreshold
+
+
+// ------------------------------------------------------------------------------------------------
+// Set resolution for spatial database queries when populating the auxiliary field.
+void
+pylith::materials::Material::setDBQueryResolution(const double value) {
+    PYLITH_COMPONENT_DEBUG("setDBQueryResolution(value="<<value<<")");
+
+    _dbQueryResolution = value;
+} // setDBQueryResolution
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of time steps between full updates of state variables.
+void
+pylith::materials::Material::setStateVarsRefreshInterval(const int value) {
+    PYLITH_COMPONENT_DEBUG("setStateVarsRefreshInterval(value="<<value<<")");
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Number of time steps between full state variable updates (" << value << ") must be nonnegative.";
+        throw std::out_of_range(msg.str());
+    } // if
+
+    _stateVarsRefreshInterval = value;
+} // setStateVarsRefreshInterval
+
+
 // ------------------------------------------------------------------------------------------------
 // Set body force kernels (intended for use in MMS tests).
 void
@@ -134,4 +179,142 @@ pylith::materials::Material::getInterfaceKernelsJacobian(const pylith::topology:
 } // getInterfaceKernelsJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+// Get number of local values exchanged for an auxiliary subfield.
+size_t
+pylith::materials::Material::getStateExchangeSize(const char* subfieldName) const {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Field* auxiliaryField = _getStateExchangeField(subfieldName);
+    const pylith::topology::Field::SubfieldInfo& info = auxiliaryField->getSubfieldInfo(subfieldName);
+
+    pylith::topology::VecVisitorMesh auxVisitor(*auxiliaryField);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    size_t numValues = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        numValues += auxVisitor.sectionSubfieldDof(info.index, point);
+    } // for
+
+    PYLITH_METHOD_RETURN(numValues);
+} // getStateExchangeSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Export an auxiliary subfield to a flat array for in-memory coupling with an external code.
+void
+pylith::materials::Material::exportState(PylithScalar* values,
+                                         const int numValues,
+                                         const char* subfieldName) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("exportState(values="<<values<<", numValues="<<numValues<<", subfieldName="<<subfieldName<<")");
+
+    assert(values);
+    pylith::topology::Field* auxiliaryField = _getStateExchangeField(subfieldName);
+    const pylith::topology::Field::SubfieldInfo& info = auxiliaryField->getSubfieldInfo(subfieldName);
+    const PylithReal valueScale = info.description.scale;
+
+    const size_t sizeExpected = getStateExchangeSize(subfieldName);
+    if (size_t(numValues) != sizeExpected) {
+        std::ostringstream msg;
+        msg << "Size of state exchange array (" << numValues << ") for subfield '" << subfieldName
+            << "' of material '" << getDescription() << "' must match the number of local subfield "
+            << "degrees of freedom (" << sizeExpected << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    pylith::topology::VecVisitorMesh auxVisitor(*auxiliaryField);
+    const PetscScalar* auxArray = auxVisitor.localArray();
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    // Traverse the mesh points in ascending order so that the layout of the flat array is stable
+    // across time steps for a fixed mesh distribution.
+    PetscInt iValue = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt dof = auxVisitor.sectionSubfieldDof(info.index, point);
+        if (!dof) { continue; }
+        const PetscInt off = auxVisitor.sectionSubfieldOffset(info.index, point);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof, ++iValue) {
+            values[iValue] = auxArray[off+iDof] * valueScale;
+        } // for
+    } // for
+    assert(size_t(iValue) == sizeExpected);
+
+    PYLITH_METHOD_END;
+} // exportState
+
+
+// ------------------------------------------------------------------------------------------------
+// Import an auxiliary subfield from a flat array for in-memory coupling with an external code.
+void
+pylith::materials::Material::importState(const PylithScalar* values,
+                                         const int numValues,
+                                         const char* subfieldName) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("importState(values="<<values<<", numValues="<<numValues<<", subfieldName="<<subfieldName<<")");
+
+    assert(values);
+    pylith::topology::Field* auxiliaryField = _getStateExchangeField(subfieldName);
+    const pylith::topology::Field::SubfieldInfo& info = auxiliaryField->getSubfieldInfo(subfieldName);
+    const PylithReal valueScale = info.description.scale;
+
+    const size_t sizeExpected = getStateExchangeSize(subfieldName);
+    if (size_t(numValues) != sizeExpected) {
+        std::ostringstream msg;
+        msg << "Size of state exchange array (" << numValues << ") for subfield '" << subfieldName
+            << "' of material '" << getDescription() << "' must match the number of local subfield "
+            << "degrees of freedom (" << sizeExpected << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    pylith::topology::VecVisitorMesh auxVisitor(*auxiliaryField);
+    PetscScalar* auxArray = auxVisitor.localArray();
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    // Traverse the mesh points in the same (ascending) order as exportState().
+    PetscInt iValue = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt dof = auxVisitor.sectionSubfieldDof(info.index, point);
+        if (!dof) { continue; }
+        const PetscInt off = auxVisitor.sectionSubfieldOffset(info.index, point);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof, ++iValue) {
+            auxArray[off+iDof] = values[iValue] / valueScale;
+        } // for
+    } // for
+    assert(size_t(iValue) == sizeExpected);
+
+    auxiliaryField->markSubfieldDirty(subfieldName);
+    assert(_integrationDomain);
+    _integrationDomain->markLHSJacobianLumpedStale();
+
+    PYLITH_METHOD_END;
+} // importState
+
+
+// ------------------------------------------------------------------------------------------------
+// Get auxiliary field holding a subfield for state exchange.
+pylith::topology::Field*
+pylith::materials::Material::_getStateExchangeField(const char* subfieldName) const {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_integrationDomain) {
+        std::ostringstream msg;
+        msg << "Cannot exchange state for subfield '" << subfieldName << "' of material '"
+            << getDescription() << "' before initializing the problem.";
+        throw std::logic_error(msg.str());
+    } // if
+    pylith::topology::Field* auxiliaryField = _integrationDomain->getAuxiliaryField();
+    if (!auxiliaryField || !auxiliaryField->hasSubfield(subfieldName)) {
+        std::ostringstream msg;
+        msg << "Could not find subfield '" << subfieldName << "' for state exchange in auxiliary "
+            << "field for material '" << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_RETURN(auxiliaryField);
+} // _getStateExchangeField
+
+
 // End of file
@@ -93,6 +93,35 @@ public:
      */
     void setGravityField(spatialdata::spatialdb::GravityField* const g);
 
+    /** Set threshold for incremental update of state variables.
+     *
+     * Cells whose state variables changed by less than the threshold (relative change) in the
+     * previous update are skipped until the next full update. A nonpositive threshold (the
+     * default) updates the state variables over the entire material every time step.
+     *
+     * @param[in] value Relative change in state variables below which cells are skipped.
+     */
+    void setStateVarsUpdateThreshold(const double value);
+
+    /** Set number of time steps between full updates of state variables.
+     *
+     * Only used with a positive state variables update threshold.
+     *
+     * @param[in] value Number of time steps between full updates (0 means never).
+     */
+    void setStateVarsRefreshInterval(const int value);
+
+    /** Set resolution for spatial database queries when populating the auxiliary field.
+     *
+     * With a positive resolution, the databases are queried on a coarse grid with the given
+     * spacing and the values are interpolated to the evaluation points with a gradient-limited
+     * estimate. Useful when the databases (e.g., velocity models) are much finer than the mesh
+     * needs. A nonpositive resolution (the default) queries every evaluation point.
+     *
+     * @param[in] value Grid spacing (dimensioned length) for coarse queries.
+     */
+    void setDBQueryResolution(const double value);
+
     /** Set body force kernels (intended for use in MMS tests).
      *
      * @param[in] kernels Array of body force kernels.
@@ -137,11 +166,63 @@ public:
     std::vector<InterfaceJacobianKernels> getInterfaceKernelsJacobian(const pylith::topology::Field& solution,
                                                                       pylith::feassemble::IntegratorInterface::FaceEnum face) const;
 
+    /** Get number of local values exchanged for an auxiliary subfield.
+     *
+     * @pre Must initialize the problem before exchanging state.
+     *
+     * @param[in] subfieldName Name of auxiliary subfield to exchange.
+     * @returns Number of subfield degrees of freedom on this process.
+     */
+    size_t getStateExchangeSize(const char* subfieldName) const;
+
+    /** Export an auxiliary subfield to a flat array for in-memory coupling with an external code.
+     *
+     * The values are dimensioned (SI units) and traversed in ascending order of the mesh points,
+     * so the layout of the array is stable across time steps for a fixed mesh distribution. The
+     * array holds the values local to this process; exchange it through shared memory or an MPI
+     * intercommunicator instead of files.
+     *
+     * @param[out] values Array of subfield values [numValues].
+     * @param[in] numValues Size of array; must match getStateExchangeSize().
+     * @param[in] subfieldName Name of auxiliary subfield to export.
+     */
+    void exportState(PylithScalar* values,
+                     const int numValues,
+                     const char* subfieldName) const;
+
+    /** Import an auxiliary subfield from a flat array for in-memory coupling with an external code.
+     *
+     * The values must be dimensioned (SI units) and laid out as in exportState(). The subfield is
+     * marked as modified so that cached data depending on it (e.g., the lumped LHS Jacobian) is
+     * recomputed.
+     *
+     * @param[in] values Array of subfield values [numValues].
+     * @param[in] numValues Size of array; must match getStateExchangeSize().
+     * @param[in] subfieldName Name of auxiliary subfield to import.
+     */
+    void importState(const PylithScalar* values,
+                     const int numValues,
+                     const char* subfieldName);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get auxiliary field holding a subfield for state exchange.
+     *
+     * @param[in] subfieldName Name of auxiliary subfield to exchange.
+     * @returns Auxiliary field of integrator for material.
+     */
+    pylith::topology::Field* _getStateExchangeField(const char* subfieldName) const;
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
     spatialdata::spatialdb::GravityField* _gravityField; ///< Gravity field for gravitational body forces.
+    pylith::feassemble::IntegratorDomain* _integrationDomain; ///< Integrator created for material (borrowed reference).
     std::vector<pylith::feassemble::IntegratorDomain::ResidualKernels> _mmsBodyForceKernels;
+    double _stateVarsUpdateThreshold; ///< Relative change below which cells skip state var update.
+    int _stateVarsRefreshInterval; ///< Number of time steps between full state var updates.
+    double _dbQueryResolution; ///< Grid spacing for coarse database queries (nonpositive queries every evaluation point).
 
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
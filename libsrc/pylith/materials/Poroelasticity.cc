@@ -189,12 +189,15 @@ pylith::materials::Poroelasticity::createIntegrator(const pylith::topology::Fiel
     pylith::feassemble::IntegratorDomain* integrator = new pylith::feassemble::IntegratorDomain(this);assert(integrator);
     integrator->setLabelName(getLabelName());
     integrator->setLabelValue(getLabelValue());
+    integrator->setIncrementalStateVarsUpdate(_stateVarsUpdateThreshold, _stateVarsRefreshInterval);
 
     _setKernelsResidual(integrator, solution);
     _setKernelsJacobian(integrator, solution);
     _setKernelsUpdateStateVars(integrator, solution);
     _setKernelsDerivedField(integrator, solution);
 
+    _integrationDomain = integrator; // Borrowed reference for state exchange.
+
     PYLITH_METHOD_RETURN(integrator);
 } // createIntegrator
 
@@ -251,6 +254,7 @@ pylith::materials::Poroelasticity::createAuxiliaryField(const pylith::topology::
     auxiliaryField->createOutputVector();
 
     assert(auxiliaryFactory);
+    auxiliaryFactory->setQueryResolution(_dbQueryResolution);
     auxiliaryFactory->setValuesFromDB();
 
     PYLITH_METHOD_RETURN(auxiliaryField);
@@ -503,6 +507,7 @@ pylith::materials::Poroelasticity::_setKernelsJacobian(pylith::feassemble::Integ
     PYLITH_COMPONENT_DEBUG("_setKernelsJacobian(integrator="<<integrator<<",solution="<<solution.getLabel()<<")");
     const spatialdata::geocoords::CoordSys* coordsys = solution.getMesh().getCoordSys();
     std::vector<JacobianKernels> kernels(9);
+    std::vector<JacobianKernels> kernelsPrecond;
 
     switch (_formulation) {
     case QUASISTATIC: {
@@ -562,6 +567,14 @@ pylith::materials::Poroelasticity::_setKernelsJacobian(pylith::feassemble::Integ
             kernels[6] = JacobianKernels("trace_strain", "displacement", equationPart, Jf0eu, Jf1eu, Jf2eu, Jf3eu);
             kernels[7] = JacobianKernels("trace_strain", "pressure",     equationPart, Jf0ep, Jf1ep, Jf2ep, Jf3ep);
             kernels[8] = JacobianKernels("trace_strain", "trace_strain", equationPart, Jf0ee, Jf1ee, Jf2ee, Jf3ee);
+
+            // Preconditioning matrix: block-diagonal approximation for fieldsplit. The
+            // pressure block (specific storage + Darcy diffusion) is spectrally equivalent
+            // to the pressure Schur complement; the coupling blocks are dropped.
+            kernelsPrecond.resize(3);
+            kernelsPrecond[0] = JacobianKernels("displacement", "displacement", equationPart, Jf0uu, Jf1uu, Jf2uu, Jf3uu);
+            kernelsPrecond[1] = JacobianKernels("pressure", "pressure", equationPart, Jf0pp, Jf1pp, Jf2pp, Jf3pp);
+            kernelsPrecond[2] = JacobianKernels("trace_strain", "trace_strain", equationPart, Jf0ee, Jf1ee, Jf2ee, Jf3ee);
         } else {
             const PetscPointJac Jf0uu = NULL;
             const PetscPointJac Jf1uu = NULL;
@@ -780,6 +793,18 @@ pylith::materials::Poroelasticity::_setKernelsJacobian(pylith::feassemble::Integ
             kernels[33] = JacobianKernels("trace_strain_t", "velocity", equationPart, Jf0edotv, Jf1edotv, Jf2edotv, Jf3edotv);
             kernels[34] = JacobianKernels("trace_strain_t", "pressure_t", equationPart, Jf0edotpdot, Jf1edotpdot, Jf2edotpdot, Jf3edotpdot);
             kernels[35] = JacobianKernels("trace_strain_t", "trace_strain_t", equationPart, Jf0edotedot, Jf1edotedot, Jf2edotedot, Jf3edotedot);
+
+            // Preconditioning matrix: block-diagonal approximation for fieldsplit. The
+            // pressure block (specific storage + Darcy diffusion) is spectrally equivalent
+            // to the pressure Schur complement; the coupling blocks are dropped. Every
+            // subfield keeps its diagonal block so the preconditioning matrix is nonsingular.
+            kernelsPrecond.resize(6);
+            kernelsPrecond[0] = JacobianKernels("displacement", "displacement", equationPart, Jf0uu, Jf1uu, Jf2uu, Jf3uu);
+            kernelsPrecond[1] = JacobianKernels("pressure", "pressure", equationPart, Jf0pp, Jf1pp, Jf2pp, Jf3pp);
+            kernelsPrecond[2] = JacobianKernels("trace_strain", "trace_strain", equationPart, Jf0ee, Jf1ee, Jf2ee, Jf3ee);
+            kernelsPrecond[3] = JacobianKernels("velocity", "velocity", equationPart, Jf0vv, Jf1vv, Jf2vv, Jf3vv);
+            kernelsPrecond[4] = JacobianKernels("pressure_t", "pressure_t", equationPart, Jf0pdotpdot, Jf1pdotpdot, Jf2pdotpdot, Jf3pdotpdot);
+            kernelsPrecond[5] = JacobianKernels("trace_strain_t", "trace_strain_t", equationPart, Jf0edotedot, Jf1edotedot, Jf2edotedot, Jf3edotedot);
         }
         break;
     } // QUASISTATIC
@@ -850,6 +875,9 @@ pylith::materials::Poroelasticity::_setKernelsJacobian(pylith::feassemble::Integ
 
     assert(integrator);
     integrator->setKernelsJacobian(kernels, solution);
+    if (!kernelsPrecond.empty()) {
+        integrator->setKernelsJacobianPrecond(kernelsPrecond, solution);
+    } // if
 
     PYLITH_METHOD_END;
 } // _setKernelsJacobian
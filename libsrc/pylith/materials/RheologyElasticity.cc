@@ -21,6 +21,7 @@
 #include "pylith/materials/RheologyElasticity.hh" // implementation of object methods
 
 #include "pylith/feassemble/Integrator.hh" // USES NEW_JACOBIAN_NEVER
+#include "pylith/topology/Field.hh" // USES Field
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_DEBUG
@@ -56,6 +57,14 @@ pylith::materials::RheologyElasticity::getLHSJacobianTriggers(void) const {
 } // getLHSJacobianTriggers
 
 
+// ------------------------------------------------------------------------------------------------
+// Get alternate stress kernel for RHS residual, G(t,s), for autotuning.
+PetscPointFunc
+pylith::materials::RheologyElasticity::getKernelf1vAlternate(const spatialdata::geocoords::CoordSys* coordsys) const {
+    return NULL; // Default is no alternate kernel; rheologies with variants override.
+} // getKernelf1vAlternate
+
+
 // ------------------------------------------------------------------------------------------------
 // Update kernel constants.
 void
@@ -70,6 +79,27 @@ pylith::materials::RheologyElasticity::updateKernelConstants(pylith::real_array*
 } // updateKernelConstants
 
 
+// ------------------------------------------------------------------------------------------------
+// Cache values of spatially uniform coefficients for constant-coefficient kernels.
+void
+pylith::materials::RheologyElasticity::detectConstantCoefficients(const pylith::topology::Field& auxiliaryField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("detectConstantCoefficients(auxiliaryField="<<auxiliaryField.getLabel()<<") empty method");
+
+    // Default is to do nothing.
+
+    PYLITH_METHOD_END;
+} // detectConstantCoefficients
+
+
+// ------------------------------------------------------------------------------------------------
+// Determine if the rheology response is linear in the solution.
+bool
+pylith::materials::RheologyElasticity::isLinear(void) const {
+    return false; // Default is nonlinear; linear rheologies override.
+} // isLinear
+
+
 // ------------------------------------------------------------------------------------------------
 // Add kernels for updating state variables.
 void
@@ -84,4 +114,12 @@ pylith::materials::RheologyElasticity::addKernelsUpdateStateVars(std::vector<pyl
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Get monomorphized batched loops for rheology, if available.
+pylith::fekernels::ElasticityKernelRegistry::KernelBlock
+pylith::materials::RheologyElasticity::getBatchedKernels(const int spaceDim) const {
+    return pylith::fekernels::ElasticityKernelRegistry::getKernels(getName(), spaceDim);
+} // getBatchedKernels
+
+
 // End of file
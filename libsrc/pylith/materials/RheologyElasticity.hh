@@ -30,6 +30,7 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/arrayfwd.hh" // USES std::vector
 #include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain::ProjectKernels
+#include "pylith/fekernels/ElasticityKernelRegistry.hh" // USES ElasticityKernelRegistry::KernelBlock
 
 #include "spatialdata/geocoords/geocoordsfwd.hh" // USES Coordsys
 
@@ -70,6 +71,19 @@ public:
     virtual
     PetscPointFunc getKernelf1v(const spatialdata::geocoords::CoordSys* coordsys) const = 0;
 
+    /** Get alternate stress kernel for RHS residual, G(t,s), for autotuning.
+     *
+     * The alternate kernel must be semantically equivalent to the kernel returned by
+     * getKernelf1v(); with autotuning enabled, the integrator benchmarks both and installs
+     * the faster one.
+     *
+     * @param[in] coordsys Coordinate system.
+     *
+     * @return Alternate RHS residual kernel for stress; NULL if none.
+     */
+    virtual
+    PetscPointFunc getKernelf1vAlternate(const spatialdata::geocoords::CoordSys* coordsys) const;
+
     /** Get elastic constants kernel for RHS Jacobian G(t,s).
      *
      * @param[in] coordsys Coordinate system.
@@ -130,6 +144,39 @@ public:
     void updateKernelConstants(pylith::real_array* kernelConstants,
                                const PylithReal dt) const;
 
+    /** Cache values of spatially uniform coefficients for constant-coefficient kernels.
+     *
+     * Called after the auxiliary field has been populated from the spatial database(s).
+     *
+     * @param[in] auxiliaryField Auxiliary field with populated values.
+     */
+    virtual
+    void detectConstantCoefficients(const pylith::topology::Field& auxiliaryField);
+
+    /** Determine if the rheology response is linear in the solution.
+     *
+     * Fully linear configurations allow replacing the Newton loop with a single assembled
+     * linear solve per time step.
+     *
+     * @returns True if the residual is linear in the solution.
+     */
+    virtual
+    bool isLinear(void) const;
+
+    /** Get monomorphized batched loops for rheology, if available.
+     *
+     * The lookup is resolved once per material when kernels are selected, so the batched
+     * assembly paths call a concrete loop with the rheology's point computation inlined
+     * instead of dispatching through a function pointer at every quadrature point. Rheologies
+     * without batched kernels return a block with NULL entries and callers fall back to the
+     * pointwise kernels.
+     *
+     * @param[in] spaceDim Spatial dimension of problem.
+     * @returns Batched kernel block for rheology.
+     */
+    virtual
+    pylith::fekernels::ElasticityKernelRegistry::KernelBlock getBatchedKernels(const int spaceDim) const;
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 
     int _lhsJacobianTriggers; ///< Triggers for needing to recompute the RHS Jacobian.
@@ -29,6 +29,7 @@
 // Constructor
 pylith::meshio::DataWriter::DataWriter(void) :
     _timeScale(1.0),
+    _expectedNumWrites(0),
     _context(""),
     _isInfo(false),
     _isOpen(false) {}
@@ -65,6 +66,14 @@ pylith::meshio::DataWriter::setTimeScale(const PylithScalar value) {
 } // timeScale
 
 
+// ----------------------------------------------------------------------
+// Set expected number of writes per time-series dataset.
+void
+pylith::meshio::DataWriter::setExpectedNumWrites(const size_t value) {
+    _expectedNumWrites = value;
+} // setExpectedNumWrites
+
+
 // ----------------------------------------------------------------------
 // Is data writer open, i.e., ready for openTimeStep()/closeTimeStep()?
 bool
@@ -125,6 +134,7 @@ pylith::meshio::DataWriter::closeTimeStep(void) {
 // ----------------------------------------------------------------------
 // Copy constructor.
 pylith::meshio::DataWriter::DataWriter(const DataWriter& w) :
+    _expectedNumWrites(w._expectedNumWrites),
     _context(w._context),
     _isInfo(w._isInfo),
     _isOpen(w._isOpen) {}
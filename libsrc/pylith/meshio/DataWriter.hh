@@ -67,6 +67,16 @@ public:
      */
     void setTimeScale(const PylithScalar value);
 
+    /** Set expected number of writes per time-series dataset.
+     *
+     * Writers may use the hint to preallocate dataset extents instead of extending them
+     * incrementally with each write. A value of 0 (default) means the number of writes is
+     * unknown.
+     *
+     * @param[in] value Expected number of writes.
+     */
+    void setExpectedNumWrites(const size_t value);
+
     /** Is data writer open, i.e., ready for openTimeStep()/closeTimeStep()?
      *
      * @returns True if data writer is open, false otherwise.
@@ -155,6 +165,7 @@ private:
 protected:
 
     PylithScalar _timeScale; ///< Time scale for dimensioning time in output.
+    size_t _expectedNumWrites; ///< Expected number of writes per time-series dataset (0 means unknown).
     std::string _context; ///< Context of scatters for DataWriter.
     bool _isInfo; ///< True if only writing info values.
     bool _isOpen; ///< True if writer is ready for openTimeStep()/closeTimeStep().
@@ -37,8 +37,19 @@
 #include <mpi.h> // USES MPI routines
 
 #include <cassert> // USES assert()
+#include <cstdlib> // USES posix_memalign(), free()
+#include <fstream> // USES std::ifstream
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
+#include <unistd.h> // USES sysconf()
+
+#include <condition_variable> // USES std::condition_variable
+#include <cstring> // USES memcpy()
+#include <deque> // HASA std::deque
+#include <mutex> // USES std::mutex
+#include <new> // USES std::bad_alloc
+#include <thread> // USES std::thread
+#include <vector> // HASA std::vector
 
 extern "C" {
     extern PetscErrorCode VecView_Seq(Vec,
@@ -53,13 +64,600 @@ extern "C" {
 #define PYLITH_HDF5_USE_API_18
 #endif
 
+namespace pylith {
+    namespace meshio {
+        class _DataWriterHDF5 {
+public:
+
+            /** Set the time dimension (first index) of the extent of a dataset.
+             *
+             * Collective; every process in the communicator of the file must call it with the
+             * same arguments. Datasets with a fixed time dimension are left unchanged.
+             *
+             * @param[in] h5 HDF5 file.
+             * @param[in] path Full path of dataset.
+             * @param[in] numSteps Number of time steps in extent.
+             */
+            static
+            void setDatasetTimeExtent(const hid_t h5,
+                                      const char* path,
+                                      const hsize_t numSteps);
+
+        }; // _DataWriterHDF5
+    } // meshio
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set the time dimension (first index) of the extent of a dataset.
+void
+pylith::meshio::_DataWriterHDF5::setDatasetTimeExtent(const hid_t h5,
+                                                      const char* path,
+                                                      const hsize_t numSteps) {
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dopen2(h5, path, H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dopen(h5, path);
+#endif
+    if (dataset < 0) {
+        std::ostringstream msg;
+        msg << "Could not open dataset '" << path << "' to set its extent.";
+        throw std::runtime_error(msg.str());
+    } // if
+    hid_t dataspace = H5Dget_space(dataset);
+    if (dataspace < 0) {
+        H5Dclose(dataset);
+        std::ostringstream msg;
+        msg << "Could not get dataspace of dataset '" << path << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    hsize_t dims[H5S_MAX_RANK];
+    hsize_t maxDims[H5S_MAX_RANK];
+    const int ndims = H5Sget_simple_extent_dims(dataspace, dims, maxDims);
+    H5Sclose(dataspace);
+    if ((ndims > 0) && (H5S_UNLIMITED == maxDims[0]) && (dims[0] != numSteps)) {
+        dims[0] = numSteps;
+        if (H5Dset_extent(dataset, dims) < 0) {
+            H5Dclose(dataset);
+            std::ostringstream msg;
+            msg << "Could not set extent of dataset '" << path << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+    H5Dclose(dataset);
+} // setDatasetTimeExtent
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+/** Background thread writing snapshotted fields.
+ *
+ * The main thread snapshots the local values of a field into a pooled
+ * task (double buffer) and continues time stepping; this thread performs
+ * the collective HDF5 writes. The writer thread makes only raw HDF5 and
+ * MPI calls; PETSc is not thread safe, and the main thread is inside
+ * PETSc while this thread writes, so everything that requires PETSc (the
+ * HDF5 file handle, vector sizes, and ownership offsets) is captured on
+ * the main thread before the thread starts or when a task is staged. All
+ * MPI calls made after start() use a duplicate of the mesh communicator
+ * so that they cannot interleave with the collective calls of the solve,
+ * which requires MPI_THREAD_MULTIPLE.
+ */
+class pylith::meshio::DataWriterHDF5::AsyncWriter {
+public:
+
+    /// Snapshot of a field write.
+    ///
+    /// The staging buffer is page aligned and reused across snapshots, so it can be
+    /// registered as pinned (page-locked) host memory and filled with an asynchronous
+    /// device-to-host copy once assembly runs on a device; registration requires page
+    /// alignment and is too expensive to redo per snapshot.
+    struct Task {
+        std::string group; ///< HDF5 group ("/vertex_fields" or "/cell_fields").
+        std::string name; ///< Name of field.
+        std::string vectorFieldType; ///< Vector field type attribute (written at first time step).
+        PylithScalar* values; ///< Staging buffer with local values of field (page aligned).
+        size_t numValues; ///< Number of values in snapshot.
+        size_t capacity; ///< Allocated size of staging buffer.
+        PetscInt globalSize; ///< Global size of field vector.
+        PetscInt globalOffset; ///< Offset of first local value in global vector.
+        PetscInt blockSize; ///< Block size of field vector.
+        int istep; ///< Time step index for field.
+        int tstampIndex; ///< Index of time stamp to write.
+        PylithScalar tDim; ///< Time stamp with dimensions.
+        bool writeTimeStamp; ///< Write time stamp before field if true.
+        std::string preallocatePath; ///< Full path of dataset to preallocate after write (empty means none).
+        bool preallocateTime; ///< Preallocate time stamp dataset after write if true.
+
+        /// Constructor.
+        Task(void);
+
+        /// Destructor.
+        ~Task(void);
+
+        /** Copy local field values into the staging buffer, growing it if necessary.
+         *
+         * @param[in] array Local values of field.
+         * @param[in] size Number of values.
+         */
+        void stage(const PetscScalar* array,
+                   const size_t size);
+    }; // Task
+
+    /** Constructor.
+     *
+     * @param[in] meshComm Communicator of mesh (duplicated for the writer thread).
+     */
+    AsyncWriter(MPI_Comm meshComm);
+
+    /// Destructor.
+    ~AsyncWriter(void);
+
+    /** Get communicator for the writer thread.
+     *
+     * @returns Duplicated communicator.
+     */
+    MPI_Comm getComm(void) const;
+
+    /** Start writer thread.
+     *
+     * The raw HDF5 file handle is extracted from the viewer before the thread
+     * starts; the viewer itself is never used from the writer thread.
+     *
+     * @param[in] viewer HDF5 viewer opened on the writer communicator.
+     */
+    void start(PetscViewer viewer);
+
+    /** Set extent (number of time steps) used when preallocating datasets.
+     *
+     * @param[in] value Number of time steps in extent (0 disables preallocation).
+     */
+    void setExpectedExtent(const hsize_t value);
+
+    /** Get a task to fill with a snapshot.
+     *
+     * Blocks until one of the pooled buffers is free.
+     *
+     * @returns Task from buffer pool.
+     */
+    Task* acquireTask(void);
+
+    /** Submit filled task to writer thread.
+     *
+     * @param[in] task Task to write.
+     */
+    void submit(Task* task);
+
+    /// Wait until all submitted tasks have been written.
+    void drain(void);
+
+    /// Drain pending tasks and join writer thread.
+    void stop(void);
+
+private:
+
+    /// Writer thread main loop.
+    void _run(void);
+
+    /** Perform the HDF5 writes for a task.
+     *
+     * @param[in] task Task to write.
+     */
+    void _write(Task* task);
+
+    /** Create a dataset if absent, extend its time dimension, and collectively write the
+     * local slice of a time step.
+     *
+     * Makes only raw HDF5 calls so that it is safe to call from the writer thread.
+     *
+     * @param[in] path Full path of dataset.
+     * @param[in] values Local values for time step.
+     * @param[in] numPoints Global number of points.
+     * @param[in] fiberDim Number of values per point.
+     * @param[in] pointOffset Offset of first local point.
+     * @param[in] numPointsLocal Local number of points.
+     * @param[in] istep Time step index.
+     */
+    void _writeSlice(const char* path,
+                     const PylithScalar* values,
+                     const hsize_t numPoints,
+                     const hsize_t fiberDim,
+                     const hsize_t pointOffset,
+                     const hsize_t numPointsLocal,
+                     const hsize_t istep);
+
+    /// Throw std::runtime_error if the writer thread recorded an error.
+    void _checkError(void);
+
+    static const size_t _maxPending; ///< Depth of snapshot buffer (double buffer).
+
+    MPI_Comm _comm; ///< Duplicated communicator for writer thread.
+    hid_t _h5; ///< HDF5 file handle (borrowed from viewer).
+    PetscMPIInt _commRank; ///< Rank in duplicated communicator.
+    std::deque<Task*> _queue; ///< Tasks waiting to be written.
+    std::vector<Task*> _pool; ///< Reusable snapshot buffers.
+    hsize_t _expectedExtent; ///< Extent for preallocating datasets (0 disables preallocation).
+    size_t _numPending; ///< Tasks submitted but not yet written.
+    std::thread _thread; ///< Writer thread.
+    std::mutex _mutex; ///< Guards queue, pool, and error state.
+    std::condition_variable _taskSubmitted; ///< Signaled when a task is submitted or the writer stops.
+    std::condition_variable _taskFinished; ///< Signaled when a task has been written.
+    std::string _errorMsg; ///< First error recorded by writer thread.
+    bool _running; ///< Writer thread accepts tasks if true.
+}; // AsyncWriter
+
+const size_t pylith::meshio::DataWriterHDF5::AsyncWriter::_maxPending = 2;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::DataWriterHDF5::AsyncWriter::Task::Task(void) :
+    values(NULL),
+    numValues(0),
+    capacity(0),
+    preallocateTime(false) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::DataWriterHDF5::AsyncWriter::Task::~Task(void) {
+    free(values);values = NULL;
+    numValues = 0;
+    capacity = 0;
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy local field values into the staging buffer, growing it if necessary.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::Task::stage(const PetscScalar* array,
+                                                         const size_t size) {
+    if (size > capacity) {
+        free(values);values = NULL;
+        const size_t pageSize = sysconf(_SC_PAGESIZE);
+        void* buffer = NULL;
+        if (posix_memalign(&buffer, pageSize, size*sizeof(PylithScalar))) {
+            capacity = 0;
+            throw std::bad_alloc();
+        } // if
+        values = (PylithScalar*) buffer;
+        capacity = size;
+    } // if
+    if (size > 0) {
+        assert(array);
+        memcpy(values, array, size*sizeof(PylithScalar));
+    } // if
+    numValues = size;
+} // stage
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::DataWriterHDF5::AsyncWriter::AsyncWriter(MPI_Comm meshComm) :
+    _comm(MPI_COMM_NULL),
+    _h5(-1),
+    _commRank(0),
+    _expectedExtent(0),
+    _numPending(0),
+    _running(false) {
+    PetscErrorCode err = MPI_Comm_dup(meshComm, &_comm);PYLITH_CHECK_ERROR(err);
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::DataWriterHDF5::AsyncWriter::~AsyncWriter(void) {
+    stop();
+
+    if (MPI_COMM_NULL != _comm) {
+        MPI_Comm_free(&_comm);
+    } // if
+    for (size_t i = 0; i < _pool.size(); ++i) {
+        delete _pool[i];_pool[i] = NULL;
+    } // for
+    _pool.clear();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get communicator for the writer thread.
+MPI_Comm
+pylith::meshio::DataWriterHDF5::AsyncWriter::getComm(void) const {
+    return _comm;
+} // getComm
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Start writer thread.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::start(PetscViewer viewer) {
+    assert(viewer);
+    assert(!_running);
+
+    // Extract the raw HDF5 file handle and communicator rank on the main thread; the
+    // writer thread must not call PETSc.
+    PetscErrorCode err = PetscViewerHDF5GetFileId(viewer, &_h5);PYLITH_CHECK_ERROR(err);
+    assert(_h5 >= 0);
+    err = MPI_Comm_rank(_comm, &_commRank);PYLITH_CHECK_ERROR(err);
+
+    _running = true;
+    _thread = std::thread(&AsyncWriter::_run, this);
+} // start
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set extent (number of time steps) used when preallocating datasets.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::setExpectedExtent(const hsize_t value) {
+    _expectedExtent = value;
+} // setExpectedExtent
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get a task to fill with a snapshot.
+pylith::meshio::DataWriterHDF5::AsyncWriter::Task*
+pylith::meshio::DataWriterHDF5::AsyncWriter::acquireTask(void) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _checkError();
+    while (_numPending >= _maxPending) {
+        _taskFinished.wait(lock);
+        _checkError();
+    } // while
+    Task* task = NULL;
+    if (!_pool.empty()) {
+        task = _pool.back();_pool.pop_back();
+    } else {
+        task = new Task;
+    } // if/else
+    return task;
+} // acquireTask
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Submit filled task to writer thread.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::submit(Task* task) {
+    assert(task);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.push_back(task);
+    ++_numPending;
+    _taskSubmitted.notify_one();
+} // submit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Wait until all submitted tasks have been written.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::drain(void) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_numPending > 0) {
+        _taskFinished.wait(lock);
+    } // while
+    _checkError();
+} // drain
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Drain pending tasks and join writer thread.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::stop(void) {
+    { // lock
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (_numPending > 0) {
+            _taskFinished.wait(lock);
+        } // while
+        _running = false;
+        _taskSubmitted.notify_one();
+    } // lock
+    if (_thread.joinable()) {
+        _thread.join();
+    } // if
+    std::lock_guard<std::mutex> lock(_mutex);
+    _checkError();
+} // stop
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Writer thread main loop.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::_run(void) {
+    while (true) {
+        Task* task = NULL;
+        { // lock
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (_running && _queue.empty()) {
+                _taskSubmitted.wait(lock);
+            } // while
+            if (_queue.empty()) {
+                return;
+            } // if
+            task = _queue.front();_queue.pop_front();
+        } // lock
+
+        std::string errorMsg;
+        try {
+            { // lock
+                // If an earlier write failed, discard remaining tasks so the
+                // main thread is never blocked waiting for buffers.
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_errorMsg.empty()) {
+                    errorMsg = _errorMsg;
+                } // if
+            } // lock
+            if (errorMsg.empty()) {
+                _write(task);
+            } // if
+        } catch (const std::exception& err) {
+            errorMsg = err.what();
+        } catch (...) {
+            errorMsg = "Unknown error in background HDF5 write.";
+        } // try/catch
+
+        { // lock
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_errorMsg.empty() && !errorMsg.empty()) {
+                _errorMsg = errorMsg;
+            } // if
+            _pool.push_back(task);
+            assert(_numPending > 0);
+            --_numPending;
+            _taskFinished.notify_all();
+        } // lock
+    } // while
+} // _run
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Perform the HDF5 writes for a task.
+//
+// Runs on the writer thread, so only raw HDF5 and MPI calls are made here; the
+// sizes, offsets, and file handle were captured on the main thread.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::_write(Task* task) {
+    assert(task);
+    assert(_h5 >= 0);
+
+    if (task->writeTimeStamp) {
+        const PylithScalar tDim = task->tDim;
+        const hsize_t numLocal = (!_commRank) ? 1 : 0;
+        _writeSlice("/time", &tDim, 1, 1, 0, numLocal, task->tstampIndex);
+        if (task->preallocateTime) {
+            _DataWriterHDF5::setDatasetTimeExtent(_h5, "/time", _expectedExtent);
+        } // if
+    } // if
+
+    const std::string fullName = task->group + "/" + task->name;
+    assert(task->blockSize > 0);
+    const hsize_t fiberDim = task->blockSize;
+    const hsize_t numPoints = task->globalSize / task->blockSize;
+    const hsize_t pointOffset = task->globalOffset / task->blockSize;
+    const hsize_t numPointsLocal = task->numValues / task->blockSize;
+    _writeSlice(fullName.c_str(), task->values, numPoints, fiberDim, pointOffset, numPointsLocal, task->istep);
+
+    if (0 == task->istep) {
+        HDF5::writeAttribute(_h5, fullName.c_str(), "vector_field_type", task->vectorFieldType.c_str());
+    } // if
+    if (!task->preallocatePath.empty()) {
+        _DataWriterHDF5::setDatasetTimeExtent(_h5, task->preallocatePath.c_str(), _expectedExtent);
+    } // if
+} // _write
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create a dataset if absent, extend its time dimension, and collectively write the local
+// slice of a time step.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::_writeSlice(const char* path,
+                                                         const PylithScalar* values,
+                                                         const hsize_t numPoints,
+                                                         const hsize_t fiberDim,
+                                                         const hsize_t pointOffset,
+                                                         const hsize_t numPointsLocal,
+                                                         const hsize_t istep) {
+    const hid_t datatype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    const int ndims = 3;
+
+    // H5Lexists() fails on a missing intermediate group, so check the parent group first.
+    const std::string pathStr = path;
+    const size_t sep = pathStr.rfind('/');
+    const std::string parent = (sep != std::string::npos && sep > 0) ? pathStr.substr(0, sep) : "/";
+    bool exists = ("/" == parent) || (H5Lexists(_h5, parent.c_str(), H5P_DEFAULT) > 0);
+    exists = exists && (H5Lexists(_h5, path, H5P_DEFAULT) > 0);
+
+    hid_t dataset = -1;
+    if (exists) {
+#if defined(PYLITH_HDF5_USE_API_18)
+        dataset = H5Dopen2(_h5, path, H5P_DEFAULT);
+#else
+        dataset = H5Dopen(_h5, path);
+#endif
+        if (dataset < 0) { throw std::runtime_error("Could not open dataset.");}
+    } else {
+        hsize_t dimsCreate[ndims];
+        dimsCreate[0] = istep+1;dimsCreate[1] = numPoints;dimsCreate[2] = fiberDim;
+        hsize_t maxDims[ndims];
+        maxDims[0] = H5S_UNLIMITED;maxDims[1] = numPoints;maxDims[2] = fiberDim;
+        hsize_t dimsChunk[ndims];
+        dimsChunk[0] = 1;dimsChunk[1] = numPoints;dimsChunk[2] = fiberDim;
+
+        hid_t filespace = H5Screate_simple(ndims, dimsCreate, maxDims);
+        if (filespace < 0) { throw std::runtime_error("Could not create filespace.");}
+        hid_t propertyCreate = H5Pcreate(H5P_DATASET_CREATE);
+        if (propertyCreate < 0) { throw std::runtime_error("Could not create dataset property.");}
+        if (H5Pset_chunk(propertyCreate, ndims, dimsChunk) < 0) { throw std::runtime_error("Could not set chunk size.");}
+#if defined(PYLITH_HDF5_USE_API_18)
+        hid_t propertyLink = H5Pcreate(H5P_LINK_CREATE);
+        if (propertyLink < 0) { throw std::runtime_error("Could not create link property.");}
+        if (H5Pset_create_intermediate_group(propertyLink, 1) < 0) { throw std::runtime_error("Could not set creation of intermediate groups.");}
+        dataset = H5Dcreate2(_h5, path, datatype, filespace, propertyLink, propertyCreate, H5P_DEFAULT);
+        if (H5Pclose(propertyLink) < 0) { throw std::runtime_error("Could not close link property.");}
+#else
+        dataset = H5Dcreate(_h5, path, datatype, filespace, propertyCreate);
+#endif
+        if (dataset < 0) { throw std::runtime_error("Could not create dataset.");}
+        if (H5Pclose(propertyCreate) < 0) { throw std::runtime_error("Could not close dataset property.");}
+        if (H5Sclose(filespace) < 0) { throw std::runtime_error("Could not close filespace.");}
+    } // if/else
+
+    // Extend the time dimension if needed (preallocation may already cover this step).
+    hid_t dataspace = H5Dget_space(dataset);
+    if (dataspace < 0) { throw std::runtime_error("Could not get dataspace.");}
+    hsize_t dims[ndims];
+    const int rank = H5Sget_simple_extent_dims(dataspace, dims, NULL);
+    if (H5Sclose(dataspace) < 0) { throw std::runtime_error("Could not close dataspace.");}
+    if (ndims != rank) { throw std::runtime_error("Expected dataset with rank 3.");}
+    if (istep+1 > dims[0]) {
+        dims[0] = istep+1;
+        if (H5Dset_extent(dataset, dims) < 0) { throw std::runtime_error("Could not set extent of dataset.");}
+    } // if
+
+    // Select the local slice of the time step and write it collectively.
+    dataspace = H5Dget_space(dataset);
+    if (dataspace < 0) { throw std::runtime_error("Could not get dataspace.");}
+    hsize_t offset[ndims];
+    offset[0] = istep;offset[1] = pointOffset;offset[2] = 0;
+    hsize_t count[ndims];
+    count[0] = 1;count[1] = numPointsLocal;count[2] = fiberDim;
+    herr_t err = (numPointsLocal > 0) ?
+                 H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offset, NULL, count, NULL) :
+                 H5Sselect_none(dataspace);
+    if (err < 0) { throw std::runtime_error("Could not select hyperslab.");}
+    hid_t memspace = H5Screate_simple(ndims, count, NULL);
+    if (memspace < 0) { throw std::runtime_error("Could not create memspace.");}
+
+    hid_t property = H5Pcreate(H5P_DATASET_XFER);
+    if (property < 0) { throw std::runtime_error("Could not create property.");}
+    H5Pset_dxpl_mpio(property, H5FD_MPIO_COLLECTIVE);
+
+    err = H5Dwrite(dataset, datatype, memspace, dataspace, property, values);
+    if (err < 0) { throw std::runtime_error("Could not write dataset.");}
+
+    if (H5Pclose(property) < 0) { throw std::runtime_error("Could not close property.");}
+    if (H5Sclose(memspace) < 0) { throw std::runtime_error("Could not close memspace.");}
+    if (H5Sclose(dataspace) < 0) { throw std::runtime_error("Could not close dataspace.");}
+    if (H5Dclose(dataset) < 0) { throw std::runtime_error("Could not close dataset.");}
+} // _writeSlice
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Throw std::runtime_error if the writer thread recorded an error.
+void
+pylith::meshio::DataWriterHDF5::AsyncWriter::_checkError(void) {
+    if (!_errorMsg.empty()) {
+        const std::string msg = _errorMsg;
+        throw std::runtime_error(msg);
+    } // if
+} // _checkError
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::DataWriterHDF5::DataWriterHDF5(void) :
     _filename("output.h5"),
     _viewer(0),
     _tstamp(0),
-    _tstampIndex(0) {
+    _asyncWriter(NULL),
+    _tstampIndex(0),
+    _istepOffset(0),
+    _asyncWrite(false),
+    _append(false) {
     PyreComponent::setName("datawriterhdf5");
 } // constructor
 
@@ -79,9 +677,16 @@ pylith::meshio::DataWriterHDF5::deallocate(void) {
 
     DataWriter::deallocate();
 
+    if (_asyncWriter) {
+        _asyncWriter->stop();
+    } // if
+
+    _truncateDatasets();
+
     PetscErrorCode err = 0;
     err = PetscViewerDestroy(&_viewer);PYLITH_CHECK_ERROR(err);assert(!_viewer);
     err = VecDestroy(&_tstamp);PYLITH_CHECK_ERROR(err);assert(!_tstamp);
+    delete _asyncWriter;_asyncWriter = NULL;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -94,7 +699,11 @@ pylith::meshio::DataWriterHDF5::DataWriterHDF5(const DataWriterHDF5& w) :
     _filename(w._filename),
     _viewer(0),
     _tstamp(0),
-    _tstampIndex(0) {}
+    _asyncWriter(NULL),
+    _tstampIndex(0),
+    _istepOffset(0),
+    _asyncWrite(w._asyncWrite),
+    _append(w._append) {}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -114,7 +723,9 @@ pylith::meshio::DataWriterHDF5::open(const pylith::topology::Mesh& mesh,
         const std::string& filename = hdf5Filename();
 
         _timesteps.clear();
+        _preallocatedDatasets.clear();
         _tstampIndex = 0;
+        _istepOffset = 0;
         PetscMPIInt commRank;
         err = MPI_Comm_rank(mesh.getComm(), &commRank);PYLITH_CHECK_ERROR(err);
         const int localSize = (!commRank) ? 1 : 0;
@@ -122,11 +733,83 @@ pylith::meshio::DataWriterHDF5::open(const pylith::topology::Mesh& mesh,
         err = VecSetBlockSize(_tstamp, 1);PYLITH_CHECK_ERROR(err);
         err = PetscObjectSetName((PetscObject) _tstamp, "time");PYLITH_CHECK_ERROR(err);
 
-        err = PetscViewerHDF5Open(mesh.getComm(), filename.c_str(), FILE_MODE_WRITE, &_viewer);PYLITH_CHECK_ERROR(err);
+        // When appending after a restart, resume the existing output file: the number of
+        // time steps already in the file offsets the indices of the new writes. The file
+        // must be self-consistent (every field dataset aligned with "/time").
+        bool isAppending = false;
+        if (_append && !isInfo) {
+            int numStepsInFile = 0;
+            if (!commRank) {
+                std::ifstream fin(filename.c_str());
+                if (fin.is_open()) {
+                    fin.close();
+                    HDF5 h5(filename.c_str(), H5F_ACC_RDONLY);
+                    if (h5.hasDataset("/time")) {
+                        hsize_t* dims = NULL;
+                        int ndims = 0;
+                        h5.getDatasetDims(&dims, &ndims, "/", "time");
+                        assert(ndims > 0);
+                        numStepsInFile = dims[0];
+                        delete[] dims;dims = NULL;
+                    } // if
+                    const char* groups[2] = { "/vertex_fields", "/cell_fields" };
+                    for (int igroup = 0; igroup < 2; ++igroup) {
+                        if (!h5.hasGroup(groups[igroup])) { continue;}
+                        string_vector datasets;
+                        h5.getGroupDatasets(&datasets, groups[igroup]);
+                        const size_t numDatasets = datasets.size();
+                        for (size_t i = 0; i < numDatasets; ++i) {
+                            hsize_t* dims = NULL;
+                            int ndims = 0;
+                            h5.getDatasetDims(&dims, &ndims, groups[igroup], datasets[i].c_str());
+                            const int numSteps = (ndims > 0) ? dims[0] : 0;
+                            delete[] dims;dims = NULL;
+                            if (numSteps != numStepsInFile) {
+                                std::ostringstream msg;
+                                msg << "Cannot append to HDF5 file '" << filename << "'. Dataset '"
+                                    << groups[igroup] << "/" << datasets[i] << "' has " << numSteps
+                                    << " time steps; expected " << numStepsInFile
+                                    << " to match '/time'.";
+                                throw std::runtime_error(msg.str());
+                            } // if
+                        } // for
+                    } // for
+                    h5.close();
+                } // if
+            } // if
+            err = MPI_Bcast(&numStepsInFile, 1, MPI_INT, 0, mesh.getComm());PYLITH_CHECK_ERROR(err);
+            if (numStepsInFile > 0) {
+                isAppending = true;
+                _istepOffset = numStepsInFile;
+                _tstampIndex = numStepsInFile;
+            } // if
+        } // if
+
+        if (_asyncWrite && !isInfo) {
+            int mpiThreadLevel = MPI_THREAD_SINGLE;
+            err = MPI_Query_thread(&mpiThreadLevel);PYLITH_CHECK_ERROR(err);
+            if (mpiThreadLevel >= MPI_THREAD_MULTIPLE) {
+                _asyncWriter = new AsyncWriter(mesh.getComm());assert(_asyncWriter);
+            } else {
+                PYLITH_COMPONENT_WARNING("MPI does not provide MPI_THREAD_MULTIPLE; writing HDF5 output synchronously.");
+            } // if/else
+        } // if
+        MPI_Comm comm = (_asyncWriter) ? _asyncWriter->getComm() : mesh.getComm();
+
+        err = PetscViewerHDF5Open(comm, filename.c_str(), isAppending ? FILE_MODE_APPEND : FILE_MODE_WRITE, &_viewer);PYLITH_CHECK_ERROR(err);
         err = PetscViewerPushFormat(_viewer, PETSC_VIEWER_HDF5_VIZ);PYLITH_CHECK_ERROR(err);
         err = PetscViewerHDF5SetBaseDimension2(_viewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
 
-        err = DMView(mesh.getDM(), _viewer);PYLITH_CHECK_ERROR(err);
+        if (!isAppending) { // topology and geometry are already in the file when appending
+            err = DMView(mesh.getDM(), _viewer);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        if (_asyncWriter) {
+            if (DataWriter::_expectedNumWrites > 0) {
+                _asyncWriter->setExpectedExtent(_istepOffset + DataWriter::_expectedNumWrites);
+            } // if
+            _asyncWriter->start(_viewer);
+        } // if
 
     } catch (const std::exception& err) {
         std::ostringstream msg;
@@ -148,6 +831,20 @@ void
 pylith::meshio::DataWriterHDF5::close(void) {
     PYLITH_METHOD_BEGIN;
 
+    if (_asyncWriter) {
+        try {
+            _asyncWriter->stop();
+        } catch (const std::exception& err) {
+            delete _asyncWriter;_asyncWriter = NULL;
+            std::ostringstream msg;
+            msg << "Error while writing HDF5 file '" << hdf5Filename() << "'.\n" << err.what();
+            throw std::runtime_error(msg.str());
+        } // try/catch
+        delete _asyncWriter;_asyncWriter = NULL;
+    } // if
+
+    _truncateDatasets();
+
     PetscErrorCode err = 0;
     err = PetscViewerDestroy(&_viewer);PYLITH_CHECK_ERROR(err);assert(!_viewer);
     err = VecDestroy(&_tstamp);PYLITH_CHECK_ERROR(err);assert(!_tstamp);
@@ -188,7 +885,7 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
         PetscErrorCode err;
 
         if (_timesteps.find(name) == _timesteps.end()) {
-            _timesteps[name] = 0;
+            _timesteps[name] = _istepOffset;
         } else {
             _timesteps[name] += 1;
         }
@@ -198,6 +895,11 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
         err = PetscObjectGetComm((PetscObject)subfield.getDM(), &comm);PYLITH_CHECK_ERROR(err);
         PetscMPIInt commRank;
         err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+
+        if (_asyncWriter) {
+            _enqueueField(t, subfield, "/vertex_fields", istep);
+            PYLITH_METHOD_END;
+        } // if
         if (_tstampIndex == istep) {
             _writeTimeStamp(t, commRank);
         } // if
@@ -225,6 +927,10 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
             const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
             HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", sattr);
         } // if
+        if ((_istepOffset == istep) && (DataWriter::_expectedNumWrites > 0) && !DataWriter::_isInfo) {
+            const std::string fullName = std::string("/vertex_fields/") + std::string(name);
+            _preallocateDataset(fullName.c_str(), name);
+        } // if
 
     } catch (const std::exception& err) {
         std::ostringstream msg;
@@ -257,7 +963,7 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
         PetscErrorCode err;
 
         if (_timesteps.find(name) == _timesteps.end()) {
-            _timesteps[name] = 0;
+            _timesteps[name] = _istepOffset;
         } else {
             _timesteps[name] += 1;
         }
@@ -267,6 +973,11 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
         err = PetscObjectGetComm((PetscObject)subfield.getDM(), &comm);PYLITH_CHECK_ERROR(err);
         PetscMPIInt commRank;
         err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+
+        if (_asyncWriter) {
+            _enqueueField(t, subfield, "/cell_fields", istep);
+            PYLITH_METHOD_END;
+        } // if
         if (_tstampIndex == istep) {
             _writeTimeStamp(t, commRank);
         } // if
@@ -294,6 +1005,10 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
             const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
             HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", sattr);
         } // if
+        if ((_istepOffset == istep) && (DataWriter::_expectedNumWrites > 0) && !DataWriter::_isInfo) {
+            const std::string fullName = std::string("/cell_fields/") + std::string(name);
+            _preallocateDataset(fullName.c_str(), name);
+        } // if
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while writing field '" << name << "' at time "
@@ -310,6 +1025,118 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
 } // writeCellField
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Snapshot field and submit it to the background writer.
+void
+pylith::meshio::DataWriterHDF5::_enqueueField(const PylithScalar t,
+                                              const pylith::meshio::OutputSubfield& subfield,
+                                              const char* group,
+                                              const int istep) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_asyncWriter);
+
+    PetscErrorCode err = 0;
+    PetscVec vector = subfield.getVector();assert(vector);
+    PetscInt localSize = 0;
+    PetscInt globalSize = 0;
+    PetscInt globalOffset = 0;
+    PetscInt blockSize = 0;
+    err = VecGetLocalSize(vector, &localSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(vector, &globalSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(vector, &globalOffset, NULL);PYLITH_CHECK_ERROR(err);
+    err = VecGetBlockSize(vector, &blockSize);PYLITH_CHECK_ERROR(err);
+
+    AsyncWriter::Task* task = _asyncWriter->acquireTask();
+    task->group = group;
+    task->name = subfield.getDescription().label;
+    task->vectorFieldType = (0 == istep) ? pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType) : "";
+    task->globalSize = globalSize;
+    task->globalOffset = globalOffset;
+    task->blockSize = blockSize;
+    task->istep = istep;
+    task->tstampIndex = _tstampIndex;
+    task->tDim = t * DataWriter::_timeScale;
+    task->writeTimeStamp = (_tstampIndex == istep);
+    task->preallocatePath = "";
+    task->preallocateTime = false;
+    if (DataWriter::_expectedNumWrites > 0) {
+        // The background thread performs the (collective) preallocation after creating the
+        // dataset; record the path here so close() can truncate to the steps actually written.
+        if (_istepOffset == istep) {
+            task->preallocatePath = task->group + "/" + task->name;
+            _preallocatedDatasets[task->name] = task->preallocatePath;
+        } // if
+        if (task->writeTimeStamp && (_istepOffset == _tstampIndex)) {
+            task->preallocateTime = true;
+            _preallocatedDatasets[""] = "/time";
+        } // if
+    } // if
+    const bool writeTimeStamp = task->writeTimeStamp;
+
+    const PetscScalar* array = NULL;
+    err = VecGetArrayRead(vector, &array);PYLITH_CHECK_ERROR(err);
+    task->stage(array, localSize);
+    err = VecRestoreArrayRead(vector, &array);PYLITH_CHECK_ERROR(err);
+
+    // The task buffer may be recycled as soon as it is submitted.
+    _asyncWriter->submit(task);
+    if (writeTimeStamp) {
+        _tstampIndex++;
+    } // if
+
+    PYLITH_METHOD_END;
+} // _enqueueField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Preallocate time dimension of a dataset to the expected number of writes.
+void
+pylith::meshio::DataWriterHDF5::_preallocateDataset(const char* path,
+                                                    const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_viewer);
+    assert(DataWriter::_expectedNumWrites > 0);
+
+    hid_t h5 = -1;
+    PetscErrorCode err = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(err);
+    assert(h5 >= 0);
+    _DataWriterHDF5::setDatasetTimeExtent(h5, path, _istepOffset + DataWriter::_expectedNumWrites);
+    _preallocatedDatasets[name] = path;
+
+    PYLITH_METHOD_END;
+} // _preallocateDataset
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Truncate preallocated datasets to the number of time steps actually written.
+void
+pylith::meshio::DataWriterHDF5::_truncateDatasets(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_preallocatedDatasets.empty() || !_viewer) { PYLITH_METHOD_END; }
+
+    hid_t h5 = -1;
+    PetscErrorCode err = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(err);
+    assert(h5 >= 0);
+    typedef std::map<std::string, std::string> datasets_t;
+    for (datasets_t::const_iterator iter = _preallocatedDatasets.begin(); iter != _preallocatedDatasets.end(); ++iter) {
+        const std::string& name = iter->first;
+        const std::string& path = iter->second;
+        if (name.empty()) { // time stamp dataset
+            _DataWriterHDF5::setDatasetTimeExtent(h5, path.c_str(), _tstampIndex);
+        } else {
+            assert(_timesteps.count(name));
+            _DataWriterHDF5::setDatasetTimeExtent(h5, path.c_str(), _timesteps[name] + 1);
+        } // if/else
+    } // for
+    _preallocatedDatasets.clear();
+
+    PYLITH_METHOD_END;
+} // _truncateDatasets
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write dataset with names of points to file.
 void
@@ -319,6 +1146,12 @@ pylith::meshio::DataWriterHDF5::writePointNames(const pylith::string_vector& nam
 
     assert(_viewer);
 
+    if (_asyncWriter) {
+        // The main thread writes directly to the file, so wait for pending
+        // background writes to finish.
+        _asyncWriter->drain();
+    } // if
+
     char* namesFixedLength = NULL;
     try {
         // Put station names into array of fixed length strings
@@ -490,6 +1323,10 @@ pylith::meshio::DataWriterHDF5::_writeTimeStamp(const PylithScalar t,
     err = PetscViewerHDF5PopTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
     err = PetscViewerHDF5PopGroup(_viewer);PYLITH_CHECK_ERROR(err);
 
+    if ((_istepOffset == _tstampIndex) && (DataWriter::_expectedNumWrites > 0) && !DataWriter::_isInfo) {
+        _preallocateDataset("/time", "");
+    } // if
+
     _tstampIndex++;
 } // _writeTimeStamp
 
@@ -84,6 +84,28 @@ public:
      */
     void filename(const char* filename);
 
+    /** Set flag for writing fields on a background thread.
+     *
+     * Fields are snapshotted into a double buffer and written while time
+     * stepping continues. Requires MPI_THREAD_MULTIPLE; falls back to
+     * synchronous writes with a warning otherwise.
+     *
+     * @param[in] flag True if writing fields on a background thread.
+     */
+    void setAsyncWrite(const bool flag);
+
+    /** Set flag for appending to an existing output file after a restart.
+     *
+     * On open() the writer reopens the existing HDF5 file, verifies its time
+     * steps are aligned, and appends new time steps after the existing ones
+     * instead of truncating the file. Falls back to truncating if the file
+     * does not exist. The Xdmf metadata file is regenerated on close() and
+     * covers the combined time steps.
+     *
+     * @param[in] flag True if appending to an existing output file.
+     */
+    void setAppend(const bool flag);
+
     /** Generate filename for HDF5 file.
      *
      * Appends _info if only writing parameters.
@@ -149,15 +171,50 @@ private:
     void _writeTimeStamp(const PylithScalar t,
                          const int commRank);
 
+    /** Snapshot field and submit it to the background writer.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield to write.
+     * @param[in] group HDF5 group for field.
+     * @param[in] istep Time step index for field.
+     */
+    void _enqueueField(const PylithScalar t,
+                       const pylith::meshio::OutputSubfield& subfield,
+                       const char* group,
+                       const int istep);
+
+    /** Preallocate time dimension of a dataset to the expected number of writes.
+     *
+     * Extending datasets incrementally with each write churns HDF5 metadata and serializes
+     * parallel writes on the file locks; preallocating the full extent at the first write
+     * leaves only the hyperslab writes. Datasets are truncated to the actual number of
+     * writes on close.
+     *
+     * @param[in] path Full path of dataset.
+     * @param[in] name Name of field ("" for the time stamp dataset).
+     */
+    void _preallocateDataset(const char* path,
+                             const char* name);
+
+    /// Truncate preallocated datasets to the number of time steps actually written.
+    void _truncateDatasets(void);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
+    class AsyncWriter; ///< Background thread writing snapshotted fields.
+
     std::string _filename; ///< Name of HDF5 file.
     PetscViewer _viewer; ///< Output file.
     PetscVec _tstamp; ///< Single value vector holding time stamp.
+    AsyncWriter* _asyncWriter; ///< Background writer (NULL if writing synchronously).
 
     std::map<std::string, int> _timesteps; ///< # of time steps written per field.
+    std::map<std::string, std::string> _preallocatedDatasets; ///< Full dataset path per field with preallocated extent.
     int _tstampIndex; ///< Index of last time stamp written.
+    int _istepOffset; ///< # of time steps in file when opened (nonzero when appending after restart).
+    bool _asyncWrite; ///< Write fields on a background thread if true.
+    bool _append; ///< Append to existing output file instead of truncating if true.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
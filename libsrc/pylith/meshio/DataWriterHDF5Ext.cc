@@ -36,6 +36,7 @@
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
+#include <strings.h> // USES strcasecmp()
 
 extern "C" {
     extern PetscErrorCode VecView_Seq(Vec,
@@ -51,7 +52,12 @@ extern "C" {
 pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(void) :
     _filename("output.h5"),
     _h5(new HDF5),
-    _tstampIndex(0) { // constructor
+    _tstampIndex(0),
+    _bufferSize(1),
+    _compressionFilter("deflate"),
+    _compressionLevel(6),
+    _scaleOffsetDecimals(-1),
+    _rankBlockLayout(false) { // constructor
 } // constructor
 
 
@@ -77,7 +83,13 @@ pylith::meshio::DataWriterHDF5Ext::deallocate(void) {
          d_iter != dEnd;
          ++d_iter) {
         err = PetscViewerDestroy(&d_iter->second.viewer);PYLITH_CHECK_ERROR(err);
+        const size_t numBuffered = d_iter->second.buffer.size();
+        for (size_t i = 0; i < numBuffered; ++i) {
+            err = VecDestroy(&d_iter->second.buffer[i]);PYLITH_CHECK_ERROR(err);
+        } // for
+        d_iter->second.buffer.clear();
     } // for
+    _tstampBuffer.clear();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -89,7 +101,14 @@ pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(const DataWriterHDF5Ext& w)
     DataWriter(w),
     _filename(w._filename),
     _h5(new HDF5),
-    _tstampIndex(0) { // copy constructor
+    _tstampIndex(0),
+    _bufferSize(w._bufferSize),
+    _compressionFilter(w._compressionFilter),
+    _compressionLevel(w._compressionLevel),
+    _scaleOffsetDecimals(w._scaleOffsetDecimals),
+    _rankBlockLayout(w._rankBlockLayout) { // copy constructor
+    setCompressionFilter(_compressionFilter.c_str());
+    _h5->setScaleOffset(_scaleOffsetDecimals);
 } // copy constructor
 
 
@@ -102,6 +121,8 @@ pylith::meshio::DataWriterHDF5Ext::open(const pylith::topology::Mesh& mesh,
 
     assert(_h5);
     _datasets.clear();
+    _tstampBuffer.clear();
+    _permutationWritten.clear();
 
     try {
         DataWriter::open(mesh, isInfo);
@@ -142,6 +163,8 @@ void
 pylith::meshio::DataWriterHDF5Ext::close(void) {
     PYLITH_METHOD_BEGIN;
 
+    _flushBuffers();
+
     DataWriter::_context = "";
 
     if (_h5->isOpen()) {
@@ -156,6 +179,90 @@ pylith::meshio::DataWriterHDF5Ext::close(void) {
 } // close
 
 
+// ----------------------------------------------------------------------
+// Set number of time steps to buffer in memory before writing to the data files.
+void
+pylith::meshio::DataWriterHDF5Ext::setBufferSize(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Buffer size (" << value << ") for HDF5 data writer must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _bufferSize = value;
+
+    PYLITH_METHOD_END;
+} // setBufferSize
+
+
+// ----------------------------------------------------------------------
+// Set compression filter applied to chunked datasets.
+void
+pylith::meshio::DataWriterHDF5Ext::setCompressionFilter(const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_h5);
+    if (0 == strcasecmp(name, "none")) {
+        _h5->setCompression(HDF5::FILTER_NONE, _compressionLevel);
+    } else if (0 == strcasecmp(name, "deflate")) {
+        _h5->setCompression(HDF5::FILTER_DEFLATE, _compressionLevel);
+    } else {
+        std::ostringstream msg;
+        msg << "Unknown compression filter '" << name << "' for HDF5 data writer. "
+            << "Known filters: 'none', 'deflate'. Other filters (e.g., zstd) require an HDF5 filter plugin.";
+        throw std::runtime_error(msg.str());
+    } // if/else
+    _compressionFilter = name;
+
+    PYLITH_METHOD_END;
+} // setCompressionFilter
+
+
+// ----------------------------------------------------------------------
+// Set compression level for the deflate filter.
+void
+pylith::meshio::DataWriterHDF5Ext::setCompressionLevel(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if ((value < 0) || (value > 9)) {
+        std::ostringstream msg;
+        msg << "Compression level (" << value << ") for HDF5 data writer must be in the range 0-9.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _compressionLevel = value;
+    setCompressionFilter(_compressionFilter.c_str());
+
+    PYLITH_METHOD_END;
+} // setCompressionLevel
+
+
+// ----------------------------------------------------------------------
+// Set number of decimal digits preserved by the scale-offset filter.
+void
+pylith::meshio::DataWriterHDF5Ext::setScaleOffsetDecimals(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_h5);
+    _scaleOffsetDecimals = value;
+    _h5->setScaleOffset(value);
+
+    PYLITH_METHOD_END;
+} // setScaleOffsetDecimals
+
+
+// ----------------------------------------------------------------------
+// Set whether datasets are laid out as rank-contiguous blocks.
+void
+pylith::meshio::DataWriterHDF5Ext::setRankBlockLayout(const bool value) {
+    PYLITH_METHOD_BEGIN;
+
+    _rankBlockLayout = value;
+
+    PYLITH_METHOD_END;
+} // setRankBlockLayout
+
+
 // ----------------------------------------------------------------------
 // Write field over vertices to file.
 void
@@ -183,7 +290,17 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
         if (_datasets.find(name) != _datasets.end()) {
             binaryViewer = _datasets[name].viewer;
         } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
+            if (_rankBlockLayout) {
+                // MPI-IO must be requested before the file is opened; each process then
+                // writes its block of rows directly instead of funneling through the root.
+                err = PetscViewerCreate(comm, &binaryViewer);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerSetType(binaryViewer, PETSCVIEWERBINARY);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerBinarySetUseMPIIO(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerFileSetMode(binaryViewer, FILE_MODE_WRITE);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerFileSetName(binaryViewer, _datasetFilename(name).c_str());PYLITH_CHECK_ERROR(err);
+            } else {
+                err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
+            } // if/else
             err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
             ExternalDataset dataset;
             dataset.numTimeSteps = 0;
@@ -194,25 +311,20 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
         } // else
         assert(binaryViewer);
 
+        // Buffer copy of field; values and time stamps are flushed to the files in batches
+        // in _flushBuffers() so many small collective writes become a few large ones.
         PetscVec vector = subfield.getVector();assert(vector);
-        PetscBool isseq;
-        err = PetscObjectTypeCompare((PetscObject) vector, VECSEQ, &isseq);PYLITH_CHECK_ERROR(err);
-        if (isseq) {
-            err = VecView_Seq(vector, binaryViewer);PYLITH_CHECK_ERROR(err);
-        } else {
-            err = VecView_MPI(vector, binaryViewer);PYLITH_CHECK_ERROR(err);
-        } // if/else
+        PetscVec vectorCopy = NULL;
+        err = VecDuplicate(vector, &vectorCopy);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(vector, vectorCopy);PYLITH_CHECK_ERROR(err);
 
         ExternalDataset& datasetInfo = _datasets[name];
+        datasetInfo.buffer.push_back(vectorCopy);
         ++datasetInfo.numTimeSteps;
 
-        // Update time stamp in "/time, if necessary.
-        if (isMPIRoot) {
-            _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
-
-            if (_tstampIndex+1 == datasetInfo.numTimeSteps) {
-                _writeTimeStamp(t);
-            } // if
+        // Buffer time stamp, if necessary.
+        if (_tstampIndex + PetscInt(_tstampBuffer.size()) + 1 == datasetInfo.numTimeSteps) {
+            _tstampBuffer.push_back(t);
         } // if
 
         // Add dataset to HDF5 file, if necessary
@@ -245,8 +357,16 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
 
             datasetInfo.numPoints = numVertices;
             datasetInfo.fiberDim = fiberDim;
+            datasetInfo.hdf5Group = "/vertex_fields";
+
+            if (_rankBlockLayout && !_permutationWritten["/vertex_fields"]) {
+                _writePermutation("/vertex_fields", globalVertexNumbers, numVertices);
+                _permutationWritten["/vertex_fields"] = true;
+            } // if
 
             if (isMPIRoot) {
+                _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
+
                 // Add new external dataset to HDF5 file.
                 const hsize_t ndims = 3;
                 hsize_t maxDims[ndims];
@@ -269,20 +389,16 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
                 std::string fullName = std::string("/vertex_fields/") + name;
                 const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
                 _h5->writeAttribute(fullName.c_str(), "vector_field_type", sattr);
-            } // if
-        } else if (isMPIRoot) {
-            // Update number of time steps in external dataset info in HDF5 file.
-            const hsize_t ndims = 3;
-            hsize_t dims[3];
-            dims[0] = datasetInfo.numTimeSteps; // update to current value
-            dims[1] = datasetInfo.numPoints;
-            dims[2] = datasetInfo.fiberDim;
+                if (_rankBlockLayout) {
+                    _h5->writeAttribute(fullName.c_str(), "layout", "rank_block");
+                } // if
 
-            _h5->extendDatasetRawExternal("/vertex_fields", name, dims, ndims);
-        } // if/else
+                _h5->close();
+            } // if
+        } // if
 
-        if (isMPIRoot) {
-            _h5->close();
+        if (int(datasetInfo.buffer.size()) >= _bufferSize) {
+            _flushBuffers();
         } // if
     } catch (const std::exception& err) {
         std::ostringstream msg;
@@ -327,7 +443,17 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
         if (_datasets.find(name) != _datasets.end()) {
             binaryViewer = _datasets[name].viewer;
         } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
+            if (_rankBlockLayout) {
+                // MPI-IO must be requested before the file is opened; each process then
+                // writes its block of rows directly instead of funneling through the root.
+                err = PetscViewerCreate(comm, &binaryViewer);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerSetType(binaryViewer, PETSCVIEWERBINARY);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerBinarySetUseMPIIO(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerFileSetMode(binaryViewer, FILE_MODE_WRITE);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerFileSetName(binaryViewer, _datasetFilename(name).c_str());PYLITH_CHECK_ERROR(err);
+            } else {
+                err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
+            } // if/else
             err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
             ExternalDataset dataset;
             dataset.numTimeSteps = 0;
@@ -338,25 +464,20 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
         } // else
         assert(binaryViewer);
 
+        // Buffer copy of field; values and time stamps are flushed to the files in batches
+        // in _flushBuffers() so many small collective writes become a few large ones.
         PetscVec vector = subfield.getVector();assert(vector);
-        PetscBool isseq;
-        err = PetscObjectTypeCompare((PetscObject) vector, VECSEQ, &isseq);PYLITH_CHECK_ERROR(err);
-        if (isseq) {
-            err = VecView_Seq(vector, binaryViewer);PYLITH_CHECK_ERROR(err);
-        } else {
-            err = VecView_MPI(vector, binaryViewer);PYLITH_CHECK_ERROR(err);
-        } // if/else
+        PetscVec vectorCopy = NULL;
+        err = VecDuplicate(vector, &vectorCopy);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(vector, vectorCopy);PYLITH_CHECK_ERROR(err);
 
         ExternalDataset& datasetInfo = _datasets[name];
+        datasetInfo.buffer.push_back(vectorCopy);
         ++datasetInfo.numTimeSteps;
 
-        // Update time stamp in "/time, if necessary.
-        if (isMPIRoot) {
-            _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
-
-            if (_tstampIndex+1 == datasetInfo.numTimeSteps) {
-                _writeTimeStamp(t);
-            } // if
+        // Buffer time stamp, if necessary.
+        if (_tstampIndex + PetscInt(_tstampBuffer.size()) + 1 == datasetInfo.numTimeSteps) {
+            _tstampBuffer.push_back(t);
         } // if
 
         // Add dataset to HDF5 file, if necessary
@@ -388,8 +509,16 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
 
             datasetInfo.numPoints = numCells;
             datasetInfo.fiberDim = fiberDim;
+            datasetInfo.hdf5Group = "/cell_fields";
+
+            if (_rankBlockLayout && !_permutationWritten["/cell_fields"]) {
+                _writePermutation("/cell_fields", globalCellNumbers, numCells);
+                _permutationWritten["/cell_fields"] = true;
+            } // if
 
             if (isMPIRoot) {
+                _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
+
                 // Add new external dataset to HDF5 file.
                 const hsize_t ndims = 3;
                 hsize_t maxDims[ndims];
@@ -412,20 +541,16 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
                 std::string fullName = std::string("/cell_fields/") + name;
                 const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
                 _h5->writeAttribute(fullName.c_str(), "vector_field_type", sattr);
-            } // if
+                if (_rankBlockLayout) {
+                    _h5->writeAttribute(fullName.c_str(), "layout", "rank_block");
+                } // if
 
-        } else if (isMPIRoot) {
-            // Update number of time steps in external dataset info in HDF5 file.
-            const hsize_t ndims = 3;
-            hsize_t dims[3];
-            dims[0] = datasetInfo.numTimeSteps; // update to current value
-            dims[1] = datasetInfo.numPoints;
-            dims[2] = datasetInfo.fiberDim;
-            _h5->extendDatasetRawExternal("/cell_fields", name, dims, ndims);
-        } // if/else
+                _h5->close();
+            } // if
+        } // if
 
-        if (isMPIRoot) {
-            _h5->close();
+        if (int(datasetInfo.buffer.size()) >= _bufferSize) {
+            _flushBuffers();
         } // if
     } catch (const std::exception& err) {
         std::ostringstream msg;
@@ -599,4 +724,153 @@ pylith::meshio::DataWriterHDF5Ext::_writeTimeStamp(const PylithScalar t) {
 } // _writeTimeStamp
 
 
+// ----------------------------------------------------------------------
+// Write permutation dataset with global point numbers for the rows of a group's datasets.
+void
+pylith::meshio::DataWriterHDF5Ext::_writePermutation(const char* group,
+                                                     PetscIS numbering,
+                                                     const int numPoints) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_h5);
+    assert(numbering);
+
+    MPI_Comm comm;
+    PetscMPIInt commRank;
+    int nprocs = 0;
+    const int commRoot = 0;
+    PetscErrorCode err = PetscObjectGetComm((PetscObject) numbering, &comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &nprocs);PYLITH_CHECK_ERROR(err);
+    const bool isMPIRoot = commRoot == commRank;
+
+    // Collect global numbers of the owned points; the rows each process writes to the data
+    // files appear in this order.
+    PetscInt n = 0;
+    int numPointsLocal = 0;
+    err = ISGetLocalSize(numbering, &n);PYLITH_CHECK_ERROR(err);
+    const PetscInt* indices = NULL;
+    if (n > 0) {
+        err = ISGetIndices(numbering, &indices);PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = 0; p < n; ++p) {
+            if (indices[p] >= 0) {++numPointsLocal;}
+        } // for
+    } // if
+    int_array permutationLocal(numPointsLocal);
+    if (n > 0) {
+        for (PetscInt p = 0, index = 0; p < n; ++p) {
+            if (indices[p] >= 0) {permutationLocal[index++] = indices[p];}
+        } // for
+        err = ISRestoreIndices(numbering, &indices);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Gather global numbers onto the root process in rank order.
+    int_array numPointsArray(nprocs);
+    err = MPI_Gather(&numPointsLocal, 1, MPI_INT, &numPointsArray[0], 1, MPI_INT, commRoot, comm);PYLITH_CHECK_ERROR(err);
+    int_array permutation;
+    int_array offsets;
+    if (isMPIRoot) {
+        permutation.resize(numPoints);
+        offsets.resize(nprocs);
+        offsets[0] = 0;
+        for (int i = 1; i < nprocs; ++i) {
+            offsets[i] = offsets[i-1] + numPointsArray[i-1];
+        } // for
+    } // if
+    err = MPI_Gatherv(&permutationLocal[0], numPointsLocal, MPI_INT, &permutation[0], &numPointsArray[0], &offsets[0], MPI_INT, commRoot, comm);PYLITH_CHECK_ERROR(err);
+
+    if (isMPIRoot) {
+        _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
+        if (!_h5->hasGroup(group)) {
+            _h5->createGroup(group);
+        } // if
+
+        const hsize_t ndims = 2;
+        hsize_t dims[ndims];
+        dims[0] = 1;
+        dims[1] = numPoints;
+        _h5->createDataset(group, "permutation", dims, dims, ndims, H5T_NATIVE_INT);
+        _h5->writeDatasetChunk(group, "permutation", &permutation[0], dims, dims, ndims, 0, H5T_NATIVE_INT);
+
+        _h5->close();
+    } // if
+
+    PYLITH_METHOD_END;
+} // _writePermutation
+
+
+// ----------------------------------------------------------------------
+// Flush buffered field values and time stamps to the output files.
+void
+pylith::meshio::DataWriterHDF5Ext::_flushBuffers(void) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_h5);
+
+    size_t numBufferedTotal = _tstampBuffer.size();
+    const dataset_type::iterator dEnd = _datasets.end();
+    for (dataset_type::const_iterator d_iter = _datasets.begin(); d_iter != dEnd; ++d_iter) {
+        numBufferedTotal += d_iter->second.buffer.size();
+    } // for
+    if (0 == numBufferedTotal) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode err = 0;
+    bool isMPIRoot = true;
+    for (dataset_type::iterator d_iter = _datasets.begin(); d_iter != dEnd; ++d_iter) {
+        ExternalDataset& datasetInfo = d_iter->second;
+
+        MPI_Comm comm;
+        PetscMPIInt commRank;
+        err = PetscObjectGetComm((PetscObject) datasetInfo.viewer, &comm);PYLITH_CHECK_ERROR(err);
+        err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+        isMPIRoot = 0 == commRank;
+
+        // Stream buffered time steps to the external data file back to back, so the writes
+        // aggregate into large sequential transfers.
+        const size_t numBuffered = datasetInfo.buffer.size();
+        for (size_t i = 0; i < numBuffered; ++i) {
+            PetscVec vector = datasetInfo.buffer[i];assert(vector);
+            PetscBool isseq;
+            err = PetscObjectTypeCompare((PetscObject) vector, VECSEQ, &isseq);PYLITH_CHECK_ERROR(err);
+            if (isseq) {
+                err = VecView_Seq(vector, datasetInfo.viewer);PYLITH_CHECK_ERROR(err);
+            } else {
+                err = VecView_MPI(vector, datasetInfo.viewer);PYLITH_CHECK_ERROR(err);
+            } // if/else
+            err = VecDestroy(&datasetInfo.buffer[i]);PYLITH_CHECK_ERROR(err);
+        } // for
+        datasetInfo.buffer.clear();
+    } // for
+
+    // Update HDF5 metadata (time stamps and dataset dimensions) once per flush.
+    if (isMPIRoot) {
+        _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
+
+        const size_t numTStamps = _tstampBuffer.size();
+        for (size_t i = 0; i < numTStamps; ++i) {
+            _writeTimeStamp(_tstampBuffer[i]);
+        } // for
+
+        if (!DataWriter::_isInfo) {
+            for (dataset_type::const_iterator d_iter = _datasets.begin(); d_iter != dEnd; ++d_iter) {
+                const ExternalDataset& datasetInfo = d_iter->second;
+                const hsize_t ndims = 3;
+                hsize_t dims[3];
+                dims[0] = datasetInfo.numTimeSteps; // update to current value
+                dims[1] = datasetInfo.numPoints;
+                dims[2] = datasetInfo.fiberDim;
+                _h5->extendDatasetRawExternal(datasetInfo.hdf5Group.c_str(), d_iter->first.c_str(), dims, ndims);
+            } // for
+        } // if
+
+        _h5->close();
+    } // if
+    _tstampBuffer.clear();
+
+    PYLITH_METHOD_END;
+} // _flushBuffers
+
+
 // End of file
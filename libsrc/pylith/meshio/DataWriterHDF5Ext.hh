@@ -47,6 +47,7 @@
 
 #include <string> // USES std::string
 #include <map> // HASA std::map
+#include <vector> // HASA std::vector
 
 // DataWriterHDF5Ext ----------------------------------------------------
 /// Object for writing finite-element data to HDF5 file.
@@ -81,6 +82,45 @@ public:
      */
     void filename(const char* filename);
 
+    /** Set number of time steps to buffer in memory before writing to the data files.
+     *
+     * Field values and time stamps are accumulated in memory and flushed as one batch of
+     * large writes, rather than one small write per subfield per time step.
+     *
+     * @param[in] value Number of time steps to buffer (>= 1).
+     */
+    void setBufferSize(const int value);
+
+    /** Set compression filter applied to chunked datasets.
+     *
+     * @param[in] name Name of filter ("none" or "deflate").
+     */
+    void setCompressionFilter(const char* name);
+
+    /** Set compression level for the deflate filter.
+     *
+     * @param[in] value Compression level (0-9).
+     */
+    void setCompressionLevel(const int value);
+
+    /** Set number of decimal digits preserved by the lossy scale-offset
+     * filter for floating-point datasets.
+     *
+     * @param[in] value Number of decimal digits; negative value disables the filter.
+     */
+    void setScaleOffsetDecimals(const int value);
+
+    /** Set whether datasets are laid out as rank-contiguous blocks.
+     *
+     * Each process writes its block of values directly to the external data file with MPI-IO,
+     * eliminating the funneling of values through the root process from the write path. The
+     * global point numbers for the rows are stored once per group in a 'permutation' dataset,
+     * so readers that want global ordering apply the permutation at read time.
+     *
+     * @param[in] value True if datasets are laid out as rank-contiguous blocks.
+     */
+    void setRankBlockLayout(const bool value);
+
     /** Generate filename for HDF5 file.
      *
      * Appends _info if only writing parameters.
@@ -146,6 +186,22 @@ private:
      */
     void _writeTimeStamp(const PylithScalar t);
 
+    /** Write permutation dataset with global point numbers for the rows of a group's datasets.
+     *
+     * Collective. The permutation is written only once per group; the global point numbers
+     * are gathered onto the root process in the order the rows appear in the data files.
+     *
+     * @param[in] group HDF5 group holding the datasets ("/vertex_fields" or "/cell_fields").
+     * @param[in] numbering PETSc IS with global point numbers (negative for unowned points).
+     * @param[in] numPoints Total number of points across all processes.
+     */
+    void _writePermutation(const char* group,
+                           PetscIS numbering,
+                           const int numPoints);
+
+    /// Flush buffered field values and time stamps to the output files.
+    void _flushBuffers(void);
+
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
@@ -159,6 +215,8 @@ private:
         PetscInt numTimeSteps;
         PetscInt numPoints;
         PetscInt fiberDim;
+        std::string hdf5Group; ///< HDF5 group holding dataset ("/vertex_fields" or "/cell_fields").
+        std::vector<PetscVec> buffer; ///< Field values buffered in memory, not yet written.
     };
     typedef std::map<std::string, ExternalDataset> dataset_type;
 
@@ -169,6 +227,13 @@ private:
     HDF5* _h5; ///< HDF5 file
     dataset_type _datasets; ///< Datasets
     int _tstampIndex; ///< Index of last time stamp written.
+    int _bufferSize; ///< Number of time steps to buffer before flushing to data files.
+    std::string _compressionFilter; ///< Name of compression filter for chunked datasets.
+    int _compressionLevel; ///< Compression level for deflate filter.
+    int _scaleOffsetDecimals; ///< Decimal digits preserved by scale-offset filter (negative disables).
+    bool _rankBlockLayout; ///< Write datasets as rank-contiguous blocks with a stored permutation.
+    std::map<std::string, bool> _permutationWritten; ///< Groups whose permutation dataset has been written.
+    std::vector<PylithScalar> _tstampBuffer; ///< Time stamps buffered in memory, not yet written.
 
 }; // DataWriterHDF5Ext
 
@@ -0,0 +1,160 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterMemory.hh" // Implementation of class methods
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "petscvec.h" // USES PetscVec
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterMemory::DataWriterMemory(void) :
+    _sinkFn(NULL),
+    _sinkContext(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterMemory::~DataWriterMemory(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterMemory::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    clearRecords();
+    DataWriter::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterMemory::DataWriterMemory(const DataWriterMemory& w) :
+    DataWriter(w),
+    _sinkFn(w._sinkFn),
+    _sinkContext(w._sinkContext) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Make copy of this object.
+pylith::meshio::DataWriter*
+pylith::meshio::DataWriterMemory::clone(void) const {
+    return new DataWriterMemory(*this);
+} // clone
+
+
+// ------------------------------------------------------------------------------------------------
+// Set sink callback consuming fields as they are written.
+void
+pylith::meshio::DataWriterMemory::setSink(sinkfn_type fn,
+                                          void* context) {
+    _sinkFn = fn;
+    _sinkContext = context;
+} // setSink
+
+
+// ------------------------------------------------------------------------------------------------
+// Get buffered records.
+const std::vector<pylith::meshio::DataWriterMemory::Record>&
+pylith::meshio::DataWriterMemory::getRecords(void) const {
+    return _records;
+} // getRecords
+
+
+// ------------------------------------------------------------------------------------------------
+// Discard buffered records.
+void
+pylith::meshio::DataWriterMemory::clearRecords(void) {
+    _records.clear();
+} // clearRecords
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over vertices.
+void
+pylith::meshio::DataWriterMemory::writeVertexField(const PylithScalar t,
+                                                   const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    _consumeField(t, subfield);
+
+    PYLITH_METHOD_END;
+} // writeVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over cells.
+void
+pylith::meshio::DataWriterMemory::writeCellField(const PylithScalar t,
+                                                 const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    _consumeField(t, subfield);
+
+    PYLITH_METHOD_END;
+} // writeCellField
+
+
+// ------------------------------------------------------------------------------------------------
+// Stream field to sink or append it to the buffered records.
+void
+pylith::meshio::DataWriterMemory::_consumeField(const PylithScalar t,
+                                                const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen);
+
+    const PetscVec vector = subfield.getVector();assert(vector);
+    const PylithScalar tDim = t * _timeScale;
+
+    if (_sinkFn) {
+        _sinkFn(_sinkContext, subfield.getDescription().label.c_str(), tDim, vector);
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscInt numValues = 0;
+    const PetscScalar* values = NULL;
+    PetscErrorCode err = VecGetLocalSize(vector, &numValues);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(vector, &values);PYLITH_CHECK_ERROR(err);
+
+    _records.push_back(Record());
+    Record& record = _records.back();
+    record.name = subfield.getDescription().label;
+    record.t = tDim;
+    record.fiberDim = subfield.getDescription().numComponents;
+    record.values.assign(values, values + numValues);
+
+    err = VecRestoreArrayRead(vector, &values);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _consumeField
+
+
+// End of file
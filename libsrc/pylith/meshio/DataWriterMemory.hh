@@ -0,0 +1,158 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterMemory.hh
+ *
+ * @brief Object for streaming finite-element data to an in-process consumer.
+ *
+ * Output stays in memory instead of going to the filesystem. Each field is either passed to a
+ * caller-provided sink callback as it is written (e.g., Green's function responses streamed
+ * directly to an in-process inversion) or, if no sink is set, buffered in records the caller
+ * drains with getRecords()/clearRecords(). Intended for embedding applications (see
+ * libsrc/pylith/pylith.hh); the callback cannot cross the Python interface.
+ */
+
+#if !defined(pylith_meshio_datawritermemory_hh)
+#define pylith_meshio_datawritermemory_hh
+
+// Include directives ---------------------------------------------------
+#include "DataWriter.hh" // ISA DataWriter
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <vector> // HASA std::vector
+
+// DataWriterMemory ------------------------------------------------------
+/// Object for streaming finite-element data to an in-process consumer.
+class pylith::meshio::DataWriterMemory : public DataWriter {
+    friend class TestDataWriterMemory; // unit testing
+
+    // PUBLIC TYPES /////////////////////////////////////////////////////////
+public:
+
+    /// Buffered field values for one field at one time.
+    struct Record {
+        std::string name; ///< Name of subfield.
+        PylithScalar t; ///< Time (in seconds) associated with field.
+        int fiberDim; ///< Number of values per point.
+        std::vector<PylithScalar> values; ///< Field values on this process.
+    }; // Record
+
+    /** Interface for sink callbacks consuming fields as they are written.
+     *
+     * The vector is the per-process portion of the global vector for the subfield and is only
+     * valid for the duration of the call; the consumer copies or reduces it before returning.
+     *
+     * @param[in] context Caller-provided context passed to setSink().
+     * @param[in] name Name of subfield.
+     * @param[in] t Time (in seconds) associated with field.
+     * @param[in] vector PETSc global vector with field values.
+     */
+    typedef void (*sinkfn_type)(void* context,
+                                const char* name,
+                                const PylithScalar t,
+                                const PetscVec vector);
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    DataWriterMemory(void);
+
+    /// Destructor
+    ~DataWriterMemory(void);
+
+    /** Make copy of this object.
+     *
+     * @returns Copy of this.
+     */
+    DataWriter* clone(void) const;
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set sink callback consuming fields as they are written.
+     *
+     * With a sink set, fields are not buffered; without one, fields accumulate in records.
+     *
+     * @param[in] fn Sink callback (NULL disables streaming and reenables buffering).
+     * @param[in] context Caller-provided context passed to each callback invocation.
+     */
+    void setSink(sinkfn_type fn,
+                 void* context);
+
+    /** Get buffered records.
+     *
+     * @returns Records buffered since the last clearRecords().
+     */
+    const std::vector<Record>& getRecords(void) const;
+
+    /// Discard buffered records.
+    void clearRecords(void);
+
+    /** Write field over vertices.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 1.
+     */
+    void writeVertexField(const PylithScalar t,
+                          const pylith::meshio::OutputSubfield& subfield);
+
+    /** Write field over cells.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 0.
+     */
+    void writeCellField(const PylithScalar t,
+                        const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Copy constructor.
+     *
+     * @param[in] w Object to copy.
+     */
+    DataWriterMemory(const DataWriterMemory& w);
+
+    /** Stream field to sink or append it to the buffered records.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield to consume.
+     */
+    void _consumeField(const PylithScalar t,
+                       const pylith::meshio::OutputSubfield& subfield);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    const DataWriterMemory& operator=(const DataWriterMemory&); ///< Not implemented
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    std::vector<Record> _records; ///< Buffered fields (used when no sink is set).
+    sinkfn_type _sinkFn; ///< Sink callback consuming fields as they are written.
+    void* _sinkContext; ///< Caller-provided context for sink callback.
+
+}; // DataWriterMemory
+
+#endif // pylith_meshio_datawritermemory_hh
+
+// End of file
@@ -368,6 +368,95 @@ pylith::meshio::ExodusII::getVar(int* values,
   PYLITH_METHOD_END;
 } // getVar
 
+// ----------------------------------------------------------------------
+// Get slab of values for variable as an array of PylithScalars.
+void
+pylith::meshio::ExodusII::getVar(PylithScalar* values,
+				 const size_t* start,
+				 const size_t* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(values);
+  assert(start);
+  assert(count);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing real variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  int vndims = 0;
+  int err = nc_inq_varndims(_file, vid, &vndims);
+  if (ndims != vndims) {
+    std::ostringstream msg;
+    msg << "Expecting " << ndims << " dimensions for variable '" << name
+	<< "' but variable only has " << vndims << " dimensions.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  if (sizeof(PylithScalar) == sizeof(double)) {
+    err = nc_get_vara_double(_file, vid, start, count, values);
+  } else {
+    assert(0);
+    throw std::logic_error("Unknown size of PylithScalar in ExodusII::getVar().");
+  } // if/else
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Coult not get slab of values for variable '" << name << ".";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
+// ----------------------------------------------------------------------
+// Get slab of values for variable as an array of ints.
+void
+pylith::meshio::ExodusII::getVar(int* values,
+				 const size_t* start,
+				 const size_t* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(values);
+  assert(start);
+  assert(count);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing integer variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  int vndims = 0;
+  int err = nc_inq_varndims(_file, vid, &vndims);
+  if (ndims != vndims) {
+    std::ostringstream msg;
+    msg << "Expecting " << ndims << " dimensions for variable '" << name
+	<< "' but variable only has " << vndims << " dimensions.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  err = nc_get_vara_int(_file, vid, start, count, values);
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Coult not get slab of values for variable '" << name << ".";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
 // ----------------------------------------------------------------------
 // Get values for variable as an array of strings.
 void
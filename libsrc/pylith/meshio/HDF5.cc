@@ -38,14 +38,20 @@
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::meshio::HDF5::HDF5(void) :
-  _file(-1)
+  _file(-1),
+  _filter(FILTER_DEFLATE),
+  _filterLevel(6),
+  _scaleOffsetDecimals(-1)
 { // constructor
 } // constructor
 
 // ----------------------------------------------------------------------
 // Constructor with filename and mode.
 pylith::meshio::HDF5::HDF5(const char* filename,
-			   hid_t mode)
+			   hid_t mode) :
+  _filter(FILTER_DEFLATE),
+  _filterLevel(6),
+  _scaleOffsetDecimals(-1)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -135,6 +141,24 @@ pylith::meshio::HDF5::isOpen(void) const
   return (_file == -1) ? false : true;
 } // isOpen
 
+// ----------------------------------------------------------------------
+// Set compression filter for chunked datasets.
+void
+pylith::meshio::HDF5::setCompression(const FilterEnum filter,
+				     const int level)
+{ // setCompression
+  _filter = filter;
+  _filterLevel = level;
+} // setCompression
+
+// ----------------------------------------------------------------------
+// Set number of decimal digits preserved by the scale-offset filter.
+void
+pylith::meshio::HDF5::setScaleOffset(const int decimals)
+{ // setScaleOffset
+  _scaleOffsetDecimals = decimals;
+} // setScaleOffset
+
 // ----------------------------------------------------------------------
 // Check if HDF5 file has group.
 bool
@@ -684,8 +708,26 @@ pylith::meshio::HDF5::createDataset(const char* parent,
     if (err < 0)
       throw std::runtime_error("Could not set chunk.");
 
-    // Set gzip compression level for chunk.
-    H5Pset_deflate(property, 6);
+    // Scale-offset filter (lossy) for floating-point data; applied
+    // before compression so smooth fields compress well.
+    if (_scaleOffsetDecimals >= 0 && H5T_FLOAT == H5Tget_class(datatype)) {
+      err = H5Pset_scaleoffset(property, H5Z_SO_FLOAT_DSCALE, _scaleOffsetDecimals);
+      if (err < 0)
+	throw std::runtime_error("Could not set scale-offset filter.");
+    } // if
+
+    // Set compression for chunk.
+    switch (_filter) {
+    case FILTER_DEFLATE:
+      err = H5Pset_deflate(property, _filterLevel);
+      if (err < 0)
+	throw std::runtime_error("Could not set deflate compression.");
+      break;
+    case FILTER_NONE:
+      break;
+    default:
+      throw std::runtime_error("Unknown compression filter.");
+    } // switch
 
 #if defined(PYLITH_HDF5_USE_API_18)
     hid_t dataset = H5Dcreate2(group, name,
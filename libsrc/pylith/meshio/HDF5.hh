@@ -35,6 +35,15 @@ class pylith::meshio::HDF5
 { // HDF5
   friend class TestHDF5; // Unit testing
 
+// PUBLIC ENUMS ---------------------------------------------------------
+public :
+
+  /// Compression filters for chunked datasets.
+  enum FilterEnum {
+    FILTER_NONE=0, ///< No compression.
+    FILTER_DEFLATE=1, ///< gzip (deflate) compression.
+  }; // FilterEnum
+
 // PUBLIC METHODS -------------------------------------------------------
 public :
 
@@ -69,6 +78,22 @@ public :
    */
   bool isOpen(void) const;
 
+  /** Set compression filter for chunked datasets.
+   *
+   * @param filter Compression filter.
+   * @param level Compression level (used by deflate filter).
+   */
+  void setCompression(const FilterEnum filter,
+		      const int level);
+
+  /** Set number of decimal digits preserved by the lossy scale-offset
+   * filter for floating-point datasets.
+   *
+   * @param decimals Number of decimal digits to preserve; negative
+   *   value disables the scale-offset filter.
+   */
+  void setScaleOffset(const int decimals);
+
   /** Check if HDF5 file has group.
    *
    * @param name Full name of group.
@@ -330,6 +355,9 @@ public :
 private :
 
   hid_t _file; ///< HDF5 file
+  FilterEnum _filter; ///< Compression filter for chunked datasets.
+  int _filterLevel; ///< Compression level (used by deflate filter).
+  int _scaleOffsetDecimals; ///< Decimal digits preserved by scale-offset filter (negative disables).
 
 }; // HDF5
 
@@ -96,4 +96,132 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 } // buildMesh
 
 
+// ----------------------------------------------------------------------
+// Set vertices and cells in mesh from raw arrays.
+void
+pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
+                                       const PylithScalar* coordinates,
+                                       const int numVertices,
+                                       int spaceDim,
+                                       int* const cells,
+                                       const int numCells,
+                                       const int numCorners,
+                                       const int meshDim) { // buildMesh
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    MPI_Comm comm = mesh->getComm();
+    PetscInt dim = meshDim;
+    PetscErrorCode err;
+
+    { // Check to make sure every vertex is in at least one cell.
+      // This is required by PETSc
+        std::vector<bool> vertexInCell(numVertices, false);
+        const int size = numCells*numCorners;
+        for (int i = 0; i < size; ++i) {
+            vertexInCell[cells[i]] = true;
+        }
+        int count = 0;
+        for (int i = 0; i < numVertices; ++i) {
+            if (!vertexInCell[i]) {
+                ++count;
+            }
+        }
+        if (count > 0) {
+            std::ostringstream msg;
+            msg << "Mesh contains " << count << " vertices that are not in any cells.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // check
+
+    /* DMPlex */
+    PetscDM dmMesh = NULL;
+    PetscBool interpolate = PETSC_TRUE;
+
+    err = MPI_Bcast(&dim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Bcast(&spaceDim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    const PetscInt bound = numCells*numCorners;
+    for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+        DMPolytopeType ct;
+
+        if (dim < 3) { continue;}
+        switch (numCorners) {
+        case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
+        case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
+        case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
+        default: continue;
+        }
+        err = DMPlexInvertCell(ct, &cells[coff]);PYLITH_CHECK_ERROR(err);
+    }
+    err = DMPlexCreateFromCellListPetsc(comm, dim, numCells, numVertices, numCorners, interpolate, cells, spaceDim, coordinates, &dmMesh);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmMesh);
+
+    PYLITH_METHOD_END;
+} // buildMesh
+
+
+// ----------------------------------------------------------------------
+// Build distributed mesh topology from rank-local slabs of cells and vertices.
+void
+pylith::meshio::MeshBuilder::buildMeshParallel(topology::Mesh* mesh,
+                                               scalar_array* coordinates,
+                                               const int numVertices,
+                                               const int spaceDim,
+                                               const int_array& cells,
+                                               const int numCells,
+                                               const int numCorners,
+                                               const int meshDim,
+                                               int_array* verticesAdj) { // buildMeshParallel
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(coordinates);
+    assert(verticesAdj);
+    MPI_Comm comm = mesh->getComm();
+    const PetscInt dim = meshDim;
+    PetscErrorCode err;
+
+    // Cells use global vertex indices, so the serial check that every vertex
+    // is in at least one cell cannot be done rank-locally; PETSc checks
+    // consistency when constructing the point SF.
+
+    const PetscInt bound = numCells*numCorners;
+    for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+        DMPolytopeType ct;
+
+        if (dim < 3) { continue;}
+        switch (numCorners) {
+        case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
+        case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
+        case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
+        default: continue;
+        }
+        err = DMPlexInvertCell(ct, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
+    }
+
+    PetscDM dmMesh = NULL;
+    PetscBool interpolate = PETSC_TRUE;
+    PetscSF sfVert = NULL;
+    PetscInt* verticesAdjPetsc = NULL;
+    err = DMPlexCreateFromCellListParallelPetsc(comm, dim, numCells, numVertices, PETSC_DECIDE, numCorners, interpolate,
+                                                &cells[0], spaceDim, &(*coordinates)[0], &sfVert, &verticesAdjPetsc,
+                                                &dmMesh);PYLITH_CHECK_ERROR(err);
+
+    // Record global vertex index of each local mesh vertex so callers can
+    // translate global point groups (e.g., nodesets) to local points.
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    verticesAdj->resize(vEnd-vStart);
+    for (PetscInt v = 0; v < vEnd-vStart; ++v) {
+        (*verticesAdj)[v] = verticesAdjPetsc[v];
+    } // for
+    err = PetscFree(verticesAdjPetsc);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&sfVert);PYLITH_CHECK_ERROR(err);
+
+    mesh->setDM(dmMesh);
+
+    PYLITH_METHOD_END;
+} // buildMeshParallel
+
+
 // End of file
@@ -72,6 +72,60 @@ void buildMesh(topology::Mesh* mesh,
                const int numCorners,
                const int meshDim,
                const bool isParallel =false);
+
+/** Build mesh topology and set vertex coordinates from raw arrays.
+ *
+ * Variant of buildMesh() for callers that manage their own storage
+ * (e.g., a memory-mapped file); the arrays are passed to PETSc without
+ * intermediate copies. Cells may be reordered in place to match the
+ * PETSc polytope orientation.
+ *
+ * @param mesh PyLith finite-element mesh.
+ * @param coordinates Array of coordinates of vertices.
+ * @param numVertices Number of vertices.
+ * @param spaceDim Dimension of vector space for vertex coordinates.
+ * @param cells Array of indices of vertices in cells (first index is 0).
+ * @param numCells Number of cells.
+ * @param numCorners Number of vertices per cell.
+ * @param meshDim Dimension of cells in mesh.
+ */
+static
+void buildMesh(topology::Mesh* mesh,
+               const PylithScalar* coordinates,
+               const int numVertices,
+               int spaceDim,
+               int* const cells,
+               const int numCells,
+               const int numCorners,
+               const int meshDim);
+
+/** Build distributed mesh topology from rank-local slabs of cells and vertices.
+ *
+ * Each rank provides a contiguous slab of the global cells and vertices.
+ * Cell connectivities use global vertex indices (zero based). The
+ * coordinates are those of the rank's vertex slab.
+ *
+ * @param mesh PyLith finite-element mesh.
+ * @param coordinates Array of coordinates of vertices in rank's slab.
+ * @param numVertices Number of vertices in rank's slab.
+ * @param spaceDim Dimension of vector space for vertex coordinates.
+ * @param cells Array of global indices of vertices in rank's cells (first index is 0).
+ * @param numCells Number of cells in rank's slab.
+ * @param numCorners Number of vertices per cell.
+ * @param meshDim Dimension of cells in mesh.
+ * @param verticesAdj Array of global vertex indices for the rank's local
+ *   mesh vertices (in local vertex order).
+ */
+static
+void buildMeshParallel(topology::Mesh* mesh,
+                       scalar_array* coordinates,
+                       const int numVertices,
+                       const int spaceDim,
+                       const int_array& cells,
+                       const int numCells,
+                       const int numCorners,
+                       const int meshDim,
+                       int_array* verticesAdj);
 }; // MeshBuilder
 
 #endif // pylith_meshio_meshbuilder_hh
@@ -54,6 +54,45 @@ pylith::meshio::MeshIO::deallocate(void) { // deallocate
 } // deallocate
 
 
+// ----------------------------------------------------------------------
+// Set names of groups (nodesets) to read from the mesh file.
+void
+pylith::meshio::MeshIO::setGroupFilter(const char* names[],
+                                       const int numNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setGroupFilter(names="<<names<<", numNames="<<numNames<<")");
+
+    assert((names && numNames) || (!names && !numNames));
+
+    _groupFilter.resize(numNames);
+    for (int i = 0; i < numNames; ++i) {
+        assert(names[i]);
+        _groupFilter[i] = names[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // setGroupFilter
+
+
+// ----------------------------------------------------------------------
+// Check whether a group passes the group filter.
+bool
+pylith::meshio::MeshIO::_keepGroup(const char* name) const {
+    if (_groupFilter.empty()) {
+        return true;
+    } // if
+
+    assert(name);
+    const size_t numNames = _groupFilter.size();
+    for (size_t i = 0; i < numNames; ++i) {
+        if (_groupFilter[i] == name) {
+            return true;
+        } // if
+    } // for
+    return false;
+} // _keepGroup
+
+
 // ----------------------------------------------------------------------
 // Get spatial dimension of mesh.
 int
@@ -32,7 +32,7 @@
 
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
-#include "pylith/utils/arrayfwd.hh" // USES scalar_array, int_array, string_vector
+#include "pylith/utils/array.hh" // HASA string_vector
 
 // MeshIO ---------------------------------------------------------------
 /// C++ abstract base class for managing mesh input/output.
@@ -73,6 +73,18 @@ public:
      */
     void write(pylith::topology::Mesh* const mesh);
 
+    /** Set names of groups (nodesets) to read from the mesh file.
+     *
+     * Readers that support filtering skip groups not in the list, so master meshes
+     * carrying nodesets for many studies only pay to read the ones the simulation
+     * references. An empty list (the default) reads all groups.
+     *
+     * @param[in] names Array of group names.
+     * @param[in] numNames Length of array.
+     */
+    void setGroupFilter(const char* names[],
+                        const int numNames);
+
     // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected:
 
@@ -168,10 +180,18 @@ protected:
     /// Create empty groups on other processes
     void _distributeGroups();
 
+    /** Check whether a group passes the group filter.
+     *
+     * @param[in] name Name of group.
+     * @returns True if group should be read, false otherwise.
+     */
+    bool _keepGroup(const char* name) const;
+
     // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected:
 
   pylith::topology::Mesh* _mesh; ///< Pointer to finite-element mesh.
+  pylith::string_vector _groupFilter; ///< Names of groups to read (empty means read all groups).
 
 }; // MeshIO
 
@@ -0,0 +1,337 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOBinary.hh" // implementation of class methods
+
+#include "MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <fcntl.h> // USES open()
+#include <unistd.h> // USES close()
+#include <sys/mman.h> // USES mmap(), munmap()
+#include <sys/stat.h> // USES fstat()
+#include <stdint.h> // USES int32_t
+#include <cstring> // USES memcpy(), strncmp()
+#include <cassert> // USES assert()
+#include <fstream> // USES std::ofstream
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _MeshIOBinary {
+public:
+
+            static const char magic[8];
+            static const int32_t version;
+            static const int32_t endianCheck;
+
+            /** File header. All integer fields are 32-bit and all
+             * floating-point data are 64-bit in the byte order of the
+             * machine that wrote the file. The header is followed by the
+             * vertex coordinates [numVertices*spaceDim] as float64, the
+             * cell connectivity [numCells*numCorners] as int32 with
+             * zero-based vertex indices, and the material identifiers
+             * [numCells] as int32. Each of the numGroups point groups
+             * follows as int32 name length, name bytes, int32 group type
+             * (0=vertices, 1=cells), int32 number of points, and the
+             * int32 point indices.
+             */
+            struct Header {
+                char magic[8]; ///< File magic bytes.
+                int32_t version; ///< Format version.
+                int32_t endianCheck; ///< Known value for detecting byte order mismatch.
+                int32_t meshDim; ///< Dimension of cells in mesh.
+                int32_t spaceDim; ///< Dimension of vertex coordinates.
+                int32_t numVertices; ///< Number of vertices.
+                int32_t numCells; ///< Number of cells.
+                int32_t numCorners; ///< Number of vertices per cell.
+                int32_t numGroups; ///< Number of point groups.
+            }; // Header
+        }; // _MeshIOBinary
+        const char _MeshIOBinary::magic[8] = { 'P', 'y', 'L', 'i', 't', 'h', 'B', 'M' };
+        const int32_t _MeshIOBinary::version = 1;
+        const int32_t _MeshIOBinary::endianCheck = 0x01020304;
+    } // meshio
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOBinary::MeshIOBinary(void) :
+    _filename("") { // constructor
+    PyreComponent::setName("meshiobinary");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOBinary::~MeshIOBinary(void) { // destructor
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOBinary::deallocate(void) { // deallocate
+    PYLITH_METHOD_BEGIN;
+
+    MeshIO::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh.
+void
+pylith::meshio::MeshIOBinary::_read(void) { // _read
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_read()");
+
+    assert(sizeof(PylithScalar) == sizeof(double));
+    assert(sizeof(int) == sizeof(int32_t));
+
+    const int commRank = _mesh->getCommRank();
+
+    if (0 == commRank) {
+        const int fd = ::open(_filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::ostringstream msg;
+            msg << "Could not open mesh file '" << _filename
+                << "' for reading.\n";
+            throw std::runtime_error(msg.str());
+        } // if
+        struct stat fileInfo;
+        if (::fstat(fd, &fileInfo) < 0) {
+            ::close(fd);
+            std::ostringstream msg;
+            msg << "Could not get size of mesh file '" << _filename << "'.\n";
+            throw std::runtime_error(msg.str());
+        } // if
+        const size_t fileSize = fileInfo.st_size;
+
+        // Map the file privately so that the coordinate and connectivity
+        // arrays can be handed to MeshBuilder without copies; reordering
+        // of the connectivity to match the PETSc polytope orientation
+        // touches copy-on-write pages and is never written back to disk.
+        char* fileData = (char*) ::mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (MAP_FAILED == (void*)fileData) {
+            std::ostringstream msg;
+            msg << "Could not memory map mesh file '" << _filename << "'.\n";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        try {
+            if (fileSize < sizeof(_MeshIOBinary::Header)) {
+                throw std::runtime_error("File is too short to contain a mesh header.");
+            } // if
+            _MeshIOBinary::Header header;
+            memcpy(&header, fileData, sizeof(header));
+            if (0 != strncmp(header.magic, _MeshIOBinary::magic, sizeof(header.magic))) {
+                throw std::runtime_error("File does not appear to be a PyLith binary mesh file (bad magic bytes).");
+            } // if
+            if (header.endianCheck != _MeshIOBinary::endianCheck) {
+                throw std::runtime_error("File was written with an incompatible byte order.");
+            } // if
+            if (header.version != _MeshIOBinary::version) {
+                std::ostringstream msg;
+                msg << "Unsupported binary mesh format version " << header.version
+                    << "; expected version " << _MeshIOBinary::version << ".";
+                throw std::runtime_error(msg.str());
+            } // if
+
+            const int meshDim = header.meshDim;
+            const int spaceDim = header.spaceDim;
+            const int numVertices = header.numVertices;
+            const int numCells = header.numCells;
+            const int numCorners = header.numCorners;
+            const int numGroups = header.numGroups;
+
+            const size_t coordinatesOffset = sizeof(header);
+            const size_t cellsOffset = coordinatesOffset + size_t(numVertices)*spaceDim*sizeof(double);
+            const size_t materialIdsOffset = cellsOffset + size_t(numCells)*numCorners*sizeof(int32_t);
+            const size_t groupsOffset = materialIdsOffset + size_t(numCells)*sizeof(int32_t);
+            if (fileSize < groupsOffset) {
+                throw std::runtime_error("File is too short for the vertices and cells given in the header.");
+            } // if
+
+            PylithScalar* coordinates = (PylithScalar*)(fileData + coordinatesOffset);
+            int* cells = (int*)(fileData + cellsOffset);
+            MeshBuilder::buildMesh(_mesh, coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim);
+
+            const int_array materialIds((const int*)(fileData + materialIdsOffset), numCells);
+            _setMaterials(materialIds);
+
+            // Group records have variable-length names, so the point
+            // arrays are not guaranteed to be aligned; copy them.
+            const char* groupData = fileData + groupsOffset;
+            const char* fileEnd = fileData + fileSize;
+            for (int iGroup = 0; iGroup < numGroups; ++iGroup) {
+                int32_t nameLen = 0;
+                if (groupData + sizeof(nameLen) > fileEnd) {
+                    throw std::runtime_error("File is too short for the groups given in the header.");
+                } // if
+                memcpy(&nameLen, groupData, sizeof(nameLen));groupData += sizeof(nameLen);
+
+                int32_t typeInt = 0;
+                int32_t numPoints = 0;
+                if (groupData + nameLen + sizeof(typeInt) + sizeof(numPoints) > fileEnd) {
+                    throw std::runtime_error("File is too short for the groups given in the header.");
+                } // if
+                const std::string name(groupData, nameLen);groupData += nameLen;
+                memcpy(&typeInt, groupData, sizeof(typeInt));groupData += sizeof(typeInt);
+                memcpy(&numPoints, groupData, sizeof(numPoints));groupData += sizeof(numPoints);
+                if ((typeInt != VERTEX) && (typeInt != CELL)) {
+                    std::ostringstream msg;
+                    msg << "Unknown point type " << typeInt << " for group '" << name << "'.";
+                    throw std::runtime_error(msg.str());
+                } // if
+                if (groupData + size_t(numPoints)*sizeof(int32_t) > fileEnd) {
+                    throw std::runtime_error("File is too short for the groups given in the header.");
+                } // if
+
+                int_array points(numPoints);
+                if (numPoints > 0) {
+                    memcpy(&points[0], groupData, numPoints*sizeof(int32_t));
+                } // if
+                groupData += size_t(numPoints)*sizeof(int32_t);
+                _setGroup(name, GroupPtType(typeInt), points);
+            } // for
+        } catch (const std::exception& err) {
+            ::munmap(fileData, fileSize);
+            std::ostringstream msg;
+            msg << "Error occurred while reading PyLith binary mesh file '"
+                << _filename << "'.\n"
+                << err.what();
+            throw std::runtime_error(msg.str());
+        } catch (...) {
+            ::munmap(fileData, fileSize);
+            std::ostringstream msg;
+            msg << "Unknown I/O error while reading PyLith binary mesh file '"
+                << _filename << "'.\n";
+            throw std::runtime_error(msg.str());
+        } // catch
+        ::munmap(fileData, fileSize);
+    } else {
+        scalar_array coordinates;
+        int_array cells;
+        int_array materialIds;
+        MeshBuilder::buildMesh(_mesh, &coordinates, 0, 0, cells, 0, 0, 0);
+        _setMaterials(materialIds);
+    } // if/else
+    _distributeGroups();
+
+    PYLITH_METHOD_END;
+} // read
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write mesh to file.
+void
+pylith::meshio::MeshIOBinary::_write(void) const { // write
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_write()");
+
+    assert(sizeof(PylithScalar) == sizeof(double));
+    assert(sizeof(int) == sizeof(int32_t));
+
+    std::ofstream fileout(_filename.c_str(), std::ios::binary);
+    if (!fileout.is_open() || !fileout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open mesh file '" << _filename
+            << "' for writing.\n";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    scalar_array coordinates;
+    int numVertices = 0;
+    int spaceDim = 0;
+    _getVertices(&coordinates, &numVertices, &spaceDim);
+
+    int_array cells;
+    int numCells = 0;
+    int numCorners = 0;
+    int meshDim = 0;
+    _getCells(&cells, &numCells, &numCorners, &meshDim);
+
+    int_array materialIds;
+    _getMaterials(&materialIds);
+
+    string_vector groups;
+    _getGroupNames(&groups);
+    const int numGroups = groups.size();
+
+    _MeshIOBinary::Header header;
+    memcpy(header.magic, _MeshIOBinary::magic, sizeof(header.magic));
+    header.version = _MeshIOBinary::version;
+    header.endianCheck = _MeshIOBinary::endianCheck;
+    header.meshDim = meshDim;
+    header.spaceDim = spaceDim;
+    header.numVertices = numVertices;
+    header.numCells = numCells;
+    header.numCorners = numCorners;
+    header.numGroups = numGroups;
+    fileout.write((const char*)&header, sizeof(header));
+
+    if (numVertices > 0) {
+        fileout.write((const char*)&coordinates[0], size_t(numVertices)*spaceDim*sizeof(double));
+    } // if
+    if (numCells > 0) {
+        fileout.write((const char*)&cells[0], size_t(numCells)*numCorners*sizeof(int32_t));
+        fileout.write((const char*)&materialIds[0], size_t(numCells)*sizeof(int32_t));
+    } // if
+
+    for (int iGroup = 0; iGroup < numGroups; ++iGroup) {
+        int_array points;
+        GroupPtType type;
+        _getGroup(&points, &type, groups[iGroup].c_str());
+
+        const int32_t nameLen = groups[iGroup].length();
+        const int32_t typeInt = type;
+        const int32_t numPoints = points.size();
+        fileout.write((const char*)&nameLen, sizeof(nameLen));
+        fileout.write(groups[iGroup].c_str(), nameLen);
+        fileout.write((const char*)&typeInt, sizeof(typeInt));
+        fileout.write((const char*)&numPoints, sizeof(numPoints));
+        if (numPoints > 0) {
+            fileout.write((const char*)&points[0], size_t(numPoints)*sizeof(int32_t));
+        } // if
+    } // for
+
+    if (!fileout.good()) {
+        std::ostringstream msg;
+        msg << "I/O error while writing PyLith binary mesh file '" << _filename << "'.\n";
+        throw std::runtime_error(msg.str());
+    } // if
+    fileout.close();
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// End of file
@@ -0,0 +1,85 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOBinary.hh
+ *
+ * @brief C++ input/output manager for PyLith binary mesh files.
+ *
+ * Binary companion to the ASCII mesh format with the same logical
+ * schema (vertices, cells with material identifiers, point groups).
+ * Coordinates and connectivity are stored as native-endian fixed-width
+ * arrays so that the reader can memory map the file and hand the arrays
+ * to MeshBuilder without copying them.
+ */
+
+#if !defined(pylith_meshio_meshiobinary_hh)
+#define pylith_meshio_meshiobinary_hh
+
+#include "MeshIO.hh" // ISA MeshIO
+
+#include <string> // HASA std::string
+
+class pylith::meshio::MeshIOBinary : public MeshIO {
+    friend class TestMeshIOBinary; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    MeshIOBinary(void);
+
+    /// Destructor
+    ~MeshIOBinary(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename for binary file.
+     *
+     * @param filename Name of file
+     */
+    void setFilename(const char* name);
+
+    /** Get filename of binary file.
+     *
+     * @returns Name of file
+     */
+    const char* getFilename(void) const;
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Write mesh
+    void _write(void) const;
+
+    /// Read mesh
+    void _read(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of file
+
+}; // MeshIOBinary
+
+#include "MeshIOBinary.icc" // inline methods
+
+#endif // pylith_meshio_meshiobinary_hh
+
+// End of file
@@ -23,12 +23,16 @@
 #include "MeshBuilder.hh" // USES MeshBuilder
 #include "ExodusII.hh" // USES ExodusII
 
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+
 #include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include "petsc.h" // USES MPI_Comm
 
+#include <algorithm> // USES std::lower_bound()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
@@ -38,7 +42,8 @@
 // Constructor
 pylith::meshio::MeshIOCubit::MeshIOCubit(void) :
     _filename(""),
-    _useNodesetNames(true) { // constructor
+    _useNodesetNames(true),
+    _useParallelRead(false) { // constructor
     PyreComponent::setName("meshiocubit");
 } // constructor
 
@@ -72,6 +77,13 @@ pylith::meshio::MeshIOCubit::_read(void) {
     assert(_mesh);
 
     const int commRank = _mesh->getCommRank();
+    int commSize = 0;
+    MPI_Comm_size(_mesh->getComm(), &commSize);
+    if (_useParallelRead && (commSize > 1)) {
+        _readParallel();
+        PYLITH_METHOD_END;
+    } // if
+
     int meshDim = 0;
     int spaceDim = 0;
     int numVertices = 0;
@@ -117,6 +129,152 @@ pylith::meshio::MeshIOCubit::_read(void) {
 } // read
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh with each rank reading its slab of cells and vertices.
+void
+pylith::meshio::MeshIOCubit::_readParallel(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readParallel()");
+
+    assert(_mesh);
+
+    const int commRank = _mesh->getCommRank();
+    int commSize = 0;
+    MPI_Comm_size(_mesh->getComm(), &commSize);
+    PetscErrorCode err = 0;
+
+    try {
+        ExodusII exofile(_filename.c_str());
+
+        const int meshDim = exofile.getDim("num_dim");
+        const int spaceDim = meshDim;
+        const int numVerticesGlobal = exofile.getDim("num_nodes");
+        const int numCellsGlobal = exofile.getDim("num_elem");
+        const int numMaterials = exofile.getDim("num_el_blk");
+
+        PYLITH_COMPONENT_INFO_ROOT("Reading "<<numCellsGlobal<<" cells in "<<numMaterials<<" blocks and "
+                                             <<numVerticesGlobal<<" vertices in slabs on "<<commSize<<" processes.");
+
+        // Block metadata is small and is read on every rank.
+        int_array blockIds(numMaterials);
+        int ndims = 1;
+        int dims[2];
+        dims[0] = numMaterials;
+        dims[1] = 0;
+        exofile.getVar(&blockIds[0], dims, ndims, "eb_prop1");
+
+        int numCorners = 0;
+        int_array blockSizes(numMaterials);
+        for (int iMaterial = 0; iMaterial < numMaterials; ++iMaterial) {
+            std::ostringstream varname;
+            varname << "num_nod_per_el" << iMaterial+1;
+            if (0 == numCorners) {
+                numCorners = exofile.getDim(varname.str().c_str());
+            } else if (exofile.getDim(varname.str().c_str()) != numCorners) {
+                std::ostringstream msg;
+                msg << "All materials must have the same number of vertices per cell.\n"
+                    << "Expected " << numCorners << " vertices per cell, but block "
+                    << blockIds[iMaterial] << " has "
+                    << exofile.getDim(varname.str().c_str())
+                    << " vertices.";
+                throw std::runtime_error(msg.str());
+            } // if/else
+
+            varname.str("");
+            varname << "num_el_in_blk" << iMaterial+1;
+            blockSizes[iMaterial] = exofile.getDim(varname.str().c_str());
+        } // for
+
+        // Contiguous slab of cells for this rank; the global cell order is the
+        // concatenation of the element blocks.
+        const int cellBegin = int(PetscInt64(numCellsGlobal)*commRank/commSize);
+        const int cellEnd = int(PetscInt64(numCellsGlobal)*(commRank+1)/commSize);
+        const int numCellsLocal = cellEnd - cellBegin;
+
+        int_array cells(size_t(numCellsLocal)*numCorners);
+        int_array materialIds(numCellsLocal);
+        for (int iMaterial = 0, blockBegin = 0; iMaterial < numMaterials; ++iMaterial) {
+            const int blockEnd = blockBegin + blockSizes[iMaterial];
+            const int overlapBegin = std::max(cellBegin, blockBegin);
+            const int overlapEnd = std::min(cellEnd, blockEnd);
+            if (overlapBegin < overlapEnd) {
+                std::ostringstream varname;
+                varname << "connect" << iMaterial+1;
+                const size_t start[2] = { size_t(overlapBegin-blockBegin), 0 };
+                const size_t count[2] = { size_t(overlapEnd-overlapBegin), size_t(numCorners) };
+                exofile.getVar(&cells[size_t(overlapBegin-cellBegin)*numCorners], start, count, 2,
+                               varname.str().c_str());
+
+                for (int iCell = overlapBegin; iCell < overlapEnd; ++iCell) {
+                    materialIds[iCell-cellBegin] = blockIds[iMaterial];
+                } // for
+            } // if
+            blockBegin = blockEnd;
+        } // for
+        cells -= 1; // use zero index
+        _orientCells(&cells, numCellsLocal, numCorners, meshDim);
+
+        // Contiguous slab of vertices for this rank.
+        const int vertexBegin = int(PetscInt64(numVerticesGlobal)*commRank/commSize);
+        const int vertexEnd = int(PetscInt64(numVerticesGlobal)*(commRank+1)/commSize);
+        const int numVerticesLocal = vertexEnd - vertexBegin;
+
+        scalar_array coordinates(size_t(numVerticesLocal)*spaceDim);
+        if (exofile.hasVar("coord", NULL)) {
+            scalar_array buffer(numVerticesLocal);
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                const size_t start[2] = { size_t(iDim), size_t(vertexBegin) };
+                const size_t count[2] = { 1, size_t(numVerticesLocal) };
+                exofile.getVar(&buffer[0], start, count, 2, "coord");
+                for (int iVertex = 0; iVertex < numVerticesLocal; ++iVertex) {
+                    coordinates[iVertex*spaceDim+iDim] = buffer[iVertex];
+                } // for
+            } // for
+        } else {
+            const char* coordNames[3] = { "coordx", "coordy", "coordz" };
+            scalar_array buffer(numVerticesLocal);
+            const size_t start[1] = { size_t(vertexBegin) };
+            const size_t count[1] = { size_t(numVerticesLocal) };
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                exofile.getVar(&buffer[0], start, count, 1, coordNames[iDim]);
+                for (int iVertex = 0; iVertex < numVerticesLocal; ++iVertex) {
+                    coordinates[iVertex*spaceDim+iDim] = buffer[iVertex];
+                } // for
+            } // for
+        } // if/else
+
+        int_array verticesAdj;
+        MeshBuilder::buildMeshParallel(_mesh, &coordinates, numVerticesLocal, spaceDim, cells, numCellsLocal,
+                                       numCorners, meshDim, &verticesAdj);
+
+        // Label rank-local cells with the material identifiers; cells in the
+        // distributed mesh keep the order of the rank's slab.
+        PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
+        topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+        const PetscInt cStart = cellsStratum.begin();
+        const PetscInt cEnd = cellsStratum.end();
+        assert(cEnd - cStart == numCellsLocal);
+        const char* const labelName = pylith::topology::Mesh::cells_label_name;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            err = DMSetLabelValue(dmMesh, labelName, c, materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        _readGroupsParallel(exofile, verticesAdj);
+    } catch (std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while reading Cubit Exodus file '" << _filename << "'.\n"
+            << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Unknown error while reading Cubit Exodus file '" << _filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // _readParallel
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write mesh to file.
 void
@@ -292,6 +450,19 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
     } // if
 
     for (int iGroup = 0; iGroup < numGroups; ++iGroup) {
+        std::string groupName;
+        if (_useNodesetNames) {
+            groupName = groupNames[iGroup];
+        } else {
+            std::ostringstream name;
+            name << ids[iGroup];
+            groupName = name.str();
+        } // if/else
+        if (!_keepGroup(groupName.c_str())) {
+            PYLITH_COMPONENT_INFO_ROOT("Skipping node set '" << groupName << "' with id " << ids[iGroup] << " (not referenced by simulation).");
+            continue;
+        } // if
+
         std::ostringstream varname;
         varname << "num_nod_ns" << iGroup+1;
         const size_t nodesetSize = exofile.getDim(varname.str().c_str());
@@ -302,24 +473,101 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
         ndims = 1;
         dims[0] = nodesetSize;
 
-        PYLITH_COMPONENT_INFO_ROOT("Reading node set '" << groupNames[iGroup] << "' with id " << ids[iGroup] << " containing " << nodesetSize << " nodes.");
+        PYLITH_COMPONENT_INFO_ROOT("Reading node set '" << groupName << "' with id " << ids[iGroup] << " containing " << nodesetSize << " nodes.");
         exofile.getVar(&points[0], dims, ndims, varname.str().c_str());
 
         std::sort(&points[0], &points[0]+nodesetSize);
         points -= 1; // use zero index
 
         GroupPtType type = VERTEX;
+        _setGroup(groupName, type, points);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _readGroups
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read point groups, restricting each group to the rank's local vertices.
+void
+pylith::meshio::MeshIOCubit::_readGroupsParallel(ExodusII& exofile,
+                                                 const int_array& verticesAdj) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readGroupsParallel(exofile="<<typeid(exofile).name()<<", verticesAdj="<<&verticesAdj<<")");
+
+    const int numGroups = exofile.getDim("num_node_sets");
+
+    PYLITH_COMPONENT_INFO_ROOT("Found " << numGroups << " node sets.");
+
+    int_array ids(numGroups);
+    int ndims = 1;
+    int dims[2];
+    dims[0] = numGroups;
+    dims[1] = 0;
+    exofile.getVar(&ids[0], dims, ndims, "ns_prop1");
+
+    string_vector groupNames(numGroups);
+
+    if (_useNodesetNames) {
+        exofile.getVar(&groupNames, numGroups, "ns_names");
+    } // if
+
+    // Node sets are small relative to the mesh, so each rank reads them in
+    // their entirety and keeps the vertices it owns. The local vertices are
+    // numbered by their (sorted) global indices in verticesAdj.
+    const int* verticesAdjBegin = &verticesAdj[0];
+    const int* verticesAdjEnd = verticesAdjBegin + verticesAdj.size();
+    for (int iGroup = 0; iGroup < numGroups; ++iGroup) {
+        std::string groupName;
         if (_useNodesetNames) {
-            _setGroup(groupNames[iGroup], type, points);
+            groupName = groupNames[iGroup];
         } else {
             std::ostringstream name;
             name << ids[iGroup];
-            _setGroup(name.str().c_str(), type, points);
+            groupName = name.str();
         } // if/else
+        if (!_keepGroup(groupName.c_str())) {
+            PYLITH_COMPONENT_INFO_ROOT("Skipping node set '" << groupName << "' with id " << ids[iGroup] << " (not referenced by simulation).");
+            continue;
+        } // if
+
+        std::ostringstream varname;
+        varname << "num_nod_ns" << iGroup+1;
+        const size_t nodesetSize = exofile.getDim(varname.str().c_str());
+        int_array points(nodesetSize);
+
+        varname.str("");
+        varname << "node_ns" << iGroup+1;
+        ndims = 1;
+        dims[0] = nodesetSize;
+
+        PYLITH_COMPONENT_INFO_ROOT("Reading node set '" << groupName << "' with id " << ids[iGroup] << " containing " << nodesetSize << " nodes.");
+        exofile.getVar(&points[0], dims, ndims, varname.str().c_str());
+
+        points -= 1; // use zero index
+
+        size_t numPointsLocal = 0;
+        int_array buffer(nodesetSize);
+        for (size_t iPoint = 0; iPoint < nodesetSize; ++iPoint) {
+            const int* match = std::lower_bound(verticesAdjBegin, verticesAdjEnd, points[iPoint]);
+            if ((match != verticesAdjEnd) && (*match == points[iPoint])) {
+                buffer[numPointsLocal++] = match - verticesAdjBegin;
+            } // if
+        } // for
+        int_array pointsLocal(numPointsLocal);
+        for (size_t iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+            pointsLocal[iPoint] = buffer[iPoint];
+        } // for
+        if (numPointsLocal > 0) {
+            std::sort(&pointsLocal[0], &pointsLocal[0]+numPointsLocal);
+        } // if
+
+        GroupPtType type = VERTEX;
+        _setGroup(groupName, type, pointsLocal);
     } // for
 
     PYLITH_METHOD_END;
-} // _readGroups
+} // _readGroupsParallel
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -62,6 +62,15 @@ public:
      */
     void setUseNodesetNames(const bool flag);
 
+    /** Set flag on whether to read slabs of the mesh in parallel.
+     *
+     * If true, each rank reads its slab of the cells and vertices directly
+     * from the Exodus file instead of rank 0 reading the entire mesh.
+     *
+     * @param flag True to read mesh in parallel.
+     */
+    void setUseParallelRead(const bool flag);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -106,6 +115,17 @@ private:
      */
     void _readGroups(ExodusII& filein);
 
+    /// Read mesh with each rank reading its slab of cells and vertices.
+    void _readParallel(void);
+
+    /** Read point groups, restricting each group to the rank's local vertices.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param verticesAdj Array of global vertex indices for local mesh vertices.
+     */
+    void _readGroupsParallel(ExodusII& filein,
+                             const int_array& verticesAdj);
+
     /** Write mesh dimensions.
      *
      * @param ncfile Cubit Exodus file.
@@ -142,6 +162,7 @@ private:
 
     std::string _filename; ///< Name of file
     bool _useNodesetNames; ///< True to use node set names instead of ids.
+    bool _useParallelRead; ///< True to read slabs of mesh in parallel.
 
 }; // MeshIOCubit
 
@@ -0,0 +1,252 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOMemory.hh" // implementation of class methods
+
+#include "MeshBuilder.hh" // USES MeshBuilder
+
+#include "pylith/utils/array.hh" // USES int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOMemory::MeshIOMemory(void) :
+    _coordinates(NULL),
+    _cells(NULL),
+    _materialIds(NULL),
+    _numVertices(0),
+    _spaceDim(0),
+    _numCells(0),
+    _numCorners(0),
+    _meshDim(0),
+    _adoptedCoordinates(false),
+    _adoptedCells(false),
+    _adoptedMaterialIds(false) {
+    PyreComponent::setName("meshiomemory");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOMemory::~MeshIOMemory(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOMemory::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    MeshIO::deallocate();
+
+    _freeAdopted();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set vertex coordinates.
+void
+pylith::meshio::MeshIOMemory::setVertices(PylithScalar* coordinates,
+                                          const int numVertices,
+                                          const int spaceDim,
+                                          const bool adopt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setVertices(coordinates="<<coordinates<<", numVertices="<<numVertices<<", spaceDim="<<spaceDim<<", adopt="<<adopt<<")");
+
+    assert((coordinates && numVertices > 0) || (!coordinates && 0 == numVertices));
+
+    if (_adoptedCoordinates) {
+        delete[] _coordinates;
+    } // if
+    _coordinates = coordinates;
+    _numVertices = numVertices;
+    _spaceDim = spaceDim;
+    _adoptedCoordinates = adopt;
+
+    PYLITH_METHOD_END;
+} // setVertices
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set cell connectivities.
+void
+pylith::meshio::MeshIOMemory::setCells(int* cells,
+                                       const int numCells,
+                                       const int numCorners,
+                                       const int meshDim,
+                                       const bool adopt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setCells(cells="<<cells<<", numCells="<<numCells<<", numCorners="<<numCorners<<", meshDim="<<meshDim<<", adopt="<<adopt<<")");
+
+    assert((cells && numCells > 0) || (!cells && 0 == numCells));
+
+    if (_adoptedCells) {
+        delete[] _cells;
+    } // if
+    _cells = cells;
+    _numCells = numCells;
+    _numCorners = numCorners;
+    _meshDim = meshDim;
+    _adoptedCells = adopt;
+
+    PYLITH_METHOD_END;
+} // setCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set material identifiers of cells.
+void
+pylith::meshio::MeshIOMemory::setMaterialIds(int* materialIds,
+                                             const bool adopt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setMaterialIds(materialIds="<<materialIds<<", adopt="<<adopt<<")");
+
+    if (_adoptedMaterialIds) {
+        delete[] _materialIds;
+    } // if
+    _materialIds = materialIds;
+    _adoptedMaterialIds = adopt;
+
+    PYLITH_METHOD_END;
+} // setMaterialIds
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add a point group.
+void
+pylith::meshio::MeshIOMemory::addGroup(const char* name,
+                                       const GroupPtType type,
+                                       int* points,
+                                       const int numPoints,
+                                       const bool adopt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("addGroup(name="<<name<<", type="<<type<<", points="<<points<<", numPoints="<<numPoints<<", adopt="<<adopt<<")");
+
+    assert(name);
+    assert((points && numPoints > 0) || (!points && 0 == numPoints));
+
+    RawGroup group;
+    group.name = name;
+    group.type = type;
+    group.points = points;
+    group.numPoints = numPoints;
+    group.adopted = adopt;
+    _groups.push_back(group);
+
+    PYLITH_METHOD_END;
+} // addGroup
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh from in-memory arrays.
+void
+pylith::meshio::MeshIOMemory::_read(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_read()");
+
+    assert(_mesh);
+
+    const int commRank = _mesh->getCommRank();
+    if (0 == commRank) {
+        if (!_coordinates || !_cells || !_materialIds) {
+            std::ostringstream msg;
+            msg << "Vertices, cells, and material identifiers not set for in-memory mesh '"
+                << PyreComponent::getIdentifier() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        // The arrays go to PETSc without intermediate copies; cells may be
+        // reordered in place to match the PETSc polytope orientation.
+        MeshBuilder::buildMesh(_mesh, _coordinates, _numVertices, _spaceDim, _cells, _numCells, _numCorners, _meshDim);
+
+        int_array materialIds(_materialIds, _numCells);
+        _setMaterials(materialIds);
+
+        const size_t numGroups = _groups.size();
+        for (size_t iGroup = 0; iGroup < numGroups; ++iGroup) {
+            const RawGroup& group = _groups[iGroup];
+            int_array points(group.points, group.numPoints);
+            _setGroup(group.name, group.type, points);
+        } // for
+    } else {
+        int_array cells;
+        scalar_array coordinates;
+        int_array materialIds;
+        MeshBuilder::buildMesh(_mesh, &coordinates, 0, _spaceDim, cells, 0, _numCorners, _meshDim);
+        _setMaterials(materialIds);
+    } // if/else
+    _distributeGroups();
+
+    _freeAdopted();
+
+    PYLITH_METHOD_END;
+} // _read
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write mesh to in-memory arrays.
+void
+pylith::meshio::MeshIOMemory::_write(void) const {
+    throw std::logic_error("MeshIOMemory::_write() not implemented.");
+} // _write
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Free adopted arrays.
+void
+pylith::meshio::MeshIOMemory::_freeAdopted(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_adoptedCoordinates) {
+        delete[] _coordinates;
+    } // if
+    _coordinates = NULL;_adoptedCoordinates = false;
+    if (_adoptedCells) {
+        delete[] _cells;
+    } // if
+    _cells = NULL;_adoptedCells = false;
+    if (_adoptedMaterialIds) {
+        delete[] _materialIds;
+    } // if
+    _materialIds = NULL;_adoptedMaterialIds = false;
+
+    const size_t numGroups = _groups.size();
+    for (size_t iGroup = 0; iGroup < numGroups; ++iGroup) {
+        if (_groups[iGroup].adopted) {
+            delete[] _groups[iGroup].points;
+        } // if
+        _groups[iGroup].points = NULL;
+    } // for
+    _groups.clear();
+
+    PYLITH_METHOD_END;
+} // _freeAdopted
+
+
+// End of file
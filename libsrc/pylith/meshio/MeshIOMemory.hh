@@ -0,0 +1,158 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOMemory.hh
+ *
+ * @brief C++ manager for injecting an in-memory mesh.
+ *
+ * Accepts caller-owned coordinate, connectivity, material id, and point
+ * group arrays so that mesh-generation pipelines running in the same
+ * process can hand a mesh to PyLith without writing it to a file. The
+ * arrays are passed to MeshBuilder without intermediate copies; with
+ * adoption the reader takes ownership and frees them with delete[].
+ */
+
+#if !defined(pylith_meshio_meshiomemory_hh)
+#define pylith_meshio_meshiomemory_hh
+
+#include "MeshIO.hh" // ISA MeshIO
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::meshio::MeshIOMemory : public MeshIO {
+    friend class TestMeshIOMemory; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    MeshIOMemory(void);
+
+    /// Destructor
+    ~MeshIOMemory(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set vertex coordinates.
+     *
+     * @param[in] coordinates Array of coordinates of vertices [numVertices*spaceDim].
+     * @param[in] numVertices Number of vertices.
+     * @param[in] spaceDim Dimension of vector space for vertex coordinates.
+     * @param[in] adopt Take ownership of array (freed with delete[]) if true;
+     *   otherwise the caller must keep the array alive through read().
+     */
+    void setVertices(PylithScalar* coordinates,
+                     const int numVertices,
+                     const int spaceDim,
+                     const bool adopt =false);
+
+    /** Set cell connectivities.
+     *
+     * The indices of the vertices must use zero based indices. Cells may be
+     * reordered in place to match the PETSc polytope orientation.
+     *
+     * @param[in] cells Array of indices of vertices in cells [numCells*numCorners].
+     * @param[in] numCells Number of cells.
+     * @param[in] numCorners Number of vertices per cell.
+     * @param[in] meshDim Dimension of cells in mesh.
+     * @param[in] adopt Take ownership of array (freed with delete[]) if true;
+     *   otherwise the caller must keep the array alive through read().
+     */
+    void setCells(int* cells,
+                  const int numCells,
+                  const int numCorners,
+                  const int meshDim,
+                  const bool adopt =false);
+
+    /** Set material identifiers of cells.
+     *
+     * @param[in] materialIds Array of material identifiers [numCells].
+     * @param[in] adopt Take ownership of array (freed with delete[]) if true;
+     *   otherwise the caller must keep the array alive through read().
+     */
+    void setMaterialIds(int* materialIds,
+                        const bool adopt =false);
+
+    /** Add a point group.
+     *
+     * The indices of the points must use zero based indices.
+     *
+     * @param[in] name Name of group.
+     * @param[in] type Type of points in group (VERTEX or CELL).
+     * @param[in] points Array of indices of points in group [numPoints].
+     * @param[in] numPoints Number of points in group.
+     * @param[in] adopt Take ownership of array (freed with delete[]) if true;
+     *   otherwise the caller must keep the array alive through read().
+     */
+    void addGroup(const char* name,
+                  const GroupPtType type,
+                  int* points,
+                  const int numPoints,
+                  const bool adopt =false);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Write mesh
+    void _write(void) const;
+
+    /// Read mesh
+    void _read(void);
+
+    // PRIVATE STRUCTS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Caller-provided point group.
+    struct RawGroup {
+        std::string name; ///< Name of group.
+        GroupPtType type; ///< Type of points in group.
+        int* points; ///< Array of indices of points in group.
+        int numPoints; ///< Number of points in group.
+        bool adopted; ///< Free array with delete[] if true.
+    }; // RawGroup
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Free adopted arrays.
+    void _freeAdopted(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    PylithScalar* _coordinates; ///< Array of coordinates of vertices.
+    int* _cells; ///< Array of indices of vertices in cells.
+    int* _materialIds; ///< Array of material identifiers of cells.
+    std::vector<RawGroup> _groups; ///< Caller-provided point groups.
+    int _numVertices; ///< Number of vertices.
+    int _spaceDim; ///< Dimension of vector space for vertex coordinates.
+    int _numCells; ///< Number of cells.
+    int _numCorners; ///< Number of vertices per cell.
+    int _meshDim; ///< Dimension of cells in mesh.
+    bool _adoptedCoordinates; ///< Free coordinates with delete[] if true.
+    bool _adoptedCells; ///< Free cells with delete[] if true.
+    bool _adoptedMaterialIds; ///< Free material ids with delete[] if true.
+
+}; // MeshIOMemory
+
+#endif // pylith_meshio_meshiomemory_hh
+
+// End of file
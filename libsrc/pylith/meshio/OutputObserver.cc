@@ -39,6 +39,8 @@
 // Constructor
 pylith::meshio::OutputObserver::OutputObserver(void) :
     _timeScale(1.0),
+    _expectedDuration(0.0),
+    _expectedNumTimeSteps(0),
     _writer(NULL),
     _trigger(NULL),
     _outputBasisOrder(1) {}
@@ -122,6 +124,75 @@ pylith::meshio::OutputObserver::setOutputBasisOrder(const int value) {
 } // setOutputBasisOrder
 
 
+// ------------------------------------------------------------------------------------------------
+// Set time windows in which the observer is active.
+void
+pylith::meshio::OutputObserver::setActiveTimeWindows(const PylithReal* windows,
+                                                     const int numWindows,
+                                                     const int numColumns) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setActiveTimeWindows(windows="<<windows<<", numWindows="<<numWindows<<", numColumns="<<numColumns<<")");
+
+    if (numWindows > 0) {
+        assert(windows);
+        if (2 != numColumns) {
+            std::ostringstream msg;
+            msg << "Active time windows must be given as start/end pairs (got " << numColumns
+                << " values per window).";
+            throw std::runtime_error(msg.str());
+        } // if
+        _activeWindows.resize(2*numWindows);
+        for (int i = 0; i < numWindows; ++i) {
+            const PylithReal windowStart = windows[2*i+0];
+            const PylithReal windowEnd = windows[2*i+1];
+            if (windowStart >= windowEnd) {
+                std::ostringstream msg;
+                msg << "Start of active time window (" << windowStart << " s) must be earlier than its end ("
+                    << windowEnd << " s).";
+                throw std::runtime_error(msg.str());
+            } // if
+            _activeWindows[2*i+0] = windowStart;
+            _activeWindows[2*i+1] = windowEnd;
+        } // for
+    } else {
+        _activeWindows.resize(0);
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // setActiveTimeWindows
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether the observer is active at time t.
+bool
+pylith::meshio::OutputObserver::_isActive(const PylithReal t) const {
+    const size_t numWindows = _activeWindows.size() / 2;
+    if (!numWindows) {
+        return true;
+    } // if
+
+    const PylithReal tDim = t * _timeScale;
+    for (size_t i = 0; i < numWindows; ++i) {
+        if ((tDim >= _activeWindows[2*i+0]) && (tDim <= _activeWindows[2*i+1])) {
+            return true;
+        } // if
+    } // for
+    return false;
+} // _isActive
+
+
+// ------------------------------------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation.
+void
+pylith::meshio::OutputObserver::setExpectedTimeSteps(const size_t numTimeSteps,
+                                                     const PylithReal duration) {
+    PYLITH_COMPONENT_DEBUG("setExpectedTimeSteps(numTimeSteps="<<numTimeSteps<<", duration="<<duration<<")");
+
+    _expectedNumTimeSteps = numTimeSteps;
+    _expectedDuration = duration;
+} // setExpectedTimeSteps
+
+
 // ------------------------------------------------------------------------------------------------
 // Set time scale.
 void
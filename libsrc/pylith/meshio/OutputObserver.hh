@@ -73,6 +73,21 @@ public:
      */
     void setOutputBasisOrder(const int value);
 
+    /** Set time windows in which the observer is active.
+     *
+     * Outside the windows the observer ignores notifications regardless of the output
+     * trigger, so observers capturing fine detail (e.g., coseismic output) can be silent
+     * during long segments of no interest. An empty array (the default) means the
+     * observer is active for the full duration of the simulation.
+     *
+     * @param[in] windows Array of start/end times of windows (seconds) [numWindows, 2].
+     * @param[in] numWindows Number of time windows.
+     * @param[in] numColumns Number of values per window (must be 2).
+     */
+    void setActiveTimeWindows(const PylithReal* windows,
+                              const int numWindows,
+                              const int numColumns);
+
     /** Set time scale.
      *
      * @param[in] value Time scale for dimensionalizing time.
@@ -80,6 +95,18 @@ public:
     virtual
     void setTimeScale(const PylithReal value);
 
+    /** Set expected number of time steps and duration of the simulation.
+     *
+     * Combined with the output trigger cadence, the hint lets the writer preallocate
+     * time-series dataset extents instead of extending them with each write.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    virtual
+    void setExpectedTimeSteps(const size_t numTimeSteps,
+                              const PylithReal duration);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -108,10 +135,20 @@ protected:
     void _appendField(const PylithReal t,
                       const pylith::meshio::OutputSubfield& subfield);
 
+    /** Check whether the observer is active at time t.
+     *
+     * @param[in] t Nondimensional time.
+     * @returns True if t falls within an active time window or no windows are set.
+     */
+    bool _isActive(const PylithReal t) const;
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
     PylithReal _timeScale; ///< Time scale for dimentionalizing time.
+    PylithReal _expectedDuration; ///< Expected duration of simulation (seconds; 0 means unknown).
+    size_t _expectedNumTimeSteps; ///< Expected number of time steps (0 means unknown).
+    pylith::scalar_array _activeWindows; ///< Start/end pairs of active time windows (seconds; empty means always active).
     std::map<std::string, OutputSubfield*> _subfields; ///< Subfields extracted for output.
     DataWriter* _writer; ///< Writer for data.
     OutputTrigger* _trigger; ///< Trigger for deciding how often to write output.
@@ -126,6 +126,15 @@ pylith::meshio::OutputPhysics::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ------------------------------------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation.
+void
+pylith::meshio::OutputPhysics::setExpectedTimeSteps(const size_t numTimeSteps,
+                                                    const PylithReal duration) {
+    OutputObserver::setExpectedTimeSteps(numTimeSteps, duration);
+} // setExpectedTimeSteps
+
+
 // ------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -190,7 +199,11 @@ pylith::meshio::OutputPhysics::update(const PylithReal t,
     if (infoOnly) {
         _writeInfo();
     } else {
+        if (!_isActive(t)) {
+            return;
+        } // if
         assert(_trigger);
+        _trigger->setState(solution);
         if (_trigger->shouldWrite(t, tindex)) {
             _writeDataStep(t, tindex, solution);
         } // if
@@ -198,6 +211,19 @@ pylith::meshio::OutputPhysics::update(const PylithReal t,
 } // update
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer would write data at time t.
+bool
+pylith::meshio::OutputPhysics::expectsDataOutput(const PylithReal t,
+                                                 const PylithInt tindex) const {
+    if (!_isActive(t)) {
+        return false;
+    } // if
+    assert(_trigger);
+    return _trigger->willWrite(t, tindex);
+} // expectsDataOutput
+
+
 // ------------------------------------------------------------------------------------------------
 // Write output for step in solution.
 void
@@ -259,6 +285,9 @@ pylith::meshio::OutputPhysics::_open(const pylith::topology::Mesh& mesh,
 
     assert(_writer);
     _writer->setTimeScale(_timeScale);
+    if (!isInfo && (_expectedNumTimeSteps > 0)) {
+        _writer->setExpectedNumWrites(_trigger->estimateNumWrites(_expectedNumTimeSteps, _expectedDuration));
+    } // if
     _writer->open(mesh, isInfo);
 
     PYLITH_METHOD_END;
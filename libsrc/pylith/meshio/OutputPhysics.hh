@@ -85,6 +85,14 @@ public:
      */
     void setTimeScale(const PylithReal value);
 
+    /** Set expected number of time steps and duration of the simulation.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    void setExpectedTimeSteps(const size_t numTimeSteps,
+                              const PylithReal duration);
+
     /** Verify configuration.
      *
      * @param[in] solution Solution field.
@@ -103,6 +111,15 @@ public:
                 const pylith::topology::Field& solution,
                 const bool infoOnly);
 
+    /** Check whether observer would write data at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if trigger indicates output would be written at time t, false otherwise.
+     */
+    bool expectsDataOutput(const PylithReal t,
+                           const PylithInt tindex) const;
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
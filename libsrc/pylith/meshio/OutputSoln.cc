@@ -96,6 +96,15 @@ pylith::meshio::OutputSoln::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation.
+void
+pylith::meshio::OutputSoln::setExpectedTimeSteps(const size_t numTimeSteps,
+                                                 const PylithReal duration) {
+    OutputObserver::setExpectedTimeSteps(numTimeSteps, duration);
+} // setExpectedTimeSteps
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -125,13 +134,30 @@ void
 pylith::meshio::OutputSoln::update(const PylithReal t,
                                    const PylithInt tindex,
                                    const pylith::topology::Field& solution) {
+    if (!_isActive(t)) {
+        return;
+    } // if
     assert(_trigger);
+    _trigger->setState(solution);
     if (_trigger->shouldWrite(t, tindex)) {
         _writeSolnStep(t, tindex, solution);
     } // if
 } // update
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer would write data at time t.
+bool
+pylith::meshio::OutputSoln::expectsDataOutput(const PylithReal t,
+                                              const PylithInt tindex) const {
+    if (!_isActive(t)) {
+        return false;
+    } // if
+    assert(_trigger);
+    return _trigger->willWrite(t, tindex);
+} // expectsDataOutput
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Prepare for output.
 void
@@ -149,6 +175,9 @@ pylith::meshio::OutputSoln::_open(const pylith::topology::Mesh& mesh) {
     assert(_writer);
     const bool isInfo = false;
     _writer->setTimeScale(_timeScale);
+    if (_expectedNumTimeSteps > 0) {
+        _writer->setExpectedNumWrites(_trigger->estimateNumWrites(_expectedNumTimeSteps, _expectedDuration));
+    } // if
     _writer->open(mesh, isInfo);
 
     PYLITH_METHOD_END;
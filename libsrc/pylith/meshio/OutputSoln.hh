@@ -70,6 +70,14 @@ public:
      */
     void setTimeScale(const PylithReal value);
 
+    /** Set expected number of time steps and duration of the simulation.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    void setExpectedTimeSteps(const size_t numTimeSteps,
+                              const PylithReal duration);
+
     /** Verify observer is compatible with solution.
      *
      * @param[in] solution Solution field.
@@ -88,6 +96,15 @@ public:
                 const PylithInt tindex,
                 const pylith::topology::Field& solution);
 
+    /** Check whether observer would write data at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if observer would write data at time t, false otherwise.
+     */
+    bool expectsDataOutput(const PylithReal t,
+                           const PylithInt tindex) const;
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
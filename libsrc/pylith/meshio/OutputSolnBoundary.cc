@@ -23,7 +23,6 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
 #include "pylith/topology/Mesh.hh" // USES Mesh
-#include "pylith/topology/MeshOps.hh" // USES createLowerDimMesh()
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
 
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
@@ -54,7 +53,7 @@ pylith::meshio::OutputSolnBoundary::deallocate(void) {
 
     OutputSoln::deallocate();
 
-    delete _boundaryMesh;_boundaryMesh = NULL;
+    _boundaryMesh = NULL; // Memory managed by domain mesh.
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -117,7 +116,7 @@ pylith::meshio::OutputSolnBoundary::_writeSolnStep(const PylithReal t,
     PYLITH_COMPONENT_DEBUG("_writeSolnStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
 
     if (!_boundaryMesh) {
-        _boundaryMesh = pylith::topology::MeshOps::createLowerDimMesh(solution.getMesh(), _labelName.c_str(), _labelValue);
+        _boundaryMesh = solution.getMesh().getSubmesh(_labelName.c_str(), _labelValue);
         assert(_boundaryMesh);
     } // if
 
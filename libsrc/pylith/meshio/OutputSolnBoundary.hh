@@ -82,7 +82,7 @@ protected:
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
-    pylith::topology::Mesh* _boundaryMesh; ///< Mesh of subdomain.
+    pylith::topology::Mesh* _boundaryMesh; ///< Mesh of subdomain (shared; memory managed by domain mesh).
     std::string _labelName; ///< Name of label for subdomain.
     int _labelValue; ///< Value of label for subdomain.
 
@@ -0,0 +1,202 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputSolnCoarse.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+
+#include "petscdm.h" // USES DMCreateInterpolation()
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <typeinfo> // USES typeid()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputSolnCoarse::OutputSolnCoarse(void) :
+    _coarseMesh(NULL),
+    _coarseSoln(NULL),
+    _interpolation(NULL),
+    _restrictScale(NULL) {
+    PyreComponent::setName("outputsolncoarse");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputSolnCoarse::~OutputSolnCoarse(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputSolnCoarse::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSoln::deallocate();
+
+    PetscErrorCode err = 0;
+    err = MatDestroy(&_interpolation);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_restrictScale);PYLITH_CHECK_ERROR(err);
+
+    delete _coarseSoln;_coarseSoln = NULL;
+    _coarseMesh = NULL; // :TODO: Use shared pointer. Mesh is owned by Python object.
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set coarse mesh for decimated output.
+void
+pylith::meshio::OutputSolnCoarse::setCoarseMesh(pylith::topology::Mesh* const mesh) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setCoarseMesh(mesh="<<mesh<<")");
+
+    assert(mesh);
+    _coarseMesh = mesh;
+
+    PYLITH_METHOD_END;
+} // setCoarseMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Write solution at time step.
+void
+pylith::meshio::OutputSolnCoarse::_writeSolnStep(const PylithReal t,
+                                                 const PylithInt tindex,
+                                                 const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_writeSolnStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    if (!_interpolation) {
+        _setupProjection(solution);
+    } // if
+    assert(_coarseMesh);
+    assert(_coarseSoln);
+
+    // Restrict solution to the coarse mesh using the scaled transpose of
+    // the coarse-to-fine interpolation operator; the scaling preserves
+    // constant fields so long-wavelength deformation passes through
+    // unchanged.
+    PetscErrorCode err = 0;
+    PetscVec solutionVector = solution.getGlobalVector();assert(solutionVector);
+    solution.scatterLocalToVector(solutionVector);
+    PetscVec coarseVector = _coarseSoln->getGlobalVector();assert(coarseVector);
+    err = MatMultTranspose(_interpolation, solutionVector, coarseVector);PYLITH_CHECK_ERROR(err);
+    err = VecPointwiseMult(coarseVector, coarseVector, _restrictScale);PYLITH_CHECK_ERROR(err);
+    _coarseSoln->scatterVectorToLocal(coarseVector);
+
+    _openSolnStep(t, *_coarseMesh);
+    const pylith::string_vector& subfieldNames = pylith::topology::FieldOps::getSubfieldNamesDomain(solution);
+    const size_t numSubfieldNames = subfieldNames.size();
+    for (size_t iField = 0; iField < numSubfieldNames; iField++) {
+        OutputSubfield* subfield = NULL;
+        subfield = this->_getSubfield(*_coarseSoln, *_coarseMesh, subfieldNames[iField].c_str());assert(subfield);
+
+        const pylith::topology::Field::SubfieldInfo& info = _coarseSoln->getSubfieldInfo(subfieldNames[iField].c_str());
+        subfield->extractSubfield(*_coarseSoln, info.index);
+
+        OutputObserver::_appendField(t, *subfield);
+    } // for
+    _closeSolnStep();
+
+    PYLITH_METHOD_END;
+} // _writeSolnStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Get output subfield, creating if necessary.
+pylith::meshio::OutputSubfield*
+pylith::meshio::OutputSolnCoarse::_getSubfield(const pylith::topology::Field& field,
+                                               const pylith::topology::Mesh& submesh,
+                                               const char* name) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_getSubfield(field="<<field.getLabel()<<", name="<<name<<", submesh="<<typeid(submesh).name()<<")");
+
+    if (_subfields.count(name) == 0) {
+        _subfields[name] = OutputSubfield::create(field, submesh, name);
+    } // if
+
+    PYLITH_METHOD_RETURN(_subfields[name]);
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup projection of solution onto coarse mesh.
+void
+pylith::meshio::OutputSolnCoarse::_setupProjection(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupProjection(solution="<<solution.getLabel()<<")");
+
+    if (!_coarseMesh) {
+        std::ostringstream msg;
+        msg << "Coarse mesh not set for decimated output '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PetscErrorCode err = 0;
+    err = MatDestroy(&_interpolation);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_restrictScale);PYLITH_CHECK_ERROR(err);
+
+    const spatialdata::geocoords::CoordSys* cs = _coarseMesh->getCoordSys();assert(cs);
+    const int spaceDim = cs->getSpaceDim();
+
+    // Create solution field on coarse mesh with the same subfields and
+    // discretizations as the solution so the coarse and fine function
+    // spaces have matching field layouts.
+    delete _coarseSoln;_coarseSoln = new pylith::topology::Field(*_coarseMesh);assert(_coarseSoln);
+    const pylith::string_vector& subfieldNames = solution.getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& sinfo = solution.getSubfieldInfo(subfieldNames[i].c_str());
+        pylith::topology::Field::Discretization discretization = sinfo.fe;
+        discretization.dimension = spaceDim;
+        // Coarse mesh has no cohesive cells; restrict fault-only subfields over the whole coarse mesh.
+        discretization.isFaultOnly = false;
+        _coarseSoln->subfieldAdd(sinfo.description, discretization);
+    } // for
+    _coarseSoln->subfieldsSetup();
+    _coarseSoln->createDiscretization();
+    _coarseSoln->setLabel(solution.getLabel());
+    _coarseSoln->allocate();
+    _coarseSoln->createGlobalVector();
+
+    // PETSc computes a general (non-nested) interpolation operator between
+    // the coarse and fine function spaces along with the row scaling that
+    // makes its transpose preserve constants under restriction.
+    err = DMCreateInterpolation(_coarseSoln->getDM(), solution.getDM(), &_interpolation, &_restrictScale);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupProjection
+
+
+// End of file
@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputSolnCoarse.hh
+ *
+ * @brief C++ object for managing decimated output of the solution on a
+ * coarser mesh.
+ */
+
+#if !defined(pylith_meshio_outputsolncoarse_hh)
+#define pylith_meshio_outputsolncoarse_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "OutputSoln.hh" // ISA OutputSoln
+#include "pylith/topology/topologyfwd.hh" // HASA Mesh, Field
+#include "pylith/utils/petscfwd.h" // HASA PetscMat, PetscVec
+
+class pylith::meshio::OutputSolnCoarse : public pylith::meshio::OutputSoln {
+    friend class TestOutputSolnCoarse; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    OutputSolnCoarse(void);
+
+    /// Destructor
+    virtual ~OutputSolnCoarse(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set coarse mesh for decimated output.
+     *
+     * The mesh must cover the domain of the solution. Caller retains
+     * ownership of the mesh.
+     *
+     * @param[in] mesh Coarse finite-element mesh.
+     */
+    void setCoarseMesh(pylith::topology::Mesh* const mesh);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Write solution at time step.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void _writeSolnStep(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution);
+
+    /** Get output subfield, creating if necessary.
+     *
+     * @param[in] field Field containing subfields.
+     * @param[in] submesh Submesh associated with output.
+     * @param[in] name Name of subfield.
+     */
+    OutputSubfield* _getSubfield(const pylith::topology::Field& field,
+                                 const pylith::topology::Mesh& submesh,
+                                 const char* name);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Setup projection of solution onto coarse mesh.
+     *
+     * Creates the solution field on the coarse mesh and the persistent
+     * interpolation operator between the coarse and fine solution spaces.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _setupProjection(const pylith::topology::Field& solution);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::topology::Mesh* _coarseMesh; ///< Coarse mesh for output (borrowed).
+    pylith::topology::Field* _coarseSoln; ///< Solution field on coarse mesh.
+    PetscMat _interpolation; ///< Interpolation from coarse to fine solution space.
+    PetscVec _restrictScale; ///< Row scaling making the transpose of the interpolation a restriction.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputSolnCoarse(const OutputSolnCoarse&); ///< Not implemented.
+    const OutputSolnCoarse& operator=(const OutputSolnCoarse&); ///< Not implemented
+
+}; // OutputSolnCoarse
+
+#endif // pylith_meshio_outputsolncoarse_hh
+
+// End of file
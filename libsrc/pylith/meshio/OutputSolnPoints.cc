@@ -37,6 +37,10 @@
 #include "spatialdata/geocoords/Converter.hh" // USES Converter
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include "petscdmplex.h" // USES DMPlexCoordinatesToReference()
+#include "petscfe.h" // USES PetscFECreateTabulation()
+
+#include <algorithm> // USES std::max()
 #include <cassert> // USES assert()
 
 // ------------------------------------------------------------------------------------------------
@@ -44,7 +48,10 @@
 pylith::meshio::OutputSolnPoints::OutputSolnPoints(void) :
     _pointMesh(NULL),
     _pointSoln(NULL),
-    _interpolator(NULL) {
+    _interpolator(NULL),
+    _interpolationMatrix(NULL),
+    _solutionWrap(NULL),
+    _pointSolnWrap(NULL) {
     PyreComponent::setName("outputsolnpoints");
 } // constructor
 
@@ -64,9 +71,13 @@ pylith::meshio::OutputSolnPoints::deallocate(void) {
 
     OutputSoln::deallocate();
 
+    PetscErrorCode err = 0;
     if (_interpolator) {
-        PetscErrorCode err = DMInterpolationDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
+        err = DMInterpolationDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
     } // if
+    err = MatDestroy(&_interpolationMatrix);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_solutionWrap);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_pointSolnWrap);PYLITH_CHECK_ERROR(err);
 
     delete _pointMesh;_pointMesh = NULL;
     delete _pointSoln;_pointSoln = NULL;
@@ -245,10 +256,135 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
     _pointSoln->setLabel(solution.getLabel());
     _pointSoln->allocate();
 
+    _buildInterpolationMatrix(solution);
+
     PYLITH_METHOD_END;
 } // setupInterpolator
 
 
+// ------------------------------------------------------------------------------------------------
+// Build persistent interpolation operator.
+void
+pylith::meshio::OutputSolnPoints::_buildInterpolationMatrix(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_buildInterpolationMatrix(solution="<<solution.getLabel()<<")");
+
+    assert(_interpolator);
+    assert(_pointSoln);
+
+    PetscErrorCode err = 0;
+    err = MatDestroy(&_interpolationMatrix);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_solutionWrap);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_pointSolnWrap);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    const spatialdata::geocoords::CoordSys* cs = solution.getMesh().getCoordSys();assert(cs);
+    const int spaceDim = cs->getSpaceDim();
+
+    // Verify all subfields use finite elements over the whole domain; fall
+    // back to interpolating with DMInterpolationEvaluate() otherwise.
+    PetscInt numDof = 0;
+    PetscInt maxBasisSize = 0;
+    const pylith::string_vector& subfieldNames = solution.getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNames[i].c_str());
+        if (info.fe.isFaultOnly) {
+            PYLITH_COMPONENT_DEBUG("Solution contains fault-only subfield '"<<subfieldNames[i]
+                                                                            <<"'; interpolating without persistent operator.");
+            PYLITH_METHOD_END;
+        } // if
+        PetscObject obj = NULL;
+        err = DMGetField(dmSoln, info.index, NULL, &obj);PYLITH_CHECK_ERROR(err);
+        PetscClassId id = 0;
+        err = PetscObjectGetClassId(obj, &id);PYLITH_CHECK_ERROR(err);
+        if (PETSCFE_CLASSID != id) {
+            PYLITH_COMPONENT_DEBUG("Subfield '"<<subfieldNames[i]
+                                               <<"' is not a finite-element field; interpolating without persistent operator.");
+            PYLITH_METHOD_END;
+        } // if
+        PetscInt numBasis = 0;
+        err = PetscFEGetDimension((PetscFE) obj, &numBasis);PYLITH_CHECK_ERROR(err);
+        maxBasisSize = std::max(maxBasisSize, numBasis);
+        numDof += info.description.numComponents;
+    } // for
+
+    const PetscInt numPointsLocal = _interpolator->n;
+    const PetscInt numRows = numPointsLocal * numDof;
+    PetscInt numCols = 0;
+    err = VecGetLocalSize(solution.getLocalVector(), &numCols);PYLITH_CHECK_ERROR(err);
+
+    PetscMat matrix = NULL;
+    err = MatCreateSeqAIJ(PETSC_COMM_SELF, numRows, numCols, maxBasisSize, NULL, &matrix);PYLITH_CHECK_ERROR(err);
+
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dmSoln, &section);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* pointCoords = NULL;
+    err = VecGetArrayRead(_interpolator->coords, &pointCoords);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+        const PetscInt cell = _interpolator->cells[iPoint];
+
+        PetscReal coordsReal[3];
+        PetscReal coordsRef[3];
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            coordsReal[iDim] = PetscRealPart(pointCoords[iPoint*spaceDim+iDim]);
+        } // for
+        err = DMPlexCoordinatesToReference(dmSoln, cell, 1, coordsReal, coordsRef);PYLITH_CHECK_ERROR(err);
+
+        PetscInt numIndices = 0;
+        PetscInt* indices = NULL;
+        PetscInt* fieldOffsets = NULL;
+        err = DMPlexGetClosureIndices(dmSoln, section, section, cell, PETSC_TRUE, &numIndices, &indices, &fieldOffsets,
+                                      NULL);PYLITH_CHECK_ERROR(err);
+
+        PetscInt componentOffset = 0;
+        for (size_t i = 0; i < numSubfields; ++i) {
+            const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNames[i].c_str());
+            PetscObject obj = NULL;
+            err = DMGetField(dmSoln, info.index, NULL, &obj);PYLITH_CHECK_ERROR(err);
+            PetscFE fe = (PetscFE) obj;
+            PetscInt numBasis = 0;
+            PetscInt numComponents = 0;
+            err = PetscFEGetDimension(fe, &numBasis);PYLITH_CHECK_ERROR(err);
+            err = PetscFEGetNumComponents(fe, &numComponents);PYLITH_CHECK_ERROR(err);
+
+            PetscTabulation tabulation = NULL;
+            err = PetscFECreateTabulation(fe, 1, 1, coordsRef, 0, &tabulation);PYLITH_CHECK_ERROR(err);
+            const PetscReal* basis = tabulation->T[0];assert(basis);
+
+            for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                const PetscInt column = indices[fieldOffsets[info.index]+iBasis];
+                if (column < 0) { continue;}
+                for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                    const PetscReal value = basis[iBasis*numComponents+iComponent];
+                    if (0.0 == value) { continue;}
+                    const PetscInt row = iPoint*numDof + componentOffset + iComponent;
+                    err = MatSetValue(matrix, row, column, value, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+                } // for
+            } // for
+            err = PetscTabulationDestroy(&tabulation);PYLITH_CHECK_ERROR(err);
+            componentOffset += numComponents;
+        } // for
+
+        err = DMPlexRestoreClosureIndices(dmSoln, section, section, cell, PETSC_TRUE, &numIndices, &indices,
+                                          &fieldOffsets, NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArrayRead(_interpolator->coords, &pointCoords);PYLITH_CHECK_ERROR(err);
+
+    err = MatAssemblyBegin(matrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(matrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    _interpolationMatrix = matrix;
+
+    // Wrappers for the local solution and point solution arrays used in the
+    // matrix-vector product.
+    err = VecCreateSeqWithArray(PETSC_COMM_SELF, 1, numCols, NULL, &_solutionWrap);PYLITH_CHECK_ERROR(err);
+    err = VecCreateSeqWithArray(PETSC_COMM_SELF, 1, numRows, NULL, &_pointSolnWrap);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _buildInterpolationMatrix
+
+
 // ------------------------------------------------------------------------------------------------
 // Append finite-element field to file.
 void
@@ -257,11 +393,28 @@ pylith::meshio::OutputSolnPoints::_interpolateField(const pylith::topology::Fiel
     assert(_pointSoln);
 
     PetscErrorCode err;
-    err = DMInterpolationEvaluate(_interpolator, solution.getDM(), solution.getLocalVector(),
-                                  _pointSoln->getLocalVector());PYLITH_CHECK_ERROR(err);
+    if (_interpolationMatrix) {
+        // Apply persistent interpolation operator to local solution values.
+        PetscVec solutionLocal = solution.getLocalVector();assert(solutionLocal);
+        PetscVec pointSolnLocal = _pointSoln->getLocalVector();assert(pointSolnLocal);
+        const PetscScalar* solutionArray = NULL;
+        PetscScalar* pointSolnArray = NULL;
+        err = VecGetArrayRead(solutionLocal, &solutionArray);PYLITH_CHECK_ERROR(err);
+        err = VecGetArray(pointSolnLocal, &pointSolnArray);PYLITH_CHECK_ERROR(err);
+        err = VecPlaceArray(_solutionWrap, solutionArray);PYLITH_CHECK_ERROR(err);
+        err = VecPlaceArray(_pointSolnWrap, pointSolnArray);PYLITH_CHECK_ERROR(err);
+        err = MatMult(_interpolationMatrix, _solutionWrap, _pointSolnWrap);PYLITH_CHECK_ERROR(err);
+        err = VecResetArray(_pointSolnWrap);PYLITH_CHECK_ERROR(err);
+        err = VecResetArray(_solutionWrap);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArray(pointSolnLocal, &pointSolnArray);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArrayRead(solutionLocal, &solutionArray);PYLITH_CHECK_ERROR(err);
+    } else {
+        err = DMInterpolationEvaluate(_interpolator, solution.getDM(), solution.getLocalVector(),
+                                      _pointSoln->getLocalVector());PYLITH_CHECK_ERROR(err);
+    } // if/else
 
     PYLITH_METHOD_END;
-} // appendVertexField
+} // _interpolateField
 
 
 // ------------------------------------------------------------------------------------------------
@@ -100,6 +100,18 @@ private:
      */
     void _interpolateField(const pylith::topology::Field& solution);
 
+    /** Build persistent interpolation operator.
+     *
+     * Assembles the interpolation weights (basis functions of the cell
+     * containing each point, evaluated at the point) into a rank-local
+     * sparse matrix so that interpolating the solution is a single
+     * matrix-vector product per output instead of recomputing reference
+     * coordinates and tabulations for every point.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _buildInterpolationMatrix(const pylith::topology::Field& solution);
+
     /// Write dataset with names of points to file.
     void _writePointNames(void);
 
@@ -111,6 +123,9 @@ private:
     pylith::topology::Mesh* _pointMesh; ///< Mesh for points (no cells).
     pylith::topology::Field* _pointSoln; ///< Solution field at points.
     DMInterpolationInfo _interpolator; ///< Field interpolator.
+    PetscMat _interpolationMatrix; ///< Persistent interpolation weights (local points x local solution dofs).
+    PetscVec _solutionWrap; ///< Wrapper around local solution array for matrix-vector product.
+    PetscVec _pointSolnWrap; ///< Wrapper around local point solution array for matrix-vector product.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
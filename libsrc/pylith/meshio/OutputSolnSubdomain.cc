@@ -0,0 +1,147 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputSolnSubdomain.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES createSubdomainMesh()
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputSolnSubdomain::OutputSolnSubdomain(void) :
+    _subdomainMesh(NULL),
+    _labelName(""),
+    _labelValue(1) {
+    PyreComponent::setName("outputsolnsubdomain");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputSolnSubdomain::~OutputSolnSubdomain(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputSolnSubdomain::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSoln::deallocate();
+
+    delete _subdomainMesh;_subdomainMesh = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of label identifier for subdomain.
+void
+pylith::meshio::OutputSolnSubdomain::setLabelName(const char* value) {
+    PYLITH_METHOD_BEGIN;
+
+    _labelName = value;
+
+    PYLITH_METHOD_END;
+} // setLabelName
+
+
+// ------------------------------------------------------------------------------------------------
+// Set value of label identifier for subdomain.
+void
+pylith::meshio::OutputSolnSubdomain::setLabelValue(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    _labelValue = value;
+
+    PYLITH_METHOD_END;
+} // setLabelValue
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::meshio::OutputSolnSubdomain::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    OutputSoln::verifyConfiguration(solution);
+
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    PetscBool hasLabel = PETSC_FALSE;
+    PetscErrorCode err = DMHasLabel(dmSoln, _labelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+    if (!hasLabel) {
+        std::ostringstream msg;
+        msg << "Mesh missing group of cells '" << _labelName << " for output using solution subdomain observer '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Write data for step in solution.
+void
+pylith::meshio::OutputSolnSubdomain::_writeSolnStep(const PylithReal t,
+                                                    const PylithInt tindex,
+                                                    const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_writeSolnStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    if (!_subdomainMesh) {
+        _subdomainMesh = pylith::topology::MeshOps::createSubdomainMesh(solution.getMesh(), _labelName.c_str(),
+                                                                        _labelValue, "subdomain");
+        assert(_subdomainMesh);
+        pylith::topology::CoordsVisitor::optimizeClosure(_subdomainMesh->getDM());
+    } // if
+
+    const pylith::string_vector& subfieldNames = pylith::topology::FieldOps::getSubfieldNamesDomain(solution);
+    PetscVec solutionVector = solution.getOutputVector();assert(solutionVector);
+
+    _openSolnStep(t, *_subdomainMesh);
+    const size_t numSubfieldNames = subfieldNames.size();
+    for (size_t iField = 0; iField < numSubfieldNames; iField++) {
+        assert(solution.hasSubfield(subfieldNames[iField].c_str()));
+
+        OutputSubfield* subfield = NULL;
+        subfield = OutputObserver::_getSubfield(solution, *_subdomainMesh, subfieldNames[iField].c_str());assert(subfield);
+        subfield->project(solutionVector);
+
+        OutputObserver::_appendField(t, *subfield);
+    } // for
+    _closeSolnStep();
+
+    PYLITH_METHOD_END;
+} // _writeSolnStep
+
+
+// End of file
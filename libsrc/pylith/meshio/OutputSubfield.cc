@@ -27,8 +27,10 @@
 #include "pylith/fekernels/Solution.hh" // USES Solution::passThruSubfield
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 
 #include <typeinfo> // USES typeid()
+#include <vector> // USES std::vector
 
 // ------------------------------------------------------------------------------------------------
 // Constructor
@@ -37,7 +39,10 @@ pylith::meshio::OutputSubfield::OutputSubfield(void) :
     _vector(NULL),
     _fn(pylith::fekernels::Solution::passThruSubfield),
     _label(NULL),
-    _labelValue(0) {}
+    _labelValue(0),
+    _extractStride(-1),
+    _extractDof(-1),
+    _extractMapComputed(false) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -52,6 +57,11 @@ pylith::meshio::OutputSubfield::~OutputSubfield(void) {
 void
 pylith::meshio::OutputSubfield::deallocate(void) {
     PetscErrorCode err;
+    if (_vector) {
+        PetscInt vectorSize = 0;
+        err = VecGetLocalSize(_vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+        pylith::utils::MemoryLogger::remove("output-buffers", size_t(vectorSize) * sizeof(PylithScalar));
+    } // if
     err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_vector);PYLITH_CHECK_ERROR(err);
 
@@ -93,6 +103,10 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     err = DMCreateGlobalVector(subfield->_dm, &subfield->_vector);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_vector, name);PYLITH_CHECK_ERROR(err);
 
+    PetscInt vectorSize = 0;
+    err = VecGetLocalSize(subfield->_vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::add("output-buffers", size_t(vectorSize) * sizeof(PylithScalar));
+
     PYLITH_METHOD_RETURN(subfield);
 }
 
@@ -132,6 +146,10 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     err = DMCreateGlobalVector(subfield->_dm, &subfield->_vector);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_vector, name);PYLITH_CHECK_ERROR(err);
 
+    PetscInt vectorSize = 0;
+    err = VecGetLocalSize(subfield->_vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::add("output-buffers", size_t(vectorSize) * sizeof(PylithScalar));
+
     PYLITH_METHOD_RETURN(subfield);
 }
 
@@ -243,28 +261,112 @@ pylith::meshio::OutputSubfield::extractSubfield(const pylith::topology::Field& f
     err = VecGetLocalSize(subfieldVector, &subfieldSize);PYLITH_CHECK_ERROR(err);
     assert(subfieldSize == storageSize);
 
-    PetscInt pStart = 0, pEnd = 0;
-    err = PetscSectionGetChart(subfieldSection, &pStart, &pEnd);
+    if (!_extractMapComputed) {
+        _computeExtractMap(field, subfieldIndex);
+    } // if
 
-    pylith::topology::VecVisitorMesh fieldVisitor(field);
-    PetscScalar* solnArray = fieldVisitor.localArray();
+    const PetscScalar* solnArray = NULL;
     PetscScalar* subfieldArray = NULL;
+    err = VecGetArrayRead(field.getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
     err = VecGetArray(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
 
-    for (PetscInt point = pStart, indexVec = 0; point < pEnd; ++point) {
-        const PetscInt solnOffset = fieldVisitor.sectionSubfieldOffset(subfieldIndex, point);
-        const PetscInt solnDof = fieldVisitor.sectionSubfieldDof(subfieldIndex, point);
-
-        for (PetscInt iDof = 0; iDof < solnDof; ++iDof) {
-            // Dimensionalize values while extracting subfield.
-            subfieldArray[indexVec++] = solnArray[solnOffset+iDof] * _description.scale;
+    const PetscScalar scale = _description.scale;
+    if (_extractStride >= 0) {
+        // Uniform layout; extract with strided copy, dimensionalizing values.
+        const PetscInt numPoints = _extractMap.size() > 0 ? _extractMap[1] : 0;
+        const PetscInt offsetStart = _extractMap.size() > 0 ? _extractMap[0] : 0;
+        const PetscInt stride = _extractStride;
+        const PetscInt numDof = _extractDof;
+        for (PetscInt iPoint = 0, indexVec = 0; iPoint < numPoints; ++iPoint) {
+            const PetscInt solnOffset = offsetStart + iPoint*stride;
+            for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+                subfieldArray[indexVec++] = solnArray[solnOffset+iDof] * scale;
+            } // for
         } // for
-    } // for
+    } else {
+        // Nonuniform layout; extract using cached (offset, numDof) pairs.
+        const size_t numPoints = _extractMap.size() / 2;
+        for (size_t iPoint = 0, indexVec = 0; iPoint < numPoints; ++iPoint) {
+            const PetscInt solnOffset = _extractMap[2*iPoint];
+            const PetscInt solnDof = _extractMap[2*iPoint+1];
+            for (PetscInt iDof = 0; iDof < solnDof; ++iDof) {
+                subfieldArray[indexVec++] = solnArray[solnOffset+iDof] * scale;
+            } // for
+        } // for
+    } // if/else
 
     err = VecRestoreArray(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(field.getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // extractSubfield
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute map from solution array to subfield array.
+void
+pylith::meshio::OutputSubfield::_computeExtractMap(const pylith::topology::Field& field,
+                                                   const PetscInt subfieldIndex) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    PetscSection subfieldSection = NULL;
+    err = PetscSectionGetField(field.getLocalSection(), subfieldIndex, &subfieldSection);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(subfieldSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::VecVisitorMesh fieldVisitor(field);
+
+    // Collect (offset, numDof) for points with degrees of freedom in subfield.
+    std::vector<PetscInt> extractMap;
+    extractMap.reserve(2*(pEnd-pStart));
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt solnDof = fieldVisitor.sectionSubfieldDof(subfieldIndex, point);
+        if (solnDof <= 0) { continue; }
+        const PetscInt solnOffset = fieldVisitor.sectionSubfieldOffset(subfieldIndex, point);
+        extractMap.push_back(solnOffset);
+        extractMap.push_back(solnDof);
+    } // for
+    const size_t numPoints = extractMap.size() / 2;
+
+    // Detect uniform layout (constant dof per point and constant stride between
+    // points) for strided fast path.
+    _extractStride = -1;
+    _extractDof = -1;
+    if (numPoints > 0) {
+        bool isUniform = true;
+        const PetscInt numDof = extractMap[1];
+        const PetscInt stride = numPoints > 1 ? extractMap[2] - extractMap[0] : numDof;
+        for (size_t iPoint = 1; iPoint < numPoints; ++iPoint) {
+            if ((extractMap[2*iPoint+1] != numDof) ||
+                (extractMap[2*iPoint] - extractMap[2*(iPoint-1)] != stride)) {
+                isUniform = false;
+                break;
+            } // if
+        } // for
+        if (isUniform) {
+            // Keep only (first offset, number of points); stride and dof are uniform.
+            _extractStride = stride;
+            _extractDof = numDof;
+            _extractMap.resize(2);
+            _extractMap[0] = extractMap[0];
+            _extractMap[1] = numPoints;
+        } else {
+            _extractMap.resize(extractMap.size());
+            for (size_t i = 0; i < extractMap.size(); ++i) {
+                _extractMap[i] = extractMap[i];
+            } // for
+        } // if/else
+    } else {
+        _extractStride = 0;
+        _extractDof = 0;
+        _extractMap.resize(0);
+    } // if/else
+    _extractMapComputed = true;
+
+    PYLITH_METHOD_END;
+} // _computeExtractMap
+
+
 // End of file
@@ -33,6 +33,7 @@
 
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/petscfwd.h" // HASA PetscVec
+#include "pylith/utils/array.hh" // HASA int_array
 
 class pylith::meshio::OutputSubfield : public pylith::utils::GenericComponent {
     friend class TestOutputSubfield; // unit testing
@@ -132,6 +133,20 @@ private:
     // Constructor.
     OutputSubfield(void);
 
+    /** Compute map from solution array to subfield array.
+     *
+     * The map is computed once and reused for all subsequent extractions,
+     * replacing per-point PETSc section queries with array lookups. Layouts
+     * with a constant number of degrees of freedom per point and constant
+     * stride between points are flagged so extraction reduces to a strided
+     * copy.
+     *
+     * @param[in] field Field with all subfields.
+     * @param[in] subfieldIndex Index of subfield to extract.
+     */
+    void _computeExtractMap(const pylith::topology::Field& field,
+                            const PetscInt subfieldIndex);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -145,6 +160,11 @@ protected:
     PetscDMLabel _label; ///< PETSc label associated with subfield.
     PetscInt _labelValue; ///< Value of PETSc label associated with subfield.
 
+    pylith::int_array _extractMap; ///< Cached (offset, numDof) pairs for extracting subfield.
+    PetscInt _extractStride; ///< Stride between points in solution array (uniform layout); -1 if nonuniform.
+    PetscInt _extractDof; ///< Degrees of freedom per point (uniform layout); -1 if nonuniform.
+    bool _extractMapComputed; ///< True if extraction map has been computed.
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -45,4 +45,19 @@ pylith::meshio::OutputTrigger::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Update trigger state with current solution.
+void
+pylith::meshio::OutputTrigger::setState(const pylith::topology::Field& solution) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Estimate number of writes for a simulation.
+size_t
+pylith::meshio::OutputTrigger::estimateNumWrites(const size_t numTimeSteps,
+                                                 const PylithReal duration) const {
+    return numTimeSteps;
+} // estimateNumWrites
+
+
 // End of file
@@ -29,6 +29,7 @@
 
 #include "pylith/utils/PyreComponent.hh"
 
+#include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/types.hh" // USE PylithInt, PylithReal
 
 class pylith::meshio::OutputTrigger : public pylith::utils::PyreComponent {
@@ -49,6 +50,16 @@ public:
      */
     void setTimeScale(const PylithReal value);
 
+    /** Update trigger state with current solution.
+     *
+     * Called before shouldWrite() so triggers can base their decision on the
+     * solution; default implementation does nothing.
+     *
+     * @param[in] solution Solution at time of proposed write.
+     */
+    virtual
+    void setState(const pylith::topology::Field& solution);
+
     /** Check whether we want to write output at time t.
      *
      * @param[in] t Time of proposed write.
@@ -59,6 +70,32 @@ public:
     bool shouldWrite(const PylithReal t,
                      const PylithInt tindex) = 0;
 
+    /** Check whether output would be written at time t without updating the trigger state.
+     *
+     * Used to decide whether to compute fields consumed only by output (e.g., derived fields)
+     * before shouldWrite() is called.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Index of current time step.
+     * @returns True if output would be written at time t, false otherwise.
+     */
+    virtual
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const = 0;
+
+    /** Estimate number of writes for a simulation.
+     *
+     * Used by writers to preallocate time-series dataset extents. The default implementation
+     * conservatively assumes a write every time step.
+     *
+     * @param[in] numTimeSteps Expected number of time steps in simulation.
+     * @param[in] duration Duration of simulation (seconds).
+     * @returns Estimated number of writes.
+     */
+    virtual
+    size_t estimateNumWrites(const size_t numTimeSteps,
+                             const PylithReal duration) const;
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
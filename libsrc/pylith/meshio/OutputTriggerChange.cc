@@ -0,0 +1,202 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputTriggerChange.hh" // Implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::computeDiagnostics()
+
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "petscdm.h" // USES DMCreateSubDM()
+
+#include <cassert> // USES assert()
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputTriggerChange::OutputTriggerChange(void) :
+    _threshold(0.01),
+    _relChange(PYLITH_MAXSCALAR),
+    _maxNumStepsSkip(PYLITH_MAXINT/2),
+    _stepWrote(PYLITH_MININT+10),
+    _solnLast(NULL),
+    _solnCurrent(NULL),
+    _solnDiff(NULL),
+    _subfieldIS(NULL) { // constructor
+    PyreComponent::setName("outputtriggerchange");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputTriggerChange::~OutputTriggerChange(void) {
+    PetscErrorCode err = 0;
+    err = VecDestroy(&_solnLast);PYLITH_CHECK_ERROR_NOTHROW(err);
+    err = VecDestroy(&_solnCurrent);PYLITH_CHECK_ERROR_NOTHROW(err);
+    err = VecDestroy(&_solnDiff);PYLITH_CHECK_ERROR_NOTHROW(err);
+    err = ISDestroy(&_subfieldIS);PYLITH_CHECK_ERROR_NOTHROW(err);
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set threshold for relative change in solution triggering a write.
+void
+pylith::meshio::OutputTriggerChange::setThreshold(const double value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setThreshold(value="<<value<<")");
+
+    _threshold = (value >= 0.0) ? value : 0.0;
+} // setThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get threshold for relative change in solution triggering a write.
+double
+pylith::meshio::OutputTriggerChange::getThreshold(void) const {
+    return _threshold;
+} // getThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set maximum number of steps to skip between writes.
+void
+pylith::meshio::OutputTriggerChange::setMaxNumStepsSkip(const int value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setMaxNumStepsSkip(value="<<value<<")");
+
+    _maxNumStepsSkip = (value >= 0) ? value : 0;
+} // setMaxNumStepsSkip
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get maximum number of steps to skip between writes.
+int
+pylith::meshio::OutputTriggerChange::getMaxNumStepsSkip(void) const {
+    return _maxNumStepsSkip;
+} // getMaxNumStepsSkip
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of solution subfield used for change metric.
+void
+pylith::meshio::OutputTriggerChange::setSubfieldName(const char* name) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setSubfieldName(name="<<name<<")");
+
+    _subfieldName = name;
+} // setSubfieldName
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of solution subfield used for change metric.
+const char*
+pylith::meshio::OutputTriggerChange::getSubfieldName(void) const {
+    return _subfieldName.c_str();
+} // getSubfieldName
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update trigger state with current solution.
+void
+pylith::meshio::OutputTriggerChange::setState(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setState(solution="<<solution.getLabel()<<")");
+
+    PetscErrorCode err = 0;
+    PetscVec solnGlobal = solution.getGlobalVector();assert(solnGlobal);
+    solution.scatterLocalToVector(solnGlobal);
+
+    // Restrict metric to subfield if requested.
+    PetscVec metricVec = solnGlobal;
+    PetscVec subfieldVec = NULL;
+    if (!_subfieldName.empty()) {
+        if (!_subfieldIS) {
+            const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(_subfieldName.c_str());
+            PetscInt subfieldIndices[1] = { info.index };
+            err = DMCreateSubDM(solution.getDM(), 1, subfieldIndices, &_subfieldIS, NULL);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecGetSubVector(solnGlobal, _subfieldIS, &subfieldVec);PYLITH_CHECK_ERROR(err);
+        metricVec = subfieldVec;
+    } // if
+
+    if (!_solnLast) {
+        // First call; force write and save solution as reference state.
+        err = VecDuplicate(metricVec, &_solnLast);PYLITH_CHECK_ERROR(err);
+        err = VecDuplicate(metricVec, &_solnCurrent);PYLITH_CHECK_ERROR(err);
+        err = VecDuplicate(metricVec, &_solnDiff);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(metricVec, _solnCurrent);PYLITH_CHECK_ERROR(err);
+        _relChange = PYLITH_MAXSCALAR;
+    } else {
+        err = VecCopy(metricVec, _solnCurrent);PYLITH_CHECK_ERROR(err);
+        err = VecWAXPY(_solnDiff, -1.0, _solnLast, _solnCurrent);PYLITH_CHECK_ERROR(err);
+        // Compute both norms with one fused reduction.
+        const PetscVec normVecs[2] = { _solnDiff, _solnCurrent };
+        pylith::topology::FieldOps::Diagnostics diagnostics[2];
+        pylith::topology::FieldOps::computeDiagnostics(normVecs, 2, diagnostics);
+        const PetscReal normDiff = diagnostics[0].norm2;
+        const PetscReal normSoln = diagnostics[1].norm2;
+        if (normSoln > 0.0) {
+            _relChange = normDiff / normSoln;
+        } else {
+            _relChange = (normDiff > 0.0) ? PYLITH_MAXSCALAR : 0.0;
+        } // if/else
+    } // if/else
+
+    if (subfieldVec) {
+        err = VecRestoreSubVector(solnGlobal, _subfieldIS, &subfieldVec);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t.
+bool
+pylith::meshio::OutputTriggerChange::shouldWrite(const PylithReal t,
+                                                 const PylithInt tindex) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::shouldWrite(t="<<t<<", tindex="<<tindex<<")");
+
+    bool isWrite = false;
+    if ((_relChange >= _threshold) || (tindex - _stepWrote > _maxNumStepsSkip)) {
+        isWrite = true;
+        _stepWrote = tindex;
+        if (_solnLast && _solnCurrent) {
+            PetscErrorCode err = VecCopy(_solnCurrent, _solnLast);PYLITH_CHECK_ERROR(err);
+        } // if
+        _relChange = 0.0;
+    } // if
+
+    PYLITH_METHOD_RETURN(isWrite);
+} // shouldWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output would be written at time t without updating the trigger state.
+bool
+pylith::meshio::OutputTriggerChange::willWrite(const PylithReal t,
+                                               const PylithInt tindex) const {
+    // Conservative; the change metric for the current time step is not known
+    // until setState() is called with the solution.
+    return true;
+} // willWrite
+
+
+// End of file
@@ -0,0 +1,143 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputTriggerChange.hh
+ *
+ * @brief Base decision on whether to write output on change in the solution since the most recent write.
+ */
+
+#if !defined(pylith_meshio_outputtriggerchange_hh)
+#define pylith_meshio_outputtriggerchange_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputTrigger.hh" // ISA OutputTrigger
+
+#include "pylith/utils/petscfwd.h" // HASA PetscVec, PetscIS
+
+#include <string> // HASA std::string
+
+class pylith::meshio::OutputTriggerChange : public pylith::meshio::OutputTrigger {
+    friend class TestOutputTriggerChange; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    OutputTriggerChange(void);
+
+    /// Destructor
+    ~OutputTriggerChange(void);
+
+    /** Update trigger state with current solution.
+     *
+     * Computes the relative change in the solution (or a subfield of the
+     * solution) since the most recent write.
+     *
+     * @param[in] solution Solution at time of proposed write.
+     */
+    void setState(const pylith::topology::Field& solution);
+
+    /** Check whether we want to write output at time t.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    bool shouldWrite(const PylithReal t,
+                     const PylithInt tindex);
+
+    /** Check whether output would be written at time t without updating the trigger state.
+     *
+     * The change metric is not known until setState() is called with the
+     * solution for the current time step, so this conservatively returns
+     * true; fields computed only for output are computed every time step.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output would be written at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
+    /** Set threshold for relative change in solution triggering a write.
+     *
+     * @param[in] value Threshold for relative change (L2 norm of increment / L2 norm of solution).
+     */
+    void setThreshold(const double value);
+
+    /** Get threshold for relative change in solution triggering a write.
+     *
+     * @returns Threshold for relative change.
+     */
+    double getThreshold(void) const;
+
+    /** Set maximum number of steps to skip between writes.
+     *
+     * Ensures sparse coverage of quiescent intervals regardless of the
+     * change metric.
+     *
+     * @param[in] value Maximum number of steps to skip between writes.
+     */
+    void setMaxNumStepsSkip(const int value);
+
+    /** Get maximum number of steps to skip between writes.
+     *
+     * @returns Maximum number of steps to skip between writes.
+     */
+    int getMaxNumStepsSkip(void) const;
+
+    /** Set name of solution subfield used for change metric.
+     *
+     * @param[in] name Name of subfield (empty string means entire solution).
+     */
+    void setSubfieldName(const char* name);
+
+    /** Get name of solution subfield used for change metric.
+     *
+     * @returns Name of subfield.
+     */
+    const char* getSubfieldName(void) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _subfieldName; ///< Name of subfield for change metric (empty means entire solution).
+    PylithReal _threshold; ///< Threshold for relative change triggering a write.
+    PylithReal _relChange; ///< Relative change in solution since most recent write.
+    PylithInt _maxNumStepsSkip; ///< Maximum number of steps to skip between writes.
+    PylithInt _stepWrote; ///< Step when data was previously written.
+    PetscVec _solnLast; ///< Solution (or subfield) at most recent write.
+    PetscVec _solnCurrent; ///< Solution (or subfield) at current time step.
+    PetscVec _solnDiff; ///< Increment in solution since most recent write.
+    PetscIS _subfieldIS; ///< Index set for subfield in solution global vector.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputTriggerChange(const OutputTriggerChange&); ///< Not implemented.
+    const OutputTriggerChange& operator=(const OutputTriggerChange&); ///< Not implemented
+
+};
+
+// OutputTriggerChange
+
+#endif // pylith_meshio_outputtriggerchange_hh
+
+// End of file
@@ -74,4 +74,22 @@ pylith::meshio::OutputTriggerStep::shouldWrite(const PylithReal t,
 } // shouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output would be written at time t without updating the trigger state.
+bool
+pylith::meshio::OutputTriggerStep::willWrite(const PylithReal t,
+                                             const PylithInt tindex) const {
+    return tindex - _stepWrote > _numStepsSkip;
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Estimate number of writes for a simulation.
+size_t
+pylith::meshio::OutputTriggerStep::estimateNumWrites(const size_t numTimeSteps,
+                                                     const PylithReal duration) const {
+    return 1 + numTimeSteps / (1 + _numStepsSkip);
+} // estimateNumWrites
+
+
 // End of file
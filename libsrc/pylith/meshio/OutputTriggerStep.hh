@@ -50,6 +50,24 @@ public:
     bool shouldWrite(const PylithReal t,
                      const PylithInt tindex);
 
+    /** Check whether output would be written at time t without updating the trigger state.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output would be written at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
+    /** Estimate number of writes for a simulation.
+     *
+     * @param[in] numTimeSteps Expected number of time steps in simulation.
+     * @param[in] duration Duration of simulation (seconds).
+     * @returns Estimated number of writes.
+     */
+    size_t estimateNumWrites(const size_t numTimeSteps,
+                             const PylithReal duration) const;
+
     /** Set number of steps to skip between writes.
      *
      * @param[in] Number of steps to skip between writes.
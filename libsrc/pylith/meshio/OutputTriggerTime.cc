@@ -24,6 +24,8 @@
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
+#include <algorithm> // USES std::min
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputTriggerTime::OutputTriggerTime(void) :
@@ -74,4 +76,26 @@ pylith::meshio::OutputTriggerTime::shouldWrite(const PylithReal t,
 } // shouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output would be written at time t without updating the trigger state.
+bool
+pylith::meshio::OutputTriggerTime::willWrite(const PylithReal t,
+                                             const PylithInt timeStep) const {
+    return t - _timeNondimWrote >= _timeSkip / _timeScale;
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Estimate number of writes for a simulation.
+size_t
+pylith::meshio::OutputTriggerTime::estimateNumWrites(const size_t numTimeSteps,
+                                                     const PylithReal duration) const {
+    if ((_timeSkip <= 0.0) || (duration <= 0.0)) {
+        return numTimeSteps;
+    } // if
+    const size_t numWrites = 1 + size_t(duration / _timeSkip);
+    return std::min(numWrites, numTimeSteps);
+} // estimateNumWrites
+
+
 // End of file
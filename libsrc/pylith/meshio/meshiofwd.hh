@@ -34,9 +34,11 @@ namespace pylith {
         class MeshIO;
         class MeshBuilder;
         class MeshIOAscii;
+        class MeshIOBinary;
         class MeshIOPetsc;
         class MeshIOCubit;
         class MeshIOLagrit;
+        class MeshIOMemory;
 
         class GMVFile;
         class GMVFileAscii;
@@ -51,7 +53,9 @@ namespace pylith {
         class OutputSoln;
         class OutputSolnDomain;
         class OutputSolnBoundary;
+        class OutputSolnCoarse;
         class OutputSolnPoints;
+        class OutputSolnSubdomain;
 
         class OutputPhysics;
         class OutputIntegrator;
@@ -59,6 +63,7 @@ namespace pylith {
 
         class ObserverOutput;
         class OutputTrigger;
+        class OutputTriggerChange;
         class OutputTriggerStep;
         class OutputTriggerTime;
 
@@ -66,6 +71,7 @@ namespace pylith {
         class DataWriterVTK;
         class DataWriterHDF5;
         class DataWriterHDF5Ext;
+        class DataWriterMemory;
 
         class HDF5;
         class Xdmf;
@@ -30,9 +30,13 @@
 #include "pylith/problems/ProgressMonitorStep.hh" // USES ProgressMonitorStep
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
 
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "petscsnes.h" // USES PetscSNES
+#include "petscdmplex.h" // USES DMPlexCoordinatesToReference()
+#include "petscfe.h" // USES PetscFECreateTabulation()
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5Open()
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
@@ -56,8 +60,11 @@ public:
 pylith::problems::GreensFns::GreensFns(void) :
     _faultLabelName(pylith::topology::Mesh::cells_label_name),
     _faultLabelValue(100),
+    _impulseBatchSize(1),
     _faultImpulses(NULL),
     _integratorImpulses(NULL),
+    _stationSampler(NULL),
+    _stationOperator(NULL),
     _snes(NULL),
     _monitor(NULL) {
     PyreComponent::setName(_GreensFns::pyreComponent);
@@ -87,7 +94,10 @@ pylith::problems::GreensFns::deallocate(void) {
 
     _monitor = NULL; // Memory handle in Python. :TODO: Use shared pointer.
 
+    delete _stationSampler;_stationSampler = NULL;
+
     PetscErrorCode err = SNESDestroy(&_snes);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_stationOperator);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -133,6 +143,79 @@ pylith::problems::GreensFns::getFaultLabelValue(void) const {
 } // getFaultLabelValue
 
 
+// ------------------------------------------------------------------------------------------------
+// Set number of impulses solved together as multiple right-hand sides.
+void
+pylith::problems::GreensFns::setImpulseBatchSize(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setImpulseBatchSize(value="<<value<<")");
+
+    if (value < 1) {
+        throw std::runtime_error("Number of impulses per batch must be at least 1.");
+    } // if
+
+    _impulseBatchSize = value;
+} // setImpulseBatchSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of impulses solved together as multiple right-hand sides.
+size_t
+pylith::problems::GreensFns::getImpulseBatchSize(void) const {
+    return _impulseBatchSize;
+} // getImpulseBatchSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set station locations for computing the fault-to-station operator by reciprocity.
+void
+pylith::problems::GreensFns::setStations(const PylithReal* stationCoords,
+                                         const int numStations,
+                                         const int spaceDim,
+                                         const char* const* stationNames,
+                                         const int numStationNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setStations(numStations="<<numStations<<", spaceDim="<<spaceDim<<")");
+
+    assert(stationCoords && stationNames);
+    assert(numStations == numStationNames);
+
+    // Copy station coordinates.
+    const PylithInt size = numStations * spaceDim;
+    _stationCoords.resize(size);
+    for (PylithInt i = 0; i < size; ++i) {
+        _stationCoords[i] = stationCoords[i];
+    } // for
+
+    // Copy station names.
+    _stationNames.resize(numStationNames);
+    for (PylithInt i = 0; i < numStationNames; ++i) {
+        _stationNames[i] = stationNames[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // setStations
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename for fault-to-station operator computed by reciprocity.
+void
+pylith::problems::GreensFns::setReciprocityFilename(const char* filename) {
+    PYLITH_COMPONENT_DEBUG("setReciprocityFilename(filename="<<filename<<")");
+
+    _reciprocityFilename = filename;
+} // setReciprocityFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename for fault-to-station operator assembled from forward responses.
+void
+pylith::problems::GreensFns::setOperatorFilename(const char* filename) {
+    PYLITH_COMPONENT_DEBUG("setOperatorFilename(filename="<<filename<<")");
+
+    _operatorFilename = filename;
+} // setOperatorFilename
+
+
 // ------------------------------------------------------------------------------------------------
 // Set progress monitor.
 void
@@ -261,6 +344,20 @@ pylith::problems::GreensFns::initialize(void) {
     err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
     err = SNESSetUp(_snes);PYLITH_CHECK_ERROR(err);
 
+    // Warm-start successive impulse solves. Neighboring impulses have similar spatial support,
+    // so seeding each Krylov solve with the projection of its right-hand side onto the space
+    // spanned by previous impulse solutions (Fischer guess) cuts iterations across the impulse
+    // sweep. Skip preconditioner-only solves, which require a zero initial guess.
+    PetscKSP ksp = NULL;
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);assert(ksp);
+    PetscBool isPreonly = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)ksp, KSPPREONLY, &isPreonly);PYLITH_CHECK_ERROR(err);
+    if (!isPreonly) {
+        const PetscInt guessBasisSize = 10;
+        err = KSPSetInitialGuessNonzero(ksp, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+        err = KSPSetUseFischerGuess(ksp, 1, guessBasisSize);PYLITH_CHECK_ERROR(err);
+    } // if
+
     // Get integrator for fault with impulses.
     assert(!_integratorImpulses);
     const size_t numIntegrators = _integrators.size();
@@ -323,28 +420,487 @@ pylith::problems::GreensFns::solve(void) {
         numImpulsesGlobal += numImpulses[iProc];
     } // for
 
-    const PylithReal tolerance = 1.0e-4;
+    // Map each global impulse to the rank owning it and its rank-local index.
+    int_array impulseProcs(numImpulsesGlobal);
+    int_array impulseLocalIndices(numImpulsesGlobal);
     for (int iProc = 0, iImpulseGlobal = 0; iProc < mpiNumProcs; ++iProc) {
         for (int iImpulseLocal = 0; iImpulseLocal < numImpulses[iProc]; ++iImpulseLocal, ++iImpulseGlobal) {
+            impulseProcs[iImpulseGlobal] = iProc;
+            impulseLocalIndices[iImpulseGlobal] = iImpulseLocal;
+        } // for
+    } // for
+
+    if (_stationNames.size() > 0) {
+        if (_operatorFilename.empty()) {
+            // Stations given; compute the fault-to-station operator by reciprocity
+            // instead of full-domain responses per impulse.
+            _solveReciprocity(impulseProcs, impulseLocalIndices, numImpulsesGlobal);
+            PYLITH_METHOD_END;
+        } // if
+        // Stations and operator file given; sample each forward response at the stations
+        // in poststep() and assemble it directly into the distributed operator.
+        _createStationOperator(numImpulsesGlobal);
+    } // if
+
+    const PylithReal tolerance = 1.0e-4;
+    for (size_t iImpulseGlobal = 0; iImpulseGlobal < numImpulsesGlobal;) {
+        size_t batchSize = _impulseBatchSize;
+        if (batchSize > numImpulsesGlobal - iImpulseGlobal) { batchSize = numImpulsesGlobal - iImpulseGlobal; }
+        if ((0 == iImpulseGlobal) || (batchSize < 2)) {
+            // Solve through PetscSNES; the first solve assembles and factors the Jacobian,
+            // which SNESSetLagJacobian(-2) retains for all subsequent impulses.
             if (0 == mpiRank) {
                 PYLITH_COMPONENT_INFO_ROOT("Computing Green's function " << iImpulseGlobal+1 << " of " << numImpulsesGlobal << ".");
             } // if
 
             // Update impulse on fault
-            const PetscReal impulseReal = (mpiRank == iProc) ? iImpulseLocal + tolerance : -1.0;
+            const PetscReal impulseReal = (mpiRank == impulseProcs[iImpulseGlobal]) ? impulseLocalIndices[iImpulseGlobal] + tolerance : -1.0;
             _integratorImpulses->setState(impulseReal);
 
             err = SNESSolve(_snes, residual->getGlobalVector(), solution->getGlobalVector());PYLITH_CHECK_ERROR(err);
             solution->scatterVectorToLocal(solution->getGlobalVector());
             solution->scatterLocalToOutput();
-            poststep(size_t(iImpulseGlobal), numImpulsesGlobal);
-        } // for
+            poststep(iImpulseGlobal, numImpulsesGlobal);
+            ++iImpulseGlobal;
+        } else {
+            _solveImpulseBatch(iImpulseGlobal, batchSize, impulseProcs, impulseLocalIndices, numImpulsesGlobal);
+            iImpulseGlobal += batchSize;
+        } // if/else
     } // for
 
+    if (_stationOperator) {
+        _writeStationOperator();
+    } // if
+
     PYLITH_METHOD_END;
 } // solve
 
 
+// ------------------------------------------------------------------------------------------------
+// Solve a batch of impulses as multiple right-hand sides, reusing the Jacobian factorization.
+void
+pylith::problems::GreensFns::_solveImpulseBatch(const size_t impulseStart,
+                                                const size_t batchSize,
+                                                const int_array& impulseProcs,
+                                                const int_array& impulseLocalIndices,
+                                                const size_t numImpulsesGlobal) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_solveImpulseBatch(impulseStart="<<impulseStart<<", batchSize="<<batchSize<<")");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    PetscErrorCode err;
+    int mpiRank = 0;
+    PetscDM dm = getPetscDM();
+    MPI_Comm comm = PetscObjectComm((PetscObject)dm);
+    err = MPI_Comm_rank(comm, &mpiRank);PYLITH_CHECK_ERROR(err);
+
+    PetscKSP ksp = NULL;
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);assert(ksp);
+
+    PetscVec solutionVec = solution->getGlobalVector();
+    PetscVec solutionBase = NULL;
+    err = VecDuplicate(solutionVec, &solutionBase);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, solutionBase);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numRowsLocal = 0, numRowsGlobal = 0;
+    err = VecGetLocalSize(solutionVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(solutionVec, &numRowsGlobal);PYLITH_CHECK_ERROR(err);
+
+    PetscMat rhsMat = NULL, stepMat = NULL;
+    err = MatCreateDense(comm, numRowsLocal, PETSC_DECIDE, numRowsGlobal, batchSize, NULL, &rhsMat);PYLITH_CHECK_ERROR(err);
+    err = MatCreateDense(comm, numRowsLocal, PETSC_DECIDE, numRowsGlobal, batchSize, NULL, &stepMat);PYLITH_CHECK_ERROR(err);
+
+    // Assemble the Newton right-hand side for each impulse at the shared base solution.
+    const PylithReal tolerance = 1.0e-4;
+    for (size_t i = 0; i < batchSize; ++i) {
+        const size_t iImpulseGlobal = impulseStart + i;
+        if (0 == mpiRank) {
+            PYLITH_COMPONENT_INFO_ROOT("Computing Green's function " << iImpulseGlobal+1 << " of " << numImpulsesGlobal << ".");
+        } // if
+
+        // Update impulse on fault
+        const PetscReal impulseReal = (mpiRank == impulseProcs[iImpulseGlobal]) ? impulseLocalIndices[iImpulseGlobal] + tolerance : -1.0;
+        _integratorImpulses->setState(impulseReal);
+
+        PetscVec rhsVec = NULL;
+        err = MatDenseGetColumnVecWrite(rhsMat, i, &rhsVec);PYLITH_CHECK_ERROR(err);
+        computeResidual(rhsVec, solutionBase);
+        err = MatDenseRestoreColumnVecWrite(rhsMat, i, &rhsVec);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // One solve for all right-hand sides, reusing the factorization/preconditioner.
+    err = KSPMatSolve(ksp, rhsMat, stepMat);PYLITH_CHECK_ERROR(err);
+
+    // Apply the Newton correction for each impulse and stream out the response.
+    for (size_t i = 0; i < batchSize; ++i) {
+        PetscVec stepVec = NULL;
+        err = MatDenseGetColumnVecRead(stepMat, i, &stepVec);PYLITH_CHECK_ERROR(err);
+        err = VecWAXPY(solutionVec, -1.0, stepVec, solutionBase);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecRead(stepMat, i, &stepVec);PYLITH_CHECK_ERROR(err);
+
+        solution->scatterVectorToLocal(solutionVec);
+        solution->scatterLocalToOutput();
+        poststep(impulseStart + i, numImpulsesGlobal);
+    } // for
+
+    err = MatDestroy(&rhsMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&stepMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionBase);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _solveImpulseBatch
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute the fault-to-station operator by reciprocity.
+void
+pylith::problems::GreensFns::_solveReciprocity(const int_array& impulseProcs,
+                                               const int_array& impulseLocalIndices,
+                                               const size_t numImpulsesGlobal) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_solveReciprocity(numImpulsesGlobal="<<numImpulsesGlobal<<")");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    PetscErrorCode err;
+    int mpiRank = 0;
+    PetscDM dmSoln = solution->getDM();assert(dmSoln);
+    MPI_Comm comm = PetscObjectComm((PetscObject)dmSoln);
+    err = MPI_Comm_rank(comm, &mpiRank);PYLITH_CHECK_ERROR(err);
+
+    const size_t numStations = _stationNames.size();
+
+    // Locate the cell containing each station and tabulate the displacement basis there.
+    // The tabulated basis values at the station are both the interpolation weights and
+    // the entries of the adjoint point load for the station.
+    StationSampler sampler;
+    _tabulateStations(&sampler);
+    const PylithInt numBasis = sampler.numBasis;
+    const PylithInt numComponents = sampler.numComponents;
+    const size_t numStationsLocal = sampler.stationIndices.size();
+
+    // Assemble the Jacobian once at the zero base solution and attach it to the
+    // linear solver. Responses in this mode are relative to a zero background,
+    // so the impulse right-hand sides are also assembled at zero.
+    PetscVec solutionVec = solution->getGlobalVector();
+    PetscVec solutionZero = NULL;
+    err = VecDuplicate(solutionVec, &solutionZero);PYLITH_CHECK_ERROR(err);
+    err = VecSet(solutionZero, 0.0);PYLITH_CHECK_ERROR(err);
+
+    PetscMat jacobianMat = NULL;
+    err = DMCreateMatrix(dmSoln, &jacobianMat);PYLITH_CHECK_ERROR(err);
+    computeJacobian(jacobianMat, jacobianMat, solutionZero);
+
+    PetscKSP ksp = NULL;
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);assert(ksp);
+    err = KSPSetOperators(ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    // Solve one adjoint problem per station displacement component, with the station
+    // point load as the right-hand side and the transpose of the Jacobian as the
+    // operator.
+    const size_t numRows = numStations * numComponents;
+    std::vector<PetscVec> adjointVecs(numRows, (PetscVec)NULL);
+    PetscVec loadLocal = NULL;
+    PetscVec loadGlobal = NULL;
+    err = DMCreateLocalVector(dmSoln, &loadLocal);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &loadGlobal);PYLITH_CHECK_ERROR(err);
+    for (size_t iRow = 0; iRow < numRows; ++iRow) {
+        const PetscInt iStation = iRow / numComponents;
+        const PetscInt iComponent = iRow % numComponents;
+        PYLITH_COMPONENT_INFO_ROOT("Computing adjoint response "<<iRow+1<<" of "<<numRows
+                                                                <<" (station '"<<_stationNames[iStation]<<"', component "<<iComponent<<").");
+
+        err = VecSet(loadLocal, 0.0);PYLITH_CHECK_ERROR(err);
+        PetscScalar* loadArray = NULL;
+        err = VecGetArray(loadLocal, &loadArray);PYLITH_CHECK_ERROR(err);
+        for (size_t iStationLocal = 0; iStationLocal < numStationsLocal; ++iStationLocal) {
+            if (sampler.stationIndices[iStationLocal] != iStation) { continue;}
+            for (PylithInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                const PylithInt dof = sampler.dofs[iStationLocal][iBasis];
+                if (dof < 0) { continue;} // Constrained dof.
+                loadArray[dof] += sampler.basis[iStationLocal][iBasis*numComponents+iComponent];
+            } // for
+        } // for
+        err = VecRestoreArray(loadLocal, &loadArray);PYLITH_CHECK_ERROR(err);
+
+        err = VecSet(loadGlobal, 0.0);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalBegin(dmSoln, loadLocal, ADD_VALUES, loadGlobal);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalEnd(dmSoln, loadLocal, ADD_VALUES, loadGlobal);PYLITH_CHECK_ERROR(err);
+
+        err = VecDuplicate(solutionVec, &adjointVecs[iRow]);PYLITH_CHECK_ERROR(err);
+        err = KSPSolveTranspose(ksp, loadGlobal, adjointVecs[iRow]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Sweep the impulses. By reciprocity, the station response to impulse k is the
+    // inner product of the adjoint response with the right-hand side of impulse k,
+    // so each impulse costs one residual assembly instead of one solve.
+    PetscMat operatorMat = NULL;
+    err = MatCreateDense(comm, PETSC_DECIDE, PETSC_DECIDE, numRows, numImpulsesGlobal, NULL, &operatorMat);PYLITH_CHECK_ERROR(err);
+    PetscInt rowStart = 0, rowEnd = 0;
+    err = MatGetOwnershipRange(operatorMat, &rowStart, &rowEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscVec rhsVec = NULL;
+    err = VecDuplicate(solutionVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscScalar> rowValues(numRows);
+    const PylithReal tolerance = 1.0e-4;
+    for (size_t iImpulseGlobal = 0; iImpulseGlobal < numImpulsesGlobal; ++iImpulseGlobal) {
+        PYLITH_COMPONENT_INFO_ROOT("Assembling impulse "<<iImpulseGlobal+1<<" of "<<numImpulsesGlobal<<".");
+
+        // Update impulse on fault
+        const PetscReal impulseReal = (mpiRank == impulseProcs[iImpulseGlobal]) ? impulseLocalIndices[iImpulseGlobal] + tolerance : -1.0;
+        _integratorImpulses->setState(impulseReal);
+
+        computeResidual(rhsVec, solutionZero);
+        err = VecMDot(rhsVec, numRows, &adjointVecs[0], &rowValues[0]);PYLITH_CHECK_ERROR(err);
+
+        // The response to impulse k is -J^{-1} F_k(0), so the station response is
+        // the negative of the inner product.
+        for (PetscInt iRow = rowStart; iRow < rowEnd; ++iRow) {
+            err = MatSetValue(operatorMat, iRow, iImpulseGlobal, -rowValues[iRow], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        if (_monitor) {
+            _monitor->update(iImpulseGlobal, 0, numImpulsesGlobal);
+        } // if
+    } // for
+    err = MatAssemblyBegin(operatorMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(operatorMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    // Write the operator.
+    if (!_reciprocityFilename.empty()) {
+        PetscViewer viewer = NULL;
+        err = PetscObjectSetName((PetscObject)operatorMat, "greens_fns");PYLITH_CHECK_ERROR(err);
+        err = PetscViewerHDF5Open(comm, _reciprocityFilename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+        err = MatView(operatorMat, viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Restore the PyLith view of the solution; the residual assemblies set it to zero.
+    solution->scatterVectorToLocal(solutionVec);
+
+    for (size_t iRow = 0; iRow < numRows; ++iRow) {
+        err = VecDestroy(&adjointVecs[iRow]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&loadLocal);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&loadGlobal);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionZero);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&operatorMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _solveReciprocity
+
+
+// ------------------------------------------------------------------------------------------------
+// Locate the cell containing each station and tabulate the displacement basis there.
+void
+pylith::problems::GreensFns::_tabulateStations(StationSampler* sampler) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_tabulateStations(sampler="<<sampler<<")");
+
+    assert(sampler);
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = solution->getDM();assert(dmSoln);
+    MPI_Comm comm = PetscObjectComm((PetscObject)dmSoln);
+
+    const spatialdata::geocoords::CoordSys* cs = solution->getMesh().getCoordSys();assert(cs);
+    const int spaceDim = cs->getSpaceDim();
+    const size_t numStations = _stationNames.size();
+    assert(_stationCoords.size() == numStations*spaceDim);
+
+    // Locate the cell containing each station.
+    DMInterpolationInfo interpolator = NULL;
+    err = DMInterpolationCreate(comm, &interpolator);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDim(interpolator, spaceDim);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationAddPoints(interpolator, numStations, (PetscReal*) &_stationCoords[0]);PYLITH_CHECK_ERROR(err);
+    const PetscBool pointsAllProcs = PETSC_TRUE;
+    const PetscBool ignoreOutsideDomain = PETSC_FALSE;
+    err = DMInterpolationSetUp(interpolator, dmSoln, pointsAllProcs, ignoreOutsideDomain);PYLITH_CHECK_ERROR(err);
+
+    const pylith::topology::Field::SubfieldInfo& dispInfo = solution->getSubfieldInfo("displacement");
+    PetscObject obj = NULL;
+    err = DMGetField(dmSoln, dispInfo.index, NULL, &obj);PYLITH_CHECK_ERROR(err);
+    PetscFE fe = (PetscFE) obj;
+    PetscInt numBasis = 0;
+    PetscInt numComponents = 0;
+    err = PetscFEGetDimension(fe, &numBasis);PYLITH_CHECK_ERROR(err);
+    err = PetscFEGetNumComponents(fe, &numComponents);PYLITH_CHECK_ERROR(err);
+    sampler->numBasis = numBasis;
+    sampler->numComponents = numComponents;
+
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dmSoln, &section);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt numStationsLocal = interpolator->n;
+    sampler->stationIndices.resize(numStationsLocal);
+    sampler->dofs.resize(numStationsLocal);
+    sampler->basis.resize(numStationsLocal);
+
+    const PetscScalar* stationCoordsLocal = NULL;
+    err = VecGetArrayRead(interpolator->coords, &stationCoordsLocal);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iStationLocal = 0; iStationLocal < numStationsLocal; ++iStationLocal) {
+        // Find station in array of all stations to get its row block in the operator.
+        sampler->stationIndices[iStationLocal] = -1;
+        for (size_t iStation = 0; iStation < numStations; ++iStation) {
+            const PylithReal tolerance = 1.0e-6;
+            PylithReal dist = 0.0;
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                dist += pow(_stationCoords[iStation*spaceDim+iDim] - PetscRealPart(stationCoordsLocal[iStationLocal*spaceDim+iDim]), 2);
+            } // for
+            if (sqrt(dist) < tolerance) {
+                sampler->stationIndices[iStationLocal] = iStation;
+                break;
+            } // if
+        } // for
+        assert(sampler->stationIndices[iStationLocal] >= 0);
+
+        const PetscInt cell = interpolator->cells[iStationLocal];
+        PetscReal coordsReal[3];
+        PetscReal coordsRef[3];
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            coordsReal[iDim] = PetscRealPart(stationCoordsLocal[iStationLocal*spaceDim+iDim]);
+        } // for
+        err = DMPlexCoordinatesToReference(dmSoln, cell, 1, coordsReal, coordsRef);PYLITH_CHECK_ERROR(err);
+
+        PetscInt numIndices = 0;
+        PetscInt* indices = NULL;
+        PetscInt* fieldOffsets = NULL;
+        err = DMPlexGetClosureIndices(dmSoln, section, section, cell, PETSC_TRUE, &numIndices, &indices, &fieldOffsets,
+                                      NULL);PYLITH_CHECK_ERROR(err);
+
+        PetscTabulation tabulation = NULL;
+        err = PetscFECreateTabulation(fe, 1, 1, coordsRef, 0, &tabulation);PYLITH_CHECK_ERROR(err);
+        const PetscReal* basis = tabulation->T[0];assert(basis);
+
+        sampler->dofs[iStationLocal].resize(numBasis);
+        sampler->basis[iStationLocal].resize(numBasis*numComponents);
+        for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+            sampler->dofs[iStationLocal][iBasis] = indices[fieldOffsets[dispInfo.index]+iBasis];
+            for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                sampler->basis[iStationLocal][iBasis*numComponents+iComponent] = basis[iBasis*numComponents+iComponent];
+            } // for
+        } // for
+        err = PetscTabulationDestroy(&tabulation);PYLITH_CHECK_ERROR(err);
+
+        err = DMPlexRestoreClosureIndices(dmSoln, section, section, cell, PETSC_TRUE, &numIndices, &indices,
+                                          &fieldOffsets, NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArrayRead(interpolator->coords, &stationCoordsLocal);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationDestroy(&interpolator);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _tabulateStations
+
+
+// ------------------------------------------------------------------------------------------------
+// Create the distributed dense station operator filled from forward impulse responses.
+void
+pylith::problems::GreensFns::_createStationOperator(const size_t numImpulsesGlobal) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createStationOperator(numImpulsesGlobal="<<numImpulsesGlobal<<")");
+
+    assert(!_stationSampler);
+    assert(!_stationOperator);
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    _stationSampler = new StationSampler;assert(_stationSampler);
+    _tabulateStations(_stationSampler);
+
+    MPI_Comm comm = PetscObjectComm((PetscObject)solution->getDM());
+    const size_t numRows = _stationNames.size() * _stationSampler->numComponents;
+    PetscErrorCode err = MatCreateDense(comm, PETSC_DECIDE, PETSC_DECIDE, numRows, numImpulsesGlobal, NULL,
+                                        &_stationOperator);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _createStationOperator
+
+
+// ------------------------------------------------------------------------------------------------
+// Sample the current response at the stations and insert the values into the operator column.
+void
+pylith::problems::GreensFns::_sampleStationResponse(const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_sampleStationResponse(impulse="<<impulse<<")");
+
+    assert(_stationSampler);
+    assert(_stationOperator);
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    PetscErrorCode err;
+    const PylithInt numBasis = _stationSampler->numBasis;
+    const PylithInt numComponents = _stationSampler->numComponents;
+    const size_t numStationsLocal = _stationSampler->stationIndices.size();
+
+    const PetscScalar* solutionArray = NULL;
+    err = VecGetArrayRead(solution->getLocalVector(), &solutionArray);PYLITH_CHECK_ERROR(err);
+    for (size_t iStationLocal = 0; iStationLocal < numStationsLocal; ++iStationLocal) {
+        const PylithInt iStation = _stationSampler->stationIndices[iStationLocal];
+        const int_array& dofs = _stationSampler->dofs[iStationLocal];
+        const scalar_array& basis = _stationSampler->basis[iStationLocal];
+        for (PylithInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+            PetscScalar value = 0.0;
+            for (PylithInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                // Constrained dofs are encoded as -(index+1); the local vector stores their
+                // prescribed values, so include them when interpolating.
+                const PylithInt dof = (dofs[iBasis] >= 0) ? dofs[iBasis] : -(dofs[iBasis]+1);
+                value += basis[iBasis*numComponents+iComponent] * solutionArray[dof];
+            } // for
+            const PetscInt row = iStation*numComponents + iComponent;
+            err = MatSetValue(_stationOperator, row, impulse, value, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(solution->getLocalVector(), &solutionArray);PYLITH_CHECK_ERROR(err);
+
+    // Flush after each column so off-process station rows do not accumulate in the stash.
+    err = MatAssemblyBegin(_stationOperator, MAT_FLUSH_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_stationOperator, MAT_FLUSH_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _sampleStationResponse
+
+
+// ------------------------------------------------------------------------------------------------
+// Finish assembly of the station operator and write it to the HDF5 file.
+void
+pylith::problems::GreensFns::_writeStationOperator(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_writeStationOperator()");
+
+    assert(_stationOperator);
+    assert(!_operatorFilename.empty());
+
+    PetscErrorCode err;
+    err = MatAssemblyBegin(_stationOperator, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_stationOperator, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    MPI_Comm comm = PetscObjectComm((PetscObject)_stationOperator);
+    PetscViewer viewer = NULL;
+    err = PetscObjectSetName((PetscObject)_stationOperator, "greens_fns");PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5Open(comm, _operatorFilename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = MatView(_stationOperator, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    err = MatDestroy(&_stationOperator);PYLITH_CHECK_ERROR(err);
+    delete _stationSampler;_stationSampler = NULL;
+
+    PYLITH_METHOD_END;
+} // _writeStationOperator
+
+
 // ------------------------------------------------------------------------------------------------
 // Perform operations after advancing solution of one impulse.
 void
@@ -377,6 +933,11 @@ pylith::problems::GreensFns::poststep(const size_t impulse,
     assert(_observers);
     _observers->notifyObservers(t, impulse, *solution);
 
+    // Assemble the station responses directly into the operator column for this impulse.
+    if (_stationOperator) {
+        _sampleStationResponse(impulse);
+    } // if
+
     // Update number of impulses for monitor
     if (_monitor) {
         assert(_normalizer);
@@ -29,6 +29,7 @@
 #include "pylith/testing/testingfwd.hh" // USES MMSTest
 #include "pylith/faults/faultsfwd.hh" // HOLDSA FaultCohesiveImpulses
 #include "pylith/feassemble/feassemblefwd.hh" // HOLDSA Integrator
+#include "pylith/utils/array.hh" // HASA scalar_array, string_vector
 
 class pylith::problems::GreensFns : public pylith::problems::Problem {
     friend class TestGreensFns; // unit testing
@@ -70,6 +71,62 @@ public:
      */
     int getFaultLabelValue(void) const;
 
+    /** Set number of impulses solved together as multiple right-hand sides.
+     *
+     * Impulses in a batch share one Jacobian factorization and one KSP solve
+     * (1 solves impulses one at a time).
+     *
+     * @param[in] value Number of impulses per batch (>= 1).
+     */
+    void setImpulseBatchSize(const size_t value);
+
+    /** Get number of impulses solved together as multiple right-hand sides.
+     *
+     * @returns Number of impulses per batch.
+     */
+    size_t getImpulseBatchSize(void) const;
+
+    /** Set station locations for computing the fault-to-station operator by reciprocity.
+     *
+     * When stations are given, solve() computes one adjoint response per station
+     * component instead of one forward response per fault impulse. The adjoint
+     * responses combined with the assembled impulse right-hand sides yield the
+     * station rows of the Green's functions operator, which is what inversions
+     * use; full-domain responses are not computed in this mode.
+     *
+     * @param[in] stationCoords Array of station coordinates [numStations * spaceDim].
+     * @param[in] numStations Number of stations.
+     * @param[in] spaceDim Spatial dimension for station coordinates.
+     * @param[in] stationNames Array with station names.
+     * @param[in] numStationNames Number of station names.
+     */
+    void setStations(const PylithReal* stationCoords,
+                     const int numStations,
+                     const int spaceDim,
+                     const char* const* stationNames,
+                     const int numStationNames);
+
+    /** Set filename for fault-to-station operator computed by reciprocity.
+     *
+     * @param[in] filename Name of HDF5 file for operator.
+     */
+    void setReciprocityFilename(const char* filename);
+
+    /** Set filename for fault-to-station operator assembled from forward responses.
+     *
+     * When stations and this filename are given, each forward impulse response is
+     * sampled at the stations as it is computed and inserted directly into a dense
+     * operator distributed by station rows, which is written as a single HDF5
+     * dataset; no gather/transpose post-processing of per-impulse output fields is
+     * needed. The operator layout matches the reciprocity mode (station index
+     * varies slowest, displacement component fastest; columns follow the global
+     * impulse order). Unlike reciprocity, this mode solves one forward problem per
+     * impulse and keeps the full-domain responses available to observers.
+     *
+     * @param[in] filename Name of HDF5 file for operator.
+     */
+    void setOperatorFilename(const char* filename);
+
     /** Set progress monitor.
      *
      * @param[in] monitor Progress monitor for Green's functions simulation.
@@ -152,13 +209,99 @@ public:
                                    PetscMat precondMat,
                                    void* context);
 
+    // PRIVATE STRUCTS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Displacement interpolation data for the stations located on this process.
+    struct StationSampler {
+        int_array stationIndices; ///< Index of each local station in the station array.
+        std::vector<int_array> dofs; ///< Closure indices of displacement dofs at each local station.
+        std::vector<scalar_array> basis; ///< Displacement basis values at each local station.
+        PylithInt numBasis; ///< Number of displacement basis functions per cell.
+        PylithInt numComponents; ///< Number of displacement components.
+    }; // StationSampler
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Solve a batch of impulses as multiple right-hand sides, reusing the Jacobian factorization.
+     *
+     * The Newton right-hand sides for all impulses in the batch are assembled at a shared base
+     * solution and solved in one KSPMatSolve(); the responses are then scattered and output one
+     * at a time. The Newton correction from any base solution yields the solution of the linear
+     * quasistatic system, so the batched responses match the impulse-at-a-time responses.
+     *
+     * @param[in] impulseStart Global index of first impulse in batch.
+     * @param[in] batchSize Number of impulses in batch.
+     * @param[in] impulseProcs Rank owning each global impulse.
+     * @param[in] impulseLocalIndices Rank-local index of each global impulse.
+     * @param[in] numImpulsesGlobal Total number of impulses.
+     */
+    void _solveImpulseBatch(const size_t impulseStart,
+                            const size_t batchSize,
+                            const int_array& impulseProcs,
+                            const int_array& impulseLocalIndices,
+                            const size_t numImpulsesGlobal);
+
+    /** Compute the fault-to-station operator by reciprocity.
+     *
+     * Solves one adjoint problem per station displacement component, with the
+     * station point load as the right-hand side and the transpose of the
+     * quasistatic Jacobian as the operator. By reciprocity, the inner product
+     * of an adjoint response with the assembled right-hand side of impulse k
+     * equals the station response to impulse k, so each impulse costs one
+     * residual assembly instead of one solve. The operator rows follow the
+     * station order given to setStations() (station index varies slowest,
+     * displacement component fastest); columns follow the global impulse order.
+     *
+     * All adjoint responses are held in memory, so this mode assumes the
+     * number of station components is small compared with the number of
+     * impulses.
+     *
+     * @param[in] impulseProcs Rank owning each global impulse.
+     * @param[in] impulseLocalIndices Rank-local index of each global impulse.
+     * @param[in] numImpulsesGlobal Total number of impulses.
+     */
+    void _solveReciprocity(const int_array& impulseProcs,
+                           const int_array& impulseLocalIndices,
+                           const size_t numImpulsesGlobal);
+
+    /** Locate the cell containing each station and tabulate the displacement basis there.
+     *
+     * @param[out] sampler Station interpolation data for the stations on this process.
+     */
+    void _tabulateStations(StationSampler* sampler) const;
+
+    /** Create the distributed dense station operator filled from forward impulse responses.
+     *
+     * @param[in] numImpulsesGlobal Total number of impulses.
+     */
+    void _createStationOperator(const size_t numImpulsesGlobal);
+
+    /** Sample the current response at the stations and insert the values into the operator
+     * column for an impulse.
+     *
+     * @param[in] impulse Index of current impulse.
+     */
+    void _sampleStationResponse(const size_t impulse);
+
+    /// Finish assembly of the station operator and write it to the HDF5 file.
+    void _writeStationOperator(void);
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
     std::string _faultLabelName; ///< Name of label for fault with impulses.
+    pylith::scalar_array _stationCoords; ///< Array of station coordinates for reciprocity mode.
+    pylith::string_vector _stationNames; ///< Array of station names for reciprocity mode.
+    std::string _reciprocityFilename; ///< Name of HDF5 file for fault-to-station operator.
+    std::string _operatorFilename; ///< Name of HDF5 file for operator assembled from forward responses.
     PylithInt _faultLabelValue; ///< Value of label for fault with impulses.
+    size_t _impulseBatchSize; ///< Number of impulses solved together as multiple right-hand sides.
     pylith::faults::FaultCohesiveImpulses* _faultImpulses; ///< Fault interface with Green's functions impulses.
     pylith::feassemble::Integrator* _integratorImpulses; ///< Integrator for Green's functions impulses.
+    StationSampler* _stationSampler; ///< Station interpolation data for direct operator assembly.
+    PetscMat _stationOperator; ///< Distributed dense operator assembled from forward responses.
 
     PetscSNES _snes; ///< PETSc SNES solver.
     pylith::problems::ProgressMonitorStep* _monitor; ///< Monitor for simulation progress.
@@ -0,0 +1,188 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "InitialConditionCheckpoint.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldDB.hh" // USES FieldDB
+#include "pylith/topology/FieldQuery.hh" // USES FieldQuery
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::problems::InitialConditionCheckpoint::InitialConditionCheckpoint(void) :
+    _filename(""),
+    _mesh(NULL) {
+    PyreComponent::setName("initialconditioncheckpoint");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::InitialConditionCheckpoint::~InitialConditionCheckpoint(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::InitialConditionCheckpoint::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _mesh = NULL; // :KLLUDGE: Should use shared pointer.
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set filename of HDF5 checkpoint file with solution.
+void
+pylith::problems::InitialConditionCheckpoint::setCheckpointFilename(const char* filename) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setCheckpointFilename(filename="<<filename<<")");
+
+    _filename = filename;
+
+    PYLITH_METHOD_END;
+} // setCheckpointFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set mesh of checkpointed simulation.
+void
+pylith::problems::InitialConditionCheckpoint::setMesh(pylith::topology::Mesh* mesh) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setMesh(mesh="<<mesh<<")");
+
+    _mesh = mesh;
+
+    PYLITH_METHOD_END;
+} // setMesh
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::problems::InitialConditionCheckpoint::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    InitialCondition::verifyConfiguration(solution);
+
+    if (_filename.empty()) {
+        std::ostringstream msg;
+        msg << "No checkpoint filename given for initial conditions in component '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!_mesh) {
+        std::ostringstream msg;
+        msg << "No mesh of the checkpointed simulation given for initial conditions in component '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set solution to values for initial condition.
+void
+pylith::problems::InitialConditionCheckpoint::setValues(pylith::topology::Field* solution,
+                                                        const spatialdata::units::Nondimensional& normalizer) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setValues(solution="<<solution<<", normalizer)");
+
+    assert(solution);
+    assert(_mesh);
+
+    // Create field on the checkpoint mesh with the layout of the solution, so the checkpoint
+    // solution vector can be loaded onto it. The ordering of the loaded vector matches the
+    // checkpointed simulation only if the checkpoint mesh is imported the same way.
+    pylith::topology::Field checkpointSoln(*_mesh);
+    const pylith::string_vector& subfieldNames = solution->getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = solution->getSubfieldInfo(subfieldNames[i].c_str());
+        if (info.fe.isFaultOnly) { continue; }
+        checkpointSoln.subfieldAdd(info.description, info.fe);
+    } // for
+    checkpointSoln.subfieldsSetup();
+    checkpointSoln.createDiscretization();
+    checkpointSoln.setLabel(solution->getLabel());
+    checkpointSoln.allocate();
+
+    PYLITH_COMPONENT_INFO_ROOT("Setting initial conditions from checkpoint '"<<_filename<<"'.");
+
+    PetscErrorCode err = 0;
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(_mesh->getComm(), _filename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    checkpointSoln.createGlobalVector();
+    PetscVec solutionVector = checkpointSoln.getGlobalVector();assert(solutionVector);
+    err = PetscObjectSetName((PetscObject)solutionVector, "solution");PYLITH_CHECK_ERROR(err);
+    err = VecLoad(solutionVector, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    checkpointSoln.scatterVectorToLocal(solutionVector);
+
+    // Query the checkpoint solution at the locations of the solution degrees of freedom,
+    // interpolating within the cells of the checkpoint mesh.
+    pylith::topology::FieldDB fieldDB;
+    fieldDB.setField(&checkpointSoln);
+    const std::string description = std::string("solution checkpoint '") + _filename + "'";
+    fieldDB.setDescription(description.c_str());
+
+    pylith::topology::FieldQuery fieldQuery(*solution);
+    const size_t numICSubfields = _subfields.size();
+    for (size_t i = 0; i < numICSubfields; ++i) {
+        const char** queryValues = NULL;
+        const size_t numValues = 0;
+        const pylith::topology::FieldQuery::convertfn_type convertFn = NULL;
+        fieldQuery.setQuery(_subfields[i].c_str(), queryValues, numValues, convertFn, &fieldDB);
+    } // for
+
+    fieldQuery.openDB(&fieldDB, normalizer.getLengthScale());
+    fieldQuery.queryDB();
+    fieldQuery.closeDB(&fieldDB);
+
+    pythia::journal::debug_t debug(PyreComponent::getName());
+    if (debug.state()) {
+        PYLITH_COMPONENT_DEBUG("Displaying solution field");
+        solution->view("Solution field with initial values", pylith::topology::Field::VIEW_ALL);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setValues
+
+
+// End of file
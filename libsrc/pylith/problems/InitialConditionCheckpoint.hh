@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/InitialConditionCheckpoint.hh
+ *
+ * @brief C++ object for specifying initial conditions from a checkpoint of another simulation,
+ * interpolating the checkpoint solution between meshes.
+ *
+ * Warm starts a simulation from the converged state of a simulation on a different (e.g.,
+ * coarser) mesh. The checkpoint solution is loaded onto the mesh of the checkpointed
+ * simulation and interpolated to the locations of the solution degrees of freedom. The
+ * checkpoint mesh must be imported with the same number of processes and the same mesh
+ * importer settings as in the checkpointed simulation, so the ordering of the checkpoint
+ * solution vector matches; the checkpointed simulation must not include faults.
+ */
+#if !defined(pylith_problems_initialconditioncheckpoint_hh)
+#define pylith_problems_initialconditioncheckpoint_hh
+
+#include "InitialCondition.hh" // ISA InitialCondition
+
+#include <string> // HASA std::string
+
+class pylith::problems::InitialConditionCheckpoint : public pylith::problems::InitialCondition {
+    friend class TestInitialConditionCheckpoint; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    InitialConditionCheckpoint(void);
+
+    /// Destructor
+    virtual ~InitialConditionCheckpoint(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename of HDF5 checkpoint file with solution.
+     *
+     * @param[in] filename Name of HDF5 checkpoint file.
+     */
+    void setCheckpointFilename(const char* filename);
+
+    /** Set mesh of checkpointed simulation.
+     *
+     * @param[in] mesh Mesh of checkpointed simulation.
+     */
+    void setMesh(pylith::topology::Mesh* mesh);
+
+    /** Verify configuration is acceptable.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Set solution to values for initial condition.
+     *
+     * @param[out] solution Solution field.
+     * @param[in] normalizer Nondimensionalization.
+     */
+    void setValues(pylith::topology::Field* solution,
+                   const spatialdata::units::Nondimensional& normalizer);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of HDF5 checkpoint file with solution.
+    pylith::topology::Mesh* _mesh; ///< Mesh of checkpointed simulation.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    InitialConditionCheckpoint(const InitialConditionCheckpoint&); ///< Not implemented
+    const InitialConditionCheckpoint& operator=(const InitialConditionCheckpoint&); ///< Not implemented
+
+}; // InitialConditionCheckpoint
+
+#endif // pylith_problems_initialconditioncheckpoint_hh
+
+// End of file
@@ -23,6 +23,7 @@
 #include "pylith/topology/FieldQuery.hh" // USES FieldQuery
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::getStratumIS()
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -181,4 +182,66 @@ pylith::problems::InitialConditionPatch::setValues(pylith::topology::Field* solu
 } // setValues
 
 
+// ------------------------------------------------------------------------------------------------
+// Set solution values for a sequence of patch initial conditions with one composed traversal.
+void
+pylith::problems::InitialConditionPatch::setValuesComposite(const std::vector<InitialConditionPatch*>& patches,
+                                                            pylith::topology::Field* solution,
+                                                            const spatialdata::units::Nondimensional& normalizer) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(solution);
+    const size_t numPatches = patches.size();
+    if (0 == numPatches) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Mark each point with the index of the last patch covering it, so overlapping patches query
+    // each point exactly once against the database that wins under sequential application.
+    const char* const ownerLabelName = "pylith-ic-patch-owner";
+    PetscDM dmSoln = solution->getDM();
+    PetscErrorCode err = DMCreateLabel(dmSoln, ownerLabelName);PYLITH_CHECK_ERROR(err);
+    PetscDMLabel ownerLabel = NULL;
+    err = DMGetLabel(dmSoln, ownerLabelName, &ownerLabel);PYLITH_CHECK_ERROR(err);assert(ownerLabel);
+    for (size_t iPatch = 0; iPatch < numPatches; ++iPatch) {
+        assert(patches[iPatch]);
+        PetscIS pointsIS = pylith::topology::MeshOps::getStratumIS(dmSoln, patches[iPatch]->_labelName.c_str(),
+                                                                   patches[iPatch]->_labelValue);
+        if (!pointsIS) { continue; }
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            err = DMLabelSetValue(ownerLabel, points[iPoint], (PetscInt)iPatch);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Apply patches in order over the points each one owns; later patches still overwrite
+    // earlier ones on shared cell closures at patch boundaries.
+    for (size_t iPatch = 0; iPatch < numPatches; ++iPatch) {
+        InitialConditionPatch* patch = patches[iPatch];
+
+        pylith::topology::FieldQuery fieldQuery(*solution);
+        const size_t numSubfields = patch->_subfields.size();
+        for (size_t i = 0; i < numSubfields; ++i) {
+            const char** queryValues = NULL;
+            const size_t numValues = 0;
+            const pylith::topology::FieldQuery::convertfn_type convertFn = NULL;
+            fieldQuery.setQuery(patch->_subfields[i].c_str(), queryValues, numValues, convertFn, patch->_db);
+        } // for
+
+        fieldQuery.openDB(patch->_db, normalizer.getLengthScale());
+        fieldQuery.queryDBLabel(ownerLabelName, (PylithInt)iPatch);
+        fieldQuery.closeDB(patch->_db);
+    } // for
+
+    err = DMRemoveLabel(dmSoln, ownerLabelName, NULL);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setValuesComposite
+
+
 // End of file
@@ -28,6 +28,8 @@
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA SpatialDB
 
+#include <vector> // USES std::vector
+
 class pylith::problems::InitialConditionPatch : public pylith::problems::InitialCondition {
     friend class TestInitialConditionPatch; // unit testing
 
@@ -87,6 +89,21 @@ public:
     void setValues(pylith::topology::Field* solution,
                    const spatialdata::units::Nondimensional& normalizer);
 
+    /** Set solution values for a sequence of patch initial conditions with one composed traversal.
+     *
+     * Marks each point with the last patch covering it and queries each patch's spatial database
+     * only over the points it owns, so overlapping patches query each point exactly once while
+     * preserving the last-patch-wins semantics of sequential application.
+     *
+     * @param[in] patches Patch initial conditions in application order.
+     * @param[out] solution Solution field.
+     * @param[in] normalizer Nondimensionalization.
+     */
+    static
+    void setValuesComposite(const std::vector<InitialConditionPatch*>& patches,
+                            pylith::topology::Field* solution,
+                            const spatialdata::units::Nondimensional& normalizer);
+
     // PRIVATE MEMEBRS
     // //////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -55,4 +55,20 @@ pylith::problems::ObserverPhysics::setPhysicsImplementation(const pylith::feasse
 } // setPhysicsImplemetation
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer would consume a data update at time t.
+bool
+pylith::problems::ObserverPhysics::expectsDataOutput(const PylithReal t,
+                                                     const PylithInt tindex) const {
+    return true;
+} // expectsDataOutput
+
+
+// ------------------------------------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation.
+void
+pylith::problems::ObserverPhysics::setExpectedTimeSteps(const size_t numTimeSteps,
+                                                        const PylithReal duration) {}
+
+
 // End of file
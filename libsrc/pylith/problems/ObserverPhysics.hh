@@ -83,6 +83,31 @@ public:
                 const pylith::topology::Field& solution,
                 const bool infoOnly) = 0;
 
+    /** Check whether observer would consume a data update at time t.
+     *
+     * Used to skip computing fields consumed only by observers (e.g., derived fields) when no
+     * observer will use them. The default implementation conservatively returns true.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if observer would consume a data update at time t, false otherwise.
+     */
+    virtual
+    bool expectsDataOutput(const PylithReal t,
+                           const PylithInt tindex) const;
+
+    /** Set expected number of time steps and duration of the simulation.
+     *
+     * Hint for preallocating output resources (e.g., time-series dataset extents). The default
+     * implementation ignores the hint.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    virtual
+    void setExpectedTimeSteps(const size_t numTimeSteps,
+                              const PylithReal duration);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
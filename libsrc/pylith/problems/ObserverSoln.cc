@@ -39,4 +39,20 @@ void
 pylith::problems::ObserverSoln::deallocate(void) {}
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer would consume a data update at time t.
+bool
+pylith::problems::ObserverSoln::expectsDataOutput(const PylithReal t,
+                                                  const PylithInt tindex) const {
+    return true;
+} // expectsDataOutput
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation.
+void
+pylith::problems::ObserverSoln::setExpectedTimeSteps(const size_t numTimeSteps,
+                                                     const PylithReal duration) {}
+
+
 // End of file
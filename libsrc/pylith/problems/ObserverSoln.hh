@@ -73,6 +73,31 @@ public:
                 const PylithInt tindex,
                 const pylith::topology::Field& solution) = 0;
 
+    /** Check whether observer would consume a data update at time t.
+     *
+     * Used to skip shared preprocessing (e.g., scattering the solution to its output view) when no
+     * observer will use it. The default implementation conservatively returns true.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if observer would consume a data update at time t, false otherwise.
+     */
+    virtual
+    bool expectsDataOutput(const PylithReal t,
+                           const PylithInt tindex) const;
+
+    /** Set expected number of time steps and duration of the simulation.
+     *
+     * Hint for preallocating output resources (e.g., time-series dataset extents). The default
+     * implementation ignores the hint.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    virtual
+    void setExpectedTimeSteps(const size_t numTimeSteps,
+                              const PylithReal duration);
+
     // PRIVATE ////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,177 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "ObserverSolnAnalysis.hh" // implementation of class methods
+
+#include "pylith/problems/SolnAnalyzer.hh" // USES SolnAnalyzer
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::problems::ObserverSolnAnalysis::ObserverSolnAnalysis(void) :
+    _logger(NULL),
+    _timeScale(1.0) {
+    PyreComponent::setName("observersolnanalysis");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::ObserverSolnAnalysis::~ObserverSolnAnalysis(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::ObserverSolnAnalysis::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _hooks.clear(); // Analyzers are borrowed references.
+    delete _logger;_logger = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Register analyzer to receive solution updates.
+void
+pylith::problems::ObserverSolnAnalysis::registerAnalyzer(pylith::problems::SolnAnalyzer* const analyzer,
+                                                         const char* name,
+                                                         const PylithReal budget) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("registerAnalyzer(analyzer="<<analyzer<<", name="<<name<<", budget="<<budget<<")");
+
+    if (!analyzer) {
+        std::ostringstream msg;
+        msg << "NULL analyzer '" << name << "' registered with solution analysis observer '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    if (!_logger) {
+        _logger = new pylith::utils::EventLogger;assert(_logger);
+        _logger->setClassName("ObserverSolnAnalysis");
+        _logger->initialize();
+    } // if
+
+    AnalysisHook hook;
+    hook.analyzer = analyzer;
+    hook.name = name;
+    hook.eventName = std::string("Py-Anlz-") + name;
+    hook.eventId = _logger->registerEvent(hook.eventName.c_str());
+    hook.budget = budget;
+    hook.active = true;
+    _hooks.push_back(hook);
+
+    PYLITH_METHOD_END;
+} // registerAnalyzer
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set time scale.
+void
+pylith::problems::ObserverSolnAnalysis::setTimeScale(const PylithReal value) {
+    _timeScale = value;
+} // setTimeScale
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify observer is compatible with solution.
+void
+pylith::problems::ObserverSolnAnalysis::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    const size_t numHooks = _hooks.size();
+    for (size_t i = 0; i < numHooks; ++i) {
+        assert(_hooks[i].analyzer);
+        _hooks[i].analyzer->verifyConfiguration(solution);
+    } // for
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Receive update (subject of observer).
+void
+pylith::problems::ObserverSolnAnalysis::update(const PylithReal t,
+                                               const PylithInt tindex,
+                                               const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("update(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    const size_t numHooks = _hooks.size();
+    for (size_t i = 0; i < numHooks; ++i) {
+        AnalysisHook& hook = _hooks[i];
+        if (!hook.active) { continue; }
+        assert(hook.analyzer);
+        assert(_logger);
+
+        _logger->eventBegin(hook.eventId);
+        hook.analyzer->analyze(t, tindex, solution);
+        _logger->eventEnd(hook.eventId);
+
+        if (hook.budget > 0.0) {
+            // Analyzers may perform collective operations, so the decision to deactivate must be
+            // the same on all processes; use the maximum accumulated time over the processes.
+            const double elapsedLocal = pylith::utils::EventLogger::getAccumulatedTime(hook.eventName.c_str());
+            double elapsed = elapsedLocal;
+            PetscErrorCode err = MPI_Allreduce(&elapsedLocal, &elapsed, 1, MPI_DOUBLE, MPI_MAX,
+                                               solution.getMesh().getComm());PYLITH_CHECK_ERROR(err);
+            if (elapsed > hook.budget) {
+                hook.active = false;
+                PYLITH_COMPONENT_WARNING("Deactivating solution analyzer '"<<hook.name<<"' at t="
+                                                                           <<t*_timeScale<<" (time step "<<tindex<<"); accumulated time "
+                                                                           <<elapsed<<" s exceeds budget of "<<hook.budget<<" s.");
+            } // if
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer would consume a data update at time t.
+bool
+pylith::problems::ObserverSolnAnalysis::expectsDataOutput(const PylithReal t,
+                                                          const PylithInt tindex) const {
+    const size_t numHooks = _hooks.size();
+    for (size_t i = 0; i < numHooks; ++i) {
+        if (_hooks[i].active) { return true; }
+    } // for
+    return false;
+} // expectsDataOutput
+
+
+// End of file
@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/ObserverSolnAnalysis.hh
+ *
+ * @brief Observer of the solution that runs registered in-situ analyzers with a bounded cost.
+ *
+ * Each analyzer (SolnAnalyzer) gets read-only access to the solution at every solution update
+ * and may be given a wall-clock time budget for the run. The time spent in each analyzer is
+ * tracked with PETSc logging events (visible in -log_view output); an analyzer that exhausts
+ * its budget is deactivated with a warning, so an expensive analysis cannot dominate the cost
+ * of the simulation it is observing.
+ */
+
+#if !defined(pylith_problems_observersolnanalysis_hh)
+#define pylith_problems_observersolnanalysis_hh
+
+#include "ObserverSoln.hh" // ISA ObserverSoln
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::problems::ObserverSolnAnalysis : public pylith::problems::ObserverSoln, public pylith::utils::PyreComponent {
+    friend class TestObserverSolnAnalysis; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    ObserverSolnAnalysis(void);
+
+    /// Destructor
+    virtual ~ObserverSolnAnalysis(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Register analyzer to receive solution updates.
+     *
+     * The analyzer must remain valid for the lifetime of the observer; the observer does not
+     * take ownership.
+     *
+     * @param[in] analyzer Analyzer to receive solution updates.
+     * @param[in] name Name of analyzer (used in logging events and warnings).
+     * @param[in] budget Wall-clock time budget for the run in seconds (nonpositive value means no budget).
+     */
+    void registerAnalyzer(pylith::problems::SolnAnalyzer* const analyzer,
+                          const char* name,
+                          const PylithReal budget);
+
+    /** Set time scale.
+     *
+     * @param[in] value Time scale for dimensionalizing time.
+     */
+    void setTimeScale(const PylithReal value);
+
+    /** Verify observer is compatible with solution.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Receive update (subject of observer).
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void update(const PylithReal t,
+                const PylithInt tindex,
+                const pylith::topology::Field& solution);
+
+    /** Check whether observer would consume a data update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if any analyzer is still active, false otherwise.
+     */
+    bool expectsDataOutput(const PylithReal t,
+                           const PylithInt tindex) const;
+
+    // PRIVATE STRUCTS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Registered analyzer with its time budget.
+    struct AnalysisHook {
+        pylith::problems::SolnAnalyzer* analyzer; ///< Analyzer; borrowed reference.
+        std::string name; ///< Name of analyzer.
+        std::string eventName; ///< Name of logging event timing the analyzer.
+        int eventId; ///< Id of logging event timing the analyzer.
+        PylithReal budget; ///< Wall-clock time budget (seconds); nonpositive means no budget.
+        bool active; ///< False once the analyzer has exhausted its budget.
+    }; // AnalysisHook
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::vector<AnalysisHook> _hooks; ///< Registered analyzers.
+    pylith::utils::EventLogger* _logger; ///< Logging events timing the analyzers.
+    PylithReal _timeScale; ///< Time scale for dimensionalizing time in warnings.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    ObserverSolnAnalysis(const ObserverSolnAnalysis&); ///< Not implemented.
+    const ObserverSolnAnalysis& operator=(const ObserverSolnAnalysis&); ///< Not implemented
+
+}; // ObserverSolnAnalysis
+
+#endif // pylith_problems_observersolnanalysis_hh
+
+// End of file
@@ -121,6 +121,23 @@ pylith::problems::ObserversPhysics::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ------------------------------------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation in observers.
+void
+pylith::problems::ObserversPhysics::setExpectedTimeSteps(const size_t numTimeSteps,
+                                                         const PylithReal duration) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setExpectedTimeSteps(numTimeSteps="<<numTimeSteps<<", duration="<<duration<<")");
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->setExpectedTimeSteps(numTimeSteps, duration);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setExpectedTimeSteps
+
+
 // ------------------------------------------------------------------------------------------------
 // Verify observers.
 void
@@ -156,4 +173,24 @@ pylith::problems::ObserversPhysics::notifyObservers(const PylithReal t,
 } // notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer would consume a data update at time t.
+bool
+pylith::problems::ObserversPhysics::expectsDataOutput(const PylithReal t,
+                                                      const PylithInt tindex) const {
+    PYLITH_METHOD_BEGIN;
+
+    bool expectsData = false;
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        if ((*iter)->expectsDataOutput(t, tindex)) {
+            expectsData = true;
+            break;
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(expectsData);
+} // expectsDataOutput
+
+
 // End of file
@@ -82,6 +82,14 @@ public:
      */
     void setTimeScale(const PylithReal value);
 
+    /** Set expected number of time steps and duration of the simulation in observers.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    void setExpectedTimeSteps(const size_t numTimeSteps,
+                              const PylithReal duration);
+
     /** Verify observers are compatible.
      *
      * @param[in] solution Solution field.
@@ -100,6 +108,15 @@ public:
                          const pylith::topology::Field& solution,
                          const bool infoOnly);
 
+    /** Check whether any observer would consume a data update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if at least one observer would consume a data update at time t, false otherwise.
+     */
+    bool expectsDataOutput(const PylithReal t,
+                           const PylithInt tindex) const;
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -81,6 +81,14 @@ pylith::problems::ObserversSoln::removeObserver(pylith::problems::ObserverSoln*
 } // removeObserver
 
 
+// ----------------------------------------------------------------------
+// Get number of registered observers.
+size_t
+pylith::problems::ObserversSoln::size(void) const {
+    return _observers.size();
+} // size
+
+
 // ----------------------------------------------------------------------
 // Set time scale in observers.
 void
@@ -97,6 +105,23 @@ pylith::problems::ObserversSoln::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ----------------------------------------------------------------------
+// Set expected number of time steps and duration of the simulation in observers.
+void
+pylith::problems::ObserversSoln::setExpectedTimeSteps(const size_t numTimeSteps,
+                                                      const PylithReal duration) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setExpectedTimeSteps(numTimeSteps="<<numTimeSteps<<", duration="<<duration<<")");
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->setExpectedTimeSteps(numTimeSteps, duration);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setExpectedTimeSteps
+
+
 // ----------------------------------------------------------------------
 // Verify observers.
 void
@@ -131,6 +156,26 @@ pylith::problems::ObserversSoln::notifyObservers(const PylithReal t,
 } // notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer would consume a data update at time t.
+bool
+pylith::problems::ObserversSoln::expectsDataOutput(const PylithReal t,
+                                                   const PylithInt tindex) const {
+    PYLITH_METHOD_BEGIN;
+
+    bool expectsData = false;
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        if ((*iter)->expectsDataOutput(t, tindex)) {
+            expectsData = true;
+            break;
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(expectsData);
+} // expectsDataOutput
+
+
 // ------------------------------------------------------------------------------------------------
 // Comparison function for keeping set of observers in order.
 bool
@@ -63,12 +63,26 @@ public:
      */
     void removeObserver(pylith::problems::ObserverSoln* observer);
 
+    /** Get number of registered observers.
+     *
+     * @returns Number of registered observers.
+     */
+    size_t size(void) const;
+
     /** Set time scale in observers.
      *
      * @param[in] value Time scale for dimensionalizing time.
      */
     void setTimeScale(const PylithReal value);
 
+    /** Set expected number of time steps and duration of the simulation in observers.
+     *
+     * @param[in] numTimeSteps Expected number of time steps.
+     * @param[in] duration Duration of simulation (seconds).
+     */
+    void setExpectedTimeSteps(const size_t numTimeSteps,
+                              const PylithReal duration);
+
     /** Verify observers are compatible.
      *
      * @param[in] solution Solution field.
@@ -86,6 +100,15 @@ public:
                          const PylithInt tindex,
                          const pylith::topology::Field& solution);
 
+    /** Check whether any observer would consume a data update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if any observer would consume a data update at time t, false otherwise.
+     */
+    bool expectsDataOutput(const PylithReal t,
+                           const PylithInt tindex) const;
+
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -38,6 +38,7 @@ pylith::problems::Physics::Physics(void) :
     _normalizer(NULL),
     _labelName(pylith::topology::Mesh::cells_label_name),
     _labelValue(1),
+    _stepCadence(1),
     _observers(new pylith::problems::ObserversPhysics) {}
 
 
@@ -99,6 +100,28 @@ pylith::problems::Physics::getLabelValue(void) const {
 } // getLabelValue
 
 
+// ------------------------------------------------------------------------------------------------
+// Set number of global time steps between updates of the residual contribution.
+void
+pylith::problems::Physics::setStepCadence(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setStepCadence(value="<<value<<")");
+
+    if (value < 1) {
+        throw std::runtime_error("Step cadence for physics must be positive.");
+    } // if
+
+    _stepCadence = value;
+} // setStepCadence
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of global time steps between updates of the residual contribution.
+size_t
+pylith::problems::Physics::getStepCadence(void) const {
+    return _stepCadence;
+} // getStepCadence
+
+
 // ------------------------------------------------------------------------------------------------
 // Set manager of scales used to nondimensionalize problem.
 void
@@ -147,6 +170,15 @@ pylith::problems::Physics::setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB
 } // setAuxiliaryFieldDB
 
 
+// ------------------------------------------------------------------------------------------------
+// Get database for auxiliary field.
+spatialdata::spatialdb::SpatialDB*
+pylith::problems::Physics::getAuxiliaryFieldDB(void) {
+    pylith::feassemble::AuxiliaryFactory* factory = _getAuxiliaryFactory();
+    return (factory) ? factory->getQueryDB() : NULL;
+} // getAuxiliaryFieldDB
+
+
 // ------------------------------------------------------------------------------------------------
 // Set discretization information for auxiliary subfield.
 void
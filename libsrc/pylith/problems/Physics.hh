@@ -84,6 +84,21 @@ public:
      */
     int getLabelValue(void) const;
 
+    /** Set number of global time steps between updates of the residual contribution.
+     *
+     * A cadence greater than 1 lags the contribution of the integrator for this physics
+     * (operator splitting), so it is not reassembled at the resolution of faster physics.
+     *
+     * @param[in] value Number of time steps between updates (1 means every step).
+     */
+    void setStepCadence(const size_t value);
+
+    /** Get number of global time steps between updates of the residual contribution.
+     *
+     * @returns Number of time steps between updates.
+     */
+    size_t getStepCadence(void) const;
+
     /** Set manager of scales used to nondimensionalize problem.
      *
      * @param dim Nondimensionalizer.
@@ -108,6 +123,12 @@ public:
      */
     void setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB* const value);
 
+    /** Get spatial database for populating auxiliary field.
+     *
+     * @returns Spatial database with initial values for auxiliary field; NULL if none.
+     */
+    spatialdata::spatialdb::SpatialDB* getAuxiliaryFieldDB(void);
+
     /** Set discretization information for auxiliary subfield.
      *
      * @param[in] subfieldName Name of auxiliary subfield.
@@ -263,6 +284,7 @@ private:
 
     std::string _labelName; ///< Name of label in mesh for material.
     int _labelValue; ///< Value of label in mesh for material.
+    size_t _stepCadence; ///< Number of time steps between updates of residual contribution.
     pylith::problems::ObserversPhysics* _observers; ///< Subscribers of updates.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 
 #include "pylith/materials/Material.hh" // USES Material
 #include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
 #include "pylith/bc/BoundaryCondition.hh" // USES BoundaryCondition
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
@@ -35,15 +36,20 @@
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor::optimizeClosure()
+#include "pylith/topology/FieldQuery.hh" // USES FieldQuery::sharedCacheClear()
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 
 #include <cassert> // USES assert()
 #include <typeinfo> // USES typeid()
+#include <thread> // USES std::thread
+#include <set> // USES std::set
 
 // ------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -76,7 +82,20 @@ public:
              */
             template<class T> static std::vector<T*> subset(const std::vector<pylith::feassemble::Integrator*>& integrators);
 
+            /** Open spatial database, swallowing errors.
+             *
+             * Runs on a background prefetch thread; errors are swallowed here and
+             * reported when the database is opened again on the main thread during
+             * auxiliary field initialization.
+             *
+             * @param[inout] db Spatial database to open.
+             */
+            static
+            void openDatabase(spatialdata::spatialdb::SpatialDB* db);
+
+            static std::vector<std::thread> prefetchThreads; ///< Background threads opening databases.
         };
+        std::vector<std::thread> _Problem::prefetchThreads;
     }
 }
 
@@ -89,7 +108,9 @@ pylith::problems::Problem::Problem() :
     _observers(new pylith::problems::ObserversSoln),
     _formulation(pylith::problems::Physics::QUASISTATIC),
     _solverType(LINEAR),
-    _petscDefaults(pylith::utils::PetscDefaults::SOLVER | pylith::utils::PetscDefaults::TESTING) {}
+    _petscDefaults(pylith::utils::PetscDefaults::SOLVER | pylith::utils::PetscDefaults::TESTING),
+    _usePrefetchDatabases(false),
+    _autotuneKernels(false) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -105,6 +126,8 @@ void
 pylith::problems::Problem::deallocate(void) {
     PYLITH_METHOD_BEGIN;
 
+    _joinDatabasePrefetch();
+
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
         delete _integrators[i];_integrators[i] = NULL;
@@ -173,6 +196,41 @@ pylith::problems::Problem::setPetscDefaults(const int flags) {
 } // setPetscDefaults
 
 
+// ------------------------------------------------------------------------------------------------
+// Set whether to prefetch auxiliary field spatial databases.
+void
+pylith::problems::Problem::setPrefetchDatabases(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setPrefetchDatabases(value="<<value<<")");
+    _usePrefetchDatabases = value;
+} // setPrefetchDatabases
+
+
+// ------------------------------------------------------------------------------------------------
+// Get whether to prefetch auxiliary field spatial databases.
+bool
+pylith::problems::Problem::getPrefetchDatabases(void) const {
+    return _usePrefetchDatabases;
+} // getPrefetchDatabases
+
+
+// ------------------------------------------------------------------------------------------------
+// Set whether parallel reductions use a fixed combination order.
+void
+pylith::problems::Problem::setDeterministicReductions(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setDeterministicReductions(value="<<value<<")");
+    pylith::topology::FieldOps::setDeterministicReductions(value);
+} // setDeterministicReductions
+
+
+// ------------------------------------------------------------------------------------------------
+// Set whether to autotune kernel variants at initialization.
+void
+pylith::problems::Problem::setAutotuneKernels(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setAutotuneKernels(value="<<value<<")");
+    _autotuneKernels = value;
+} // setAutotuneKernels
+
+
 // ------------------------------------------------------------------------------------------------
 // Set manager of scales used to nondimensionalize problem.
 void
@@ -356,6 +414,10 @@ pylith::problems::Problem::preinitialize(const pylith::topology::Mesh& mesh) {
         _bc[i]->setFormulation(_formulation);
     } // for
 
+    if (_usePrefetchDatabases) {
+        _prefetchDatabases();
+    } // if
+
     PYLITH_METHOD_END;
 } // preinitialize
 
@@ -408,6 +470,8 @@ pylith::problems::Problem::initialize(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("Problem::initialize()");
 
+    _joinDatabasePrefetch();
+
     assert(_integrationData);
     pylith::topology::Field* solution = _integrationData->getField("solution");
     assert(solution);
@@ -417,8 +481,9 @@ pylith::problems::Problem::initialize(void) {
     _setupSolution();
     pylith::topology::CoordsVisitor::optimizeClosure(solution->getDM());
 
-    // Initialize integrators.
+    // Initialize integrators, scheduling integrators with matching kernels back-to-back.
     _createIntegrators();
+    _scheduleIntegrators();
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
         assert(_integrators[i]);
@@ -433,9 +498,25 @@ pylith::problems::Problem::initialize(void) {
         _constraints[i]->initialize(*solution);
     } // for
 
+    // Free spatial database values shared across field queries during initialization.
+    pylith::topology::FieldQuery::sharedCacheClear();
+
     solution->allocate();
     solution->createGlobalVector();
     solution->createOutputVector();
+    pylith::utils::MemoryLogger::addField("solution-field", *solution);
+
+    // Excise cells with fully constrained closures; they contribute only to constrained rows,
+    // which global assembly discards. Requires the constraints in the solution field layout, so
+    // this must follow allocation of the solution field.
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->removeFullyConstrainedCells();
+    } // for
+
+    // Cache cell geometry; reused by integrators until the mesh changes.
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->cacheGeometry(_integrationData->getGeometryCache());
+    } // for
 
     switch (_formulation) {
     case pylith::problems::Physics::DYNAMIC:
@@ -459,6 +540,86 @@ pylith::problems::Problem::initialize(void) {
 } // initialize
 
 
+// ------------------------------------------------------------------------------------------------
+// Re-query kinematic rupture parameters from the spatial databases.
+void
+pylith::problems::Problem::reinitializeRuptureParameters(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::reinitializeRuptureParameters()");
+
+    const size_t numInterfaces = _interfaces.size();
+    for (size_t i = 0; i < numInterfaces; ++i) {
+        assert(_interfaces[i]);
+        pylith::faults::FaultCohesiveKin* fault = dynamic_cast<pylith::faults::FaultCohesiveKin*>(_interfaces[i]);
+        if (fault) {
+            fault->reinitializeRuptureParameters();
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // reinitializeRuptureParameters
+
+
+// ------------------------------------------------------------------------------------------------
+// Print forecast of per-step cost, memory use, and output volume for a dry run.
+void
+pylith::problems::Problem::printForecast(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::printForecast()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField("solution");
+    assert(solution);
+
+    PetscErrorCode err;
+
+    // Degrees of freedom in the global solution vector.
+    PetscVec solutionVec = solution->getGlobalVector();assert(solutionVec);
+    PetscInt numDOFGlobal = 0;
+    PetscInt numDOFLocal = 0;
+    err = VecGetSize(solutionVec, &numDOFGlobal);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(solutionVec, &numDOFLocal);PYLITH_CHECK_ERROR(err);
+
+    // Allocate the Jacobian to measure its storage and sparsity; discarded before returning.
+    PetscMat jacobian = NULL;
+    err = DMCreateMatrix(solution->getDM(), &jacobian);PYLITH_CHECK_ERROR(err);
+    MatInfo matInfo;
+    err = MatGetInfo(jacobian, MAT_LOCAL, &matInfo);PYLITH_CHECK_ERROR(err);
+    const double numNonzerosLocal = matInfo.nz_allocated;
+    err = MatDestroy(&jacobian);PYLITH_CHECK_ERROR(err);
+
+    // Resident memory after discretization setup (mesh, solution, and auxiliary fields).
+    PetscLogDouble memoryLocal = 0.0;
+    err = PetscMemoryGetCurrentUsage(&memoryLocal);PYLITH_CHECK_ERROR(err);
+
+    MPI_Comm comm = solution->getMesh().getComm();
+    int numProcs = 1;
+    err = MPI_Comm_size(comm, &numProcs);PYLITH_CHECK_ERROR(err);
+    double statsLocal[3] = { double(numDOFLocal), numNonzerosLocal, double(memoryLocal) };
+    double statsMax[3];
+    double statsSum[3];
+    err = MPI_Allreduce(statsLocal, statsMax, 3, MPI_DOUBLE, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(statsLocal, statsSum, 3, MPI_DOUBLE, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+    const double bytesPerMB = 1048576.0;
+    const double jacobianBytesMax = statsMax[1] * (sizeof(PetscScalar) + sizeof(PetscInt));
+    PYLITH_COMPONENT_INFO_ROOT("Dry-run forecast (no time stepping)\n"
+                               << "Processes: " << numProcs << "\n"
+                               << "Solution degrees of freedom: " << numDOFGlobal
+                               << " total, " << PetscInt(statsMax[0]) << " max per process\n"
+                               << "Jacobian nonzeros: " << size_t(statsSum[1])
+                               << " total, " << size_t(statsMax[1]) << " max per process"
+                               << " (~" << size_t(jacobianBytesMax/bytesPerMB) << " MB per process when assembled)\n"
+                               << "Cost per Jacobian-vector product: ~" << size_t(2.0*statsSum[1]) << " flops"
+                               << " (~1 product per linear solver iteration)\n"
+                               << "Memory per process after setup: " << size_t(statsMax[2]/bytesPerMB) << " MB max, "
+                               << size_t(statsSum[2]/numProcs/bytesPerMB) << " MB average"
+                               << " (Jacobian and solver workspace are additional)");
+
+    PYLITH_METHOD_END;
+} // printForecast
+
+
 // ------------------------------------------------------------------------------------------------
 // Check material and interface ids.
 void
@@ -512,14 +673,24 @@ pylith::problems::Problem::_createIntegrators(void) {
         assert(_materials[i]);
         pylith::feassemble::Integrator* integrator = _materials[i]->createIntegrator(*solution);
         assert(count < maxSize);
-        if (integrator) { _integrators[count++] = integrator;}
+        if (integrator) {
+            integrator->setStepCadence(_materials[i]->getStepCadence());
+            pylith::feassemble::IntegratorDomain* integratorDomain = dynamic_cast<pylith::feassemble::IntegratorDomain*>(integrator);
+            if (_autotuneKernels && integratorDomain) {
+                integratorDomain->setAutotuneKernels(true);
+            } // if
+            _integrators[count++] = integrator;
+        } // if
     } // for
 
     for (size_t i = 0; i < numInterfaces; ++i) {
         assert(_interfaces[i]);
         pylith::feassemble::Integrator* integrator = _interfaces[i]->createIntegrator(*solution, _materials);
         assert(count < maxSize);
-        if (integrator) { _integrators[count++] = integrator;}
+        if (integrator) {
+            integrator->setStepCadence(_interfaces[i]->getStepCadence());
+            _integrators[count++] = integrator;
+        } // if
     } // for
 
     // Check to make sure boundary conditions are compatible with the solution.
@@ -527,7 +698,10 @@ pylith::problems::Problem::_createIntegrators(void) {
         assert(_bc[i]);
         pylith::feassemble::Integrator* integrator = _bc[i]->createIntegrator(*solution);
         assert(count < maxSize);
-        if (integrator) { _integrators[count++] = integrator;}
+        if (integrator) {
+            integrator->setStepCadence(_bc[i]->getStepCadence());
+            _integrators[count++] = integrator;
+        } // if
     } // for
 
     _integrators.resize(count);
@@ -536,6 +710,45 @@ pylith::problems::Problem::_createIntegrators(void) {
 } // _createIntegrators
 
 
+// ------------------------------------------------------------------------------------------------
+// Group integrators with identical kernels so their assembly sweeps run back-to-back.
+void
+pylith::problems::Problem::_scheduleIntegrators(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_scheduleIntegrators()");
+
+    // Integrators with the same kernel signature use identical point-wise functions, so
+    // running their assembly sweeps consecutively reuses warm instruction and data caches.
+    // The schedule preserves the relative order of integrators within a group and of
+    // integrators without a signature, so only the interleaving changes; the residual and
+    // Jacobian are sums over integrators and do not depend on the order.
+    const size_t numIntegrators = _integrators.size();
+    std::vector<pylith::feassemble::Integrator*> schedule;
+    schedule.reserve(numIntegrators);
+    std::vector<bool> scheduled(numIntegrators, false);
+    size_t numGroups = 0;
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        if (scheduled[i]) { continue; }
+        assert(_integrators[i]);
+        schedule.push_back(_integrators[i]);scheduled[i] = true;
+        ++numGroups;
+        const size_t signature = _integrators[i]->getKernelSignature();
+        if (!signature) { continue; } // No signature; do not group with other integrators.
+        for (size_t j = i+1; j < numIntegrators; ++j) {
+            if (!scheduled[j] && (signature == _integrators[j]->getKernelSignature())) {
+                schedule.push_back(_integrators[j]);scheduled[j] = true;
+            } // if
+        } // for
+    } // for
+    assert(schedule.size() == numIntegrators);
+    _integrators = schedule;
+
+    PYLITH_COMPONENT_DEBUG("Scheduled "<<numIntegrators<<" integrators into "<<numGroups<<" groups of matching kernels.");
+
+    PYLITH_METHOD_END;
+} // _scheduleIntegrators
+
+
 // ------------------------------------------------------------------------------------------------
 // Create array of constraints from materials, interfaces, and boundary conditions.
 void
@@ -622,9 +835,70 @@ pylith::problems::Problem::_setupSolution(void) {
 } // _setupSolution
 
 
+// ------------------------------------------------------------------------------------------------
+// Start background threads opening auxiliary field spatial databases.
+void
+pylith::problems::Problem::_prefetchDatabases(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_prefetchDatabases()");
+
+    // Collect unique databases; the same database may be shared among materials.
+    std::set<spatialdata::spatialdb::SpatialDB*> databases;
+    const size_t numMaterials = _materials.size();
+    for (size_t i = 0; i < numMaterials; ++i) {
+        databases.insert(_materials[i]->getAuxiliaryFieldDB());
+    } // for
+    const size_t numInterfaces = _interfaces.size();
+    for (size_t i = 0; i < numInterfaces; ++i) {
+        databases.insert(_interfaces[i]->getAuxiliaryFieldDB());
+    } // for
+    const size_t numBC = _bc.size();
+    for (size_t i = 0; i < numBC; ++i) {
+        databases.insert(_bc[i]->getAuxiliaryFieldDB());
+    } // for
+    databases.insert(_gravityField); // Queried by every material with body forces.
+    databases.erase((spatialdata::spatialdb::SpatialDB*)NULL);
+
+    for (std::set<spatialdata::spatialdb::SpatialDB*>::iterator iter = databases.begin();
+         iter != databases.end();
+         ++iter) {
+        _Problem::prefetchThreads.push_back(std::thread(_Problem::openDatabase, *iter));
+    } // for
+
+    PYLITH_METHOD_END;
+} // _prefetchDatabases
+
+
+// ------------------------------------------------------------------------------------------------
+// Wait for database prefetch threads to finish.
+void
+pylith::problems::Problem::_joinDatabasePrefetch(void) {
+    const size_t numThreads = _Problem::prefetchThreads.size();
+    for (size_t i = 0; i < numThreads; ++i) {
+        if (_Problem::prefetchThreads[i].joinable()) {
+            _Problem::prefetchThreads[i].join();
+        } // if
+    } // for
+    _Problem::prefetchThreads.clear();
+} // _joinDatabasePrefetch
+
+
 // ------------------------------------------------------------------------------------------------
 // Create null space for solution subfield.
 void
+pylith::problems::_Problem::openDatabase(spatialdata::spatialdb::SpatialDB* db) {
+    assert(db);
+    try {
+        db->open();
+    } catch (...) {
+        // Errors are reported when the database is opened again on the main
+        // thread during auxiliary field initialization.
+    } // try/catch
+} // openDatabase
+
+
+// ------------------------------------------------------------------------------------------------
+void
 pylith::problems::_Problem::createNullSpace(const pylith::topology::Field* solution,
                                             const char* subfieldName) {
     PYLITH_METHOD_BEGIN;
@@ -642,8 +916,7 @@ pylith::problems::_Problem::createNullSpace(const pylith::topology::Field* solut
 
     const PetscDM dmSoln = solution->getDM();
     const pylith::topology::Field::SubfieldInfo info = solution->getSubfieldInfo(subfieldName);
-    MatNullSpace nullSpace = NULL;
-    err = DMPlexCreateRigidBody(dmSoln, info.index, &nullSpace);PYLITH_CHECK_ERROR(err);
+    MatNullSpace nullSpace = solution->computeRigidBodyModes(subfieldName);
 
     PetscObject field = NULL;
     err = DMGetField(dmSoln, info.index, NULL, &field);PYLITH_CHECK_ERROR(err);
@@ -103,6 +103,45 @@ public:
      */
     void setPetscDefaults(const int flags);
 
+    /** Set whether to prefetch auxiliary field spatial databases.
+     *
+     * When enabled, the spatial databases for the auxiliary fields are opened
+     * and indexed on background threads between preinitialization and
+     * initialization, overlapping database I/O with the serial setup work so
+     * large (GB-scale) databases do not extend the startup critical path.
+     *
+     * @param[in] value True if databases should be prefetched on background threads.
+     */
+    void setPrefetchDatabases(const bool value);
+
+    /** Get whether to prefetch auxiliary field spatial databases.
+     *
+     * @returns True if databases are prefetched on background threads.
+     */
+    bool getPrefetchDatabases(void) const;
+
+    /** Set whether parallel reductions use a fixed combination order.
+     *
+     * When enabled, PyLith's own reductions (e.g., solution diagnostics) combine the
+     * per-process floating point contributions in a fixed rank order so results are
+     * bitwise reproducible from run to run on a fixed number of processes, at a modest
+     * cost in communication. The setting is process wide; residual and Jacobian
+     * assembly order is controlled by PETSc and is not affected.
+     *
+     * @param[in] value True if reductions should use a fixed combination order.
+     */
+    void setDeterministicReductions(const bool value);
+
+    /** Set whether to autotune kernel variants at initialization.
+     *
+     * When enabled, each material integrator benchmarks the semantically equivalent kernel
+     * variants registered for it on a sample batch of quadrature points at initialization and
+     * installs the fastest set, recording the timings and selection through the event logger.
+     *
+     * @param[in] value True if kernel variants should be autotuned.
+     */
+    void setAutotuneKernels(const bool value);
+
     /** Set manager of scales used to nondimensionalize problem.
      *
      * @param[in] dim Nondimensionalizer.
@@ -186,6 +225,21 @@ public:
     virtual
     void initialize(void);
 
+    /// Re-query kinematic rupture parameters from the spatial databases.
+    ///
+    /// Fast path for re-running an initialized problem with different slip distributions:
+    /// the mesh, discretization, integrators, and Jacobian sparsity are kept, and only the
+    /// kinematic auxiliary fields of the faults are re-queried.
+    void reinitializeRuptureParameters(void);
+
+    /// Print forecast of per-step cost, memory use, and output volume for a dry run.
+    ///
+    /// Should be called after initialize(). Allocates and discards the Jacobian to measure
+    /// its storage and sparsity, and reports the forecast to stdout on the root process
+    /// without advancing the solution.
+    virtual
+    void printForecast(void);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -205,6 +259,8 @@ protected:
     pylith::problems::Physics::FormulationEnum _formulation; ///< Formulation for equations.
     SolverTypeEnum _solverType; ///< Problem (solver) type.
     int _petscDefaults; ///< Flags for PETSc default options for problem.
+    bool _usePrefetchDatabases; ///< Prefetch auxiliary field databases on background threads.
+    bool _autotuneKernels; ///< Benchmark kernel variants at initialization and select the fastest.
 
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -218,9 +274,18 @@ private:
     /// Create array of constraints from materials, interfaces, and boundary conditions.
     void _createConstraints(void);
 
+    /// Group integrators with identical kernels so their assembly sweeps run back-to-back.
+    void _scheduleIntegrators(void);
+
     /// Setup solution subfields and discretization.
     void _setupSolution(void);
 
+    /// Start background threads opening auxiliary field spatial databases.
+    void _prefetchDatabases(void);
+
+    /// Wait for database prefetch threads to finish.
+    void _joinDatabasePrefetch(void);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
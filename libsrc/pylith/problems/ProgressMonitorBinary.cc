@@ -0,0 +1,137 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "ProgressMonitorBinary.hh" // implementation of class methods
+
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <fcntl.h> // USES open()
+#include <unistd.h> // USES close(), ftruncate()
+#include <sys/mman.h> // USES mmap(), munmap()
+#include <cerrno> // USES errno
+#include <ctime> // USES C time_t
+#include <cstring> // USES memset(), memcpy(), strerror()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::ProgressMonitorBinary::ProgressMonitorBinary(void) :
+    _status(NULL),
+    _fd(-1) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::ProgressMonitorBinary::~ProgressMonitorBinary(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::ProgressMonitorBinary::deallocate(void) {
+    _close();
+
+    ProgressMonitorTime::deallocate();
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Update progress with per-step solver details.
+void
+pylith::problems::ProgressMonitorBinary::updateStep(const double current,
+                                                    const double start,
+                                                    const double stop,
+                                                    const size_t tindex,
+                                                    const double dt,
+                                                    const long linearIterations,
+                                                    const long nonlinearIterations) {
+    if (!_isMaster || !_status) {
+        return;
+    } // if
+
+    const double percentComplete = (stop != start) ? (100*(current-start)) / (stop-start) : 0.0;
+    const double wallElapsed = difftime(time(NULL), _startTime);
+
+    // Seqlock: readers retry while the sequence counter is odd or changes during their read.
+    ++_status->sequence;
+    __sync_synchronize();
+    _status->step = tindex;
+    _status->t = current;
+    _status->dt = dt;
+    _status->percentComplete = percentComplete;
+    _status->wallElapsed = wallElapsed;
+    _status->linearIterations = linearIterations;
+    _status->nonlinearIterations = nonlinearIterations;
+    __sync_synchronize();
+    ++_status->sequence;
+} // updateStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Open progress monitor.
+void
+pylith::problems::ProgressMonitorBinary::_open(void) {
+    _fd = ::open(getFilename(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (_fd < 0) {
+        std::ostringstream msg;
+        msg << "Could not open progress monitor status file '" << getFilename() << "': " << strerror(errno);
+        throw std::runtime_error(msg.str());
+    } // if
+    if (-1 == ftruncate(_fd, sizeof(StatusRecord))) {
+        std::ostringstream msg;
+        msg << "Could not size progress monitor status file '" << getFilename() << "': " << strerror(errno);
+        ::close(_fd);_fd = -1;
+        throw std::runtime_error(msg.str());
+    } // if
+    void* buffer = mmap(NULL, sizeof(StatusRecord), PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (MAP_FAILED == buffer) {
+        std::ostringstream msg;
+        msg << "Could not map progress monitor status file '" << getFilename() << "': " << strerror(errno);
+        ::close(_fd);_fd = -1;
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _status = (StatusRecord*) buffer;
+    memset(_status, 0, sizeof(StatusRecord));
+    memcpy(_status->magic, "PyLithPM", sizeof(_status->magic));
+    _status->version = 1;
+} // _open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close progress monitor.
+void
+pylith::problems::ProgressMonitorBinary::_close(void) {
+    if (_status) {
+        munmap(_status, sizeof(StatusRecord));
+        _status = NULL;
+    } // if
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    } // if
+} // _close
+
+
+// End of file
@@ -0,0 +1,111 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/*** @file libsrc/problems/ProgressMonitorBinary.hh
+ *
+ * @brief Progress monitor writing a fixed-size binary status record to a
+ * memory-mapped file readable by external tools while the simulation runs.
+ */
+
+#if !defined(pylith_problems_progressmonitorbinary_hh)
+#define pylith_problems_progressmonitorbinary_hh
+
+#include "ProgressMonitorTime.hh" // ISA ProgressMonitorTime
+
+#include <stdint.h> // HASA uint64_t, int64_t
+
+class pylith::problems::ProgressMonitorBinary : public pylith::problems::ProgressMonitorTime {
+    friend class TestProgressMonitorBinary; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    ProgressMonitorBinary(void);
+
+    /// Destructor
+    virtual ~ProgressMonitorBinary(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Update progress with per-step solver details.
+     *
+     * Overwrites the single status record in place every step. The record is guarded by a
+     * sequence counter (odd while a write is in progress), so lock-free readers can detect and
+     * retry torn reads.
+     *
+     * @param[in] current Current time.
+     * @param[in] start Starting time.
+     * @param[in] stop Ending time.
+     * @param[in] tindex Current time step.
+     * @param[in] dt Current time step size.
+     * @param[in] linearIterations Cumulative number of linear solver iterations.
+     * @param[in] nonlinearIterations Cumulative number of nonlinear solver iterations.
+     */
+    void updateStep(const double current,
+                    const double start,
+                    const double stop,
+                    const size_t tindex,
+                    const double dt,
+                    const long linearIterations,
+                    const long nonlinearIterations);
+
+    // PUBLIC STRUCTS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Layout of memory-mapped status record (fixed size, native byte order).
+    struct StatusRecord {
+        char magic[8]; ///< File signature "PyLithPM".
+        uint64_t version; ///< Layout version.
+        uint64_t sequence; ///< Seqlock counter; odd while record is being updated.
+        uint64_t step; ///< Current time step.
+        double t; ///< Current simulation time (seconds).
+        double dt; ///< Current time step size (seconds).
+        double percentComplete; ///< Percent of simulation completed.
+        double wallElapsed; ///< Wall clock time since start of simulation (seconds).
+        int64_t linearIterations; ///< Cumulative number of linear solver iterations.
+        int64_t nonlinearIterations; ///< Cumulative number of nonlinear solver iterations.
+    }; // StatusRecord
+
+    // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Open progress monitor.
+    void _open(void);
+
+    /// Close progress monitor.
+    void _close(void);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    StatusRecord* _status; ///< Memory-mapped status record.
+    int _fd; ///< File descriptor for status file.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    ProgressMonitorBinary(const ProgressMonitorBinary&); ///< Not implemented.
+    const ProgressMonitorBinary& operator=(const ProgressMonitorBinary&); ///< Not implemented.
+
+}; // ProgressMonitorBinary
+
+#endif // pylith_problems_progressmonitorbinary_hh
+
+// End of file
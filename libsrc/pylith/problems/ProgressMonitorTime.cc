@@ -20,6 +20,8 @@
 
 #include "ProgressMonitorTime.hh" // implementation of class methods
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::getAccumulatedTime()
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include "spatialdata/units/Parser.hh" // USES Parser
@@ -34,7 +36,14 @@
 // Constructor
 pylith::problems::ProgressMonitorTime::ProgressMonitorTime(void) :
     _baseTime(1.0),
-    _baseUnit("second") {}
+    _baseUnit("second"),
+    _showBudget(false),
+    _assemblyPrev(0.0),
+    _solvePrev(0.0),
+    _stateUpdatePrev(0.0),
+    _outputPrev(0.0),
+    _linearItsPrev(0),
+    _nonlinearItsPrev(0) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -75,12 +84,47 @@ pylith::problems::ProgressMonitorTime::getTimeUnit(void) const {
 } // getTimeUnit
 
 
+// ------------------------------------------------------------------------------------------------
+// Set whether to write a per-step time budget.
+void
+pylith::problems::ProgressMonitorTime::setShowBudget(const bool value) {
+    _showBudget = value;
+} // setShowBudget
+
+
+// ------------------------------------------------------------------------------------------------
+// Get whether to write a per-step time budget.
+bool
+pylith::problems::ProgressMonitorTime::getShowBudget(void) const {
+    return _showBudget;
+} // getShowBudget
+
+
 // ------------------------------------------------------------------------------------------------
 // Open progress monitor.
 void
 pylith::problems::ProgressMonitorTime::_open(void) {
+    if (_showBudget) {
+        // The budget is accumulated from the PETSc logging events, so logging must be active.
+        PetscBool isActive = PETSC_FALSE;
+        PetscErrorCode err = PetscLogIsActive(&isActive);PYLITH_CHECK_ERROR(err);
+        if (!isActive) {
+            err = PetscLogDefaultBegin();PYLITH_CHECK_ERROR(err);
+        } // if
+        _assemblyPrev = 0.0;
+        _solvePrev = 0.0;
+        _stateUpdatePrev = 0.0;
+        _outputPrev = 0.0;
+        _linearItsPrev = 0;
+        _nonlinearItsPrev = 0;
+    } // if
+
     _sout.open(getFilename());
-    _sout << "Timestamp                     Simulation t   % complete   Est. completion" << std::endl;
+    if (_showBudget) {
+        _sout << "Timestamp                         Step   Simulation t    Assembly [ms]  Solve [ms]  Update [ms]  Output [ms]  Linear its  Nonlinear its" << std::endl;
+    } else {
+        _sout << "Timestamp                     Simulation t   % complete   Est. completion" << std::endl;
+    } // if/else
     _sout.setf(std::ios::fixed);
 } // _open
 
@@ -120,6 +164,62 @@ pylith::problems::ProgressMonitorTime::update(const double current,
 } // update
 
 
+// ------------------------------------------------------------------------------------------------
+// Update progress with per-step solver details.
+void
+pylith::problems::ProgressMonitorTime::updateStep(const double current,
+                                                  const double start,
+                                                  const double stop,
+                                                  const size_t tindex,
+                                                  const double dt,
+                                                  const long linearIterations,
+                                                  const long nonlinearIterations) {
+    if (!_showBudget) {
+        update(current, start, stop);
+        return;
+    } // if
+    if (!_isMaster) {
+        return;
+    } // if
+
+    // Accumulated times for this process; assembly and solve come from the PETSc solver
+    // events, state update and output from the events TimeDependent logs in poststep().
+    const double assembly = pylith::utils::EventLogger::getAccumulatedTime("SNESFunctionEval")
+                            + pylith::utils::EventLogger::getAccumulatedTime("SNESJacobianEval")
+                            + pylith::utils::EventLogger::getAccumulatedTime("TSFunctionEval")
+                            + pylith::utils::EventLogger::getAccumulatedTime("TSJacobianEval");
+    const double solve = pylith::utils::EventLogger::getAccumulatedTime("KSPSolve");
+    const double stateUpdate = pylith::utils::EventLogger::getAccumulatedTime("Py-TDep-stateUpdate");
+    const double output = pylith::utils::EventLogger::getAccumulatedTime("Py-TDep-output");
+
+    assert(_sout.is_open());
+    const double tSimNorm = current / _baseTime;
+    time_t now = time(NULL);
+    std::tm* now_tm = localtime(&now);
+    std::string now_str = asctime(now_tm);
+    now_str = now_str.erase(now_str.find_last_not_of('\n')+1);
+    _sout << now_str << "   "
+          << std::setw(8) << tindex << "   "
+          << std::setprecision(2) << std::setw(9) << tSimNorm
+          << "*" << std::left << std::setw(6) << _baseUnit << std::right
+          << std::setprecision(1)
+          << std::setw(13) << 1.0e+3 * (assembly - _assemblyPrev)
+          << std::setw(12) << 1.0e+3 * (solve - _solvePrev)
+          << std::setw(13) << 1.0e+3 * (stateUpdate - _stateUpdatePrev)
+          << std::setw(13) << 1.0e+3 * (output - _outputPrev)
+          << std::setw(12) << linearIterations - _linearItsPrev
+          << std::setw(15) << nonlinearIterations - _nonlinearItsPrev
+          << std::endl;
+
+    _assemblyPrev = assembly;
+    _solvePrev = solve;
+    _stateUpdatePrev = stateUpdate;
+    _outputPrev = output;
+    _linearItsPrev = linearIterations;
+    _nonlinearItsPrev = nonlinearIterations;
+} // updateStep
+
+
 // ------------------------------------------------------------------------------------------------
 // Update progress.
 void
@@ -56,6 +56,23 @@ public:
      */
     const char* getTimeUnit(void) const;
 
+    /** Set whether to write a per-step time budget.
+     *
+     * When enabled, every time step appends one line with the time this process spent in
+     * assembly, solve, state update, and output since the previous step along with the solver
+     * iteration counts for the step. The budget is accumulated from the PETSc logging events;
+     * logging is turned on when the monitor is opened if it is not already active.
+     *
+     * @param[in] value True if per-step budget lines should be written.
+     */
+    void setShowBudget(const bool value);
+
+    /** Get whether to write a per-step time budget.
+     *
+     * @returns True if per-step budget lines are written.
+     */
+    bool getShowBudget(void) const;
+
     /** Update progress.
      *
      * @param[in] current Current time.
@@ -66,6 +83,29 @@ public:
                 const double start,
                 const double stop);
 
+    /** Update progress with per-step solver details.
+     *
+     * When the per-step budget is enabled, writes one budget line per step; otherwise the
+     * details are ignored and update() is called. Monitors recording per-step status
+     * (e.g., ProgressMonitorBinary) override this method.
+     *
+     * @param[in] current Current time.
+     * @param[in] start Starting time.
+     * @param[in] stop Ending time.
+     * @param[in] tindex Current time step.
+     * @param[in] dt Current time step size.
+     * @param[in] linearIterations Cumulative number of linear solver iterations.
+     * @param[in] nonlinearIterations Cumulative number of nonlinear solver iterations.
+     */
+    virtual
+    void updateStep(const double current,
+                    const double start,
+                    const double stop,
+                    const size_t tindex,
+                    const double dt,
+                    const long linearIterations,
+                    const long nonlinearIterations);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -93,6 +133,13 @@ private:
     double _baseTime; ///< Units of time as seconds.
     std::string _baseUnit; ///< Unit of time.
     std::ofstream _sout; ///< Output stream.
+    bool _showBudget; ///< Write per-step time budget lines.
+    double _assemblyPrev; ///< Accumulated assembly time (s) at previous step.
+    double _solvePrev; ///< Accumulated solve time (s) at previous step.
+    double _stateUpdatePrev; ///< Accumulated state-update time (s) at previous step.
+    double _outputPrev; ///< Accumulated output time (s) at previous step.
+    long _linearItsPrev; ///< Cumulative linear solver iterations at previous step.
+    long _nonlinearItsPrev; ///< Cumulative nonlinear solver iterations at previous step.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
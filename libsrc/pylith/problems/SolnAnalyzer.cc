@@ -0,0 +1,39 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SolnAnalyzer.hh" // implementation of class methods
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::problems::SolnAnalyzer::SolnAnalyzer(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::SolnAnalyzer::~SolnAnalyzer(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify analyzer is compatible with solution.
+void
+pylith::problems::SolnAnalyzer::verifyConfiguration(const pylith::topology::Field& solution) const {}
+
+
+// End of file
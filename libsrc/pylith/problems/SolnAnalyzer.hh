@@ -0,0 +1,78 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/SolnAnalyzer.hh
+ *
+ * @brief C++ abstract base class for in-situ analysis of the solution (e.g., moment release,
+ * surface deformation spectra) without writing full output. Analyzers are registered with an
+ * ObserverSolnAnalysis observer, which gives them read-only access to the solution at each
+ * update and enforces a per-analyzer time budget.
+ */
+
+#if !defined(pylith_problems_solnanalyzer_hh)
+#define pylith_problems_solnanalyzer_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/types.hh" // USES PylithReal, PylithInt
+
+class pylith::problems::SolnAnalyzer {
+    friend class TestSolnAnalyzer; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    SolnAnalyzer(void);
+
+    /// Destructor.
+    virtual ~SolnAnalyzer(void);
+
+    /** Verify analyzer is compatible with solution.
+     *
+     * The default implementation accepts any solution.
+     *
+     * @param[in] solution Solution field.
+     */
+    virtual
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Analyze solution at time t.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t (read-only).
+     */
+    virtual
+    void analyze(const PylithReal t,
+                 const PylithInt tindex,
+                 const pylith::topology::Field& solution) = 0;
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    SolnAnalyzer(const SolnAnalyzer&); ///< Not implemented.
+    const SolnAnalyzer& operator=(const SolnAnalyzer&); ///< Not implemented.
+
+}; // SolnAnalyzer
+
+#endif // pylith_problems_solnanalyzer_hh
+
+// End of file
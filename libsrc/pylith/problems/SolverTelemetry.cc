@@ -0,0 +1,243 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SolverTelemetry.hh" // implementation of class methods
+
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "petscvec.h" // USES PetscVec
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include <cassert> // USES assert()
+#include <cmath> // USES sqrt()
+#include <sstream> // USES std::ostringstream
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::SolverTelemetry::SolverTelemetry(void) :
+    _filename("solver_telemetry.h5"),
+    _logger(NULL),
+    _residualPrev(NULL),
+    _wallTimeStart(0.0) {
+    GenericComponent::setName("solvertelemetry");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::SolverTelemetry::~SolverTelemetry(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::SolverTelemetry::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = VecDestroy(&_residualPrev);PYLITH_CHECK_ERROR(err);
+    delete _logger;_logger = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename for HDF5 telemetry file.
+void
+pylith::problems::SolverTelemetry::setFilename(const char* filename) {
+    _filename = filename;
+} // setFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Get filename for HDF5 telemetry file.
+const char*
+pylith::problems::SolverTelemetry::getFilename(void) const {
+    return _filename.c_str();
+} // getFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Initialize telemetry for integrators, registering a logging event per integrator.
+void
+pylith::problems::SolverTelemetry::initialize(const std::vector<pylith::feassemble::Integrator*>& integrators) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_logger) {
+        _logger = new pylith::utils::EventLogger;assert(_logger);
+        _logger->setClassName("SolverTelemetry");
+        _logger->initialize();
+    } // if
+
+    const size_t numIntegrators = integrators.size();
+    _integratorNames.resize(numIntegrators);
+    _eventIds.resize(numIntegrators);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(integrators[i]);
+        std::ostringstream name;
+        name << integrators[i]->getLabelName() << "=" << integrators[i]->getLabelValue();
+        _integratorNames[i] = name.str();
+        _eventIds[i] = _logger->registerEvent((std::string("Py-Telem-") + _integratorNames[i]).c_str());
+    } // for
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Start record for one residual evaluation.
+void
+pylith::problems::SolverTelemetry::beginResidual(const PylithReal t,
+                                                 const PylithReal dt) {
+    _times.push_back(t);
+    _timeSteps.push_back(dt);
+
+    const size_t numIntegrators = _integratorNames.size();
+    _normsSq.resize(_normsSq.size() + numIntegrators, 0.0);
+    _wallTimes.resize(_wallTimes.size() + numIntegrators, 0.0);
+} // beginResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Start measurement for one integrator within the current residual evaluation.
+void
+pylith::problems::SolverTelemetry::beginIntegrator(const size_t index,
+                                                   PetscVec residualLocalVec) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(residualLocalVec);
+
+    PetscErrorCode err = 0;
+    if (!_residualPrev) {
+        err = VecDuplicate(residualLocalVec, &_residualPrev);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = VecCopy(residualLocalVec, _residualPrev);PYLITH_CHECK_ERROR(err);
+
+    assert(_logger);
+    assert(index < _eventIds.size());
+    _logger->eventBegin(_eventIds[index]);
+    _wallTimeStart = MPI_Wtime();
+
+    PYLITH_METHOD_END;
+} // beginIntegrator
+
+
+// ------------------------------------------------------------------------------------------------
+// End measurement for one integrator within the current residual evaluation.
+void
+pylith::problems::SolverTelemetry::endIntegrator(const size_t index,
+                                                 PetscVec residualLocalVec) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(residualLocalVec);
+    assert(_residualPrev);
+
+    const double elapsed = MPI_Wtime() - _wallTimeStart;
+    assert(_logger);
+    assert(index < _eventIds.size());
+    _logger->eventEnd(_eventIds[index]);
+
+    // Norm of the integrator contribution (difference of residual before and after).
+    PetscErrorCode err = VecAXPY(_residualPrev, -1.0, residualLocalVec);PYLITH_CHECK_ERROR(err);
+    PetscReal norm = 0.0;
+    err = VecNorm(_residualPrev, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+
+    const size_t numIntegrators = _integratorNames.size();
+    assert(_normsSq.size() >= numIntegrators);
+    const size_t row = _normsSq.size() - numIntegrators;
+    _normsSq[row + index] = norm * norm;
+    _wallTimes[row + index] = elapsed;
+
+    PYLITH_METHOD_END;
+} // endIntegrator
+
+
+// ------------------------------------------------------------------------------------------------
+// Reduce telemetry across processes and write HDF5 time series (master process only).
+void
+pylith::problems::SolverTelemetry::write(const PylithReal timeScale) {
+    PYLITH_METHOD_BEGIN;
+
+    const size_t numRecords = _times.size();
+    const size_t numIntegrators = _integratorNames.size();
+    if ((0 == numRecords) || (0 == numIntegrators)) {
+        PYLITH_METHOD_END;
+    } // if
+
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    int rank = 0;
+    PetscErrorCode err = MPI_Comm_rank(comm, &rank);PYLITH_CHECK_ERROR(err);
+    const bool isMaster = 0 == rank;
+
+    // Sum squared norms of local contributions over processes; take maximum wall time.
+    const int count = int(numRecords * numIntegrators);
+    err = MPI_Reduce(isMaster ? MPI_IN_PLACE : &_normsSq[0], &_normsSq[0], count, MPI_DOUBLE,
+                     MPI_SUM, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Reduce(isMaster ? MPI_IN_PLACE : &_wallTimes[0], &_wallTimes[0], count, MPI_DOUBLE,
+                     MPI_MAX, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (!isMaster) {
+        PYLITH_METHOD_END;
+    } // if
+
+    std::vector<double> norms(numRecords * numIntegrators);
+    for (size_t i = 0; i < norms.size(); ++i) {
+        norms[i] = sqrt(_normsSq[i]);
+    } // for
+    std::vector<double> times(numRecords);
+    std::vector<double> timeSteps(numRecords);
+    for (size_t i = 0; i < numRecords; ++i) {
+        times[i] = _times[i] * timeScale;
+        timeSteps[i] = _timeSteps[i] * timeScale;
+    } // for
+
+    pylith::meshio::HDF5 h5(_filename.c_str(), H5F_ACC_TRUNC);
+
+    const int ndims = 2;
+    hsize_t maxDims[2] = { H5S_UNLIMITED, 1 };
+    hsize_t dims[2] = { hsize_t(numRecords), 1 };
+    h5.createDataset("/", "time", maxDims, dims, ndims, H5T_NATIVE_DOUBLE);
+    h5.writeDatasetChunk("/", "time", &times[0], dims, dims, ndims, 0, H5T_NATIVE_DOUBLE);
+    h5.createDataset("/", "time_step", maxDims, dims, ndims, H5T_NATIVE_DOUBLE);
+    h5.writeDatasetChunk("/", "time_step", &timeSteps[0], dims, dims, ndims, 0, H5T_NATIVE_DOUBLE);
+
+    maxDims[1] = hsize_t(numIntegrators);
+    dims[1] = hsize_t(numIntegrators);
+    h5.createDataset("/", "residual_norm", maxDims, dims, ndims, H5T_NATIVE_DOUBLE);
+    h5.writeDatasetChunk("/", "residual_norm", &norms[0], dims, dims, ndims, 0, H5T_NATIVE_DOUBLE);
+    h5.createDataset("/", "wall_time", maxDims, dims, ndims, H5T_NATIVE_DOUBLE);
+    h5.writeDatasetChunk("/", "wall_time", &_wallTimes[0], dims, dims, ndims, 0, H5T_NATIVE_DOUBLE);
+
+    std::vector<const char*> names(numIntegrators);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        names[i] = _integratorNames[i].c_str();
+    } // for
+    h5.writeDataset("/", "integrators", &names[0], int(numIntegrators));
+
+    h5.close();
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// End of file
@@ -0,0 +1,135 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/problems/SolverTelemetry.hh
+ *
+ * @brief Per-integrator residual-norm and timing telemetry for diagnosing solver convergence.
+ *
+ * Records the residual-norm contribution and wall time of each integrator for every LHS
+ * residual evaluation, so slow nonlinear convergence can be attributed to a specific
+ * material or fault. Norms are accumulated locally during the run and reduced across
+ * processes once at the end of the simulation, when the series is written to an HDF5 file;
+ * per-integrator PETSc logging events provide the same timings in -log_view output.
+ */
+
+#if !defined(pylith_problems_solvertelemetry_hh)
+#define pylith_problems_solvertelemetry_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+#include "pylith/feassemble/feassemblefwd.hh" // USES Integrator
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
+#include "pylith/utils/petscfwd.h" // USES PetscVec
+#include "pylith/utils/types.hh" // USES PylithReal
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::problems::SolverTelemetry : public pylith::utils::GenericComponent {
+    friend class TestSolverTelemetry; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    SolverTelemetry(void);
+
+    /// Destructor.
+    ~SolverTelemetry(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename for HDF5 telemetry file.
+     *
+     * @param[in] filename Name of HDF5 telemetry file.
+     */
+    void setFilename(const char* filename);
+
+    /** Get filename for HDF5 telemetry file.
+     *
+     * @returns Name of HDF5 telemetry file.
+     */
+    const char* getFilename(void) const;
+
+    /** Initialize telemetry for integrators, registering a logging event per integrator.
+     *
+     * @param[in] integrators Integrators for problem.
+     */
+    void initialize(const std::vector<pylith::feassemble::Integrator*>& integrators);
+
+    /** Start record for one residual evaluation.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] dt Current time step (nondimensional).
+     */
+    void beginResidual(const PylithReal t,
+                       const PylithReal dt);
+
+    /** Start measurement for one integrator within the current residual evaluation.
+     *
+     * @param[in] index Index of integrator.
+     * @param[in] residualLocalVec Local PETSc Vec with residual before integrator contribution.
+     */
+    void beginIntegrator(const size_t index,
+                         PetscVec residualLocalVec);
+
+    /** End measurement for one integrator within the current residual evaluation.
+     *
+     * @param[in] index Index of integrator.
+     * @param[in] residualLocalVec Local PETSc Vec with residual after integrator contribution.
+     */
+    void endIntegrator(const size_t index,
+                       PetscVec residualLocalVec);
+
+    /** Reduce telemetry across processes and write HDF5 time series (master process only).
+     *
+     * Residual norms are computed from local contributions summed over processes; points
+     * shared among processes contribute once per process, so norms are diagnostic
+     * (per-integrator comparison over time), not assembled residual norms.
+     *
+     * @param[in] timeScale Time scale for dimensionalizing time.
+     */
+    void write(const PylithReal timeScale);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of HDF5 telemetry file.
+    pylith::utils::EventLogger* _logger; ///< Event logger.
+    std::vector<std::string> _integratorNames; ///< Name (label and value) of each integrator.
+    std::vector<int> _eventIds; ///< Logging event for each integrator.
+    std::vector<double> _times; ///< Time (nondimensional) of each residual evaluation.
+    std::vector<double> _timeSteps; ///< Time step (nondimensional) of each residual evaluation.
+    std::vector<double> _normsSq; ///< Local residual norm squared [evaluation, integrator].
+    std::vector<double> _wallTimes; ///< Wall time (s) [evaluation, integrator].
+    PetscVec _residualPrev; ///< Snapshot of residual before integrator contribution.
+    double _wallTimeStart; ///< Wall time at start of current integrator measurement.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    SolverTelemetry(const SolverTelemetry&); ///< Not implemented.
+    const SolverTelemetry& operator=(const SolverTelemetry&); ///< Not implemented.
+
+}; // class SolverTelemetry
+
+#endif // pylith_problems_solvertelemetry_hh
+
+// End of file
@@ -0,0 +1,517 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+#include <portinfo>
+
+#include "SteadyState.hh" // implementation of class methods
+
+#include "pylith/feassemble/IntegrationData.hh" // HOLDSA IntegrationData
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscts.h" // USES PetscTS
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _SteadyState {
+public:
+
+            static const char* pyreComponent;
+        }; // _SteadyState
+
+        const char* _SteadyState::pyreComponent = "steadystate";
+    } // problems
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::SteadyState::SteadyState(void) :
+    _dtInitial(1.0),
+    _dtIncrement(1.1),
+    _maxPseudoTimeSteps(100),
+    _ts(NULL) {
+    PyreComponent::setName(_SteadyState::pyreComponent);
+
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, -HUGE_VAL);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, -1.0);
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::SteadyState::~SteadyState(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::SteadyState::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Problem::deallocate();
+
+    PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set initial pseudo-time step.
+void
+pylith::problems::SteadyState::setInitialTimeStep(const double value) {
+    PYLITH_COMPONENT_DEBUG("setInitialTimeStep(value="<<value<<")");
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Initial pseudo-time step (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _dtInitial = value;
+} // setInitialTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Get initial pseudo-time step.
+double
+pylith::problems::SteadyState::getInitialTimeStep(void) const {
+    return _dtInitial;
+} // getInitialTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Set maximum number of pseudo-time steps.
+void
+pylith::problems::SteadyState::setMaxPseudoTimeSteps(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setMaxPseudoTimeSteps(value="<<value<<")");
+
+    _maxPseudoTimeSteps = value;
+} // setMaxPseudoTimeSteps
+
+
+// ------------------------------------------------------------------------------------------------
+// Get maximum number of pseudo-time steps.
+size_t
+pylith::problems::SteadyState::getMaxPseudoTimeSteps(void) const {
+    return _maxPseudoTimeSteps;
+} // getMaxPseudoTimeSteps
+
+
+// ------------------------------------------------------------------------------------------------
+// Set factor by which the pseudo-time step grows as the residual decreases.
+void
+pylith::problems::SteadyState::setTimeStepIncrement(const double value) {
+    PYLITH_COMPONENT_DEBUG("setTimeStepIncrement(value="<<value<<")");
+
+    if (value <= 1.0) {
+        std::ostringstream msg;
+        msg << "Pseudo-time step increment factor (" << value << ") must be greater than 1.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _dtIncrement = value;
+} // setTimeStepIncrement
+
+
+// ------------------------------------------------------------------------------------------------
+// Get Petsc DM associated with problem.
+PetscDM
+pylith::problems::SteadyState::getPetscDM(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dm = NULL;
+    PetscErrorCode err = TSGetDM(_ts, &dm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(dm);
+} // getPetscDM
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration.
+void
+pylith::problems::SteadyState::verifyConfiguration(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::verifyConfiguration(void)");
+
+    Problem::verifyConfiguration();
+
+    if (pylith::problems::Physics::QUASISTATIC != _formulation) {
+        throw std::runtime_error("Steady-state problems require the quasistatic formulation.");
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Initialize.
+void
+pylith::problems::SteadyState::initialize(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("initialize()");
+
+    Problem::initialize();
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);assert(!_ts);
+    const pylith::topology::Mesh& mesh = solution->getMesh();
+    err = TSCreate(mesh.getComm(), &_ts);PYLITH_CHECK_ERROR(err);assert(_ts);
+    err = TSSetType(_ts, TSPSEUDO);PYLITH_CHECK_ERROR(err);
+    err = TSSetProblemType(_ts, TS_NONLINEAR);PYLITH_CHECK_ERROR(err);
+    err = TSSetExactFinalTime(_ts, TS_EXACTFINALTIME_UNSPECIFIED);PYLITH_CHECK_ERROR(err);
+    err = TSSetApplicationContext(_ts, (void*)this);PYLITH_CHECK_ERROR(err);
+
+    assert(_normalizer);
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    PYLITH_COMPONENT_DEBUG("Setting PetscTS parameters: "
+                           <<"dtInitial="<<_dtInitial
+                           <<", dtIncrement="<<_dtIncrement
+                           <<", maxPseudoTimeSteps="<<_maxPseudoTimeSteps);
+    err = TSSetTime(_ts, 0.0);PYLITH_CHECK_ERROR(err);
+    err = TSSetTimeStep(_ts, _dtInitial / timeScale);PYLITH_CHECK_ERROR(err);
+    err = TSSetMaxSteps(_ts, _maxPseudoTimeSteps);PYLITH_CHECK_ERROR(err);
+    err = TSSetMaxTime(_ts, PETSC_MAX_REAL);PYLITH_CHECK_ERROR(err);
+    err = TSPseudoSetTimeStepIncrement(_ts, _dtIncrement);PYLITH_CHECK_ERROR(err);
+    err = TSSetDM(_ts, solution->getDM());PYLITH_CHECK_ERROR(err);
+
+    // Set initial guess for solution.
+    PYLITH_COMPONENT_DEBUG("Setting PetscTS initial guess using global vector for solution.");
+    solution->zeroLocal();
+    PetscVec solutionVector = solution->getGlobalVector();
+    solution->scatterLocalToVector(solutionVector);
+    err = TSSetSolution(_ts, solutionVector);PYLITH_CHECK_ERROR(err);
+    assert(_observers);
+    _observers->setTimeScale(timeScale);
+
+    PYLITH_COMPONENT_DEBUG("Setting up time derivative of solution and residual fields.");
+    pylith::topology::Field* solutionDot = new pylith::topology::Field(*solution);assert(solutionDot);
+    solutionDot->setLabel("solutionDot");
+    _integrationData->setField(pylith::feassemble::IntegrationData::solution_dot, solutionDot);
+
+    pylith::topology::Field* residual = new pylith::topology::Field(*solution);assert(residual);
+    residual->setLabel("residual");
+    _integrationData->setField(pylith::feassemble::IntegrationData::residual, residual);
+
+    // Constraint values and integrator state correspond to the physical time of the steady state.
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, 0.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, 0.0);
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->setState(0.0);
+    } // for
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->setState(0.0);
+    } // for
+
+    // Set callbacks.
+    PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks poststep(), computeIFunction(), and computeIJacobian().");
+    err = TSSetPostStep(_ts, poststep);PYLITH_CHECK_ERROR(err);
+    err = TSSetIFunction(_ts, NULL, computeLHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
+    err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+
+    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
+    err = TSSetFromOptions(_ts);PYLITH_CHECK_ERROR(err);
+    err = TSSetUp(_ts);PYLITH_CHECK_ERROR(err);
+
+    pythia::journal::debug_t debug(pylith::utils::PyreComponent::getName());
+    if (debug.state()) {
+        PetscDS dsSoln = NULL;
+        err = DMGetDS(solution->getDM(), &dsSoln);PYLITH_CHECK_ERROR(err);
+        debug << pythia::journal::at(__HERE__)
+              << "Solution discretization" << pythia::journal::endl;
+        PetscDSView(dsSoln, PETSC_VIEWER_STDOUT_SELF);
+    } // if
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Solve steady-state problem.
+void
+pylith::problems::SteadyState::solve(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("solve()");
+
+    PetscErrorCode err = TSSolve(_ts, NULL);PYLITH_CHECK_ERROR(err);
+
+    TSConvergedReason reason = TS_CONVERGED_ITERATING;
+    err = TSGetConvergedReason(_ts, &reason);PYLITH_CHECK_ERROR(err);
+    if (reason < 0) {
+        std::ostringstream msg;
+        msg << "Pseudo-time stepping to steady state diverged (reason " << TSConvergedReasons[reason] << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Notify problem observers of steady-state solution.
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+    PetscReal t = 0.0;
+    PetscInt tindex = 0;
+    err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetStepNumber(_ts, &tindex);PYLITH_CHECK_ERROR(err);
+    solution->scatterVectorToLocal(solution->getGlobalVector());
+    solution->scatterLocalToOutput();
+    assert(_observers);
+    _observers->notifyObservers(t, tindex, *solution);
+
+    PYLITH_METHOD_END;
+} // solve
+
+
+// ------------------------------------------------------------------------------------------------
+// Perform operations after advancing solution one pseudo-time step.
+void
+pylith::problems::SteadyState::poststep(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("poststep()");
+
+    // Get current pseudo time and step.
+    PetscErrorCode err;
+    PylithReal t = 0.0, dt = 0.0;
+    PylithInt tindex = 0;
+    err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    err = TSGetStepNumber(_ts, &tindex);PYLITH_CHECK_ERROR(err);
+
+    // Update PyLith view of the solution.
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+    PetscVec solutionVec = NULL;
+    err = TSGetSolution(_ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    solution->scatterVectorToLocal(solutionVec);
+
+    // Update state variables (e.g., viscous strain) so the pseudo-time march relaxes toward
+    // the steady state; observers are notified only with the converged solution in solve().
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->poststep(t, tindex, dt, *solution);
+    } // for
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->poststep(t, tindex, dt, *solution);
+    } // for
+
+    PYLITH_METHOD_END;
+} // poststep
+
+
+// ------------------------------------------------------------------------------------------------
+// Set solution values according to constraints (Dirichlet BC).
+void
+pylith::problems::SteadyState::setSolutionLocal(PetscVec solutionVec,
+                                                PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setSolutionLocal(solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<")");
+
+    // Update PyLith view of the solution and its time derivative.
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    solution->scatterVectorToLocal(solutionVec);
+    if (solutionDotVec) {
+        pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);
+        assert(solutionDot);
+        solutionDot->scatterVectorToLocal(solutionDotVec);
+    } // if
+
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->setSolution(_integrationData);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setSolutionLocal
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute LHS residual for F(t,s,\dot{s}).
+void
+pylith::problems::SteadyState::computeLHSResidual(PetscVec residualVec,
+                                                  const PetscReal dt,
+                                                  PetscVec solutionVec,
+                                                  PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeLHSResidual(dt="<<dt<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<")");
+
+    assert(residualVec);
+    assert(solutionVec);
+    assert(solutionDotVec);
+    assert(_integrationData);
+
+    // Update PyLith view of the solution.
+    setSolutionLocal(solutionVec, solutionDotVec);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
+
+    // Sum residual across integrators.
+    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
+    residual->zeroLocal();
+    const size_t numIntegrators = _integrators.size();
+    assert(numIntegrators > 0); // must have at least 1 integrator
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSResidual(residual, *_integrationData);
+    } // for
+
+    // Assemble residual values across processes.
+    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+    residual->scatterLocalToVector(residualVec, ADD_VALUES);
+
+    PYLITH_METHOD_END;
+} // computeLHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute LHS Jacobian for F(t,s,\dot{s}).
+void
+pylith::problems::SteadyState::computeLHSJacobian(PetscMat jacobianMat,
+                                                  PetscMat precondMat,
+                                                  const PylithReal dt,
+                                                  const PylithReal s_tshift,
+                                                  PetscVec solutionVec,
+                                                  PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeLHSJacobian(dt="<<dt<<", s_tshift="<<s_tshift<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<")");
+
+    assert(jacobianMat);
+    assert(precondMat);
+    assert(solutionVec);
+    assert(solutionDotVec);
+    assert(s_tshift > 0);
+    assert(_integrationData);
+
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, s_tshift);
+
+    // Zero LHS Jacobian
+    PetscErrorCode err = 0;
+    PetscDS dsSoln = NULL;
+    err = DMGetDS(solution->getDM(), &dsSoln);PYLITH_CHECK_ERROR(err);
+    PetscBool hasJacobian = PETSC_FALSE;
+    err = PetscDSHasJacobian(dsSoln, &hasJacobian);PYLITH_CHECK_ERROR(err);
+    if (hasJacobian) { err = MatZeroEntries(jacobianMat);PYLITH_CHECK_ERROR(err); }
+    err = MatZeroEntries(precondMat);PYLITH_CHECK_ERROR(err);
+
+    // Update PyLith view of the solution.
+    setSolutionLocal(solutionVec, solutionDotVec);
+
+    // Sum Jacobian contributions across integrators.
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, *_integrationData);
+    } // for
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, dt);
+
+    // Assemble matrices
+    if (jacobianMat != precondMat) {
+        err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);
+        err = MatAssemblyEnd(jacobianMat, MAT_FINAL_ASSEMBLY);
+    }
+    err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
+    err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobian
+
+
+// ------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for LHS, F(t,s,\dot{s}).
+PetscErrorCode
+pylith::problems::SteadyState::computeLHSResidual(PetscTS ts,
+                                                  PetscReal t,
+                                                  PetscVec solutionVec,
+                                                  PetscVec solutionDotVec,
+                                                  PetscVec residualVec,
+                                                  void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_SteadyState::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeLHSResidual(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    PetscReal dt = 0.0;
+    PetscErrorCode err = TSGetTimeStep(ts, &dt);PYLITH_CHECK_ERROR(err);
+    pylith::problems::SteadyState* problem = (pylith::problems::SteadyState*)context;
+    problem->computeLHSResidual(residualVec, dt, solutionVec, solutionDotVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeLHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Callback static method for computing Jacobian for LHS, Jacobian of F(t,s,\dot{s}).
+PetscErrorCode
+pylith::problems::SteadyState::computeLHSJacobian(PetscTS ts,
+                                                  PetscReal t,
+                                                  PetscVec solutionVec,
+                                                  PetscVec solutionDotVec,
+                                                  PetscReal s_tshift,
+                                                  PetscMat jacobianMat,
+                                                  PetscMat precondMat,
+                                                  void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_SteadyState::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeLHSJacobian(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", s_tshift="<<s_tshift<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", context="<<context<<")" << pythia::journal::endl;
+
+    PetscReal dt = 0.0;
+    PetscErrorCode err = TSGetTimeStep(ts, &dt);PYLITH_CHECK_ERROR(err);
+    pylith::problems::SteadyState* problem = (pylith::problems::SteadyState*)context;
+    problem->computeLHSJacobian(jacobianMat, precondMat, dt, s_tshift, solutionVec, solutionDotVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeLHSJacobian
+
+
+// ------------------------------------------------------------------------------------------------
+// Callback static method for operations after advancing solution one pseudo-time step.
+PetscErrorCode
+pylith::problems::SteadyState::poststep(PetscTS ts) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_SteadyState::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "poststep(ts="<<ts<<")" << pythia::journal::endl;
+
+    pylith::problems::SteadyState* problem = NULL;
+    PetscErrorCode err = TSGetApplicationContext(ts, (void*)&problem);PYLITH_CHECK_ERROR(err);assert(problem);
+    problem->poststep();
+
+    PYLITH_METHOD_RETURN(0);
+} // poststep
+
+
+// End of file
@@ -0,0 +1,193 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/SteadyState.hh
+ *
+ * @brief Object for steady-state problem solved with pseudo-transient continuation.
+ *
+ * Jumps directly to the steady-state solution (e.g., interseismic spin-up of earthquake-cycle
+ * models) by marching PETSc pseudo-time stepping (TSPSEUDO) against the same integrators as a
+ * quasistatic time-dependent problem, instead of time stepping many relaxation times.
+ */
+
+#if !defined(pylith_problems_steadystate_hh)
+#define pylith_problems_steadystate_hh
+
+#include "Problem.hh" // ISA Problem
+
+class pylith::problems::SteadyState : public pylith::problems::Problem {
+    friend class TestSteadyState; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    SteadyState(void);
+
+    /// Destructor
+    ~SteadyState(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set initial pseudo-time step.
+     *
+     * @param[in] value Initial pseudo-time step (seconds).
+     */
+    void setInitialTimeStep(const double value);
+
+    /** Get initial pseudo-time step.
+     *
+     * @returns Initial pseudo-time step (seconds).
+     */
+    double getInitialTimeStep(void) const;
+
+    /** Set maximum number of pseudo-time steps.
+     *
+     * @param[in] value Maximum number of pseudo-time steps.
+     */
+    void setMaxPseudoTimeSteps(const size_t value);
+
+    /** Get maximum number of pseudo-time steps.
+     *
+     * @returns Maximum number of pseudo-time steps.
+     */
+    size_t getMaxPseudoTimeSteps(void) const;
+
+    /** Set factor by which the pseudo-time step grows as the residual decreases.
+     *
+     * @param[in] value Pseudo-time step increment factor (> 1).
+     */
+    void setTimeStepIncrement(const double value);
+
+    /** Get Petsc DM for problem.
+     *
+     * @returns PETSc DM for problem.
+     */
+    PetscDM getPetscDM(void);
+
+    /// Verify configuration.
+    void verifyConfiguration(void) const;
+
+    /// Initialize.
+    void initialize(void);
+
+    /** Solve steady-state problem.
+     */
+    void solve(void);
+
+    /// Perform operations after advancing solution one pseudo-time step.
+    void poststep(void);
+
+    /** Set solution values according to constraints (Dirichlet BC).
+     *
+     * @param[in] solutionVec PETSc Vec with current global view of solution.
+     * @param[in] solutionDotVec PETSc Vec with current global view of time derivative of the solution.
+     */
+    void setSolutionLocal(PetscVec solutionVec,
+                          PetscVec solutionDotVec);
+
+    /** Compute LHS residual, F(t,s,\dot{s}) and assemble into global vector.
+     *
+     * @param[out] residualVec PETSc Vec for residual.
+     * @param[in] dt Current pseudo-time step.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] solutionDotVec PETSc Vec with time derivative of current trial solution.
+     */
+    void computeLHSResidual(PetscVec residualVec,
+                            const PetscReal dt,
+                            PetscVec solutionVec,
+                            PetscVec solutionDotVec);
+
+    /* Compute LHS Jacobian for F(t,s,\dot{s}).
+     *
+     * @param[out] jacobianMat PETSc Mat for Jacobian.
+     * @param[out] precondMat PETSc Mat for preconditioner for Jacobian.
+     * @param[in] dt Current pseudo-time step.
+     * @param[in] s_tshift Scale for time derivative.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] solutionDotVec PETSc Vec with time derivative of current trial solution.
+     */
+    void computeLHSJacobian(PetscMat jacobianMat,
+                            PetscMat precondMat,
+                            const PylithReal dt,
+                            const PylithReal s_tshift,
+                            PetscVec solutionVec,
+                            PetscVec solutionDotVec);
+
+    /** Callback static method for computing residual for LHS, F(t,s,\dot{s}).
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current pseudo time.
+     * @param[in] solutionVec PetscVec for solution.
+     * @param[in] solutionDotVec PetscVec for time derivative of solution.
+     * @param[out] residualvec PetscVec for residual.
+     * @param[in] context User context (SteadyState).
+     */
+    static
+    PetscErrorCode computeLHSResidual(PetscTS ts,
+                                      PetscReal t,
+                                      PetscVec solutionVec,
+                                      PetscVec solutionDotVec,
+                                      PetscVec residualVec,
+                                      void* context);
+
+    /* Callback static method for computing Jacobian for LHS, Jacobian of F(t,s,\dot{s}).
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current pseudo time.
+     * @param[in] solution PetscVec for solution.
+     * @param[out] jacobianMat Jacobian matrix.
+     * @param[out] precondMat Preconditioner matrix.
+     * @param[in] context User context (SteadyState).
+     */
+    static
+    PetscErrorCode computeLHSJacobian(PetscTS ts,
+                                      PetscReal t,
+                                      PetscVec solutionVec,
+                                      PetscVec solutionDotVec,
+                                      PetscReal s_tshift,
+                                      PetscMat jacobianMat,
+                                      PetscMat precondMat,
+                                      void* context);
+
+    /** Callback static method for operations after advancing solution one pseudo-time step.
+     */
+    static
+    PetscErrorCode poststep(PetscTS ts);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    double _dtInitial; ///< Initial pseudo-time step (seconds).
+    double _dtIncrement; ///< Factor by which pseudo-time step grows as residual decreases.
+    size_t _maxPseudoTimeSteps; ///< Maximum number of pseudo-time steps.
+    PetscTS _ts; ///< PETSc time stepper.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    SteadyState(const SteadyState&); ///< Not implemented
+    const SteadyState& operator=(const SteadyState&); ///< Not implemented
+
+}; // SteadyState
+
+#endif // pylith_problems_steadystate_hh
+
+// End of file
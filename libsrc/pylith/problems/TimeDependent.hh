@@ -27,6 +27,7 @@
 
 #include "Problem.hh" // ISA Problem
 #include "pylith/testing/testingfwd.hh" // USES MMSTest
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
 
 class pylith::problems::TimeDependent : public pylith::problems::Problem {
     friend class TestTimeDependent; // unit testing
@@ -92,6 +93,86 @@ public:
      */
     double getInitialTimeStep(void) const;
 
+    /** Enable adaptive time stepping.
+     *
+     * The time step is adapted from the relative rate of solution change, growing during
+     * quiescent periods and shrinking when the solution changes rapidly (e.g., coseismic slip).
+     *
+     * @param[in] value True if time step should be adapted.
+     */
+    void setAdaptiveTimeStep(const bool value);
+
+    /** Set minimum time step for adaptive time stepping.
+     *
+     * @param[in] value Minimum time step (seconds, 0 means no minimum).
+     */
+    void setMinTimeStep(const double value);
+
+    /** Set maximum time step for adaptive time stepping.
+     *
+     * @param[in] value Maximum time step (seconds, 0 means no maximum).
+     */
+    void setMaxTimeStep(const double value);
+
+    /** Set target relative change in the solution per time step for adaptive time stepping.
+     *
+     * @param[in] value Target relative change in solution per time step.
+     */
+    void setAdaptTolerance(const double value);
+
+    /** Set maximum factor by which the time step can grow in one step.
+     *
+     * @param[in] value Maximum growth factor (> 1).
+     */
+    void setAdaptGrowthFactor(const double value);
+
+    /** Enable relaxation fast-forward for adaptive time stepping.
+     *
+     * When all materials have linear bulk rheologies and the solution change is decaying
+     * geometrically (linear viscoelastic relaxation), the step may grow up to the relaxation
+     * time inferred from the decay in one jump instead of being limited by the growth factor.
+     * The linear Maxwell rheologies integrate the relaxation exponential exactly over a step,
+     * so large interseismic steps do not degrade the state-variable updates.
+     *
+     * @param[in] value True if step growth during relaxation is not limited per step.
+     */
+    void setRelaxationFastForward(const bool value);
+
+    /** Set lag in rebuilding the LHS Jacobian for nonlinear problems.
+     *
+     * A requested rebuild is deferred until the given number of rebuild requests have
+     * accumulated since the last rebuild, reusing the stale Jacobian as the Newton
+     * preconditioner at the cost of extra Newton iterations. A value of 1 rebuilds on every
+     * request (default). Ignored for linear problems, where a stale Jacobian would change
+     * the solution.
+     *
+     * @param[in] value Number of rebuild requests per rebuild (>= 1).
+     */
+    void setLHSJacobianLag(const int value);
+
+    /** Set allowed growth in linear iterations before rebuilding a frozen preconditioner.
+     *
+     * When enabled, the preconditioner setup is kept while the Jacobian is reassembled each
+     * step (e.g., dt-dependent viscoelastic Jacobians), so the Krylov operator stays current
+     * while the cost of PCSetUp (e.g., the multigrid hierarchy) amortizes over many steps.
+     * The preconditioner is rebuilt when the linear iterations for a step exceed the given
+     * factor times the count observed on the first step after the last rebuild. A value of 0
+     * disables freezing (default), rebuilding the preconditioner with every Jacobian.
+     *
+     * @param[in] value Allowed growth factor in linear iterations (> 1), or 0 to disable.
+     */
+    void setPrecondFreezeFactor(const double value);
+
+    /** Set order of extrapolation from solution history for nonlinear solver initial guess.
+     *
+     * Recent solutions are kept in a ring buffer and extrapolated in time to form the initial
+     * guess for the nonlinear solve of each time step, reducing Newton iterations. An order of
+     * 0 disables extrapolation and starts from the previous solution (default).
+     *
+     * @param[in] value Order of polynomial extrapolation (0-2).
+     */
+    void setInitialGuessOrder(const int value);
+
     /** Set initial conditions.
      *
      * @param[in] ic Array of initial conditions.
@@ -114,6 +195,130 @@ public:
      */
     void setProgressMonitor(pylith::problems::ProgressMonitorTime* monitor);
 
+    /** Set filename for HDF5 solver convergence telemetry.
+     *
+     * When set, the residual-norm contribution and wall time of each integrator are recorded
+     * for every LHS residual evaluation and written as an HDF5 time series at the end of the
+     * simulation, attributing slow nonlinear convergence to a specific material or fault.
+     *
+     * @param[in] filename Name of HDF5 telemetry file (empty string disables telemetry).
+     */
+    void setSolverTelemetryFilename(const char* filename);
+
+    /** Set filename for JSON performance profile.
+     *
+     * Enables hierarchical wall-clock profiling with per-integrator attribution
+     * (per-material, per-interface, per-boundary-condition); the profile is written
+     * with min/max/mean across ranks at the end of the simulation.
+     *
+     * @param[in] filename Name of JSON profile file (empty string disables profiling).
+     */
+    void setProfileFilename(const char* filename);
+
+    /** Set filename for checkpoints.
+     *
+     * @param[in] filename Name of HDF5 checkpoint file.
+     */
+    void setCheckpointFilename(const char* filename);
+
+    /** Set number of time steps between checkpoints.
+     *
+     * @param[in] value Number of time steps between checkpoints (0 disables checkpointing).
+     */
+    void setCheckpointInterval(const int value);
+
+    /** Set filename of checkpoint for restarting the simulation.
+     *
+     * @param[in] filename Name of HDF5 checkpoint file (empty string means no restart).
+     */
+    void setRestartFilename(const char* filename);
+
+    /** Set matrix-free application of the LHS Jacobian.
+     *
+     * If true, the LHS Jacobian action is applied directly from the Jf kernels via a PETSc
+     * shell matrix and only the preconditioning matrix is assembled.
+     *
+     * @param[in] value True if Jacobian should be applied matrix free.
+     */
+    void setMatrixFreeJacobian(const bool value);
+
+    /** Get matrix-free application of the LHS Jacobian.
+     *
+     * @returns True if Jacobian is applied matrix free.
+     */
+    bool getMatrixFreeJacobian(void) const;
+
+    /** Set use of fused explicit time-stepping fast path.
+     *
+     * If true and the formulation is dynamic with a fixed time step, the problem advances the
+     * solution with a fused forward Euler update (lumped-mass scaling and solution update in a
+     * single pass over rank-local data) instead of the generic PETSc TS stage machinery. The
+     * per-step fixed costs of the generic machinery dominate high-frequency wave runs with many
+     * small steps.
+     *
+     * @param[in] value True if explicit stepping should use the fused fast path.
+     */
+    void setExplicitFastPath(const bool value);
+
+    /** Get use of fused explicit time-stepping fast path.
+     *
+     * @returns True if explicit stepping uses the fused fast path.
+     */
+    bool getExplicitFastPath(void) const;
+
+    /** Set materials advanced with a smaller time step in the explicit fast path.
+     *
+     * Explicit stability is set by the smallest cell, which is usually confined to a few
+     * materials (e.g., refined regions near faults). The listed materials are advanced with
+     * the global time step divided by the subcycle factor, while the remaining materials are
+     * advanced with the global step; their coupling terms on the shared interface are frozen
+     * over the global step. Requires the explicit fast path.
+     *
+     * @param[in] values Array of label values for materials to subcycle.
+     * @param[in] numValues Number of label values.
+     */
+    void setSubcycleLabelValues(const int* values,
+                                const int numValues);
+
+    /** Set factor by which the time step is reduced for subcycled materials.
+     *
+     * @param[in] value Number of substeps per global time step (>= 1; 1 disables subcycling).
+     */
+    void setSubcycleFactor(const size_t value);
+
+    /** Set use of compact storage for the preconditioning matrix.
+     *
+     * The assembled matrix kept for preconditioning does not need the full general storage of
+     * the operator. When the LHS Jacobian is applied matrix free, the separate preconditioning
+     * matrix is stored in symmetric (upper triangle) format, halving its memory and the
+     * bandwidth consumed during smoothing. Requires a symmetric Jacobian.
+     *
+     * @param[in] value True if preconditioning matrix should use compact symmetric storage.
+     */
+    void setCompactPrecondStorage(const bool value);
+
+    /** Get use of compact storage for the preconditioning matrix.
+     *
+     * @returns True if preconditioning matrix uses compact symmetric storage.
+     */
+    bool getCompactPrecondStorage(void) const;
+
+    /** Set automatic recovery from solver failures.
+     *
+     * The solution and auxiliary fields (state variables) are snapshotted at each accepted
+     * time step; on a solver failure the state is rolled back, the time step is halved, and
+     * the step is retried with escalating solver robustness instead of aborting the run.
+     *
+     * @param[in] value True if solver failures should trigger rollback and retry.
+     */
+    void setSolverRecovery(const bool value);
+
+    /** Get automatic recovery from solver failures.
+     *
+     * @returns True if solver failures trigger rollback and retry.
+     */
+    bool getSolverRecovery(void) const;
+
     /** Get Petsc DM for problem.
      *
      * @returns PETSc DM for problem.
@@ -138,10 +343,101 @@ public:
     /// Initialize.
     void initialize(void);
 
+    /// Print forecast of per-step cost, memory use, and output volume for a dry run.
+    void printForecast(void);
+
     /** Solve time dependent problem.
      */
     void solve(void);
 
+    /** Snapshot initial solution and auxiliary fields for a parameter sweep.
+     *
+     * Must be called after initialize() and before the first call to runSweepMember().
+     */
+    void prepareSweep(void);
+
+    /** Run one parameter sweep member in-process.
+     *
+     * Restores the solution and auxiliary fields (including state variables) from the
+     * snapshot taken by prepareSweep(), scales the named auxiliary subfield of every
+     * integrator and constraint that has it by the given factor, rewinds the time stepper
+     * to the start time, and reruns the solve loop. The factor is applied to the snapshot
+     * values, so factors for successive members are absolute, not cumulative. The problem
+     * is not re-initialized and Python is not re-entered between members.
+     *
+     * @param[in] subfieldName Name of auxiliary subfield to scale.
+     * @param[in] factor Factor applied to the initial subfield values for this member.
+     */
+    void runSweepMember(const char* subfieldName,
+                        const PylithReal factor);
+
+    /** Run a parameter sweep in-process.
+     *
+     * Equivalent to prepareSweep() followed by runSweepMember() for each factor. Use
+     * runSweepMember() directly to harvest the solution between members.
+     *
+     * @param[in] subfieldName Name of auxiliary subfield to scale.
+     * @param[in] values Array of factors applied to the initial subfield values.
+     * @param[in] numValues Number of sweep members.
+     */
+    void runSweep(const char* subfieldName,
+                  const PylithScalar* values,
+                  const int numValues);
+
+    /** Run one segment of an earthquake cycle in-process.
+     *
+     * Rewinds the time stepper clock to the segment window and reruns the solve loop.
+     * Use transferStateFrom() to hand off the solution and material state from the
+     * previous segment before running. The problem is not re-initialized between
+     * segments.
+     *
+     * @param[in] tStart Start time of segment (seconds).
+     * @param[in] tEnd End time of segment (seconds).
+     */
+    void runSegment(const double tStart,
+                    const double tEnd);
+
+    /** Hand off solution and material state from another problem in memory.
+     *
+     * Copies the solution subfields present in both problems (e.g., displacement and the
+     * fault Lagrange multiplier) from the other problem's current solution, and copies the
+     * matching auxiliary subfields of paired integrators and constraints, so state variables
+     * updated by the previous segment (UpdateStateVars content) carry over at full precision.
+     * Both problems must be initialized over the same mesh with their integrators and
+     * constraints in the same order; subfields present in only one problem (e.g., velocity
+     * when entering a dynamic segment) and subfields with different discretizations keep
+     * their current values.
+     *
+     * @param[in] other Problem for the previous segment of the cycle.
+     */
+    void transferStateFrom(TimeDependent& other);
+
+    /** Estimate surface displacements at stations from an analytic half-space solution (3D only).
+     *
+     * Sums Okada (1985) point-source contributions for the prescribed slip of all
+     * FaultCohesiveKin interfaces at time t, treating each fault cell as a point
+     * dislocation in a homogeneous elastic half space with a free surface at z=0.
+     * Intended for screening candidate rupture models against the OutputSolnPoints
+     * station set in seconds instead of running the finite-element solve; the estimates
+     * ignore material heterogeneity, topography, and finite domain boundaries. The
+     * problem must be initialized. The result is complete on all processes.
+     *
+     * @param[out] displacements Array of station displacements [numStations * spaceDim].
+     * @param[in] numValues Size of displacements array.
+     * @param[in] stationCoords Array of nondimensional station coordinates [numStations * spaceDim].
+     * @param[in] numStations Number of stations.
+     * @param[in] spaceDim Spatial dimension for coordinates and displacements.
+     * @param[in] t Nondimensional time at which to evaluate slip.
+     * @param[in] poissonRatio Poisson's ratio for the half space.
+     */
+    void estimateSurfaceDisplacements(PylithScalar* displacements,
+                                      const int numValues,
+                                      const PylithReal* stationCoords,
+                                      const int numStations,
+                                      const int spaceDim,
+                                      const PylithReal t,
+                                      const PylithReal poissonRatio);
+
     /** Perform Perform operations after advancing solution one time step.
      *
      * Update state variables, output.
@@ -270,6 +566,29 @@ public:
     static
     PetscErrorCode poststep(PetscTS ts);
 
+    /** Callback static method for applying action of LHS Jacobian via shell matrix (matrix free).
+     *
+     * @param[in] jacobianMat PETSc shell Mat with TimeDependent as context.
+     * @param[in] vecIn PETSc Vec the Jacobian acts on.
+     * @param[out] vecOut PETSc Vec with Jacobian action.
+     */
+    static
+    PetscErrorCode applyLHSJacobianAction(PetscMat jacobianMat,
+                                          PetscVec vecIn,
+                                          PetscVec vecOut);
+
+    /** Callback static method for computing initial guess for nonlinear solve by extrapolating
+     * from solution history.
+     *
+     * @param[in] snes PETSc nonlinear solver.
+     * @param[out] initialGuessVec PETSc Vec to fill with initial guess.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeInitialGuess(PetscSNES snes,
+                                       PetscVec initialGuessVec,
+                                       void* context);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -280,6 +599,133 @@ private:
      */
     bool _needNewJacobian(const PylithReal dt);
 
+    /** Set whether the solver may reuse the preconditioner setup.
+     *
+     * Keeping the preconditioner while the Jacobian is unchanged skips PCSetUp each Newton
+     * iteration, preserving the fieldsplit/Schur setup (e.g., the pressure block preconditioner
+     * for incompressible elasticity) across iterations and time steps.
+     *
+     * @param[in] reuse True if preconditioner setup can be reused, false if it must be rebuilt.
+     */
+    void _setPreconditionerReuse(const bool reuse);
+
+    /// Update frozen-preconditioner policy from the linear iterations of the last time step.
+    void _updatePrecondFreeze(void);
+
+    /** Create LHS Jacobian matrix with exact preallocation from the cell closures.
+     *
+     * The default DM preallocation underestimates the coupling of the Lagrange multiplier
+     * degrees of freedom in the closures of the cohesive cells, so the first assembly on
+     * meshes with faults reallocates repeatedly. Inserting the closure coupling of every cell
+     * (including the cohesive cells) into a preallocator matrix gives the exact nonzero
+     * pattern, so the first fault-model assembly allocates once.
+     *
+     * @returns PETSc Mat for LHS Jacobian (caller takes ownership).
+     */
+    PetscMat _createCohesiveAwareJacobian(void);
+
+    /// Advance the solution with the fused explicit forward Euler fast path.
+    void _solveExplicitFastPath(void);
+
+    /** Advance the solution with the explicit fast path and material-block subcycling.
+     *
+     * Degrees of freedom supported on cells of the subcycled materials are advanced with
+     * the global step divided by the subcycle factor; only the subcycled materials are
+     * reassembled during substeps. Contributions from the remaining materials to shared
+     * interface degrees of freedom are frozen at their value at the start of the global
+     * step, and the remaining degrees of freedom take one forward Euler step with the
+     * full residual at the start of the global step.
+     */
+    void _solveExplicitFastPathSubcycle(void);
+
+    /** Compute RHS residual from a subset of the integrators.
+     *
+     * Mirrors computeRHSResidual() without the lumped Jacobian scaling (the explicit fast
+     * path fuses the scaling into the update).
+     *
+     * @param[out] residualVec PETSc Vec for residual.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] integrators Integrators contributing to the residual.
+     */
+    void _computeRHSResidualSubset(PetscVec residualVec,
+                                   const PylithReal t,
+                                   const PylithReal dt,
+                                   PetscVec solutionVec,
+                                   const std::vector<pylith::feassemble::Integrator*>& integrators);
+
+    /** Pre-tabulate prescribed fault slip for uniform time stepping.
+     *
+     * The explicit fast path takes uniform time steps, so the slip time functions of
+     * kinematic ruptures can be evaluated once at initialization and read from tables
+     * during stepping; see FaultCohesiveKin::tabulateSlipTimeSeries().
+     *
+     * @param[in] tStart Nondimensional time of first step.
+     * @param[in] dt Nondimensional time step.
+     * @param[in] numSteps Number of time steps.
+     */
+    void _tabulateFaultSlip(const PylithReal tStart,
+                            const PylithReal dt,
+                            const size_t numSteps);
+
+    /** Copy values of a subfield between global vectors of two fields over the same mesh.
+     *
+     * The values are copied only if the subfields have the same global size (same
+     * discretization); otherwise the target is left unchanged.
+     *
+     * @param[inout] targetVec Global vector receiving values.
+     * @param[in] targetDM PETSc DM of field holding target vector.
+     * @param[in] targetIndex Index of subfield in target field.
+     * @param[in] sourceVec Global vector providing values.
+     * @param[in] sourceDM PETSc DM of field holding source vector.
+     * @param[in] sourceIndex Index of subfield in source field.
+     */
+    static
+    void _copySubfieldValues(PetscVec targetVec,
+                             PetscDM targetDM,
+                             const int targetIndex,
+                             PetscVec sourceVec,
+                             PetscDM sourceDM,
+                             const int sourceIndex);
+
+    /** Copy matching auxiliary subfields from another problem's auxiliary field.
+     *
+     * @param[inout] target Auxiliary field receiving values (may be NULL).
+     * @param[in] source Auxiliary field providing values (may be NULL).
+     */
+    void _transferAuxiliaryField(pylith::topology::Field* target,
+                                 const pylith::topology::Field* source);
+
+    /// Advance the solution, rolling back and retrying on solver failures.
+    void _solveWithRecovery(void);
+
+    /// Snapshot solution and auxiliary fields (state variables) for rollback.
+    void _snapshotState(void);
+
+    /// Restore solution and auxiliary fields from snapshot after a solver failure.
+    void _restoreState(void);
+
+    /** Escalate solver robustness after a failed time step.
+     *
+     * @param[in] level Number of failed attempts for the current time step.
+     */
+    void _escalateSolverRobustness(const int level);
+
+    /** Accumulate LHS residual contribution for an integrator stepping on a cadence.
+     *
+     * On scheduled steps the contribution is recomputed and cached; in between the cached
+     * contribution is reused (operator splitting), so the integrator's physics is not
+     * reassembled at the resolution of integrators stepping every time step.
+     *
+     * @param[in] integrator Index of integrator.
+     * @param[in] tindex Current time step.
+     * @param[inout] residual Field accumulating residual contributions.
+     */
+    void _accumulateLaggedResidual(const size_t integrator,
+                                   const PetscInt tindex,
+                                   pylith::topology::Field* residual);
+
     /** Set state (auxiliary field values) of system for time t.
      *
      * @param[in] t Current time.
@@ -289,17 +735,93 @@ private:
     /// Notify observers with solution corresponding to initial conditions.
     void _notifyObserversInitialSoln(void);
 
+    /// Capture object state of auxiliary fields to detect changes in state variables.
+    void _captureAuxiliaryFieldStates(void);
+
+    /** Write checkpoint with solution, changed auxiliary fields, and time stepper clock.
+     *
+     * Auxiliary fields whose values match their initialized state (no state
+     * variables updated) are reconstructible from the simulation input and
+     * are excluded to keep the checkpoint small.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] tindex Current time step.
+     * @param[in] dt Current time step size (nondimensional).
+     */
+    void _writeCheckpoint(const PylithReal t,
+                          const PylithInt tindex,
+                          const PylithReal dt);
+
+    /// Restore solution, state variables, and time stepper clock from restart checkpoint.
+    void _readRestart(void);
+
+    /// Update time step from relative rate of solution change over the last step.
+    void _adaptTimeStep(void);
+
+    /** Push copy of current solution onto ring buffer of solution history.
+     *
+     * @param[in] t Current time (nondimensional).
+     */
+    void _updateSolutionHistory(const PylithReal t);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     double _startTime; ///< Starting time of problem (seconds).
     double _endTime; ///< Ending time of problem (seconds).
     double _dtInitial; ///< Initial time step (seconds).
+    double _dtMin; ///< Minimum time step for adaptive time stepping (seconds, 0 means no minimum).
+    double _dtMax; ///< Maximum time step for adaptive time stepping (seconds, 0 means no maximum).
+    double _adaptTolerance; ///< Target relative change in solution per time step.
+    double _adaptGrowthFactor; ///< Maximum factor by which time step can grow in one step.
+    double _adaptPrevRelChange; ///< Relative solution change over the step before last (0 if unknown).
     size_t _maxTimeSteps; ///< Maximum number of time steps for problem.
+    int _jacobianLag; ///< Number of LHS Jacobian rebuild requests per rebuild (1 rebuilds on every request).
+    int _jacobianRebuildsDeferred; ///< Number of LHS Jacobian rebuild requests deferred since last rebuild.
+    double _precondFreezeFactor; ///< Allowed growth in linear iterations before rebuilding a frozen preconditioner (0 disables freezing).
+    PylithInt _precondFreezeBaseline; ///< Linear iterations per step right after last preconditioner rebuild (-1 if not yet measured).
+    PylithInt _precondFreezeTotalIterations; ///< Cumulative linear iterations at last policy update.
+    bool _precondRebuildPending; ///< True if frozen preconditioner must be rebuilt with the next Jacobian.
+    int _initialGuessOrder; ///< Order of extrapolation from solution history for nonlinear solver initial guess (0 disables).
+    std::vector<PetscVec> _solutionHistory; ///< Ring buffer of recent solutions for extrapolated initial guess.
+    std::vector<PylithReal> _solutionHistoryTimes; ///< Times (nondimensional) of solutions in ring buffer.
     PetscTS _ts; ///< PETSc time stepper.
     std::vector<pylith::problems::InitialCondition*> _ic; ///< Array of initial conditions.
     pylith::problems::ProgressMonitorTime* _monitor; ///< Monitor for simulation progress.
-
+    pylith::problems::SolverTelemetry* _telemetry; ///< Solver convergence telemetry (NULL if disabled).
+    pylith::utils::EventLogger* _stepLogger; ///< Events marking the state-update and output phases of a time step.
+
+    std::string _telemetryFilename; ///< Name of HDF5 solver telemetry file (empty means disabled).
+    std::string _profileFilename; ///< Name of JSON performance profile file (empty means disabled).
+    std::string _checkpointFilename; ///< Name of HDF5 checkpoint file.
+    std::string _restartFilename; ///< Name of HDF5 checkpoint file for restart (empty means no restart).
+    int _checkpointInterval; ///< Number of time steps between checkpoints (0 disables checkpointing).
+    PylithInt _checkpointStepWrote; ///< Step when checkpoint was previously written.
+    std::vector<PetscObjectState> _auxiliaryFieldStates; ///< Object state of auxiliary fields after initialization.
+
+    PetscMat _jacobianShellMat; ///< PETSc shell matrix for matrix-free LHS Jacobian (NULL if not used).
+    PetscVec _solutionAdaptPrev; ///< Solution at previous time step for adaptive time stepping (NULL if not used).
+    std::vector<PetscVec> _laggedResidualVecs; ///< Cached residual contributions for integrators with step cadence > 1.
+    PetscVec _laggedResidualScratchVec; ///< Scratch vector for extracting per-integrator residual contributions.
+    PetscVec _recoverySolutionVec; ///< Snapshot of solution at last accepted step (NULL if not used).
+    std::vector<PetscVec> _recoveryAuxiliaryVecs; ///< Snapshots of integrator auxiliary fields at last accepted step.
+    PetscVec _sweepSolutionVec; ///< Snapshot of initial solution for parameter sweeps (NULL if not used).
+    std::vector<PetscVec> _sweepAuxiliaryVecs; ///< Snapshots of initial integrator and constraint auxiliary fields for parameter sweeps.
+    PylithReal _recoveryTime; ///< Time of rollback snapshot (nondimensional).
+    PylithInt _recoveryStep; ///< Time step index of rollback snapshot.
+    PylithReal _tLocalSolution; ///< Time for which local view of solution was last updated.
+    PetscObjectState _solutionVecState; ///< State of global solution Vec at last local update.
+    PetscObjectState _solutionDotVecState; ///< State of global solution time derivative Vec at last local update.
+    bool _useMatrixFreeJacobian; ///< True if LHS Jacobian action is applied matrix free.
+    bool _useExplicitFastPath; ///< True if explicit stepping uses the fused fast path.
+    size_t _subcycleFactor; ///< Number of substeps per global time step for subcycled materials (1 disables subcycling).
+    std::vector<int> _subcycleLabelValues; ///< Label values of materials advanced with the subcycled time step.
+    bool _useCompactPrecondStorage; ///< True if preconditioning matrix uses compact symmetric storage.
+    bool _useSolverRecovery; ///< True if solver failures trigger rollback and retry.
+    bool _explicitFastPathActive; ///< True while the fused fast path is advancing the solution.
+    bool _useAdaptiveTimeStep; ///< True if time step is adapted from rate of solution change.
+    bool _useRelaxationFastForward; ///< True if step growth during linear viscoelastic relaxation is not limited per step.
+    bool _materialsAllLinear; ///< True if all materials have linear bulk rheologies.
     bool _needNewLHSJacobian; ///< True if need to recompute LHS Jacobian.
     bool _haveNewLHSJacobian; ///< True if LHS Jacobian was reformed.
     bool _shouldNotifyIC;
@@ -32,22 +32,29 @@ namespace pylith {
         class Problem;
         class TimeDependent;
         class GreensFns;
+        class SteadyState;
 
         class SolutionFactory;
         class ObserversSoln;
         class ObserverSoln;
+        class ObserverSolnAnalysis;
+        class SolnAnalyzer;
 
         class Physics;
         class ObserversPhysics;
         class ObserverPhysics;
 
         class InitialCondition;
+        class InitialConditionCheckpoint;
         class InitialConditionDomain;
         class InitialConditionPatch;
 
         class ProgressMonitor;
         class ProgressMonitorTime;
         class ProgressMonitorStep;
+        class ProgressMonitorBinary;
+
+        class SolverTelemetry;
 
     } // problems
 } // pylith
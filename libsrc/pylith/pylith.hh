@@ -0,0 +1,95 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/pylith/pylith.hh
+ *
+ * @brief C++ embedding interface to libpylith.
+ *
+ * This header collects the classes supported for driving PyLith simulations directly from
+ * C++ without the Python/Pyre layer, for example from an external orchestration code that
+ * runs many solves in one process. The classes included here follow the same deprecation
+ * policy as the Python interface; headers not included here are internal and may change
+ * without notice.
+ *
+ * The setup mirrors what the Python application does and what the MMS tests in
+ * tests/mmstests do:
+ *
+ * 1. Initialize PETSc (PetscInitialize()); the embedding application owns the PETSc
+ *    lifecycle.
+ * 2. Read the mesh with a pylith::meshio::MeshIO implementation into a
+ *    pylith::topology::Mesh, set the coordinate system, and nondimensionalize it with
+ *    pylith::topology::MeshOps::nondimensionalize().
+ * 3. Construct the materials (e.g., pylith::materials::Elasticity with a
+ *    pylith::materials::IsotropicLinearElasticity bulk rheology), boundary conditions
+ *    (e.g., pylith::bc::DirichletTimeDependent), and faults
+ *    (e.g., pylith::faults::FaultCohesiveKin), attaching spatial databases for the
+ *    auxiliary fields.
+ * 4. Construct a pylith::problems::TimeDependent problem; set the normalizer, materials,
+ *    boundary conditions, interfaces, time-stepping parameters, and formulation.
+ * 5. Build the solution field with pylith::problems::SolutionFactory and pass it to the
+ *    problem with setSolution().
+ * 6. Call preinitialize(mesh), verifyConfiguration(), initialize(), and solve(). For
+ *    in-process ensembles, use prepareSweep()/runSweepMember() instead of repeating
+ *    initialization.
+ *
+ * Solver defaults normally applied by the Python layer are available through
+ * pylith::utils::PetscDefaults::set().
+ */
+
+#if !defined(pylith_pylith_hh)
+#define pylith_pylith_hh
+
+#include "pylith/topology/Mesh.hh"
+#include "pylith/topology/MeshOps.hh"
+#include "pylith/topology/Field.hh"
+
+#include "pylith/meshio/MeshIOAscii.hh"
+#include "pylith/meshio/MeshIOCubit.hh"
+#include "pylith/meshio/MeshIOPetsc.hh"
+#include "pylith/meshio/DataWriterMemory.hh"
+
+#include "pylith/problems/TimeDependent.hh"
+#include "pylith/problems/GreensFns.hh"
+#include "pylith/problems/SteadyState.hh"
+#include "pylith/problems/SolutionFactory.hh"
+#include "pylith/problems/InitialConditionDomain.hh"
+#include "pylith/problems/InitialConditionPatch.hh"
+
+#include "pylith/materials/Elasticity.hh"
+#include "pylith/materials/IncompressibleElasticity.hh"
+#include "pylith/materials/IsotropicLinearElasticity.hh"
+#include "pylith/materials/IsotropicLinearMaxwell.hh"
+#include "pylith/materials/IsotropicLinearGenMaxwell.hh"
+#include "pylith/materials/IsotropicPowerLaw.hh"
+
+#include "pylith/bc/DirichletTimeDependent.hh"
+#include "pylith/bc/NeumannTimeDependent.hh"
+#include "pylith/bc/AbsorbingDampers.hh"
+
+#include "pylith/faults/FaultCohesiveKin.hh"
+#include "pylith/faults/FaultCohesiveImpulses.hh"
+#include "pylith/faults/KinSrcStep.hh"
+#include "pylith/faults/KinSrcRamp.hh"
+#include "pylith/faults/KinSrcConstRate.hh"
+
+#include "pylith/utils/PetscOptions.hh"
+
+#endif // pylith_pylith_hh
+
+// End of file
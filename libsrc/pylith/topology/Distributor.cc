@@ -21,12 +21,14 @@
 #include "Distributor.hh" // implementation of class methods
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::isCohesiveCell()
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
 #include "pylith/meshio/DataWriter.hh" // USES DataWriter
+#include "pylith/utils/CommLogger.hh" // USES CommLogger
 #include "pylith/utils/journals.hh" // pythia::journal
 
 #include <cstring> // USES strlen()
@@ -34,6 +36,8 @@
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
+#include <map> // USES std::map
+#include <vector> // USES std::vector
 
 // ------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -59,7 +63,25 @@ public:
                                              pylith::faults::FaultCohesive* faults[],
                                              const int numFaults);
 
+            /** Configure the partitioner for a mesh, using per-cell weights if present.
+             *
+             * If the mesh has the cell weight label, partition the cell graph with the requested
+             * partitioner using the weights and hand the result to DMPlexDistribute() through a
+             * shell partitioner; otherwise just select the requested partitioner.
+             *
+             * @param[inout] dmMesh PETSc DM for the mesh to be distributed.
+             * @param[in] partitionerName Name of PETSc partitioner to use in distributing mesh.
+             *
+             * @returns PETSc error code (0==success).
+             */
+            static
+            PetscErrorCode setupPartitioner(PetscDM dmMesh,
+                                            const char* partitionerName);
+
+            static const char* cellWeightLabelName; ///< Name of label with per-cell partition weights.
+
         }; // _Distributor
+        const char* _Distributor::cellWeightLabelName = "pylith-partition-weight";
     } // topology
 } // pylith
 
@@ -82,6 +104,7 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
                                           const int numFaults,
                                           const char* partitionerName) {
     PYLITH_METHOD_BEGIN;
+    pylith::utils::CommLogger::Scope commScope("distribute");
     pythia::journal::info_t info("mesh_distributor");
 
     assert(newMesh);
@@ -97,16 +120,43 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
     PetscPartitioner partitioner = 0;
     PetscDM dmOrig = origMesh.getDM();assert(dmOrig);
     err = DMPlexGetPartitioner(dmOrig, &partitioner);PYLITH_CHECK_ERROR(err);
-    err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+
+    PetscMPIInt commSize = 0;
+    err = MPI_Comm_size(origMesh.getComm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmTmp = NULL, dmNew = NULL;
+    const PetscInt overlap = 0;
+
+    // A parallel partitioner allows a two-stage distribution: a cheap initial chunking of the
+    // serially-loaded mesh onto all processes followed by a quality parallel partition, so that no
+    // single process needs the memory to partition the entire mesh.
+    const bool useTwoStage = (commSize > 1) && (0 == strcasecmp(partitionerName, "parmetis"));
+    if (useTwoStage) {
+        if (0 == commRank) {
+            info << pythia::journal::at(__HERE__)
+                 << "Distributing mesh in two stages (cheap chunking, then parallel repartition)." << pythia::journal::endl;
+        } // if
+        err = PetscPartitionerSetType(partitioner, PETSCPARTITIONERSIMPLE);PYLITH_CHECK_ERROR(err);
+        PetscDM dmChunked = NULL;
+        err = DMPlexDistribute(dmOrig, overlap, NULL, &dmChunked);PYLITH_CHECK_ERROR(err);
+        if (dmChunked) {
+            err = _Distributor::setupPartitioner(dmChunked, partitionerName);PYLITH_CHECK_ERROR(err);
+            err = DMPlexDistribute(dmChunked, overlap, NULL, &dmTmp);PYLITH_CHECK_ERROR(err);
+            if (dmTmp) {
+                err = DMDestroy(&dmChunked);PYLITH_CHECK_ERROR(err);
+            } else {
+                dmTmp = dmChunked;dmChunked = NULL;
+            } // if/else
+        } // if
+    } else {
+        err = _Distributor::setupPartitioner(dmOrig, partitionerName);PYLITH_CHECK_ERROR(err);
+        err = DMPlexDistribute(dmOrig, overlap, NULL, &dmTmp);PYLITH_CHECK_ERROR(err);
+    } // if/else
 
     if (0 == commRank) {
         info << pythia::journal::at(__HERE__)
              << "Distributing partitioned mesh." << pythia::journal::endl;
     } // if
-
-    PetscDM dmTmp = NULL, dmNew = NULL;
-    const PetscInt overlap = 0;
-    err = DMPlexDistribute(origMesh.getDM(), overlap, NULL, &dmTmp);PYLITH_CHECK_ERROR(err);
     err = _Distributor::distributeOverlap(&dmNew, dmTmp, faults, numFaults);PYLITH_CHECK_ERROR(err);
     err = DMDestroy(&dmTmp);PYLITH_CHECK_ERROR(err);
     err = DMPlexDistributeSetDefault(dmNew, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
@@ -118,6 +168,60 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
 } // distribute
 
 
+// ------------------------------------------------------------------------------------------------
+// Set per-cell weights used in partitioning the mesh.
+void
+pylith::topology::Distributor::setCellWeights(pylith::topology::Mesh* const mesh,
+                                              const int* materialValues,
+                                              const int numMaterialValues,
+                                              const int* materialWeights,
+                                              const int numMaterialWeights,
+                                              const int cohesiveCellWeight) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    if (numMaterialValues != numMaterialWeights) {
+        std::ostringstream msg;
+        msg << "Number of material label values (" << numMaterialValues << ") must match number of material weights ("
+            << numMaterialWeights << ") in setting cell weights for partitioning mesh.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    std::map<int, int> weightForMaterial;
+    for (int i = 0; i < numMaterialValues; ++i) {
+        weightForMaterial[materialValues[i]] = materialWeights[i];
+    } // for
+
+    PetscDM dmMesh = mesh->getDM();assert(dmMesh);
+    PetscErrorCode err = 0;
+    PetscDMLabel weightLabel = NULL;
+    err = DMCreateLabel(dmMesh, _Distributor::cellWeightLabelName);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dmMesh, _Distributor::cellWeightLabelName, &weightLabel);PYLITH_CHECK_ERROR(err);
+    PetscDMLabel materialLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &materialLabel);PYLITH_CHECK_ERROR(err);
+
+    topology::Stratum cellsStratum(dmMesh, pylith::topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt weight = 1;
+        if (pylith::topology::MeshOps::isCohesiveCell(dmMesh, cell)) {
+            weight = (cohesiveCellWeight > 0) ? cohesiveCellWeight : 1;
+        } else if (materialLabel) {
+            PetscInt materialValue = -1;
+            err = DMLabelGetValue(materialLabel, cell, &materialValue);PYLITH_CHECK_ERROR(err);
+            const std::map<int, int>::const_iterator iter = weightForMaterial.find(materialValue);
+            if ((iter != weightForMaterial.end()) && (iter->second > 0)) {
+                weight = iter->second;
+            } // if
+        } // if/else
+        err = DMLabelSetValue(weightLabel, cell, weight);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setCellWeights
+
+
 // ------------------------------------------------------------------------------------------------
 // Write partitioning info for distributed mesh.
 void
@@ -162,6 +266,40 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
     const PetscInt cStart = cellsStratum.begin();
     const PetscInt cEnd = cellsStratum.end();
 
+    // Report per-process statistics for number of cells and estimated assembly cost (per-cell
+    // partition weights if present, otherwise cell count) so that users can verify balance.
+    PetscErrorCode err = 0;
+    PetscDMLabel weightLabel = NULL;
+    err = DMGetLabel(dmMesh, _Distributor::cellWeightLabelName, &weightLabel);PYLITH_CHECK_ERROR(err);
+    PylithInt costLocal = 0;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt weight = 1;
+        if (weightLabel) {
+            err = DMLabelGetValue(weightLabel, cell, &weight);PYLITH_CHECK_ERROR(err);
+            if (weight < 1) { weight = 1; }
+        } // if
+        costLocal += weight;
+    } // for
+    PylithInt statsLocal[2] = { cEnd - cStart, costLocal };
+    PylithInt statsMin[2], statsMax[2], statsSum[2];
+    MPI_Allreduce(statsLocal, statsMin, 2, MPIU_INT, MPI_MIN, mesh.getComm());
+    MPI_Allreduce(statsLocal, statsMax, 2, MPIU_INT, MPI_MAX, mesh.getComm());
+    MPI_Allreduce(statsLocal, statsSum, 2, MPIU_INT, MPI_SUM, mesh.getComm());
+    PetscMPIInt commSize = 0;
+    MPI_Comm_size(mesh.getComm(), &commSize);
+    if (pylith::utils::MPI::isRoot()) {
+        const PylithReal cellsAvg = PylithReal(statsSum[0]) / commSize;
+        const PylithReal costAvg = PylithReal(statsSum[1]) / commSize;
+        pythia::journal::info_t info("mesh_distributor");
+        info << pythia::journal::at(__HERE__)
+             << "Partition statistics over " << commSize << " processes:\n"
+             << "  Cells per process: min=" << statsMin[0] << ", max=" << statsMax[0] << ", avg=" << cellsAvg
+             << ", imbalance=" << ((cellsAvg > 0) ? statsMax[0] / cellsAvg : 1.0) << "\n"
+             << "  Estimated assembly cost per process: min=" << statsMin[1] << ", max=" << statsMax[1]
+             << ", avg=" << costAvg << ", imbalance=" << ((costAvg > 0) ? statsMax[1] / costAvg : 1.0)
+             << pythia::journal::endl;
+    } // if
+
     VecVisitorMesh partitionVisitor(partitionField);
     PetscScalar* partitionArray = partitionVisitor.localArray();
     for (PetscInt point = cStart; point < cEnd; ++point) {
@@ -280,4 +418,83 @@ pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
 } // distributeOverlap
 
 
+// ------------------------------------------------------------------------------------------------
+// Configure the partitioner for a mesh, using per-cell weights if present.
+PetscErrorCode
+pylith::topology::_Distributor::setupPartitioner(PetscDM dmMesh,
+                                                 const char* partitionerName) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscPartitioner partitioner = NULL;
+    err = DMPlexGetPartitioner(dmMesh, &partitioner);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel weightLabel = NULL;
+    err = DMGetLabel(dmMesh, cellWeightLabelName, &weightLabel);PYLITH_CHECK_ERROR(err);
+    if (!weightLabel) {
+        err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_RETURN(0);
+    } // if
+
+    // Partition the cell graph with the requested partitioner using the per-cell weights and hand
+    // the resulting partition to DMPlexDistribute() through a shell partitioner.
+    MPI_Comm comm;
+    PetscMPIInt numParts;
+    PetscCall(PetscObjectGetComm((PetscObject)dmMesh, &comm));
+    PetscCallMPI(MPI_Comm_size(comm, &numParts));
+
+    PetscInt numVertices = 0;
+    PetscInt* start = NULL;
+    PetscInt* adjacency = NULL;
+    PetscIS globalNumbering = NULL;
+    PetscCall(DMPlexCreatePartitionerGraph(dmMesh, 0, &numVertices, &start, &adjacency, &globalNumbering));
+
+    // Graph vertices correspond to the locally owned cells in chart order.
+    PetscSection vertexSection = NULL;
+    PetscCall(PetscSectionCreate(comm, &vertexSection));
+    PetscCall(PetscSectionSetChart(vertexSection, 0, numVertices));
+    PetscInt cStart = 0, cEnd = 0;
+    PetscCall(DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd));
+    const PetscInt* globalIndices = NULL;
+    PetscCall(ISGetIndices(globalNumbering, &globalIndices));
+    for (PetscInt cell = cStart, vertex = 0; cell < cEnd; ++cell) {
+        if (globalIndices[cell-cStart] < 0) { continue;} // cell not owned by this process
+        PetscInt weight = 1;
+        PetscCall(DMLabelGetValue(weightLabel, cell, &weight));
+        PetscCall(PetscSectionSetDof(vertexSection, vertex++, (weight > 0) ? weight : 1));
+    } // for
+    PetscCall(ISRestoreIndices(globalNumbering, &globalIndices));
+    PetscCall(PetscSectionSetUp(vertexSection));
+
+    PetscPartitioner graphPartitioner = NULL;
+    PetscCall(PetscPartitionerCreate(comm, &graphPartitioner));
+    PetscCall(PetscPartitionerSetType(graphPartitioner, partitionerName));
+    PetscSection partSection = NULL;
+    PetscCall(PetscSectionCreate(comm, &partSection));
+    PetscIS partition = NULL;
+    PetscCall(PetscPartitionerPartition(graphPartitioner, numParts, numVertices, start, adjacency,
+                                        vertexSection, NULL, NULL, partSection, &partition));
+
+    std::vector<PetscInt> partSizes(numParts, 0);
+    for (PetscInt part = 0; part < numParts; ++part) {
+        PetscCall(PetscSectionGetDof(partSection, part, &partSizes[part]));
+    } // for
+    const PetscInt* partPoints = NULL;
+    PetscCall(ISGetIndices(partition, &partPoints));
+    PetscCall(PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL));
+    PetscCall(PetscPartitionerShellSetPartition(partitioner, numParts, &partSizes[0], partPoints));
+    PetscCall(ISRestoreIndices(partition, &partPoints));
+
+    PetscCall(ISDestroy(&partition));
+    PetscCall(PetscSectionDestroy(&partSection));
+    PetscCall(PetscSectionDestroy(&vertexSection));
+    PetscCall(PetscPartitionerDestroy(&graphPartitioner));
+    PetscCall(ISDestroy(&globalNumbering));
+    PetscCall(PetscFree(start));
+    PetscCall(PetscFree(adjacency));
+
+    PYLITH_METHOD_RETURN(0);
+} // setupPartitioner
+
+
 // End of file
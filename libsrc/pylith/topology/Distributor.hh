@@ -60,6 +60,28 @@ public:
                     const int numFaults,
                     const char* partitionerName);
 
+    /** Set per-cell weights used in partitioning the mesh.
+     *
+     * Weights bias the partition so that processes are assigned similar total assembly cost rather
+     * than similar numbers of cells. Weights are relative integer costs per cell; cells of
+     * materials with expensive bulk rheologies and cohesive cells cost more to assemble than cells
+     * of linear elastic materials.
+     *
+     * @param[inout] mesh Mesh to be distributed.
+     * @param[in] materialValues Array of values of label marking materials.
+     * @param[in] numMaterialValues Number of material label values.
+     * @param[in] materialWeights Array of weights (cost per cell) for each material.
+     * @param[in] numMaterialWeights Number of material weights.
+     * @param[in] cohesiveCellWeight Weight (cost per cell) for cohesive cells.
+     */
+    static
+    void setCellWeights(pylith::topology::Mesh* const mesh,
+                        const int* materialValues,
+                        const int numMaterialValues,
+                        const int* materialWeights,
+                        const int numMaterialWeights,
+                        const int cohesiveCellWeight);
+
     /** Write partitioning info for distributed mesh.
      *
      * @param writer Data writer for partition information.
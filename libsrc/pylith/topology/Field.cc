@@ -32,11 +32,13 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/CommLogger.hh" // USES CommLogger
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 
 #include <cassert> // USES assert()
 #include <iostream> // USES std::cout
 #include <iomanip> // USES std::setw()
+#include <sstream> // USES std::ostringstream
 
 namespace pylith {
     namespace topology {
@@ -67,14 +69,20 @@ public:
 // Default constructor.
 pylith::topology::Field::Field(const pylith::topology::Mesh& mesh) :
     _mesh(NULL),
+    _layoutMeshId(0),
     _localVec(NULL),
     _globalVec(NULL),
-    _outputVec(NULL) {
+    _outputVec(NULL),
+    _localArrayView(NULL),
+    _localVecStateOutput(-1) {
     PYLITH_METHOD_BEGIN;
 
     GenericComponent::setName("field");
     _label = "unknown";
     _mesh = mesh.clone();assert(_mesh);
+    if (mesh.getDM()) {
+        PetscErrorCode err = PetscObjectGetId((PetscObject) mesh.getDM(), &_layoutMeshId);PYLITH_CHECK_ERROR(err);
+    } // if
 
     PYLITH_METHOD_END;
 } // constructor
@@ -84,9 +92,12 @@ pylith::topology::Field::Field(const pylith::topology::Mesh& mesh) :
 // Constructor with field to use for layout.
 pylith::topology::Field::Field(const Field& src) :
     _mesh(NULL),
+    _layoutMeshId(src._layoutMeshId),
     _localVec(NULL),
     _globalVec(NULL),
-    _outputVec(NULL) {
+    _outputVec(NULL),
+    _localArrayView(NULL),
+    _localVecStateOutput(-1) {
     PYLITH_METHOD_BEGIN;
 
     _subfields = src._subfields;
@@ -124,6 +135,10 @@ pylith::topology::Field::deallocate(void) {
     delete _mesh;_mesh = NULL;
 
     PetscErrorCode err;
+    if (_localArrayView && _localVec) { // View never restored; release it before destroying the vector.
+        err = VecRestoreArrayRead(_localVec, &_localArrayView);PYLITH_CHECK_ERROR(err);
+        _localArrayView = NULL;
+    } // if
     err = VecDestroy(&_localVec);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_outputVec);PYLITH_CHECK_ERROR(err);
@@ -218,6 +233,52 @@ pylith::topology::Field::getLocalVector(void) const {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Get read-only view of values in local vector.
+void
+pylith::topology::Field::getLocalArrayView(const PylithScalar** valuesView,
+                                           PylithInt* size) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(valuesView);
+    assert(size);
+    if (_localArrayView) {
+        std::ostringstream msg;
+        msg << "View of local vector for field '" << _label << "' is already checked out.";
+        throw std::logic_error(msg.str());
+    } // if
+    assert(_localVec);
+
+    PetscErrorCode err = VecGetArrayRead(_localVec, &_localArrayView);PYLITH_CHECK_ERROR(err);
+    PylithInt vecSize = 0;
+    err = VecGetLocalSize(_localVec, &vecSize);PYLITH_CHECK_ERROR(err);
+    *valuesView = _localArrayView;
+    *size = vecSize;
+
+    PYLITH_METHOD_END;
+} // getLocalArrayView
+
+
+// ------------------------------------------------------------------------------------------------
+// Restore view of values in local vector from getLocalArrayView().
+void
+pylith::topology::Field::restoreLocalArrayView(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_localArrayView) {
+        std::ostringstream msg;
+        msg << "No view of local vector for field '" << _label << "' to restore.";
+        throw std::logic_error(msg.str());
+    } // if
+    assert(_localVec);
+
+    PetscErrorCode err = VecRestoreArrayRead(_localVec, &_localArrayView);PYLITH_CHECK_ERROR(err);
+    _localArrayView = NULL;
+
+    PYLITH_METHOD_END;
+} // restoreLocalArrayView
+
+
 // ------------------------------------------------------------------------------------------------
 // Get global vector.
 PetscVec
@@ -308,9 +369,23 @@ pylith::topology::Field::allocate(void) {
      */
 
     const PetscDM dm = _mesh->getDM();assert(dm);
+
+    // If a field with an identical layout has been created before, share its section layout
+    // instead of rebuilding the layout from the discretization. Field layouts are immutable once
+    // set up (constraints are added to the section before allocate()), so same-layout fields
+    // reference one shared section rather than each holding a copy.
+    const std::string& layoutKey = _layoutCacheKey();
+    PetscSection layoutTemplate = FieldOps::getLayoutTemplate(layoutKey.c_str());
+    if (layoutTemplate) {
+        err = DMSetLocalSection(dm, layoutTemplate);PYLITH_CHECK_ERROR(err);
+    } // if
+
     err = DMGetSection(dm, &s);PYLITH_CHECK_ERROR(err);assert(s); // Creates local section
     err = DMSetGlobalSection(dm, NULL);PYLITH_CHECK_ERROR(err); // Creates global section
     err = PetscSectionSetUp(s);PYLITH_CHECK_ERROR(err);
+    if (!layoutTemplate) {
+        FieldOps::storeLayoutTemplate(layoutKey.c_str(), s);
+    } // if
 
     err = VecDestroy(&_localVec);PYLITH_CHECK_ERROR(err);
     err = DMCreateLocalVector(dm, &_localVec);PYLITH_CHECK_ERROR(err);
@@ -321,6 +396,38 @@ pylith::topology::Field::allocate(void) {
 } // allocate
 
 
+// ------------------------------------------------------------------------------------------------
+// Get key identifying mesh and discretization signature of field layout.
+std::string
+pylith::topology::Field::_layoutCacheKey(void) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+
+    std::ostringstream key;
+    key << _layoutMeshId;
+
+    // Boundary conditions alter the constrained degrees of freedom in the layout, so fields with
+    // different numbers of boundary conditions must not share layout templates.
+    PetscDS ds = NULL;
+    PetscInt numBoundary = 0;
+    PetscErrorCode err = DMGetDS(_mesh->getDM(), &ds);PYLITH_CHECK_ERROR(err);
+    if (ds) {
+        err = PetscDSGetNumBoundary(ds, &numBoundary);PYLITH_CHECK_ERROR(err);
+    } // if
+    key << ";bc=" << numBoundary;
+
+    for (subfields_type::const_iterator s_iter = _subfields.begin(); s_iter != _subfields.end(); ++s_iter) {
+        const SubfieldInfo& sinfo = s_iter->second;
+        key << ";" << s_iter->first << ":" << sinfo.index << ":" << sinfo.description.numComponents
+            << ":" << sinfo.fe.basisOrder << ":" << sinfo.fe.quadOrder << ":" << sinfo.fe.dimension
+            << ":" << sinfo.fe.cellBasis << ":" << sinfo.fe.feSpace << ":" << sinfo.fe.isBasisContinuous
+            << ":" << sinfo.fe.isFaultOnly;
+    } // for
+
+    PYLITH_METHOD_RETURN(key.str());
+} // _layoutCacheKey
+
+
 // ------------------------------------------------------------------------------------------------
 // Zero local vector values (including constrained DOF).
 void
@@ -334,6 +441,40 @@ pylith::topology::Field::zeroLocal(void) {
 } // zeroLocal
 
 
+// ------------------------------------------------------------------------------------------------
+// Scale values of a subfield in place.
+void
+pylith::topology::Field::scaleSubfield(const char* name,
+                                       const PylithReal factor) {
+    PYLITH_METHOD_BEGIN;
+
+    const PetscInt i_subfield = getSubfieldInfo(name).index;
+
+    assert(_mesh);
+    PetscSection section = NULL;
+    PetscErrorCode err = DMGetLocalSection(_mesh->getDM(), &section);PYLITH_CHECK_ERROR(err);assert(section);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    assert(_localVec);
+    PetscScalar* localArray = NULL;
+    err = VecGetArray(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0;
+        err = PetscSectionGetFieldDof(section, point, i_subfield, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; }
+        PetscInt offset = 0;
+        err = PetscSectionGetFieldOffset(section, point, i_subfield, &offset);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < dof; ++i) {
+            localArray[offset+i] *= factor;
+        } // for
+    } // for
+    err = VecRestoreArray(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scaleSubfield
+
+
 // ------------------------------------------------------------------------------------------------
 // Print field to standard out.
 void
@@ -406,7 +547,10 @@ pylith::topology::Field::scatterLocalToVector(const PetscVec vector,
     assert(_mesh);
     assert(vector);
 
+    pylith::utils::CommLogger::Scope commScope("scatter_local_to_vector");
+
     PetscErrorCode err;
+
     assert(_localVec);
     err = DMLocalToGlobalBegin(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
     err = DMLocalToGlobalEnd(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
@@ -415,6 +559,42 @@ pylith::topology::Field::scatterLocalToVector(const PetscVec vector,
 } // scatterLocalToVector
 
 
+// ------------------------------------------------------------------------------------------------
+// Begin scattering section information across processors to update the
+// PETSc vector view of the field.
+void
+pylith::topology::Field::scatterLocalToVectorBegin(const PetscVec vector,
+                                                   InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+    pylith::utils::CommLogger::Scope commScope("scatter_local_to_vector_begin");
+
+    assert(_localVec);
+    PetscErrorCode err = DMLocalToGlobalBegin(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterLocalToVectorBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// Complete scattering section information across processors to update the
+// PETSc vector view of the field.
+void
+pylith::topology::Field::scatterLocalToVectorEnd(const PetscVec vector,
+                                                 InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+    pylith::utils::CommLogger::Scope commScope("scatter_local_to_vector_end");
+
+    assert(_localVec);
+    PetscErrorCode err = DMLocalToGlobalEnd(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterLocalToVectorEnd
+
+
 // ------------------------------------------------------------------------------------------------
 // Scatter PETSc vector information across processors to update the
 // section view of the field.
@@ -425,7 +605,10 @@ pylith::topology::Field::scatterVectorToLocal(const PetscVec vector,
     assert(_mesh);
     assert(vector);
 
+    pylith::utils::CommLogger::Scope commScope("scatter_vector_to_local");
+
     PetscErrorCode err;
+
     assert(_localVec);
     err = DMGlobalToLocalBegin(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
     err = DMGlobalToLocalEnd(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
@@ -434,6 +617,42 @@ pylith::topology::Field::scatterVectorToLocal(const PetscVec vector,
 } // scatterVectorToLocal
 
 
+// ------------------------------------------------------------------------------------------------
+// Begin scattering PETSc vector information across processors to update the
+// section view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalBegin(const PetscVec vector,
+                                                   InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+    pylith::utils::CommLogger::Scope commScope("scatter_vector_to_local_begin");
+
+    assert(_localVec);
+    PetscErrorCode err = DMGlobalToLocalBegin(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// Complete scattering PETSc vector information across processors to update the
+// section view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalEnd(const PetscVec vector,
+                                                 InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+    pylith::utils::CommLogger::Scope commScope("scatter_vector_to_local_end");
+
+    assert(_localVec);
+    PetscErrorCode err = DMGlobalToLocalEnd(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalEnd
+
+
 // ------------------------------------------------------------------------------------------------
 // Scatter section information across processors to update the
 // output view of the field.
@@ -441,14 +660,25 @@ void
 pylith::topology::Field::scatterLocalToOutput(InsertMode mode) const {
     PYLITH_METHOD_BEGIN;
     assert(_mesh);
+    pylith::utils::CommLogger::Scope commScope("scatter_local_to_output");
 
     PetscErrorCode err;
     PetscDM dmOutput = NULL;
     err = DMGetOutputDM(_mesh->getDM(), &dmOutput);PYLITH_CHECK_ERROR(err);
     if (dmOutput) {
         assert(_localVec);
+
+        // Several observers may output the same field at a time step; skip the scatter if the
+        // local vector is unchanged since the output view was last updated.
+        PetscObjectState localVecState = 0;
+        err = PetscObjectStateGet((PetscObject)_localVec, &localVecState);PYLITH_CHECK_ERROR(err);
+        if ((INSERT_VALUES == mode) && (localVecState == _localVecStateOutput)) {
+            PYLITH_METHOD_END;
+        } // if
+
         err = DMLocalToGlobalBegin(dmOutput, _localVec, mode, _outputVec);PYLITH_CHECK_ERROR(err);
         err = DMLocalToGlobalEnd(dmOutput, _localVec, mode, _outputVec);PYLITH_CHECK_ERROR(err);
+        _localVecStateOutput = (INSERT_VALUES == mode) ? localVecState : -1;
     } // if
 
     PYLITH_METHOD_END;
@@ -625,6 +855,70 @@ pylith::topology::Field::getSubfieldInfo(const char* name) const {
 } // subfieldInfo
 
 
+// ------------------------------------------------------------------------------------------------
+// Mark subfield as having updated values.
+void
+pylith::topology::Field::markSubfieldDirty(const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    getSubfieldInfo(name); // Verify subfield exists.
+    _dirtySubfields.insert(name);
+
+    PYLITH_METHOD_END;
+} // markSubfieldDirty
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether subfield has been marked dirty since the marks were last cleared.
+bool
+pylith::topology::Field::isSubfieldDirty(const char* name) const {
+    PYLITH_METHOD_BEGIN;
+
+    PYLITH_METHOD_RETURN(_dirtySubfields.end() != _dirtySubfields.find(name));
+} // isSubfieldDirty
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether any subfield has been marked dirty since the marks were last cleared.
+bool
+pylith::topology::Field::hasDirtySubfields(void) const {
+    return !_dirtySubfields.empty();
+} // hasDirtySubfields
+
+
+// ------------------------------------------------------------------------------------------------
+// Clear dirty marks for subfields.
+void
+pylith::topology::Field::clearDirtySubfields(void) {
+    _dirtySubfields.clear();
+} // clearDirtySubfields
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute rigid body modes (translations and rotations) for a subfield.
+PetscMatNullSpace
+pylith::topology::Field::computeRigidBodyModes(const char* subfieldName) const {
+    PYLITH_METHOD_BEGIN;
+    assert(subfieldName);
+
+    const SubfieldInfo& info = getSubfieldInfo(subfieldName);
+    const size_t spaceDim = getSpaceDim();
+    if (info.description.numComponents != spaceDim) {
+        std::ostringstream msg;
+        msg << "Subfield '" << subfieldName << "' in field '" << getLabel() << "' has "
+            << info.description.numComponents << " component(s); rigid body modes require a vector subfield with "
+            << spaceDim << " components.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // The translation and rotation modes are built from the mesh coordinates held by the DM.
+    PetscMatNullSpace nullSpace = NULL;
+    PetscErrorCode err = DMPlexCreateRigidBody(getDM(), info.index, &nullSpace);PYLITH_CHECK_ERROR(err);assert(nullSpace);
+
+    PYLITH_METHOD_RETURN(nullSpace);
+} // computeRigidBodyModes
+
+
 // ------------------------------------------------------------------------------------------------
 // Create global vector.
 void
@@ -657,6 +951,7 @@ pylith::topology::Field::createOutputVector(void) {
 
     err = DMCreateGlobalVector(dmOutput, &_outputVec);PYLITH_CHECK_ERROR(err);assert(_outputVec);
     err = PetscObjectSetName((PetscObject) _outputVec, getLabel());PYLITH_CHECK_ERROR(err);
+    _localVecStateOutput = -1; // New output vector; force scatter on next output.
 
     PYLITH_METHOD_END;
 }
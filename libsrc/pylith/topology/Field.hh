@@ -33,6 +33,7 @@
 #include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
 
 #include <map> // USES std::map
+#include <set> // HASA std::set
 #include <string> // USES std::string
 
 /** @brief Vector field over the vertices or cells of a finite-element
@@ -142,6 +143,21 @@ public:
      */
     PetscVec getLocalVector(void) const;
 
+    /** Get read-only view of values in local PETSc Vec.
+     *
+     * The view borrows the array of the local vector without copying the values. It remains
+     * valid until restoreLocalArrayView() is called; each call must be paired with a call to
+     * restoreLocalArrayView() before the field is modified.
+     *
+     * @param[out] valuesView Read-only pointer to values in local vector.
+     * @param[out] size Number of values in local vector.
+     */
+    void getLocalArrayView(const PylithScalar** valuesView,
+                           PylithInt* size);
+
+    /// Restore view of values in local PETSc Vec from getLocalArrayView().
+    void restoreLocalArrayView(void);
+
     /** Get the global PETSc Vec.
      *
      * @returns PETSc Vec object.
@@ -186,6 +202,18 @@ public:
     /// Zero local values (including constrained values).
     void zeroLocal(void);
 
+    /** Scale values of a subfield in place.
+     *
+     * Multiplies the values of the named subfield in the local vector by the given factor,
+     * leaving the other subfields unchanged. Useful for parameter sweeps that vary a single
+     * auxiliary parameter without re-querying the spatial databases.
+     *
+     * @param[in] name Name of subfield.
+     * @param[in] factor Factor to multiply subfield values by.
+     */
+    void scaleSubfield(const char* name,
+                       const PylithReal factor);
+
     /** Add subfield to current field (for use from SWIG).
      *
      * Should be followed by calls to subfieldsSetup() and allocate().
@@ -222,6 +250,11 @@ public:
      *
      * Should be followed by calls to subfieldsSetup() and allocate().
      *
+     * The index assigned to a subfield matches the order in which subfields are added. For
+     * auxiliary fields, the index is part of the contract with the pointwise kernels, which
+     * address auxiliary subfields by position (for example, numA-1 for the last subfield), so
+     * the order in which subfields are added must match the order assumed by the kernels.
+     *
      * @param[in] description Description for subfield.
      * @param[in] discretization Discretization information for subfield.
      */
@@ -257,6 +290,43 @@ public:
      */
     const SubfieldInfo& getSubfieldInfo(const char* name) const;
 
+    /** Mark subfield as having updated values.
+     *
+     * Components updating a time-dependent subfield in place (e.g., time history amplitude, fault
+     * slip) record which subfield they touched so consumers can skip work that depends only on
+     * subfields that have not changed.
+     *
+     * @param[in] name Name of subfield.
+     */
+    void markSubfieldDirty(const char* name);
+
+    /** Check whether subfield has been marked dirty since the marks were last cleared.
+     *
+     * @param[in] name Name of subfield.
+     * @returns True if subfield has been marked dirty.
+     */
+    bool isSubfieldDirty(const char* name) const;
+
+    /** Check whether any subfield has been marked dirty since the marks were last cleared.
+     *
+     * @returns True if any subfield has been marked dirty.
+     */
+    bool hasDirtySubfields(void) const;
+
+    /// Clear dirty marks for subfields.
+    void clearDirtySubfields(void);
+
+    /** Compute rigid body modes (translations and rotations) for a subfield.
+     *
+     * Generates the near-null-space vectors for a vector subfield (e.g., displacement) from the
+     * mesh coordinates. Attaching the modes to the system matrix is essential for good algebraic
+     * multigrid convergence on 3D elasticity problems.
+     *
+     * @param[in] subfieldName Name of vector subfield.
+     * @returns PETSc null space with rigid body modes (caller responsible for destroying).
+     */
+    PetscMatNullSpace computeRigidBodyModes(const char* subfieldName) const;
+
     /** Display field.
      *
      * @param[in] label Label for output.
@@ -274,6 +344,27 @@ public:
     void scatterLocalToVector(const PetscVec vector,
                               InsertMode mode=INSERT_VALUES) const;
 
+    /** Begin scattering section information across processors to update the
+     * global view of the field.
+     *
+     * Split-phase version of scatterLocalToVector() allowing communication to overlap with
+     * computation; must be matched with a call to scatterLocalToVectorEnd().
+     *
+     * @param[out] vector PETSc vector to update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterLocalToVectorBegin(const PetscVec vector,
+                                   InsertMode mode=INSERT_VALUES) const;
+
+    /** Complete scattering section information across processors to update the
+     * global view of the field.
+     *
+     * @param[out] vector PETSc vector to update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterLocalToVectorEnd(const PetscVec vector,
+                                 InsertMode mode=INSERT_VALUES) const;
+
     /** Scatter global information across processors to update the local
      * view of the field.
      *
@@ -283,6 +374,27 @@ public:
     void scatterVectorToLocal(const PetscVec vector,
                               InsertMode mode=INSERT_VALUES) const;
 
+    /** Begin scattering global information across processors to update the local
+     * view of the field.
+     *
+     * Split-phase version of scatterVectorToLocal() allowing communication to overlap with
+     * computation; must be matched with a call to scatterVectorToLocalEnd().
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalBegin(const PetscVec vector,
+                                   InsertMode mode=INSERT_VALUES) const;
+
+    /** Complete scattering global information across processors to update the local
+     * view of the field.
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalEnd(const PetscVec vector,
+                                 InsertMode mode=INSERT_VALUES) const;
+
     /** Scatter section information across processors to update the
      * output view of the field.
      *
@@ -296,6 +408,18 @@ public:
     /// Create global vector with no constrained degrees of freedom for output.
     void createOutputVector(void);
 
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get key identifying mesh and discretization signature of field layout.
+     *
+     * Fields with the same key have identical local section layouts, so the layout of the first
+     * field created can be used as a template for the others.
+     *
+     * @returns Key for field layout.
+     */
+    std::string _layoutCacheKey(void) const;
+
     // PRIVATE TYPEDEFS ///////////////////////////////////////////////////////////////////////////
 private:
 
@@ -305,12 +429,16 @@ private:
 private:
 
     subfields_type _subfields; ///< Map of subfields in field.
+    std::set<std::string> _dirtySubfields; ///< Subfields with updated values since marks were last cleared.
     std::string _label; ///< Label for field.
 
     pylith::topology::Mesh* _mesh; ///< Mesh associated with field.
+    PetscObjectId _layoutMeshId; ///< Id of PETSc DM of mesh used to create field (for layout cache key).
     PetscVec _localVec; ///< Local PETSc vector.
     PetscVec _globalVec; ///< Global PETSc vector.
     PetscVec _outputVec; ///< Global PETSc vector without constrained DOF for output.
+    const PylithScalar* _localArrayView; ///< Borrowed array of local vector from getLocalArrayView().
+    mutable PetscObjectState _localVecStateOutput; ///< Object state of local vector at last output scatter.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
@@ -0,0 +1,336 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "FieldDB.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/geocoords/Converter.hh" // USES Converter
+
+#include "petscdmplex.h" // USES DMInterpolation, DMPlexGetScale()
+
+#include <algorithm> // USES std::max()
+#include <cassert> // USES assert()
+#include <cstring> // USES strcasecmp()
+#include <map> // USES std::map
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+namespace pylith {
+    namespace topology {
+        namespace _FieldDB {
+            /// Location with exact comparison for matching gathered interpolation results.
+            struct Location {
+                double x[3];
+
+                bool operator<(const Location& rhs) const {
+                    for (int i = 0; i < 3; ++i) {
+                        if (x[i] < rhs.x[i]) { return true; }
+                        if (x[i] > rhs.x[i]) { return false; }
+                    } // for
+                    return false;
+                } // operator<
+
+            }; // Location
+        } // _FieldDB
+    } // topology
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::topology::FieldDB::FieldDB(void) :
+    _field(NULL),
+    _lengthScale(1.0) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::topology::FieldDB::~FieldDB(void) {
+    _field = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Set field with values for database.
+void
+pylith::topology::FieldDB::setField(const pylith::topology::Field* field) {
+    _field = field;
+} // setField
+
+
+// ------------------------------------------------------------------------------------------------
+// Open the database and prepare for querying.
+void
+pylith::topology::FieldDB::open(void) {
+    if (!_field) {
+        std::ostringstream msg;
+        msg << "No field given for field spatial database '" << getDescription() << "'.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    // Values are the components of the non-fault subfields in subfield order, matching the
+    // ordering of the values interpolated within the cells of the mesh.
+    _names.clear();
+    _scales.clear();
+    const pylith::string_vector& subfieldNames = _field->getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = _field->getSubfieldInfo(subfieldNames[i].c_str());
+        if (info.fe.isFaultOnly) { continue; }
+        const size_t numComponents = info.description.numComponents;
+        for (size_t iComponent = 0; iComponent < numComponents; ++iComponent) {
+            _names.push_back(info.description.componentNames[iComponent]);
+            _scales.push_back(info.description.scale);
+        } // for
+    } // for
+
+    PetscReal lengthScale = 1.0;
+    PetscErrorCode err = DMPlexGetScale(_field->getDM(), PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+    _lengthScale = lengthScale;
+
+    // Default query returns all values in the order given.
+    const size_t numValues = _names.size();
+    _queryIndices.resize(numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+        _queryIndices[i] = i;
+    } // for
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close the database.
+void
+pylith::topology::FieldDB::close(void) {
+    _queryIndices.clear();
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Get names of values in spatial database.
+void
+pylith::topology::FieldDB::getNamesDBValues(const char*** valueNames,
+                                            size_t* numValues) const {
+    const size_t size = _names.size();
+    const char** names = (size > 0) ? new const char*[size] : NULL;
+    for (size_t i = 0; i < size; ++i) {
+        names[i] = _names[i].c_str();
+    } // for
+
+    if (valueNames) { *valueNames = names; }
+    if (numValues) { *numValues = size; }
+} // getNamesDBValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values to be returned by queries.
+void
+pylith::topology::FieldDB::setQueryValues(const char* const* names,
+                                          const size_t numVals) {
+    assert(names && numVals > 0);
+
+    const size_t numValues = _names.size();
+    _queryIndices.resize(numVals);
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        size_t iName = 0;
+        for (; iName < numValues; ++iName) {
+            if (0 == strcasecmp(names[iVal], _names[iName].c_str())) {
+                _queryIndices[iVal] = iName;
+                break;
+            } // if
+        } // for
+        if (iName == numValues) {
+            std::ostringstream msg;
+            msg << "Could not find value '" << names[iVal] << "' in field spatial database '"
+                << getDescription() << "'. Available values are:";
+            for (size_t i = 0; i < numValues; ++i) {
+                msg << "\n  " << _names[i];
+            } // for
+            msg << "\n";
+            throw std::out_of_range(msg.str());
+        } // if
+    } // for
+} // setQueryValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database at a single location; not supported.
+int
+pylith::topology::FieldDB::query(double* vals,
+                                 const size_t numVals,
+                                 const double* coords,
+                                 const size_t numDims,
+                                 const spatialdata::geocoords::CoordSys* csQuery) {
+    std::ostringstream msg;
+    msg << "Field spatial database '" << getDescription() << "' supports only batched queries, "
+        << "because queries are collective on the communicator of the mesh of the field.";
+    throw std::logic_error(msg.str());
+} // query
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database at multiple locations; collective on the mesh communicator.
+void
+pylith::topology::FieldDB::queryMulti(double* vals,
+                                      const size_t numVals,
+                                      const double* coords,
+                                      const size_t numLocs,
+                                      const size_t numDims,
+                                      const spatialdata::geocoords::CoordSys* csQuery) {
+    assert(_field);
+    assert((coords && numLocs > 0) || (0 == numLocs));
+    if (numVals != _queryIndices.size()) {
+        std::ostringstream msg;
+        msg << "Number of values to be returned by queries of field spatial database '"
+            << getDescription() << "' (" << _queryIndices.size() << ") does not match size of array provided ("
+            << numVals << ").";
+        throw std::invalid_argument(msg.str());
+    } // if
+
+    // Convert coordinates to the coordinate system of the mesh in a single call and
+    // nondimensionalize to match the mesh coordinates.
+    std::vector<double> coordsNDim(coords, coords + numLocs*numDims);
+    const spatialdata::geocoords::CoordSys* csMesh = _field->getMesh().getCoordSys();assert(csMesh);
+    if (numLocs > 0) {
+        assert(csQuery);
+        spatialdata::geocoords::Converter::convert(&coordsNDim[0], numLocs, numDims, csMesh, csQuery);
+        assert(_lengthScale > 0);
+        for (size_t i = 0; i < numLocs*numDims; ++i) {
+            coordsNDim[i] /= _lengthScale;
+        } // for
+    } // if
+
+    // Gather the locations from all processes; each process interpolates within the cells it
+    // owns, so every process must see every location.
+    MPI_Comm comm = _field->getMesh().getComm();
+    int commSize = 0;
+    PetscErrorCode err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+    std::vector<int> counts(commSize, 0);
+    std::vector<int> offsets(commSize, 0);
+    const int countLocal = int(numLocs*numDims);
+    err = MPI_Allgather((void*)&countLocal, 1, MPI_INT, &counts[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+    size_t totalCoords = 0;
+    for (int i = 0; i < commSize; ++i) {
+        offsets[i] = int(totalCoords);
+        totalCoords += counts[i];
+    } // for
+    const size_t totalLocs = totalCoords / numDims;
+    std::vector<double> coordsAll(std::max(totalCoords, size_t(1)));
+    err = MPI_Allgatherv((numLocs > 0) ? &coordsNDim[0] : NULL, countLocal, MPI_DOUBLE,
+                         &coordsAll[0], &counts[0], &offsets[0], MPI_DOUBLE, comm);PYLITH_CHECK_ERROR(err);
+
+    // Interpolate the field at the locations within the local cells.
+    const size_t numDof = _names.size();
+    DMInterpolationInfo interpolator = NULL;
+    err = DMInterpolationCreate(comm, &interpolator);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDim(interpolator, numDims);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationAddPoints(interpolator, totalLocs, &coordsAll[0]);PYLITH_CHECK_ERROR(err);
+    const PetscBool pointsAllProcs = PETSC_TRUE;
+    const PetscBool ignoreOutsideDomain = PETSC_TRUE;
+    err = DMInterpolationSetUp(interpolator, _field->getDM(), pointsAllProcs, ignoreOutsideDomain);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDof(interpolator, numDof);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt numFound = interpolator->n;
+    PetscVec foundValuesVec = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, numFound*numDof, &foundValuesVec);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationEvaluate(interpolator, _field->getDM(), _field->getLocalVector(),
+                                  foundValuesVec);PYLITH_CHECK_ERROR(err);
+
+    // Gather the (location, values) pairs found on each process, so each process can answer
+    // its own locations regardless of which process owns the containing cell.
+    const size_t entrySize = 3 + numDof;
+    std::vector<double> entriesLocal(std::max(size_t(numFound)*entrySize, size_t(1)));
+    const PetscScalar* foundCoords = NULL;
+    const PetscScalar* foundValues = NULL;
+    err = VecGetArrayRead(interpolator->coords, &foundCoords);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(foundValuesVec, &foundValues);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iFound = 0; iFound < numFound; ++iFound) {
+        for (size_t i = 0; i < 3; ++i) {
+            entriesLocal[iFound*entrySize+i] = (i < numDims) ? PetscRealPart(foundCoords[iFound*numDims+i]) : 0.0;
+        } // for
+        for (size_t i = 0; i < numDof; ++i) {
+            entriesLocal[iFound*entrySize+3+i] = PetscRealPart(foundValues[iFound*numDof+i]);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(foundValuesVec, &foundValues);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(interpolator->coords, &foundCoords);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&foundValuesVec);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationDestroy(&interpolator);PYLITH_CHECK_ERROR(err);
+
+    const int entriesCountLocal = int(numFound*entrySize);
+    err = MPI_Allgather((void*)&entriesCountLocal, 1, MPI_INT, &counts[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+    size_t totalEntries = 0;
+    for (int i = 0; i < commSize; ++i) {
+        offsets[i] = int(totalEntries);
+        totalEntries += counts[i];
+    } // for
+    std::vector<double> entriesAll(std::max(totalEntries, size_t(1)));
+    err = MPI_Allgatherv(&entriesLocal[0], entriesCountLocal, MPI_DOUBLE,
+                         &entriesAll[0], &counts[0], &offsets[0], MPI_DOUBLE, comm);PYLITH_CHECK_ERROR(err);
+
+    // Gathered locations are exact copies of the locations passed in, so matching uses exact
+    // comparison; locations in cells on process boundaries found twice simply overwrite.
+    std::map<_FieldDB::Location, size_t> foundLocations;
+    const size_t numEntries = totalEntries / entrySize;
+    for (size_t iEntry = 0; iEntry < numEntries; ++iEntry) {
+        _FieldDB::Location location;
+        for (size_t i = 0; i < 3; ++i) {
+            location.x[i] = entriesAll[iEntry*entrySize+i];
+        } // for
+        foundLocations[location] = iEntry;
+    } // for
+
+    size_t numNotFound = 0;
+    std::ostringstream notFoundMsg;
+    for (size_t iLoc = 0; iLoc < numLocs; ++iLoc) {
+        _FieldDB::Location location;
+        for (size_t i = 0; i < 3; ++i) {
+            location.x[i] = (i < numDims) ? coordsNDim[iLoc*numDims+i] : 0.0;
+        } // for
+        const std::map<_FieldDB::Location, size_t>::const_iterator iter = foundLocations.find(location);
+        if (iter == foundLocations.end()) {
+            if (++numNotFound <= 5) {
+                notFoundMsg << "\n  (";
+                for (size_t i = 0; i < numDims; ++i) {
+                    notFoundMsg << "  " << location.x[i] * _lengthScale;
+                } // for
+                notFoundMsg << ")";
+            } // if
+            continue;
+        } // if
+        const double* values = &entriesAll[iter->second*entrySize+3];
+        for (size_t iVal = 0; iVal < numVals; ++iVal) {
+            const size_t index = _queryIndices[iVal];
+            vals[iLoc*numVals+iVal] = values[index] * _scales[index];
+        } // for
+    } // for
+    if (numNotFound > 0) {
+        std::ostringstream msg;
+        msg << "Could not find values for " << numNotFound << " location(s) outside the mesh of the field in "
+            << "field spatial database '" << getDescription() << "'. First locations:" << notFoundMsg.str();
+        throw std::runtime_error(msg.str());
+    } // if
+} // queryMulti
+
+
+// End of file
@@ -0,0 +1,135 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/topology/FieldDB.hh
+ *
+ * @brief Spatial database presenting the values of a finite-element field, so fields on one
+ * mesh can be queried at arbitrary locations (e.g., transferred to another mesh). Values are
+ * the components of the non-fault subfields in subfield order; locations are interpolated
+ * within the cells of the field's mesh.
+ *
+ * Queries are collective on the mesh communicator, because locations may lie in cells owned
+ * by other processes; only the batched queryMulti() interface is supported, and it must be
+ * called on all processes of the mesh communicator (with possibly zero locations).
+ */
+
+#if !defined(pylith_topology_fielddb_hh)
+#define pylith_topology_fielddb_hh
+
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/array.hh" // HASA string_vector
+#include "pylith/utils/MultiQueryDB.hh" // ISA MultiQueryDB
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // ISA SpatialDB
+
+#include <vector> // HASA std::vector
+
+class pylith::topology::FieldDB : public spatialdata::spatialdb::SpatialDB, public pylith::utils::MultiQueryDB {
+    friend class TestFieldDB; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    FieldDB(void);
+
+    /// Destructor.
+    ~FieldDB(void);
+
+    /** Set field with values for database.
+     *
+     * @param[in] field Finite-element field with values for database.
+     */
+    void setField(const pylith::topology::Field* field);
+
+    /// Open the database and prepare for querying.
+    void open(void);
+
+    /// Close the database.
+    void close(void);
+
+    /** Get names of values in spatial database.
+     *
+     * @param[out] valueNames Array of names of values.
+     * @param[out] numValues Size of array.
+     */
+    void getNamesDBValues(const char*** valueNames,
+                          size_t* numValues) const;
+
+    /** Set values to be returned by queries.
+     *
+     * @pre Must call open() before setQueryValues().
+     *
+     * @param[in] names Names of values to be returned in queries.
+     * @param[in] numVals Number of values to be returned in queries.
+     */
+    void setQueryValues(const char* const* names,
+                        const size_t numVals);
+
+    /** Query the database at a single location; not supported.
+     *
+     * Queries are collective on the mesh communicator, so only queryMulti() is supported.
+     */
+    int query(double* vals,
+              const size_t numVals,
+              const double* coords,
+              const size_t numDims,
+              const spatialdata::geocoords::CoordSys* csQuery);
+
+    /** Query the database at multiple locations; collective on the mesh communicator.
+     *
+     * The values at each location are interpolated within the cell of the field's mesh
+     * containing the location, which may be owned by another process.
+     *
+     * @pre Must call open() before queryMulti().
+     *
+     * @param[out] vals Values at the locations [numLocs*numVals].
+     * @param[in] numVals Number of values to be returned per location.
+     * @param[in] coords Coordinates of the locations [numLocs*numDims].
+     * @param[in] numLocs Number of locations.
+     * @param[in] numDims Number of dimensions for coordinates.
+     * @param[in] csQuery Coordinate system of coordinates.
+     */
+    void queryMulti(double* vals,
+                    const size_t numVals,
+                    const double* coords,
+                    const size_t numLocs,
+                    const size_t numDims,
+                    const spatialdata::geocoords::CoordSys* csQuery);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    const pylith::topology::Field* _field; ///< Field with values for database.
+    pylith::string_vector _names; ///< Names of values in database (subfield components).
+    std::vector<double> _scales; ///< Scales of values to convert to SI units.
+    std::vector<size_t> _queryIndices; ///< Indices of values to be returned in queries.
+    double _lengthScale; ///< Length scale for nondimensionalizing query locations.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    FieldDB(const FieldDB&); ///< Not implemented.
+    const FieldDB& operator=(const FieldDB&); ///< Not implemented.
+
+}; // class FieldDB
+
+#endif // pylith_topology_fielddb_hh
+
+// End of file
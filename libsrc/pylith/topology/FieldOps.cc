@@ -26,19 +26,58 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/VisitorSubmesh.hh" // USES VecVisitorSubmesh
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 
 #include "petscdm.h" // USES PetscDM
+#include "petscvec.h" // USES PetscVec
+
+#include <cmath> // USES sqrt()
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::copy()
 
 std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE> pylith::topology::FieldOps::feStore = std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE>();
+std::map<std::string, PetscSection> pylith::topology::FieldOps::layoutStore = std::map<std::string, PetscSection>();
+bool pylith::topology::FieldOps::deterministicReductions = false;
 
 void
 pylith::topology::FieldOps::deallocate(void) {
     pylith::topology::FieldOps::feStore.clear();
+    for (std::map<std::string, PetscSection>::iterator iter = layoutStore.begin(); iter != layoutStore.end(); ++iter) {
+        PetscErrorCode err = PetscSectionDestroy(&iter->second);PYLITH_CHECK_ERROR_NOTHROW(err);
+    } // for
+    pylith::topology::FieldOps::layoutStore.clear();
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Get layout template matching key.
+PetscSection
+pylith::topology::FieldOps::getLayoutTemplate(const char* key) {
+    const std::map<std::string, PetscSection>::const_iterator iter = layoutStore.find(key);
+    return (iter != layoutStore.end()) ? iter->second : NULL;
+} // getLayoutTemplate
+
+
+// ------------------------------------------------------------------------------------------------
+// Store local section as layout template.
+void
+pylith::topology::FieldOps::storeLayoutTemplate(const char* key,
+                                                PetscSection section) {
+    PYLITH_METHOD_BEGIN;
+    assert(section);
+
+    if (0 == layoutStore.count(key)) {
+        PetscSection sectionCopy = NULL;
+        PetscErrorCode err = PetscSectionClone(section, &sectionCopy);PYLITH_CHECK_ERROR(err);
+        layoutStore[key] = sectionCopy;
+    } // if
+
+    PYLITH_METHOD_END;
+} // storeLayoutTemplate
+
+
 // ------------------------------------------------------------------------------------------------
 // Create PetscFE object for discretization.
 PetscFE
@@ -122,9 +161,28 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         assert(feKey.feSpace == FieldBase::POLYNOMIAL_SPACE);
         pylith::topology::FieldOps::feStore.insert(std::pair<FieldBase::Discretization, pylith::topology::FE>(feKey, fe));
     } else {
-        throw std::logic_error("FieldOps::createFE() :TODO: Can't reuse PetscFE due to naming of fields, so make a deep copy of fe.");
-        fe = hasFE->second._fe;
-        err = PetscObjectReference((PetscObject) fe);PYLITH_CHECK_ERROR(err);
+        // The FE for each subfield gets the subfield name, so we cannot hand out the cached FE
+        // itself. Instead, create a shallow copy that shares the (reference counted) basis space,
+        // dual space, and quadrature of the cached FE, which avoids repeating the expensive setup
+        // and tabulation for identical discretizations.
+        const PetscFE feCached = hasFE->second._fe;assert(feCached);
+        PetscSpace space = NULL;
+        err = PetscFEGetBasisSpace(feCached, &space);PYLITH_CHECK_ERROR(err);
+        PetscDualSpace dualspace = NULL;
+        err = PetscFEGetDualSpace(feCached, &dualspace);PYLITH_CHECK_ERROR(err);
+        PetscQuadrature quadrature = NULL;
+        err = PetscFEGetQuadrature(feCached, &quadrature);PYLITH_CHECK_ERROR(err);
+        PetscQuadrature faceQuadrature = NULL;
+        err = PetscFEGetFaceQuadrature(feCached, &faceQuadrature);PYLITH_CHECK_ERROR(err);
+
+        err = PetscFECreate(PETSC_COMM_SELF, &fe);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetType(fe, PETSCFEBASIC);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetBasisSpace(fe, space);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetDualSpace(fe, dualspace);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetNumComponents(fe, feKey.components);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetUp(fe);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
     }
 
     PYLITH_METHOD_RETURN(fe);
@@ -262,4 +320,137 @@ pylith::topology::FieldOps::layoutsMatch(const pylith::topology::Field& fieldA,
 } // layoutsMatch
 
 
+// ------------------------------------------------------------------------------------------------
+// Set whether reductions in PyLith accumulation paths use a fixed combination order.
+void
+pylith::topology::FieldOps::setDeterministicReductions(const bool value) {
+    deterministicReductions = value;
+} // setDeterministicReductions
+
+
+// ------------------------------------------------------------------------------------------------
+// Get whether reductions use a fixed combination order.
+bool
+pylith::topology::FieldOps::getDeterministicReductions(void) {
+    return deterministicReductions;
+} // getDeterministicReductions
+
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _FieldOps {
+public:
+
+            /** MPI combiner for packed diagnostics [sum of squares, -min, max] per vector;
+             * sums the first slot and maximizes the other two.
+             */
+            static
+            void reduceDiagnostics(void* inRaw,
+                                   void* inoutRaw,
+                                   int* len,
+                                   MPI_Datatype* datatype);
+
+        }; // _FieldOps
+    } // topology
+} // pylith
+
+void
+pylith::topology::_FieldOps::reduceDiagnostics(void* inRaw,
+                                               void* inoutRaw,
+                                               int* len,
+                                               MPI_Datatype* datatype) {
+    const PylithReal* in = (const PylithReal*)inRaw;
+    PylithReal* inout = (PylithReal*)inoutRaw;
+    for (int i = 0; i < *len; ++i) {
+        inout[3*i+0] += in[3*i+0];
+        if (in[3*i+1] > inout[3*i+1]) { inout[3*i+1] = in[3*i+1]; }
+        if (in[3*i+2] > inout[3*i+2]) { inout[3*i+2] = in[3*i+2]; }
+    } // for
+} // reduceDiagnostics
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute L2 norm, minimum, and maximum of several global vectors with one fused reduction.
+void
+pylith::topology::FieldOps::computeDiagnostics(const PetscVec* vectors,
+                                               const size_t numVectors,
+                                               Diagnostics* diagnostics) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(vectors);
+    assert(diagnostics);
+    if (0 == numVectors) { PYLITH_METHOD_END; }
+
+    // Accumulate local contributions for all vectors in one pass, packed as
+    // [sum of squares, -min, max] so a single reduction combines them.
+    std::vector<PylithReal> values(3*numVectors);
+    PetscErrorCode err = 0;
+    for (size_t i = 0; i < numVectors; ++i) {
+        assert(vectors[i]);
+        PetscInt numValuesLocal = 0;
+        const PetscScalar* valuesLocal = NULL;
+        err = VecGetLocalSize(vectors[i], &numValuesLocal);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(vectors[i], &valuesLocal);PYLITH_CHECK_ERROR(err);
+        PylithReal sumSq = 0.0;
+        PylithReal minValue = +PYLITH_MAXSCALAR;
+        PylithReal maxValue = -PYLITH_MAXSCALAR;
+        for (PetscInt iValue = 0; iValue < numValuesLocal; ++iValue) {
+            const PylithReal value = PetscRealPart(valuesLocal[iValue]);
+            sumSq += value * value;
+            if (value < minValue) { minValue = value; }
+            if (value > maxValue) { maxValue = value; }
+        } // for
+        err = VecRestoreArrayRead(vectors[i], &valuesLocal);PYLITH_CHECK_ERROR(err);
+        values[3*i+0] = sumSq;
+        values[3*i+1] = -minValue;
+        values[3*i+2] = +maxValue;
+    } // for
+
+    // Use a contiguous triple as the reduction element so MPI cannot split a
+    // vector's slots across segments of the combiner.
+    MPI_Comm comm = PetscObjectComm((PetscObject)vectors[0]);
+    MPI_Datatype tripleType;
+    err = MPI_Type_contiguous(3, MPIU_REAL, &tripleType);PYLITH_CHECK_ERROR(err);
+    err = MPI_Type_commit(&tripleType);PYLITH_CHECK_ERROR(err);
+    if (!deterministicReductions) {
+        MPI_Op reduceOp;
+        err = MPI_Op_create(_FieldOps::reduceDiagnostics, 1, &reduceOp);PYLITH_CHECK_ERROR(err);
+        err = MPI_Allreduce(MPI_IN_PLACE, &values[0], numVectors, tripleType, reduceOp, comm);PYLITH_CHECK_ERROR(err);
+        err = MPI_Op_free(&reduceOp);PYLITH_CHECK_ERROR(err);
+    } else {
+        // Deterministic mode: gather the per-process triples and combine them in rank
+        // order on the root so the floating point sums have a fixed association order
+        // independent of the MPI reduction algorithm, then broadcast the result.
+        int commRank = 0;
+        int commSize = 0;
+        err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+        err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+        std::vector<PylithReal> gathered((0 == commRank) ? 3*numVectors*commSize : 1);
+        err = MPI_Gather(&values[0], numVectors, tripleType, &gathered[0], numVectors, tripleType, 0, comm);PYLITH_CHECK_ERROR(err);
+        if (0 == commRank) {
+            for (int iRank = 0; iRank < commSize; ++iRank) {
+                const PylithReal* in = &gathered[3*numVectors*iRank];
+                int len = numVectors;
+                if (0 == iRank) {
+                    std::copy(in, in + 3*numVectors, values.begin());
+                } else {
+                    _FieldOps::reduceDiagnostics((void*)in, (void*)&values[0], &len, &tripleType);
+                } // if/else
+            } // for
+        } // if
+        err = MPI_Bcast(&values[0], numVectors, tripleType, 0, comm);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = MPI_Type_free(&tripleType);PYLITH_CHECK_ERROR(err);
+
+    for (size_t i = 0; i < numVectors; ++i) {
+        diagnostics[i].norm2 = sqrt(values[3*i+0]);
+        diagnostics[i].min = -values[3*i+1];
+        diagnostics[i].max = +values[3*i+2];
+    } // for
+
+    PYLITH_METHOD_END;
+} // computeDiagnostics
+
+
 // End of file
@@ -30,9 +30,11 @@
 
 #include "FieldBase.hh" // USES FieldBase::Discretization
 #include "pylith/utils/petscfwd.h" // USES PetscFE
+#include "pylith/utils/types.hh" // USES PylithReal
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 #include <map>
+#include <string>
 
 // Wrapper for PetscFE
 class pylith::topology::FE {
@@ -117,7 +119,71 @@ public:
     bool layoutsMatch(const pylith::topology::Field& fieldA,
                       const pylith::topology::Field& fieldB);
 
-    /** Free saved PetscFE objects.
+    /** Get layout template matching key.
+     *
+     * @param[in] key Key identifying mesh and discretization signature of field layout.
+     *
+     * @returns Local section with field layout if a template exists, NULL otherwise.
+     */
+    static
+    PetscSection getLayoutTemplate(const char* key);
+
+    /** Store local section as layout template.
+     *
+     * A copy of the section is stored so that later changes to the field layout do not alter the
+     * template. Fields created later with the same layout reference the stored section directly,
+     * so one section serves all same-layout fields on a mesh.
+     *
+     * @param[in] key Key identifying mesh and discretization signature of field layout.
+     * @param[in] section Local section with field layout.
+     */
+    static
+    void storeLayoutTemplate(const char* key,
+                             PetscSection section);
+
+    /// Diagnostics for a vector computed with fused reductions.
+    struct Diagnostics {
+        PylithReal norm2; ///< Global L2 norm.
+        PylithReal min; ///< Global minimum of entries.
+        PylithReal max; ///< Global maximum of entries.
+    }; // Diagnostics
+
+    /** Compute L2 norm, minimum, and maximum of several global vectors with one fused reduction.
+     *
+     * The local contributions for all vectors are accumulated in one pass and combined across
+     * processes in a single MPI_Allreduce, instead of one collective per norm. All vectors must
+     * share the same communicator.
+     *
+     * @param[in] vectors Array of global PETSc Vecs.
+     * @param[in] numVectors Number of vectors.
+     * @param[out] diagnostics Array of diagnostics, one per vector.
+     */
+    static
+    void computeDiagnostics(const PetscVec* vectors,
+                            const size_t numVectors,
+                            Diagnostics* diagnostics);
+
+    /** Set whether reductions in PyLith accumulation paths use a fixed combination order.
+     *
+     * When enabled, computeDiagnostics() gathers the per-process floating point
+     * contributions and combines them in rank order on the root process instead of
+     * letting MPI choose the reduction order, making the results bitwise reproducible
+     * from run to run on a fixed number of processes. Costs a gather plus broadcast
+     * instead of one allreduce. The setting is process wide.
+     *
+     * @param[in] value True to use fixed-order reductions.
+     */
+    static
+    void setDeterministicReductions(const bool value);
+
+    /** Get whether reductions use a fixed combination order.
+     *
+     * @returns True if fixed-order reductions are enabled.
+     */
+    static
+    bool getDeterministicReductions(void);
+
+    /** Free saved PetscFE objects and layout templates.
      */
     static
     void deallocate(void);
@@ -130,6 +196,8 @@ private:
     const FieldOps& operator=(const FieldOps&); ///< Not implemented.
 
     static std::map<FieldBase::Discretization, pylith::topology::FE> feStore;
+    static std::map<std::string, PetscSection> layoutStore;
+    static bool deterministicReductions; ///< True if reductions use a fixed combination order.
 
 }; // FieldOps
 
@@ -28,6 +28,10 @@
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/MultiQueryDB.hh" // USES MultiQueryDB
+
+#include <algorithm> // USES std::sort(), std::min(), std::max()
+#include <cmath> // USES floor()
 
 namespace pylith {
     namespace topology {
@@ -42,10 +46,35 @@ public:
             void findQueryIndices(FieldQuery::DBQueryContext* context,
                                   const pylith::string_vector& valuesForSubfield);
 
+            /** Query spatial database once over the sorted unique locations
+             * recorded during the collect pass, caching the values.
+             */
+            static
+            void queryBatch(FieldQuery::DBQueryContext* context,
+                            const size_t spaceDim);
+
+            /** Query spatial database once per occupied cell of a coarse grid
+             * and interpolate to the recorded locations with a gradient
+             * limited by the range of neighboring cell values.
+             */
+            static
+            void queryBatchCoarse(FieldQuery::DBQueryContext* context,
+                                  const size_t spaceDim);
+
+            /** Run validators over the populated field values, aggregating
+             * all offending points instead of aborting at the first failure.
+             */
+            static
+            void validateValues(const FieldQuery::DBQueryContext* contexts,
+                                const size_t numSubfields,
+                                const Field& field);
+
         }; // _FieldQuery
     } // topology
 } // pylith
 
+std::map<std::string, pylith::topology::FieldQuery::pointvalues_type> pylith::topology::FieldQuery::_sharedValues;
+
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::topology::FieldQuery::FieldQuery(const Field& field) :
@@ -53,12 +82,14 @@ pylith::topology::FieldQuery::FieldQuery(const Field& field) :
     _functions(NULL),
     _contexts(NULL),
     _contextPtrs(NULL),
-    _logger(new pylith::utils::EventLogger) {
+    _logger(new pylith::utils::EventLogger),
+    _queryResolution(0.0) {
     assert(_logger);
     _logger->setClassName("FieldQuery");
     _logger->initialize();
     _logger->registerEvent("Py-FdQu-queryDB");
     _logger->registerEvent("Py-FdQu-queryPt");
+    _logger->registerEvent("Py-FdQu-queryBatch");
 } // constructor
 
 
@@ -140,6 +171,22 @@ pylith::topology::FieldQuery::initializeWithDefaultQueries(void) {
 } // initializeWithDefaultQueries
 
 
+// ----------------------------------------------------------------------
+// Set resolution for batched spatial database queries.
+void
+pylith::topology::FieldQuery::setQueryResolution(const PylithReal value) {
+    _queryResolution = value;
+} // setQueryResolution
+
+
+// ----------------------------------------------------------------------
+// Clear store of database values shared across field queries.
+void
+pylith::topology::FieldQuery::sharedCacheClear(void) {
+    _sharedValues.clear();
+} // sharedCacheClear
+
+
 // ----------------------------------------------------------------------
 // Query spatial database to set values in field.
 void
@@ -181,6 +228,7 @@ pylith::topology::FieldQuery::openDB(spatialdata::spatialdb::SpatialDB* db,
             _functions[index] = NULL;
         } // if/else
         _contexts[index].lengthScale = lengthScale;
+        _contexts[index].queryResolution = _queryResolution;
 
         const pylith::topology::Field::Description& description = iter->second.description;
         _contexts[index].description = description.label;
@@ -207,9 +255,52 @@ pylith::topology::FieldQuery::queryDB(void) {
 
     PetscErrorCode err = 0;
     PetscReal dummyTime = 0.0;
+
+    // Collect pass: record the locations PETSc will evaluate without
+    // querying the spatial databases.
+    const size_t numSubfields = _field._subfields.size();
+    bool hasDB = false;
+    for (size_t i = 0; i < numSubfields; ++i) {
+        if (_contexts[i].db) { hasDB = true; }
+        _contexts[i].batchMode = QUERY_COLLECT;
+        _contexts[i].batchCoords.clear();
+        _contexts[i].batchValues.clear();
+    } // for
+    if (hasDB) {
+        err = DMProjectFunctionLocal(_field.getDM(), dummyTime, _functions, (void**)_contextPtrs, INSERT_ALL_VALUES,
+                                     _field.getLocalVector());PYLITH_CHECK_ERROR(err);
+
+        // Batched query pass: query each database once over the sorted
+        // unique locations. Sorting gives locality in the database index,
+        // and locations shared by cells are queried once instead of once
+        // per cell.
+        const PylithInt batchEvent = _logger->getEventId("Py-FdQu-queryBatch");
+        _logger->eventBegin(batchEvent);
+        const spatialdata::geocoords::CoordSys* cs = _field.getMesh().getCoordSys();assert(cs);
+        const size_t spaceDim = cs->getSpaceDim();
+        for (size_t i = 0; i < numSubfields; ++i) {
+            _FieldQuery::queryBatch(&_contexts[i], spaceDim);
+            _contexts[i].batchMode = QUERY_CACHED;
+        } // for
+        _logger->eventEnd(batchEvent);
+    } // if
+
+    // Projection pass: project the cached values onto the field. Validators
+    // are skipped in this pass and run afterwards over the populated array,
+    // aggregating all offending points instead of aborting at the first one.
     err = DMProjectFunctionLocal(_field.getDM(), dummyTime, _functions, (void**)_contextPtrs, INSERT_ALL_VALUES,
                                  _field.getLocalVector());PYLITH_CHECK_ERROR(err);
 
+    if (hasDB) {
+        _FieldQuery::validateValues(_contexts, numSubfields, _field);
+    } // if
+
+    for (size_t i = 0; i < numSubfields; ++i) {
+        _contexts[i].batchMode = QUERY_DIRECT;
+        _contexts[i].batchCoords.clear();
+        _contexts[i].batchValues.clear();
+    } // for
+
     _logger->eventEnd(queryEvent);
 
     PYLITH_METHOD_END;
@@ -289,6 +380,17 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
         PYLITH_METHOD_RETURN(0);
     } // if
 
+    // Collect pass of batched query; record the location without querying.
+    if (pylith::topology::FieldQuery::QUERY_COLLECT == queryctx->batchMode) {
+        for (PylithInt i = 0; i < dim; ++i) {
+            queryctx->batchCoords.push_back(x[i]);
+        } // for
+        for (PylithInt i = 0; i < nvalues; ++i) {
+            values[i] = 0.0;
+        } // for
+        PYLITH_METHOD_RETURN(0);
+    } // if
+
     assert(queryctx->logger);
     const PylithInt pointFnEvent = queryctx->logger->getEventId("Py-FdQu-queryPt");
     queryctx->logger->eventBegin(pointFnEvent);
@@ -300,17 +402,42 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
         xDim[i] = x[i] * queryctx->lengthScale;
     } // for
 
-    // Query database.
+    // Copy values cached by the batched query pass or by another field query
+    // sharing the database, or query the database.
+    pylith::topology::FieldQuery::BatchPoint point;
+    for (int i = 0; i < 3; ++i) {
+        point.x[i] = (i < dim) ? x[i] : 0.0;
+    } // for
+    bool cached = false;
+    if (pylith::topology::FieldQuery::QUERY_CACHED == queryctx->batchMode) {
+        const pylith::topology::FieldQuery::pointvalues_type::const_iterator iter =
+            queryctx->batchValues.find(point);
+        if (iter != queryctx->batchValues.end()) {
+            std::copy(iter->second.begin(), iter->second.end(), &queryctx->queryValues[0]);
+            cached = true;
+        } // if
+    } // if
     assert(queryctx->cs);
-    const int err = queryctx->db->query(&queryctx->queryValues[0], queryctx->queryValues.size(), xDim, dim, queryctx->cs);
-    if (err) {
-        std::ostringstream msg;
-        msg << "Could not find values for " << queryctx->description << " at (";
-        for (int i = 0; i < dim; ++i) {
-            msg << "  " << xDim[i];
-        }
-        msg << ") in spatial database '" << queryctx->db->getDescription() << "'.";
-        PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+    if (!cached) {
+        pylith::topology::FieldQuery::pointvalues_type& shared =
+            pylith::topology::FieldQuery::_sharedValues[queryctx->db->getDescription()];
+        const pylith::topology::FieldQuery::pointvalues_type::const_iterator sharedIter = shared.find(point);
+        if (sharedIter != shared.end()) {
+            std::copy(sharedIter->second.begin(), sharedIter->second.end(), &queryctx->queryValues[0]);
+            cached = true;
+        } else {
+            const int err = queryctx->db->query(&queryctx->queryValues[0], queryctx->queryValues.size(), xDim, dim, queryctx->cs);
+            if (err) {
+                std::ostringstream msg;
+                msg << "Could not find values for " << queryctx->description << " at (";
+                for (int i = 0; i < dim; ++i) {
+                    msg << "  " << xDim[i];
+                }
+                msg << ") in spatial database '" << queryctx->db->getDescription() << "'.";
+                PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+            } // if
+            shared[point].assign(&queryctx->queryValues[0], &queryctx->queryValues[0] + queryctx->queryValues.size());
+        } // if/else
     } // if
 
     // Convert database values to subfield values if converter function specified.
@@ -326,19 +453,18 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
                 << invalidMsg;
             PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
         }
-    } else {
-        for (PylithInt i = 0; i < nvalues; ++i) {
-            values[i] = queryctx->queryValues[queryctx->queryIndices[i]];
-        } // for
-    } // if/else
+    } // if
 
-    // Validate subfield values if validator function was specified.
-    if (queryctx->validator) {
-        for (PylithInt i = 0; i < nvalues; ++i) {
-            const char* invalidMsg = queryctx->validator(values[i]);
+    // Copy (if no converter), validate (dimensional values), and nondimensionalize subfield
+    // values in a single pass, so each value is touched once.
+    assert(queryctx->valueScale > 0);
+    for (PylithInt i = 0; i < nvalues; ++i) {
+        const PylithScalar value = (queryctx->converter) ? values[i] : queryctx->queryValues[queryctx->queryIndices[i]];
+        if (queryctx->validator && (pylith::topology::FieldQuery::QUERY_CACHED != queryctx->batchMode)) {
+            const char* invalidMsg = queryctx->validator(value);
             if (invalidMsg) {
                 std::ostringstream msg;
-                msg << "Found invalid value for " << queryctx->description << " (" << values[i] << ") at location (";
+                msg << "Found invalid value for " << queryctx->description << " (" << value << ") at location (";
                 for (int i = 0; i < dim; ++i) {
                     msg << "  " << xDim[i];
                 }
@@ -346,13 +472,8 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
                 msg << invalidMsg;
                 PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
             } // if
-        } // for
-    } // if
-
-    // Nondimensionalize values
-    assert(queryctx->valueScale > 0);
-    for (int i = 0; i < nvalues; ++i) {
-        values[i] /= queryctx->valueScale;
+        } // if
+        values[i] = value / queryctx->valueScale;
     } // for
 
     queryctx->logger->eventEnd(pointFnEvent);
@@ -421,4 +542,308 @@ pylith::topology::_FieldQuery::findQueryIndices(FieldQuery::DBQueryContext* cont
 } // findQueryIndices
 
 
+// ----------------------------------------------------------------------
+// Query spatial database once over the sorted unique locations recorded
+// during the collect pass, caching the values.
+void
+pylith::topology::_FieldQuery::queryBatch(FieldQuery::DBQueryContext* context,
+                                          const size_t spaceDim) {
+    assert(context);
+    assert(spaceDim <= 3);
+
+    if (!context->db) {
+        return;
+    } // if
+
+    if (context->queryResolution > 0.0) {
+        queryBatchCoarse(context, spaceDim);
+        return;
+    } // if
+
+    const size_t numPoints = context->batchCoords.size() / spaceDim;
+    std::vector<FieldQuery::BatchPoint> points(numPoints);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        for (size_t i = 0; i < 3; ++i) {
+            points[iPoint].x[i] = (i < spaceDim) ? context->batchCoords[iPoint*spaceDim+i] : 0.0;
+        } // for
+    } // for
+    std::sort(points.begin(), points.end());
+
+    assert(context->lengthScale > 0);
+    const size_t numValues = context->queryValues.size();
+    FieldQuery::pointvalues_type& shared = FieldQuery::_sharedValues[context->db->getDescription()];
+
+    // Skip duplicate locations and locations already queried by another field query sharing
+    // the database.
+    std::vector<FieldQuery::BatchPoint> queryPoints;
+    queryPoints.reserve(numPoints);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        if ((iPoint > 0) && !(points[iPoint-1] < points[iPoint])) {
+            continue; // Duplicate location; already queried.
+        } // if
+        const FieldQuery::pointvalues_type::const_iterator sharedIter = shared.find(points[iPoint]);
+        if (sharedIter != shared.end()) {
+            context->batchValues[points[iPoint]] = sharedIter->second;
+            continue;
+        } // if
+        queryPoints.push_back(points[iPoint]);
+    } // for
+    const size_t numQuery = queryPoints.size();
+
+    pylith::utils::MultiQueryDB* dbMulti = dynamic_cast<pylith::utils::MultiQueryDB*>(context->db);
+    if (dbMulti) {
+        // Query all locations in a single call; the coordinates of all locations are converted
+        // to the coordinate system of the database at once instead of once per location. The
+        // call is made even with zero locations, because batched queries of some databases are
+        // collective (e.g., interpolating a field on a distributed mesh).
+        std::vector<double> coordsDim(numQuery*spaceDim);
+        for (size_t iPoint = 0; iPoint < numQuery; ++iPoint) {
+            for (size_t i = 0; i < spaceDim; ++i) {
+                coordsDim[iPoint*spaceDim+i] = queryPoints[iPoint].x[i] * context->lengthScale;
+            } // for
+        } // for
+        std::vector<double> values(numQuery*numValues);
+        assert(context->cs);
+        dbMulti->queryMulti((numQuery > 0) ? &values[0] : NULL, numValues,
+                            (numQuery > 0) ? &coordsDim[0] : NULL, numQuery, spaceDim, context->cs);
+        for (size_t iPoint = 0; iPoint < numQuery; ++iPoint) {
+            std::vector<double>& pointValues = context->batchValues[queryPoints[iPoint]];
+            pointValues.assign(&values[iPoint*numValues], &values[iPoint*numValues] + numValues);
+            shared[queryPoints[iPoint]] = pointValues;
+        } // for
+    } else {
+        double xDim[3];
+        for (size_t iPoint = 0; iPoint < numQuery; ++iPoint) {
+            for (size_t i = 0; i < spaceDim; ++i) {
+                xDim[i] = queryPoints[iPoint].x[i] * context->lengthScale;
+            } // for
+            assert(context->cs);
+            const int err = context->db->query(&context->queryValues[0], numValues, xDim, spaceDim, context->cs);
+            if (err) {
+                std::ostringstream msg;
+                msg << "Could not find values for " << context->description << " at (";
+                for (size_t i = 0; i < spaceDim; ++i) {
+                    msg << "  " << xDim[i];
+                }
+                msg << ") in spatial database '" << context->db->getDescription() << "'.";
+                throw std::runtime_error(msg.str());
+            } // if
+            std::vector<double>& values = context->batchValues[queryPoints[iPoint]];
+            values.assign(&context->queryValues[0], &context->queryValues[0] + numValues);
+            shared[queryPoints[iPoint]] = values;
+        } // for
+    } // if/else
+
+    context->batchCoords.clear();
+} // queryBatch
+
+
+// ----------------------------------------------------------------------
+// Query spatial database once per occupied cell of a coarse grid and
+// interpolate to the recorded locations with a gradient limited by the
+// range of neighboring cell values.
+void
+pylith::topology::_FieldQuery::queryBatchCoarse(FieldQuery::DBQueryContext* context,
+                                                const size_t spaceDim) {
+    assert(context);
+    assert(context->db);
+    assert(context->lengthScale > 0);
+    assert(context->queryResolution > 0.0);
+    assert(spaceDim <= 3);
+
+    typedef std::map<FieldQuery::BatchPoint, std::vector<double> > cellvalues_type;
+
+    const double gridSpacing = context->queryResolution / context->lengthScale; // (nondimensional)
+    const size_t numValues = context->queryValues.size();
+    const size_t numPoints = context->batchCoords.size() / spaceDim;
+
+    // Snap the recorded locations to the coarse grid; the grid index of each
+    // cell is stored in a BatchPoint so neighbor lookup uses exact values.
+    std::vector<FieldQuery::BatchPoint> points(numPoints);
+    std::vector<FieldQuery::BatchPoint> cells(numPoints);
+    cellvalues_type cellValues;
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        for (size_t i = 0; i < 3; ++i) {
+            const double x = (i < spaceDim) ? context->batchCoords[iPoint*spaceDim+i] : 0.0;
+            points[iPoint].x[i] = x;
+            cells[iPoint].x[i] = (i < spaceDim) ? floor(x / gridSpacing) : 0.0;
+        } // for
+        cellValues[cells[iPoint]];
+    } // for
+
+    // Query once per occupied grid cell, at the cell center. Grid cells are
+    // shared across field queries using the same database and spacing.
+    std::ostringstream sharedKey;
+    sharedKey.precision(15);
+    sharedKey << context->db->getDescription() << "|gridSpacing=" << gridSpacing;
+    FieldQuery::pointvalues_type& shared = FieldQuery::_sharedValues[sharedKey.str()];
+    std::vector<cellvalues_type::iterator> queryCells;
+    queryCells.reserve(cellValues.size());
+    for (cellvalues_type::iterator iter = cellValues.begin(); iter != cellValues.end(); ++iter) {
+        const FieldQuery::pointvalues_type::const_iterator sharedIter = shared.find(iter->first);
+        if (sharedIter != shared.end()) { // Cell already queried by another field query sharing the database.
+            iter->second = sharedIter->second;
+            continue;
+        } // if
+        queryCells.push_back(iter);
+    } // for
+    const size_t numQuery = queryCells.size();
+
+    pylith::utils::MultiQueryDB* dbMulti = dynamic_cast<pylith::utils::MultiQueryDB*>(context->db);
+    if (dbMulti) {
+        // Query all cell centers in a single call; the coordinates of all cell centers are
+        // converted to the coordinate system of the database at once instead of once per cell.
+        // The call is made even with zero cells, because batched queries of some databases are
+        // collective (e.g., interpolating a field on a distributed mesh).
+        std::vector<double> coordsDim(numQuery*spaceDim);
+        for (size_t iCell = 0; iCell < numQuery; ++iCell) {
+            for (size_t i = 0; i < spaceDim; ++i) {
+                coordsDim[iCell*spaceDim+i] = (queryCells[iCell]->first.x[i] + 0.5) * gridSpacing * context->lengthScale;
+            } // for
+        } // for
+        std::vector<double> values(numQuery*numValues);
+        assert(context->cs);
+        dbMulti->queryMulti((numQuery > 0) ? &values[0] : NULL, numValues,
+                            (numQuery > 0) ? &coordsDim[0] : NULL, numQuery, spaceDim, context->cs);
+        for (size_t iCell = 0; iCell < numQuery; ++iCell) {
+            queryCells[iCell]->second.assign(&values[iCell*numValues], &values[iCell*numValues] + numValues);
+            shared[queryCells[iCell]->first] = queryCells[iCell]->second;
+        } // for
+    } else {
+        double xDim[3];
+        for (size_t iCell = 0; iCell < numQuery; ++iCell) {
+            cellvalues_type::iterator iter = queryCells[iCell];
+            for (size_t i = 0; i < spaceDim; ++i) {
+                xDim[i] = (iter->first.x[i] + 0.5) * gridSpacing * context->lengthScale;
+            } // for
+            assert(context->cs);
+            const int err = context->db->query(&context->queryValues[0], numValues, xDim, spaceDim, context->cs);
+            if (err) {
+                std::ostringstream msg;
+                msg << "Could not find values for " << context->description << " at (";
+                for (size_t i = 0; i < spaceDim; ++i) {
+                    msg << "  " << xDim[i];
+                }
+                msg << ") in spatial database '" << context->db->getDescription() << "'.";
+                throw std::runtime_error(msg.str());
+            } // if
+            iter->second.assign(&context->queryValues[0], &context->queryValues[0] + numValues);
+            shared[iter->first] = iter->second;
+        } // for
+    } // if/else
+
+    // Interpolate to the recorded locations with a gradient estimated from
+    // neighboring occupied cells, limited so interpolated values stay within
+    // the range of the values used in the estimate.
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        if (context->batchValues.count(points[iPoint]) > 0) {
+            continue; // Duplicate location; already interpolated.
+        } // if
+        const std::vector<double>& cellV = cellValues[cells[iPoint]];
+        std::vector<double> values(cellV);
+        std::vector<double> valuesMin(cellV);
+        std::vector<double> valuesMax(cellV);
+        for (size_t d = 0; d < spaceDim; ++d) {
+            FieldQuery::BatchPoint cellMinus = cells[iPoint];cellMinus.x[d] -= 1.0;
+            FieldQuery::BatchPoint cellPlus = cells[iPoint];cellPlus.x[d] += 1.0;
+            const cellvalues_type::const_iterator iterMinus = cellValues.find(cellMinus);
+            const cellvalues_type::const_iterator iterPlus = cellValues.find(cellPlus);
+            const bool hasMinus = iterMinus != cellValues.end();
+            const bool hasPlus = iterPlus != cellValues.end();
+            if (!hasMinus && !hasPlus) { continue; }
+            const double offset = points[iPoint].x[d] - (cells[iPoint].x[d] + 0.5) * gridSpacing;
+            for (size_t j = 0; j < numValues; ++j) {
+                double slope = 0.0;
+                if (hasMinus && hasPlus) {
+                    slope = (iterPlus->second[j] - iterMinus->second[j]) / (2.0*gridSpacing);
+                } else if (hasPlus) {
+                    slope = (iterPlus->second[j] - cellV[j]) / gridSpacing;
+                } else {
+                    slope = (cellV[j] - iterMinus->second[j]) / gridSpacing;
+                } // if/else
+                values[j] += slope * offset;
+                if (hasMinus) {
+                    valuesMin[j] = std::min(valuesMin[j], iterMinus->second[j]);
+                    valuesMax[j] = std::max(valuesMax[j], iterMinus->second[j]);
+                } // if
+                if (hasPlus) {
+                    valuesMin[j] = std::min(valuesMin[j], iterPlus->second[j]);
+                    valuesMax[j] = std::max(valuesMax[j], iterPlus->second[j]);
+                } // if
+            } // for
+        } // for
+        for (size_t j = 0; j < numValues; ++j) {
+            values[j] = std::max(valuesMin[j], std::min(valuesMax[j], values[j]));
+        } // for
+        context->batchValues[points[iPoint]] = values;
+    } // for
+
+    context->batchCoords.clear();
+} // queryBatchCoarse
+
+
+// ----------------------------------------------------------------------
+// Run validators over the populated field values, aggregating all
+// offending points instead of aborting at the first failure.
+void
+pylith::topology::_FieldQuery::validateValues(const FieldQuery::DBQueryContext* contexts,
+                                              const size_t numSubfields,
+                                              const Field& field) {
+    assert(contexts);
+
+    const size_t maxReported = 50; // Cap on reported offending values per subfield.
+
+    PetscErrorCode err = 0;
+    PetscSection section = NULL;
+    err = DMGetLocalSection(field.getDM(), &section);PYLITH_CHECK_ERROR_NOTHROW(err);assert(section);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR_NOTHROW(err);
+
+    const PetscScalar* fieldArray = NULL;
+    err = VecGetArrayRead(field.getLocalVector(), &fieldArray);PYLITH_CHECK_ERROR_NOTHROW(err);assert(fieldArray);
+
+    size_t numInvalid = 0;
+    std::ostringstream msg;
+    for (size_t iField = 0; iField < numSubfields; ++iField) {
+        const FieldQuery::DBQueryContext& context = contexts[iField];
+        if (!context.db || !context.validator) {
+            continue;
+        } // if
+        assert(context.valueScale > 0);
+        size_t numInvalidSubfield = 0;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt numDof = 0, offset = 0;
+            err = PetscSectionGetFieldDof(section, point, iField, &numDof);PYLITH_CHECK_ERROR_NOTHROW(err);
+            err = PetscSectionGetFieldOffset(section, point, iField, &offset);PYLITH_CHECK_ERROR_NOTHROW(err);
+            for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+                const double value = fieldArray[offset+iDof] * context.valueScale;
+                const char* invalidMsg = context.validator(value);
+                if (invalidMsg) {
+                    if (++numInvalidSubfield <= maxReported) {
+                        msg << "Found invalid value for " << context.description << " (" << value
+                            << ") at mesh point " << point << ", component " << iDof
+                            << ", from spatial database '" << context.db->getDescription() << "'. "
+                            << invalidMsg << "\n";
+                    } // if
+                } // if
+            } // for
+        } // for
+        if (numInvalidSubfield > maxReported) {
+            msg << "... and " << numInvalidSubfield - maxReported << " more invalid values for "
+                << context.description << ".\n";
+        } // if
+        numInvalid += numInvalidSubfield;
+    } // for
+
+    err = VecRestoreArrayRead(field.getLocalVector(), &fieldArray);PYLITH_CHECK_ERROR_NOTHROW(err);
+
+    if (numInvalid > 0) {
+        std::ostringstream summary;
+        summary << "Found " << numInvalid << " invalid value(s) in field '" << field.getLabel() << "':\n"
+                << msg.str();
+        throw std::runtime_error(summary.str());
+    } // if
+} // validateValues
+
+
 // End of file
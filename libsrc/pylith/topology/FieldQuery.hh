@@ -36,6 +36,7 @@
 
 #include <map> // HOLDSA std::map
 #include <string> // HASA std::string
+#include <vector> // HOLDSA std::vector
 
 namespace pylith {
     namespace feassemble {
@@ -101,6 +102,30 @@ public:
     /// Initialize query with default query information.
     void initializeWithDefaultQueries(void);
 
+    /** Set resolution for batched spatial database queries.
+     *
+     * With a positive resolution, the batched query snaps the locations to a
+     * coarse grid with the given spacing, queries each spatial database once
+     * per occupied grid cell, and interpolates to the evaluation locations
+     * with a gradient estimated from neighboring grid cells (limited so
+     * interpolated values stay within the range of the values used). Useful
+     * when the databases are much finer than the mesh needs. A nonpositive
+     * resolution (the default) queries every location.
+     *
+     * @param[in] value Grid spacing (dimensioned length) for coarse queries.
+     */
+    void setQueryResolution(const PylithReal value);
+
+    /** Clear store of database values shared across field queries.
+     *
+     * Queries cache the raw database values in a store shared across
+     * FieldQuery instances, so components querying the same database at the
+     * same locations (e.g., materials sharing one velocity model, faults
+     * re-querying it) trigger one database query per unique location. Call
+     * after initialization to free the store.
+     */
+    static void sharedCacheClear(void);
+
     /** Open spatial database query for setting values in field.
      *
      * @param db Spatial database to query.
@@ -110,7 +135,14 @@ public:
     void openDB(spatialdata::spatialdb::SpatialDB* db,
                 const PylithReal lengthScale);
 
-    /// Query spatial database to set values in field.
+    /** Query spatial database to set values in field.
+     *
+     * Queries are batched: the locations to be evaluated are gathered in a
+     * first projection pass, each spatial database is queried once over the
+     * sorted unique locations, and a second projection pass uses the cached
+     * values. Sorting gives locality in the database index, and locations
+     * shared by cells are queried once instead of once per cell.
+     */
     void queryDB(void);
 
     /** Query spatial database for points in label to set values in field.
@@ -188,6 +220,30 @@ private:
                                            PylithScalar*,
                                            void*);
 
+    /// Mode of batched spatial database queries.
+    enum QueryBatchMode {
+        QUERY_DIRECT=0, ///< Query spatial database at each location.
+        QUERY_COLLECT=1, ///< Record locations to be evaluated without querying.
+        QUERY_CACHED=2, ///< Copy values cached by the batched query pass.
+    }; // QueryBatchMode
+
+    /// Location key for values cached by the batched query pass.
+    struct BatchPoint {
+        double x[3]; ///< Location (nondimensioned); unused coordinates are zero.
+
+        /// Lexicographic ordering of locations.
+        bool operator<(const BatchPoint& rhs) const {
+            for (int i = 0; i < 3; ++i) {
+                if (x[i] < rhs.x[i]) { return true; }
+                if (x[i] > rhs.x[i]) { return false; }
+            } // for
+            return false;
+        } // operator<
+
+    }; // BatchPoint
+
+    typedef std::map<BatchPoint, std::vector<double> > pointvalues_type;
+
     /// Context for spatial database queries.
     struct DBQueryContext {
         spatialdata::spatialdb::SpatialDB* db; ///< Spatial database.
@@ -200,6 +256,10 @@ private:
         convertfn_type converter; ///< Function to convert values to subfield (optional).
         pylith::topology::FieldBase::validatorfn_type validator; ///< Function to validate values (optional).
         pylith::utils::EventLogger* logger;
+        PylithReal queryResolution; ///< Grid spacing (dimensioned) for coarse batched queries (nonpositive queries every location).
+        int batchMode; ///< Mode of batched queries (QueryBatchMode).
+        std::vector<double> batchCoords; ///< Locations recorded during collect pass.
+        std::map<BatchPoint, std::vector<double> > batchValues; ///< Values cached by the batched query pass.
 
         DBQueryContext(void) :
             db(NULL),
@@ -209,7 +269,9 @@ private:
             description("unknown"),
             converter(NULL),
             validator(NULL),
-            logger(NULL) {}
+            logger(NULL),
+            queryResolution(0.0),
+            batchMode(QUERY_DIRECT) {}
 
 
     }; // DBQueryStruct
@@ -227,6 +289,10 @@ private:
 
     pylith::utils::EventLogger* _logger;
 
+    PylithReal _queryResolution; ///< Grid spacing (dimensioned) for coarse batched queries (nonpositive queries every location).
+
+    static std::map<std::string, pointvalues_type> _sharedValues; ///< Raw database values shared across field queries, keyed by database description.
+
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,216 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "FieldSoAView.hh" // implementation of object methods
+
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::topology::FieldSoAView::FieldSoAView(void) :
+    _field(NULL) {
+    GenericComponent::setName("fieldsoaview");
+} // constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::topology::FieldSoAView::~FieldSoAView(void) {
+    deallocate();
+} // destructor
+
+
+// ----------------------------------------------------------------------
+// Deallocate data structures.
+void
+pylith::topology::FieldSoAView::deallocate(void) {
+    _field = NULL;
+    _subfields.clear();
+    _points.resize(0);
+} // deallocate
+
+
+// ----------------------------------------------------------------------
+// Initialize view with subfields to gather.
+void
+pylith::topology::FieldSoAView::initialize(const pylith::topology::Field& field,
+                                           const pylith::string_vector& subfieldNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("initialize(field="<<field.getLabel()<<", # subfields="<<subfieldNames.size()<<")");
+
+    assert(subfieldNames.size() > 0);
+
+    _subfields.clear();
+    for (size_t i = 0; i < subfieldNames.size(); ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(subfieldNames[i].c_str());
+        SubfieldArrays& arrays = _subfields[subfieldNames[i]];
+        arrays.index = info.index;
+        arrays.numComponents = info.description.numComponents;
+    } // for
+    _field = &field;
+
+    // All subfields in the view must share the same discretization points; use the first
+    // subfield to find the points with values.
+    PetscErrorCode err = 0;
+    PetscSection section = NULL;
+    err = DMGetLocalSection(field.getDM(), &section);PYLITH_CHECK_ERROR(err);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt firstIndex = _subfields[subfieldNames[0]].index;
+    size_t numPoints = 0;
+    _points.resize(pEnd-pStart);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0;
+        err = PetscSectionGetFieldDof(section, point, firstIndex, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof > 0) {
+            _points[numPoints++] = point;
+        } // if
+    } // for
+    _points.resize(numPoints);
+
+    for (arrays_map_t::iterator iter = _subfields.begin(); iter != _subfields.end(); ++iter) {
+        SubfieldArrays& arrays = iter->second;
+        arrays.values.resize(arrays.numComponents * numPoints);
+    } // for
+
+    gather();
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ----------------------------------------------------------------------
+// Gather subfield values from the interleaved local vector into the SoA arrays.
+void
+pylith::topology::FieldSoAView::gather(void) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_field);
+    PetscErrorCode err = 0;
+    PetscSection section = NULL;
+    err = DMGetLocalSection(_field->getDM(), &section);PYLITH_CHECK_ERROR(err);
+    const PetscScalar* fieldArray = NULL;
+    err = VecGetArrayRead(_field->getLocalVector(), &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    const size_t numPoints = _points.size();
+    for (arrays_map_t::iterator iter = _subfields.begin(); iter != _subfields.end(); ++iter) {
+        SubfieldArrays& arrays = iter->second;
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            PetscInt offset = 0;
+            err = PetscSectionGetFieldOffset(section, _points[iPoint], arrays.index, &offset);PYLITH_CHECK_ERROR(err);
+            for (PylithInt iComponent = 0; iComponent < arrays.numComponents; ++iComponent) {
+                arrays.values[iComponent*numPoints+iPoint] = fieldArray[offset+iComponent];
+            } // for
+        } // for
+    } // for
+    err = VecRestoreArrayRead(_field->getLocalVector(), &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // gather
+
+
+// ----------------------------------------------------------------------
+// Scatter subfield values from the SoA arrays back into the interleaved local vector.
+void
+pylith::topology::FieldSoAView::scatter(const char* subfieldName) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_field);
+    const SubfieldArrays& arrays = _getSubfieldArrays(subfieldName);
+
+    PetscErrorCode err = 0;
+    PetscSection section = NULL;
+    err = DMGetLocalSection(_field->getDM(), &section);PYLITH_CHECK_ERROR(err);
+    PetscScalar* fieldArray = NULL;
+    err = VecGetArray(_field->getLocalVector(), &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    const size_t numPoints = _points.size();
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        PetscInt offset = 0;
+        err = PetscSectionGetFieldOffset(section, _points[iPoint], arrays.index, &offset);PYLITH_CHECK_ERROR(err);
+        for (PylithInt iComponent = 0; iComponent < arrays.numComponents; ++iComponent) {
+            fieldArray[offset+iComponent] = arrays.values[iComponent*numPoints+iPoint];
+        } // for
+    } // for
+    err = VecRestoreArray(_field->getLocalVector(), &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatter
+
+
+// ----------------------------------------------------------------------
+// Get number of points with values in the view.
+PylithInt
+pylith::topology::FieldSoAView::getNumPoints(void) const {
+    return _points.size();
+} // getNumPoints
+
+
+// ----------------------------------------------------------------------
+// Get contiguous array with values of one component of a subfield.
+const PylithScalar*
+pylith::topology::FieldSoAView::getComponentValues(const char* subfieldName,
+                                                   const PylithInt component) const {
+    const SubfieldArrays& arrays = _getSubfieldArrays(subfieldName);
+    assert(component >= 0 && component < arrays.numComponents);
+
+    return &arrays.values[component*_points.size()];
+} // getComponentValues
+
+
+// ----------------------------------------------------------------------
+// Get mutable contiguous array with values of one component of a subfield.
+PylithScalar*
+pylith::topology::FieldSoAView::getComponentValuesMutable(const char* subfieldName,
+                                                          const PylithInt component) {
+    const SubfieldArrays& arrays = _getSubfieldArrays(subfieldName);
+    assert(component >= 0 && component < arrays.numComponents);
+
+    return const_cast<PylithScalar*>(&arrays.values[component*_points.size()]);
+} // getComponentValuesMutable
+
+
+// ----------------------------------------------------------------------
+// Get SoA storage for subfield.
+const pylith::topology::FieldSoAView::SubfieldArrays&
+pylith::topology::FieldSoAView::_getSubfieldArrays(const char* subfieldName) const {
+    PYLITH_METHOD_BEGIN;
+
+    arrays_map_t::const_iterator iter = _subfields.find(subfieldName);
+    if (_subfields.end() == iter) {
+        std::ostringstream msg;
+        msg << "Could not find subfield '" << subfieldName << "' in structure-of-arrays view of field '"
+            << (_field ? _field->getLabel() : "") << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_RETURN(iter->second);
+} // _getSubfieldArrays
+
+
+// End of file
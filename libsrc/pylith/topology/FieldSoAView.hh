@@ -0,0 +1,146 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/topology/FieldSoAView.hh
+ *
+ * @brief Structure-of-arrays view of field subfields.
+ *
+ * The PETSc local vector interleaves all subfields per point, so batched kernels touching only
+ * a few subfields stream over unrelated data. A FieldSoAView gathers selected subfields into
+ * contiguous per-component arrays (component-major) for bandwidth-efficient batched evaluation,
+ * and scatters updated subfields back into the interleaved local vector.
+ */
+
+#if !defined(pylith_topology_fieldsoaview_hh)
+#define pylith_topology_fieldsoaview_hh
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+#include "pylith/utils/array.hh" // HASA scalar_array, int_array
+#include "pylith/utils/types.hh" // USES PylithInt, PylithScalar
+
+#include <map> // HASA std::map
+#include <string> // HASA std::string
+
+class pylith::topology::FieldSoAView : public pylith::utils::GenericComponent {
+    friend class TestFieldSoAView; // unit testing
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    FieldSoAView(void);
+
+    /// Destructor.
+    ~FieldSoAView(void);
+
+    /// Deallocate data structures.
+    void deallocate(void);
+
+    /** Initialize view with subfields to gather.
+     *
+     * The field must remain valid for the lifetime of the view.
+     *
+     * @param[in] field Field with interleaved subfields.
+     * @param[in] subfieldNames Names of subfields to include in the view.
+     */
+    void initialize(const pylith::topology::Field& field,
+                    const pylith::string_vector& subfieldNames);
+
+    /** Gather subfield values from the interleaved local vector into the SoA arrays.
+     *
+     * Call after the field values change (e.g., after updating state variables).
+     */
+    void gather(void);
+
+    /** Scatter subfield values from the SoA arrays back into the interleaved local vector.
+     *
+     * @param[in] subfieldName Name of subfield to scatter.
+     */
+    void scatter(const char* subfieldName);
+
+    /** Get number of points with values in the view.
+     *
+     * @returns Number of points.
+     */
+    PylithInt getNumPoints(void) const;
+
+    /** Get contiguous array with values of one component of a subfield.
+     *
+     * Values are component-major; each component forms a contiguous lane of getNumPoints()
+     * values suitable for SIMD traversal.
+     *
+     * @param[in] subfieldName Name of subfield.
+     * @param[in] component Index of component in subfield.
+     * @returns Array of component values [getNumPoints()].
+     */
+    const PylithScalar* getComponentValues(const char* subfieldName,
+                                           const PylithInt component) const;
+
+    /** Get mutable contiguous array with values of one component of a subfield.
+     *
+     * Updated values are copied back into the field with scatter().
+     *
+     * @param[in] subfieldName Name of subfield.
+     * @param[in] component Index of component in subfield.
+     * @returns Array of component values [getNumPoints()].
+     */
+    PylithScalar* getComponentValuesMutable(const char* subfieldName,
+                                            const PylithInt component);
+
+    // PRIVATE TYPEDEFS /////////////////////////////////////////////////////
+private:
+
+    /// SoA storage for one subfield.
+    struct SubfieldArrays {
+        PylithInt index; ///< Index of subfield in field.
+        PylithInt numComponents; ///< Number of components in subfield.
+        pylith::scalar_array values; ///< Component-major values [numComponents*numPoints].
+    }; // SubfieldArrays
+
+    typedef std::map<std::string, SubfieldArrays> arrays_map_t;
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Get SoA storage for subfield.
+     *
+     * @param[in] subfieldName Name of subfield.
+     * @returns SoA storage for subfield.
+     */
+    const SubfieldArrays& _getSubfieldArrays(const char* subfieldName) const;
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    const pylith::topology::Field* _field; ///< Field with interleaved subfields (borrowed reference).
+    arrays_map_t _subfields; ///< SoA storage by subfield name.
+    pylith::int_array _points; ///< Points in field chart with values.
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    FieldSoAView(const FieldSoAView&); ///< Not implemented.
+    const FieldSoAView& operator=(const FieldSoAView&); ///< Not implemented.
+
+}; // class FieldSoAView
+
+#endif // pylith_topology_fieldsoaview_hh
+
+// End of file
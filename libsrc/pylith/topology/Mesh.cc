@@ -22,6 +22,7 @@
 #include "Mesh.hh" // implementation of class methods
 
 #include "MeshOps.hh" // USES MeshOps
+#include "CoordsVisitor.hh" // USES CoordsVisitor::optimizeClosure()
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "pylith/utils/array.hh" // USES scalar_array
@@ -73,7 +74,15 @@ void
 pylith::topology::Mesh::deallocate(void) {
     PYLITH_METHOD_BEGIN;
 
+    for (submesh_map::iterator iter = _submeshes.begin(); iter != _submeshes.end(); ++iter) {
+        delete iter->second;iter->second = NULL;
+    } // for
+    _submeshes.clear();
+
     delete _coordSys;_coordSys = NULL;
+    if (_dm) {
+        MeshOps::clearStratumCache(_dm);
+    } // if
     PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
@@ -118,6 +127,9 @@ pylith::topology::Mesh::setDM(PetscDM dm,
     PYLITH_METHOD_BEGIN;
 
     PetscErrorCode err;
+    if (_dm) {
+        MeshOps::clearStratumCache(_dm);
+    } // if
     err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
     _dm = dm;
     err = PetscObjectSetName((PetscObject) _dm, label);PYLITH_CHECK_ERROR(err);
@@ -221,4 +233,27 @@ pylith::topology::Mesh::view(const char* viewOption) const {
 } // view
 
 
+// ------------------------------------------------------------------------------------------------
+// Get lower dimension mesh for boundary, creating it if necessary.
+pylith::topology::Mesh*
+pylith::topology::Mesh::getSubmesh(const char* labelName,
+                                   const int labelValue) const {
+    PYLITH_METHOD_BEGIN;
+
+    assert(labelName);
+
+    const std::pair<std::string, int> key(labelName, labelValue);
+    submesh_map::const_iterator iter = _submeshes.find(key);
+    if (iter != _submeshes.end()) {
+        PYLITH_METHOD_RETURN(iter->second);
+    } // if
+
+    Mesh* submesh = MeshOps::createLowerDimMesh(*this, labelName, labelValue);assert(submesh);
+    CoordsVisitor::optimizeClosure(submesh->getDM());
+    _submeshes[key] = submesh;
+
+    PYLITH_METHOD_RETURN(submesh);
+} // getSubmesh
+
+
 // End of file
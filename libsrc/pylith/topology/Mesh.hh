@@ -31,6 +31,10 @@
 
 #include "pylith/utils/petscfwd.h" // HASA PetscDM
 
+#include <map> // HASA std::map
+#include <string> // HASA std::string
+#include <utility> // HASA std::pair
+
 // Mesh -----------------------------------------------------------------
 /** @brief PyLith finite-element mesh.
  *
@@ -131,11 +135,27 @@ public:
      */
     void view(const char* viewOption="::ascii_info_detail") const;
 
+    /** Get lower dimension mesh for boundary, creating it if necessary.
+     *
+     * Submeshes are shared; components using the same label and label value get the same
+     * submesh, so the boundary is extracted from the domain mesh only once. The submeshes
+     * are treated as immutable and their memory is managed by this mesh.
+     *
+     * @param[in] labelName Name of label marking boundary.
+     * @param[in] labelValue Value of label marking boundary.
+     * @returns Submesh for boundary.
+     */
+    Mesh* getSubmesh(const char* labelName,
+                     const int labelValue) const;
+
     // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
+    typedef std::map<std::pair<std::string, int>, Mesh*> submesh_map; ///< Map (label name, label value) to submesh.
+
     spatialdata::geocoords::CoordSys* _coordSys; ///< Coordinate system.
     PetscDM _dm; ///< PETSc DM with topology.
+    mutable submesh_map _submeshes; ///< Cache of boundary submeshes, keyed by (label name, label value).
 
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
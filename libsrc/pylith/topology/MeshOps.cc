@@ -24,9 +24,13 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/utils/array.hh" // USES int_array
 
+#include "pylith/utils/journals.hh" // USES pythia::journal
+
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5Open()
+
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
@@ -34,6 +38,39 @@
 #include <algorithm> // USES std::sort, std::find
 #include <map> // USES std::map
 
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        // Cache of stratum index sets shared across all consumers of label queries.
+        class _StratumCache {
+public:
+
+            struct Key {
+                PetscDM dm; ///< PETSc DM holding label.
+                std::string labelName; ///< Name of label.
+                PetscInt labelValue; ///< Label value.
+
+                bool operator<(const Key& rhs) const {
+                    if (dm != rhs.dm) { return dm < rhs.dm; }
+                    if (labelValue != rhs.labelValue) { return labelValue < rhs.labelValue; }
+                    return labelName < rhs.labelName;
+                } // operator<
+
+            }; // Key
+
+            struct Entry {
+                PetscObjectState labelState; ///< State of label when index set was built.
+                PetscIS pointsIS; ///< Cached index set (NULL if no points with value).
+            }; // Entry
+
+            typedef std::map<Key, Entry> cache_t;
+            static cache_t cache;
+        }; // _StratumCache
+
+        _StratumCache::cache_t _StratumCache::cache;
+    } // topology
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Create subdomain mesh using label.
 pylith::topology::Mesh*
@@ -126,12 +163,53 @@ pylith::topology::MeshOps::createLowerDimMesh(const pylith::topology::Mesh& mesh
 
     err = DMPlexCreateSubmesh(dmDomain, dmLabel, labelValue, PETSC_FALSE, &dmSubmesh);PYLITH_CHECK_ERROR(err);
 
-    PetscInt maxConeSizeLocal = 0, maxConeSize = 0;
+    // Verify the submesh contains cells. The check is done rank-locally from the label with a
+    // single exchange of flags over shared points, so that creating a submesh for each boundary
+    // condition does not trigger an all-rank reduction; boundary condition setup then scales
+    // with the number of boundary conditions rather than the number of processes. A process
+    // whose portion of the label is empty places no requirement on other processes.
+    PetscInt maxConeSizeLocal = 0;
     err = DMPlexGetMaxSizes(dmSubmesh, &maxConeSizeLocal, NULL);PYLITH_CHECK_ERROR(err);
-    err = MPI_Allreduce(&maxConeSizeLocal, &maxConeSize, 1, MPI_INT, MPI_MAX,
-                        PetscObjectComm((PetscObject) dmSubmesh));PYLITH_CHECK_ERROR(err);
+    const PetscInt hasCellsLocal = (maxConeSizeLocal > 0) ? 1 : 0;
+    PetscInt hasCellsNearby = hasCellsLocal;
+
+    PetscSF pointSF = NULL;
+    PetscInt numRoots = -1;
+    err = DMGetPointSF(dmDomain, &pointSF);PYLITH_CHECK_ERROR(err);
+    if (pointSF) {
+        err = PetscSFGetGraph(pointSF, &numRoots, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (numRoots > 0) { // Distributed mesh; exchange flags with processes sharing points.
+        std::vector<PetscInt> pointFlags(numRoots, hasCellsLocal);
+        err = PetscSFReduceBegin(pointSF, MPIU_INT, &pointFlags[0], &pointFlags[0], MPI_LOR);PYLITH_CHECK_ERROR(err);
+        err = PetscSFReduceEnd(pointSF, MPIU_INT, &pointFlags[0], &pointFlags[0], MPI_LOR);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastBegin(pointSF, MPIU_INT, &pointFlags[0], &pointFlags[0], MPI_LOR);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastEnd(pointSF, MPIU_INT, &pointFlags[0], &pointFlags[0], MPI_LOR);PYLITH_CHECK_ERROR(err);
+
+        if (!hasCellsNearby) {
+            PetscIS stratumIS = getStratumIS(dmDomain, labelName, labelValue);
+            if (stratumIS) {
+                PetscInt numPoints = 0;
+                const PetscInt* points = NULL;
+                err = ISGetLocalSize(stratumIS, &numPoints);PYLITH_CHECK_ERROR(err);
+                err = ISGetIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
+                for (PetscInt p = 0; p < numPoints; ++p) {
+                    if ((points[p] < numRoots) && pointFlags[points[p]]) {
+                        hasCellsNearby = 1;
+                        break;
+                    } // if
+                } // for
+                err = ISRestoreIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
+                err = ISDestroy(&stratumIS);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // if
+    } // if
 
-    if (maxConeSize <= 0) {
+    PetscInt stratumSizeLocal = 0;
+    err = DMLabelGetStratumSize(dmLabel, labelValue, &stratumSizeLocal);PYLITH_CHECK_ERROR(err);
+    int commSize = 0;
+    err = MPI_Comm_size(mesh.getComm(), &commSize);PYLITH_CHECK_ERROR(err);
+    if (((stratumSizeLocal > 0) || (1 == commSize)) && !hasCellsNearby) {
         err = DMDestroy(&dmSubmesh);PYLITH_CHECK_ERROR(err);
         std::ostringstream msg;
         msg << "Error while creating lower dimension mesh. Submesh '" << labelName
@@ -278,6 +356,161 @@ pylith::topology::MeshOps::checkTopology(const Mesh& mesh) {
 } // checkTopology
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute and log mesh statistics for pre-run checks.
+void
+pylith::topology::MeshOps::writeStatistics(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscErrorCode err = 0;
+    MPI_Comm comm = mesh.getComm();
+    const int dim = mesh.getDimension();
+
+    PylithInt cStart = 0, cEnd = 0;
+    PylithInt vStart = 0, vEnd = 0;
+    const int cellHeight = 0;
+    err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel materialLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &materialLabel);PYLITH_CHECK_ERROR(err);assert(materialLabel);
+
+    // Range of material label values over all processes (material ids are small integers).
+    PylithInt valueMinLocal = PETSC_MAX_INT, valueMaxLocal = PETSC_MIN_INT;
+    PetscIS valuesIS = NULL;
+    PylithInt numValues = 0;
+    const PylithInt* values = NULL;
+    err = DMLabelGetValueIS(materialLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PylithInt iValue = 0; iValue < numValues; ++iValue) {
+        valueMinLocal = std::min(valueMinLocal, values[iValue]);
+        valueMaxLocal = std::max(valueMaxLocal, values[iValue]);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+    PylithInt valueMin = 0, valueMax = 0;
+    MPI_Allreduce(&valueMinLocal, &valueMin, 1, MPIU_INT, MPI_MIN, comm);
+    MPI_Allreduce(&valueMaxLocal, &valueMax, 1, MPIU_INT, MPI_MAX, comm);
+    const PylithInt maxNumMaterials = 1024;
+    const PylithInt numMaterialSlots = std::min(valueMax - valueMin + 1, maxNumMaterials);
+    std::vector<PylithInt> materialCountsLocal(numMaterialSlots, 0);
+
+    // Single pass over cells: quality histogram (condition number of cell Jacobian, log2 bins),
+    // per-material cell counts, and estimated assembly cost (cohesive cells are more expensive).
+    const int numBins = 8;
+    PylithInt qualityBinsLocal[numBins];
+    for (int iBin = 0; iBin < numBins; ++iBin) {
+        qualityBinsLocal[iBin] = 0;
+    } // for
+    PylithInt numCohesiveLocal = 0;
+    PylithInt numDegenerateLocal = 0;
+    PylithInt costLocal = 0;
+    const int costCohesive = 4;
+    for (PylithInt cell = cStart; cell < cEnd; ++cell) {
+        PylithInt value = 0;
+        err = DMLabelGetValue(materialLabel, cell, &value);PYLITH_CHECK_ERROR(err);
+        if ((value >= valueMin) && (value - valueMin < numMaterialSlots)) {
+            ++materialCountsLocal[value-valueMin];
+        } // if
+
+        if (isCohesiveCell(dmMesh, cell)) {
+            ++numCohesiveLocal;
+            costLocal += costCohesive;
+            continue; // Cohesive cells have zero volume; no quality metric.
+        } // if
+        costLocal += 1;
+
+        PetscReal v0[3], cellJ[9], cellInvJ[9], detJ = 0.0;
+        err = DMPlexComputeCellGeometryAffineFEM(dmMesh, cell, v0, cellJ, cellInvJ, &detJ);PYLITH_CHECK_ERROR(err);
+        if (detJ <= 0.0) {
+            ++numDegenerateLocal;
+            continue;
+        } // if
+        PetscReal normJ = 0.0, normInvJ = 0.0;
+        for (int i = 0; i < dim*dim; ++i) {
+            normJ += cellJ[i] * cellJ[i];
+            normInvJ += cellInvJ[i] * cellInvJ[i];
+        } // for
+        const PetscReal condition = sqrt(normJ * normInvJ) / dim;
+        int iBin = 0;
+        PetscReal scale = condition;
+        while ((scale >= 2.0) && (iBin < numBins-1)) {
+            scale /= 2.0;
+            ++iBin;
+        } // while
+        ++qualityBinsLocal[iBin];
+    } // for
+
+    // Rough per-process memory footprint (sparse Jacobian, solver vectors, mesh topology)
+    // assuming basis order 1 and solution dof equal to the spatial dimension.
+    const PylithInt numCorners = getNumCorners(mesh);
+    const double ndofsLocal = double(vEnd-vStart) * dim;
+    const double rowNonzeros = double(dim) * ((3 == dim) ? 27 : 9);
+    const double bytesLocal =
+        ndofsLocal * rowNonzeros * (sizeof(PetscScalar) + sizeof(PetscInt))
+        + ndofsLocal * 12 * sizeof(PetscScalar)
+        + double(cEnd-cStart) * numCorners * 4 * sizeof(PetscInt);
+    const double memoryMbLocal = bytesLocal / (1024.0*1024.0);
+
+    // Reduce statistics over all processes.
+    PetscMPIInt commSize = 0;
+    MPI_Comm_size(comm, &commSize);
+    PylithInt qualityBins[numBins];
+    std::vector<PylithInt> materialCounts(numMaterialSlots, 0);
+    const PylithInt numCellsLocal = cEnd - cStart;
+    PylithInt numCells = 0, numCellsMin = 0, numCellsMax = 0;
+    PylithInt numCohesive = 0, numDegenerate = 0;
+    PylithInt cost = 0, costMin = 0, costMax = 0;
+    double memoryMb = 0.0, memoryMbMax = 0.0;
+    MPI_Allreduce(qualityBinsLocal, qualityBins, numBins, MPIU_INT, MPI_SUM, comm);
+    if (numMaterialSlots > 0) {
+        MPI_Allreduce(&materialCountsLocal[0], &materialCounts[0], numMaterialSlots, MPIU_INT, MPI_SUM, comm);
+    } // if
+    MPI_Allreduce(&numCellsLocal, &numCells, 1, MPIU_INT, MPI_SUM, comm);
+    MPI_Allreduce(&numCellsLocal, &numCellsMin, 1, MPIU_INT, MPI_MIN, comm);
+    MPI_Allreduce(&numCellsLocal, &numCellsMax, 1, MPIU_INT, MPI_MAX, comm);
+    MPI_Allreduce(&numCohesiveLocal, &numCohesive, 1, MPIU_INT, MPI_SUM, comm);
+    MPI_Allreduce(&numDegenerateLocal, &numDegenerate, 1, MPIU_INT, MPI_SUM, comm);
+    MPI_Allreduce(&costLocal, &cost, 1, MPIU_INT, MPI_SUM, comm);
+    MPI_Allreduce(&costLocal, &costMin, 1, MPIU_INT, MPI_MIN, comm);
+    MPI_Allreduce(&costLocal, &costMax, 1, MPIU_INT, MPI_MAX, comm);
+    MPI_Allreduce(&memoryMbLocal, &memoryMb, 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(&memoryMbLocal, &memoryMbMax, 1, MPI_DOUBLE, MPI_MAX, comm);
+
+    if (0 == mesh.getCommRank()) {
+        const double costAvg = double(cost) / commSize;
+        pythia::journal::info_t info("meshops");
+        info << pythia::journal::at(__HERE__)
+             << "Mesh statistics over " << commSize << " processes:"
+             << "\n    Cells: total=" << numCells << ", min/max per process=" << numCellsMin << "/" << numCellsMax
+             << ", cohesive=" << numCohesive << ", degenerate=" << numDegenerate
+             << "\n    Estimated assembly cost (cell units): min/max per process=" << costMin << "/" << costMax
+             << ", imbalance=" << ((costAvg > 0) ? costMax / costAvg : 1.0)
+             << "\n    Estimated memory: total=" << memoryMb << " MB, max per process=" << memoryMbMax << " MB"
+             << "\n    Cell quality (condition number of cell Jacobian):";
+        for (int iBin = 0; iBin < numBins; ++iBin) {
+            const int binMin = 1 << iBin;
+            if (iBin < numBins-1) {
+                info << "\n        [" << binMin << ", " << 2*binMin << "): " << qualityBins[iBin];
+            } else {
+                info << "\n        [" << binMin << ", inf): " << qualityBins[iBin];
+            } // if/else
+        } // for
+        info << "\n    Cells per material:";
+        for (PylithInt iSlot = 0; iSlot < numMaterialSlots; ++iSlot) {
+            if (materialCounts[iSlot] > 0) {
+                info << "\n        " << valueMin + iSlot << ": " << materialCounts[iSlot];
+            } // if
+        } // for
+        info << pythia::journal::endl;
+    } // if
+
+    PYLITH_METHOD_END;
+} // writeStatistics
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 bool
 pylith::topology::MeshOps::isSimplexMesh(const Mesh& mesh) {
@@ -392,6 +625,112 @@ pylith::topology::MeshOps::getNumCorners(const pylith::topology::Mesh& mesh) {
 }
 
 
+// ----------------------------------------------------------------------
+// Get index set of points for a label and value, caching the index set for reuse.
+PetscIS
+pylith::topology::MeshOps::getStratumIS(const PetscDM dm,
+                                        const char* labelName,
+                                        const int labelValue) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(dm);
+    assert(labelName);
+
+    PetscErrorCode err = 0;
+    PetscDMLabel dmLabel = NULL;
+    err = DMGetLabel(dm, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);
+    if (!dmLabel) {
+        PYLITH_METHOD_RETURN(PetscIS(NULL));
+    } // if
+
+    // Rebuild the cached index set if the label has changed since the index set was built.
+    PetscObjectState labelState = 0;
+    err = PetscObjectStateGet((PetscObject)dmLabel, &labelState);PYLITH_CHECK_ERROR(err);
+
+    _StratumCache::Key key;
+    key.dm = dm;
+    key.labelName = labelName;
+    key.labelValue = labelValue;
+    _StratumCache::cache_t::iterator iter = _StratumCache::cache.find(key);
+    if ((iter == _StratumCache::cache.end()) || (iter->second.labelState != labelState)) {
+        PetscIS pointsIS = NULL;
+        err = DMLabelGetStratumIS(dmLabel, labelValue, &pointsIS);PYLITH_CHECK_ERROR(err);
+        // Building the index set can sort the label hashes, so reread the state afterwards.
+        err = PetscObjectStateGet((PetscObject)dmLabel, &labelState);PYLITH_CHECK_ERROR(err);
+        if (iter != _StratumCache::cache.end()) {
+            err = ISDestroy(&iter->second.pointsIS);PYLITH_CHECK_ERROR(err);
+            iter->second.labelState = labelState;
+            iter->second.pointsIS = pointsIS;
+        } else {
+            _StratumCache::Entry entry;
+            entry.labelState = labelState;
+            entry.pointsIS = pointsIS;
+            iter = _StratumCache::cache.insert(std::make_pair(key, entry)).first;
+        } // if/else
+    } // if
+
+    PetscIS pointsIS = iter->second.pointsIS;
+    if (pointsIS) {
+        err = PetscObjectReference((PetscObject)pointsIS);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(pointsIS);
+} // getStratumIS
+
+
+// ----------------------------------------------------------------------
+// Discard cached stratum index sets for a DM.
+void
+pylith::topology::MeshOps::clearStratumCache(const PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    _StratumCache::cache_t::iterator iter = _StratumCache::cache.begin();
+    while (iter != _StratumCache::cache.end()) {
+        if (iter->first.dm == dm) {
+            err = ISDestroy(&iter->second.pointsIS);PYLITH_CHECK_ERROR(err);
+            _StratumCache::cache.erase(iter++);
+        } else {
+            ++iter;
+        } // if/else
+    } // while
+
+    PYLITH_METHOD_END;
+} // clearStratumCache
+
+
+// ----------------------------------------------------------------------
+// Get contiguous ranges of cells with the same cell type.
+std::vector<pylith::topology::MeshOps::CellTypeRange>
+pylith::topology::MeshOps::getCellTypeRanges(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PylithInt cStart = 0, cEnd = 0;
+    const int cellHeight = 0;
+    PetscErrorCode err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+    std::vector<CellTypeRange> ranges;
+    DMPolytopeType ctRange = DM_POLYTOPE_UNKNOWN;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        DMPolytopeType ct;
+        err = DMPlexGetCellType(dmMesh, cell, &ct);PYLITH_CHECK_ERROR(err);
+        if (ranges.empty() || (ct != ctRange)) {
+            CellTypeRange range;
+            range.cellType = ct;
+            range.cellStart = cell;
+            range.cellEnd = cell+1;
+            ranges.push_back(range);
+            ctRange = ct;
+        } else {
+            ranges.back().cellEnd = cell+1;
+        } // if/else
+    } // for
+
+    PYLITH_METHOD_RETURN(ranges);
+} // getCellTypeRanges
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 void
 pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mesh,
@@ -465,4 +804,56 @@ pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mes
 } // checkMaterialIds
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Save mesh topology (including cohesive cells and labels) to a cache file.
+void
+pylith::topology::MeshOps::saveTopologyCache(const pylith::topology::Mesh& mesh,
+                                             const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(filename);
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscErrorCode err = 0;
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(mesh.getComm(), filename, FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMView(dmMesh, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // saveTopologyCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Load mesh topology (including cohesive cells and labels) from a cache file.
+void
+pylith::topology::MeshOps::loadTopologyCache(pylith::topology::Mesh* mesh,
+                                             const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(filename);
+
+    PetscErrorCode err = 0;
+
+    PetscDM dmMesh = NULL;
+    err = DMCreate(mesh->getComm(), &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = DMSetType(dmMesh, DMPLEX);PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(mesh->getComm(), filename, FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMLoad(dmMesh, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    mesh->setDM(dmMesh);
+
+    PYLITH_METHOD_END;
+} // loadTopologyCache
+
+
 // End of file
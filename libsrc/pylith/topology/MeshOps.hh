@@ -33,9 +33,21 @@
 #include "spatialdata/geocoords/geocoordsfwd.hh"
 #include "spatialdata/units/unitsfwd.hh"
 
+#include <vector> // USES std::vector
+
 class pylith::topology::MeshOps {
     friend class TestMeshOps; // unit testing
 
+    // PUBLIC STRUCTS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Contiguous range of cells with the same cell type.
+    struct CellTypeRange {
+        PylithInt cellType; ///< Cell type (DMPolytopeType) of cells in range.
+        PylithInt cellStart; ///< First cell in range.
+        PylithInt cellEnd; ///< One past last cell in range.
+    }; // CellTypeRange
+
     // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -98,6 +110,18 @@ public:
     static
     void checkTopology(const Mesh& mesh);
 
+    /** Compute and log mesh statistics for pre-run checks.
+     *
+     * Computes a cell quality histogram, per-material cell counts, an estimated memory
+     * footprint per process, and an estimated relative assembly cost per process in a single
+     * parallel pass over the cells. Intended as a fast pre-flight check of partition balance
+     * and memory use before committing to a long run.
+     *
+     * @param[in] mesh Finite-element mesh.
+     */
+    static
+    void writeStatistics(const Mesh& mesh);
+
     /** Determine is mesh contains simplex cells (i.e., line, tri, tet).
      *
      * @param[in] mesh Finite-element mesh.
@@ -140,6 +164,71 @@ public:
     static
     PylithInt getNumCorners(const pylith::topology::Mesh& mesh);
 
+    /** Get index set of points for a label and value, caching the index set for reuse.
+     *
+     * Label queries are scattered across initialization (integrators, output, constraints),
+     * and each DMLabelGetStratumIS() call rebuilds the index set from the label hashes. The
+     * cache builds one immutable sorted index array per (DM, label, value) on first query and
+     * shares it across all consumers; cached entries are rebuilt if the label state changes
+     * and discarded by clearStratumCache() when the DM is destroyed.
+     *
+     * The caller is responsible for calling ISDestroy() on the returned index set, matching
+     * the reference semantics of DMLabelGetStratumIS().
+     *
+     * @param[in] dm PETSc DM holding label.
+     * @param[in] labelName Name of label.
+     * @param[in] labelValue Label value.
+     * @returns PETSc IS of points with label value (NULL if label or points are absent).
+     */
+    static
+    PetscIS getStratumIS(const PetscDM dm,
+                         const char* labelName,
+                         const int labelValue);
+
+    /** Discard cached stratum index sets for a DM.
+     *
+     * Must be called before destroying a DM with cached strata so a new DM allocated at the
+     * same address cannot match stale cache entries.
+     *
+     * @param[in] dm PETSc DM being destroyed.
+     */
+    static
+    void clearStratumCache(const PetscDM dm);
+
+    /** Get contiguous ranges of cells with the same cell type.
+     *
+     * Segments the cells stratum into runs of cells with the same cell type so loops over
+     * cells in hybrid meshes (e.g., tri/quad or tet/hex) can use type-homogeneous inner loops
+     * without per-cell branching. A cell type appears in more than one range if its cells are
+     * interleaved with cells of other types.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @returns Ranges of cells, ordered by first cell in range.
+     */
+    static
+    std::vector<CellTypeRange> getCellTypeRanges(const pylith::topology::Mesh& mesh);
+
+    /** Save mesh topology (including cohesive cells and labels) to a cache file.
+     *
+     * Used to avoid recomputing the cohesive topology from the fault labels on
+     * subsequent runs with the same mesh and faults.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] filename Name of HDF5 cache file.
+     */
+    static
+    void saveTopologyCache(const Mesh& mesh,
+                           const char* filename);
+
+    /** Load mesh topology (including cohesive cells and labels) from a cache file.
+     *
+     * @param[inout] mesh Finite-element mesh (coordinate system must be set).
+     * @param[in] filename Name of HDF5 cache file.
+     */
+    static
+    void loadTopologyCache(Mesh* mesh,
+                           const char* filename);
+
     /** Check to make sure material label value for every cell matches the label value of
      *  one of the materials.
      *
@@ -30,7 +30,9 @@
 
 // ----------------------------------------------------------------------
 // Constructor
-pylith::topology::RefineUniform::RefineUniform(void) {}
+pylith::topology::RefineUniform::RefineUniform(void) :
+    _vertexFn(NULL),
+    _vertexContext(NULL) {}
 
 
 // ----------------------------------------------------------------------
@@ -43,7 +45,20 @@ pylith::topology::RefineUniform::~RefineUniform(void) {
 // ----------------------------------------------------------------------
 // Deallocate data structures.
 void
-pylith::topology::RefineUniform::deallocate(void) {}
+pylith::topology::RefineUniform::deallocate(void) {
+    _vertexFn = NULL;
+    _vertexContext = NULL;
+}
+
+
+// ----------------------------------------------------------------------
+// Set callback for adjusting the locations of vertices in the refined mesh.
+void
+pylith::topology::RefineUniform::setVertexPlacement(vertex_placement_fn fn,
+                                                    void* context) {
+    _vertexFn = fn;
+    _vertexContext = context;
+} // setVertexPlacement
 
 
 // ----------------------------------------------------------------------
@@ -78,11 +93,18 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     PetscDM dmNew = NULL;
     err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     err = DMRefine(dmOrig, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
+    // Drop the reference to the parent mesh held by the refined mesh so that the memory for
+    // intermediate meshes is released as we refine level by level instead of retaining the entire
+    // refinement hierarchy.
+    err = DMSetCoarseDM(dmNew, NULL);PYLITH_CHECK_ERROR(err);
+    _snapVertices(dmNew);
 
     for (int i = 1; i < levels; ++i) {
         PetscDM dmCur = dmNew;dmNew = NULL;
         err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
         err = DMRefine(dmCur, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
+        err = DMSetCoarseDM(dmNew, NULL);PYLITH_CHECK_ERROR(err);
+        _snapVertices(dmNew);
 
         err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
     } // for
@@ -129,4 +151,40 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
 } // refine
 
 
+// ----------------------------------------------------------------------
+// Apply vertex placement callback to vertices of refined mesh.
+void
+pylith::topology::RefineUniform::_snapVertices(PetscDM dmMesh) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_vertexFn) {
+        PYLITH_METHOD_END;
+    } // if
+    assert(dmMesh);
+
+    PetscErrorCode err;
+    PetscVec coordsVec = NULL;
+    err = DMGetCoordinatesLocal(dmMesh, &coordsVec);PYLITH_CHECK_ERROR(err);assert(coordsVec);
+    PetscSection coordsSection = NULL;
+    err = DMGetCoordinateSection(dmMesh, &coordsSection);PYLITH_CHECK_ERROR(err);assert(coordsSection);
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmMesh, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscScalar* coordsArray = NULL;
+    err = VecGetArray(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        PetscInt off = 0;
+        err = PetscSectionGetOffset(coordsSection, vertex, &off);PYLITH_CHECK_ERROR(err);
+        _vertexFn(&coordsArray[off], spaceDim, _vertexContext);
+    } // for
+    err = VecRestoreArray(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    err = DMSetCoordinatesLocal(dmMesh, coordsVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _snapVertices
+
+
 // End of file
@@ -28,6 +28,9 @@
 // Include directives ---------------------------------------------------
 #include "topologyfwd.hh" // forward declarations
 
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+#include "pylith/utils/types.hh" // USES PylithScalar
+
 // RefineUniform --------------------------------------------------------
 /// Object for managing uniform global mesh refinement.
 class pylith::topology::RefineUniform
@@ -37,6 +40,11 @@ class pylith::topology::RefineUniform
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
+  /// Function prototype for adjusting the location of a vertex in a refined mesh.
+  typedef void (*vertex_placement_fn)(PylithScalar* coordsVertex,
+				      const int spaceDim,
+				      void* context);
+
   /// Constructor
   RefineUniform(void);
 
@@ -46,6 +54,18 @@ public :
   /// Deallocate data structures.
   void deallocate(void);
 
+  /** Set callback for adjusting the locations of vertices in the refined mesh.
+   *
+   * The callback is applied to every vertex after each refinement level so that new vertices can
+   * be snapped to curved geometry (e.g., fault surfaces); it must be a projection (applying it to
+   * a vertex already on the geometry must leave the vertex unchanged).
+   *
+   * @param fn Vertex placement callback.
+   * @param context Context passed to callback.
+   */
+  void setVertexPlacement(vertex_placement_fn fn,
+			  void* context);
+
   /** Refine mesh.
    *
    * @param newMesh Refined mesh (result).
@@ -56,6 +76,21 @@ public :
 	      const Mesh& mesh,
 	      const int levels =1);
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Apply vertex placement callback to vertices of refined mesh.
+   *
+   * @param dmMesh PETSc DM for refined mesh.
+   */
+  void _snapVertices(PetscDM dmMesh);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  vertex_placement_fn _vertexFn; ///< Callback for adjusting locations of vertices.
+  void* _vertexContext; ///< Context passed to vertex placement callback.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -23,6 +23,50 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 
+#include <algorithm> // USES std::sort
+#include <vector> // USES std::vector
+#include <stdint.h> // USES uint64_t
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        namespace _ReverseCuthillMcKee {
+            /** Compute Morton (z-order) key for point within bounding box.
+             *
+             * @param[in] coords Coordinates of point.
+             * @param[in] coordsMin Minimum coordinates of bounding box.
+             * @param[in] coordsMax Maximum coordinates of bounding box.
+             * @param[in] dim Spatial dimension.
+             *
+             * @returns Morton key.
+             */
+            static
+            uint64_t mortonKey(const PetscReal coords[],
+                               const PetscReal coordsMin[],
+                               const PetscReal coordsMax[],
+                               const int dim) {
+                const int numBits = 63 / dim;
+                uint64_t indices[3] = { 0, 0, 0 };
+                for (int i = 0; i < dim; ++i) {
+                    const PetscReal extent = coordsMax[i] - coordsMin[i];
+                    PetscReal relative = (extent > 0) ? (coords[i] - coordsMin[i]) / extent : 0.0;
+                    if (relative < 0.0) { relative = 0.0; }
+                    if (relative > 1.0) { relative = 1.0; }
+                    indices[i] = uint64_t(relative * ((uint64_t(1) << numBits) - 1));
+                } // for
+                uint64_t key = 0;
+                for (int bit = numBits-1; bit >= 0; --bit) {
+                    for (int i = 0; i < dim; ++i) {
+                        key = (key << 1) | ((indices[i] >> bit) & 1);
+                    } // for
+                } // for
+                return key;
+            } // mortonKey
+
+        } // _ReverseCuthillMcKee
+    } // topology
+} // pylith
+
 // ----------------------------------------------------------------------
 // Reorder vertices and cells in mesh.
 void
@@ -78,4 +122,73 @@ pylith::topology::ReverseCuthillMcKee::reorder(topology::Mesh* mesh) {
 } // reorder
 
 
+// ----------------------------------------------------------------------
+// Reorder cells of mesh along a space-filling curve for cache locality.
+void
+pylith::topology::ReverseCuthillMcKee::reorderCellsLocality(topology::Mesh* mesh) {
+    assert(mesh);
+    PetscErrorCode err = 0;
+
+    PetscDM dmOrig = mesh->getDM();assert(dmOrig);
+    PetscInt dim = 0;
+    err = DMGetCoordinateDim(dmOrig, &dim);PYLITH_CHECK_ERROR(err);
+    PetscReal coordsMin[3], coordsMax[3];
+    err = DMGetBoundingBox(dmOrig, coordsMin, coordsMax);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> permArray(pEnd-pStart);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        permArray[point-pStart] = point; // Identity for points not reordered (vertices, edges, faces).
+    } // for
+
+    // Sort cells by the Morton key of their centroid within each block of cells with the same
+    // material label value, keeping the cells for each material consecutive.
+    PetscDMLabel dmLabel = NULL;
+    const char* const labelName = pylith::topology::Mesh::cells_label_name;
+    err = DMGetLabel(dmOrig, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMLabelGetValueIS(dmLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(dmLabel, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+
+        std::vector<std::pair<uint64_t, PetscInt> > keys(numPoints);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            const PetscInt cell = points[iPoint];
+            PetscReal volume = 0.0, centroid[3];
+            err = DMPlexComputeCellGeometryFVM(dmOrig, cell, &volume, centroid, NULL);PYLITH_CHECK_ERROR(err);
+            keys[iPoint] = std::make_pair(_ReverseCuthillMcKee::mortonKey(centroid, coordsMin, coordsMax, dim), cell);
+        } // for
+        std::sort(keys.begin(), keys.end());
+
+        // Stratum points are sorted, so they are also the positions the reordered cells occupy.
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            permArray[keys[iPoint].second - pStart] = points[iPoint];
+        } // for
+
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    PetscIS permutation = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, pEnd-pStart, &permArray[0], PETSC_COPY_VALUES, &permutation);PYLITH_CHECK_ERROR(err);
+    err = ISSetPermutation(permutation);PYLITH_CHECK_ERROR(err);
+    PetscDM dmNew = NULL;
+    err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmNew);
+} // reorderCellsLocality
+
+
 // End of file
@@ -44,6 +44,17 @@ public :
   static
   void reorder(topology::Mesh* mesh);
 
+  /** Reorder cells of mesh along a space-filling curve for cache locality.
+   *
+   * Cells are sorted by the Morton key of their centroid within each block of cells with the same
+   * material label value, so cells for each material remain consecutive. Vertices are not
+   * reordered. Fields created after reordering (e.g., auxiliary fields) inherit the cell ordering.
+   *
+   * @param mesh PyLith finite-element mesh.
+   */
+  static
+  void reorderCellsLocality(topology::Mesh* mesh);
+
 }; // ReverseCuthillMcKee
 
 #endif // pylith_topology_reversecuthillmckee_hh
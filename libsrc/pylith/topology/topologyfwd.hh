@@ -45,8 +45,10 @@ namespace pylith {
 
         class FE;
         class FieldFactory;
+        class FieldDB;
         class FieldOps;
         class FieldQuery;
+        class FieldSoAView;
 
         class MatVisitorMesh;
         class MatVisitorSubmesh;
@@ -0,0 +1,304 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "AnalyticDB.hh" // implementation of class methods
+
+#include "pylith/utils/Expression.hh" // USES Expression
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/geocoords/Converter.hh" // USES Converter
+#include "spatialdata/units/Parser.hh" // USES Parser
+
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <cstring> // USES strcasecmp()
+#include <thread> // USES std::thread
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::utils::AnalyticDB::AnalyticDB(void) :
+    _compiled(NULL),
+    _cs(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::utils::AnalyticDB::~AnalyticDB(void) {
+    delete[] _compiled;_compiled = NULL;
+    delete _cs;_cs = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values, units, and expressions in database.
+void
+pylith::utils::AnalyticDB::setData(const char* const* names,
+                                   const char* const* units,
+                                   const char* const* expressions,
+                                   const int numValues) {
+    assert((names && units && expressions && numValues > 0) ||
+           (!names && !units && !expressions && 0 == numValues));
+
+    _names.resize(numValues);
+    _units.resize(numValues);
+    _expressions.resize(numValues);
+    for (int i = 0; i < numValues; ++i) {
+        _names[i] = names[i];
+        _units[i] = units[i];
+        _expressions[i] = expressions[i];
+    } // for
+} // setData
+
+
+// ------------------------------------------------------------------------------------------------
+// Set coordinate system associated with expressions.
+void
+pylith::utils::AnalyticDB::setCoordSys(const spatialdata::geocoords::CoordSys& cs) {
+    delete _cs;_cs = cs.clone();
+} // setCoordSys
+
+
+// ------------------------------------------------------------------------------------------------
+// Open the database and prepare for querying; compiles the expressions.
+void
+pylith::utils::AnalyticDB::open(void) {
+    if (_names.empty()) {
+        std::ostringstream msg;
+        msg << "No values given for analytic spatial database '" << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!_cs) {
+        std::ostringstream msg;
+        msg << "No coordinate system given for analytic spatial database '" << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Convert units to scales for converting values to SI units.
+    spatialdata::units::Parser parser;
+    const size_t numValues = _names.size();
+    _scales.resize(numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+        _scales[i] = (0 != strcasecmp(_units[i].c_str(), "none")) ? parser.parse(_units[i].c_str()) : 1.0;
+    } // for
+
+    // Compile expressions into stack programs evaluated per query.
+    const size_t spaceDim = _cs->getSpaceDim();
+    static const char* coordinateNames[3] = { "x", "y", "z" };
+    pylith::string_vector variableNames(spaceDim);
+    for (size_t i = 0; i < spaceDim; ++i) {
+        variableNames[i] = coordinateNames[i];
+    } // for
+    delete[] _compiled;_compiled = new pylith::utils::Expression[numValues];
+    for (size_t i = 0; i < numValues; ++i) {
+        try {
+            _compiled[i].compile(_expressions[i].c_str(), variableNames);
+        } catch (const std::exception& err) {
+            std::ostringstream msg;
+            msg << "Error compiling expression '" << _expressions[i] << "' for value '" << _names[i]
+                << "' in analytic spatial database '" << getDescription() << "'.\n" << err.what();
+            throw std::runtime_error(msg.str());
+        } // try/catch
+    } // for
+
+    // Default query returns all values in the order given.
+    _queryIndices.resize(numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+        _queryIndices[i] = i;
+    } // for
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close the database.
+void
+pylith::utils::AnalyticDB::close(void) {
+    delete[] _compiled;_compiled = NULL;
+    _scales.clear();
+    _queryIndices.clear();
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Get names of values in spatial database.
+void
+pylith::utils::AnalyticDB::getNamesDBValues(const char*** valueNames,
+                                            size_t* numValues) const {
+    const size_t size = _names.size();
+    const char** names = (size > 0) ? new const char*[size] : NULL;
+    for (size_t i = 0; i < size; ++i) {
+        names[i] = _names[i].c_str();
+    } // for
+
+    if (valueNames) { *valueNames = names; }
+    if (numValues) { *numValues = size; }
+} // getNamesDBValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values to be returned by queries.
+void
+pylith::utils::AnalyticDB::setQueryValues(const char* const* names,
+                                          const size_t numVals) {
+    if (0 == numVals) {
+        std::ostringstream msg;
+        msg << "Number of values for query in analytic spatial database '" << getDescription()
+            << "' must be positive.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    assert(names && numVals > 0);
+
+    const size_t numValues = _names.size();
+    _queryIndices.resize(numVals);
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        size_t iName = 0;
+        for (; iName < numValues; ++iName) {
+            if (0 == strcasecmp(names[iVal], _names[iName].c_str())) {
+                _queryIndices[iVal] = iName;
+                break;
+            } // if
+        } // for
+        if (iName == numValues) {
+            std::ostringstream msg;
+            msg << "Could not find value '" << names[iVal] << "' in analytic spatial database '"
+                << getDescription() << "'. Available values are:";
+            for (size_t i = 0; i < numValues; ++i) {
+                msg << "\n  " << _names[i];
+            } // for
+            msg << "\n";
+            throw std::out_of_range(msg.str());
+        } // if
+    } // for
+} // setQueryValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database.
+int
+pylith::utils::AnalyticDB::query(double* vals,
+                                 const size_t numVals,
+                                 const double* coords,
+                                 const size_t numDims,
+                                 const spatialdata::geocoords::CoordSys* csQuery) {
+    _checkQuery(numVals);
+    assert(coords && numDims == size_t(_cs->getSpaceDim()));
+
+    // Convert coordinates to coordinate system of expressions.
+    double xyz[3] = { 0.0, 0.0, 0.0 };
+    for (size_t i = 0; i < numDims; ++i) {
+        xyz[i] = coords[i];
+    } // for
+    assert(csQuery);
+    spatialdata::geocoords::Converter::convert(xyz, 1, numDims, _cs, csQuery);
+
+    _evaluate(vals, numVals, xyz);
+
+    return 0;
+} // query
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database at multiple locations.
+void
+pylith::utils::AnalyticDB::queryMulti(double* vals,
+                                      const size_t numVals,
+                                      const double* coords,
+                                      const size_t numLocs,
+                                      const size_t numDims,
+                                      const spatialdata::geocoords::CoordSys* csQuery) {
+    _checkQuery(numVals);
+    assert((coords && numLocs > 0) || (0 == numLocs));
+    assert(numDims == size_t(_cs->getSpaceDim()));
+
+    if (0 == numLocs) {
+        return;
+    } // if
+
+    // Convert coordinates of all locations to the coordinate system of the expressions in a
+    // single call, amortizing the per-call projection setup of geographic coordinate systems.
+    std::vector<double> xyz(coords, coords + numLocs*numDims);
+    assert(csQuery);
+    spatialdata::geocoords::Converter::convert(&xyz[0], numLocs, numDims, _cs, csQuery);
+
+    // Evaluating a compiled expression only reads the stack program, so large batches are
+    // split among threads.
+    const size_t minLocsPerThread = 5000;
+    const size_t maxThreads = std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+    const size_t numThreads = std::min(maxThreads, std::max(size_t(1), numLocs / minLocsPerThread));
+    if (numThreads > 1) {
+        std::vector<std::thread> threads;
+        const size_t locsPerThread = (numLocs + numThreads - 1) / numThreads;
+        for (size_t iThread = 0; iThread < numThreads; ++iThread) {
+            const size_t locBegin = iThread * locsPerThread;
+            const size_t locEnd = std::min(numLocs, locBegin + locsPerThread);
+            threads.push_back(std::thread([this, vals, numVals, &xyz, numDims, locBegin, locEnd]() {
+                    for (size_t iLoc = locBegin; iLoc < locEnd; ++iLoc) {
+                        _evaluate(&vals[iLoc*numVals], numVals, &xyz[iLoc*numDims]);
+                    } // for
+                }));
+        } // for
+        for (size_t iThread = 0; iThread < numThreads; ++iThread) {
+            threads[iThread].join();
+        } // for
+    } else {
+        for (size_t iLoc = 0; iLoc < numLocs; ++iLoc) {
+            _evaluate(&vals[iLoc*numVals], numVals, &xyz[iLoc*numDims]);
+        } // for
+    } // if/else
+} // queryMulti
+
+
+// ------------------------------------------------------------------------------------------------
+// Check that the database is open and the query size matches the query values.
+void
+pylith::utils::AnalyticDB::_checkQuery(const size_t numVals) const {
+    const size_t numQueryValues = _queryIndices.size();
+    if (0 == numQueryValues) {
+        std::ostringstream msg;
+        msg << "Values to be returned by queries of analytic spatial database '" << getDescription()
+            << "' have not been set. Has the database been opened?";
+        throw std::logic_error(msg.str());
+    } else if (numVals != numQueryValues) {
+        std::ostringstream msg;
+        msg << "Number of values to be returned by queries of analytic spatial database '"
+            << getDescription() << "' (" << numQueryValues << ") does not match size of array provided ("
+            << numVals << ").";
+        throw std::invalid_argument(msg.str());
+    } // if/else
+    assert(_compiled);
+    assert(_cs);
+} // _checkQuery
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate the expressions at a location.
+void
+pylith::utils::AnalyticDB::_evaluate(double* vals,
+                                     const size_t numVals,
+                                     const double* xyz) const {
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        const size_t index = _queryIndices[iVal];
+        vals[iVal] = _scales[index] * _compiled[index].evaluate(xyz);
+    } // for
+} // _evaluate
+
+
+// End of file
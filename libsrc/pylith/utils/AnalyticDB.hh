@@ -0,0 +1,175 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/utils/AnalyticDB.hh
+ *
+ * @brief Spatial database of values given by analytic expressions of the spatial coordinates,
+ * compiled once at open() and evaluated at native speed per query.
+ */
+
+#if !defined(pylith_utils_analyticdb_hh)
+#define pylith_utils_analyticdb_hh
+
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/array.hh" // HASA string_vector
+#include "pylith/utils/MultiQueryDB.hh" // ISA MultiQueryDB
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // ISA SpatialDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
+
+#include <vector> // HASA std::vector
+
+class pylith::utils::AnalyticDB : public spatialdata::spatialdb::SpatialDB, public pylith::utils::MultiQueryDB {
+    friend class TestAnalyticDB; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    AnalyticDB(void);
+
+    /// Destructor.
+    ~AnalyticDB(void);
+
+    /** Set values, units, and expressions in database.
+     *
+     * Expressions are in terms of the coordinates x, y, and z (depending on the spatial
+     * dimension of the coordinate system) and are compiled when the database is opened.
+     *
+     * @param[in] names Array of names of values in database.
+     * @param[in] units Array of units for values in database ('none' for dimensionless values).
+     * @param[in] expressions Array of expressions for values in database.
+     * @param[in] numValues Number of values in database.
+     */
+    void setData(const char* const* names,
+                 const char* const* units,
+                 const char* const* expressions,
+                 const int numValues);
+
+    /** Set coordinate system associated with expressions.
+     *
+     * @param[in] cs Coordinate system.
+     */
+    void setCoordSys(const spatialdata::geocoords::CoordSys& cs);
+
+    /// Open the database and prepare for querying; compiles the expressions.
+    void open(void);
+
+    /// Close the database.
+    void close(void);
+
+    /** Get names of values in spatial database.
+     *
+     * @param[out] valueNames Array of names of values.
+     * @param[out] numValues Size of array.
+     */
+    void getNamesDBValues(const char*** valueNames,
+                          size_t* numValues) const;
+
+    /** Set values to be returned by queries.
+     *
+     * @pre Must call open() before setQueryValues().
+     *
+     * @param[in] names Names of values to be returned in queries.
+     * @param[in] numVals Number of values to be returned in queries.
+     */
+    void setQueryValues(const char* const* names,
+                        const size_t numVals);
+
+    /** Query the database.
+     *
+     * @pre Must call open() before query().
+     *
+     * @param[out] vals Values to be returned.
+     * @param[in] numVals Number of values to be returned.
+     * @param[in] coords Coordinates of point for query.
+     * @param[in] numDims Number of dimensions for coordinates.
+     * @param[in] csQuery Coordinate system of coordinates.
+     *
+     * @returns 0 on success, 1 on failure (i.e., could not interpolate).
+     */
+    int query(double* vals,
+              const size_t numVals,
+              const double* coords,
+              const size_t numDims,
+              const spatialdata::geocoords::CoordSys* csQuery);
+
+    /** Query the database at multiple locations.
+     *
+     * The coordinates of all locations are converted to the coordinate system of the expressions
+     * in a single call, and the expressions are evaluated in parallel with threads for large
+     * batches.
+     *
+     * @pre Must call open() before queryMulti().
+     *
+     * @param[out] vals Values at the locations [numLocs*numVals].
+     * @param[in] numVals Number of values to be returned per location.
+     * @param[in] coords Coordinates of the locations [numLocs*numDims].
+     * @param[in] numLocs Number of locations.
+     * @param[in] numDims Number of dimensions for coordinates.
+     * @param[in] csQuery Coordinate system of coordinates.
+     */
+    void queryMulti(double* vals,
+                    const size_t numVals,
+                    const double* coords,
+                    const size_t numLocs,
+                    const size_t numDims,
+                    const spatialdata::geocoords::CoordSys* csQuery);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Check that the database is open and the query size matches the query values.
+     *
+     * @param[in] numVals Number of values to be returned per location.
+     */
+    void _checkQuery(const size_t numVals) const;
+
+    /** Evaluate the expressions at a location.
+     *
+     * @param[out] vals Values at the location [numVals].
+     * @param[in] numVals Number of values to be returned.
+     * @param[in] xyz Coordinates of the location in the coordinate system of the expressions.
+     */
+    void _evaluate(double* vals,
+                   const size_t numVals,
+                   const double* xyz) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::string_vector _names; ///< Names of values in database.
+    pylith::string_vector _units; ///< Units of values in database.
+    pylith::string_vector _expressions; ///< Expressions for values in database.
+    std::vector<double> _scales; ///< Scales of values to convert to SI units.
+    std::vector<size_t> _queryIndices; ///< Indices of values to be returned in queries.
+    pylith::utils::Expression* _compiled; ///< Compiled expressions (one per value).
+    spatialdata::geocoords::CoordSys* _cs; ///< Coordinate system associated with expressions.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    AnalyticDB(const AnalyticDB&); ///< Not implemented.
+    const AnalyticDB& operator=(const AnalyticDB&); ///< Not implemented.
+
+}; // class AnalyticDB
+
+#endif // pylith_utils_analyticdb_hh
+
+// End of file
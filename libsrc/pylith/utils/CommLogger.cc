@@ -0,0 +1,258 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "CommLogger.hh" // Implementation of class methods
+
+#include "petscsys.h" // USES petsc_isend_ct, petsc_irecv_ct, etc.
+
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ofstream
+#include <algorithm> // USES std::min(), std::max()
+#include <cstring> // USES strlen()
+#include <cassert> // USES assert()
+
+thread_local pylith::utils::CommLogger::stats_map pylith::utils::CommLogger::_stats;
+thread_local std::vector<pylith::utils::CommLogger::OpenScope> pylith::utils::CommLogger::_stack;
+std::string pylith::utils::CommLogger::_filename;
+bool pylith::utils::CommLogger::_enabled = false;
+
+// ----------------------------------------------------------------------
+// Constructor for counter scope.
+pylith::utils::CommLogger::Scope::Scope(const char* name) :
+    _active(pylith::utils::CommLogger::isEnabled()) {
+    if (_active) {
+        pylith::utils::CommLogger::begin(name);
+    } // if
+} // Scope constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor for counter scope.
+pylith::utils::CommLogger::Scope::~Scope(void) {
+    if (_active) {
+        pylith::utils::CommLogger::end();
+    } // if
+} // Scope destructor
+
+
+// ----------------------------------------------------------------------
+// Enable communication statistics and set output filename.
+void
+pylith::utils::CommLogger::enable(const char* filename) {
+    assert(filename);
+    if (0 == strlen(filename)) {
+        throw std::runtime_error("Empty string given for communication statistics filename.");
+    } // if
+
+    _filename = filename;
+    _enabled = true;
+} // enable
+
+
+// ----------------------------------------------------------------------
+// Check whether communication statistics are enabled.
+bool
+pylith::utils::CommLogger::isEnabled(void) {
+    return _enabled;
+} // isEnabled
+
+
+// ----------------------------------------------------------------------
+// Begin counter scope.
+void
+pylith::utils::CommLogger::begin(const char* name) {
+    if (!_enabled) { return; }
+
+    assert(name);
+    OpenScope scope;
+    scope.path = !_stack.empty() ? _stack.back().path + "/" + name : std::string(name);
+    _counters(&scope.messages, &scope.bytes);
+    scope.time = MPI_Wtime();
+    _stack.push_back(scope);
+} // begin
+
+
+// ----------------------------------------------------------------------
+// End innermost counter scope.
+void
+pylith::utils::CommLogger::end(void) {
+    if (!_enabled) { return; }
+
+    assert(!_stack.empty());
+    double messages = 0.0;
+    double bytes = 0.0;
+    _counters(&messages, &bytes);
+
+    Accumulator& accumulator = _stats[_stack.back().path];
+    accumulator.count += 1;
+    accumulator.messages += messages - _stack.back().messages;
+    accumulator.bytes += bytes - _stack.back().bytes;
+    accumulator.elapsed += MPI_Wtime() - _stack.back().time;
+    _stack.pop_back();
+} // end
+
+
+// ----------------------------------------------------------------------
+// Write statistics as JSON with min/max/mean and per-rank values.
+void
+pylith::utils::CommLogger::write(MPI_Comm comm) {
+    if (!_enabled) { return; }
+
+    // Serialize the local statistics; ranks may hold different paths, so the
+    // merge uses a union of paths rather than a reduction.
+    std::ostringstream serial;
+    serial.precision(15);
+    for (stats_map::const_iterator iter = _stats.begin(); iter != _stats.end(); ++iter) {
+        serial << iter->first << "\t" << iter->second.count << "\t" << iter->second.messages
+               << "\t" << iter->second.bytes << "\t" << iter->second.elapsed << "\n";
+    } // for
+    const std::string& localBuffer = serial.str();
+    const int localSize = int(localBuffer.size());
+
+    int commRank = 0;
+    int commSize = 0;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+
+    std::vector<int> bufferSizes(commSize, 0);
+    MPI_Gather((void*)&localSize, 1, MPI_INT, &bufferSizes[0], 1, MPI_INT, 0, comm);
+
+    std::vector<int> bufferOffsets(commSize, 0);
+    int totalSize = 0;
+    if (0 == commRank) {
+        for (int i = 0; i < commSize; ++i) {
+            bufferOffsets[i] = totalSize;
+            totalSize += bufferSizes[i];
+        } // for
+    } // if
+    std::vector<char> globalBuffer(totalSize > 0 ? totalSize : 1);
+    MPI_Gatherv((void*)localBuffer.c_str(), localSize, MPI_CHAR, &globalBuffer[0],
+                &bufferSizes[0], &bufferOffsets[0], MPI_CHAR, 0, comm);
+
+    if (commRank > 0) { return; }
+
+    // Merge per-rank statistics, keeping the per-rank values so imbalance is
+    // visible per phase.
+    struct Stats {
+        long count;
+        std::vector<double> messages;
+        std::vector<double> bytes;
+        std::vector<double> elapsed;
+        Stats(void) :
+            count(0) {}
+
+
+    }; // Stats
+    std::map<std::string, Stats> merged;
+    for (int i = 0; i < commSize; ++i) {
+        std::istringstream rankBuffer(std::string(&globalBuffer[bufferOffsets[i]], bufferSizes[i]));
+        std::string line;
+        while (std::getline(rankBuffer, line)) {
+            std::istringstream tokens(line);
+            std::string path;
+            long count = 0;
+            double messages = 0.0, bytes = 0.0, elapsed = 0.0;
+            if (!std::getline(tokens, path, '\t')) { continue; }
+            tokens >> count >> messages >> bytes >> elapsed;
+
+            Stats& stats = merged[path];
+            if (stats.messages.empty()) {
+                stats.messages.resize(commSize, 0.0);
+                stats.bytes.resize(commSize, 0.0);
+                stats.elapsed.resize(commSize, 0.0);
+            } // if
+            stats.count = std::max(stats.count, count);
+            stats.messages[i] = messages;
+            stats.bytes[i] = bytes;
+            stats.elapsed[i] = elapsed;
+        } // while
+    } // for
+
+    std::ofstream sout(_filename.c_str());
+    if (!sout.is_open()) {
+        std::ostringstream msg;
+        msg << "Could not open communication statistics file '" << _filename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+    sout.precision(6);
+    sout << "{\n  \"num_ranks\": " << commSize << ",\n  \"scopes\": [\n";
+    for (std::map<std::string, Stats>::const_iterator iter = merged.begin(); iter != merged.end(); ++iter) {
+        if (iter != merged.begin()) { sout << ",\n"; }
+        const Stats& stats = iter->second;
+        sout << "    {\"path\": \"" << iter->first << "\""
+             << ", \"count\": " << stats.count;
+        const char* names[3] = { "messages", "bytes", "time" };
+        const std::vector<double>* values[3] = { &stats.messages, &stats.bytes, &stats.elapsed };
+        for (int i = 0; i < 3; ++i) {
+            double minValue = (*values[i])[0];
+            double maxValue = minValue;
+            double sum = 0.0;
+            for (int iRank = 0; iRank < commSize; ++iRank) {
+                minValue = std::min(minValue, (*values[i])[iRank]);
+                maxValue = std::max(maxValue, (*values[i])[iRank]);
+                sum += (*values[i])[iRank];
+            } // for
+            sout << ", \"" << names[i] << "_min\": " << minValue
+                 << ", \"" << names[i] << "_max\": " << maxValue
+                 << ", \"" << names[i] << "_mean\": " << sum / commSize;
+        } // for
+        sout << ", \"time_per_rank\": [";
+        for (int iRank = 0; iRank < commSize; ++iRank) {
+            if (iRank > 0) { sout << ", "; }
+            sout << stats.elapsed[iRank];
+        } // for
+        sout << "]}";
+    } // for
+    sout << "\n  ]\n}\n";
+    sout.close();
+} // write
+
+
+// ----------------------------------------------------------------------
+// Discard accumulated statistics and disable communication statistics.
+void
+pylith::utils::CommLogger::reset(void) {
+    _stats.clear();
+    _stack.clear();
+    _filename = "";
+    _enabled = false;
+} // reset
+
+
+// ----------------------------------------------------------------------
+// Get current totals of the PETSc MPI counters on this rank.
+void
+pylith::utils::CommLogger::_counters(double* messages,
+                                     double* bytes) {
+    assert(messages);
+    assert(bytes);
+#if defined(PETSC_USE_LOG)
+    // PETSc increments these in its MPI wrappers whenever logging support is compiled in.
+    *messages = petsc_isend_ct + petsc_irecv_ct + petsc_send_ct + petsc_recv_ct;
+    *bytes = petsc_isend_len + petsc_irecv_len + petsc_send_len + petsc_recv_len;
+#else
+    *messages = 0.0;
+    *bytes = 0.0;
+#endif
+} // _counters
+
+
+// End of file
@@ -0,0 +1,161 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file libsrc/utils/CommLogger.hh
+ *
+ * @brief Communication statistics with per-phase attribution.
+ *
+ * Counter scopes nest; each scope accumulates the MPI messages, bytes, and
+ * wall time of the communication issued inside it under the path formed by
+ * the enclosing scopes (e.g., "rhs_residual/scatter_vector_to_local"), so the
+ * statistics attribute exchanges to solver phases and output rather than to
+ * generic MPI calls. Message and byte counts come from the counters PETSc
+ * maintains in its MPI wrappers. The statistics are written as JSON with the
+ * minimum, maximum, and mean across ranks plus the per-rank values, so rank
+ * imbalance is visible per phase. When disabled (the default), scopes reduce
+ * to a single boolean test.
+ */
+
+#if !defined(pylith_utils_commlogger_hh)
+#define pylith_utils_commlogger_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/mpi.hh" // USES MPI_Comm
+
+#include <string> // HASA std::string
+#include <map> // HASA std::map
+#include <vector> // HASA std::vector
+
+// CommLogger -----------------------------------------------------------
+/// Communication statistics with per-phase attribution.
+class pylith::utils::CommLogger {
+    friend class TestCommLogger; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /// Counter scope; accumulates messages, bytes, and wall time from
+    /// construction to destruction under the path formed by the enclosing
+    /// scopes on the same rank.
+    class Scope {
+public:
+
+        /** Constructor.
+         *
+         * @param[in] name Name of scope (appended to enclosing scope path).
+         */
+        Scope(const char* name);
+
+        /// Destructor.
+        ~Scope(void);
+
+private:
+
+        bool _active; ///< True if communication statistics were enabled at construction.
+
+private:
+
+        Scope(const Scope&); ///< Not implemented.
+        const Scope& operator=(const Scope&); ///< Not implemented.
+    }; // Scope
+
+    /** Enable communication statistics and set output filename.
+     *
+     * @param[in] filename Name of JSON file for statistics.
+     */
+    static void enable(const char* filename);
+
+    /** Check whether communication statistics are enabled.
+     *
+     * @returns True if communication statistics are enabled.
+     */
+    static bool isEnabled(void);
+
+    /** Begin counter scope.
+     *
+     * @param[in] name Name of scope (appended to enclosing scope path).
+     */
+    static void begin(const char* name);
+
+    /// End innermost counter scope.
+    static void end(void);
+
+    /** Write statistics as JSON with min/max/mean and per-rank values.
+     *
+     * Collective on comm; rank 0 writes the file.
+     *
+     * @param[in] comm MPI communicator for gathering across ranks.
+     */
+    static void write(MPI_Comm comm);
+
+    /// Discard accumulated statistics and disable communication statistics.
+    static void reset(void);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    /** Get current totals of the PETSc MPI counters on this rank.
+     *
+     * @param[out] messages Number of point-to-point messages sent and received.
+     * @param[out] bytes Number of bytes sent and received.
+     */
+    static void _counters(double* messages,
+                          double* bytes);
+
+    /// Accumulated communication for one scope path.
+    struct Accumulator {
+        long count; ///< Number of times scope was entered.
+        double messages; ///< Messages sent and received in scope.
+        double bytes; ///< Bytes sent and received in scope.
+        double elapsed; ///< Wall time in scope (seconds), including waits.
+        Accumulator(void) :
+            count(0),
+            messages(0.0),
+            bytes(0.0),
+            elapsed(0.0) {}
+
+
+    }; // Accumulator
+
+    /// Open scope (path and counter values at entry).
+    struct OpenScope {
+        std::string path; ///< Path formed by enclosing scopes.
+        double messages; ///< Message counter at scope entry.
+        double bytes; ///< Byte counter at scope entry.
+        double time; ///< Wall time at scope entry.
+    }; // OpenScope
+
+    typedef std::map<std::string, Accumulator> stats_map;
+
+    // Accumulation state is thread local so that independent problem instances running on
+    // disjoint threads within one process do not interleave scopes or race on the
+    // accumulators; write() reports the statistics of the calling thread. Configuration
+    // (filename, enabled flag) is process wide and set before worker threads start.
+    static thread_local stats_map _stats; ///< Accumulated communication per scope path on this thread.
+    static thread_local std::vector<OpenScope> _stack; ///< Open scopes.
+    static std::string _filename; ///< Name of JSON output file.
+    static bool _enabled; ///< True if communication statistics are enabled.
+
+}; // CommLogger
+
+#endif // pylith_utils_commlogger_hh
+
+// End of file
@@ -24,8 +24,19 @@
 
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setw, std::setfill
+#include <cstring> // USES strlen()
 #include <cassert> // USES assert()
 
+bool pylith::utils::EventLogger::_foldedEnabled = false;
+std::string pylith::utils::EventLogger::_foldedFilename;
+pylith::utils::EventLogger::map_name_type pylith::utils::EventLogger::_eventNames;
+pylith::utils::EventLogger::map_name_type pylith::utils::EventLogger::_stageNames;
+std::vector<std::string> pylith::utils::EventLogger::_foldedStack;
+pylith::utils::EventLogger::folded_map_type pylith::utils::EventLogger::_folded;
+double pylith::utils::EventLogger::_foldedLastTime = 0.0;
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::utils::EventLogger::EventLogger(void) :
@@ -76,6 +87,7 @@ pylith::utils::EventLogger::registerEvent(const char* name) {
         throw std::runtime_error(msg.str());
     } // if
     _events[name] = id;
+    _eventNames[id] = name;
     PYLITH_METHOD_RETURN(id);
 } // registerEvent
 
@@ -112,6 +124,7 @@ pylith::utils::EventLogger::registerStage(const char* name) {
         throw std::runtime_error(msg.str());
     } // if
     _stages[name] = id;
+    _stageNames[id] = name;
 
     PYLITH_METHOD_RETURN(id);
 } // registerStage
@@ -134,4 +147,127 @@ pylith::utils::EventLogger::getStageId(const char* name) {
 } // getStageId
 
 
+// ----------------------------------------------------------------------
+// Get time accumulated by a logging event in the current logging stage.
+double
+pylith::utils::EventLogger::getAccumulatedTime(const char* name) {
+    PetscBool isActive = PETSC_FALSE;
+    PetscErrorCode err = PetscLogIsActive(&isActive);
+    if (err || !isActive) {
+        return 0.0;
+    } // if
+
+    PetscLogEvent id = -1;
+    err = PetscLogEventGetId(name, &id);
+    if (err || (id < 0)) {
+        return 0.0;
+    } // if
+
+    PetscEventPerfInfo info;
+    err = PetscLogEventGetPerfInfo(PETSC_DETERMINE, id, &info);
+    if (err) {
+        return 0.0;
+    } // if
+
+    return info.time;
+} // getAccumulatedTime
+
+
+// ----------------------------------------------------------------------
+// Enable folded-stack (flame-graph compatible) output.
+void
+pylith::utils::EventLogger::enableFoldedOutput(const char* filenamePrefix) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!filenamePrefix || (0 == strlen(filenamePrefix))) {
+        throw std::runtime_error("Empty filename prefix given for folded-stack output.");
+    } // if
+
+    _foldedFilename = filenamePrefix;
+    _foldedEnabled = true;
+    _foldedLastTime = MPI_Wtime();
+
+    PYLITH_METHOD_END;
+} // enableFoldedOutput
+
+
+// ----------------------------------------------------------------------
+// Check whether folded-stack output is enabled.
+bool
+pylith::utils::EventLogger::isFoldedOutputEnabled(void) {
+    return _foldedEnabled;
+} // isFoldedOutputEnabled
+
+
+// ----------------------------------------------------------------------
+// Write folded stack samples for this rank.
+void
+pylith::utils::EventLogger::writeFoldedStacks(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_foldedEnabled) {
+        PYLITH_METHOD_END;
+    } // if
+    _foldedSample(); // Attribute time since the last transition.
+
+    int rank = 0;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    std::ostringstream filename;
+    filename << _foldedFilename << "-rank" << std::setw(4) << std::setfill('0') << rank << ".folded";
+
+    std::ofstream fout(filename.str().c_str());
+    if (!fout.is_open()) {
+        std::ostringstream msg;
+        msg << "Could not open folded-stack output file '" << filename.str() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    for (folded_map_type::const_iterator iter = _folded.begin(); iter != _folded.end(); ++iter) {
+        // Flame-graph tools expect integer sample counts; use microseconds.
+        fout << iter->first << " " << (long long)(1.0e+6 * iter->second) << "\n";
+    } // for
+    fout.close();
+
+    PYLITH_METHOD_END;
+} // writeFoldedStacks
+
+
+// ----------------------------------------------------------------------
+// Attribute elapsed time to active stack and push event or stage.
+void
+pylith::utils::EventLogger::_foldedPush(const char* name) {
+    _foldedSample();
+    _foldedStack.push_back(name && strlen(name) > 0 ? name : "unknown");
+} // _foldedPush
+
+
+// ----------------------------------------------------------------------
+// Attribute elapsed time to active stack and pop innermost event or stage.
+void
+pylith::utils::EventLogger::_foldedPop(void) {
+    _foldedSample();
+    if (!_foldedStack.empty()) {
+        _foldedStack.pop_back();
+    } // if
+} // _foldedPop
+
+
+// ----------------------------------------------------------------------
+// Attribute wall time since last transition to the active stack.
+void
+pylith::utils::EventLogger::_foldedSample(void) {
+    const double now = MPI_Wtime();
+    const double elapsed = now - _foldedLastTime;
+    _foldedLastTime = now;
+    if (elapsed <= 0.0) {
+        return;
+    } // if
+
+    std::string path = "pylith";
+    for (size_t i = 0; i < _foldedStack.size(); ++i) {
+        path += ";" + _foldedStack[i];
+    } // for
+    _folded[path] += elapsed;
+} // _foldedSample
+
+
 // End of file
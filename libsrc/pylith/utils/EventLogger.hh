@@ -32,6 +32,7 @@
 
 #include <string> // USES std::string
 #include <map> // USES std::map
+#include <vector> // USES std::vector
 
 #include "petsc.h"
 #include "petsclog.h" // USES PetscLogEventBegin/End() in inline methods
@@ -121,6 +122,53 @@ public:
     /// Log stage end.
     void stagePop(void);
 
+    /** Get time accumulated by a logging event in the current logging stage.
+     *
+     * Works for events registered through an EventLogger as well as events
+     * PETSc registers itself (e.g., KSPSolve). Requires PETSc logging to be
+     * active; returns 0 if it is not or if no event with the given name
+     * exists.
+     *
+     * @param[in] name Name of logging event.
+     * @returns Accumulated time in seconds on this process.
+     */
+    static double getAccumulatedTime(const char* name);
+
+    /** Enable folded-stack (flame-graph compatible) output.
+     *
+     * When enabled, the wall time between event/stage transitions is
+     * attributed to the active event stack, and each rank writes its folded
+     * samples to '<prefix>-rankNNNN.folded' suitable for flame-graph tools.
+     * When disabled (the default), event logging reduces to the PETSc calls.
+     *
+     * @param[in] filenamePrefix Prefix for per-rank folded output files.
+     */
+    static void enableFoldedOutput(const char* filenamePrefix);
+
+    /** Check whether folded-stack output is enabled.
+     *
+     * @returns True if folded-stack output is enabled.
+     */
+    static bool isFoldedOutputEnabled(void);
+
+    /// Write folded stack samples for this rank.
+    static void writeFoldedStacks(void);
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Attribute elapsed time to active stack and push event or stage.
+     *
+     * @param[in] name Name of event or stage.
+     */
+    static void _foldedPush(const char* name);
+
+    /// Attribute elapsed time to active stack and pop innermost event or stage.
+    static void _foldedPop(void);
+
+    /// Attribute wall time since last transition to the active stack.
+    static void _foldedSample(void);
+
     // PRIVATE METHODS //////////////////////////////////////////////////////
 private:
 
@@ -140,6 +188,17 @@ private:
     map_event_type _events; ///< PETSc logging identifiers for events
     map_event_type _stages; ///< PETSc logging identifiers for stages
 
+    typedef std::map<int, std::string> map_name_type;
+    typedef std::map<std::string, double> folded_map_type;
+
+    static bool _foldedEnabled; ///< True if folded-stack output is enabled.
+    static std::string _foldedFilename; ///< Prefix for per-rank folded output files.
+    static map_name_type _eventNames; ///< Event names by PETSc identifier.
+    static map_name_type _stageNames; ///< Stage names by PETSc identifier.
+    static std::vector<std::string> _foldedStack; ///< Active event/stage stack on this rank.
+    static folded_map_type _folded; ///< Accumulated time per stack on this rank.
+    static double _foldedLastTime; ///< Time of last event/stage transition.
+
 }; // EventLogger
 
 #include "EventLogger.icc" // inline methods
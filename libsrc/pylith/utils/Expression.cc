@@ -0,0 +1,452 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "Expression.hh" // implementation of class methods
+
+#include <algorithm> // USES std::max()
+#include <cassert> // USES assert()
+#include <cctype> // USES isalpha(), isdigit()
+#include <cmath> // USES sin(), cos(), ...
+#include <cstdlib> // USES strtod()
+#include <cstring> // USES strlen()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ------------------------------------------------------------------------------------------------
+// Local "private" functions.
+namespace pylith {
+    namespace utils {
+        class _Expression {
+public:
+
+            /// Opcodes of compiled stack program.
+            enum OpcodeEnum {
+                PUSH_CONSTANT = 0,
+                PUSH_VARIABLE = 1,
+                ADD = 2,
+                SUBTRACT = 3,
+                MULTIPLY = 4,
+                DIVIDE = 5,
+                POWER = 6,
+                NEGATE = 7,
+                CALL = 8,
+            }; // OpcodeEnum
+
+            /// Function with name for CALL instructions.
+            struct Function {
+                const char* name;
+                double (*fn)(double);
+            }; // Function
+
+            static const Function functions[];
+            static const size_t numFunctions;
+
+            static const size_t maxStackSize;
+
+            /** Compile expression, appending instructions to program.
+             *
+             * Recursive descent parser; each parse method appends the instructions computing its
+             * value in postfix order.
+             */
+            class Parser {
+public:
+
+                Parser(const std::string& expression,
+                       const pylith::string_vector& variableNames,
+                       std::vector<pylith::utils::Expression::Instruction>* program);
+
+                /// Parse full expression; throws std::runtime_error for syntax errors.
+                void parse(void);
+
+private:
+
+                void _parseSum(void);
+
+                void _parseProduct(void);
+
+                void _parseFactor(void);
+
+                void _parsePrimary(void);
+
+                void _skipWhitespace(void);
+
+                bool _match(const char c);
+
+                void _emit(const int opcode,
+                           const int index = 0,
+                           const double value = 0.0);
+
+                void _error(const char* msg);
+
+                const std::string& _expression;
+                const pylith::string_vector& _variableNames;
+                std::vector<pylith::utils::Expression::Instruction>* _program;
+                size_t _position;
+            }; // Parser
+
+        }; // _Expression
+        const _Expression::Function _Expression::functions[] = {
+            { "sin", sin },
+            { "cos", cos },
+            { "tan", tan },
+            { "asin", asin },
+            { "acos", acos },
+            { "atan", atan },
+            { "sinh", sinh },
+            { "cosh", cosh },
+            { "tanh", tanh },
+            { "exp", exp },
+            { "log", log },
+            { "log10", log10 },
+            { "sqrt", sqrt },
+            { "abs", fabs },
+        };
+        const size_t _Expression::numFunctions = sizeof(_Expression::functions) / sizeof(_Expression::Function);
+        const size_t _Expression::maxStackSize = 64;
+
+    } // utils
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::utils::Expression::Expression(void) :
+    _expression(""),
+    _numVariables(0),
+    _stackSize(0) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::utils::Expression::~Expression(void) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Compile expression into a stack program.
+void
+pylith::utils::Expression::compile(const char* expression,
+                                   const pylith::string_vector& variableNames) {
+    if (!expression || (0 == strlen(expression))) {
+        throw std::runtime_error("Empty string given for expression.");
+    } // if
+
+    _expression = expression;
+    _numVariables = variableNames.size();
+    _program.clear();
+
+    _Expression::Parser parser(_expression, variableNames, &_program);
+    parser.parse();
+
+    // Compute maximum evaluation stack depth of program.
+    size_t depth = 0;
+    size_t maxDepth = 0;
+    const size_t numInstructions = _program.size();
+    for (size_t i = 0; i < numInstructions; ++i) {
+        switch (_program[i].opcode) {
+        case _Expression::PUSH_CONSTANT:
+        case _Expression::PUSH_VARIABLE:
+            ++depth;
+            break;
+        case _Expression::ADD:
+        case _Expression::SUBTRACT:
+        case _Expression::MULTIPLY:
+        case _Expression::DIVIDE:
+        case _Expression::POWER:
+            assert(depth >= 2);
+            --depth;
+            break;
+        case _Expression::NEGATE:
+        case _Expression::CALL:
+            assert(depth >= 1);
+            break;
+        default:
+            assert(false);
+        } // switch
+        maxDepth = std::max(maxDepth, depth);
+    } // for
+    assert(1 == depth);
+    if (maxDepth > _Expression::maxStackSize) {
+        std::ostringstream msg;
+        msg << "Expression '" << _expression << "' is too deeply nested (evaluation stack depth "
+            << maxDepth << " exceeds limit of " << _Expression::maxStackSize << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+    _stackSize = maxDepth;
+} // compile
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate compiled expression.
+double
+pylith::utils::Expression::evaluate(const double* variableValues) const {
+    assert(!_program.empty());
+    assert(variableValues || (0 == _numVariables));
+
+    double stack[64]; // _Expression::maxStackSize
+    size_t depth = 0;
+    const Instruction* instructions = &_program[0];
+    const size_t numInstructions = _program.size();
+    for (size_t i = 0; i < numInstructions; ++i) {
+        const Instruction& instruction = instructions[i];
+        switch (instruction.opcode) {
+        case _Expression::PUSH_CONSTANT:
+            stack[depth++] = instruction.value;
+            break;
+        case _Expression::PUSH_VARIABLE:
+            stack[depth++] = variableValues[instruction.index];
+            break;
+        case _Expression::ADD:
+            --depth;stack[depth-1] += stack[depth];
+            break;
+        case _Expression::SUBTRACT:
+            --depth;stack[depth-1] -= stack[depth];
+            break;
+        case _Expression::MULTIPLY:
+            --depth;stack[depth-1] *= stack[depth];
+            break;
+        case _Expression::DIVIDE:
+            --depth;stack[depth-1] /= stack[depth];
+            break;
+        case _Expression::POWER:
+            --depth;stack[depth-1] = pow(stack[depth-1], stack[depth]);
+            break;
+        case _Expression::NEGATE:
+            stack[depth-1] = -stack[depth-1];
+            break;
+        case _Expression::CALL:
+            stack[depth-1] = _Expression::functions[instruction.index].fn(stack[depth-1]);
+            break;
+        default:
+            assert(false);
+        } // switch
+    } // for
+    assert(1 == depth);
+
+    return stack[0];
+} // evaluate
+
+
+// ------------------------------------------------------------------------------------------------
+// Get expression.
+const char*
+pylith::utils::Expression::getExpression(void) const {
+    return _expression.c_str();
+} // getExpression
+
+
+// ------------------------------------------------------------------------------------------------
+// Parser constructor.
+pylith::utils::_Expression::Parser::Parser(const std::string& expression,
+                                           const pylith::string_vector& variableNames,
+                                           std::vector<pylith::utils::Expression::Instruction>* program) :
+    _expression(expression),
+    _variableNames(variableNames),
+    _program(program),
+    _position(0) {
+    assert(program);
+} // Parser constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Parse full expression.
+void
+pylith::utils::_Expression::Parser::parse(void) {
+    _parseSum();
+    _skipWhitespace();
+    if (_position != _expression.length()) {
+        _error("Unexpected character");
+    } // if
+} // parse
+
+
+// ------------------------------------------------------------------------------------------------
+// Parse sum of products.
+void
+pylith::utils::_Expression::Parser::_parseSum(void) {
+    _parseProduct();
+    for (;;) {
+        if (_match('+')) {
+            _parseProduct();
+            _emit(ADD);
+        } else if (_match('-')) {
+            _parseProduct();
+            _emit(SUBTRACT);
+        } else {
+            break;
+        } // if/else
+    } // for
+} // _parseSum
+
+
+// ------------------------------------------------------------------------------------------------
+// Parse product of factors.
+void
+pylith::utils::_Expression::Parser::_parseProduct(void) {
+    _parseFactor();
+    for (;;) {
+        if (_match('*')) {
+            _parseFactor();
+            _emit(MULTIPLY);
+        } else if (_match('/')) {
+            _parseFactor();
+            _emit(DIVIDE);
+        } else {
+            break;
+        } // if/else
+    } // for
+} // _parseProduct
+
+
+// ------------------------------------------------------------------------------------------------
+// Parse factor (primary with optional sign and power; power is right associative).
+void
+pylith::utils::_Expression::Parser::_parseFactor(void) {
+    if (_match('-')) {
+        _parseFactor();
+        _emit(NEGATE);
+    } else if (_match('+')) {
+        _parseFactor();
+    } else {
+        _parsePrimary();
+        if (_match('^')) {
+            _parseFactor();
+            _emit(POWER);
+        } // if
+    } // if/else
+} // _parseFactor
+
+
+// ------------------------------------------------------------------------------------------------
+// Parse number, variable, constant, function call, or parenthesized expression.
+void
+pylith::utils::_Expression::Parser::_parsePrimary(void) {
+    _skipWhitespace();
+    if (_position >= _expression.length()) {
+        _error("Unexpected end of expression");
+    } // if
+
+    const char c = _expression[_position];
+    if (('(' == c)) {
+        ++_position;
+        _parseSum();
+        if (!_match(')')) {
+            _error("Expected ')'");
+        } // if
+    } else if (isdigit(c) || ('.' == c)) {
+        const char* start = _expression.c_str() + _position;
+        char* end = NULL;
+        const double value = strtod(start, &end);
+        if (end == start) {
+            _error("Invalid number");
+        } // if
+        _position += end - start;
+        _emit(PUSH_CONSTANT, 0, value);
+    } else if (isalpha(c) || ('_' == c)) {
+        const size_t start = _position;
+        while ((_position < _expression.length()) &&
+               (isalnum(_expression[_position]) || ('_' == _expression[_position]))) {
+            ++_position;
+        } // while
+        const std::string name = _expression.substr(start, _position - start);
+
+        const size_t numVariables = _variableNames.size();
+        for (size_t i = 0; i < numVariables; ++i) {
+            if (name == _variableNames[i]) {
+                _emit(PUSH_VARIABLE, int(i));
+                return;
+            } // if
+        } // for
+        if ("pi" == name) {
+            _emit(PUSH_CONSTANT, 0, M_PI);
+            return;
+        } // if
+        if ("e" == name) {
+            _emit(PUSH_CONSTANT, 0, M_E);
+            return;
+        } // if
+        for (size_t i = 0; i < numFunctions; ++i) {
+            if (name == functions[i].name) {
+                if (!_match('(')) {
+                    _error("Expected '(' after function name");
+                } // if
+                _parseSum();
+                if (!_match(')')) {
+                    _error("Expected ')'");
+                } // if
+                _emit(CALL, int(i));
+                return;
+            } // if
+        } // for
+        _position = start;
+        _error("Unknown variable or function");
+    } else {
+        _error("Unexpected character");
+    } // if/else
+} // _parsePrimary
+
+
+// ------------------------------------------------------------------------------------------------
+// Advance past whitespace.
+void
+pylith::utils::_Expression::Parser::_skipWhitespace(void) {
+    while ((_position < _expression.length()) && isspace(_expression[_position])) {
+        ++_position;
+    } // while
+} // _skipWhitespace
+
+
+// ------------------------------------------------------------------------------------------------
+// Consume character if it is next in the expression.
+bool
+pylith::utils::_Expression::Parser::_match(const char c) {
+    _skipWhitespace();
+    if ((_position < _expression.length()) && (c == _expression[_position])) {
+        ++_position;
+        return true;
+    } // if
+    return false;
+} // _match
+
+
+// ------------------------------------------------------------------------------------------------
+// Append instruction to program.
+void
+pylith::utils::_Expression::Parser::_emit(const int opcode,
+                                          const int index,
+                                          const double value) {
+    pylith::utils::Expression::Instruction instruction;
+    instruction.opcode = opcode;
+    instruction.index = index;
+    instruction.value = value;
+    _program->push_back(instruction);
+} // _emit
+
+
+// ------------------------------------------------------------------------------------------------
+// Throw syntax error with position in expression.
+void
+pylith::utils::_Expression::Parser::_error(const char* msg) {
+    std::ostringstream info;
+    info << "Error compiling expression '" << _expression << "' at position " << _position
+         << ": " << msg << ".";
+    throw std::runtime_error(info.str());
+} // _error
+
+
+// End of file
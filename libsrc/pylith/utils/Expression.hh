@@ -0,0 +1,100 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/utils/Expression.hh
+ *
+ * @brief Mathematical expression compiled once into a stack program and evaluated at native
+ * speed, without going through the Python layer or a spatial database per evaluation.
+ */
+
+#if !defined(pylith_utils_expression_hh)
+#define pylith_utils_expression_hh
+
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/arrayfwd.hh" // USES string_vector
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::utils::Expression {
+    friend class TestExpression; // unit testing
+
+    // PUBLIC STRUCTS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Instruction of compiled stack program.
+    struct Instruction {
+        int opcode; ///< Operation.
+        int index; ///< Variable or function index (PUSH_VARIABLE and CALL).
+        double value; ///< Constant value (PUSH_CONSTANT).
+    }; // Instruction
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    Expression(void);
+
+    /// Destructor.
+    ~Expression(void);
+
+    /** Compile expression into a stack program.
+     *
+     * Supported syntax: numbers, the given variable names, constants 'pi' and 'e', operators
+     * +, -, *, /, ^ (power), parentheses, and functions sin, cos, tan, asin, acos, atan,
+     * sinh, cosh, tanh, exp, log, log10, sqrt, and abs.
+     *
+     * @param[in] expression Expression to compile.
+     * @param[in] variableNames Names of variables in order matching values passed to evaluate().
+     */
+    void compile(const char* expression,
+                 const pylith::string_vector& variableNames);
+
+    /** Evaluate compiled expression.
+     *
+     * @param[in] variableValues Values of variables in order used in compile().
+     * @returns Value of expression.
+     */
+    double evaluate(const double* variableValues) const;
+
+    /** Get expression.
+     *
+     * @returns Expression passed to compile().
+     */
+    const char* getExpression(void) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _expression; ///< Expression passed to compile().
+    std::vector<Instruction> _program; ///< Compiled stack program.
+    size_t _numVariables; ///< Number of variables.
+    size_t _stackSize; ///< Maximum evaluation stack depth of program.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    Expression(const Expression&); ///< Not implemented.
+    const Expression& operator=(const Expression&); ///< Not implemented.
+
+}; // class Expression
+
+#endif // pylith_utils_expression_hh
+
+// End of file
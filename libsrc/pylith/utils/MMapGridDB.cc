@@ -0,0 +1,477 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MMapGridDB.hh" // implementation of class methods
+
+#include "spatialdata/geocoords/CSCart.hh" // HOLDSA CSCart
+#include "spatialdata/geocoords/Converter.hh" // USES Converter
+#include "spatialdata/units/Parser.hh" // USES Parser
+
+#include <fcntl.h> // USES open()
+#include <sys/mman.h> // USES mmap()
+#include <sys/stat.h> // USES fstat()
+#include <unistd.h> // USES close()
+
+#include <algorithm> // USES std::upper_bound, std::min(), std::max()
+#include <thread> // USES std::thread
+#include <cassert> // USES assert()
+#include <cerrno> // USES errno
+#include <cstdint> // USES int64_t
+#include <cstring> // USES memcmp(), strerror()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+namespace pylith {
+    namespace utils {
+        namespace _MMapGridDB {
+            /// Layout of binary grid file; all integers and values are native-endian.
+            static const char magicV1[24] = "PyLithMMapGridDB v1\n";
+            static const char magicV2[24] = "PyLithMMapGridDB v2\n";
+            static const size_t magicSize = sizeof(magicV1);
+            static const size_t numHeaderIntsV1 = 5; ///< spaceDim, numValues, numX, numY, numZ.
+            static const size_t numHeaderIntsV2 = 6; ///< v1 header + dtype of values.
+            static const size_t nameSize = 64; ///< Bytes for name of each value.
+            static const size_t unitsSize = 32; ///< Bytes for units of each value.
+            static const int64_t dtypeFloat64 = 0; ///< Values stored as 8-byte doubles.
+            static const int64_t dtypeFloat32 = 1; ///< Values stored as quantized 4-byte floats.
+        } // _MMapGridDB
+    } // utils
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::utils::MMapGridDB::MMapGridDB(void) :
+    _filename(""),
+    _cs(NULL),
+    _mapped(NULL),
+    _mappedSize(0),
+    _fd(-1),
+    _values(NULL),
+    _valuesSingle(NULL),
+    _spaceDim(0),
+    _numValues(0) {
+    for (size_t i = 0; i < 3; ++i) {
+        _gridCoords[i] = NULL;
+        _numGridCoords[i] = 0;
+    } // for
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::utils::MMapGridDB::~MMapGridDB(void) {
+    close();
+    delete _cs;_cs = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename of binary grid file.
+void
+pylith::utils::MMapGridDB::setFilename(const char* value) {
+    _filename = value;
+} // setFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Open the database and prepare for querying; maps the grid file into memory.
+void
+pylith::utils::MMapGridDB::open(void) {
+    if (_mapped) { return; } // Already open.
+
+    if (_filename.empty()) {
+        std::ostringstream msg;
+        msg << "No filename given for memory-mapped gridded spatial database '" << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _fd = ::open(_filename.c_str(), O_RDONLY);
+    if (_fd < 0) {
+        std::ostringstream msg;
+        msg << "Could not open file '" << _filename << "' for memory-mapped gridded spatial database '"
+            << getDescription() << "'.\n" << strerror(errno);
+        throw std::runtime_error(msg.str());
+    } // if
+
+    struct stat fileInfo;
+    if (fstat(_fd, &fileInfo)) {
+        ::close(_fd);_fd = -1;
+        std::ostringstream msg;
+        msg << "Could not get size of file '" << _filename << "' for memory-mapped gridded spatial database '"
+            << getDescription() << "'.\n" << strerror(errno);
+        throw std::runtime_error(msg.str());
+    } // if
+    _mappedSize = fileInfo.st_size;
+
+    // Read-only shared mapping, so the pages are backed by the page cache and shared by all
+    // processes on the node mapping the same file.
+    _mapped = mmap(NULL, _mappedSize, PROT_READ, MAP_SHARED, _fd, 0);
+    if (MAP_FAILED == _mapped) {
+        _mapped = NULL;
+        ::close(_fd);_fd = -1;
+        std::ostringstream msg;
+        msg << "Could not map file '" << _filename << "' for memory-mapped gridded spatial database '"
+            << getDescription() << "'.\n" << strerror(errno);
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Parse header. Version 2 adds the dtype of the values, so grids quantized to single
+    // precision halve the mapped value storage (and the memory bandwidth of queries).
+    const char* bytes = (const char*)_mapped;
+    size_t numHeaderInts = 0;
+    if ((_mappedSize >= _MMapGridDB::magicSize) && (0 == memcmp(bytes, _MMapGridDB::magicV1, _MMapGridDB::magicSize))) {
+        numHeaderInts = _MMapGridDB::numHeaderIntsV1;
+    } else if ((_mappedSize >= _MMapGridDB::magicSize) && (0 == memcmp(bytes, _MMapGridDB::magicV2, _MMapGridDB::magicSize))) {
+        numHeaderInts = _MMapGridDB::numHeaderIntsV2;
+    } // if/else
+    const size_t headerSize = _MMapGridDB::magicSize + numHeaderInts*sizeof(int64_t);
+    if ((0 == numHeaderInts) || (_mappedSize < headerSize)) {
+        close();
+        std::ostringstream msg;
+        msg << "File '" << _filename << "' for memory-mapped gridded spatial database '" << getDescription()
+            << "' is not a PyLith binary grid file. Use 'pylith_convert_griddb' to generate one from a "
+            << "SimpleGridDB file.";
+        throw std::runtime_error(msg.str());
+    } // if
+    const int64_t* headerInts = (const int64_t*)(bytes + _MMapGridDB::magicSize);
+    _spaceDim = headerInts[0];
+    _numValues = headerInts[1];
+    size_t numLocs = 1;
+    for (size_t i = 0; i < 3; ++i) {
+        _numGridCoords[i] = headerInts[2+i];
+        if (_numGridCoords[i] > 0) { numLocs *= _numGridCoords[i]; }
+    } // for
+    const int64_t valueDtype = (numHeaderInts > _MMapGridDB::numHeaderIntsV1) ? headerInts[5] : _MMapGridDB::dtypeFloat64;
+    if ((_spaceDim < 1) || (_spaceDim > 3) || (0 == _numValues) ||
+        ((_MMapGridDB::dtypeFloat64 != valueDtype) && (_MMapGridDB::dtypeFloat32 != valueDtype))) {
+        close();
+        std::ostringstream msg;
+        msg << "Bad header in file '" << _filename << "' for memory-mapped gridded spatial database '"
+            << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    const size_t valueSize = (_MMapGridDB::dtypeFloat32 == valueDtype) ? sizeof(float) : sizeof(double);
+
+    // Verify file size matches the header before indexing into the mapping.
+    size_t offset = headerSize + _numValues * (_MMapGridDB::nameSize + _MMapGridDB::unitsSize);
+    size_t expectedSize = offset;
+    for (size_t i = 0; i < 3; ++i) {
+        expectedSize += _numGridCoords[i] * sizeof(double);
+    } // for
+    expectedSize += numLocs * _numValues * valueSize;
+    if (_mappedSize != expectedSize) {
+        close();
+        std::ostringstream msg;
+        msg << "Size of file '" << _filename << "' for memory-mapped gridded spatial database '"
+            << getDescription() << "' (" << _mappedSize << " bytes) does not match size expected from header ("
+            << expectedSize << " bytes).";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Names and units of values; convert units to scales for converting values to SI units.
+    spatialdata::units::Parser parser;
+    _names.resize(_numValues);
+    _units.resize(_numValues);
+    _scales.resize(_numValues);
+    const char* nameBytes = bytes + headerSize;
+    for (size_t i = 0; i < _numValues; ++i) {
+        _names[i] = std::string(nameBytes, strnlen(nameBytes, _MMapGridDB::nameSize));
+        nameBytes += _MMapGridDB::nameSize;
+        _units[i] = std::string(nameBytes, strnlen(nameBytes, _MMapGridDB::unitsSize));
+        nameBytes += _MMapGridDB::unitsSize;
+        _scales[i] = (0 != strcasecmp(_units[i].c_str(), "none")) ? parser.parse(_units[i].c_str()) : 1.0;
+    } // for
+
+    // Grid coordinates and values point into the mapping; nothing is copied.
+    for (size_t i = 0; i < 3; ++i) {
+        _gridCoords[i] = (_numGridCoords[i] > 0) ? (const double*)(bytes + offset) : NULL;
+        offset += _numGridCoords[i] * sizeof(double);
+    } // for
+    if (_MMapGridDB::dtypeFloat32 == valueDtype) {
+        _valuesSingle = (const float*)(bytes + offset);
+    } else {
+        _values = (const double*)(bytes + offset);
+    } // if/else
+
+    delete _cs;_cs = new spatialdata::geocoords::CSCart;assert(_cs);
+    _cs->setSpaceDim(_spaceDim);
+
+    // Default query returns all values in the order given.
+    _queryIndices.resize(_numValues);
+    for (size_t i = 0; i < _numValues; ++i) {
+        _queryIndices[i] = i;
+    } // for
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close the database; unmaps the grid file.
+void
+pylith::utils::MMapGridDB::close(void) {
+    if (_mapped) {
+        munmap(_mapped, _mappedSize);
+        _mapped = NULL;
+        _mappedSize = 0;
+    } // if
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    } // if
+    for (size_t i = 0; i < 3; ++i) {
+        _gridCoords[i] = NULL;
+        _numGridCoords[i] = 0;
+    } // for
+    _values = NULL;
+    _valuesSingle = NULL;
+    _scales.clear();
+    _queryIndices.clear();
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Get names of values in spatial database.
+void
+pylith::utils::MMapGridDB::getNamesDBValues(const char*** valueNames,
+                                            size_t* numValues) const {
+    const size_t size = _names.size();
+    const char** names = (size > 0) ? new const char*[size] : NULL;
+    for (size_t i = 0; i < size; ++i) {
+        names[i] = _names[i].c_str();
+    } // for
+
+    if (valueNames) { *valueNames = names; }
+    if (numValues) { *numValues = size; }
+} // getNamesDBValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values to be returned by queries.
+void
+pylith::utils::MMapGridDB::setQueryValues(const char* const* names,
+                                          const size_t numVals) {
+    if (0 == numVals) {
+        std::ostringstream msg;
+        msg << "Number of values for query in memory-mapped gridded spatial database '" << getDescription()
+            << "' must be positive.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    assert(names && numVals > 0);
+
+    const size_t numValues = _names.size();
+    _queryIndices.resize(numVals);
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        size_t iName = 0;
+        for (; iName < numValues; ++iName) {
+            if (0 == strcasecmp(names[iVal], _names[iName].c_str())) {
+                _queryIndices[iVal] = iName;
+                break;
+            } // if
+        } // for
+        if (iName == numValues) {
+            std::ostringstream msg;
+            msg << "Could not find value '" << names[iVal] << "' in memory-mapped gridded spatial database '"
+                << getDescription() << "'. Available values are:";
+            for (size_t i = 0; i < numValues; ++i) {
+                msg << "\n  " << _names[i];
+            } // for
+            msg << "\n";
+            throw std::out_of_range(msg.str());
+        } // if
+    } // for
+} // setQueryValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database, interpolating multilinearly within the grid.
+int
+pylith::utils::MMapGridDB::query(double* vals,
+                                 const size_t numVals,
+                                 const double* coords,
+                                 const size_t numDims,
+                                 const spatialdata::geocoords::CoordSys* csQuery) {
+    _checkQuery(numVals);
+    assert(coords && numDims == _spaceDim);
+
+    // Convert coordinates to coordinate system of grid.
+    double xyz[3] = { 0.0, 0.0, 0.0 };
+    for (size_t i = 0; i < numDims; ++i) {
+        xyz[i] = coords[i];
+    } // for
+    assert(csQuery);
+    spatialdata::geocoords::Converter::convert(xyz, 1, numDims, _cs, csQuery);
+
+    _interpolate(vals, numVals, xyz);
+
+    return 0;
+} // query
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database at multiple locations.
+void
+pylith::utils::MMapGridDB::queryMulti(double* vals,
+                                      const size_t numVals,
+                                      const double* coords,
+                                      const size_t numLocs,
+                                      const size_t numDims,
+                                      const spatialdata::geocoords::CoordSys* csQuery) {
+    _checkQuery(numVals);
+    assert((coords && numLocs > 0) || (0 == numLocs));
+    assert(numDims == _spaceDim);
+
+    if (0 == numLocs) {
+        return;
+    } // if
+
+    // Convert coordinates of all locations to the coordinate system of the grid in a single
+    // call, amortizing the per-call projection setup of geographic coordinate systems.
+    std::vector<double> xyz(coords, coords + numLocs*numDims);
+    assert(csQuery);
+    spatialdata::geocoords::Converter::convert(&xyz[0], numLocs, numDims, _cs, csQuery);
+
+    // Interpolation only reads the mapped grid, so large batches are split among threads.
+    const size_t minLocsPerThread = 5000;
+    const size_t maxThreads = std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+    const size_t numThreads = std::min(maxThreads, std::max(size_t(1), numLocs / minLocsPerThread));
+    if (numThreads > 1) {
+        std::vector<std::thread> threads;
+        const size_t locsPerThread = (numLocs + numThreads - 1) / numThreads;
+        for (size_t iThread = 0; iThread < numThreads; ++iThread) {
+            const size_t locBegin = iThread * locsPerThread;
+            const size_t locEnd = std::min(numLocs, locBegin + locsPerThread);
+            threads.push_back(std::thread([this, vals, numVals, &xyz, numDims, locBegin, locEnd]() {
+                    for (size_t iLoc = locBegin; iLoc < locEnd; ++iLoc) {
+                        _interpolate(&vals[iLoc*numVals], numVals, &xyz[iLoc*numDims]);
+                    } // for
+                }));
+        } // for
+        for (size_t iThread = 0; iThread < numThreads; ++iThread) {
+            threads[iThread].join();
+        } // for
+    } else {
+        for (size_t iLoc = 0; iLoc < numLocs; ++iLoc) {
+            _interpolate(&vals[iLoc*numVals], numVals, &xyz[iLoc*numDims]);
+        } // for
+    } // if/else
+} // queryMulti
+
+
+// ------------------------------------------------------------------------------------------------
+// Check that the database is open and the query size matches the query values.
+void
+pylith::utils::MMapGridDB::_checkQuery(const size_t numVals) const {
+    if (!_mapped) {
+        std::ostringstream msg;
+        msg << "Memory-mapped gridded spatial database '" << getDescription()
+            << "' has not been opened before query.";
+        throw std::logic_error(msg.str());
+    } else if (numVals != _queryIndices.size()) {
+        std::ostringstream msg;
+        msg << "Number of values to be returned by queries of memory-mapped gridded spatial database '"
+            << getDescription() << "' (" << _queryIndices.size() << ") does not match size of array provided ("
+            << numVals << ").";
+        throw std::invalid_argument(msg.str());
+    } // if/else
+} // _checkQuery
+
+
+// ------------------------------------------------------------------------------------------------
+// Interpolate values multilinearly within the grid at a location.
+void
+pylith::utils::MMapGridDB::_interpolate(double* vals,
+                                        const size_t numVals,
+                                        const double* xyz) const {
+    // Locate the grid cell containing the location (clamped to the grid) and the interpolation
+    // weights along each dimension.
+    size_t cellIndex[3] = { 0, 0, 0 };
+    double cellWeight[3] = { 0.0, 0.0, 0.0 };
+    for (size_t i = 0; i < _spaceDim; ++i) {
+        if (_numGridCoords[i] > 0) {
+            _findCell(&cellIndex[i], &cellWeight[i], _gridCoords[i], _numGridCoords[i], xyz[i]);
+        } // if
+    } // for
+
+    // Multilinear interpolation over the (up to 8) corners of the cell.
+    const size_t numX = (_numGridCoords[0] > 0) ? _numGridCoords[0] : 1;
+    const size_t numY = (_numGridCoords[1] > 0) ? _numGridCoords[1] : 1;
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        vals[iVal] = 0.0;
+    } // for
+    for (size_t corner = 0; corner < 8; ++corner) {
+        double weight = 1.0;
+        size_t index[3];
+        for (size_t i = 0; i < 3; ++i) {
+            const bool upper = corner & (size_t(1) << i);
+            index[i] = cellIndex[i];
+            if (upper) {
+                if (!(_numGridCoords[i] > 1)) { weight = 0.0;break; }
+                index[i] += 1;
+                weight *= cellWeight[i];
+            } else {
+                weight *= 1.0 - cellWeight[i];
+            } // if/else
+        } // for
+        if (weight <= 0.0) { continue; }
+        const size_t cornerOffset = ((index[2]*numY + index[1])*numX + index[0]) * _numValues;
+        if (_valuesSingle) {
+            // Values quantized to single precision; dequantize in the gather.
+            const float* cornerValues = &_valuesSingle[cornerOffset];
+            for (size_t iVal = 0; iVal < numVals; ++iVal) {
+                vals[iVal] += weight * double(cornerValues[_queryIndices[iVal]]);
+            } // for
+        } else {
+            const double* cornerValues = &_values[cornerOffset];
+            for (size_t iVal = 0; iVal < numVals; ++iVal) {
+                vals[iVal] += weight * cornerValues[_queryIndices[iVal]];
+            } // for
+        } // if/else
+    } // for
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        vals[iVal] *= _scales[_queryIndices[iVal]];
+    } // for
+} // _interpolate
+
+
+// ------------------------------------------------------------------------------------------------
+// Find grid cell containing coordinate along one dimension.
+void
+pylith::utils::MMapGridDB::_findCell(size_t* index,
+                                     double* weight,
+                                     const double* gridCoords,
+                                     const size_t numGridCoords,
+                                     const double x) {
+    assert(index && weight && gridCoords && numGridCoords > 0);
+
+    if ((1 == numGridCoords) || (x <= gridCoords[0])) {
+        *index = 0;
+        *weight = 0.0;
+    } else if (x >= gridCoords[numGridCoords-1]) {
+        *index = numGridCoords - 2;
+        *weight = 1.0;
+    } else {
+        const double* upper = std::upper_bound(gridCoords, gridCoords + numGridCoords, x);
+        const size_t i = upper - gridCoords - 1;
+        *index = i;
+        *weight = (x - gridCoords[i]) / (gridCoords[i+1] - gridCoords[i]);
+    } // if/else
+} // _findCell
+
+
+// End of file
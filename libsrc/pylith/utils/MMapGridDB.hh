@@ -0,0 +1,194 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/utils/MMapGridDB.hh
+ *
+ * @brief Read-only gridded spatial database backed by a memory-mapped binary file, so ranks on
+ * a node share page-cache-backed mappings instead of holding one copy of the grid each.
+ */
+
+#if !defined(pylith_utils_mmapgriddb_hh)
+#define pylith_utils_mmapgriddb_hh
+
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/array.hh" // HASA string_vector
+#include "pylith/utils/MultiQueryDB.hh" // ISA MultiQueryDB
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // ISA SpatialDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CSCart
+
+#include <vector> // HASA std::vector
+
+class pylith::utils::MMapGridDB : public spatialdata::spatialdb::SpatialDB, public pylith::utils::MultiQueryDB {
+    friend class TestMMapGridDB; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    MMapGridDB(void);
+
+    /// Destructor.
+    ~MMapGridDB(void);
+
+    /** Set filename of binary grid file.
+     *
+     * Use the `pylith_convert_griddb` utility to convert a SimpleGridDB ASCII file to the
+     * binary layout mapped by this database. Grids converted with `--value-dtype=float32`
+     * store the values quantized to single precision (source databases rarely carry more than
+     * 3-4 significant digits), halving the mapped storage and the memory bandwidth of queries;
+     * the values are dequantized to double precision during interpolation.
+     *
+     * @param[in] value Filename of binary grid file.
+     */
+    void setFilename(const char* value);
+
+    /// Open the database and prepare for querying; maps the grid file into memory.
+    void open(void);
+
+    /// Close the database; unmaps the grid file.
+    void close(void);
+
+    /** Get names of values in spatial database.
+     *
+     * @param[out] valueNames Array of names of values.
+     * @param[out] numValues Size of array.
+     */
+    void getNamesDBValues(const char*** valueNames,
+                          size_t* numValues) const;
+
+    /** Set values to be returned by queries.
+     *
+     * @pre Must call open() before setQueryValues().
+     *
+     * @param[in] names Names of values to be returned in queries.
+     * @param[in] numVals Number of values to be returned in queries.
+     */
+    void setQueryValues(const char* const* names,
+                        const size_t numVals);
+
+    /** Query the database, interpolating multilinearly within the grid.
+     *
+     * Locations outside the grid are clamped to the grid boundary.
+     *
+     * @pre Must call open() before query().
+     *
+     * @param[out] vals Values to be returned.
+     * @param[in] numVals Number of values to be returned.
+     * @param[in] coords Coordinates of point for query.
+     * @param[in] numDims Number of dimensions for coordinates.
+     * @param[in] csQuery Coordinate system of coordinates.
+     *
+     * @returns 0 on success, 1 on failure (i.e., could not interpolate).
+     */
+    int query(double* vals,
+              const size_t numVals,
+              const double* coords,
+              const size_t numDims,
+              const spatialdata::geocoords::CoordSys* csQuery);
+
+    /** Query the database at multiple locations.
+     *
+     * The coordinates of all locations are converted to the coordinate system of the grid in a
+     * single call, and the interpolation is done in parallel with threads for large batches.
+     *
+     * @pre Must call open() before queryMulti().
+     *
+     * @param[out] vals Values at the locations [numLocs*numVals].
+     * @param[in] numVals Number of values to be returned per location.
+     * @param[in] coords Coordinates of the locations [numLocs*numDims].
+     * @param[in] numLocs Number of locations.
+     * @param[in] numDims Number of dimensions for coordinates.
+     * @param[in] csQuery Coordinate system of coordinates.
+     */
+    void queryMulti(double* vals,
+                    const size_t numVals,
+                    const double* coords,
+                    const size_t numLocs,
+                    const size_t numDims,
+                    const spatialdata::geocoords::CoordSys* csQuery);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Check that the database is open and the query size matches the query values.
+     *
+     * @param[in] numVals Number of values to be returned per location.
+     */
+    void _checkQuery(const size_t numVals) const;
+
+    /** Interpolate values multilinearly within the grid at a location.
+     *
+     * Locations outside the grid are clamped to the grid boundary.
+     *
+     * @param[out] vals Values at the location [numVals].
+     * @param[in] numVals Number of values to be returned.
+     * @param[in] xyz Coordinates of the location in the coordinate system of the grid.
+     */
+    void _interpolate(double* vals,
+                      const size_t numVals,
+                      const double* xyz) const;
+
+    /** Find grid cell containing coordinate along one dimension.
+     *
+     * @param[out] index Index of grid point at lower edge of cell.
+     * @param[out] weight Interpolation weight toward grid point at upper edge of cell.
+     * @param[in] gridCoords Grid coordinates along dimension.
+     * @param[in] numGridCoords Number of grid coordinates along dimension.
+     * @param[in] x Coordinate of query location along dimension.
+     */
+    static
+    void _findCell(size_t* index,
+                   double* weight,
+                   const double* gridCoords,
+                   const size_t numGridCoords,
+                   const double x);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Filename of binary grid file.
+    pylith::string_vector _names; ///< Names of values in database.
+    pylith::string_vector _units; ///< Units of values in database.
+    std::vector<double> _scales; ///< Scales of values to convert to SI units.
+    std::vector<size_t> _queryIndices; ///< Indices of values to be returned in queries.
+    spatialdata::geocoords::CoordSys* _cs; ///< Coordinate system of grid.
+
+    void* _mapped; ///< Memory-mapped grid file (NULL if not open).
+    size_t _mappedSize; ///< Size of mapping in bytes.
+    int _fd; ///< File descriptor of grid file (-1 if not open).
+
+    const double* _gridCoords[3]; ///< Grid coordinates along each dimension (into mapping).
+    size_t _numGridCoords[3]; ///< Number of grid coordinates along each dimension.
+    const double* _values; ///< Grid values (into mapping; NULL if values are single precision).
+    const float* _valuesSingle; ///< Grid values quantized to single precision (into mapping; NULL if double precision).
+    size_t _spaceDim; ///< Spatial dimension of grid.
+    size_t _numValues; ///< Number of values in database.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    MMapGridDB(const MMapGridDB&); ///< Not implemented.
+    const MMapGridDB& operator=(const MMapGridDB&); ///< Not implemented.
+
+}; // class MMapGridDB
+
+#endif // pylith_utils_mmapgriddb_hh
+
+// End of file
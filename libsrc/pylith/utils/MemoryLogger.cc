@@ -0,0 +1,138 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "MemoryLogger.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include "petscsys.h" // USES PetscMemoryGetCurrentUsage()
+#include "petscmat.h" // USES MatGetInfo()
+
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+thread_local pylith::utils::MemoryLogger::usage_map pylith::utils::MemoryLogger::_usage;
+
+// ----------------------------------------------------------------------
+// Enable tracking of the process-wide memory high water mark.
+void
+pylith::utils::MemoryLogger::enableProcessHighWater(void) {
+    PetscErrorCode err = PetscMemorySetGetMaximumUsage();PYLITH_CHECK_ERROR(err);
+} // enableProcessHighWater
+
+
+// ----------------------------------------------------------------------
+// Add bytes to subsystem usage.
+void
+pylith::utils::MemoryLogger::add(const char* subsystem,
+                                 const size_t bytes) {
+    assert(subsystem);
+
+    Usage& usage = _usage[subsystem];
+    usage.current += bytes;
+    if (usage.current > usage.highWater) {
+        usage.highWater = usage.current;
+    } // if
+} // add
+
+
+// ----------------------------------------------------------------------
+// Subtract bytes from subsystem usage.
+void
+pylith::utils::MemoryLogger::remove(const char* subsystem,
+                                    const size_t bytes) {
+    assert(subsystem);
+
+    Usage& usage = _usage[subsystem];
+    usage.current = (bytes < usage.current) ? usage.current - bytes : 0;
+} // remove
+
+
+// ----------------------------------------------------------------------
+// Set current subsystem usage (replaces previous value).
+void
+pylith::utils::MemoryLogger::track(const char* subsystem,
+                                   const size_t bytes) {
+    assert(subsystem);
+
+    Usage& usage = _usage[subsystem];
+    usage.current = bytes;
+    if (usage.current > usage.highWater) {
+        usage.highWater = usage.current;
+    } // if
+} // track
+
+
+// ----------------------------------------------------------------------
+// Add storage for field to subsystem usage.
+void
+pylith::utils::MemoryLogger::addField(const char* subsystem,
+                                      const pylith::topology::Field& field) {
+    add(subsystem, size_t(field.getStorageSize()) * sizeof(PylithScalar));
+} // addField
+
+
+// ----------------------------------------------------------------------
+// Set current subsystem usage from matrix storage.
+void
+pylith::utils::MemoryLogger::trackMatrix(const char* subsystem,
+                                         const PetscMat matrix) {
+    assert(matrix);
+
+    MatInfo info;
+    PetscErrorCode err = MatGetInfo(matrix, MAT_LOCAL, &info);PYLITH_CHECK_ERROR(err);
+    track(subsystem, size_t(info.memory));
+} // trackMatrix
+
+
+// ----------------------------------------------------------------------
+// Get report of per-subsystem and process memory usage on this rank.
+std::string
+pylith::utils::MemoryLogger::report(void) {
+    const double toMB = 1.0 / double(1 << 20);
+
+    std::ostringstream msg;
+    msg << "Memory usage (current / high water, MB):";
+    for (usage_map::const_iterator iter = _usage.begin(); iter != _usage.end(); ++iter) {
+        msg << "\n    " << iter->first << ": " << iter->second.current*toMB
+            << " / " << iter->second.highWater*toMB;
+    } // for
+
+    PetscLogDouble current = 0.0;
+    PetscLogDouble maximum = 0.0;
+    PetscErrorCode err = PetscMemoryGetCurrentUsage(&current);PYLITH_CHECK_ERROR(err);
+    err = PetscMemoryGetMaximumUsage(&maximum);PYLITH_CHECK_ERROR(err);
+    msg << "\n    process: " << current*toMB << " / " << maximum*toMB;
+
+    return msg.str();
+} // report
+
+
+// ----------------------------------------------------------------------
+// Discard accumulated usage.
+void
+pylith::utils::MemoryLogger::reset(void) {
+    _usage.clear();
+} // reset
+
+
+// End of file
@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file libsrc/utils/MemoryLogger.hh
+ *
+ * @brief Memory footprint accounting per subsystem.
+ *
+ * Subsystems (solution field, auxiliary fields, Jacobian, output buffers)
+ * report the storage they allocate, tagged by subsystem name; the logger
+ * tracks current and high-water usage per subsystem on each rank together
+ * with the process-wide usage reported by PETSc. Reports are emitted at
+ * phase transitions in TimeDependent so out-of-memory failures can be
+ * attributed and large runs can be capacity planned without trial and
+ * error.
+ */
+
+#if !defined(pylith_utils_memorylogger_hh)
+#define pylith_utils_memorylogger_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/petscfwd.h" // USES PetscMat
+
+#include <string> // HASA std::string
+#include <map> // HASA std::map
+
+// MemoryLogger ---------------------------------------------------------
+/// Memory footprint accounting per subsystem.
+class pylith::utils::MemoryLogger {
+    friend class TestMemoryLogger; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /// Enable tracking of the process-wide memory high water mark.
+    static void enableProcessHighWater(void);
+
+    /** Add bytes to subsystem usage.
+     *
+     * @param[in] subsystem Name of subsystem.
+     * @param[in] bytes Number of bytes allocated.
+     */
+    static void add(const char* subsystem,
+                    const size_t bytes);
+
+    /** Subtract bytes from subsystem usage.
+     *
+     * @param[in] subsystem Name of subsystem.
+     * @param[in] bytes Number of bytes deallocated.
+     */
+    static void remove(const char* subsystem,
+                       const size_t bytes);
+
+    /** Set current subsystem usage (replaces previous value).
+     *
+     * Used for storage that is reallocated in place, such as the Jacobian.
+     *
+     * @param[in] subsystem Name of subsystem.
+     * @param[in] bytes Number of bytes currently allocated.
+     */
+    static void track(const char* subsystem,
+                      const size_t bytes);
+
+    /** Add storage for field to subsystem usage.
+     *
+     * @param[in] subsystem Name of subsystem.
+     * @param[in] field Field with allocated storage.
+     */
+    static void addField(const char* subsystem,
+                         const pylith::topology::Field& field);
+
+    /** Set current subsystem usage from matrix storage.
+     *
+     * @param[in] subsystem Name of subsystem.
+     * @param[in] matrix Allocated matrix.
+     */
+    static void trackMatrix(const char* subsystem,
+                            const PetscMat matrix);
+
+    /** Get report of per-subsystem and process memory usage on this rank.
+     *
+     * @returns String with current and high-water usage per subsystem.
+     */
+    static std::string report(void);
+
+    /// Discard accumulated usage.
+    static void reset(void);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    /// Current and high-water usage for one subsystem.
+    struct Usage {
+        size_t current; ///< Current usage (bytes).
+        size_t highWater; ///< High-water usage (bytes).
+        Usage(void) :
+            current(0),
+            highWater(0) {}
+
+
+    }; // Usage
+
+    typedef std::map<std::string, Usage> usage_map;
+
+    // Usage is thread local so that independent problem instances running on disjoint
+    // threads within one process do not race on the accumulators; report() covers the
+    // allocations tracked by the calling thread.
+    static thread_local usage_map _usage; ///< Usage per subsystem on this thread.
+
+}; // MemoryLogger
+
+#endif // pylith_utils_memorylogger_hh
+
+// End of file
@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/utils/MultiQueryDB.hh
+ *
+ * @brief Interface for spatial databases that can be queried at many locations in one call,
+ * converting all of the coordinates to the coordinate system of the database at once instead
+ * of once per location. Geographic coordinate systems pay per-call projection setup, so
+ * batching the conversion matters when models query millions of locations at startup.
+ */
+
+#if !defined(pylith_utils_multiquerydb_hh)
+#define pylith_utils_multiquerydb_hh
+
+#include "utilsfwd.hh" // forward declarations
+
+#include "spatialdata/geocoords/geocoordsfwd.hh" // USES CoordSys
+
+#include <cstddef> // USES size_t
+
+class pylith::utils::MultiQueryDB {
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Destructor.
+    virtual ~MultiQueryDB(void) {}
+
+    /** Query the database at multiple locations.
+     *
+     * The coordinates of all locations are converted to the coordinate system of the database
+     * in a single call before the values are computed.
+     *
+     * @pre Must call open() before queryMulti().
+     *
+     * @param[out] vals Values at the locations [numLocs*numVals].
+     * @param[in] numVals Number of values to be returned per location.
+     * @param[in] coords Coordinates of the locations [numLocs*numDims].
+     * @param[in] numLocs Number of locations.
+     * @param[in] numDims Number of dimensions for coordinates.
+     * @param[in] csQuery Coordinate system of coordinates.
+     */
+    virtual
+    void queryMulti(double* vals,
+                    const size_t numVals,
+                    const double* coords,
+                    const size_t numLocs,
+                    const size_t numDims,
+                    const spatialdata::geocoords::CoordSys* csQuery) = 0;
+
+}; // class MultiQueryDB
+
+#endif // pylith_utils_multiquerydb_hh
+
+// End of file
@@ -0,0 +1,248 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "PerfLogger.hh" // Implementation of class methods
+
+#include "petscsys.h" // USES PetscGetFlops()
+
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ofstream
+#include <algorithm> // USES std::min(), std::max()
+#include <cstring> // USES strlen()
+#include <cassert> // USES assert()
+
+thread_local pylith::utils::PerfLogger::profile_map pylith::utils::PerfLogger::_profile;
+thread_local std::vector<pylith::utils::PerfLogger::OpenScope> pylith::utils::PerfLogger::_stack;
+std::string pylith::utils::PerfLogger::_filename;
+bool pylith::utils::PerfLogger::_enabled = false;
+
+// ----------------------------------------------------------------------
+// Constructor for timer scope.
+pylith::utils::PerfLogger::Scope::Scope(const char* name) :
+    _active(pylith::utils::PerfLogger::isEnabled()) {
+    if (_active) {
+        pylith::utils::PerfLogger::begin(name);
+    } // if
+} // Scope constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor for timer scope.
+pylith::utils::PerfLogger::Scope::~Scope(void) {
+    if (_active) {
+        pylith::utils::PerfLogger::end();
+    } // if
+} // Scope destructor
+
+
+// ----------------------------------------------------------------------
+// Enable profiling and set output filename.
+void
+pylith::utils::PerfLogger::enable(const char* filename) {
+    assert(filename);
+    if (0 == strlen(filename)) {
+        throw std::runtime_error("Empty string given for profile filename.");
+    } // if
+
+    _filename = filename;
+    _enabled = true;
+} // enable
+
+
+// ----------------------------------------------------------------------
+// Check whether profiling is enabled.
+bool
+pylith::utils::PerfLogger::isEnabled(void) {
+    return _enabled;
+} // isEnabled
+
+
+// ----------------------------------------------------------------------
+// Begin timer scope.
+void
+pylith::utils::PerfLogger::begin(const char* name) {
+    if (!_enabled) { return; }
+
+    assert(name);
+    OpenScope scope;
+    scope.path = !_stack.empty() ? _stack.back().path + "/" + name : std::string(name);
+    scope.time = MPI_Wtime();
+    PetscLogDouble flops = 0.0;
+    const PetscErrorCode err = PetscGetFlops(&flops);
+    scope.flops = (!err) ? flops : 0.0;
+    _stack.push_back(scope);
+} // begin
+
+
+// ----------------------------------------------------------------------
+// End innermost timer scope.
+void
+pylith::utils::PerfLogger::end(void) {
+    if (!_enabled) { return; }
+
+    assert(!_stack.empty());
+    PetscLogDouble flops = 0.0;
+    const PetscErrorCode err = PetscGetFlops(&flops);
+
+    Accumulator& accumulator = _profile[_stack.back().path];
+    accumulator.count += 1;
+    accumulator.total += MPI_Wtime() - _stack.back().time;
+    accumulator.flops += (!err) ? flops - _stack.back().flops : 0.0;
+    _stack.pop_back();
+} // end
+
+
+// ----------------------------------------------------------------------
+// Attribute data movement to the innermost open scope.
+void
+pylith::utils::PerfLogger::addBytes(const double bytes) {
+    if (!_enabled || _stack.empty()) { return; }
+
+    _profile[_stack.back().path].bytes += bytes;
+} // addBytes
+
+
+// ----------------------------------------------------------------------
+// Write profile as JSON with min/max/mean across ranks.
+void
+pylith::utils::PerfLogger::write(MPI_Comm comm) {
+    if (!_enabled) { return; }
+
+    // Serialize the local profile; ranks may hold different paths after mesh
+    // distribution, so the merge uses a union of paths rather than a reduction.
+    std::ostringstream serial;
+    serial.precision(15);
+    for (profile_map::const_iterator iter = _profile.begin(); iter != _profile.end(); ++iter) {
+        serial << iter->first << "\t" << iter->second.count << "\t" << iter->second.total
+               << "\t" << iter->second.flops << "\t" << iter->second.bytes << "\n";
+    } // for
+    const std::string& localBuffer = serial.str();
+    const int localSize = int(localBuffer.size());
+
+    int commRank = 0;
+    int commSize = 0;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+
+    std::vector<int> bufferSizes(commSize, 0);
+    MPI_Gather((void*)&localSize, 1, MPI_INT, &bufferSizes[0], 1, MPI_INT, 0, comm);
+
+    std::vector<int> bufferOffsets(commSize, 0);
+    int totalSize = 0;
+    if (0 == commRank) {
+        for (int i = 0; i < commSize; ++i) {
+            bufferOffsets[i] = totalSize;
+            totalSize += bufferSizes[i];
+        } // for
+    } // if
+    std::vector<char> globalBuffer(totalSize > 0 ? totalSize : 1);
+    MPI_Gatherv((void*)localBuffer.c_str(), localSize, MPI_CHAR, &globalBuffer[0],
+                &bufferSizes[0], &bufferOffsets[0], MPI_CHAR, 0, comm);
+
+    if (commRank > 0) { return; }
+
+    // Merge per-rank profiles into min/max/mean per path.
+    struct Stats {
+        long count;
+        double min;
+        double max;
+        double sum;
+        double flopsSum;
+        double bytesSum;
+        int numRanks;
+        Stats(void) :
+            count(0),
+            min(0.0),
+            max(0.0),
+            sum(0.0),
+            flopsSum(0.0),
+            bytesSum(0.0),
+            numRanks(0) {}
+
+
+    }; // Stats
+    std::map<std::string, Stats> merged;
+    for (int i = 0; i < commSize; ++i) {
+        std::istringstream rankBuffer(std::string(&globalBuffer[bufferOffsets[i]], bufferSizes[i]));
+        std::string line;
+        while (std::getline(rankBuffer, line)) {
+            std::istringstream tokens(line);
+            std::string path;
+            long count = 0;
+            double total = 0.0, flops = 0.0, bytes = 0.0;
+            if (!std::getline(tokens, path, '\t')) { continue; }
+            tokens >> count >> total >> flops >> bytes;
+
+            Stats& stats = merged[path];
+            if (0 == stats.numRanks) {
+                stats.min = total;
+                stats.max = total;
+            } else {
+                stats.min = std::min(stats.min, total);
+                stats.max = std::max(stats.max, total);
+            } // if/else
+            stats.sum += total;
+            stats.flopsSum += flops;
+            stats.bytesSum += bytes;
+            stats.count = std::max(stats.count, count);
+            stats.numRanks += 1;
+        } // while
+    } // for
+
+    std::ofstream profile(_filename.c_str());
+    if (!profile.is_open()) {
+        std::ostringstream msg;
+        msg << "Could not open profile file '" << _filename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+    profile.precision(6);
+    profile << "{\n  \"num_ranks\": " << commSize << ",\n  \"scopes\": [\n";
+    for (std::map<std::string, Stats>::const_iterator iter = merged.begin(); iter != merged.end(); ++iter) {
+        if (iter != merged.begin()) { profile << ",\n"; }
+        const Stats& stats = iter->second;
+        profile << "    {\"path\": \"" << iter->first << "\""
+                << ", \"count\": " << stats.count
+                << ", \"min\": " << stats.min
+                << ", \"max\": " << stats.max
+                << ", \"mean\": " << stats.sum / stats.numRanks
+                << ", \"flops_mean\": " << stats.flopsSum / stats.numRanks
+                << ", \"bytes_mean\": " << stats.bytesSum / stats.numRanks
+                << ", \"flop_rate\": " << ((stats.sum > 0.0) ? stats.flopsSum / stats.sum : 0.0)
+                << ", \"intensity\": " << ((stats.bytesSum > 0.0) ? stats.flopsSum / stats.bytesSum : 0.0)
+                << "}";
+    } // for
+    profile << "\n  ]\n}\n";
+    profile.close();
+} // write
+
+
+// ----------------------------------------------------------------------
+// Discard accumulated profile and disable profiling.
+void
+pylith::utils::PerfLogger::reset(void) {
+    _profile.clear();
+    _stack.clear();
+    _filename = "";
+    _enabled = false;
+} // reset
+
+
+// End of file
@@ -0,0 +1,162 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file libsrc/utils/PerfLogger.hh
+ *
+ * @brief Hierarchical wall-clock profiling with per-kernel attribution.
+ *
+ * Timer scopes nest; each scope accumulates under the path formed by the
+ * enclosing scopes (e.g., "lhs_residual/elasticity_crust"), so the profile
+ * attributes time to individual materials, interfaces, and boundary
+ * conditions. Each scope also accumulates the flops PETSc logs while it is
+ * open and the estimated bytes moved reported via addBytes(), giving the
+ * achieved flop rate and arithmetic intensity per scope for roofline
+ * analysis. The profile is written as JSON with the minimum, maximum, and
+ * mean time across ranks. When disabled (the default), scopes reduce to a
+ * single boolean test.
+ */
+
+#if !defined(pylith_utils_perflogger_hh)
+#define pylith_utils_perflogger_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/mpi.hh" // USES MPI_Comm
+
+#include <string> // HASA std::string
+#include <map> // HASA std::map
+#include <vector> // HASA std::vector
+
+// PerfLogger -----------------------------------------------------------
+/// Hierarchical wall-clock profiling with per-kernel attribution.
+class pylith::utils::PerfLogger {
+    friend class TestPerfLogger; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /// Timer scope; accumulates time from construction to destruction under
+    /// the path formed by the enclosing scopes on the same rank.
+    class Scope {
+public:
+
+        /** Constructor.
+         *
+         * @param[in] name Name of scope (appended to enclosing scope path).
+         */
+        Scope(const char* name);
+
+        /// Destructor.
+        ~Scope(void);
+
+private:
+
+        bool _active; ///< True if profiling was enabled at construction.
+
+private:
+
+        Scope(const Scope&); ///< Not implemented.
+        const Scope& operator=(const Scope&); ///< Not implemented.
+    }; // Scope
+
+    /** Enable profiling and set output filename.
+     *
+     * @param[in] filename Name of JSON file for profile.
+     */
+    static void enable(const char* filename);
+
+    /** Check whether profiling is enabled.
+     *
+     * @returns True if profiling is enabled.
+     */
+    static bool isEnabled(void);
+
+    /** Begin timer scope.
+     *
+     * @param[in] name Name of scope (appended to enclosing scope path).
+     */
+    static void begin(const char* name);
+
+    /// End innermost timer scope.
+    static void end(void);
+
+    /** Attribute data movement to the innermost open scope.
+     *
+     * Bytes are an estimate of the memory traffic of the work in the scope
+     * (fields read and written); together with the flops PETSc logs during
+     * the scope they give the arithmetic intensity and achieved flop rate
+     * for roofline analysis.
+     *
+     * @param[in] bytes Estimated bytes moved.
+     */
+    static void addBytes(const double bytes);
+
+    /** Write profile as JSON with min/max/mean across ranks.
+     *
+     * Collective on comm; rank 0 writes the file.
+     *
+     * @param[in] comm MPI communicator for reduction across ranks.
+     */
+    static void write(MPI_Comm comm);
+
+    /// Discard accumulated profile and disable profiling.
+    static void reset(void);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    /// Accumulated time, work, and call count for one scope path.
+    struct Accumulator {
+        long count; ///< Number of times scope was entered.
+        double total; ///< Total time in scope (seconds).
+        double flops; ///< Flops logged by PETSc while scope was open.
+        double bytes; ///< Estimated bytes moved in scope (from addBytes()).
+        Accumulator(void) :
+            count(0),
+            total(0.0),
+            flops(0.0),
+            bytes(0.0) {}
+
+
+    }; // Accumulator
+
+    /// Open scope (path and counters at entry).
+    struct OpenScope {
+        std::string path; ///< Path formed by enclosing scopes.
+        double time; ///< Wall time at scope entry.
+        double flops; ///< Logged flops at scope entry.
+    }; // OpenScope
+
+    typedef std::map<std::string, Accumulator> profile_map;
+
+    // Accumulation state is thread local so that independent problem instances running on
+    // disjoint threads within one process do not interleave scopes or race on the
+    // accumulators; write() reports the profile of the calling thread. Configuration
+    // (filename, enabled flag) is process wide and set before worker threads start.
+    static thread_local profile_map _profile; ///< Accumulated time per scope path on this thread.
+    static thread_local std::vector<OpenScope> _stack; ///< Open scopes.
+    static std::string _filename; ///< Name of JSON output file.
+    static bool _enabled; ///< True if profiling is enabled.
+
+}; // PerfLogger
+
+#endif // pylith_utils_perflogger_hh
+
+// End of file
@@ -29,6 +29,9 @@
 #include "pylith/utils/mpi.hh" // USES isRoot()
 
 #include <cassert>
+#include <cstring> // USES strlen()
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream
 
 namespace pylith {
     namespace utils {
@@ -85,6 +88,65 @@ public:
             static
             void addInitialGuess(PetscOptions* options);
 
+            /** Add GPU options.
+             *
+             * @param[in] options PETSc options.
+             */
+            static
+            void addGPU(PetscOptions* options);
+
+            /** Add Schur complement elimination options for the fault Lagrange multipliers.
+             *
+             * @param[in] options PETSc options.
+             * @param[in] isParallel True if solving problem in parallel, false if in serial.
+             */
+            static
+            void addFaultSchurElimination(PetscOptions* options,
+                                          const bool isParallel);
+
+            /** Add tuned algebraic multigrid options for elasticity.
+             *
+             * @param[in] options PETSc options.
+             * @param[in] solution Solution field for problem.
+             * @param[in] hasFault True if problem has a fault, false otherwise.
+             */
+            static
+            void addElasticityMultigrid(PetscOptions* options,
+                                        const pylith::topology::Field& solution,
+                                        const bool hasFault);
+
+            /** Add pipelined Krylov options for latency-bound runs.
+             *
+             * @param[in] options PETSc options.
+             * @param[in] hasFault True if problem has a fault, false otherwise.
+             */
+            static
+            void addPipelinedKrylov(PetscOptions* options,
+                                    const bool hasFault);
+
+            /** Warn about user options that defeat the solver presets.
+             *
+             * A user value for a solver type option (name ending in '_type') that differs from
+             * the preset value changes the solver structure, usually defeating the tuned preset.
+             *
+             * @param[in] optionsIgnored Default options ignored in favor of user values.
+             */
+            static
+            void checkConflicts(const PetscOptions& optionsIgnored);
+
+            /** Write effective PETSc options with provenance to file.
+             *
+             * @param[in] optionsUsed Default options applied.
+             * @param[in] optionsIgnored Default options ignored in favor of user values.
+             * @param[in] filename Name of file for dump.
+             */
+            static
+            void writeEffective(const PetscOptions& optionsUsed,
+                                const PetscOptions& optionsIgnored,
+                                const char* filename);
+
+            static const int pipelineCommSizeMin; ///< Communicator size at which pipelined Krylov methods pay off.
+            static std::string dumpFilename; ///< Name of file for dump of effective options (empty means no dump).
         };
     }
 }
@@ -96,6 +158,12 @@ const int pylith::utils::PetscDefaults::SOLVER = 0x2;
 const int pylith::utils::PetscDefaults::PARALLEL = 0x4;
 const int pylith::utils::PetscDefaults::INITIAL_GUESS = 0x8;
 const int pylith::utils::PetscDefaults::TESTING = 0x10;
+const int pylith::utils::PetscDefaults::GPU = 0x20;
+const int pylith::utils::PetscDefaults::FAULT_SCHUR = 0x40;
+const int pylith::utils::PetscDefaults::MULTIGRID = 0x80;
+
+const int pylith::utils::_PetscOptions::pipelineCommSizeMin = 512;
+std::string pylith::utils::_PetscOptions::dumpFilename;
 
 // ------------------------------------------------------------------------------------------------
 // Set default PETSc solver options based on solution field and material.
@@ -111,9 +179,9 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
     } // if
 
     PetscOptions* options = NULL;
+    const bool isParallel = flags & PARALLEL || _PetscOptions::isParallel(solution);
+    const bool hasFault = _PetscOptions::hasFault(solution);
     if (flags & SOLVER) {
-        const bool isParallel = flags & PARALLEL || _PetscOptions::isParallel(solution);
-        const bool hasFault = _PetscOptions::hasFault(solution);
         options = material->getSolverDefaults(isParallel, hasFault);
     } // if
     if (!options) {
@@ -121,6 +189,19 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
     } // if
     assert(options);
 
+    if ((flags & FAULT_SCHUR) && hasFault) {
+        _PetscOptions::addFaultSchurElimination(options, isParallel);
+    } // if
+    if ((flags & MULTIGRID) && solution.hasSubfield("displacement")) {
+        _PetscOptions::addElasticityMultigrid(options, solution, hasFault);
+    } // if
+    if (flags & SOLVER) {
+        int commSize = 0;
+        MPI_Comm_size(solution.getMesh().getComm(), &commSize);
+        if (commSize >= _PetscOptions::pipelineCommSizeMin) {
+            _PetscOptions::addPipelinedKrylov(options, hasFault);
+        } // if
+    } // if
     _PetscOptions::addSolverTolerances(options);
     if (flags & INITIAL_GUESS) {
         _PetscOptions::addInitialGuess(options);
@@ -131,6 +212,9 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
     if (flags & MONITORS) {
         _PetscOptions::addMonitoring(options);
     } // if
+    if (flags & GPU) {
+        _PetscOptions::addGPU(options);
+    } // if
 
     options->set();
     delete options;options = NULL;
@@ -139,6 +223,14 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
 } // setDefaults
 
 
+// ------------------------------------------------------------------------------------------------
+// Set filename for dump of effective PETSc options with provenance.
+void
+pylith::utils::PetscDefaults::setDumpFilename(const char* filename) {
+    _PetscOptions::dumpFilename = filename;
+} // setDumpFilename
+
+
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::utils::PetscOptions::PetscOptions(void) {
@@ -210,6 +302,13 @@ pylith::utils::PetscOptions::set(void) {
         } // if
     } // if
 
+    if (pylith::utils::MPI::isRoot()) {
+        _PetscOptions::checkConflicts(optionsIgnored);
+        if (!_PetscOptions::dumpFilename.empty()) {
+            _PetscOptions::writeEffective(optionsUsed, optionsIgnored, _PetscOptions::dumpFilename.c_str());
+        } // if
+    } // if
+
     PYLITH_METHOD_END;
 } // set
 
@@ -342,4 +441,200 @@ pylith::utils::_PetscOptions::addInitialGuess(PetscOptions* options) {
 } // addInitialGuess
 
 
+// ------------------------------------------------------------------------------------------------
+// Add GPU defaults.
+void
+pylith::utils::_PetscOptions::addGPU(PetscOptions* options) {
+    assert(options);
+
+    // Keep vectors and assembled matrices resident on the device so residual evaluation and the
+    // solve avoid host-device transfers each time step. The finite-element kernels remain on the
+    // host; PETSc migrates data as needed.
+    options->add("-dm_vec_type", "cuda");
+    options->add("-dm_mat_type", "aijcusparse");
+
+} // addGPU
+
+
+// ------------------------------------------------------------------------------------------------
+// Add Schur complement elimination options for the fault Lagrange multipliers.
+void
+pylith::utils::_PetscOptions::addFaultSchurElimination(PetscOptions* options,
+                                                       const bool isParallel) {
+    assert(options);
+
+    // The Lagrange multipliers couple displacement degrees of freedom only across the cohesive
+    // cells, so the Schur complement preconditioner formed from the diagonal of the elasticity
+    // block (selfp) retains the fault sparsity and is cheap to build and factor. We use the full
+    // Schur factorization so the multiplier block is eliminated exactly instead of approximately
+    // as in the generic field split set up by the materials.
+    options->add("-pc_type", "fieldsplit");
+    options->add("-pc_use_amat");
+    options->add("-pc_fieldsplit_type", "schur");
+    options->add("-pc_fieldsplit_schur_factorization_type", "full");
+    options->add("-pc_fieldsplit_schur_precondition", "selfp");
+    options->add("-pc_fieldsplit_schur_scale", "1.0");
+
+    options->add("-fieldsplit_displacement_ksp_type", "preonly");
+    if (!isParallel) {
+        options->add("-fieldsplit_displacement_pc_type", "lu");
+        options->add("-fieldsplit_lagrange_multiplier_fault_ksp_type", "preonly");
+        options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "lu");
+    } else {
+        options->add("-fieldsplit_displacement_pc_type", "ml");
+        options->add("-fieldsplit_lagrange_multiplier_fault_ksp_type", "gmres");
+        options->add("-fieldsplit_lagrange_multiplier_fault_ksp_rtol", "1.0e-09");
+        options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "asm");
+        options->add("-fieldsplit_lagrange_multiplier_fault_sub_pc_type", "lu");
+    } // if/else
+} // addFaultSchurElimination
+
+
+// ------------------------------------------------------------------------------------------------
+// Add tuned algebraic multigrid options for elasticity.
+void
+pylith::utils::_PetscOptions::addElasticityMultigrid(PetscOptions* options,
+                                                     const pylith::topology::Field& solution,
+                                                     const bool hasFault) {
+    assert(options);
+
+    // With a fault the displacement block sits inside the field split; without one the options
+    // apply to the outer preconditioner.
+    const std::string prefix = hasFault ? "-fieldsplit_displacement_" : "-";
+
+    // Smoothed aggregation with rigid-body near-null space; the modes are attached to the
+    // displacement field by the problem during initialization, so GAMG picks them up from the
+    // matrix. The aggregation threshold is raised above the PETSc default because crustal meshes
+    // have high-aspect-ratio cells whose weak connections otherwise produce aggregates that
+    // degrade the coarse grids.
+    options->add((prefix + "pc_type").c_str(), "gamg");
+    options->add((prefix + "pc_gamg_type").c_str(), "agg");
+    options->add((prefix + "pc_gamg_agg_nsmooths").c_str(), "1");
+    options->add((prefix + "pc_gamg_threshold").c_str(), "0.04");
+    options->add((prefix + "pc_gamg_threshold_scale").c_str(), "0.5");
+    options->add((prefix + "pc_gamg_coarse_eq_limit").c_str(), "1000");
+
+    // Chebyshev/Jacobi smoothing with a CG eigenvalue estimate; the elasticity block is SPD.
+    options->add((prefix + "mg_levels_ksp_type").c_str(), "chebyshev");
+    options->add((prefix + "mg_levels_esteig_ksp_type").c_str(), "cg");
+    options->add((prefix + "mg_levels_ksp_max_it").c_str(), "2");
+    options->add((prefix + "mg_levels_pc_type").c_str(), "jacobi");
+
+    // With a pure displacement layout the assembled matrix is blocked by the number of
+    // displacement components; telling the matrix improves aggregation and MatMult throughput.
+    if (1 == solution.getSubfieldNames().size()) {
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo("displacement");
+        std::ostringstream blockSize;
+        blockSize << info.description.numComponents;
+        options->add("-mat_block_size", blockSize.str().c_str());
+    } // if
+} // addElasticityMultigrid
+
+
+// ------------------------------------------------------------------------------------------------
+// Add pipelined Krylov options for latency-bound runs.
+void
+pylith::utils::_PetscOptions::addPipelinedKrylov(PetscOptions* options,
+                                                 const bool hasFault) {
+    assert(options);
+
+    // At large communicator sizes the blocking allreduce behind each Krylov dot product
+    // dominates the iteration. The pipelined variants perform a single nonblocking reduction
+    // overlapped with the matrix-vector product and preconditioner application, at the cost of
+    // a few extra vector operations.
+    if (!hasFault) {
+        options->add("-ksp_type", "pipecg"); // Elasticity operator is symmetric positive definite.
+    } else {
+        // The outer solver wraps the field split, whose inner solves make the preconditioner
+        // nonstationary, so use the flexible pipelined variant.
+        options->add("-ksp_type", "pipefgmres");
+    } // if/else
+} // addPipelinedKrylov
+
+
+// ------------------------------------------------------------------------------------------------
+// Warn about user options that defeat the solver presets.
+void
+pylith::utils::_PetscOptions::checkConflicts(const PetscOptions& optionsIgnored) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    const PetscOptions::options_t::const_iterator begin = optionsIgnored._options.begin();
+    const PetscOptions::options_t::const_iterator end = optionsIgnored._options.end();
+    for (PetscOptions::options_t::const_iterator iter = begin; iter != end; ++iter) {
+        const std::string& name = iter->first;
+        const std::string& valueDefault = iter->second;
+
+        // Options ending in '_type' select the solver structure; differing user values defeat
+        // the tuned preset. Differing tolerances and monitor settings are legitimate tuning.
+        const std::string suffix = "_type";
+        if ((name.length() < suffix.length()) ||
+            (name.compare(name.length()-suffix.length(), suffix.length(), suffix) != 0)) {
+            continue;
+        } // if
+
+        char valueUser[256];
+        PetscBool found = PETSC_FALSE;
+        err = PetscOptionsGetString(NULL, NULL, name.c_str(), valueUser, sizeof(valueUser), &found);PYLITH_CHECK_ERROR(err);
+        if (found && (valueDefault != valueUser)) {
+            pythia::journal::warning_t warning("petscoptions");
+            warning << pythia::journal::at(__HERE__)
+                    << "User value '" << valueUser << "' for PETSc option '" << name.substr(1)
+                    << "' overrides the value '" << valueDefault << "' from the PyLith solver defaults. "
+                    << "This changes the solver structure and usually defeats the tuned preset; "
+                    << "remove the user option or turn off the corresponding flag in petsc_defaults."
+                    << pythia::journal::endl;
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // checkConflicts
+
+
+// ------------------------------------------------------------------------------------------------
+// Write effective PETSc options with provenance to file.
+void
+pylith::utils::_PetscOptions::writeEffective(const PetscOptions& optionsUsed,
+                                             const PetscOptions& optionsIgnored,
+                                             const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    std::ofstream fout(filename);
+    if (!fout.is_open()) {
+        pythia::journal::warning_t warning("petscoptions");
+        warning << pythia::journal::at(__HERE__)
+                << "Could not open file '" << filename << "' for dump of effective PETSc options."
+                << pythia::journal::endl;
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode err = 0;
+    fout << "# Effective PETSc options with provenance.\n";
+
+    fout << "\n# Defaults applied by PyLith.\n";
+    for (PetscOptions::options_t::const_iterator iter = optionsUsed._options.begin();
+         iter != optionsUsed._options.end(); ++iter) {
+        fout << iter->first.substr(1) << " = " << (iter->second.empty() ? "true" : iter->second) << "\n";
+    } // for
+
+    fout << "\n# Defaults overridden by user options.\n";
+    for (PetscOptions::options_t::const_iterator iter = optionsIgnored._options.begin();
+         iter != optionsIgnored._options.end(); ++iter) {
+        char valueUser[256];
+        PetscBool found = PETSC_FALSE;
+        err = PetscOptionsGetString(NULL, NULL, iter->first.c_str(), valueUser, sizeof(valueUser), &found);PYLITH_CHECK_ERROR(err);
+        fout << iter->first.substr(1) << " = " << (found && strlen(valueUser) ? valueUser : "true")
+             << " # overrides PyLith default '" << (iter->second.empty() ? "true" : iter->second) << "'\n";
+    } // for
+
+    fout << "\n# Complete PETSc options database.\n";
+    char* optionsAll = NULL;
+    err = PetscOptionsGetAll(NULL, &optionsAll);PYLITH_CHECK_ERROR(err);
+    fout << optionsAll << "\n";
+    err = PetscFree(optionsAll);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // writeEffective
+
+
 // End of file
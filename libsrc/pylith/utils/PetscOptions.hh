@@ -42,6 +42,9 @@ public:
     static const int PARALLEL;
     static const int INITIAL_GUESS;
     static const int TESTING;
+    static const int GPU;
+    static const int FAULT_SCHUR;
+    static const int MULTIGRID;
 
     // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
 public:
@@ -57,6 +60,16 @@ public:
              const pylith::materials::Material* material,
              const int flags);
 
+    /** Set filename for dump of effective PETSc options with provenance.
+     *
+     * The dump lists the defaults applied, the defaults overridden by user options (with both
+     * values), and the complete PETSc options database actually used.
+     *
+     * @param[in] filename Name of file for dump (empty string disables dump).
+     */
+    static
+    void setDumpFilename(const char* filename);
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
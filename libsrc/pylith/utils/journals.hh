@@ -28,29 +28,40 @@
 #include "pythia/journal/diagnostics.h"
 #include "pylith/utils/mpi.hh"
 
+// Debug-level messages are disabled by default at runtime, so the streaming of the message
+// arguments is guarded by the journal state to avoid formatting messages that are discarded.
+// Configuring with --disable-journal-debug removes the debug-level calls at compile time.
+#if defined(PYLITH_DISABLE_JOURNAL_DEBUG)
+#define PYLITH_COMPONENT_DEBUG(msg) \
+    do { } while (0)
+#else
 #define PYLITH_COMPONENT_DEBUG(msg) \
     do { \
         pythia::journal::debug_t debug(PyreComponent::getName()); \
-        debug << pythia::journal::at(__HERE__) \
-              << "Component '"<<PyreComponent::getIdentifier()<<"': " \
-              << msg << pythia::journal::endl; \
+        if (debug.state()) { \
+            debug << pythia::journal::at(__HERE__) \
+                  << "Component '"<<PyreComponent::getIdentifier()<<"': " \
+                  << msg << pythia::journal::endl; } \
     } while (0)
+#endif
 
 #define PYLITH_COMPONENT_INFO_ROOT(msg) \
     do { \
         if (pylith::utils::MPI::isRoot()) { \
             pythia::journal::info_t info(PyreComponent::getName()); \
-            info << pythia::journal::at(__HERE__) \
-                 << "Component '"<<PyreComponent::getIdentifier()<<"': " \
-                 << msg << pythia::journal::endl; } \
+            if (info.state()) { \
+                info << pythia::journal::at(__HERE__) \
+                     << "Component '"<<PyreComponent::getIdentifier()<<"': " \
+                     << msg << pythia::journal::endl; } } \
     } while (0)
 
 #define PYLITH_COMPONENT_INFO(msg) \
     do { \
         pythia::journal::info_t info(PyreComponent::getName()); \
-        info << pythia::journal::at(__HERE__) \
-             << "Component '"<<PyreComponent::getIdentifier()<<"': " \
-             << msg << pythia::journal::endl; \
+        if (info.state()) { \
+            info << pythia::journal::at(__HERE__) \
+                 << "Component '"<<PyreComponent::getIdentifier()<<"': " \
+                 << msg << pythia::journal::endl; } \
     } while (0)
 
 #define PYLITH_COMPONENT_WARNING(msg) \
@@ -78,26 +89,34 @@
         throw std::logic_error(firewall.str().c_str()); \
     } while (0)
 
+#if defined(PYLITH_DISABLE_JOURNAL_DEBUG)
+#define PYLITH_JOURNAL_DEBUG(msg) \
+    do { } while (0)
+#else
 #define PYLITH_JOURNAL_DEBUG(msg) \
     do { \
         pythia::journal::debug_t debug(GenericComponent::getName()); \
-        debug << pythia::journal::at(__HERE__) \
-              << msg << pythia::journal::endl; \
+        if (debug.state()) { \
+            debug << pythia::journal::at(__HERE__) \
+                  << msg << pythia::journal::endl; } \
     } while (0)
+#endif
 
 #define PYLITH_JOURNAL_INFO_ROOT(msg) \
     do { \
         if (pylith::utils::MPI::isRoot()) { \
             pythia::journal::info_t info(GenericComponent::getName()); \
-            info << pythia::journal::at(__HERE__) \
-                 << msg << pythia::journal::endl; } \
+            if (info.state()) { \
+                info << pythia::journal::at(__HERE__) \
+                     << msg << pythia::journal::endl; } } \
     } while (0)
 
 #define PYLITH_JOURNAL_INFO(msg) \
     do { \
         pythia::journal::info_t info(GenericComponent::getName()); \
-        info << pythia::journal::at(__HERE__) \
-             << msg << pythia::journal::endl; \
+        if (info.state()) { \
+            info << pythia::journal::at(__HERE__) \
+                 << msg << pythia::journal::endl; } \
     } while (0)
 
 #define PYLITH_JOURNAL_WARNING(msg) \
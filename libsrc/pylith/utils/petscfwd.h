@@ -76,6 +76,9 @@ typedef struct _p_PetscFE* PetscFE;
 /// forward declaration for PETSc weak form
 typedef struct _p_PetscWeakForm* PetscWeakForm;
 
+/// forward declaration for PETSc Mat null space
+typedef struct _p_MatNullSpace* PetscMatNullSpace;
+
 #endif // pylith_utils_petscfwd_h
 
 // End of file
@@ -31,6 +31,20 @@ typedef PetscScalar PylithScalar;
 typedef PetscReal PylithReal;
 typedef PetscInt PylithInt;
 
+/* Type for arithmetic inside the hot finite-element kernels for dynamic simulations.
+ *
+ * Configure with --enable-single-precision-kernels to evaluate the kernel arithmetic in
+ * single precision while accumulating into the residual and Jacobian arrays in the
+ * (PetscScalar) storage precision. Explicit wave-propagation residuals are insensitive to
+ * the kernel arithmetic precision, and the narrower type reduces the pressure on memory
+ * bandwidth in bandwidth-bound runs.
+ */
+#if defined(PYLITH_KERNELS_SINGLE_PRECISION)
+typedef float PylithKernelScalar;
+#else
+typedef PylithScalar PylithKernelScalar;
+#endif
+
 typedef PetscErrorCode (*PetscUserFieldFunc)(PetscInt,
                                              PetscReal,
                                              const PetscReal x[],
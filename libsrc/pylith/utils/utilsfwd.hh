@@ -33,6 +33,13 @@ namespace pylith {
         class PetscDefaults;
 
         class EventLogger;
+        class PerfLogger;
+        class MemoryLogger;
+        class CommLogger;
+        class Expression;
+        class MultiQueryDB;
+        class AnalyticDB;
+        class MMapGridDB;
         class GenericComponent;
         class PyreComponent;
 
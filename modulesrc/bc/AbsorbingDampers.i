@@ -36,6 +36,18 @@ public:
             /// Deallocate PETSc and local data structures.
             void deallocate(void);
 
+            /** Set name of file holding stored impedance operator.
+             *
+             * @param[in] value Name of impedance operator file (empty string turns off stored operator).
+             */
+            void setImpedanceFilename(const char* value);
+
+            /** Get name of file holding stored impedance operator.
+             *
+             * @returns Name of impedance operator file.
+             */
+            const char* getImpedanceFilename(void) const;
+
             /** Verify configuration is acceptable.
              *
              * @param[in] solution Solution field.
@@ -49,6 +49,18 @@ public:
              */
             const char* getSubfieldName(void) const;
 
+            /** Set names of additional boundaries merged into this boundary condition.
+             *
+             * @param[in] labelNames Array of names of labels for additional boundaries.
+             * @param[in] numNames Number of labels.
+             */
+            %apply(const char* const* string_list, const int list_len){
+                (const char* labelNames[], const int numNames)
+            };
+            void setExtraBoundaries(const char* labelNames[],
+                                    const int numNames);
+            %clear(const char* labelNames[], const int numNames);
+
             /** Set first choice for reference direction to discriminate among tangential directions in 3-D.
              *
              * @param vec Reference direction unit vector.
@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/bc/DirichletUserFn.i
+ *
+ * @brief Python interface to C++ DirichletUserFn object.
+ */
+
+namespace pylith {
+    namespace bc {
+        class DirichletUserFn : public pylith::bc::BoundaryCondition {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Default constructor.
+            DirichletUserFn(void);
+
+            /// Destructor.
+            ~DirichletUserFn(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set indices of constrained degrees of freedom at each location.
+             *
+             * Example: [0, 1] to apply forces to x and y degrees of freedom in
+             * a Cartesian coordinate system.
+             *
+             * @param[in] dof Array of indices for constrained degrees of freedom.
+             * @param[in] size Size of array
+             */
+	    %apply(int* INPLACE_ARRAY1, int DIM1) {
+		(const int* flags,
+		 const int size)
+		    };
+            void setConstrainedDOF(const int* flags,
+                                   const int size);
+	    %clear(const int* flags, const int size);
+
+            /** Get indices of constrained degrees of freedom.
+             *
+             * @returns Array of indices for constrained degrees of freedom.
+             */
+            const pylith::int_array& getConstrainedDOF(void) const;
+
+            /** Set expressions specifying field on boundary.
+             *
+             * One expression per component of the solution subfield, in terms of the
+             * nondimensional coordinates x, y, and z and nondimensional time t.
+             *
+             * @param[in] expressions Array of expressions for components of field on boundary.
+             * @param[in] numExpressions Number of expressions.
+             */
+            %apply(const char* const* string_list, const int list_len){
+                (const char* const* expressions, const int numExpressions)
+            };
+            void setExpressions(const char* const* expressions,
+                                const int numExpressions);
+            %clear(const char* const* expressions, const int numExpressions);
+
+            /** Verify configuration is acceptable.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Create integrator and set kernels.
+             *
+             * @param[in] solution Solution field.
+             * @returns Integrator if applicable, otherwise NULL.
+             */
+            pylith::feassemble::Integrator* createIntegrator(const pylith::topology::Field& solution);
+
+            /** Create constraint and set kernels.
+             *
+             * @param[in] solution Solution field.
+             * @returns Constraint if applicable, otherwise NULL.
+             */
+            std::vector<pylith::feassemble::Constraint*> createConstraints(const pylith::topology::Field& solution);
+
+            /** Create auxiliary field.
+             *
+             * @param[in] solution Solution field.
+             * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+             *
+             * @returns Auxiliary field if applicable, otherwise NULL.
+             */
+            pylith::topology::Field* createAuxiliaryField(const pylith::topology::Field& solution,
+                                                          const pylith::topology::Mesh& domainMesh);
+
+            /** Create derived field.
+             *
+             * @param[in] solution Solution field.
+             * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+             *
+             * @returns Derived field if applicable, otherwise NULL.
+             */
+            pylith::topology::Field* createDerivedField(const pylith::topology::Field& solution,
+                                                        const pylith::topology::Mesh& domainMesh);
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Get auxiliary factory associated with physics.
+             *
+             * @return Auxiliary factory for physics object.
+             */
+            pylith::feassemble::AuxiliaryFactory* _getAuxiliaryFactory(void);
+
+        };
+
+        // class DirichletUserFn
+
+    } // bc
+} // pylith
+
+// End of file
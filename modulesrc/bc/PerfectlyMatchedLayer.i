@@ -0,0 +1,95 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/bc/PerfectlyMatchedLayer.i
+ *
+ * @brief Python interface to C++ PerfectlyMatchedLayer object.
+ */
+
+namespace pylith {
+    namespace bc {
+        class PerfectlyMatchedLayer : public pylith::bc::BoundaryCondition {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Default constructor.
+            PerfectlyMatchedLayer(void);
+
+            /// Destructor.
+            ~PerfectlyMatchedLayer(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Verify configuration is acceptable.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Create integrator and set kernels.
+             *
+             * @param[in] solution Solution field.
+             * @returns Integrator if applicable, otherwise NULL.
+             */
+            pylith::feassemble::Integrator* createIntegrator(const pylith::topology::Field& solution);
+
+            /** Create constraint and set kernels.
+             *
+             * @param[in] solution Solution field.
+             * @returns Constraint if applicable, otherwise NULL.
+             */
+            std::vector<pylith::feassemble::Constraint*> createConstraints(const pylith::topology::Field& solution);
+
+            /** Create auxiliary field.
+             *
+             * @param[in] solution Solution field.
+             * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+             *
+             * @returns Auxiliary field if applicable, otherwise NULL.
+             */
+            pylith::topology::Field* createAuxiliaryField(const pylith::topology::Field& solution,
+                                                          const pylith::topology::Mesh& domainMesh);
+
+            /** Create derived field.
+             *
+             * @param[in] solution Solution field.
+             * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+             *
+             * @returns Derived field if applicable, otherwise NULL.
+             */
+            pylith::topology::Field* createDerivedField(const pylith::topology::Field& solution,
+                                                        const pylith::topology::Mesh& domainMesh);
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Get auxiliary factory associated with physics.
+             *
+             * @return Auxiliary factory for physics object.
+             */
+            pylith::feassemble::AuxiliaryFactory* _getAuxiliaryFactory(void);
+
+        };
+
+        // class PerfectlyMatchedLayer
+
+    } // bc
+} // pylith
+
+// End of file
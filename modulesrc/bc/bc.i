@@ -20,8 +20,10 @@
 // Header files for module C++ code
 %{
 #include "pylith/bc/DirichletTimeDependent.hh"
+#include "pylith/bc/DirichletUserFn.hh"
 #include "pylith/bc/NeumannTimeDependent.hh"
 #include "pylith/bc/AbsorbingDampers.hh"
+#include "pylith/bc/PerfectlyMatchedLayer.hh"
 %}
 
 
@@ -36,6 +38,7 @@
 
 %include "typemaps.i"
 %include "../include/scalartypemaps.i"
+%include "../include/chararray.i"
 
 // Numpy interface stuff
 %{
@@ -52,8 +55,10 @@
 
 %include "BoundaryCondition.i"
 %include "DirichletTimeDependent.i"
+%include "DirichletUserFn.i"
 %include "NeumannTimeDependent.i"
 %include "AbsorbingDampers.i"
+%include "PerfectlyMatchedLayer.i"
 
 
 
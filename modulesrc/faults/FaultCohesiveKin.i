@@ -87,6 +87,9 @@ public:
             void updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
                                       const double t);
 
+            /// Re-query kinematic rupture parameters from the spatial databases.
+            void reinitializeRuptureParameters(void);
+
             // PROTECTED METHODS //////////////////////////////////////////////////////////////////
 protected:
 
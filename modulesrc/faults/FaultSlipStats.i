@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/faults/FaultSlipStats.i
+ *
+ * @brief Python interface to C++ FaultSlipStats object.
+ */
+
+namespace pylith {
+    namespace faults {
+        class FaultSlipStats : public pylith::problems::ObserverPhysics, public pylith::utils::PyreComponent {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            FaultSlipStats(void);
+
+            /// Destructor
+            virtual ~FaultSlipStats(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set filename for HDF5 slip statistics file.
+             *
+             * @param[in] filename Name of HDF5 slip statistics file.
+             */
+            void setFilename(const char* filename);
+
+            /** Get filename for HDF5 slip statistics file.
+             *
+             * @returns Name of HDF5 slip statistics file.
+             */
+            const char* getFilename(void) const;
+
+            /** Set shear modulus used to compute the seismic moment.
+             *
+             * @param[in] value Uniform shear modulus (Pa).
+             */
+            void setShearModulus(const PylithReal value);
+
+            /** Set slip threshold defining the rupture area.
+             *
+             * @param[in] value Slip threshold (m).
+             */
+            void setSlipThreshold(const PylithReal value);
+
+            /** Set time scale.
+             *
+             * @param[in] value Time scale for dimensionalizing time.
+             */
+            void setTimeScale(const PylithReal value);
+
+            /** Verify observer is compatible with solution.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Receive update (subject of observer).
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after initialization).
+             */
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution,
+                        const bool infoOnly);
+
+        }; // FaultSlipStats
+
+    } // faults
+} // pylith
+
+// End of file
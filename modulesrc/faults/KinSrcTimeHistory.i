@@ -48,13 +48,13 @@ public:
             /** Get requested slip subfields at time t.
              *
              * @param[inout] slipLocalVec Local PETSc vector for slip, slip rate, or slip acceleration values.
-             * @param[in] faultAuxiliaryField Auxiliary field for fault.
+             * @param[in] slipDM PETSc DM holding only the slip-related subfields of the fault auxiliary field.
              * @param[in] t Time t.
              * @param[in] timeScale Time scale for nondimensionalization.
              * @param[in] bitSlipSubfields Slip subfields to compute.
              */
             void getSlipSubfields(PetscVec slipLocalVec,
-                                  pylith::topology::Field* faultAuxiliaryField,
+                                  PetscDM slipDM,
                                   const PylithScalar t,
                                   const PylithScalar timeScale,
                                   const int bitSlipSubfields);
@@ -22,6 +22,7 @@
 #include "pylith/faults/FaultCohesive.hh"
 #include "pylith/faults/FaultCohesiveKin.hh"
 #include "pylith/faults/FaultCohesiveImpulses.hh"
+#include "pylith/faults/FaultCohesiveDyn.hh"
 #include "pylith/faults/KinSrc.hh"
 #include "pylith/faults/KinSrcStep.hh"
 #include "pylith/faults/KinSrcRamp.hh"
@@ -29,6 +30,7 @@
 #include "pylith/faults/KinSrcBrune.hh"
 #include "pylith/faults/KinSrcLiuCos.hh"
 #include "pylith/faults/KinSrcTimeHistory.hh"
+#include "pylith/faults/FaultSlipStats.hh"
 %}
 
 %include "exception.i"
@@ -57,10 +59,12 @@ import_array();
 // Interfaces
 %include "../utils/PyreComponent.i"
 %include "../problems/Physics.i"
+%include "../problems/ObserverPhysics.i"
 
 %include "FaultCohesive.i"
 %include "FaultCohesiveKin.i"
 %include "FaultCohesiveImpulses.i"
+%include "FaultCohesiveDyn.i"
 %include "KinSrc.i"
 %include "KinSrcStep.i"
 %include "KinSrcRamp.i"
@@ -68,5 +72,6 @@ import_array();
 %include "KinSrcBrune.i"
 %include "KinSrcLiuCos.i"
 %include "KinSrcTimeHistory.i"
+%include "FaultSlipStats.i"
 
 // End of file
@@ -20,6 +20,8 @@
 // Header files for module C++ code
 %{
 #include "pylith/utils/types.hh"
+
+#include "pylith/feassemble/AuxiliaryFactory.hh"
 %}
 
 %include "exception.i"
@@ -43,5 +45,16 @@
 import_array();
 %}
 
+%inline %{
+  /** Set directory for caching auxiliary field values across runs.
+   *
+   * @param value Name of cache directory (empty string disables caching).
+   */
+  void
+  AuxiliaryFactory_setCacheDir(const char* value) {
+    pylith::feassemble::AuxiliaryFactory::setCacheDir(value);
+  } // setCacheDir
+%}
+
 
 // End of file
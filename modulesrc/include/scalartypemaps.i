@@ -165,5 +165,28 @@ convert_scalararray(PyObject* input,
 }
 
 
+// Typemap suite for (const PylithScalar** ARGOUTVIEW_ARRAY1, PylithInt* DIM1).
+// Returns a read-only NumPy array wrapping the borrowed values without copying.
+%typemap(in,numinputs=0)
+  (const PylithScalar** ARGOUTVIEW_ARRAY1, PylithInt* DIM1)
+  (PylithScalar* data_temp = NULL, PylithInt dim_temp = 0)
+{
+  $1 = (const PylithScalar**) &data_temp;
+  $2 = &dim_temp;
+}
+%typemap(argout,
+         fragment="NumPy_Backward_Compatibility,NumPy_Macros")
+  (const PylithScalar** ARGOUTVIEW_ARRAY1, PylithInt* DIM1)
+{
+  npy_intp dims[1] = { (npy_intp) dim_temp$argnum };
+  const int typecode = (sizeof(PylithScalar) == sizeof(float)) ? NPY_FLOAT : NPY_DOUBLE;
+  PyObject* obj = PyArray_SimpleNewFromData(1, dims, typecode, (void*) data_temp$argnum);
+  PyArrayObject* array = (PyArrayObject*) obj;
+
+  if (!array) SWIG_fail;
+  array_clearflags(array, NPY_ARRAY_WRITEABLE);
+  $result = SWIG_Python_AppendOutput($result, obj);
+}
+
 
 // End of file
@@ -0,0 +1,66 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/include/spatialdbbase.i
+ *
+ * @brief Minimal declaration of spatialdata::spatialdb::SpatialDB for use as a base class.
+ *
+ * This file is imported (not included), so no wrappers are generated from it; the wrappers and
+ * runtime type information for the base class are provided by the spatialdata SWIG module.
+ */
+
+%module(package="spatialdata.spatialdb") spatialdb
+
+namespace spatialdata {
+    namespace spatialdb {
+        class SpatialDB {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Default constructor.
+            SpatialDB(void);
+
+            /// Destructor.
+            virtual ~SpatialDB(void);
+
+            /** Set description of spatial database.
+             *
+             * @param description Description of database.
+             */
+            void setDescription(const char* description);
+
+            /** Get description of spatial database.
+             *
+             * @returns Description of database.
+             */
+            const char* getDescription(void) const;
+
+            /// Open the database and prepare for querying.
+            virtual
+            void open(void) = 0;
+
+            /// Close the database.
+            virtual
+            void close(void) = 0;
+
+        }; // class SpatialDB
+
+    } // spatialdb
+} // spatialdata
+
+// End of file
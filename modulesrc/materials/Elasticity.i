@@ -48,6 +48,12 @@ public:
              */
             bool useBodyForce(void) const;
 
+            /** Set within-cell contrast in elastic moduli that marks a material interface cell.
+             *
+             * @param[in] value Contrast ratio above which a cell is treated as an interface cell (<= 1 disables).
+             */
+            void setInterfaceContrastThreshold(const double value);
+
             /** Set bulk rheology.
              *
              * @param[in] rheology Bulk rheology for elasticity.
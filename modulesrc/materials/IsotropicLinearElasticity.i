@@ -102,6 +102,20 @@ public:
              */
             PetscPointFunc getKernelCauchyStressVector(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+            /** Update kernel constants.
+             *
+             * @param[inout] kernelConstants Array of constants used in integration kernels.
+             * @param[in] dt Current time step.
+             */
+            void updateKernelConstants(pylith::real_array* kernelConstants,
+                                       const PylithReal dt) const;
+
+            /** Cache values of spatially uniform elastic moduli for constant-coefficient kernels.
+             *
+             * @param[in] auxiliaryField Auxiliary field with populated values.
+             */
+            void detectConstantCoefficients(const pylith::topology::Field& auxiliaryField);
+
         };
 
         // class IsotropicLinearElasticity
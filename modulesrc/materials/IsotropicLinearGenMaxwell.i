@@ -118,6 +118,12 @@ public:
             void updateKernelConstants(pylith::real_array* kernelConstants,
                                        const PylithReal dt) const;
 
+            /** Cache spatially uniform relaxation times for precomputed decay factor constants.
+             *
+             * @param[in] auxiliaryField Auxiliary field with populated values.
+             */
+            void detectConstantCoefficients(const pylith::topology::Field& auxiliaryField);
+
         };
 
         // class IsotropicLinearGenMaxwell
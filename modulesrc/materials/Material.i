@@ -58,6 +58,24 @@ public:
              */
             void setGravityField(spatialdata::spatialdb::GravityField* const g);
 
+            /** Set threshold for incremental update of state variables.
+             *
+             * @param[in] value Relative change in state variables below which cells are skipped.
+             */
+            void setStateVarsUpdateThreshold(const double value);
+
+            /** Set number of time steps between full updates of state variables.
+             *
+             * @param[in] value Number of time steps between full updates (0 means never).
+             */
+            void setStateVarsRefreshInterval(const int value);
+
+            /** Set resolution for spatial database queries when populating the auxiliary field.
+             *
+             * @param[in] value Grid spacing (dimensioned length) for coarse queries.
+             */
+            void setDBQueryResolution(const double value);
+
             /** Create constraint and set kernels.
              *
              * @param[in] solution Solution field.
@@ -76,6 +94,41 @@ public:
             pylith::utils::PetscOptions* getSolverDefaults(const bool isParallel,
                                                            const bool hasFault) const;
 
+            /** Get number of local values exchanged for an auxiliary subfield.
+             *
+             * @param[in] subfieldName Name of auxiliary subfield to exchange.
+             * @returns Number of subfield degrees of freedom on this process.
+             */
+            size_t getStateExchangeSize(const char* subfieldName) const;
+
+            /** Export an auxiliary subfield to a flat array for in-memory coupling with an external code.
+             *
+             * @param[out] values Array of subfield values [numValues].
+             * @param[in] numValues Size of array; must match getStateExchangeSize().
+             * @param[in] subfieldName Name of auxiliary subfield to export.
+             */
+            %apply(PylithScalar* INPLACE_ARRAY1, int DIM1) {
+                (PylithScalar* values, const int numValues)
+            };
+            void exportState(PylithScalar* values,
+                             const int numValues,
+                             const char* subfieldName) const;
+            %clear(PylithScalar* values, const int numValues);
+
+            /** Import an auxiliary subfield from a flat array for in-memory coupling with an external code.
+             *
+             * @param[in] values Array of subfield values [numValues].
+             * @param[in] numValues Size of array; must match getStateExchangeSize().
+             * @param[in] subfieldName Name of auxiliary subfield to import.
+             */
+            %apply(double* IN_ARRAY1, int DIM1) {
+                (const PylithScalar* values, const int numValues)
+            };
+            void importState(const PylithScalar* values,
+                             const int numValues,
+                             const char* subfieldName);
+            %clear(const PylithScalar* values, const int numValues);
+
         }; // class Material
 
     } // materials
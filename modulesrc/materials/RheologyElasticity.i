@@ -110,6 +110,13 @@ public:
             void updateKernelConstants(pylith::real_array* kernelConstants,
                                        const PylithReal dt) const;
 
+            /** Cache values of spatially uniform coefficients for constant-coefficient kernels.
+             *
+             * @param[in] auxiliaryField Auxiliary field with populated values.
+             */
+            virtual
+            void detectConstantCoefficients(const pylith::topology::Field& auxiliaryField);
+
         };
 
         // class RheologyElasticity
@@ -49,6 +49,18 @@ public:
              */
             void filename(const char* filename);
 
+            /** Set flag for writing fields on a background thread.
+             *
+             * @param flag True if writing fields on a background thread.
+             */
+            void setAsyncWrite(const bool flag);
+
+            /** Set flag for appending to an existing output file after a restart.
+             *
+             * @param flag True if appending to an existing output file.
+             */
+            void setAppend(const bool flag);
+
             /** Generate filename for HDF5 file.
              *
              * Appends _info if only writing parameters.
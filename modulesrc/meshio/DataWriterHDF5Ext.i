@@ -49,6 +49,37 @@ public:
              */
             void filename(const char* filename);
 
+            /** Set number of time steps to buffer in memory before writing to the data files.
+             *
+             * @param[in] value Number of time steps to buffer (>= 1).
+             */
+            void setBufferSize(const int value);
+
+            /** Set compression filter applied to chunked datasets.
+             *
+             * @param[in] name Name of filter ("none" or "deflate").
+             */
+            void setCompressionFilter(const char* name);
+
+            /** Set compression level for the deflate filter.
+             *
+             * @param[in] value Compression level (0-9).
+             */
+            void setCompressionLevel(const int value);
+
+            /** Set number of decimal digits preserved by the lossy scale-offset
+             * filter for floating-point datasets.
+             *
+             * @param[in] value Number of decimal digits; negative value disables the filter.
+             */
+            void setScaleOffsetDecimals(const int value);
+
+            /** Set whether datasets are laid out as rank-contiguous blocks.
+             *
+             * @param[in] value True if datasets are laid out as rank-contiguous blocks.
+             */
+            void setRankBlockLayout(const bool value);
+
             /** Generate filename for HDF5 file.
              *
              * Appends _info if only writing parameters.
@@ -0,0 +1,70 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/DataWriterMemory.i
+ *
+ * @brief Python interface to C++ DataWriterMemory object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::DataWriterMemory : public DataWriter {
+            // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            DataWriterMemory(void);
+
+            /// Destructor
+            ~DataWriterMemory(void);
+
+            /** Make copy of this object.
+             *
+             * @returns Copy of this.
+             */
+            DataWriter* clone(void) const;
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /// Discard buffered records.
+            void clearRecords(void);
+
+            /** Write field over vertices.
+             *
+             * @param t Time associated with field.
+             * @param subfield Subfield with basis order 1.
+             */
+            void writeVertexField(const PylithScalar t,
+                                  const pylith::meshio::OutputSubfield& subfield);
+
+            /** Write field over cells.
+             *
+             * @param t Time associated with field.
+             * @param subfield Subfield with basis order 0.
+             */
+            void writeCellField(const PylithScalar t,
+                                const pylith::meshio::OutputSubfield& subfield);
+
+        }; // DataWriterMemory
+
+    } // meshio
+} // pylith
+
+// End of file
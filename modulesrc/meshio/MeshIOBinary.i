@@ -0,0 +1,67 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/MeshIOBinary.i
+ *
+ * @brief Python interface to C++ MeshIOBinary object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class MeshIOBinary: public MeshIO
+        { // MeshIOBinary
+          // PUBLIC METHODS /////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            MeshIOBinary(void);
+
+            /// Destructor
+            ~MeshIOBinary(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set filename for binary file.
+             *
+             * @param filename Name of file
+             */
+            void setFilename(const char* name);
+
+            /** Get filename of binary file.
+             *
+             * @returns Name of file
+             */
+            const char* getFilename(void) const;
+
+            // PROTECTED METHODS ////////////////////////////////////////////////////
+protected:
+
+            /// Write mesh
+            void _write(void) const;
+
+            /// Read mesh
+            void _read(void);
+
+        }; // MeshIOBinary
+
+    } // meshio
+} // pylith
+
+// End of file
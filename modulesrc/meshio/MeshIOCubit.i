@@ -56,6 +56,12 @@ public:
              */
             void setUseNodesetNames(const bool flag);
 
+            /** Set flag on whether to read slabs of the mesh in parallel.
+             *
+             * @param flag True to read mesh in parallel.
+             */
+            void setUseParallelRead(const bool flag);
+
             // PROTECTED METHODS ////////////////////////////////////////////////////
 protected:
 
@@ -67,7 +67,22 @@ namespace pylith {
        * @param mesh PyLith finite-element mesh.
        */
       void write(pylith::topology::Mesh* const mesh);
-      
+
+      /** Set names of groups (nodesets) to read from the mesh file.
+       *
+       * @param[in] names Array of group names.
+       * @param[in] numNames Length of array.
+       */
+      %apply(const char* const* string_list, const int list_len) {
+	(const char* names[],
+	 const int numNames)
+      };
+      void setGroupFilter(const char* names[],
+			  const int numNames);
+
+      %clear(const char* names[], const int numNames);
+
+
       // PROTECTED MEMBERS //////////////////////////////////////////////
     protected :
 
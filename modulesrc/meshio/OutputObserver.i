@@ -62,6 +62,22 @@ public:
              */
             void setOutputBasisOrder(const int value);
 
+            /** Set time windows in which the observer is active.
+             *
+             * @param[in] windows Array of start/end times of windows (seconds) [numWindows, 2].
+             * @param[in] numWindows Number of time windows.
+             * @param[in] numColumns Number of values per window (must be 2).
+             */
+            %apply(double* IN_ARRAY2, int DIM1, int DIM2) {
+                (const PylithReal* windows,
+                 const int numWindows,
+                 const int numColumns)
+            };
+            void setActiveTimeWindows(const PylithReal* windows,
+                                      const int numWindows,
+                                      const int numColumns);
+            %clear(const PylithReal* windows, const int numWindows, const int numColumns);
+
             /** Set time scale.
              *
              * @param[in] value Time scale for dimensionalizing time.
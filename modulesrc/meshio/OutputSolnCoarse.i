@@ -0,0 +1,67 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputSolnCoarse.i
+ *
+ * @brief Python interface to C++ OutputSolnCoarse object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class OutputSolnCoarse : public pylith::meshio::OutputSoln {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            OutputSolnCoarse(void);
+
+            /// Destructor
+            virtual ~OutputSolnCoarse(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set coarse mesh for decimated output.
+             *
+             * The mesh must cover the domain of the solution. Caller retains
+             * ownership of the mesh.
+             *
+             * @param[in] mesh Coarse finite-element mesh.
+             */
+            void setCoarseMesh(pylith::topology::Mesh* const mesh);
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Write solution at time step.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             */
+            void _writeSolnStep(const PylithReal t,
+                                const PylithInt tindex,
+                                const pylith::topology::Field& solution);
+
+        }; // OutputSolnCoarse
+
+    } // meshio
+} // pylith
+
+// End of file
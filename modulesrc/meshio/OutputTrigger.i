@@ -50,6 +50,16 @@ public:
             bool shouldWrite(const PylithReal t,
                              const PylithInt tindex) = 0;
 
+            /** Check whether output would be written at time t without updating the trigger state.
+             *
+             * @param[in] t Time of proposed write.
+             * @param[in] tindex Inxex of current time step.
+             * @returns True if output would be written at time t, false otherwise.
+             */
+            virtual
+            bool willWrite(const PylithReal t,
+                           const PylithInt tindex) const = 0;
+
         }; // OutputTrigger
 
     } // meshio
@@ -0,0 +1,99 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputTriggerChange.i
+ *
+ * @brief Python interface to C++ OutputTriggerChange object.
+ */
+
+namespace pylith {
+    namespace meshio {
+
+        class pylith::meshio::OutputTriggerChange : public pylith::meshio::OutputTrigger {
+
+	  // PUBLIC METHODS ///////////////////////////////////////////////////////
+	public:
+
+	  /// Constructor
+	  OutputTriggerChange(void);
+
+	  /// Destructor
+	  ~OutputTriggerChange(void);
+
+	  /** Check whether we want to write output at time t.
+	   *
+	   * @param[in] t Time of proposed write.
+	   * @param[in] tindex Inxex of current time step.
+	   * @returns True if output should be written at time t, false otherwise.
+	   */
+	  bool shouldWrite(const PylithReal t,
+			   const PylithInt tindex);
+
+	  /** Check whether output would be written at time t without updating the trigger state.
+	   *
+	   * @param[in] t Time of proposed write.
+	   * @param[in] tindex Inxex of current time step.
+	   * @returns True if output would be written at time t, false otherwise.
+	   */
+	  bool willWrite(const PylithReal t,
+			 const PylithInt tindex) const;
+
+	  /** Set threshold for relative change in solution triggering a write.
+	   *
+	   * @param[in] value Threshold for relative change.
+	   */
+	  void setThreshold(const double value);
+
+	  /** Get threshold for relative change in solution triggering a write.
+	   *
+	   * @returns Threshold for relative change.
+	   */
+	  double getThreshold(void) const;
+
+	  /** Set maximum number of steps to skip between writes.
+	   *
+	   * @param[in] value Maximum number of steps to skip between writes.
+	   */
+	  void setMaxNumStepsSkip(const int value);
+
+	  /** Get maximum number of steps to skip between writes.
+	   *
+	   * @returns Maximum number of steps to skip between writes.
+	   */
+	  int getMaxNumStepsSkip(void) const;
+
+	  /** Set name of solution subfield used for change metric.
+	   *
+	   * @param[in] name Name of subfield (empty string means entire solution).
+	   */
+	  void setSubfieldName(const char* name);
+
+	  /** Get name of solution subfield used for change metric.
+	   *
+	   * @returns Name of subfield.
+	   */
+	  const char* getSubfieldName(void) const;
+
+	}; // OutputTriggerChange
+
+    } // meshio
+} // pylith
+
+
+// End of file
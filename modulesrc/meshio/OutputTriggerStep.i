@@ -45,6 +45,15 @@ namespace pylith {
 	  bool shouldWrite(const PylithReal t,
 			   const PylithInt tindex);
 
+	  /** Check whether output would be written at time t without updating the trigger state.
+	   *
+	   * @param[in] t Time of proposed write.
+	   * @param[in] tindex Inxex of current time step.
+	   * @returns True if output would be written at time t, false otherwise.
+	   */
+	  bool willWrite(const PylithReal t,
+			 const PylithInt tindex) const;
+
 	  /** Set number of steps to skip between writes.
 	   *
 	   * @param[in] Number of steps to skip between writes.
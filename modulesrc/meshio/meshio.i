@@ -23,6 +23,7 @@
 %{
 #include "pylith/meshio/MeshIO.hh"
 #include "pylith/meshio/MeshIOAscii.hh"
+#include "pylith/meshio/MeshIOBinary.hh"
 #include "pylith/meshio/MeshIOLagrit.hh"
 #include "pylith/meshio/MeshIOPetsc.hh"
 #if defined(ENABLE_CUBIT)
@@ -30,10 +31,12 @@
 #endif
 
 #include "pylith/meshio/OutputTrigger.hh"
+#include "pylith/meshio/OutputTriggerChange.hh"
 #include "pylith/meshio/OutputTriggerStep.hh"
 #include "pylith/meshio/OutputTriggerTime.hh"
 #include "pylith/meshio/DataWriter.hh"
 #include "pylith/meshio/DataWriterVTK.hh"
+#include "pylith/meshio/DataWriterMemory.hh"
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
@@ -42,7 +45,9 @@
 #include "pylith/meshio/OutputSoln.hh"
 #include "pylith/meshio/OutputSolnDomain.hh"
 #include "pylith/meshio/OutputSolnBoundary.hh"
+#include "pylith/meshio/OutputSolnCoarse.hh"
 #include "pylith/meshio/OutputSolnPoints.hh"
+#include "pylith/meshio/OutputSolnSubdomain.hh"
 #include "pylith/meshio/OutputPhysics.hh"
 
 #include "pylith/utils/arrayfwd.hh"
@@ -77,6 +82,7 @@ import_array();
 %include "../problems/ObserverPhysics.i"
 %include "MeshIOObj.i"
 %include "MeshIOAscii.i"
+%include "MeshIOBinary.i"
 %include "MeshIOLagrit.i"
 %include "MeshIOPetsc.i"
 #if defined(ENABLE_CUBIT)
@@ -84,10 +90,12 @@ import_array();
 #endif
 
 %include "OutputTrigger.i"
+%include "OutputTriggerChange.i"
 %include "OutputTriggerStep.i"
 %include "OutputTriggerTime.i"
 %include "DataWriter.i"
 %include "DataWriterVTK.i"
+%include "DataWriterMemory.i"
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
@@ -96,7 +104,9 @@ import_array();
 %include "OutputSoln.i"
 %include "OutputSolnDomain.i"
 %include "OutputSolnBoundary.i"
+%include "OutputSolnCoarse.i"
 %include "OutputSolnPoints.i"
+%include "OutputSolnSubdomain.i"
 %include "OutputPhysics.i"
 
 
@@ -22,9 +22,16 @@
 // Header files for module C++ code
 %{
 #include <petsc.h>
+
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
 %}
 
 %include "typemaps.i"
+%include "std_string.i"
 
 // Interfaces
 %include "mpi_comm.i"
@@ -26,5 +26,75 @@
 %}
 
 
+// ----------------------------------------------------------------------
+// gather_errors
+%inline %{
+  /** Gather per-process error messages onto the root process and summarize.
+   *
+   * Collective on the communicator. Processes without an error pass an empty
+   * string. The summary deduplicates the messages and reports the number of
+   * processes affected by each one; it is returned on the root process and is
+   * an empty string on the other processes.
+   *
+   * @param msg Error message on this process (empty string if no error).
+   * @param comm MPI communicator.
+   * @returns Summary of errors across processes (root process only).
+   */
+  std::string
+    gather_errors(const char* msg,
+		  MPI_Comm* comm) {
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(*comm, &rank);
+    MPI_Comm_size(*comm, &size);
+
+    const int msgLen = int(strlen(msg));
+    std::vector<int> lengths(0 == rank ? size : 1, 0);
+    MPI_Gather((void*)&msgLen, 1, MPI_INT, &lengths[0], 1, MPI_INT, 0, *comm);
+
+    std::vector<int> offsets(0 == rank ? size : 1, 0);
+    int totalLen = 0;
+    if (0 == rank) {
+      for (int i = 0; i < size; ++i) {
+	offsets[i] = totalLen;
+	totalLen += lengths[i];
+      } // for
+    } // if
+    std::vector<char> buffer(totalLen + 1, '\0');
+    MPI_Gatherv((void*)msg, msgLen, MPI_CHAR, &buffer[0], &lengths[0], &offsets[0], MPI_CHAR, 0, *comm);
+
+    std::string summary;
+    if (0 == rank) {
+      // Deduplicate messages, keeping the number of processes reporting each
+      // one and the lowest reporting rank.
+      typedef std::map<std::string, std::pair<int, int> > counts_type;
+      counts_type counts;
+      int numFailed = 0;
+      for (int i = 0; i < size; ++i) {
+	if (lengths[i] <= 0) { continue; }
+	++numFailed;
+	const std::string message(&buffer[offsets[i]], lengths[i]);
+	counts_type::iterator iter = counts.find(message);
+	if (counts.end() == iter) {
+	  counts[message] = std::make_pair(1, i);
+	} else {
+	  ++iter->second.first;
+	} // if/else
+      } // for
+
+      std::ostringstream s;
+      s << numFailed << " of " << size << " processes reported errors, "
+	<< counts.size() << " unique:\n";
+      for (counts_type::const_iterator iter = counts.begin(); iter != counts.end(); ++iter) {
+	s << "  [" << iter->second.first << " process(es), first on rank "
+	  << iter->second.second << "] " << iter->first << "\n";
+      } // for
+      summary = s.str();
+    } // if
+    return summary;
+  } // gather_errors
+%}
+
+
 // End of file
 
@@ -62,6 +62,54 @@ public:
              */
             int getFaultLabelValue(void) const;
 
+            /** Set number of impulses solved together as multiple right-hand sides.
+             *
+             * @param[in] value Number of impulses per batch (>= 1).
+             */
+            void setImpulseBatchSize(const size_t value);
+
+            /** Get number of impulses solved together as multiple right-hand sides.
+             *
+             * @returns Number of impulses per batch.
+             */
+            size_t getImpulseBatchSize(void) const;
+
+            /** Set station locations for computing the fault-to-station operator by reciprocity.
+             *
+             * @param[in] stationCoords Array of station coordinates [numStations * spaceDim].
+             * @param[in] numStations Number of stations.
+             * @param[in] spaceDim Spatial dimension for station coordinates.
+             * @param[in] stationNames Array with station names.
+             * @param[in] numStationNames Number of station names.
+             */
+            %apply(double* IN_ARRAY2, int DIM1, int DIM2) {
+	            (const PylithReal* stationCoords,
+	            const int numStations,
+	            const int spaceDim)
+	        };
+            %apply(const char* const* string_list, const int list_len){
+	            (const char* const* stationNames, const int numStationNames)
+	        };
+            void setStations(const PylithReal* stationCoords,
+                             const int numStations,
+                             const int spaceDim,
+                             const char* const* stationNames,
+                             const int numStationNames);
+            %clear(const PylithReal* stationCoords, const int numStations, const int spaceDim);
+            %clear(const char* const* stationNames, const int numStationNames);
+
+            /** Set filename for fault-to-station operator computed by reciprocity.
+             *
+             * @param[in] filename Name of HDF5 file for operator.
+             */
+            void setReciprocityFilename(const char* filename);
+
+            /** Set filename for fault-to-station operator assembled from forward responses.
+             *
+             * @param[in] filename Name of HDF5 file for operator.
+             */
+            void setOperatorFilename(const char* filename);
+
             /** Set progress monitor.
              *
              * @param[in] monitor Progress monitor for Green's functions simulation.
@@ -0,0 +1,71 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/problems/InitialConditionCheckpoint.i
+ *
+ * @brief Python interface to C++ InitialConditionCheckpoint.
+ */
+
+namespace pylith {
+    namespace problems {
+        class InitialConditionCheckpoint : public pylith::problems::InitialCondition {
+            // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            InitialConditionCheckpoint(void);
+
+            /// Destructor
+            virtual ~InitialConditionCheckpoint(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set filename of HDF5 checkpoint file with solution.
+             *
+             * @param[in] filename Name of HDF5 checkpoint file.
+             */
+            void setCheckpointFilename(const char* filename);
+
+            /** Set mesh of checkpointed simulation.
+             *
+             * @param[in] mesh Mesh of checkpointed simulation.
+             */
+            void setMesh(pylith::topology::Mesh* mesh);
+
+            /** Verify configuration is acceptable.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Set solution to values for initial condition.
+             *
+             * @param[out] solution Solution field.
+             * @param[in] normalizer Nondimensionalization.
+             */
+            void setValues(pylith::topology::Field* solution,
+                           const spatialdata::units::Nondimensional& normalizer);
+
+        }; // InitialConditionCheckpoint
+
+    } // problems
+} // pylith
+
+// End of file
@@ -71,6 +71,18 @@ public:
              */
             int getLabelValue(void) const;
 
+            /** Set number of global time steps between updates of the residual contribution.
+             *
+             * @param[in] value Number of time steps between updates (1 means every step).
+             */
+            void setStepCadence(const size_t value);
+
+            /** Get number of global time steps between updates of the residual contribution.
+             *
+             * @returns Number of time steps between updates.
+             */
+            size_t getStepCadence(void) const;
+
             /** Set manager of scales used to nondimensionalize problem.
              *
              * @param dim Nondimensionalizer.
@@ -75,6 +75,30 @@ public:
              */
             void setPetscDefaults(const int flags);
 
+            /** Set whether to prefetch auxiliary field spatial databases.
+             *
+             * @param[in] value True if databases should be prefetched on background threads.
+             */
+            void setPrefetchDatabases(const bool value);
+
+            /** Get whether to prefetch auxiliary field spatial databases.
+             *
+             * @returns True if databases are prefetched on background threads.
+             */
+            bool getPrefetchDatabases(void) const;
+
+            /** Set whether parallel reductions use a fixed combination order.
+             *
+             * @param[in] value True if reductions should use a fixed combination order.
+             */
+            void setDeterministicReductions(const bool value);
+
+            /** Set whether to autotune kernel variants at initialization.
+             *
+             * @param[in] value True if kernel variants should be autotuned.
+             */
+            void setAutotuneKernels(const bool value);
+
             /** Set manager of scales used to nondimensionalize problem.
              *
              * @param[in] dim Nondimensionalizer.
@@ -146,6 +170,13 @@ public:
             virtual
             void initialize(void);
 
+            /// Re-query kinematic rupture parameters from the spatial databases.
+            void reinitializeRuptureParameters(void);
+
+            /// Print forecast of per-step cost, memory use, and output volume for a dry run.
+            virtual
+            void printForecast(void);
+
         }; // Problem
 
     } // problems
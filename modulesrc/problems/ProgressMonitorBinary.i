@@ -0,0 +1,68 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/problems/ProgressMonitorBinary.i
+ *
+ * Python interface to C++ ProgressMonitorBinary.
+ */
+
+namespace pylith {
+    namespace problems {
+        class ProgressMonitorBinary: public pylith::problems::ProgressMonitorTime {
+            // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            ProgressMonitorBinary(void);
+
+            /// Destructor
+            virtual ~ProgressMonitorBinary(void);
+
+            /** Update progress with per-step solver details.
+             *
+             * @param[in] current Current time.
+             * @param[in] start Starting time.
+             * @param[in] stop Ending time.
+             * @param[in] tindex Current time step.
+             * @param[in] dt Current time step size.
+             * @param[in] linearIterations Cumulative number of linear solver iterations.
+             * @param[in] nonlinearIterations Cumulative number of nonlinear solver iterations.
+             */
+            void updateStep(const double current,
+                            const double start,
+                            const double stop,
+                            const size_t tindex,
+                            const double dt,
+                            const long linearIterations,
+                            const long nonlinearIterations);
+
+            // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////
+protected:
+
+            /// Open progress monitor.
+            void _open(void);
+
+            /// Close progress monitor.
+            void _close(void);
+
+        }; // class ProgressMonitorBinary
+
+    } // problems
+} // pylith
+
+// End of file
@@ -45,6 +45,18 @@ public:
              */
             const char* getTimeUnit(void) const;
 
+            /** Set whether to write a per-step time budget.
+             *
+             * @param[in] value True if per-step budget lines should be written.
+             */
+            void setShowBudget(const bool value);
+
+            /** Get whether to write a per-step time budget.
+             *
+             * @returns True if per-step budget lines are written.
+             */
+            bool getShowBudget(void) const;
+
             /** Update progress.
              *
              * @param[in] current Current time.
@@ -55,6 +67,25 @@ public:
                         const double start,
                         const double stop);
 
+            /** Update progress with per-step solver details.
+             *
+             * @param[in] current Current time.
+             * @param[in] start Starting time.
+             * @param[in] stop Ending time.
+             * @param[in] tindex Current time step.
+             * @param[in] dt Current time step size.
+             * @param[in] linearIterations Cumulative number of linear solver iterations.
+             * @param[in] nonlinearIterations Cumulative number of nonlinear solver iterations.
+             */
+            virtual
+            void updateStep(const double current,
+                            const double start,
+                            const double stop,
+                            const size_t tindex,
+                            const double dt,
+                            const long linearIterations,
+                            const long nonlinearIterations);
+
             // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////
 protected:
 
@@ -0,0 +1,84 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file modulesrc/problems/SteadyState.i
+ *
+ * Python interface to C++ SteadyState.
+ */
+
+namespace pylith {
+    namespace problems {
+        class SteadyState: public pylith::problems::Problem {
+            // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            SteadyState(void);
+
+            /// Destructor
+            ~SteadyState(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set initial pseudo-time step.
+             *
+             * @param[in] value Initial pseudo-time step (seconds).
+             */
+            void setInitialTimeStep(const double value);
+
+            /** Get initial pseudo-time step.
+             *
+             * @returns Initial pseudo-time step (seconds).
+             */
+            double getInitialTimeStep(void) const;
+
+            /** Set maximum number of pseudo-time steps.
+             *
+             * @param[in] value Maximum number of pseudo-time steps.
+             */
+            void setMaxPseudoTimeSteps(const size_t value);
+
+            /** Get maximum number of pseudo-time steps.
+             *
+             * @returns Maximum number of pseudo-time steps.
+             */
+            size_t getMaxPseudoTimeSteps(void) const;
+
+            /** Set factor by which the pseudo-time step grows as the residual decreases.
+             *
+             * @param[in] value Pseudo-time step increment factor (> 1).
+             */
+            void setTimeStepIncrement(const double value);
+
+            /// Verify configuration.
+            void verifyConfiguration(void) const;
+
+            /// Initialize.
+            void initialize(void);
+
+            /** Solve steady-state problem.
+             */
+            void solve(void);
+
+        }; // SteadyState
+
+    } // problems
+} // pylith
+
+// End of file
@@ -107,13 +107,243 @@ public:
              */
             void setProgressMonitor(pylith::problems::ProgressMonitorTime* monitor);
 
+            /** Set filename for HDF5 solver convergence telemetry.
+             *
+             * @param[in] filename Name of HDF5 telemetry file (empty string disables telemetry).
+             */
+            void setSolverTelemetryFilename(const char* filename);
+
+            /** Set filename for JSON performance profile.
+             *
+             * @param[in] filename Name of JSON profile file (empty string disables profiling).
+             */
+            void setProfileFilename(const char* filename);
+
+            /** Set filename for checkpoints.
+             *
+             * @param[in] filename Name of HDF5 checkpoint file.
+             */
+            void setCheckpointFilename(const char* filename);
+
+            /** Set number of time steps between checkpoints.
+             *
+             * @param[in] value Number of time steps between checkpoints (0 disables checkpointing).
+             */
+            void setCheckpointInterval(const int value);
+
+            /** Set filename of checkpoint to restart from.
+             *
+             * @param[in] filename Name of HDF5 checkpoint file (empty string means no restart).
+             */
+            void setRestartFilename(const char* filename);
+
+            /** Enable adaptive time stepping.
+             *
+             * @param[in] value True if time step should be adapted.
+             */
+            void setAdaptiveTimeStep(const bool value);
+
+            /** Set minimum time step for adaptive time stepping.
+             *
+             * @param[in] value Minimum time step (seconds, 0 means no minimum).
+             */
+            void setMinTimeStep(const double value);
+
+            /** Set maximum time step for adaptive time stepping.
+             *
+             * @param[in] value Maximum time step (seconds, 0 means no maximum).
+             */
+            void setMaxTimeStep(const double value);
+
+            /** Set target relative change in the solution per time step for adaptive time stepping.
+             *
+             * @param[in] value Target relative change in solution per time step.
+             */
+            void setAdaptTolerance(const double value);
+
+            /** Set maximum factor by which the time step can grow in one step.
+             *
+             * @param[in] value Maximum growth factor (> 1).
+             */
+            void setAdaptGrowthFactor(const double value);
+
+            /** Enable relaxation fast-forward for adaptive time stepping.
+             *
+             * @param[in] value True if step growth during relaxation is not limited per step.
+             */
+            void setRelaxationFastForward(const bool value);
+
+            /** Set lag in rebuilding the LHS Jacobian for nonlinear problems.
+             *
+             * @param[in] value Number of rebuild requests per rebuild (>= 1).
+             */
+            void setLHSJacobianLag(const int value);
+
+            /** Set allowed growth in linear iterations before rebuilding a frozen preconditioner.
+             *
+             * @param[in] value Allowed growth factor in linear iterations (> 1), or 0 to disable.
+             */
+            void setPrecondFreezeFactor(const double value);
+
+            /** Set order of extrapolation from solution history for nonlinear solver initial guess.
+             *
+             * @param[in] value Order of extrapolation (0-2, 0 means use previous solution).
+             */
+            void setInitialGuessOrder(const int value);
+
+            /** Set matrix-free application of the LHS Jacobian.
+             *
+             * @param[in] value True if Jacobian should be applied matrix free.
+             */
+            void setMatrixFreeJacobian(const bool value);
+
+            /** Get matrix-free application of the LHS Jacobian.
+             *
+             * @returns True if Jacobian is applied matrix free.
+             */
+            bool getMatrixFreeJacobian(void) const;
+
+            /** Set use of fused explicit time-stepping fast path.
+             *
+             * @param[in] value True if explicit stepping should use the fused fast path.
+             */
+            void setExplicitFastPath(const bool value);
+
+            /** Get use of fused explicit time-stepping fast path.
+             *
+             * @returns True if explicit stepping uses the fused fast path.
+             */
+            bool getExplicitFastPath(void) const;
+
+            /** Set materials advanced with a smaller time step in the explicit fast path.
+             *
+             * @param[in] values Array of label values for materials to subcycle.
+             * @param[in] numValues Number of label values.
+             */
+            %apply(int* INPLACE_ARRAY1, int DIM1) {
+                (const int* values,
+                 const int numValues)
+            };
+            void setSubcycleLabelValues(const int* values,
+                                        const int numValues);
+            %clear(const int* values, const int numValues);
+
+            /** Set factor by which the time step is reduced for subcycled materials.
+             *
+             * @param[in] value Number of substeps per global time step (>= 1; 1 disables subcycling).
+             */
+            void setSubcycleFactor(const size_t value);
+
+            /** Set use of compact storage for the preconditioning matrix.
+             *
+             * @param[in] value True if preconditioning matrix should use compact symmetric storage.
+             */
+            void setCompactPrecondStorage(const bool value);
+
+            /** Get use of compact storage for the preconditioning matrix.
+             *
+             * @returns True if preconditioning matrix uses compact symmetric storage.
+             */
+            bool getCompactPrecondStorage(void) const;
+
+            /** Set automatic recovery from solver failures.
+             *
+             * @param[in] value True if solver failures should trigger rollback and retry.
+             */
+            void setSolverRecovery(const bool value);
+
+            /** Get automatic recovery from solver failures.
+             *
+             * @returns True if solver failures trigger rollback and retry.
+             */
+            bool getSolverRecovery(void) const;
+
             /// Initialize.
             void initialize(void);
 
+            /// Print forecast of per-step cost, memory use, and output volume for a dry run.
+            void printForecast(void);
+
             /** Solve time dependent problem.
              */
             void solve(void);
 
+            /** Snapshot initial solution and auxiliary fields for a parameter sweep.
+             *
+             * Must be called after initialize() and before the first call to runSweepMember().
+             */
+            void prepareSweep(void);
+
+            /** Run one parameter sweep member in-process.
+             *
+             * Restores the solution and auxiliary fields from the snapshot taken by
+             * prepareSweep(), scales the named auxiliary subfield of every integrator and
+             * constraint that has it by the given factor, rewinds the time stepper to the
+             * start time, and reruns the solve loop.
+             *
+             * @param[in] subfieldName Name of auxiliary subfield to scale.
+             * @param[in] factor Factor applied to the initial subfield values for this member.
+             */
+            void runSweepMember(const char* subfieldName,
+                                const PylithReal factor);
+
+            /** Run a parameter sweep in-process.
+             *
+             * @param[in] subfieldName Name of auxiliary subfield to scale.
+             * @param[in] values Array of factors applied to the initial subfield values.
+             * @param[in] numValues Number of sweep members.
+             */
+            %apply(PylithScalar* IN_ARRAY1, int DIM1) {
+                (const PylithScalar* values, const int numValues)
+            };
+            void runSweep(const char* subfieldName,
+                          const PylithScalar* values,
+                          const int numValues);
+
+            %clear(const PylithScalar* values, const int numValues);
+
+            /** Run one segment of an earthquake cycle in-process.
+             *
+             * @param[in] tStart Start time of segment (seconds).
+             * @param[in] tEnd End time of segment (seconds).
+             */
+            void runSegment(const double tStart,
+                            const double tEnd);
+
+            /** Hand off solution and material state from another problem in memory.
+             *
+             * @param[in] other Problem for the previous segment of the cycle.
+             */
+            void transferStateFrom(pylith::problems::TimeDependent& other);
+
+            /** Estimate surface displacements at stations from an analytic half-space solution (3D only).
+             *
+             * @param[out] displacements Array of station displacements [numStations * spaceDim].
+             * @param[in] numValues Size of displacements array.
+             * @param[in] stationCoords Array of nondimensional station coordinates [numStations * spaceDim].
+             * @param[in] numStations Number of stations.
+             * @param[in] spaceDim Spatial dimension for coordinates and displacements.
+             * @param[in] t Nondimensional time at which to evaluate slip.
+             * @param[in] poissonRatio Poisson's ratio for the half space.
+             */
+            %apply(PylithScalar* INPLACE_ARRAY1, int DIM1) {
+                (PylithScalar* displacements, const int numValues)
+            };
+            %apply(double* IN_ARRAY2, int DIM1, int DIM2) {
+                (const PylithReal* stationCoords,
+                 const int numStations,
+                 const int spaceDim)
+            };
+            void estimateSurfaceDisplacements(PylithScalar* displacements,
+                                              const int numValues,
+                                              const PylithReal* stationCoords,
+                                              const int numStations,
+                                              const int spaceDim,
+                                              const PylithReal t,
+                                              const PylithReal poissonRatio);
+            %clear(PylithScalar* displacements, const int numValues);
+            %clear(const PylithReal* stationCoords, const int numStations, const int spaceDim);
+
             /** Perform Perform operations after advancing solution one time step.
              *
              * Update state variables, output.
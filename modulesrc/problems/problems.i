@@ -24,15 +24,18 @@
 #include "pylith/problems/Problem.hh"
 #include "pylith/problems/TimeDependent.hh"
 #include "pylith/problems/GreensFns.hh"
+#include "pylith/problems/SteadyState.hh"
 #include "pylith/problems/Physics.hh"
 #include "pylith/problems/ObserverSoln.hh"
 #include "pylith/problems/ObserverPhysics.hh"
 #include "pylith/problems/InitialCondition.hh"
+#include "pylith/problems/InitialConditionCheckpoint.hh"
 #include "pylith/problems/InitialConditionDomain.hh"
 #include "pylith/problems/InitialConditionPatch.hh"
 #include "pylith/problems/ProgressMonitor.hh"
 #include "pylith/problems/ProgressMonitorTime.hh"
 #include "pylith/problems/ProgressMonitorStep.hh"
+#include "pylith/problems/ProgressMonitorBinary.hh"
 %}
 
 %include "exception.i"
@@ -65,14 +68,17 @@
 %include "Problem.i"
 %include "TimeDependent.i"
 %include "GreensFns.i"
+%include "SteadyState.i"
 %include "Physics.i"
 %include "ObserverSoln.i"
 %include "ObserverPhysics.i"
 %include "InitialCondition.i"
+%include "InitialConditionCheckpoint.i"
 %include "InitialConditionDomain.i"
 %include "InitialConditionPatch.i"
 %include "ProgressMonitor.i"
 %include "ProgressMonitorTime.i"
 %include "ProgressMonitorStep.i"
+%include "ProgressMonitorBinary.i"
 
 // End of file
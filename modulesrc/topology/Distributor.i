@@ -22,6 +22,11 @@
  * @brief Python interface to C++ Distributor object.
  */
 
+%apply(int* IN_ARRAY1, int DIM1) {
+    (const int* materialValues, const int numMaterialValues),
+    (const int* materialWeights, const int numMaterialWeights)
+};
+
 namespace pylith {
     namespace topology {
         class Distributor
@@ -50,6 +55,23 @@ public:
                             const int numFaults,
                             const char* partitionerName);
 
+            /** Set per-cell weights used in partitioning the mesh.
+             *
+             * @param[inout] mesh Mesh to be distributed.
+             * @param[in] materialValues Array of values of label marking materials.
+             * @param[in] numMaterialValues Number of material label values.
+             * @param[in] materialWeights Array of weights (cost per cell) for each material.
+             * @param[in] numMaterialWeights Number of material weights.
+             * @param[in] cohesiveCellWeight Weight (cost per cell) for cohesive cells.
+             */
+            static
+            void setCellWeights(pylith::topology::Mesh* const mesh,
+                                const int* materialValues,
+                                const int numMaterialValues,
+                                const int* materialWeights,
+                                const int numMaterialWeights,
+                                const int cohesiveCellWeight);
+
             /** Write partitioning info for distributed mesh.
              *
              * @param writer Data writer for partition information.
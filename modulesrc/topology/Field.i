@@ -100,6 +100,32 @@ public:
              */
             PetscVec getLocalVector(void) const;
 
+            /** Get read-only view of values in local PETSc Vec.
+             *
+             * The view borrows the array of the local vector without copying the values. It
+             * remains valid until restoreLocalArrayView() is called; each call must be paired
+             * with a call to restoreLocalArrayView() before the field is modified.
+             *
+             * @returns Read-only NumPy array with values in local vector.
+             */
+            %apply(const PylithScalar** ARGOUTVIEW_ARRAY1, PylithInt* DIM1) {
+                (const PylithScalar** valuesView, PylithInt* size)
+            };
+            void getLocalArrayView(const PylithScalar** valuesView,
+                                   PylithInt* size);
+
+            %clear(const PylithScalar** valuesView, PylithInt* size);
+
+            /// Restore view of values in local PETSc Vec from getLocalArrayView().
+            void restoreLocalArrayView(void);
+
+            /** Compute rigid body modes (translations and rotations) for a subfield.
+             *
+             * @param[in] subfieldName Name of vector subfield.
+             * @returns PETSc null space with rigid body modes (caller responsible for destroying).
+             */
+            PetscMatNullSpace computeRigidBodyModes(const char* subfieldName) const;
+
             /** Get the global PETSc Vec.
              *
              * @returns PETSc Vec object.
@@ -144,6 +170,14 @@ public:
             /// Zero local values (including constrained values).
             void zeroLocal(void);
 
+            /** Scale values of a subfield in place.
+             *
+             * @param[in] name Name of subfield.
+             * @param[in] factor Factor to multiply subfield values by.
+             */
+            void scaleSubfield(const char* name,
+                               const PylithReal factor);
+
             /** Add subfield to current field (for use from SWIG).
              *
              * Should be followed by calls to subfieldsSetup() and allocate().
@@ -110,6 +110,15 @@ public:
              */
             void view(const char* viewOption="") const;
 
+            /** Get lower dimension mesh for boundary, creating it if necessary.
+             *
+             * @param[in] labelName Name of label marking boundary.
+             * @param[in] labelValue Value of label marking boundary.
+             * @returns Submesh for boundary.
+             */
+            Mesh* getSubmesh(const char* labelName,
+                             const int labelValue) const;
+
         }; // Mesh
 
     } // topology
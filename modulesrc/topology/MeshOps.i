@@ -33,6 +33,37 @@
 			    const spatialdata::units::Nondimensional& normalizer) {
     pylith::topology::MeshOps::nondimensionalize(mesh, normalizer);
   } // nondimensionalize
+
+  /** Compute and log mesh statistics for pre-run checks.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void
+  MeshOps_writeStatistics(const pylith::topology::Mesh& mesh) {
+    pylith::topology::MeshOps::writeStatistics(mesh);
+  } // writeStatistics
+
+  /** Save mesh topology (including cohesive cells and labels) to a cache file.
+   *
+   * @param mesh Finite-element mesh.
+   * @param filename Name of HDF5 cache file.
+   */
+  void
+  MeshOps_saveTopologyCache(const pylith::topology::Mesh& mesh,
+			    const char* filename) {
+    pylith::topology::MeshOps::saveTopologyCache(mesh, filename);
+  } // saveTopologyCache
+
+  /** Load mesh topology (including cohesive cells and labels) from a cache file.
+   *
+   * @param mesh Finite-element mesh (coordinate system must be set).
+   * @param filename Name of HDF5 cache file.
+   */
+  void
+  MeshOps_loadTopologyCache(pylith::topology::Mesh* mesh,
+			    const char* filename) {
+    pylith::topology::MeshOps::loadTopologyCache(mesh, filename);
+  } // loadTopologyCache
 %}
 
 // End of file
@@ -40,6 +40,13 @@ namespace pylith {
       static
       void reorder(topology::Mesh* mesh);
 
+      /** Reorder cells of mesh along a space-filling curve for cache locality.
+       *
+       * @param mesh PyLith finite-element mesh.
+       */
+      static
+      void reorderCellsLocality(topology::Mesh* mesh);
+
     }; // ReverseCuthillMcKee
 
   } // topology
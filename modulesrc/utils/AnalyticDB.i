@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/utils/AnalyticDB.i
+ *
+ * @brief Python interface to C++ AnalyticDB object.
+ */
+
+namespace pylith {
+    namespace utils {
+        class AnalyticDB : public spatialdata::spatialdb::SpatialDB {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Default constructor.
+            AnalyticDB(void);
+
+            /// Destructor.
+            ~AnalyticDB(void);
+
+            /** Set values, units, and expressions in database.
+             *
+             * Expressions are in terms of the coordinates x, y, and z (depending on the spatial
+             * dimension of the coordinate system) and are compiled when the database is opened.
+             *
+             * @param[in] names Array of names of values in database.
+             * @param[in] units Array of units for values in database ('none' for dimensionless values).
+             * @param[in] expressions Array of expressions for values in database.
+             * @param[in] numValues Number of values in database.
+             */
+            %apply(const char* const* string_list) {
+                (const char* const* names)
+            };
+            %apply(const char* const* string_list) {
+                (const char* const* units)
+            };
+            %apply(const char* const* string_list, const int list_len){
+                (const char* const* expressions, const int numValues)
+            };
+            void setData(const char* const* names,
+                         const char* const* units,
+                         const char* const* expressions,
+                         const int numValues);
+            %clear(const char* const* names);
+            %clear(const char* const* units);
+            %clear(const char* const* expressions, const int numValues);
+
+            /** Set coordinate system associated with expressions.
+             *
+             * @param[in] cs Coordinate system.
+             */
+            void setCoordSys(const spatialdata::geocoords::CoordSys& cs);
+
+            /// Open the database and prepare for querying; compiles the expressions.
+            void open(void);
+
+            /// Close the database.
+            void close(void);
+
+        }; // class AnalyticDB
+
+    } // utils
+} // pylith
+
+// End of file
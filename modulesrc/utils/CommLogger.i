@@ -0,0 +1,56 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/CommLogger.i
+ *
+ * @brief Python interface to C++ CommLogger.
+ */
+
+
+namespace pylith {
+  namespace utils {
+
+    class CommLogger
+    { // CommLogger
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /** Enable communication statistics and set output filename.
+       *
+       * @param filename Name of JSON file for statistics.
+       */
+      static void enable(const char* filename);
+
+      /** Check whether communication statistics are enabled.
+       *
+       * @returns True if communication statistics are enabled.
+       */
+      static bool isEnabled(void);
+
+      /// Discard accumulated statistics and disable communication statistics.
+      static void reset(void);
+
+    }; // CommLogger
+
+  } // utils
+} // pylith
+
+
+// End of file
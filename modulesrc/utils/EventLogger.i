@@ -102,10 +102,32 @@ namespace pylith {
        * @param id Stage identifier.
        */
       void stagePush(const int id);
-      
+
       /// Log stage end.
       void stagePop(void);
 
+      /** Get time accumulated by a logging event in the current logging stage.
+       *
+       * @param name Name of logging event.
+       * @returns Accumulated time in seconds on this process.
+       */
+      static double getAccumulatedTime(const char* name);
+
+      /** Enable folded-stack (flame-graph compatible) output.
+       *
+       * @param filenamePrefix Prefix for per-rank folded output files.
+       */
+      static void enableFoldedOutput(const char* filenamePrefix);
+
+      /** Check whether folded-stack output is enabled.
+       *
+       * @returns True if folded-stack output is enabled.
+       */
+      static bool isFoldedOutputEnabled(void);
+
+      /// Write folded stack samples for this rank.
+      static void writeFoldedStacks(void);
+
     }; // EventLogger
 
   } // utils
@@ -0,0 +1,56 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/utils/MMapGridDB.i
+ *
+ * @brief Python interface to C++ MMapGridDB object.
+ */
+
+namespace pylith {
+    namespace utils {
+        class MMapGridDB : public spatialdata::spatialdb::SpatialDB {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Default constructor.
+            MMapGridDB(void);
+
+            /// Destructor.
+            ~MMapGridDB(void);
+
+            /** Set filename of binary grid file.
+             *
+             * Use the `pylith_convert_griddb` utility to convert a SimpleGridDB ASCII file to the
+             * binary layout mapped by this database.
+             *
+             * @param[in] value Filename of binary grid file.
+             */
+            void setFilename(const char* value);
+
+            /// Open the database and prepare for querying; maps the grid file into memory.
+            void open(void);
+
+            /// Close the database; unmaps the grid file.
+            void close(void);
+
+        }; // class MMapGridDB
+
+    } // utils
+} // pylith
+
+// End of file
@@ -34,6 +34,16 @@ public:
             static const int PARALLEL;
             static const int INITIAL_GUESS;
             static const int TESTING;
+            static const int GPU;
+            static const int FAULT_SCHUR;
+            static const int MULTIGRID;
+
+            /** Set filename for dump of effective PETSc options with provenance.
+             *
+             * @param[in] filename Name of file for dump (empty string disables dump).
+             */
+            static
+            void setDumpFilename(const char* filename);
 
             // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////
 private:
@@ -22,12 +22,15 @@
 // Header files for module C++ code
 %{
 #include "pylith/utils/EventLogger.hh"
+#include "pylith/utils/CommLogger.hh"
 #include "pylith/utils/PyreComponent.hh"
 #include "pylith/utils/PetscOptions.hh"
 #include "pylith/utils/PylithVersion.hh"
 #include "pylith/utils/PetscVersion.hh"
 #include "pylith/utils/DependenciesVersion.hh"
 #include "pylith/utils/TestArray.hh"
+#include "pylith/utils/AnalyticDB.hh"
+#include "pylith/utils/MMapGridDB.hh"
 #include "pylith/utils/constdefs.h"
 
 #include <petsclog.h> // USES PetscLogEventBegin/End() in inline methods
@@ -45,6 +48,10 @@
 
 %include "typemaps.i"
 %include "../include/scalartypemaps.i"
+%include "../include/chararray.i"
+
+// Base class for AnalyticDB and MMapGridDB provided by the spatialdata SWIG module.
+%import "../include/spatialdbbase.i"
 
 // Numpy interface stuff
 %{
@@ -58,12 +65,15 @@ import_array();
 // Interfaces
 %include "pylith_general.i"
 %include "EventLogger.i"
+%include "CommLogger.i"
 %include "PyreComponent.i"
 %include "PetscOptions.i"
 %include "PylithVersion.i"
 %include "PetscVersion.i"
 %include "DependenciesVersion.i"
 %include "TestArray.i"
+%include "AnalyticDB.i"
+%include "MMapGridDB.i"
 %include "constdefs.i"
 
 // End of file
@@ -0,0 +1,174 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# Application for converting a SimpleGridDB file to the binary layout used by
+# the memory-mapped gridded spatial database (pylith.utils.MMapGridDB).
+
+import argparse
+
+import numpy
+
+MAGIC_V1 = b"PyLithMMapGridDB v1\n"
+MAGIC_V2 = b"PyLithMMapGridDB v2\n"
+MAGIC_SIZE = 24
+NAME_SIZE = 64
+UNITS_SIZE = 32
+
+VALUE_DTYPES = {
+    "float64": (0, numpy.float64),
+    "float32": (1, numpy.float32),
+}
+
+
+class ConvertGridDBApp():
+    """Application for converting a SimpleGridDB ASCII file to the binary grid
+    file mapped by the memory-mapped gridded spatial database.
+
+    The binary layout holds the grid coordinates and values as contiguous
+    native-endian doubles, so the database can map the file read-only and all
+    processes on a node share the page-cache-backed pages instead of each
+    holding a copy of the grid.
+    """
+
+    def main(self, **kwargs):
+        """Main entry point.
+
+        Keyword arguments:
+            filename_in (str)
+                Name of SimpleGridDB ASCII file to convert.
+            filename_out (str)
+                Name of binary grid file to write.
+            value_dtype (str)
+                Storage dtype of values, 'float64' or 'float32' (default 'float64'). Values
+                quantized to 'float32' halve the storage and the memory bandwidth of queries;
+                source databases rarely carry more than 3-4 significant digits.
+        """
+        args = argparse.Namespace(**kwargs) if kwargs else self._parse_command_line()
+        if not hasattr(args, "value_dtype"):
+            args.value_dtype = "float64"
+
+        grid = self._read_simplegriddb(args.filename_in)
+        self._write_binary(args.filename_out, grid, args.value_dtype)
+
+    def _read_simplegriddb(self, filename):
+        """Read SimpleGridDB ASCII file.
+        """
+        with open(filename, "r", encoding="utf-8") as fin:
+            header = fin.readline()
+            if not header.startswith("#SPATIAL_GRID.ascii"):
+                raise ValueError(f"File '{filename}' is not a SimpleGridDB ASCII file.")
+
+            settings = {}
+            depth = 0
+            for line in fin:
+                fields = line.split("//")[0].strip()
+                if not fields:
+                    continue
+                if "{" in fields:
+                    depth += 1
+                    fields = fields.split("{")[0]
+                    if "=" in fields and depth > 1:
+                        continue
+                if "}" in fields:
+                    depth -= 1
+                    if depth == 0:
+                        break
+                    continue
+                if "=" in fields and depth == 1:
+                    key, value = fields.split("=", 1)
+                    settings[key.strip()] = value.strip()
+
+            spaceDim = int(settings["space-dim"])
+            numValues = int(settings["num-values"])
+            names = settings["value-names"].split()
+            units = settings["value-units"].split()
+            numGrid = [int(settings.get("num-x", 0)), int(settings.get("num-y", 0)),
+                       int(settings.get("num-z", 0))][:spaceDim]
+            if len(names) != numValues or len(units) != numValues:
+                raise ValueError(
+                    f"Number of value names ({len(names)}) and units ({len(units)}) in '{filename}' "
+                    f"must match num-values ({numValues}).")
+
+            data = numpy.array(
+                [float(token) for line in fin for token in line.split("//")[0].split()])
+
+        gridCoords = []
+        offset = 0
+        for num in numGrid:
+            gridCoords.append(numpy.sort(data[offset:offset + num]))
+            offset += num
+
+        numLocs = int(numpy.prod(numGrid))
+        points = data[offset:].reshape((numLocs, spaceDim + numValues))
+        values = numpy.zeros((numLocs, numValues), dtype=numpy.float64)
+        # Locations may be in any order in the file; place values by grid indices.
+        shape = [1, 1, 1]
+        shape[:spaceDim] = numGrid
+        for point in points:
+            index = [0, 0, 0]
+            for dim in range(spaceDim):
+                index[dim] = int(numpy.argmin(numpy.abs(gridCoords[dim] - point[dim])))
+            values[(index[2] * shape[1] + index[1]) * shape[0] + index[0], :] = point[spaceDim:]
+
+        return {
+            "space_dim": spaceDim,
+            "names": names,
+            "units": units,
+            "num_grid": numGrid,
+            "grid_coords": gridCoords,
+            "values": values,
+        }
+
+    def _write_binary(self, filename, grid, value_dtype="float64"):
+        """Write binary grid file.
+        """
+        if value_dtype not in VALUE_DTYPES:
+            raise ValueError(f"Unknown value dtype '{value_dtype}'. Choices are: {', '.join(VALUE_DTYPES)}.")
+        dtypeFlag, dtype = VALUE_DTYPES[value_dtype]
+        numGrid = list(grid["num_grid"]) + [0] * (3 - len(grid["num_grid"]))
+        with open(filename, "wb") as fout:
+            fout.write(MAGIC_V2.ljust(MAGIC_SIZE, b"\0"))
+            header = numpy.array(
+                [grid["space_dim"], len(grid["names"])] + numGrid + [dtypeFlag], dtype=numpy.int64)
+            header.tofile(fout)
+            for name, units in zip(grid["names"], grid["units"]):
+                fout.write(name.encode("utf-8").ljust(NAME_SIZE, b"\0"))
+                fout.write(units.encode("utf-8").ljust(UNITS_SIZE, b"\0"))
+            for coords in grid["grid_coords"]:
+                coords.astype(numpy.float64).tofile(fout)
+            grid["values"].astype(dtype).tofile(fout)
+
+    def _parse_command_line(self):
+        """Parse command line arguments.
+        """
+        DESCRIPTION = (
+            "Application for converting a SimpleGridDB ASCII file to the binary grid file "
+            "mapped by the memory-mapped gridded spatial database (pylith.utils.MMapGridDB)."
+        )
+        parser = argparse.ArgumentParser(description=DESCRIPTION,
+                                         formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+        parser.add_argument("filename_in", metavar="FILE_IN",
+                            help="SimpleGridDB ASCII file to convert.")
+        parser.add_argument("filename_out", metavar="FILE_OUT",
+                            help="Binary grid file to write.")
+        parser.add_argument("--value-dtype", dest="value_dtype", default="float64",
+                            choices=sorted(VALUE_DTYPES),
+                            help="Storage dtype of values; 'float32' quantizes the values to "
+                            "single precision, halving the storage and the memory bandwidth of "
+                            "queries.")
+        return parser.parse_args()
+
+
+# End of file
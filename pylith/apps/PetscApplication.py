@@ -21,6 +21,14 @@
 from pythia.mpi import Application
 
 
+class AggregatedError(RuntimeError):
+    """Error already reported in a rank-aggregated summary on the root process.
+
+    Raised on every process after a collective error check so that the whole job tears down
+    without each process printing its own stack trace.
+    """
+
+
 class PetscApplication(Application):
     """Python PETSc application for creating an MPI application that uses PETSc.
     """
@@ -64,9 +72,10 @@ class PetscApplication(Application):
             import sys
 
             self.cleanup()  # Attempt to clean up memory.
-            print("Fatal error. Calling MPI_Abort() to abort PyLith application.")
-            traceback.print_exc(file=sys.stdout)
-            sys.stdout.flush()
+            if not isinstance(err, AggregatedError):
+                print("Fatal error. Calling MPI_Abort() to abort PyLith application.")
+                traceback.print_exc(file=sys.stdout)
+                sys.stdout.flush()
             from pylith.mpi import mpi
             errorCode = -1
             mpi.mpi_abort(mpi.petsc_comm_world(), errorCode)
@@ -39,6 +39,18 @@ class PyLithApp(PetscApplication):
     initializeOnly = pythia.pyre.inventory.bool("initialize_only", default=False)
     initializeOnly.meta['tip'] = "Stop simulation after initializing problem."
 
+    dryRun = pythia.pyre.inventory.bool("dry_run", default=False)
+    dryRun.meta['tip'] = "Initialize problem and print forecast of per-step cost, memory use, and output volume without time stepping."
+
+    flamegraphFilename = pythia.pyre.inventory.str("flamegraph_filename", default="")
+    flamegraphFilename.meta['tip'] = "Prefix for per-rank folded-stack (flame graph) profile files (empty string disables profiling)."
+
+    commStatsFilename = pythia.pyre.inventory.str("comm_stats_filename", default="")
+    commStatsFilename.meta['tip'] = "Name of JSON file for per-phase MPI communication statistics with per-rank values (empty string disables statistics)."
+
+    auxiliaryCacheDir = pythia.pyre.inventory.str("auxiliary_cache_dir", default="")
+    auxiliaryCacheDir.meta['tip'] = "Directory for caching auxiliary field values across runs; cache files are keyed by a hash of the mesh, field layout, and spatial databases (default is no caching)."
+
     from pylith.utils.SimulationMetadata import SimulationMetadata
     metadata = pythia.pyre.inventory.facility(
         "metadata", family="simulation_metadata", factory=SimulationMetadata)
@@ -90,34 +102,58 @@ class PyLithApp(PetscApplication):
 
         # Create mesh (adjust to account for interfaces (faults) if necessary)
         self._eventLogger.stagePush("Meshing")
-        interfaces = None
-        if "interfaces" in dir(self.problem):
-            interfaces = self.problem.interfaces.components()
-        self.mesher.preinitialize(self.problem)
-        mesh = self.mesher.create(self.problem, interfaces)
-        del interfaces
-        self.mesher = None
+        error = None
+        try:
+            interfaces = None
+            if "interfaces" in dir(self.problem):
+                interfaces = self.problem.interfaces.components()
+            self.mesher.preinitialize(self.problem)
+            mesh = self.mesher.create(self.problem, interfaces)
+            del interfaces
+            self.mesher = None
+        except Exception as err:
+            error = err
+        self._checkAggregatedErrors(error)
         self._debug.log(resourceUsageString())
         self._eventLogger.stagePop()
 
+        if self.auxiliaryCacheDir:
+            from pylith.feassemble.feassemble import AuxiliaryFactory_setCacheDir
+            AuxiliaryFactory_setCacheDir(self.auxiliaryCacheDir)
+
         # Setup problem, verify configuration, and then initialize
         self._eventLogger.stagePush("Setup")
-        self.problem.preinitialize(mesh)
-        self._debug.log(resourceUsageString())
+        error = None
+        try:
+            self.problem.preinitialize(mesh)
+            self._debug.log(resourceUsageString())
 
-        self.problem.verifyConfiguration()
+            self.problem.verifyConfiguration()
 
-        self.problem.initialize()
+            self.problem.initialize()
+        except Exception as err:
+            error = err
+        self._checkAggregatedErrors(error)
         self._debug.log(resourceUsageString())
 
         self._eventLogger.stagePop()
 
+        # If performing a dry run, print forecast and stop before running problem
+        if self.dryRun:
+            self.problem.printForecast()
+            return
+
         # If initializing only, stop before running problem
         if self.initializeOnly:
             return
 
         # Run problem
-        self.problem.run(self)
+        error = None
+        try:
+            self.problem.run(self)
+        except Exception as err:
+            error = err
+        self._checkAggregatedErrors(error)
         self._debug.log(resourceUsageString())
 
         # Cleanup
@@ -125,6 +161,9 @@ class PyLithApp(PetscApplication):
         self.problem.finalize()
         self._eventLogger.stagePop()
 
+        if self.flamegraphFilename:
+            self._eventLogger.writeFoldedStacks()
+
         return
 
     def version(self):
@@ -231,6 +270,37 @@ class PyLithApp(PetscApplication):
 
     # PRIVATE METHODS ////////////////////////////////////////////////////
 
+    def _checkAggregatedErrors(self, error):
+        """Collective check for errors across processes at a stage boundary.
+
+        Every process must call this. Failures are gathered onto the root process,
+        deduplicated, and reported in one summary with the number of processes affected by
+        each error, instead of one stack trace per process. All processes then raise
+        AggregatedError so the job tears down instead of hanging in a later collective
+        call. Failures inside collective calls still abort through PETSc error handling.
+
+        Args:
+            error (Exception)
+                Error caught on this process (None if no error).
+        """
+        import pylith.mpi.mpi as mpi
+        numErrors = mpi.allreduce_scalar_int(
+            1 if error is not None else 0, mpi.mpi_sum(), mpi.petsc_comm_world())
+        if 0 == numErrors:
+            return
+
+        msg = "{}: {}".format(type(error).__name__, error) if error is not None else ""
+        summary = mpi.gather_errors(msg, mpi.petsc_comm_world())
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            import sys
+            print("Fatal error. Aborting PyLith application.")
+            print(summary)
+            sys.stdout.flush()
+
+        from pylith.apps.PetscApplication import AggregatedError
+        raise AggregatedError(msg if msg else "Another process reported an error.")
+
     def _configure(self):
         """Setup members using inventory.
         """
@@ -244,6 +314,11 @@ class PyLithApp(PetscApplication):
         logger = EventLogger()
         logger.setClassName("PyLith")
         logger.initialize()
+        if self.flamegraphFilename:
+            logger.enableFoldedOutput(self.flamegraphFilename)
+        if self.commStatsFilename:
+            from pylith.utils.utils import CommLogger
+            CommLogger.enable(self.commStatsFilename)
 
         self._eventLogger = logger
         return
@@ -31,25 +31,59 @@ class RunnerApp():
     def main(self, **kwargs):
         """Main entry point.
 
+        Running simulations with the runner pays the cost of importing Python modules and
+        initializing the SWIG modules once for the entire set instead of once per simulation,
+        which is most of the startup time of each `pylith` invocation. For ensembles, use
+        `--args` to append parameter overrides to every simulation and `--ensemble` to run
+        each simulation once per member with the member's parameter overrides; combined with
+        the mesh importer `topology_cache_dir` property, members skip the mesh surgery as
+        well as the Python startup.
+
         Keyword arguments:
             searchpath (str), default: "."
                 Search path for .cfg files.
         """
         args = argparse.Namespace(**kwargs) if kwargs else self._parse_command_line()
+        extra_arguments = args.args.split() if getattr(args, "args", None) else []
+        members = self._load_ensemble(args.ensemble) if getattr(args, "ensemble", None) else [[]]
 
         for filename in sorted(pathlib.Path(args.searchpath).glob("**/*.cfg")):
             metadata = fromFile(filename)
             if metadata:
                 if metadata.arguments:
-                    pylith_arguments = metadata.arguments
+                    pylith_arguments = metadata.arguments + extra_arguments
                     if args.nodes > 1:
                         pylith_arguments += [f"--nodes={args.nodes}"]
-                    self._run_pylith(filename, pylith_arguments)
+                    for member_arguments in members:
+                        self._run_pylith(filename, pylith_arguments + member_arguments)
                 elif args.verbose:
                     print(f"WARNING: File {filename} missing PyLith arguments.")
             elif args.verbose:
                 print(f"INFO: File {filename} missing simulation metadata.")
 
+    def _load_ensemble(self, filename):
+        """Load ensemble member parameter overrides from file.
+
+        Each nonempty line that does not start with '#' holds the command line arguments for
+        one ensemble member.
+
+        Args:
+            filename (str)
+                Path to file with one set of parameter overrides per line.
+
+        Returns (list of list of str)
+            Command line arguments for each ensemble member.
+        """
+        members = []
+        with open(filename, "r") as fin:
+            for line in fin:
+                line = line.strip()
+                if line and not line.startswith("#"):
+                    members.append(line.split())
+        if not members:
+            raise ValueError(f"No ensemble members found in '{filename}'.")
+        return members
+
     def _run_pylith(self, filename, arguments):
         """Run PyLith simulation using given arguments.
 
@@ -91,6 +125,10 @@ class RunnerApp():
                             dest="verbose", help="Report missing metadata.")
         parser.add_argument("--nodes", action="store", default=1, type=int,
                             dest="nodes", help="Number of processes to use when running PyLith.")
+        parser.add_argument("--args", action="store", default="",
+                            dest="args", help="Additional command line arguments (e.g., parameter overrides) appended to every simulation.")
+        parser.add_argument("--ensemble", action="store", default="",
+                            dest="ensemble", help="File with parameter overrides for one ensemble member per line; each simulation is run once per member in a single persistent process.")
 
         args = parser.parse_args()
         return args
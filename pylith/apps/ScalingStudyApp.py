@@ -0,0 +1,212 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# Application for running scaling studies with PyLith .cfg files.
+
+import argparse
+import pathlib
+import re
+import os
+
+from pylith.apps.PyLithApp import PyLithApp
+
+
+class ScalingStudyApp():
+    """Application for running a strong or weak scaling study from a single
+    PyLith .cfg file.
+
+    The application runs the simulation once for each number of processes in
+    the rank sweep, optionally refining the mesh with RefineUniform, collects
+    the stage timing from the PETSc performance log of each run, and writes a
+    consolidated report with the parallel efficiency per stage. If one
+    refinement level is given (or none), the sweep is a strong scaling study;
+    if a refinement level is given for each rank count, the sweep is a weak
+    scaling study and efficiency is computed at fixed work per process.
+    """
+
+    def main(self, **kwargs):
+        """Main entry point.
+
+        Keyword arguments:
+            cfg_file (str)
+                Simulation parameter file for the study.
+            ranks (str), default: "1,2,4,8"
+                Comma-separated numbers of processes.
+            refine (str), default: None
+                Comma-separated RefineUniform levels (one value, or one per rank count).
+            output_dir (str), default: "scaling_output"
+                Directory for performance logs and the scaling report.
+        """
+        args = argparse.Namespace(**kwargs) if kwargs else self._parse_command_line()
+
+        ranks = [int(value) for value in args.ranks.split(",")]
+        if args.refine:
+            levels = [int(value) for value in args.refine.split(",")]
+            if 1 == len(levels):
+                levels = len(ranks) * levels
+            elif len(levels) != len(ranks):
+                raise ValueError(f"Number of refinement levels ({len(levels)}) must be one or match number of rank counts ({len(ranks)}).")
+        else:
+            levels = len(ranks) * [0]
+
+        outputDir = pathlib.Path(args.output_dir)
+        outputDir.mkdir(parents=True, exist_ok=True)
+
+        cfgFile = pathlib.Path(args.cfg_file)
+        results = []
+        for nprocs, level in zip(ranks, levels):
+            logFilename = (outputDir / f"{cfgFile.stem}_np{nprocs:03d}_refine{level}.log").absolute()
+            self._run_pylith(cfgFile, nprocs, level, logFilename)
+            results.append(self._parse_log(logFilename))
+
+        report = self._format_report(cfgFile, ranks, levels, results)
+        reportFilename = outputDir / f"{cfgFile.stem}_scaling.txt"
+        with open(reportFilename, "w") as fout:
+            fout.write(report)
+        print(report)
+        print(f"Scaling report written to {reportFilename}.")
+
+    def _run_pylith(self, filename, nprocs, level, logFilename):
+        """Run PyLith simulation on given number of processes.
+
+        Args:
+            filename (pathlib.Path)
+                Path to simulation parameter file.
+            nprocs (int)
+                Number of processes.
+            level (int)
+                Number of uniform refinement levels (0 for no refinement).
+            logFilename (pathlib.Path)
+                Path to PETSc performance log for run.
+        """
+        arguments = [str(filename.name), f"--petsc.log_view=:{logFilename}"]
+        if nprocs > 1:
+            arguments += [f"--nodes={nprocs}"]
+        if level > 0:
+            arguments += ["--mesh_generator.refiner=pylith.topology.RefineUniform",
+                          f"--mesh_generator.refiner.levels={level}"]
+
+        workdir = filename.parent
+        cwd = os.getcwd()
+
+        args = " ".join(arguments)
+        if workdir.name:
+            os.chdir(workdir)
+        print(f"RUNNING: pylith {args}...")
+
+        app = PyLithApp()
+        app.run(argv=["pylith"] + arguments)
+        os.chdir(cwd)
+
+    def _parse_log(self, logFilename):
+        """Parse stage times from PETSc performance log.
+
+        Args:
+            logFilename (pathlib.Path)
+                Path to PETSc performance log for run.
+
+        Returns (dict)
+            Total wall time ("total") and wall time per stage ("stages").
+        """
+        patternTotal = re.compile(r"^Time \(sec\):\s+(\S+)")
+        patternStage = re.compile(r"^\s*\d+:\s+(.+?):\s+(\d\.\d+e[+-]\d+)")
+
+        total = None
+        stages = {}
+        with open(logFilename) as fin:
+            for line in fin:
+                match = patternTotal.match(line)
+                if match:
+                    total = float(match.group(1))
+                    continue
+                match = patternStage.match(line)
+                if match:
+                    stages.setdefault(match.group(1), float(match.group(2)))
+        if total is None:
+            raise IOError(f"Could not find total wall time in PETSc performance log {logFilename}.")
+        return {"total": total, "stages": stages}
+
+    def _format_report(self, cfgFile, ranks, levels, results):
+        """Format consolidated scaling report.
+
+        Args:
+            cfgFile (pathlib.Path)
+                Path to simulation parameter file.
+            ranks (list of int)
+                Numbers of processes.
+            levels (list of int)
+                Refinement levels (one per rank count).
+            results (list of dict)
+                Parsed performance log for each run.
+
+        Returns (str)
+            Scaling report.
+        """
+        isWeak = len(set(levels)) > 1
+        study = "weak" if isWeak else "strong"
+
+        def efficiency(timeRef, time, nprocs):
+            if (timeRef <= 0.0) or (time <= 0.0):
+                return None
+            if isWeak:
+                return timeRef / time
+            return (timeRef * ranks[0]) / (time * nprocs)
+
+        phases = ["Total"]
+        for result in results:
+            phases += [stage for stage in result["stages"] if stage not in phases]
+
+        lines = [
+            f"Scaling study ({study} scaling): {cfgFile}",
+            f"Efficiency is relative to the run on {ranks[0]} process(es).",
+            "",
+            f"{'Phase':<24}" + "".join(f"{f'np={nprocs}':>18}" for nprocs in ranks),
+            f"{'(refine levels)':<24}" + "".join(f"{level:>18}" for level in levels),
+        ]
+        for phase in phases:
+            timeRef = results[0]["total"] if phase == "Total" else results[0]["stages"].get(phase, 0.0)
+            cells = []
+            for nprocs, result in zip(ranks, results):
+                time = result["total"] if phase == "Total" else result["stages"].get(phase, 0.0)
+                eff = efficiency(timeRef, time, nprocs)
+                cells.append(f"{time:>10.3e} ({eff:4.0%})" if eff is not None else f"{time:>10.3e}   --  ")
+            lines.append(f"{phase:<24}" + "".join(f"{cell:>18}" for cell in cells))
+        return "\n".join(lines) + "\n"
+
+    def _parse_command_line(self):
+        """Parse command line arguments.
+
+        Returns (argsparse.Namespace)
+           Command line arguments.
+        """
+        DESCRIPTION = (
+            "Application for running a strong or weak scaling study from a single PyLith .cfg file."
+        )
+
+        parser = argparse.ArgumentParser(description=DESCRIPTION,
+            formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+        parser.add_argument("cfg_file", help="Simulation parameter file for the study.")
+        parser.add_argument("--ranks", action="store", default="1,2,4,8",
+                            dest="ranks", help="Comma-separated numbers of processes.")
+        parser.add_argument("--refine", action="store", default=None,
+                            dest="refine", help="Comma-separated RefineUniform levels (one value for all runs, or one per rank count for weak scaling).")
+        parser.add_argument("--output-dir", action="store", default="scaling_output",
+                            dest="output_dir", help="Directory for performance logs and the scaling report.")
+
+        args = parser.parse_args()
+        return args
+
+
+# End of file
@@ -13,6 +13,8 @@
 #
 # ----------------------------------------------------------------------
 
+import pythia.pyre.inventory
+
 from pylith.bc.BoundaryCondition import BoundaryCondition
 from .bc import AbsorbingDampers as ModuleAbsorbingDampers
 
@@ -36,10 +38,14 @@ class AbsorbingDampers(BoundaryCondition, ModuleAbsorbingDampers):
 
             auxiliary_subfields.density.basis_order = 0
             auxiliary_subfields.vp.basis_order = 0
-            auxiliary_subfields.vs.basis_order = 0            
+            auxiliary_subfields.vs.basis_order = 0
             """,
     }
 
+    impedanceFilename = pythia.pyre.inventory.str("impedance_filename", default="")
+    impedanceFilename.meta['tip'] = "Name of file for storing the boundary impedance operator; assembled once and " \
+        "reused in subsequent runs on the same mesh and number of processes (empty turns off stored operator)."
+
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
     def __init__(self, name="absorbingdampers"):
@@ -56,6 +62,9 @@ class AbsorbingDampers(BoundaryCondition, ModuleAbsorbingDampers):
         """Do pre-initialization setup.
         """
         BoundaryCondition.preinitialize(self, problem)
+
+        if self.impedanceFilename:
+            ModuleAbsorbingDampers.setImpedanceFilename(self, self.impedanceFilename)
         return
 
     # PRIVATE METHODS ////////////////////////////////////////////////////
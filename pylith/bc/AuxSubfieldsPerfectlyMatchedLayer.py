@@ -0,0 +1,68 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/bc/AuxSubfieldsPerfectlyMatchedLayer.py
+#
+# @brief Python container for perfectly matched layer subfields.
+
+from pylith.utils.PetscComponent import PetscComponent
+
+
+class AuxSubfieldsPerfectlyMatchedLayer(PetscComponent):
+    """
+    Auxiliary subfields for the perfectly matched layer absorbing region.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pml_auxiliary_subfields]
+            density.basis_order = 0
+            damping_coefficient.basis_order = 1
+            """,
+    }
+
+    import pythia.pyre.inventory
+
+    from pylith.topology.Subfield import Subfield
+
+    density = pythia.pyre.inventory.facility("density", family="auxiliary_subfield", factory=Subfield)
+    density.meta['tip'] = "Mass density subfield."
+
+    dampingCoefficient = pythia.pyre.inventory.facility("damping_coefficient", family="auxiliary_subfield", factory=Subfield)
+    dampingCoefficient.meta['tip'] = "Damping coefficient profile subfield."
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="auxsubfieldsperfectlymatchedlayer"):
+        """Constructor.
+        """
+        PetscComponent.__init__(self, name, facility="auxiliary_subfields")
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _configure(self):
+        PetscComponent._configure(self)
+        return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def auxiliary_subfields():
+    """Factory associated with AuxSubfieldsPerfectlyMatchedLayer.
+    """
+    return AuxSubfieldsPerfectlyMatchedLayer()
+
+
+# End of file
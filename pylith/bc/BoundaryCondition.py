@@ -41,6 +41,10 @@ class BoundaryCondition(Physics, ModuleBoundaryCondition):
     labelValue = pythia.pyre.inventory.int("label_value", default=1)
     labelValue.meta['tip'] = "Value of label identifying boundary (tag of physical group in Gmsh files)."
 
+    extraBoundaries = pythia.pyre.inventory.list("extra_boundaries", default=[])
+    extraBoundaries.meta['tip'] = "Names of labels for additional boundaries merged into this boundary condition " \
+        "(mutually exclusive surfaces sharing the label value; integrator-based conditions only)."
+
     def __init__(self, name="boundarycondition"):
         """Constructor.
         """
@@ -55,6 +59,8 @@ class BoundaryCondition(Physics, ModuleBoundaryCondition):
         ModuleBoundaryCondition.setSubfieldName(self, self.field)
         ModuleBoundaryCondition.setLabelName(self, self.labelName)
         ModuleBoundaryCondition.setLabelValue(self, self.labelValue)
+        if len(self.extraBoundaries) > 0:
+            ModuleBoundaryCondition.setExtraBoundaries(self, self.extraBoundaries)
         return
 
     def _configure(self):
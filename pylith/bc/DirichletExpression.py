@@ -0,0 +1,111 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+import pythia.pyre.inventory
+
+from .BoundaryCondition import BoundaryCondition
+from .bc import DirichletUserFn as ModuleDirichletUserFn
+
+
+class DirichletExpression(BoundaryCondition, ModuleDirichletUserFn):
+    """
+    Dirichlet (prescribed values) boundary condition with values given by mathematical
+    expressions of the nondimensional coordinates x, y, and z and nondimensional time t.
+
+    The expressions are compiled at the start of the simulation and evaluated at native speed,
+    without going through the Python layer or a spatial database per point. Provide one
+    expression per component of the solution subfield.
+
+    Implements `BoundaryCondition`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            # Dirichlet boundary condition prescribing a displacement ramp on the -x boundary.
+            [pylithapp.problem.bc.bc_xneg]
+            constrained_dof = [0, 1]
+            label = boundary_xneg
+            field = displacement
+
+            expressions = [0.01*t*sin(pi*y), 0.0]
+            """,
+    }
+
+    constrainedDOF = pythia.pyre.inventory.array("constrained_dof", converter=int, default=[])
+    constrainedDOF.meta['tip'] = "Array of constrained degrees of freedom (0=1st DOF, 1=2nd DOF, etc)."
+
+    expressions = pythia.pyre.inventory.list("expressions", default=[])
+    expressions.meta['tip'] = "Array of expressions for components of field on boundary in terms of x, y, z, and t."
+
+    def __init__(self, name="dirichletexpression"):
+        """Constructor.
+        """
+        BoundaryCondition.__init__(self, name)
+        return
+
+    def preinitialize(self, problem):
+        """Do pre-initialization setup.
+        """
+        import numpy
+
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log(
+                "Performing minimal initialization of expression Dirichlet boundary condition '%s'." % self.aliases[-1])
+
+        BoundaryCondition.preinitialize(self, problem)
+
+        ModuleDirichletUserFn.setConstrainedDOF(
+            self, numpy.array(self.constrainedDOF, dtype=numpy.intc))
+        ModuleDirichletUserFn.setExpressions(self, self.expressions)
+        return
+
+    def _validate(self, context):
+        if 0 == len(self.constrainedDOF):
+            trait = self.inventory.getTrait("constrained_dof")
+            self._validationError(context, trait, f"No constrained degrees of freedom found for expression Dirichlet boundary condition '{self.aliases[-1]}'. "
+                "'constrained_dof' must be a zero-based integer array (0=x, 1=y, 2=z).")
+        if 0 == len(self.expressions):
+            trait = self.inventory.getTrait("expressions")
+            self._validationError(context, trait, f"No expressions found for expression Dirichlet boundary condition '{self.aliases[-1]}'. "
+                "'expressions' must contain one expression per component of the solution subfield.")
+
+    def _validationError(self, context, trait, msg):
+        from pythia.pyre.inventory.Item import Item
+        error = ValueError(msg)
+        descriptor = self.getTraitDescriptor(trait.name)
+        context.error(error, items=[Item(trait, descriptor)])
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        BoundaryCondition._configure(self)
+        return
+
+    def _createModuleObj(self):
+        """Create handle to corresponding C++ object.
+        """
+        ModuleDirichletUserFn.__init__(self)
+        return
+
+
+# Factories
+
+def boundary_condition():
+    """Factory associated with DirichletExpression.
+    """
+    return DirichletExpression()
+
+
+# End of file
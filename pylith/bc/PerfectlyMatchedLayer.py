@@ -0,0 +1,86 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from pylith.bc.BoundaryCondition import BoundaryCondition
+from .bc import PerfectlyMatchedLayer as ModulePerfectlyMatchedLayer
+
+
+class PerfectlyMatchedLayer(BoundaryCondition, ModulePerfectlyMatchedLayer):
+    """
+    Perfectly matched layer absorbing region.
+
+    The layer is a volumetric region of cells adjacent to the boundary, marked with a label
+    like a material. The damping coefficient profile is graded from zero at the interior edge
+    of the layer to its maximum at the exterior boundary.
+
+    Implements `BoundaryCondition`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pml]
+            label = pml_xpos
+            field = velocity
+
+            db_auxiliary_field = spatialdata.spatialdb.SimpleDB
+            db_auxiliary_field.description = Density and damping profile for PML region
+            db_auxiliary_field.iohandler.filename = pml_xpos.spatialdb
+
+            auxiliary_subfields.density.basis_order = 0
+            auxiliary_subfields.damping_coefficient.basis_order = 1
+            """,
+    }
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="perfectlymatchedlayer"):
+        """Constructor.
+        """
+        BoundaryCondition.__init__(self, name)
+        return
+
+    def _defaults(self):
+        from .AuxSubfieldsPerfectlyMatchedLayer import AuxSubfieldsPerfectlyMatchedLayer
+        self.auxiliarySubfields = AuxSubfieldsPerfectlyMatchedLayer("auxiliary_subfields")
+
+    def preinitialize(self, problem):
+        """Do pre-initialization setup.
+        """
+        BoundaryCondition.preinitialize(self, problem)
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        BoundaryCondition._configure(self)
+        return
+
+    def _createModuleObj(self):
+        """Create handle to corresponding C++ object.
+        """
+        ModulePerfectlyMatchedLayer.__init__(self)
+        return
+
+
+# Factories
+
+def boundary_condition():
+    """Factory associated with PerfectlyMatchedLayer.
+    """
+    return PerfectlyMatchedLayer()
+
+
+# End of file
@@ -21,8 +21,10 @@ __all__ = [
     "AbsorbingDampers",
     "AuxSubfieldsTimeDependent",
     "BoundaryCondition",
+    "DirichletExpression",
     "DirichletTimeDependent",
     "NeumannTimeDependent",
+    "PerfectlyMatchedLayer",
     "ZeroDB",
 ]
 
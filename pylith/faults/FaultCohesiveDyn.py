@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .FaultCohesive import FaultCohesive
+from .faults import FaultCohesiveDyn as ModuleFaultCohesiveDyn
+
+
+class FaultCohesiveDyn(FaultCohesive, ModuleFaultCohesiveDyn):
+    """
+    Fault surface with spontaneous (dynamic) rupture governed by rate- and state-dependent
+    friction implemented with cohesive cells.
+
+    Requires the dynamic_imex formulation.
+
+    Implements `FaultCohesive`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.problem.interfaces.fault]
+            label = fault
+            label_value = 20
+
+            observers.observer.data_fields = [slip_rate, state_variable]
+
+            db_auxiliary_field = spatialdata.spatialdb.UniformDB
+            db_auxiliary_field.description = Rate-state friction parameters
+            db_auxiliary_field.values = [state_variable, reference_friction_coefficient, reference_slip_rate, characteristic_slip_distance, constitutive_parameter_a, constitutive_parameter_b, cohesion]
+            db_auxiliary_field.data = [1.0e+8*s, 0.6, 1.0e-6*m/s, 0.02*m, 0.008, 0.012, 0.0*Pa]
+            """
+    }
+
+    import pythia.pyre.inventory
+
+    from pylith.utils.NullComponent import NullComponent
+    auxiliaryFieldDB = pythia.pyre.inventory.facility("db_auxiliary_field", family="spatial_database", factory=NullComponent)
+
+    def __init__(self, name="faultcohesivedyn"):
+        """Initialize configuration.
+        """
+        FaultCohesive.__init__(self, name)
+
+    def preinitialize(self, problem):
+        """Do pre-initialization setup.
+        """
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log(f"Pre-initializing fault '{self.labelName}={self.labelValue}'.")
+        FaultCohesive.preinitialize(self, problem)
+
+    def verifyConfiguration(self):
+        """Verify compatibility of configuration.
+        """
+        FaultCohesive.verifyConfiguration(self)
+        ModuleFaultCohesiveDyn.verifyConfiguration(self, self.mesh())
+
+    def _createModuleObj(self):
+        """Create handle to C++ FaultCohesiveDyn.
+        """
+        ModuleFaultCohesiveDyn.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def fault():
+    """Factory associated with FaultCohesiveDyn.
+    """
+    return FaultCohesiveDyn()
+
+
+# End of file
@@ -0,0 +1,100 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from pylith.utils.PetscComponent import PetscComponent
+from .faults import FaultSlipStats as ModuleFaultSlipStats
+
+
+class FaultSlipStats(PetscComponent, ModuleFaultSlipStats):
+    """
+    Observer of a fault that writes scalar slip statistics (seismic moment, moment magnitude,
+    rupture area, mean slip, mean slip rate) as time series in a small HDF5 file.
+
+    The statistics are computed during the run from the slip in the fault auxiliary field, so
+    they do not require post-processing the full fault output archives. The slip magnitude uses
+    the shear components of slip (the opening component is excluded); the seismic moment uses a
+    uniform shear modulus.
+
+    Implements `PetscComponent`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            # Write slip statistics for the fault in addition to the fault output.
+            [pylithapp.problem.interfaces.fault.observers]
+            stats = pylith.faults.FaultSlipStats
+
+            [pylithapp.problem.interfaces.fault.observers.stats]
+            shear_modulus = 30.0*GPa
+            slip_threshold = 0.001*m
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    from pythia.pyre.units.pressure import Pa
+    from pythia.pyre.units.length import m
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of HDF5 slip statistics file (default is 'output_dir/simname-identifier-slip_stats.h5')."
+
+    shearModulus = pythia.pyre.inventory.dimensional("shear_modulus", default=3.0e+10*Pa,
+                                                     validator=pythia.pyre.inventory.greater(0.0*Pa))
+    shearModulus.meta['tip'] = "Uniform shear modulus used to compute the seismic moment."
+
+    slipThreshold = pythia.pyre.inventory.dimensional("slip_threshold", default=0.0*m,
+                                                      validator=pythia.pyre.inventory.greaterEqual(0.0*m))
+    slipThreshold.meta['tip'] = "Cells with slip above the threshold contribute to the rupture area, mean slip, and mean slip rate."
+
+    def __init__(self, name="faultslipstats"):
+        """Constructor.
+        """
+        PetscComponent.__init__(self, name, facility="observer")
+
+    def preinitialize(self, problem, identifier):
+        """Do minimal initialization.
+        """
+        self._createModuleObj()
+
+        import os
+        filename = self.filename
+        if not filename:
+            filename = os.path.join(problem.defaults.outputDir, f"{problem.defaults.simName}-{identifier}-slip_stats.h5")
+        relpath = os.path.dirname(filename)
+        if relpath and not os.path.isdir(relpath):
+            os.makedirs(relpath, exist_ok=True)
+        ModuleFaultSlipStats.setFilename(self, filename)
+        ModuleFaultSlipStats.setShearModulus(self, self.shearModulus.value)
+        ModuleFaultSlipStats.setSlipThreshold(self, self.slipThreshold.value)
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        PetscComponent._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleFaultSlipStats.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with FaultSlipStats.
+    """
+    return FaultSlipStats()
+
+
+# End of file
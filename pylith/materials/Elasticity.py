@@ -44,6 +44,9 @@ class Elasticity(Material, ModuleElasticity):
     useBodyForce = pythia.pyre.inventory.bool("use_body_force", default=False)
     useBodyForce.meta['tip'] = "Include body force term in elasticity equation."
 
+    interfaceContrastThreshold = pythia.pyre.inventory.float("interface_contrast_threshold", default=0.0)
+    interfaceContrastThreshold.meta['tip'] = "Replace elastic moduli in cells where the within-cell contrast exceeds this ratio (e.g., cells straddling a sediment/basement contact) with the within-cell harmonic mean (<= 1 disables)."
+
     rheology = pythia.pyre.inventory.facility("bulk_rheology", family="elasticity_rheology", factory=IsotropicLinearElasticity)
     rheology.meta['tip'] = "Bulk rheology for elastic material."
 
@@ -66,6 +69,7 @@ class Elasticity(Material, ModuleElasticity):
         Material.preinitialize(self, problem)
         self.rheology.addAuxiliarySubfields(self, problem)
         ModuleElasticity.useBodyForce(self, self.useBodyForce)
+        ModuleElasticity.setInterfaceContrastThreshold(self, self.interfaceContrastThreshold)
 
     def _createModuleObj(self):
         """Create handle to C++ Elasticity.
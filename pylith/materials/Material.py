@@ -41,6 +41,18 @@ class Material(Physics, ModuleMaterial):
     labelValue = pythia.pyre.inventory.int("label_value", default=1)
     labelValue.meta["tip"] = "Value of label for material."
 
+    stateVarsUpdateThreshold = pythia.pyre.inventory.float("state_vars_update_threshold", default=0.0,
+                                                           validator=pythia.pyre.inventory.greaterEqual(0.0))
+    stateVarsUpdateThreshold.meta["tip"] = "Relative change in state variables below which cells are skipped in the state variable update (0 updates all cells every time step)."
+
+    stateVarsRefreshInterval = pythia.pyre.inventory.int("state_vars_refresh_interval", default=10,
+                                                         validator=pythia.pyre.inventory.greaterEqual(0))
+    stateVarsRefreshInterval.meta["tip"] = "Number of time steps between full state variable updates when using a nonzero update threshold (0 means never)."
+
+    from pythia.pyre.units.length import m
+    dbQueryResolution = pythia.pyre.inventory.dimensional("db_query_resolution", default=0.0*m)
+    dbQueryResolution.meta["tip"] = "Query spatial databases for auxiliary field values on a coarse grid with this spacing, interpolating to the evaluation points with a gradient-limited estimate (0 queries every evaluation point)."
+
     def __init__(self, name="material"):
         """Constructor.
         """
@@ -53,6 +65,9 @@ class Material(Physics, ModuleMaterial):
         ModuleMaterial.setDescription(self, self.description)
         ModuleMaterial.setLabelName(self, self.labelName)
         ModuleMaterial.setLabelValue(self, self.labelValue)
+        ModuleMaterial.setStateVarsUpdateThreshold(self, self.stateVarsUpdateThreshold)
+        ModuleMaterial.setStateVarsRefreshInterval(self, self.stateVarsRefreshInterval)
+        ModuleMaterial.setDBQueryResolution(self, self.dbQueryResolution.value)
 
 
 # End of file
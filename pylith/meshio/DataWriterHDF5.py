@@ -36,6 +36,12 @@ class DataWriterHDF5(DataWriter, ModuleDataWriterHDF5):
     filename = pythia.pyre.inventory.str("filename", default="")
     filename.meta['tip'] = "Name of HDF5 file."
 
+    asyncWrite = pythia.pyre.inventory.bool("async_write", default=False)
+    asyncWrite.meta['tip'] = "Write fields on a background thread so time stepping continues during flushes (requires MPI_THREAD_MULTIPLE)."
+
+    appendFile = pythia.pyre.inventory.bool("append", default=False)
+    appendFile.meta['tip'] = "Append to existing output file instead of truncating it (use when restarting from a checkpoint)."
+
     def __init__(self, name="datawriterhdf5"):
         """Constructor.
         """
@@ -46,6 +52,8 @@ class DataWriterHDF5(DataWriter, ModuleDataWriterHDF5):
         """Initialize writer.
         """
         DataWriter.preinitialize(self)
+        ModuleDataWriterHDF5.setAsyncWrite(self, self.asyncWrite)
+        ModuleDataWriterHDF5.setAppend(self, self.appendFile)
 
     def setFilename(self, outputDir, simName, label):
         """Set filename from default options and inventory. If filename is given in inventory, use it,
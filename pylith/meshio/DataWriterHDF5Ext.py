@@ -35,6 +35,21 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
     filename = pythia.pyre.inventory.str("filename", default="")
     filename.meta['tip'] = "Name of HDF5 file."
 
+    bufferSize = pythia.pyre.inventory.int("buffer_size", default=1, validator=pythia.pyre.inventory.greaterEqual(1))
+    bufferSize.meta['tip'] = "Number of output time steps to buffer in memory and write in one batch."
+
+    compressionFilter = pythia.pyre.inventory.str("compression_filter", default="deflate", validator=pythia.pyre.inventory.choice(["none", "deflate"]))
+    compressionFilter.meta['tip'] = "Compression filter applied to chunked datasets."
+
+    compressionLevel = pythia.pyre.inventory.int("compression_level", default=6)
+    compressionLevel.meta['tip'] = "Compression level for deflate filter (0-9)."
+
+    scaleOffsetDecimals = pythia.pyre.inventory.int("scale_offset_decimals", default=-1)
+    scaleOffsetDecimals.meta['tip'] = "Decimal digits preserved by lossy scale-offset filter for floating-point datasets (negative disables)."
+
+    rankBlockLayout = pythia.pyre.inventory.bool("rank_block_layout", default=False)
+    rankBlockLayout.meta['tip'] = "Write datasets as rank-contiguous blocks with a stored permutation instead of reordering rows to global order."
+
     def __init__(self, name="datawriterhdf5"):
         """Constructor.
         """
@@ -44,6 +59,11 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
         """Initialize writer.
         """
         DataWriter.preinitialize(self)
+        ModuleDataWriterHDF5Ext.setBufferSize(self, self.bufferSize)
+        ModuleDataWriterHDF5Ext.setCompressionLevel(self, self.compressionLevel)
+        ModuleDataWriterHDF5Ext.setCompressionFilter(self, self.compressionFilter)
+        ModuleDataWriterHDF5Ext.setScaleOffsetDecimals(self, self.scaleOffsetDecimals)
+        ModuleDataWriterHDF5Ext.setRankBlockLayout(self, self.rankBlockLayout)
 
     def setFilename(self, outputDir, simName, label):
         """Set filename from default options and inventory. If filename is given in inventory, use it,
@@ -0,0 +1,73 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .DataWriter import DataWriter
+from .meshio import DataWriterMemory as ModuleDataWriterMemory
+
+
+class DataWriterMemory(DataWriter, ModuleDataWriterMemory):
+    """
+    Writer of solution, auxiliary, and derived subfields to an in-process consumer
+    instead of the filesystem.
+
+    Fields are passed to a sink callback registered on the C++ object (embedding
+    applications) or buffered in memory for an in-process consumer to drain.
+    Intended for pipelines, such as Green's function based inversions, where
+    writing responses to disk and reading them back dominates the wall time.
+
+    Implements `DataWriter`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [data_writer]
+        """
+    }
+
+    def __init__(self, name="datawritermemory"):
+        """Constructor.
+        """
+        DataWriter.__init__(self, name)
+        ModuleDataWriterMemory.__init__(self)
+
+    def preinitialize(self):
+        """Initialize writer.
+        """
+        DataWriter.preinitialize(self)
+
+    def setFilename(self, outputDir, simName, label):
+        """No files are written; nothing to do.
+        """
+        return
+
+    def _configure(self):
+        """Configure object.
+        """
+        DataWriter._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object."""
+        ModuleDataWriterMemory.__init__(self)
+        return
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def data_writer():
+    """Factory associated with DataWriter.
+    """
+    return DataWriterMemory()
+
+
+# End of file
@@ -35,6 +35,9 @@ class OutputObserver(PetscComponent, ModuleOutputObserver):
     outputBasisOrder = pythia.pyre.inventory.int("output_basis_order", default=1, validator=pythia.pyre.inventory.choice([0,1]))
     outputBasisOrder.meta['tip'] = "Basis order for output."
 
+    activeTimeWindows = pythia.pyre.inventory.list("active_time_windows", default=[])
+    activeTimeWindows.meta['tip'] = "Time windows in which the observer writes output, as entries 'START -> END' with units (e.g., [199.9*year -> 200.1*year]); an empty list means the full duration of the simulation."
+
     def __init__(self, name="outputobserver"):
         """Constructor.
         """
@@ -59,6 +62,21 @@ class OutputObserver(PetscComponent, ModuleOutputObserver):
         self.writer.preinitialize()
         ModuleOutputObserver.setWriter(self, self.writer)
 
+        if self.activeTimeWindows:
+            import numpy
+            from pythia.pyre.units import parser
+            uparser = parser()
+            numWindows = len(self.activeTimeWindows)
+            windows = numpy.zeros((numWindows, 2), dtype=numpy.float64)
+            for i, window in enumerate(self.activeTimeWindows):
+                fields = window.split("->")
+                if len(fields) != 2:
+                    raise ValueError(f"Could not parse active time window '{window}' for output observer "
+                                     f"'{self.aliases[-1]}'. Windows must have the form 'START -> END'.")
+                windows[i, 0] = uparser.parse(fields[0].strip()).value
+                windows[i, 1] = uparser.parse(fields[1].strip()).value
+            ModuleOutputObserver.setActiveTimeWindows(self, windows)
+
     def _configure(self):
         """Set members based using inventory.
         """
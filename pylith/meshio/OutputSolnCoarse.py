@@ -0,0 +1,105 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .OutputSoln import OutputSoln
+from .meshio import OutputSolnCoarse as ModuleOutputSolnCoarse
+
+
+class OutputSolnCoarse(OutputSoln, ModuleOutputSolnCoarse):
+    """
+    Output of solution subfields restricted to a coarser mesh.
+
+    Projecting the solution onto a user-supplied coarse mesh greatly reduces
+    the output volume while preserving long-wavelength deformation, making it
+    practical to write time series at high temporal cadence.
+
+    :::{tip}
+    Most output information can be configured at the problem level using the [`ProblemDefaults` Component](../problems/ProblemDefaults.md).
+    :::
+
+    Implements `OutputSoln`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [observer]
+            data_fields = [displacement]
+
+            # Coarse mesh for decimated output.
+            reader = pylith.meshio.MeshIOAscii
+            reader.filename = mesh_coarse.txt
+
+            # Write output to HDF5 file with name `domain_coarse.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = domain_coarse.h5
+
+            output_basis_order = 1
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    label = pythia.pyre.inventory.str("label", default="coarse")
+    label.meta['tip'] = "Label identifier for coarse mesh (used in constructing default filenames)."
+
+    from .MeshIOAscii import MeshIOAscii
+    reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
+    reader.meta['tip'] = "Reader for coarse mesh."
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="outputsolncoarse"):
+        """Constructor.
+        """
+        OutputSoln.__init__(self, name)
+        self.coarseMesh = None
+        return
+
+    def preinitialize(self, problem):
+        """Do mimimal initialization.
+        """
+        OutputSoln.preinitialize(self, problem)
+
+        # Read coarse mesh and nondimensionalize it consistently with the
+        # simulation mesh. Retain a reference because the C++ object borrows
+        # the mesh.
+        self.reader.preinitialize()
+        self.coarseMesh = self.reader.read(debug=False)
+        from pylith.topology.topology import MeshOps_nondimensionalize
+        MeshOps_nondimensionalize(self.coarseMesh, problem.normalizer)
+
+        ModuleOutputSolnCoarse.setCoarseMesh(self, self.coarseMesh)
+
+        identifier = self.aliases[-1]
+        self.writer.setFilename(problem.defaults.outputDir, problem.defaults.simName, identifier)
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputSolnCoarse.__init__(self)
+        return
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def observer():
+    """Factory associated with OutputSoln.
+    """
+    return OutputSolnCoarse()
+
+
+# End of file
@@ -0,0 +1,100 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .OutputSoln import OutputSoln
+from .meshio import OutputSolnSubdomain as ModuleOutputSolnSubdomain
+
+
+def validateLabel(value):
+    """Validate label for group/nodeset/pset.
+    """
+    if not value.strip():
+        raise ValueError("Label for volume subdomain in mesh not specified.")
+    return value
+
+
+class OutputSolnSubdomain(OutputSoln, ModuleOutputSolnSubdomain):
+    """
+    Output of solution subfields over a volume subdomain marked by a cell label.
+
+    Writing only the region being analyzed (e.g., the volume around a fault) at full
+    cadence greatly reduces output cost compared to whole-domain output.
+
+    :::{tip}
+    Most output information can be configured at the problem level using the [`ProblemDefaults` Component](../problems/ProblemDefaults.md).
+    :::
+
+    Implements `OutputSoln`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [observer]
+            data_fields = [displacement]
+
+            # Output the cells with material-id 2 (region around the fault).
+            label = material-id
+            label_value = 2
+
+            # Write output to HDF5 file with name `fault_region.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = fault_region.h5
+
+            output_basis_order = 1
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    labelName = pythia.pyre.inventory.str("label", default="", validator=validateLabel)
+    labelName.meta['tip'] = "Name of label identifier for volume subdomain."
+
+    labelValue = pythia.pyre.inventory.int("label_value", default=1)
+    labelValue.meta['tip'] = "Value of label identifier for volume subdomain."
+
+    def __init__(self, name="outputsolnsubdomain"):
+        """Constructor.
+        """
+        OutputSoln.__init__(self, name)
+
+    def preinitialize(self, problem):
+        """Do mimimal initialization.
+        """
+        OutputSoln.preinitialize(self, problem)
+        ModuleOutputSolnSubdomain.setLabelName(self, self.labelName)
+        ModuleOutputSolnSubdomain.setLabelValue(self, self.labelValue)
+
+        identifier = self.aliases[-1]
+        self.writer.setFilename(problem.defaults.outputDir, problem.defaults.simName, identifier)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        OutputSoln._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputSolnSubdomain.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with OutputSoln.
+    """
+    return OutputSolnSubdomain()
+
+
+# End of file
@@ -0,0 +1,80 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .OutputTrigger import OutputTrigger
+from .meshio import OutputTriggerChange as ModuleOutputTriggerChange
+
+
+class OutputTriggerChange(OutputTrigger, ModuleOutputTriggerChange):
+    """
+    Define how often output is written in terms of change in the solution.
+
+    Output is written when the relative change in the solution (or a chosen
+    subfield, such as displacement or velocity) since the most recent write
+    exceeds a threshold, concentrating output where the dynamics happen. A
+    maximum number of skipped steps guarantees sparse coverage of quiescent
+    intervals.
+
+    Implements `OutputTrigger`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [output_trigger]
+            threshold = 0.01
+            subfield = displacement
+            max_num_skip = 100
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    threshold = pythia.pyre.inventory.float("threshold", default=0.01, validator=pythia.pyre.inventory.greaterEqual(0.0))
+    threshold.meta['tip'] = "Relative change in solution (L2 norm of increment / L2 norm of solution) triggering a write."
+
+    subfield = pythia.pyre.inventory.str("subfield", default="")
+    subfield.meta['tip'] = "Name of solution subfield used for change metric (empty string means entire solution)."
+
+    maxNumSkip = pythia.pyre.inventory.int("max_num_skip", default=100, validator=pythia.pyre.inventory.greaterEqual(0))
+    maxNumSkip.meta['tip'] = "Maximum number of solution steps to skip between writes regardless of solution change."
+
+    def __init__(self, name="outputtriggerchange"):
+        """Constructor.
+        """
+        OutputTrigger.__init__(self, name)
+
+    def preinitialize(self):
+        """Setup output trigger.
+        """
+        ModuleOutputTriggerChange.__init__(self)
+        ModuleOutputTriggerChange.setIdentifier(self, self.aliases[-1])
+        ModuleOutputTriggerChange.setThreshold(self, self.threshold)
+        ModuleOutputTriggerChange.setSubfieldName(self, self.subfield)
+        ModuleOutputTriggerChange.setMaxNumStepsSkip(self, self.maxNumSkip)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        OutputTrigger._configure(self)
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def output_trigger():
+    """Factory associated with OutputTriggerChange.
+    """
+    return OutputTriggerChange()
+
+
+# End of file
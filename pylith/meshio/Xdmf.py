@@ -29,7 +29,7 @@ class Field(object):
     def __init__(self):
         self.name = None
         self.vectorFieldType = None
-        self.data = None
+        self.shape = None
         self.domain = None
         return
 
@@ -42,6 +42,8 @@ class Xdmf(object):
         """Constructor.
         """
         self.file = None
+        self.filenameXdmf = None
+        self.spaceDim = None
 
     def write(self, filenameH5, filenameXdmf=None, verbose=False):
         """Write Xdmf file corresponding to given HDF5 file.
@@ -57,6 +59,7 @@ class Xdmf(object):
             raise IOError(
                 "Cannot create Xdmf file for HDF5 file '%s'. File not found." % filenameH5)
         self.h5 = h5py.File(filenameH5, "r")
+        self.spaceDim = None
 
         if self._getSpaceDim() == 1:
             print("WARNING: Xdmf grids are not defined for 1-D domains.\n"
@@ -64,7 +67,11 @@ class Xdmf(object):
             self.h5.close()
             return
 
-        self.file = open(filenameXdmf, "w")
+        # Accumulate metadata in memory and write the Xdmf file in one batch
+        # instead of issuing many small writes per time grid.
+        import io
+        self.filenameXdmf = filenameXdmf
+        self.file = io.StringIO()
 
         # Header
         self._openXdmf()
@@ -74,6 +81,12 @@ class Xdmf(object):
         vertices = self.h5["/geometry/vertices"]
         self._openDomain(cells, vertices)
 
+        # Snapshot grid metadata once; the time grids reference the same
+        # topology and geometry, so there is no need to query the HDF5 file
+        # again for every time step.
+        cellType = self._getXdmfCellType(cells)
+        numCells = cells.shape[0]
+
         timeStamps = self._getTimeStamps()
         fields = self._getFields()
 
@@ -82,11 +95,11 @@ class Xdmf(object):
             self._writeTimeStamps(timeStamps)
             for iTime, timeStamp in enumerate(timeStamps):
                 self._openTimeGrid()
-                self._writeGridTopology(cells)
+                self._writeGridTopology(cellType, numCells)
                 self._writeGridGeometry(vertices)
                 for field in fields:
                     if field.vectorFieldType in ["Tensor6", "Matrix"]:
-                        numComponents = field.data.shape[-1]
+                        numComponents = field.shape[-1]
                         for iComponent in range(numComponents):
                             self._writeGridFieldComponent(
                                 field, iTime, iComponent)
@@ -97,11 +110,11 @@ class Xdmf(object):
         else:
             iTime = None
             self._openTimeGrid()
-            self._writeGridTopology(cells)
+            self._writeGridTopology(cellType, numCells)
             self._writeGridGeometry(vertices)
             for field in fields:
                 if field.vectorFieldType in ["Tensor6", "Matrix"]:
-                    numComponents = field.data.shape[-1]
+                    numComponents = field.shape[-1]
                     for iComponent in range(numComponents):
                         self._writeGridFieldComponent(field, iTime, iComponent)
                 else:
@@ -114,12 +127,16 @@ class Xdmf(object):
 
     def _close(self):
         self.h5.close()
+        with open(self.filenameXdmf, "w") as fout:
+            fout.write(self.file.getvalue())
         self.file.close()
 
     def _getSpaceDim(self):
-        vertices = self.h5["/geometry/vertices"]
-        assert(2 == len(vertices.shape))
-        return vertices.shape[1]
+        if self.spaceDim is None:
+            vertices = self.h5["/geometry/vertices"]
+            assert(2 == len(vertices.shape))
+            self.spaceDim = vertices.shape[1]
+        return self.spaceDim
 
     def _getXdmfCellType(self, cells):
         """Get type of cell.
@@ -190,7 +207,9 @@ class Xdmf(object):
                 for name, dataset in vfields.items():
                     field = Field()
                     field.name = name
-                    field.data = dataset[:]
+                    # Only the shape is needed for the Xdmf metadata; do not
+                    # read the dataset contents.
+                    field.shape = dataset.shape
                     field.domain = Field.groupToDomain[group]
                     if "vector_field_type" in dataset.attrs:
                         field.vectorFieldType = self._getXdmfVectorFieldType(
@@ -352,13 +371,9 @@ class Xdmf(object):
             "      </Grid>\n"
         )
 
-    def _writeGridTopology(self, cells):
+    def _writeGridTopology(self, cellType, numCells):
         """Write topology information for current grid.
         """
-        cellType = self._getXdmfCellType(cells)
-        assert(2 == len(cells.shape))
-        numCells = cells.shape[0]
-
         self.file.write(
             "        <Topology TopologyType=\"%s\" NumberOfElements=\"%d\">\n"
             "          <DataItem Reference=\"XML\">\n"
@@ -404,12 +419,12 @@ class Xdmf(object):
                 "Unexpected vector field type '%s' for field component names." % field.vectorFieldType)
         h5Name = "/" + Field.domainToGroup[field.domain] + "/" + field.name
         if iTime is None:
-            assert(2 == len(field.data.shape))
-            numPoints, numComponents = field.data.shape
+            assert(2 == len(field.shape))
+            numPoints, numComponents = field.shape
             numTimeSteps = 1
         else:
-            assert(3 == len(field.data.shape))
-            numTimeSteps, numPoints, numComponents = field.data.shape
+            assert(3 == len(field.shape))
+            numTimeSteps, numPoints, numComponents = field.shape
 
         self.file.write(
             "        <Attribute Name=\"%(componentName)s\" Type=\"Scalar\" Center=\"%(domain)s\">\n"
@@ -445,17 +460,17 @@ class Xdmf(object):
         iStep = iTime
         if iTime is None:
             iStep = 0
-            if 2 == len(field.data.shape):
-                numPoints, numComponents = field.data.shape
+            if 2 == len(field.shape):
+                numPoints, numComponents = field.shape
                 numTimeSteps = 1
-            elif 3 == len(field.data.shape):
-                numTimeSteps, numPoints, numComponents = field.data.shape
+            elif 3 == len(field.shape):
+                numTimeSteps, numPoints, numComponents = field.shape
             else:
                 raise ValueError(
                     "Unexpected shape for dataset '%s'." % field.name)
         else:
-            assert(3 == len(field.data.shape))
-            numTimeSteps, numPoints, numComponents = field.data.shape
+            assert(3 == len(field.shape))
+            numTimeSteps, numPoints, numComponents = field.shape
 
         if 2 == self._getSpaceDim() and field.vectorFieldType == "Vector":
 
@@ -21,6 +21,7 @@
 __all__ = [
     "MeshIOObj",
     "MeshIOAscii",
+    "MeshIOBinary",
     "MeshIOCubit",
     "MeshIOLagrit",
     "DataWriter",
@@ -31,9 +32,12 @@ __all__ = [
     "OutputPhysics",
     "OutputSoln",
     "OutputSolnBoundary",
+    "OutputSolnCoarse",
     "OutputSolnDomain",
     "OutputSolnPoints",
+    "OutputSolnSubdomain",
     "OutputTrigger",
+    "OutputTriggerChange",
     "OutputTriggerStep",
     "OutputTriggerTime",
     "PointsList",
@@ -0,0 +1,169 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from pylith.utils.PetscComponent import PetscComponent
+
+
+class EarthquakeCycle(PetscComponent):
+    """
+    Earthquake-cycle driver chaining quasistatic (interseismic) and dynamic (coseismic)
+    segments in-process.
+
+    Each cycle runs the quasistatic problem over the interseismic window and then the
+    dynamic problem over the event window; the solution and material state (state
+    variables) are handed off in memory between segments, so no output files are read
+    back and no re-equilibration solves are needed. The time windows of both problems
+    are shifted by the cycle period for each successive cycle.
+
+    The quasistatic and dynamic problems must be configured over the same mesh with
+    their materials, interfaces, and boundary conditions in the same order.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp]
+            problem = pylith.problems.EarthquakeCycle
+
+            [pylithapp.problem]
+            num_cycles = 5
+            event_duration = 120.0*s
+
+            [pylithapp.problem.quasistatic]
+            formulation = quasistatic
+            start_time = 0.0*year
+            end_time = 200.0*year
+            initial_dt = 5.0*year
+
+            [pylithapp.problem.dynamic]
+            formulation = dynamic
+            initial_dt = 0.05*s
+        """
+    }
+
+    import pythia.pyre.inventory
+    from pythia.pyre.units.time import second
+
+    from .TimeDependent import TimeDependent
+
+    quasistatic = pythia.pyre.inventory.facility("quasistatic", family="problem", factory=TimeDependent)
+    quasistatic.meta['tip'] = "Quasistatic problem for the interseismic segments."
+
+    dynamic = pythia.pyre.inventory.facility("dynamic", family="problem", factory=TimeDependent)
+    dynamic.meta['tip'] = "Dynamic problem for the coseismic segments."
+
+    numCycles = pythia.pyre.inventory.int("num_cycles", default=1, validator=pythia.pyre.inventory.greater(0))
+    numCycles.meta['tip'] = "Number of earthquake cycles to run."
+
+    eventDuration = pythia.pyre.inventory.dimensional("event_duration", default=60.0 * second,
+                                                      validator=pythia.pyre.inventory.greater(0.0 * second))
+    eventDuration.meta['tip'] = "Duration of the dynamic (coseismic) segment of each cycle."
+
+    def __init__(self, name="earthquakecycle"):
+        """Constructor.
+        """
+        PetscComponent.__init__(self, name, facility="problem")
+
+    # The mesher accesses the materials, interfaces, and defaults of the problem when
+    # creating the mesh; both segment problems share the mesh, so delegate to the
+    # quasistatic problem.
+    @property
+    def materials(self):
+        return self.quasistatic.materials
+
+    @property
+    def interfaces(self):
+        return self.quasistatic.interfaces
+
+    @property
+    def bc(self):
+        return self.quasistatic.bc
+
+    @property
+    def normalizer(self):
+        return self.quasistatic.normalizer
+
+    @property
+    def defaults(self):
+        return self.quasistatic.defaults
+
+    def preinitialize(self, mesh):
+        """Do minimal initialization of both segment problems.
+        """
+        self.quasistatic.preinitialize(mesh)
+        self.dynamic.preinitialize(mesh)
+
+    def verifyConfiguration(self):
+        """Verify compatibility of configuration.
+        """
+        if self.quasistatic.formulation != "quasistatic":
+            raise ValueError("Quasistatic problem for earthquake cycle must use the 'quasistatic' formulation "
+                             "(got '{}').".format(self.quasistatic.formulation))
+        if self.dynamic.formulation not in ("dynamic", "dynamic_imex"):
+            raise ValueError("Dynamic problem for earthquake cycle must use the 'dynamic' or 'dynamic_imex' "
+                             "formulation (got '{}').".format(self.dynamic.formulation))
+        self.quasistatic.verifyConfiguration()
+        self.dynamic.verifyConfiguration()
+
+    def initialize(self):
+        """Initialize both segment problems.
+        """
+        self.quasistatic.initialize()
+        self.dynamic.initialize()
+
+    def printForecast(self):
+        """Print forecast for both segment problems.
+        """
+        self.quasistatic.printForecast()
+        self.dynamic.printForecast()
+
+    def run(self, app):
+        """Run the earthquake cycles, alternating quasistatic and dynamic segments.
+        """
+        from pylith.mpi.Communicator import mpi_is_root
+        isRoot = mpi_is_root()
+
+        tStart = self.quasistatic.startTime.value
+        tEvent = self.quasistatic.endTime.value
+        eventDuration = self.eventDuration.value
+        period = (tEvent - tStart) + eventDuration
+
+        for cycle in range(self.numCycles):
+            shift = cycle * period
+            if isRoot:
+                self._info.log("Running quasistatic segment of cycle %d." % (cycle + 1))
+            if cycle > 0:
+                self.quasistatic.transferStateFrom(self.dynamic)
+            self.quasistatic.runSegment(tStart + shift, tEvent + shift)
+
+            if isRoot:
+                self._info.log("Running dynamic segment of cycle %d." % (cycle + 1))
+            self.dynamic.transferStateFrom(self.quasistatic)
+            self.dynamic.runSegment(tEvent + shift, tEvent + shift + eventDuration)
+
+    def finalize(self):
+        """Cleanup after running problem.
+        """
+        self.quasistatic.finalize()
+        self.dynamic.finalize()
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def problem():
+    """Factory associated with EarthquakeCycle.
+    """
+    return EarthquakeCycle()
+
+
+# End of file
@@ -76,6 +76,19 @@ class GreensFns(Problem, ModuleGreensFns):
     faultLabelValue = pythia.pyre.inventory.int("label_value", default=1)
     faultLabelValue.meta['tip'] = "Value of label identifier for fault surface on which to impose impulses."
 
+    impulseBatchSize = pythia.pyre.inventory.int("impulse_batch_size", default=1, validator=pythia.pyre.inventory.greaterEqual(1))
+    impulseBatchSize.meta['tip'] = "Number of impulses solved together as multiple right-hand sides (1 solves impulses one at a time)."
+
+    from pylith.utils.NullComponent import NullComponent
+    stations = pythia.pyre.inventory.facility("stations", family="points_list", factory=NullComponent)
+    stations.meta['tip'] = "Reader for station locations; if given, compute the fault-to-station operator (by reciprocity, or assembled from forward responses when operator_filename is given)."
+
+    reciprocityFilename = pythia.pyre.inventory.str("reciprocity_filename", default="output/greensfns_stations.h5")
+    reciprocityFilename.meta['tip'] = "Name of HDF5 file for fault-to-station operator computed by reciprocity."
+
+    operatorFilename = pythia.pyre.inventory.str("operator_filename", default="")
+    operatorFilename.meta['tip'] = "Name of HDF5 file for fault-to-station operator assembled directly from forward impulse responses; if given with stations, forward solves fill the operator instead of using reciprocity."
+
     from .ProgressMonitorStep import ProgressMonitorStep
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorStep)
@@ -99,6 +112,31 @@ class GreensFns(Problem, ModuleGreensFns):
 
         ModuleGreensFns.setFaultLabelName(self, self.faultLabelName)
         ModuleGreensFns.setFaultLabelValue(self, self.faultLabelValue)
+        ModuleGreensFns.setImpulseBatchSize(self, self.impulseBatchSize)
+
+        from pylith.utils.NullComponent import NullComponent
+        if not isinstance(self.stations, NullComponent):
+            stationNames, stationCoords = self.stations.read()
+
+            # Convert to mesh coordinate system and nondimensionalize.
+            from spatialdata.geocoords.Converter import convert
+            convert(stationCoords, mesh.getCoordSys(), self.stations.coordsys)
+            stationCoords /= self.normalizer.lengthScale.value
+
+            ModuleGreensFns.setStations(self, stationCoords, stationNames)
+
+            import os
+            from pylith.mpi.Communicator import mpi_is_root
+            if self.operatorFilename:
+                relpath = os.path.dirname(self.operatorFilename)
+                if relpath and not os.path.exists(relpath) and mpi_is_root():
+                    os.makedirs(relpath)
+                ModuleGreensFns.setOperatorFilename(self, self.operatorFilename)
+            else:
+                relpath = os.path.dirname(self.reciprocityFilename)
+                if relpath and not os.path.exists(relpath) and mpi_is_root():
+                    os.makedirs(relpath)
+                ModuleGreensFns.setReciprocityFilename(self, self.reciprocityFilename)
 
         self.progressMonitor.preinitialize()
         ModuleGreensFns.setProgressMonitor(self, self.progressMonitor)
@@ -0,0 +1,103 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from pylith.problems.InitialCondition import InitialCondition
+from .problems import InitialConditionCheckpoint as ModuleInitialCondition
+
+
+def validateFilename(value):
+    """Validate filename of HDF5 checkpoint file.
+    """
+    if not value:
+        raise ValueError("Filename of HDF5 checkpoint file not specified.")
+    return value
+
+
+class InitialConditionCheckpoint(InitialCondition, ModuleInitialCondition):
+    """
+    Initial conditions from a checkpoint of another simulation, interpolating the checkpoint
+    solution between meshes (e.g., warm starting from the converged state of a simulation on a
+    coarser mesh).
+
+    The mesh of the checkpointed simulation must be imported with the same number of processes
+    and the same mesh importer settings as in the checkpointed simulation, so the ordering of
+    the checkpoint solution vector matches; the checkpointed simulation must not include faults.
+
+    Implements `InitialCondition`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            # Warm start from the checkpoint of a simulation on a coarser mesh.
+            [pylithapp.problem]
+            ic = [checkpoint]
+            ic.checkpoint = pylith.problems.InitialConditionCheckpoint
+
+            [pylithapp.problem.ic.checkpoint]
+            checkpoint_filename = output/coarse-checkpoint.h5
+            subfields = [displacement]
+
+            mesher.reader = pylith.meshio.MeshIOCubit
+            mesher.reader.filename = mesh_coarse.exo
+            mesher.reader.coordsys.space_dim = 3
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    checkpointFilename = pythia.pyre.inventory.str("checkpoint_filename", default="", validator=validateFilename)
+    checkpointFilename.meta["tip"] = "Name of HDF5 checkpoint file with solution of checkpointed simulation."
+
+    from pylith.topology.MeshImporter import MeshImporter
+    mesher = pythia.pyre.inventory.facility("mesher", family="mesh_generator", factory=MeshImporter)
+    mesher.meta["tip"] = "Importer for mesh of checkpointed simulation; settings must match the checkpointed simulation."
+
+    def __init__(self, name="initialconditioncheckpoint"):
+        """Constructor.
+        """
+        InitialCondition.__init__(self, name)
+
+    def preinitialize(self, problem):
+        """Setup initial conditions.
+        """
+        InitialCondition.preinitialize(self, problem)
+
+        ModuleInitialCondition.setCheckpointFilename(self, self.checkpointFilename)
+
+        # Import the mesh of the checkpointed simulation; keep a reference so the mesh outlives
+        # preinitialization.
+        self.mesher.preinitialize(problem)
+        self.checkpointMesh = self.mesher.create(problem)
+        ModuleInitialCondition.setMesh(self, self.checkpointMesh)
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        InitialCondition._configure(self)
+
+    def _createModuleObj(self):
+        """Call constructor for module object for access to C++ object.
+        """
+        ModuleInitialCondition.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def initial_conditions():
+    """Factory associated with InitialConditionCheckpoint.
+    """
+    return InitialConditionCheckpoint()
+
+
+# End of file
@@ -55,6 +55,10 @@ class Physics(PetscComponent, ModulePhysics):
         "observers", itemFactory=observerFactory, factory=SinglePhysicsObserver)
     observers.meta['tip'] = "Observers (e.g., output)."
 
+    stepCadence = pythia.pyre.inventory.int("step_cadence", default=1,
+                                            validator=pythia.pyre.inventory.greaterEqual(1))
+    stepCadence.meta['tip'] = "Number of global time steps between updates of the residual contribution (> 1 lags the contribution for operator splitting)."
+
     def __init__(self, name="physics", facility="physics"):
         """Constructor.
         """
@@ -67,6 +71,7 @@ class Physics(PetscComponent, ModulePhysics):
         identifier = self.aliases[-1]
         ModulePhysics.setIdentifier(self, identifier)
         ModulePhysics.setNormalizer(self, problem.normalizer)
+        ModulePhysics.setStepCadence(self, self.stepCadence)
 
         if not isinstance(self.auxiliaryFieldDB, NullComponent):
             ModulePhysics.setAuxiliaryFieldDB(self, self.auxiliaryFieldDB)
@@ -81,6 +81,15 @@ class Problem(PetscComponent, ModuleProblem):
     petscDefaults = pythia.pyre.inventory.facility("petsc_defaults", family="petsc_defaults", factory=PetscDefaults)
     petscDefaults.meta['tip'] = "Flags controlling which default PETSc options to use."
 
+    prefetchDatabases = pythia.pyre.inventory.bool("prefetch_databases", default=False)
+    prefetchDatabases.meta['tip'] = "Open and index auxiliary field spatial databases on background threads during startup."
+
+    deterministicReductions = pythia.pyre.inventory.bool("deterministic_reductions", default=False)
+    deterministicReductions.meta['tip'] = "Combine parallel reductions in a fixed order for bitwise run-to-run reproducibility at a modest cost in communication."
+
+    autotuneKernels = pythia.pyre.inventory.bool("autotune_kernels", default=False)
+    autotuneKernels.meta['tip'] = "Benchmark semantically equivalent kernel variants for each material at initialization and select the fastest."
+
     from .Solution import Solution
     solution = pythia.pyre.inventory.facility("solution", family="solution", factory=Solution)
     solution.meta['tip'] = "Solution field for problem."
@@ -141,6 +150,9 @@ class Problem(PetscComponent, ModuleProblem):
         else:
             raise ValueError("Unknown solver choice '%s'." % self.solverChoice)
         ModuleProblem.setPetscDefaults(self, self.petscDefaults.flags());
+        ModuleProblem.setPrefetchDatabases(self, self.prefetchDatabases)
+        ModuleProblem.setDeterministicReductions(self, self.deterministicReductions)
+        ModuleProblem.setAutotuneKernels(self, self.autotuneKernels)
         ModuleProblem.setNormalizer(self, self.normalizer)
         if not isinstance(self.gravityField, NullComponent):
             ModuleProblem.setGravityField(self, self.gravityField)
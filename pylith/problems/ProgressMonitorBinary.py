@@ -0,0 +1,55 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .ProgressMonitor import ProgressMonitor
+from .problems import ProgressMonitorBinary as ModuleProgressMonitorBinary
+
+
+class ProgressMonitorBinary(ProgressMonitor, ModuleProgressMonitorBinary):
+    """
+    Progress monitor writing a fixed-size binary status record (step, time, time step,
+    percent complete, wall time, solver iterations) to a memory-mapped file that external
+    tools can read while the simulation runs.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.timedependent]
+            progress_monitor = pylith.problems.ProgressMonitorBinary
+
+            [pylithapp.timedependent.progress_monitor]
+            filename = output/step01-progress.bin
+        """
+    }
+
+    def __init__(self, name="progressmonitorbinary"):
+        """Constructor.
+        """
+        ProgressMonitor.__init__(self, name)
+
+    def _createModuleObj(self):
+        """Create handle to corresponding C++ object.
+        """
+        ModuleProgressMonitorBinary.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def progress_monitor():
+    """Factory associated with ProgressMonitorBinary.
+    """
+    return ProgressMonitorBinary()
+
+
+# End of file
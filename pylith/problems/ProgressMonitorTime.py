@@ -34,6 +34,9 @@ class ProgressMonitorTime(ProgressMonitor, ModuleProgressMonitorTime):
     tUnits = pythia.pyre.inventory.str("t_units", default="year")
     tUnits.meta['tip'] = "Units used for simulation time in output."
 
+    showBudget = pythia.pyre.inventory.bool("show_budget", default=False)
+    showBudget.meta['tip'] = "Write one line per time step with the time spent in assembly, solve, state update, and output along with the solver iteration counts."
+
     def __init__(self, name="progressmonitortime"):
         """Constructor.
         """
@@ -44,6 +47,7 @@ class ProgressMonitorTime(ProgressMonitor, ModuleProgressMonitorTime):
         """
         ProgressMonitor.preinitialize(self)
         ModuleProgressMonitorTime.setTimeUnit(self, self.tUnits)
+        ModuleProgressMonitorTime.setShowBudget(self, self.showBudget)
 
     def _createModuleObj(self):
         """Create handle to corresponding C++ object.
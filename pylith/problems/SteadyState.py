@@ -0,0 +1,111 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/problems/SteadyState.py
+#
+# @brief Python class for steady-state problem solved with pseudo-transient continuation.
+#
+# Factory: problem.
+
+from .Problem import Problem
+from .problems import SteadyState as ModuleSteadyState
+
+
+class SteadyState(Problem, ModuleSteadyState):
+    """
+    Steady-state problem type that jumps directly to the steady-state solution using PETSc
+    pseudo-transient continuation (e.g., interseismic spin-up of earthquake-cycle models)
+    instead of time stepping many relaxation times.
+
+    Implements `Problem`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp]
+            problem = pylith.problems.SteadyState
+
+            [pylithapp.steadystate]
+            initial_dt = 10.0*year
+            max_pseudo_timesteps = 200
+
+            # Set appropriate default solver settings.
+            set_solver_defaults = True
+        """
+    }
+
+    import pythia.pyre.inventory
+    from pythia.pyre.units.time import year
+
+    dtInitial = pythia.pyre.inventory.dimensional("initial_dt", default=10.0 * year,
+                                                  validator=pythia.pyre.inventory.greater(0.0 * year))
+    dtInitial.meta['tip'] = "Initial pseudo-time step."
+
+    maxPseudoTimeSteps = pythia.pyre.inventory.int("max_pseudo_timesteps", default=100,
+                                                   validator=pythia.pyre.inventory.greaterEqual(1))
+    maxPseudoTimeSteps.meta['tip'] = "Maximum number of pseudo-time steps."
+
+    dtIncrement = pythia.pyre.inventory.float("dt_increment", default=1.1,
+                                              validator=pythia.pyre.inventory.greater(1.0))
+    dtIncrement.meta['tip'] = "Factor by which the pseudo-time step grows as the residual decreases."
+
+    def __init__(self, name="steadystate"):
+        """Constructor.
+        """
+        Problem.__init__(self, name)
+
+    def preinitialize(self, mesh):
+        """Setup integrators for each element family (material/quadrature,
+        bc/quadrature, etc.).
+        """
+        self._setupLogging()
+
+        import weakref
+        self.mesh = weakref.ref(mesh)
+
+        Problem.preinitialize(self, mesh)
+
+        ModuleSteadyState.setInitialTimeStep(self, self.dtInitial.value)
+        ModuleSteadyState.setMaxPseudoTimeSteps(self, self.maxPseudoTimeSteps)
+        ModuleSteadyState.setTimeStepIncrement(self, self.dtIncrement)
+
+    def run(self, app):
+        """Solve steady-state problem.
+        """
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log("Solving problem.")
+
+        ModuleSteadyState.solve(self)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        Problem._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleSteadyState.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def problem():
+    """Factory associated with SteadyState.
+    """
+    return SteadyState()
+
+
+# End of file
@@ -88,12 +88,80 @@ class TimeDependent(Problem, ModuleTimeDependent):
     maxTimeSteps = pythia.pyre.inventory.int("max_timesteps", default=20000, validator=pythia.pyre.inventory.greater(0))
     maxTimeSteps.meta['tip'] = "Maximum number of time steps."
 
+    adaptiveTimeStep = pythia.pyre.inventory.bool("adaptive_time_step", default=False)
+    adaptiveTimeStep.meta['tip'] = "Adapt time step from rate of solution change (grow during quiescent periods, shrink during rapid slip)."
+
+    minTimeStep = pythia.pyre.inventory.dimensional("min_dt", default=0.0 * year,
+                                                    validator=pythia.pyre.inventory.greaterEqual(0.0 * year))
+    minTimeStep.meta['tip'] = "Minimum time step for adaptive time stepping (0 means no minimum)."
+
+    maxTimeStep = pythia.pyre.inventory.dimensional("max_dt", default=0.0 * year,
+                                                    validator=pythia.pyre.inventory.greaterEqual(0.0 * year))
+    maxTimeStep.meta['tip'] = "Maximum time step for adaptive time stepping (0 means no maximum)."
+
+    adaptTolerance = pythia.pyre.inventory.float("adapt_tolerance", default=0.01,
+                                                 validator=pythia.pyre.inventory.greater(0.0))
+    adaptTolerance.meta['tip'] = "Target relative change in solution per time step for adaptive time stepping."
+
+    adaptGrowthFactor = pythia.pyre.inventory.float("adapt_growth_factor", default=2.0,
+                                                    validator=pythia.pyre.inventory.greater(1.0))
+    adaptGrowthFactor.meta['tip'] = "Maximum factor by which the time step can grow in one step."
+
+    relaxationFastForward = pythia.pyre.inventory.bool("relaxation_fast_forward", default=False)
+    relaxationFastForward.meta['tip'] = "Let the time step grow up to the inferred relaxation time in one jump during linear viscoelastic relaxation (requires adaptive time stepping and linear bulk rheologies)."
+
+    jacobianLag = pythia.pyre.inventory.int("jacobian_lag", default=1,
+                                            validator=pythia.pyre.inventory.greaterEqual(1))
+    jacobianLag.meta['tip'] = "Rebuild LHS Jacobian every N rebuild requests, reusing the stale Jacobian in between (nonlinear problems only)."
+
+    precondFreezeFactor = pythia.pyre.inventory.float("precond_freeze_factor", default=0.0)
+    precondFreezeFactor.meta['tip'] = "Keep the preconditioner setup while the Jacobian is reassembled each step, rebuilding it when the linear iterations for a step exceed this factor times the count after the last rebuild (0 disables freezing)."
+
+    initialGuessOrder = pythia.pyre.inventory.int("initial_guess_order", default=0,
+                                                  validator=pythia.pyre.inventory.greaterEqual(0))
+    initialGuessOrder.meta['tip'] = "Order of extrapolation from solution history for nonlinear solver initial guess (0 means use previous solution)."
+
     ic = pythia.pyre.inventory.facilityArray("ic", itemFactory=icFactory, factory=EmptyBin)
     ic.meta['tip'] = "Initial conditions."
 
     shouldNotifyIC = pythia.pyre.inventory.bool("notify_observers_ic", default=False)
     shouldNotifyIC.meta["tip"] = "Notify observers of solution with initial conditions."
 
+    matrixFreeJacobian = pythia.pyre.inventory.bool("matrix_free_jacobian", default=False)
+    matrixFreeJacobian.meta["tip"] = "Apply LHS Jacobian matrix free; assemble only the preconditioning matrix."
+
+    explicitFastPath = pythia.pyre.inventory.bool("explicit_fast_path", default=False)
+    explicitFastPath.meta["tip"] = "Advance dynamic simulations with a fused forward Euler update instead of the generic PETSc TS machinery."
+
+    subcycleLabelValues = pythia.pyre.inventory.list("subcycle_label_values", default=[])
+    subcycleLabelValues.meta["tip"] = "Label values of materials advanced with the time step divided by the subcycle factor (explicit fast path only)."
+
+    subcycleFactor = pythia.pyre.inventory.int("subcycle_factor", default=1,
+                                               validator=pythia.pyre.inventory.greaterEqual(1))
+    subcycleFactor.meta["tip"] = "Number of substeps per global time step for subcycled materials (1 disables subcycling)."
+
+    compactPrecondStorage = pythia.pyre.inventory.bool("compact_precond_storage", default=False)
+    compactPrecondStorage.meta["tip"] = "Store the preconditioning matrix in compact symmetric format (requires matrix_free_jacobian and a symmetric Jacobian)."
+
+    solverRecovery = pythia.pyre.inventory.bool("solver_recovery", default=False)
+    solverRecovery.meta["tip"] = "On solver failure, roll back to the last accepted step, halve the time step, and retry with escalating solver robustness instead of aborting."
+
+    checkpointFilename = pythia.pyre.inventory.str("checkpoint_filename", default="checkpoint.h5")
+    checkpointFilename.meta['tip'] = "Name of HDF5 file for checkpoints."
+
+    checkpointInterval = pythia.pyre.inventory.int("checkpoint_interval", default=0,
+                                                   validator=pythia.pyre.inventory.greaterEqual(0))
+    checkpointInterval.meta['tip'] = "Number of time steps between checkpoints (0 disables checkpointing)."
+
+    restartFilename = pythia.pyre.inventory.str("restart_filename", default="")
+    restartFilename.meta['tip'] = "Name of HDF5 checkpoint file to restart from (empty string means no restart)."
+
+    solverTelemetryFilename = pythia.pyre.inventory.str("solver_telemetry_filename", default="")
+    solverTelemetryFilename.meta['tip'] = "Name of HDF5 file for per-integrator solver convergence telemetry (empty string disables telemetry)."
+
+    profileFilename = pythia.pyre.inventory.str("profile_filename", default="")
+    profileFilename.meta['tip'] = "Name of JSON file for hierarchical performance profile with per-integrator attribution (empty string disables profiling)."
+
     from .ProgressMonitorTime import ProgressMonitorTime
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorTime)
@@ -120,6 +188,29 @@ class TimeDependent(Problem, ModuleTimeDependent):
         ModuleTimeDependent.setInitialTimeStep(self, self.dtInitial.value)
         ModuleTimeDependent.setMaxTimeSteps(self, self.maxTimeSteps)
         ModuleTimeDependent.setShouldNotifyIC(self, self.shouldNotifyIC)
+        ModuleTimeDependent.setMatrixFreeJacobian(self, self.matrixFreeJacobian)
+        ModuleTimeDependent.setExplicitFastPath(self, self.explicitFastPath)
+        if self.subcycleLabelValues:
+            import numpy
+            subcycleLabelValues = numpy.array([int(value) for value in self.subcycleLabelValues], dtype=numpy.intc)
+            ModuleTimeDependent.setSubcycleLabelValues(self, subcycleLabelValues)
+        ModuleTimeDependent.setSubcycleFactor(self, self.subcycleFactor)
+        ModuleTimeDependent.setCompactPrecondStorage(self, self.compactPrecondStorage)
+        ModuleTimeDependent.setSolverRecovery(self, self.solverRecovery)
+        ModuleTimeDependent.setCheckpointFilename(self, self.checkpointFilename)
+        ModuleTimeDependent.setCheckpointInterval(self, self.checkpointInterval)
+        ModuleTimeDependent.setRestartFilename(self, self.restartFilename)
+        ModuleTimeDependent.setSolverTelemetryFilename(self, self.solverTelemetryFilename)
+        ModuleTimeDependent.setProfileFilename(self, self.profileFilename)
+        ModuleTimeDependent.setAdaptiveTimeStep(self, self.adaptiveTimeStep)
+        ModuleTimeDependent.setMinTimeStep(self, self.minTimeStep.value)
+        ModuleTimeDependent.setMaxTimeStep(self, self.maxTimeStep.value)
+        ModuleTimeDependent.setAdaptTolerance(self, self.adaptTolerance)
+        ModuleTimeDependent.setAdaptGrowthFactor(self, self.adaptGrowthFactor)
+        ModuleTimeDependent.setRelaxationFastForward(self, self.relaxationFastForward)
+        ModuleTimeDependent.setLHSJacobianLag(self, self.jacobianLag)
+        ModuleTimeDependent.setPrecondFreezeFactor(self, self.precondFreezeFactor)
+        ModuleTimeDependent.setInitialGuessOrder(self, self.initialGuessOrder)
 
         # Preinitialize initial conditions.
         for ic in self.ic.components():
@@ -138,6 +229,37 @@ class TimeDependent(Problem, ModuleTimeDependent):
 
         ModuleTimeDependent.solve(self)
 
+    def estimateSurfaceDisplacements(self, stations, t, poissonRatio=0.25):
+        """Estimate surface displacements at stations with the analytic half-space engine (3D only).
+
+        Sums Okada (1985) point-source contributions for the prescribed slip of all
+        kinematic fault interfaces, treating each fault cell as a point dislocation in a
+        homogeneous elastic half space. Intended for screening candidate rupture models
+        against the station set used for OutputSolnPoints without running the
+        finite-element solve. The problem must be initialized.
+
+        Args:
+            stations: Reader for station names and coordinates (same reader as OutputSolnPoints).
+            t: Time at which to evaluate the prescribed slip (with units).
+            poissonRatio: Poisson's ratio for the half space.
+        Returns:
+            Tuple of station names and array of station displacements [numStations, spaceDim].
+        """
+        import numpy
+        from spatialdata.geocoords.Converter import convert
+
+        stationNames, stationCoords = stations.read()
+        convert(stationCoords, self.mesh().getCoordSys(), stations.coordsys)
+        lengthScale = self.normalizer.lengthScale.value
+        timeScale = self.normalizer.timeScale.value
+        stationCoords = stationCoords / lengthScale
+
+        displacements = numpy.zeros(stationCoords.shape, dtype=numpy.float64)
+        ModuleTimeDependent.estimateSurfaceDisplacements(self, displacements.ravel(), stationCoords,
+                                                         t.value / timeScale, poissonRatio)
+        displacements *= lengthScale
+        return (stationNames, displacements)
+
     def _configure(self):
         """Set members based using inventory.
         """
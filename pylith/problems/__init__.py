@@ -21,7 +21,9 @@
 __all__ = [
     "Problem",
     "TimeDependent",
+    "EarthquakeCycle",
     "InitialCondition",
+    "InitialConditionCheckpoint",
     "InitialConditionDomain",
     "InitialConditionPatch",
     "Physics",
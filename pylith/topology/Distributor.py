@@ -37,6 +37,13 @@ class Distributor(PetscComponent, ModuleDistributor):
     writePartition = pythia.pyre.inventory.bool("write_partition", default=False)
     writePartition.meta['tip'] = "Write partition information to file."
 
+    weightCells = pythia.pyre.inventory.bool("weight_cells", default=False)
+    weightCells.meta['tip'] = "Weight cells by estimated assembly cost (bulk rheology, cohesive cells) when partitioning."
+
+    cohesiveCellWeight = pythia.pyre.inventory.int("cohesive_cell_weight", default=4,
+                                            validator=pythia.pyre.inventory.greater(0))
+    cohesiveCellWeight.meta['tip'] = "Weight (cost per cell) for cohesive cells when weighting cells in partitioning."
+
     from pylith.meshio.DataWriterHDF5 import DataWriterHDF5
     dataWriter = pythia.pyre.inventory.facility("data_writer", factory=DataWriterHDF5, family="data_writer")
     dataWriter.meta['tip'] = "Data writer for partition information."
@@ -63,6 +70,11 @@ class Distributor(PetscComponent, ModuleDistributor):
             partitionerName = "parmetis"
         else:
             partitionerName = self.partitioner
+        if self.weightCells:
+            materials = problem.materials.components()
+            materialValues = [material.labelValue for material in materials]
+            materialWeights = [self._materialWeight(material) for material in materials]
+            ModuleDistributor.setCellWeights(mesh, materialValues, materialWeights, self.cohesiveCellWeight)
         ModuleDistributor.distribute(newMesh, mesh, problem.interfaces.components(), partitionerName)
 
         mesh.cleanup()
@@ -79,6 +91,20 @@ class Distributor(PetscComponent, ModuleDistributor):
         """
         PetscComponent._configure(self)
 
+    def _materialWeight(self, material):
+        """Get relative cost of assembling a cell of a material, based on its bulk rheology.
+        """
+        weights = {
+            "IsotropicLinearElasticity": 1,
+            "IsotropicLinearIncompElasticity": 1,
+            "IsotropicLinearMaxwell": 2,
+            "IsotropicLinearGenMaxwell": 3,
+            "IsotropicLinearPoroelasticity": 2,
+            "IsotropicPowerLaw": 4,
+        }
+        rheology = getattr(material, "rheology", None)
+        return weights.get(type(rheology).__name__, 1) if rheology else 1
+
     def _setupLogging(self):
         """Setup event logging.
         """
@@ -43,8 +43,11 @@ class MeshGenerator(PetscComponent):
         """
         PetscComponent._configure(self)
 
-    def _adjustTopology(self, mesh, interfaces, problem):
+    def _adjustTopology(self, mesh, interfaces, problem, adjustMesh=True):
         """Adjust topology for interface implementation.
+
+        If adjustMesh is False, only do pre-initialization setup of the interfaces
+        (the mesh already contains the cohesive cells, e.g., loaded from a topology cache).
         """
         logEvent = "%sadjTopo" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
@@ -61,7 +64,8 @@ class MeshGenerator(PetscComponent):
                     self._info.log("Adjusting topology for fault '%s'." % interface.labelName)
                 interface.preinitialize(problem)
                 interface.setCohesiveLabelValue(cohesiveLabelValue)
-                interface.adjustTopology(mesh)
+                if adjustMesh:
+                    interface.adjustTopology(mesh)
                 cohesiveLabelValue += 1
 
         self._eventLogger.eventEnd(logEvent)
@@ -37,9 +37,15 @@ class MeshImporter(MeshGenerator):
     reorderMesh = pythia.pyre.inventory.bool("reorder_mesh", default=True)
     reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
 
+    reorderCellsLocality = pythia.pyre.inventory.bool("reorder_cells_locality", default=False)
+    reorderCellsLocality.meta['tip'] = "Reorder cells along a space-filling curve for cache locality (after reverse Cuthill-McKee if both are enabled)."
+
     checkTopology = pythia.pyre.inventory.bool("check_topology", default=True)
     checkTopology.meta['tip'] = "Check topology of imported mesh."
 
+    readOnlyReferencedGroups = pythia.pyre.inventory.bool("read_only_referenced_groups", default=False)
+    readOnlyReferencedGroups.meta['tip'] = "Read only the mesh groups (nodesets) referenced by the problem's boundary conditions, faults, and observers (useful for master meshes carrying nodesets for many studies)."
+
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
     reader.meta['tip'] = "Reader for mesh files."
@@ -52,6 +58,12 @@ class MeshImporter(MeshGenerator):
     refiner = pythia.pyre.inventory.facility("refiner", family="mesh_refiner", factory=MeshRefiner)
     refiner.meta['tip'] = "Performs uniform global mesh refinement after distribution among processes (default is no refinement)."
 
+    writeStatistics = pythia.pyre.inventory.bool("write_statistics", default=False)
+    writeStatistics.meta['tip'] = "Log mesh statistics (cell quality, partition balance, estimated memory use) after distribution and refinement."
+
+    topologyCacheDir = pythia.pyre.inventory.str("topology_cache_dir", default="")
+    topologyCacheDir.meta['tip'] = "Directory for caching mesh topology with cohesive cells; cache files are keyed by a hash of the mesh file and fault labels (default is no caching)."
+
     def __init__(self, name="meshimporter"):
         """Constructor.
         """
@@ -78,26 +90,57 @@ class MeshImporter(MeshGenerator):
         logEvent = "%screate" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
 
-        # Read mesh
-        mesh = self.reader.read(self.checkTopology)
-
-        # Reorder mesh
-        if self.reorderMesh:
-            logEvent2 = "%sreorder" % self._loggingPrefix
-            self._eventLogger.eventBegin(logEvent2)
+        cachePath = self._topologyCachePath(faults) if self.topologyCacheDir else None
+        import os
+        if cachePath and os.path.isfile(cachePath):
+            # Load mesh with cohesive cells from topology cache, skipping mesh surgery.
+            if isRoot:
+                self._info.log("Loading mesh topology from cache '%s'." % cachePath)
+            from pylith.mpi.Communicator import petsc_comm_world
+            from pylith.topology.Mesh import Mesh
+            from pylith.topology.topology import MeshOps_loadTopologyCache
+            mesh = Mesh(dim=self.reader.coordsys.getSpaceDim(), comm=petsc_comm_world())
+            mesh.setCoordSys(self.reader.coordsys)
+            MeshOps_loadTopologyCache(mesh, cachePath)
+            self._adjustTopology(mesh, faults, problem, adjustMesh=False)
+        else:
+            # Read mesh
+            if self.readOnlyReferencedGroups:
+                groupNames = self._referencedGroups(problem, faults)
+                if isRoot:
+                    self._info.log("Limiting mesh groups read to those referenced by the problem: %s." % ", ".join(groupNames))
+                self.reader.setGroupFilter(groupNames)
+            mesh = self.reader.read(self.checkTopology)
+
+            # Reorder mesh
+            if self.reorderMesh or self.reorderCellsLocality:
+                logEvent2 = "%sreorder" % self._loggingPrefix
+                self._eventLogger.eventBegin(logEvent2)
+                self._debug.log(resourceUsageString())
+                from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+                ordering = ReverseCuthillMcKee()
+                if self.reorderMesh:
+                    if isRoot:
+                        self._info.log("Reordering cells and vertices.")
+                    ordering.reorder(mesh)
+                if self.reorderCellsLocality:
+                    if isRoot:
+                        self._info.log("Reordering cells for cache locality.")
+                    ordering.reorderCellsLocality(mesh)
+                self._eventLogger.eventEnd(logEvent2)
+
+            # Adjust topology
             self._debug.log(resourceUsageString())
             if isRoot:
-                self._info.log("Reordering cells and vertices.")
-            from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-            ordering = ReverseCuthillMcKee()
-            ordering.reorder(mesh)
-            self._eventLogger.eventEnd(logEvent2)
-
-        # Adjust topology
-        self._debug.log(resourceUsageString())
-        if isRoot:
-            self._info.log("Adjusting topology.")
-        self._adjustTopology(mesh, faults, problem)
+                self._info.log("Adjusting topology.")
+            self._adjustTopology(mesh, faults, problem)
+
+            if cachePath:
+                if isRoot:
+                    self._info.log("Saving mesh topology to cache '%s'." % cachePath)
+                from pylith.topology.topology import MeshOps_saveTopologyCache
+                os.makedirs(self.topologyCacheDir, exist_ok=True)
+                MeshOps_saveTopologyCache(mesh, cachePath)
 
         # Distribute mesh
         from pylith.mpi.Communicator import mpi_comm_world
@@ -117,6 +160,12 @@ class MeshImporter(MeshGenerator):
         # Can't reorder mesh again, because we do not have routine to
         # unmix normal and hybrid cells.
 
+        if self.writeStatistics:
+            if isRoot:
+                self._info.log("Computing mesh statistics.")
+            from pylith.topology.topology import MeshOps_writeStatistics
+            MeshOps_writeStatistics(newMesh)
+
         # Nondimensionalize mesh (coordinates of vertices).
         from pylith.topology.topology import MeshOps_nondimensionalize
         MeshOps_nondimensionalize(newMesh, problem.normalizer)
@@ -129,6 +178,43 @@ class MeshImporter(MeshGenerator):
         """
         MeshGenerator._configure(self)
 
+    def _referencedGroups(self, problem, faults):
+        """Collect names of mesh groups (nodesets) referenced by the problem's components.
+        """
+        groupNames = set()
+        for bc in problem.bc.components():
+            groupNames.add(bc.labelName)
+        for interface in problem.interfaces.components():
+            groupNames.add(interface.labelName)
+            if interface.edgeName:
+                groupNames.add(interface.edgeName)
+        if faults:
+            for fault in faults:
+                groupNames.add(fault.labelName)
+                if fault.edgeName:
+                    groupNames.add(fault.edgeName)
+        for observer in problem.observers.components():
+            if hasattr(observer, "labelName"):
+                groupNames.add(observer.labelName)
+        return sorted(groupNames)
+
+    def _topologyCachePath(self, faults):
+        """Generate path of topology cache file from hash of mesh file and fault labels.
+        """
+        import hashlib
+        import os
+        fingerprint = hashlib.sha256()
+        with open(self.reader.filename, "rb") as fin:
+            for chunk in iter(lambda: fin.read(65536), b""):
+                fingerprint.update(chunk)
+        fingerprint.update(repr(self.reorderMesh).encode())
+        fingerprint.update(repr(self.reorderCellsLocality).encode())
+        if faults:
+            for fault in faults:
+                fingerprint.update(
+                    f"{fault.labelName}:{fault.labelValue}:{fault.edgeName}:{fault.edgeValue}".encode())
+        return os.path.join(self.topologyCacheDir, f"topology_{fingerprint.hexdigest()[:16]}.h5")
+
     def _setupLogging(self):
         """Setup event logging.
         """
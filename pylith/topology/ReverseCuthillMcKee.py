@@ -31,5 +31,10 @@ class ReverseCuthillMcKee(ModuleReverseCuthillMcKee):
         """
         ModuleReverseCuthillMcKee.reorder(mesh)
 
+    def reorderCellsLocality(self, mesh):
+        """Reorder cells along a space-filling curve for cache locality.
+        """
+        ModuleReverseCuthillMcKee.reorderCellsLocality(mesh)
+
 
 # End of file
@@ -0,0 +1,90 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+import pythia.pyre.inventory
+
+from spatialdata.spatialdb.SpatialDBObj import SpatialDBObj
+from .utils import AnalyticDB as ModuleAnalyticDB
+
+
+class AnalyticDB(SpatialDBObj, ModuleAnalyticDB):
+    """
+    Spatial database of values given by analytic expressions of the spatial coordinates
+    x, y, and z. The expressions are compiled when the database is opened and evaluated at
+    native speed per query, so analytic property distributions (e.g., depth-dependent moduli)
+    do not pay the cost of a gridded database or the Python layer.
+
+    Implements `SpatialDB`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            # Elastic properties with a linear gradient in Vs and Vp down to 5 km depth.
+            [pylithapp.problem.materials.crust]
+            db_auxiliary_field = pylith.utils.AnalyticDB
+            db_auxiliary_field.description = Depth-dependent elastic properties
+            db_auxiliary_field.values = [density, vs, vp]
+            db_auxiliary_field.units = [kg/m**3, m/s, m/s]
+            db_auxiliary_field.expressions = [2500.0, 3000.0-0.2*z, 5200.0-0.35*z]
+            db_auxiliary_field.coordsys.space_dim = 3
+            """,
+    }
+
+    dbValues = pythia.pyre.inventory.list("values", default=[])
+    dbValues.meta['tip'] = "Names of values in spatial database."
+
+    dbUnits = pythia.pyre.inventory.list("units", default=[])
+    dbUnits.meta['tip'] = "Units for values in spatial database ('none' for dimensionless values)."
+
+    dbExpressions = pythia.pyre.inventory.list("expressions", default=[])
+    dbExpressions.meta['tip'] = "Expressions for values in spatial database in terms of x, y, and z."
+
+    from spatialdata.geocoords.CSCart import CSCart
+    cs = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
+    cs.meta['tip'] = "Coordinate system associated with expressions."
+
+    def __init__(self, name="analyticdb"):
+        """Constructor.
+        """
+        SpatialDBObj.__init__(self, name)
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        SpatialDBObj._configure(self)
+
+        if len(self.dbValues) != len(self.dbUnits) or len(self.dbValues) != len(self.dbExpressions):
+            raise ValueError(
+                f"Lengths of 'values' ({len(self.dbValues)}), 'units' ({len(self.dbUnits)}), and "
+                f"'expressions' ({len(self.dbExpressions)}) for analytic spatial database "
+                f"'{self.description}' must be equal.")
+
+        ModuleAnalyticDB.setCoordSys(self, self.cs)
+        ModuleAnalyticDB.setData(self, self.dbValues, self.dbUnits, self.dbExpressions)
+
+    def _createModuleObj(self):
+        """Create handle to corresponding C++ object.
+        """
+        ModuleAnalyticDB.__init__(self)
+
+
+# Factories
+
+def spatial_database():
+    """Factory associated with AnalyticDB.
+    """
+    return AnalyticDB()
+
+
+# End of file
@@ -0,0 +1,77 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+import pythia.pyre.inventory
+
+from spatialdata.spatialdb.SpatialDBObj import SpatialDBObj
+from .utils import MMapGridDB as ModuleMMapGridDB
+
+
+class MMapGridDB(SpatialDBObj, ModuleMMapGridDB):
+    """
+    Read-only gridded spatial database backed by a memory-mapped binary file. All processes on a
+    node share the page-cache-backed pages of the grid file instead of each holding a copy of the
+    grid, so large velocity models cost one copy of resident memory per node rather than one per
+    process.
+
+    Use the `pylith_convert_griddb` utility to convert a SimpleGridDB ASCII file to the binary
+    grid file. Converting with `--value-dtype=float32` quantizes the values to single precision,
+    halving the grid storage and the memory bandwidth of queries.
+
+    Implements `SpatialDB`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            # Elastic properties from a large gridded velocity model shared by all ranks on a node.
+            [pylithapp.problem.materials.crust]
+            db_auxiliary_field = pylith.utils.MMapGridDB
+            db_auxiliary_field.description = Gridded velocity model
+            db_auxiliary_field.filename = velocity_model.griddb
+            """,
+    }
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Filename of binary grid file (generated with pylith_convert_griddb)."
+
+    def __init__(self, name="mmapgriddb"):
+        """Constructor.
+        """
+        SpatialDBObj.__init__(self, name)
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        SpatialDBObj._configure(self)
+
+        if 0 == len(self.filename):
+            raise ValueError(
+                f"No filename given for memory-mapped gridded spatial database '{self.description}'.")
+        ModuleMMapGridDB.setFilename(self, self.filename)
+
+    def _createModuleObj(self):
+        """Create handle to corresponding C++ object.
+        """
+        ModuleMMapGridDB.__init__(self)
+
+
+# Factories
+
+def spatial_database():
+    """Factory associated with MMapGridDB.
+    """
+    return MMapGridDB()
+
+
+# End of file
@@ -49,6 +49,18 @@ class PetscDefaults(Component):
     testing = pythia.pyre.inventory.bool("testing", default=False)
     testing.meta["tip"] = "Use default PETSc testing options."
 
+    gpu = pythia.pyre.inventory.bool("gpu", default=False)
+    gpu.meta["tip"] = "Use device (GPU) vectors and matrices for assembly and solve."
+
+    faultSchur = pythia.pyre.inventory.bool("fault_schur", default=False)
+    faultSchur.meta["tip"] = "Use exact Schur complement elimination of the fault Lagrange multipliers."
+
+    multigrid = pythia.pyre.inventory.bool("multigrid", default=False)
+    multigrid.meta["tip"] = "Use algebraic multigrid tuned for elasticity (rigid-body near-null space, aggregation thresholds for crustal meshes)."
+
+    optionsFilename = pythia.pyre.inventory.str("options_filename", default="")
+    optionsFilename.meta["tip"] = "Filename for dump of effective PETSc options with provenance (defaults applied, defaults overridden by user options, complete options database); default is no dump."
+
     def __init__(self, name="petscdefaults"):
         """Constructor.
         """
@@ -56,6 +68,7 @@ class PetscDefaults(Component):
 
     def flags(self):
         from .utils import PetscDefaults as ModuleDefaults
+        ModuleDefaults.setDumpFilename(self.optionsFilename)
         value = ModuleDefaults.NONE
         if self.solver:
             value |= ModuleDefaults.SOLVER
@@ -67,6 +80,12 @@ class PetscDefaults(Component):
             value |= ModuleDefaults.INITIAL_GUESS
         if self.testing:
             value |= ModuleDefaults.TESTING
+        if self.gpu:
+            value |= ModuleDefaults.GPU
+        if self.faultSchur:
+            value |= ModuleDefaults.FAULT_SCHUR
+        if self.multigrid:
+            value |= ModuleDefaults.MULTIGRID
         return value
 
 
@@ -14,7 +14,9 @@
 # ----------------------------------------------------------------------
 #
 
-__all__ = ['NullComponent',
+__all__ = ['AnalyticDB',
+           'MMapGridDB',
+           'NullComponent',
            'PetscComponent',
            'PetscManager',
            ]
@@ -0,0 +1,127 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestElasticityKernelRegistry.hh" // Implementation of class methods
+
+#include "pylith/fekernels/ElasticityKernelRegistry.hh" // USES ElasticityKernelRegistry
+#include "pylith/fekernels/IsotropicLinearElasticityBatched.hh" // USES IsotropicLinearElasticityBatched
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <valarray> // USES std::valarray
+#include <cmath> // USES sin()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::fekernels::TestElasticityKernelRegistry);
+
+// ----------------------------------------------------------------------
+// Test getKernels() for supported (rheology, spatial dimension) combinations.
+void
+pylith::fekernels::TestElasticityKernelRegistry::testGetKernels(void) {
+    PYLITH_METHOD_BEGIN;
+
+    ElasticityKernelRegistry::KernelBlock block2D =
+        ElasticityKernelRegistry::getKernels("isotropiclinearelasticity", 2);
+    CPPUNIT_ASSERT(block2D.f1v);
+    CPPUNIT_ASSERT(block2D.Jf3vu);
+    CPPUNIT_ASSERT(ElasticityKernelRegistry::batchedfn_type(
+                       IsotropicLinearElasticityBatched::f1v_infinitesimalStrain2D) == block2D.f1v);
+    CPPUNIT_ASSERT(ElasticityKernelRegistry::batchedfn_type(
+                       IsotropicLinearElasticityBatched::Jf3vu_infinitesimalStrain2D) == block2D.Jf3vu);
+
+    ElasticityKernelRegistry::KernelBlock block3D =
+        ElasticityKernelRegistry::getKernels("isotropiclinearelasticity", 3);
+    CPPUNIT_ASSERT(block3D.f1v);
+    CPPUNIT_ASSERT(block3D.Jf3vu);
+    CPPUNIT_ASSERT(ElasticityKernelRegistry::batchedfn_type(
+                       IsotropicLinearElasticityBatched::f1v_infinitesimalStrain3D) == block3D.f1v);
+    CPPUNIT_ASSERT(ElasticityKernelRegistry::batchedfn_type(
+                       IsotropicLinearElasticityBatched::Jf3vu_infinitesimalStrain3D) == block3D.Jf3vu);
+
+    PYLITH_METHOD_END;
+} // testGetKernels
+
+
+// ----------------------------------------------------------------------
+// Test getKernels() for unsupported rheologies and dimensions.
+void
+pylith::fekernels::TestElasticityKernelRegistry::testGetKernelsUnknown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    ElasticityKernelRegistry::KernelBlock block =
+        ElasticityKernelRegistry::getKernels("isotropicpowerlaw", 3);
+    CPPUNIT_ASSERT(!block.f1v);
+    CPPUNIT_ASSERT(!block.Jf3vu);
+
+    block = ElasticityKernelRegistry::getKernels("isotropiclinearelasticity", 1);
+    CPPUNIT_ASSERT(!block.f1v);
+    CPPUNIT_ASSERT(!block.Jf3vu);
+
+    block = ElasticityKernelRegistry::getKernels(NULL, 2);
+    CPPUNIT_ASSERT(!block.f1v);
+    CPPUNIT_ASSERT(!block.Jf3vu);
+
+    PYLITH_METHOD_END;
+} // testGetKernelsUnknown
+
+
+// ----------------------------------------------------------------------
+// Test that the registered loops compute the same values as the batched kernels.
+void
+pylith::fekernels::TestElasticityKernelRegistry::testKernelEvaluation(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const PylithInt dim = 2;
+    const PylithInt nq = 11;
+
+    std::valarray<PylithScalar> dispGrad(dim*dim*nq);
+    std::valarray<PylithScalar> shearModulus(nq);
+    std::valarray<PylithScalar> bulkModulus(nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        for (PylithInt i = 0; i < dim*dim; ++i) {
+            dispGrad[i*nq+q] = 1.0e-4 * sin(1.0 + q + i);
+        } // for
+        shearModulus[q] = 20.0e+9;
+        bulkModulus[q] = 30.0e+9;
+    } // for
+
+    ElasticityKernelRegistry::Batch batch;
+    batch.numPoints = nq;
+    batch.dispGrad = &dispGrad[0];
+    batch.shearModulus = &shearModulus[0];
+    batch.bulkModulus = &bulkModulus[0];
+
+    ElasticityKernelRegistry::KernelBlock block =
+        ElasticityKernelRegistry::getKernels("isotropiclinearelasticity", dim);
+    CPPUNIT_ASSERT(block.f1v);
+
+    std::valarray<PylithScalar> f1Registry(3*nq);
+    std::valarray<PylithScalar> f1Direct(3*nq);
+    block.f1v(batch, &f1Registry[0]);
+    IsotropicLinearElasticityBatched::f1v_infinitesimalStrain2D(batch, &f1Direct[0]);
+    for (PylithInt i = 0; i < 3*nq; ++i) {
+        CPPUNIT_ASSERT_EQUAL(f1Direct[i], f1Registry[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testKernelEvaluation
+
+
+// End of file
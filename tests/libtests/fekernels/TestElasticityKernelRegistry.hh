@@ -0,0 +1,66 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/fekernels/TestElasticityKernelRegistry.hh
+ *
+ * @brief C++ TestElasticityKernelRegistry object
+ *
+ * C++ unit testing for the registry of monomorphized batched elasticity loops.
+ */
+
+#if !defined(pylith_fekernels_testelasticitykernelregistry_hh)
+#define pylith_fekernels_testelasticitykernelregistry_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestElasticityKernelRegistry;
+    } // fekernels
+} // pylith
+
+/// C++ unit testing for ElasticityKernelRegistry
+class pylith::fekernels::TestElasticityKernelRegistry : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestElasticityKernelRegistry);
+
+    CPPUNIT_TEST(testGetKernels);
+    CPPUNIT_TEST(testGetKernelsUnknown);
+    CPPUNIT_TEST(testKernelEvaluation);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test getKernels() for supported (rheology, spatial dimension) combinations.
+    void testGetKernels(void);
+
+    /// Test getKernels() for unsupported rheologies and dimensions.
+    void testGetKernelsUnknown(void);
+
+    /// Test that the registered loops compute the same values as the batched kernels.
+    void testKernelEvaluation(void);
+
+}; // class TestElasticityKernelRegistry
+
+#endif // pylith_fekernels_testelasticitykernelregistry_hh
+
+// End of file
@@ -0,0 +1,362 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestIsotropicLinearElasticityBatched.hh" // Implementation of class methods
+
+#include "pylith/fekernels/IsotropicLinearElasticityBatched.hh" // USES IsotropicLinearElasticityBatched
+#include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity* pointwise kernels
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <valarray> // USES std::valarray
+#include <cmath> // USES sin(), cos()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::fekernels::TestIsotropicLinearElasticityBatched);
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace fekernels {
+        namespace _TestIsotropicLinearElasticityBatched {
+            const PylithInt numPoints = 37; // Not a multiple of any SIMD width.
+            const PylithReal tolerance = 1.0e-12;
+
+            // Displacement gradient for quadrature point; varies smoothly and is not symmetric.
+            inline
+            PylithScalar dispGrad(const PylithInt q,
+                                  const PylithInt i,
+                                  const PylithInt j,
+                                  const PylithInt dim) {
+                return 1.0e-4 * sin(1.0 + q + dim*i + j) + 2.0e-5 * cos(0.5*q + i - j);
+            } // dispGrad
+
+            // Elastic moduli for quadrature point (heterogeneous block).
+            inline
+            PylithScalar shearModulus(const PylithInt q) {
+                return 20.0e+9 * (1.0 + 0.2*sin(0.3*q));
+            } // shearModulus
+
+            inline
+            PylithScalar bulkModulus(const PylithInt q) {
+                return 30.0e+9 * (1.0 + 0.1*cos(0.7*q));
+            } // bulkModulus
+
+        } // _TestIsotropicLinearElasticityBatched
+    } // fekernels
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test f1v_infinitesimalStrain2D() against the pointwise plane strain f1v kernel.
+void
+pylith::fekernels::TestIsotropicLinearElasticityBatched::testF1v2D(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicLinearElasticityBatched;
+
+    const PylithInt dim = 2;
+    const PylithInt nq = data::numPoints;
+
+    std::valarray<PylithScalar> dispGrad(dim*dim*nq);
+    std::valarray<PylithScalar> shearModulus(nq);
+    std::valarray<PylithScalar> bulkModulus(nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                dispGrad[(i*dim+j)*nq+q] = data::dispGrad(q, i, j, dim);
+            } // for
+        } // for
+        shearModulus[q] = data::shearModulus(q);
+        bulkModulus[q] = data::bulkModulus(q);
+    } // for
+
+    IsotropicLinearElasticityBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.dispGrad = &dispGrad[0];
+    batch.shearModulus = &shearModulus[0];
+    batch.bulkModulus = &bulkModulus[0];
+
+    std::valarray<PylithScalar> f1Batched(3*nq);
+    IsotropicLinearElasticityBatched::f1v_infinitesimalStrain2D(batch, &f1Batched[0]);
+
+    // Evaluate the pointwise kernel one quadrature point at a time on the same inputs.
+    const PylithInt numS = 1;
+    const PylithInt numA = 3; // density, shear_modulus, bulk_modulus
+    const PylithInt sOff[numS] = { 0 };
+    const PylithInt sOff_x[numS] = { 0 };
+    const PylithInt aOff[numA] = { 0, 1, 2 };
+    const PylithScalar x[dim] = { 0.0, 0.0 };
+    for (PylithInt q = 0; q < nq; ++q) {
+        PylithScalar s[dim] = { 0.0, 0.0 };
+        PylithScalar s_t[dim] = { 0.0, 0.0 };
+        PylithScalar s_x[dim*dim];
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                s_x[i*dim+j] = dispGrad[(i*dim+j)*nq+q];
+            } // for
+        } // for
+        PylithScalar a[numA] = { 2500.0, shearModulus[q], bulkModulus[q] };
+
+        PylithScalar f1Pointwise[dim*dim] = { 0.0, 0.0, 0.0, 0.0 };
+        IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f1Pointwise);
+
+        const PylithReal scale = data::shearModulus(0) * 1.0e-4;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[0*dim+0], f1Batched[0*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[1*dim+1], f1Batched[1*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[0*dim+1], f1Batched[2*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[1*dim+0], f1Batched[2*nq+q], data::tolerance*scale);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testF1v2D
+
+
+// ----------------------------------------------------------------------
+// Test f1v_infinitesimalStrain3D() against the pointwise 3D f1v kernel.
+void
+pylith::fekernels::TestIsotropicLinearElasticityBatched::testF1v3D(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicLinearElasticityBatched;
+
+    const PylithInt dim = 3;
+    const PylithInt nq = data::numPoints;
+
+    std::valarray<PylithScalar> dispGrad(dim*dim*nq);
+    std::valarray<PylithScalar> shearModulus(nq);
+    std::valarray<PylithScalar> bulkModulus(nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                dispGrad[(i*dim+j)*nq+q] = data::dispGrad(q, i, j, dim);
+            } // for
+        } // for
+        shearModulus[q] = data::shearModulus(q);
+        bulkModulus[q] = data::bulkModulus(q);
+    } // for
+
+    IsotropicLinearElasticityBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.dispGrad = &dispGrad[0];
+    batch.shearModulus = &shearModulus[0];
+    batch.bulkModulus = &bulkModulus[0];
+
+    std::valarray<PylithScalar> f1Batched(6*nq);
+    IsotropicLinearElasticityBatched::f1v_infinitesimalStrain3D(batch, &f1Batched[0]);
+
+    const PylithInt numS = 1;
+    const PylithInt numA = 3; // density, shear_modulus, bulk_modulus
+    const PylithInt sOff[numS] = { 0 };
+    const PylithInt sOff_x[numS] = { 0 };
+    const PylithInt aOff[numA] = { 0, 1, 2 };
+    const PylithScalar x[dim] = { 0.0, 0.0, 0.0 };
+    for (PylithInt q = 0; q < nq; ++q) {
+        PylithScalar s[dim] = { 0.0, 0.0, 0.0 };
+        PylithScalar s_t[dim] = { 0.0, 0.0, 0.0 };
+        PylithScalar s_x[dim*dim];
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                s_x[i*dim+j] = dispGrad[(i*dim+j)*nq+q];
+            } // for
+        } // for
+        PylithScalar a[numA] = { 2500.0, shearModulus[q], bulkModulus[q] };
+
+        PylithScalar f1Pointwise[dim*dim];
+        for (PylithInt i = 0; i < dim*dim; ++i) {
+            f1Pointwise[i] = 0.0;
+        } // for
+        IsotropicLinearElasticity3D::f1v_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f1Pointwise);
+
+        const PylithReal scale = data::shearModulus(0) * 1.0e-4;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[0*dim+0], f1Batched[0*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[1*dim+1], f1Batched[1*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[2*dim+2], f1Batched[2*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[0*dim+1], f1Batched[3*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[1*dim+2], f1Batched[4*nq+q], data::tolerance*scale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1Pointwise[0*dim+2], f1Batched[5*nq+q], data::tolerance*scale);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testF1v3D
+
+
+// ----------------------------------------------------------------------
+// Test Jf3vu_infinitesimalStrain2D() against the pointwise plane strain Jf3vu kernel.
+void
+pylith::fekernels::TestIsotropicLinearElasticityBatched::testJf3vu2D(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicLinearElasticityBatched;
+
+    const PylithInt dim = 2;
+    const PylithInt nq = data::numPoints;
+
+    std::valarray<PylithScalar> shearModulus(nq);
+    std::valarray<PylithScalar> bulkModulus(nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        shearModulus[q] = data::shearModulus(q);
+        bulkModulus[q] = data::bulkModulus(q);
+    } // for
+
+    IsotropicLinearElasticityBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.shearModulus = &shearModulus[0];
+    batch.bulkModulus = &bulkModulus[0];
+
+    std::valarray<PylithScalar> Jf3Batched(4*nq); // (C1111, C1122, C1212, C2222)
+    IsotropicLinearElasticityBatched::Jf3vu_infinitesimalStrain2D(batch, &Jf3Batched[0]);
+
+    const PylithInt numS = 1;
+    const PylithInt numA = 3; // density, shear_modulus, bulk_modulus
+    const PylithInt sOff[numS] = { 0 };
+    const PylithInt sOff_x[numS] = { 0 };
+    const PylithInt aOff[numA] = { 0, 1, 2 };
+    const PylithScalar x[dim] = { 0.0, 0.0 };
+    for (PylithInt q = 0; q < nq; ++q) {
+        PylithScalar s[dim] = { 0.0, 0.0 };
+        PylithScalar a[numA] = { 2500.0, shearModulus[q], bulkModulus[q] };
+
+        PylithScalar Jf3Pointwise[16];
+        for (PylithInt i = 0; i < 16; ++i) {
+            Jf3Pointwise[i] = 0.0;
+        } // for
+        IsotropicLinearElasticityPlaneStrain::Jf3vu_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, NULL, NULL, aOff, NULL, a, NULL, NULL,
+            0.0, 1.0, x, 0, NULL, Jf3Pointwise);
+
+        const PylithReal scale = data::shearModulus(0);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(Jf3Pointwise[ 0], Jf3Batched[0*nq+q], data::tolerance*scale); // C1111
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(Jf3Pointwise[ 5], Jf3Batched[1*nq+q], data::tolerance*scale); // C1122
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(Jf3Pointwise[ 3], Jf3Batched[2*nq+q], data::tolerance*scale); // C1212
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(Jf3Pointwise[15], Jf3Batched[3*nq+q], data::tolerance*scale); // C2222
+    } // for
+
+    PYLITH_METHOD_END;
+} // testJf3vu2D
+
+
+// ----------------------------------------------------------------------
+// Test Jf3vu_infinitesimalStrain3D() against the pointwise 3D Jf3vu kernel.
+void
+pylith::fekernels::TestIsotropicLinearElasticityBatched::testJf3vu3D(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicLinearElasticityBatched;
+
+    const PylithInt dim = 3;
+    const PylithInt nq = data::numPoints;
+
+    std::valarray<PylithScalar> shearModulus(nq);
+    std::valarray<PylithScalar> bulkModulus(nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        shearModulus[q] = data::shearModulus(q);
+        bulkModulus[q] = data::bulkModulus(q);
+    } // for
+
+    IsotropicLinearElasticityBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.shearModulus = &shearModulus[0];
+    batch.bulkModulus = &bulkModulus[0];
+
+    std::valarray<PylithScalar> Jf3Batched(3*nq); // (C1111, C1122, C1212)
+    IsotropicLinearElasticityBatched::Jf3vu_infinitesimalStrain3D(batch, &Jf3Batched[0]);
+
+    const PylithInt numS = 1;
+    const PylithInt numA = 3; // density, shear_modulus, bulk_modulus
+    const PylithInt sOff[numS] = { 0 };
+    const PylithInt sOff_x[numS] = { 0 };
+    const PylithInt aOff[numA] = { 0, 1, 2 };
+    const PylithScalar x[dim] = { 0.0, 0.0, 0.0 };
+    for (PylithInt q = 0; q < nq; ++q) {
+        PylithScalar s[dim] = { 0.0, 0.0, 0.0 };
+        PylithScalar a[numA] = { 2500.0, shearModulus[q], bulkModulus[q] };
+
+        PylithScalar Jf3Pointwise[81];
+        for (PylithInt i = 0; i < 81; ++i) {
+            Jf3Pointwise[i] = 0.0;
+        } // for
+        IsotropicLinearElasticity3D::Jf3vu_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, NULL, NULL, aOff, NULL, a, NULL, NULL,
+            0.0, 1.0, x, 0, NULL, Jf3Pointwise);
+
+        const PylithReal scale = data::shearModulus(0);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(Jf3Pointwise[ 0], Jf3Batched[0*nq+q], data::tolerance*scale); // C1111 (j0000)
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(Jf3Pointwise[10], Jf3Batched[1*nq+q], data::tolerance*scale); // C1122 (j0101)
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(Jf3Pointwise[ 4], Jf3Batched[2*nq+q], data::tolerance*scale); // C1212 (j0011)
+    } // for
+
+    PYLITH_METHOD_END;
+} // testJf3vu3D
+
+
+// ----------------------------------------------------------------------
+// Test equivalence of the general and constant-moduli pointwise f1v variants.
+void
+pylith::fekernels::TestIsotropicLinearElasticityBatched::testF1vConstModuli(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicLinearElasticityBatched;
+
+    // The autotuned kernel variants must be semantically equivalent; with uniform moduli the
+    // constant-moduli variant (moduli from the kernel constants) must match the general variant
+    // (moduli from the auxiliary field) at every quadrature point.
+    const PylithInt dim = 2;
+    const PylithInt numS = 1;
+    const PylithInt numA = 3; // density, shear_modulus, bulk_modulus
+    const PylithInt sOff[numS] = { 0 };
+    const PylithInt sOff_x[numS] = { 0 };
+    const PylithInt aOff[numA] = { 0, 1, 2 };
+    const PylithScalar x[dim] = { 0.0, 0.0 };
+
+    const PylithScalar shearModulus = data::shearModulus(0);
+    const PylithScalar bulkModulus = data::bulkModulus(0);
+    PylithScalar a[numA] = { 2500.0, shearModulus, bulkModulus };
+    const PylithInt numConstants = 2;
+    const PylithScalar constants[numConstants] = { shearModulus, bulkModulus };
+
+    for (PylithInt q = 0; q < data::numPoints; ++q) {
+        PylithScalar s[dim] = { 0.0, 0.0 };
+        PylithScalar s_t[dim] = { 0.0, 0.0 };
+        PylithScalar s_x[dim*dim];
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                s_x[i*dim+j] = data::dispGrad(q, i, j, dim);
+            } // for
+        } // for
+
+        PylithScalar f1General[dim*dim] = { 0.0, 0.0, 0.0, 0.0 };
+        IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f1General);
+
+        PylithScalar f1ConstModuli[dim*dim] = { 0.0, 0.0, 0.0, 0.0 };
+        IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain_constModuli(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, numConstants, constants, f1ConstModuli);
+
+        const PylithReal scale = shearModulus * 1.0e-4;
+        for (PylithInt i = 0; i < dim*dim; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(f1General[i], f1ConstModuli[i], data::tolerance*scale);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testF1vConstModuli
+
+
+// End of file
@@ -0,0 +1,75 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/fekernels/TestIsotropicLinearElasticityBatched.hh
+ *
+ * @brief C++ TestIsotropicLinearElasticityBatched object
+ *
+ * C++ unit testing for the batched (SoA) isotropic linear elasticity kernels
+ * against the pointwise kernels registered with the PETSc weak form.
+ */
+
+#if !defined(pylith_fekernels_testisotropiclinearelasticitybatched_hh)
+#define pylith_fekernels_testisotropiclinearelasticitybatched_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicLinearElasticityBatched;
+    } // fekernels
+} // pylith
+
+/// C++ unit testing for IsotropicLinearElasticityBatched
+class pylith::fekernels::TestIsotropicLinearElasticityBatched : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestIsotropicLinearElasticityBatched);
+
+    CPPUNIT_TEST(testF1v2D);
+    CPPUNIT_TEST(testF1v3D);
+    CPPUNIT_TEST(testJf3vu2D);
+    CPPUNIT_TEST(testJf3vu3D);
+    CPPUNIT_TEST(testF1vConstModuli);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test f1v_infinitesimalStrain2D() against the pointwise plane strain f1v kernel.
+    void testF1v2D(void);
+
+    /// Test f1v_infinitesimalStrain3D() against the pointwise 3D f1v kernel.
+    void testF1v3D(void);
+
+    /// Test Jf3vu_infinitesimalStrain2D() against the pointwise plane strain Jf3vu kernel.
+    void testJf3vu2D(void);
+
+    /// Test Jf3vu_infinitesimalStrain3D() against the pointwise 3D Jf3vu kernel.
+    void testJf3vu3D(void);
+
+    /// Test equivalence of the general and constant-moduli pointwise f1v variants.
+    void testF1vConstModuli(void);
+
+}; // class TestIsotropicLinearElasticityBatched
+
+#endif // pylith_fekernels_testisotropiclinearelasticitybatched_hh
+
+// End of file
@@ -0,0 +1,367 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestIsotropicLinearPoroelasticityBatched.hh" // Implementation of class methods
+
+#include "pylith/fekernels/IsotropicLinearPoroelasticityBatched.hh" // USES IsotropicLinearPoroelasticityBatched
+#include "pylith/fekernels/IsotropicLinearPoroelasticity.hh" // USES IsotropicLinearPoroelasticity* pointwise kernels
+#include "pylith/fekernels/Poroelasticity.hh" // USES Poroelasticity::f0e
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <valarray> // USES std::valarray
+#include <cmath> // USES sin(), cos()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::fekernels::TestIsotropicLinearPoroelasticityBatched);
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace fekernels {
+        namespace _TestIsotropicLinearPoroelasticityBatched {
+            const PylithInt numPoints = 29; // Not a multiple of any SIMD width.
+            const PylithReal tolerance = 1.0e-12;
+
+            // Auxiliary field layout shared by the pointwise quasistatic kernels:
+            // poroelasticity [solid_density, fluid_density, fluid_viscosity, porosity] followed by
+            // rheology [shear_modulus, drained_bulk_modulus, biot_coefficient, biot_modulus,
+            // isotropic_permeability].
+            const PylithInt numA = 9;
+            const PylithInt i_fluidViscosity = 2;
+            const PylithInt i_shearModulus = numA - 5;
+            const PylithInt i_drainedBulkModulus = numA - 4;
+            const PylithInt i_biotCoefficient = numA - 3;
+            const PylithInt i_biotModulus = numA - 2;
+            const PylithInt i_isotropicPermeability = numA - 1;
+
+            inline
+            PylithScalar dispGrad(const PylithInt q,
+                                  const PylithInt i,
+                                  const PylithInt j,
+                                  const PylithInt dim) {
+                return 1.0e-4 * sin(1.0 + q + dim*i + j) + 2.0e-5 * cos(0.5*q + i - j);
+            } // dispGrad
+
+            inline
+            PylithScalar pressure(const PylithInt q) {
+                return 1.0e+6 * (1.0 + 0.4*sin(0.2*q));
+            } // pressure
+
+            inline
+            PylithScalar pressureGrad(const PylithInt q,
+                                      const PylithInt j) {
+                return 1.0e+3 * cos(0.6*q + j);
+            } // pressureGrad
+
+            inline
+            void fillAuxiliary(const PylithInt q,
+                               PylithScalar* a) {
+                a[0] = 2500.0; // solid_density
+                a[1] = 1000.0; // fluid_density
+                a[i_fluidViscosity] = 1.0e-3 * (1.0 + 0.1*sin(0.8*q));
+                a[3] = 0.1; // porosity
+                a[i_shearModulus] = 20.0e+9 * (1.0 + 0.2*sin(0.3*q));
+                a[i_drainedBulkModulus] = 30.0e+9 * (1.0 + 0.1*cos(0.7*q));
+                a[i_biotCoefficient] = 0.8 + 0.1*sin(0.5*q);
+                a[i_biotModulus] = 10.0e+9 * (1.0 + 0.3*cos(0.4*q));
+                a[i_isotropicPermeability] = 1.0e-14 * (1.0 + 0.5*sin(0.9*q));
+            } // fillAuxiliary
+
+        } // _TestIsotropicLinearPoroelasticityBatched
+    } // fekernels
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test residual_quasistatic2D() against the pointwise f1u, f0p, f1p, and f0e kernels.
+void
+pylith::fekernels::TestIsotropicLinearPoroelasticityBatched::testResidual2D(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicLinearPoroelasticityBatched;
+
+    const PylithInt dim = 2;
+    const PylithInt nq = data::numPoints;
+
+    std::valarray<PylithScalar> dispGrad(dim*dim*nq);
+    std::valarray<PylithScalar> pressure(nq);
+    std::valarray<PylithScalar> pressure_t(nq);
+    std::valarray<PylithScalar> pressureGrad(dim*nq);
+    std::valarray<PylithScalar> traceStrain(nq);
+    std::valarray<PylithScalar> traceStrain_t(nq);
+    std::valarray<PylithScalar> shearModulus(nq);
+    std::valarray<PylithScalar> drainedBulkModulus(nq);
+    std::valarray<PylithScalar> biotCoefficient(nq);
+    std::valarray<PylithScalar> biotModulus(nq);
+    std::valarray<PylithScalar> fluidViscosity(nq);
+    std::valarray<PylithScalar> isotropicPermeability(nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                dispGrad[(i*dim+j)*nq+q] = data::dispGrad(q, i, j, dim);
+            } // for
+            pressureGrad[i*nq+q] = data::pressureGrad(q, i);
+        } // for
+        pressure[q] = data::pressure(q);
+        pressure_t[q] = 0.01 * data::pressure(q);
+        traceStrain[q] = 1.1 * (data::dispGrad(q, 0, 0, dim) + data::dispGrad(q, 1, 1, dim));
+        traceStrain_t[q] = 0.01 * traceStrain[q];
+
+        PylithScalar a[data::numA];
+        data::fillAuxiliary(q, a);
+        shearModulus[q] = a[data::i_shearModulus];
+        drainedBulkModulus[q] = a[data::i_drainedBulkModulus];
+        biotCoefficient[q] = a[data::i_biotCoefficient];
+        biotModulus[q] = a[data::i_biotModulus];
+        fluidViscosity[q] = a[data::i_fluidViscosity];
+        isotropicPermeability[q] = a[data::i_isotropicPermeability];
+    } // for
+
+    IsotropicLinearPoroelasticityBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.dispGrad = &dispGrad[0];
+    batch.pressure = &pressure[0];
+    batch.pressure_t = &pressure_t[0];
+    batch.pressureGrad = &pressureGrad[0];
+    batch.traceStrain = &traceStrain[0];
+    batch.traceStrain_t = &traceStrain_t[0];
+    batch.shearModulus = &shearModulus[0];
+    batch.drainedBulkModulus = &drainedBulkModulus[0];
+    batch.biotCoefficient = &biotCoefficient[0];
+    batch.biotModulus = &biotModulus[0];
+    batch.fluidViscosity = &fluidViscosity[0];
+    batch.isotropicPermeability = &isotropicPermeability[0];
+
+    std::valarray<PylithScalar> f1uBatched(3*nq);
+    std::valarray<PylithScalar> f0pBatched(nq);
+    std::valarray<PylithScalar> f1pBatched(dim*nq);
+    std::valarray<PylithScalar> f0eBatched(nq);
+    IsotropicLinearPoroelasticityBatched::residual_quasistatic2D(
+        batch, &f1uBatched[0], &f0pBatched[0], &f1pBatched[0], &f0eBatched[0]);
+
+    // Evaluate the pointwise kernels one quadrature point at a time on the same inputs.
+    const PylithInt numS = 3; // displacement, pressure, trace_strain
+    const PylithInt sOff[numS] = { 0, dim, dim+1 };
+    const PylithInt sOff_x[numS] = { 0, dim*dim, dim*dim+dim };
+    PylithInt aOff[data::numA];
+    for (PylithInt i = 0; i < data::numA; ++i) {
+        aOff[i] = i;
+    } // for
+    const PylithScalar x[dim] = { 0.0, 0.0 };
+    for (PylithInt q = 0; q < nq; ++q) {
+        PylithScalar s[dim+2];
+        PylithScalar s_t[dim+2];
+        PylithScalar s_x[dim*dim+dim+dim];
+        for (PylithInt i = 0; i < dim+2; ++i) {
+            s[i] = 0.0;
+            s_t[i] = 0.0;
+        } // for
+        for (PylithInt i = 0; i < dim*dim+dim+dim; ++i) {
+            s_x[i] = 0.0;
+        } // for
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                s_x[i*dim+j] = dispGrad[(i*dim+j)*nq+q];
+            } // for
+            s_x[dim*dim+i] = pressureGrad[i*nq+q];
+        } // for
+        s[dim] = pressure[q];
+        s[dim+1] = traceStrain[q];
+        s_t[dim] = pressure_t[q];
+        s_t[dim+1] = traceStrain_t[q];
+        PylithScalar a[data::numA];
+        data::fillAuxiliary(q, a);
+
+        PylithScalar f1uPointwise[dim*dim] = { 0.0, 0.0, 0.0, 0.0 };
+        IsotropicLinearPoroelasticityPlaneStrain::f1u(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f1uPointwise);
+
+        PylithScalar f0pPointwise[1] = { 0.0 };
+        IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f0pPointwise);
+
+        PylithScalar f1pPointwise[dim] = { 0.0, 0.0 };
+        IsotropicLinearPoroelasticityPlaneStrain::f1p(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f1pPointwise);
+
+        PylithScalar f0ePointwise[1] = { 0.0 };
+        Poroelasticity::f0e(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f0ePointwise);
+
+        const PylithReal stressScale = shearModulus[q] * 1.0e-4;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[0*dim+0], f1uBatched[0*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[1*dim+1], f1uBatched[1*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[0*dim+1], f1uBatched[2*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[1*dim+0], f1uBatched[2*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f0pPointwise[0], f0pBatched[q], data::tolerance*fabs(f0pPointwise[0]));
+        for (PylithInt j = 0; j < dim; ++j) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(f1pPointwise[j], f1pBatched[j*nq+q], data::tolerance*fabs(f1pPointwise[j]));
+        } // for
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f0ePointwise[0], f0eBatched[q], data::tolerance*1.0e-4);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testResidual2D
+
+
+// ----------------------------------------------------------------------
+// Test residual_quasistatic3D() against the pointwise f1u, f0p, f1p, and f0e kernels.
+void
+pylith::fekernels::TestIsotropicLinearPoroelasticityBatched::testResidual3D(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicLinearPoroelasticityBatched;
+
+    const PylithInt dim = 3;
+    const PylithInt nq = data::numPoints;
+
+    std::valarray<PylithScalar> dispGrad(dim*dim*nq);
+    std::valarray<PylithScalar> pressure(nq);
+    std::valarray<PylithScalar> pressure_t(nq);
+    std::valarray<PylithScalar> pressureGrad(dim*nq);
+    std::valarray<PylithScalar> traceStrain(nq);
+    std::valarray<PylithScalar> traceStrain_t(nq);
+    std::valarray<PylithScalar> shearModulus(nq);
+    std::valarray<PylithScalar> drainedBulkModulus(nq);
+    std::valarray<PylithScalar> biotCoefficient(nq);
+    std::valarray<PylithScalar> biotModulus(nq);
+    std::valarray<PylithScalar> fluidViscosity(nq);
+    std::valarray<PylithScalar> isotropicPermeability(nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        PylithScalar trace = 0.0;
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                dispGrad[(i*dim+j)*nq+q] = data::dispGrad(q, i, j, dim);
+            } // for
+            pressureGrad[i*nq+q] = data::pressureGrad(q, i);
+            trace += data::dispGrad(q, i, i, dim);
+        } // for
+        pressure[q] = data::pressure(q);
+        pressure_t[q] = 0.01 * data::pressure(q);
+        traceStrain[q] = 1.1 * trace;
+        traceStrain_t[q] = 0.01 * traceStrain[q];
+
+        PylithScalar a[data::numA];
+        data::fillAuxiliary(q, a);
+        shearModulus[q] = a[data::i_shearModulus];
+        drainedBulkModulus[q] = a[data::i_drainedBulkModulus];
+        biotCoefficient[q] = a[data::i_biotCoefficient];
+        biotModulus[q] = a[data::i_biotModulus];
+        fluidViscosity[q] = a[data::i_fluidViscosity];
+        isotropicPermeability[q] = a[data::i_isotropicPermeability];
+    } // for
+
+    IsotropicLinearPoroelasticityBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.dispGrad = &dispGrad[0];
+    batch.pressure = &pressure[0];
+    batch.pressure_t = &pressure_t[0];
+    batch.pressureGrad = &pressureGrad[0];
+    batch.traceStrain = &traceStrain[0];
+    batch.traceStrain_t = &traceStrain_t[0];
+    batch.shearModulus = &shearModulus[0];
+    batch.drainedBulkModulus = &drainedBulkModulus[0];
+    batch.biotCoefficient = &biotCoefficient[0];
+    batch.biotModulus = &biotModulus[0];
+    batch.fluidViscosity = &fluidViscosity[0];
+    batch.isotropicPermeability = &isotropicPermeability[0];
+
+    std::valarray<PylithScalar> f1uBatched(6*nq);
+    std::valarray<PylithScalar> f0pBatched(nq);
+    std::valarray<PylithScalar> f1pBatched(dim*nq);
+    std::valarray<PylithScalar> f0eBatched(nq);
+    IsotropicLinearPoroelasticityBatched::residual_quasistatic3D(
+        batch, &f1uBatched[0], &f0pBatched[0], &f1pBatched[0], &f0eBatched[0]);
+
+    const PylithInt numS = 3; // displacement, pressure, trace_strain
+    const PylithInt sOff[numS] = { 0, dim, dim+1 };
+    const PylithInt sOff_x[numS] = { 0, dim*dim, dim*dim+dim };
+    PylithInt aOff[data::numA];
+    for (PylithInt i = 0; i < data::numA; ++i) {
+        aOff[i] = i;
+    } // for
+    const PylithScalar x[dim] = { 0.0, 0.0, 0.0 };
+    for (PylithInt q = 0; q < nq; ++q) {
+        PylithScalar s[dim+2];
+        PylithScalar s_t[dim+2];
+        PylithScalar s_x[dim*dim+dim+dim];
+        for (PylithInt i = 0; i < dim+2; ++i) {
+            s[i] = 0.0;
+            s_t[i] = 0.0;
+        } // for
+        for (PylithInt i = 0; i < dim*dim+dim+dim; ++i) {
+            s_x[i] = 0.0;
+        } // for
+        for (PylithInt i = 0; i < dim; ++i) {
+            for (PylithInt j = 0; j < dim; ++j) {
+                s_x[i*dim+j] = dispGrad[(i*dim+j)*nq+q];
+            } // for
+            s_x[dim*dim+i] = pressureGrad[i*nq+q];
+        } // for
+        s[dim] = pressure[q];
+        s[dim+1] = traceStrain[q];
+        s_t[dim] = pressure_t[q];
+        s_t[dim+1] = traceStrain_t[q];
+        PylithScalar a[data::numA];
+        data::fillAuxiliary(q, a);
+
+        PylithScalar f1uPointwise[dim*dim];
+        for (PylithInt i = 0; i < dim*dim; ++i) {
+            f1uPointwise[i] = 0.0;
+        } // for
+        IsotropicLinearPoroelasticity3D::f1u(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f1uPointwise);
+
+        PylithScalar f0pPointwise[1] = { 0.0 };
+        IsotropicLinearPoroelasticity3D::f0p_implicit(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f0pPointwise);
+
+        PylithScalar f1pPointwise[dim] = { 0.0, 0.0, 0.0 };
+        IsotropicLinearPoroelasticity3D::f1p(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f1pPointwise);
+
+        PylithScalar f0ePointwise[1] = { 0.0 };
+        Poroelasticity::f0e(
+            dim, numS, data::numA, sOff, sOff_x, s, s_t, s_x, aOff, NULL, a, NULL, NULL,
+            0.0, x, 0, NULL, f0ePointwise);
+
+        const PylithReal stressScale = shearModulus[q] * 1.0e-4;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[0*dim+0], f1uBatched[0*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[1*dim+1], f1uBatched[1*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[2*dim+2], f1uBatched[2*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[0*dim+1], f1uBatched[3*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[1*dim+2], f1uBatched[4*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f1uPointwise[0*dim+2], f1uBatched[5*nq+q], data::tolerance*stressScale);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f0pPointwise[0], f0pBatched[q], data::tolerance*fabs(f0pPointwise[0]));
+        for (PylithInt j = 0; j < dim; ++j) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(f1pPointwise[j], f1pBatched[j*nq+q], data::tolerance*fabs(f1pPointwise[j]));
+        } // for
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(f0ePointwise[0], f0eBatched[q], data::tolerance*1.0e-4);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testResidual3D
+
+
+// End of file
@@ -0,0 +1,63 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/fekernels/TestIsotropicLinearPoroelasticityBatched.hh
+ *
+ * @brief C++ TestIsotropicLinearPoroelasticityBatched object
+ *
+ * C++ unit testing for the batched (SoA) fused poroelasticity residual kernels against the
+ * pointwise kernels registered with the PETSc weak form.
+ */
+
+#if !defined(pylith_fekernels_testisotropiclinearporoelasticitybatched_hh)
+#define pylith_fekernels_testisotropiclinearporoelasticitybatched_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicLinearPoroelasticityBatched;
+    } // fekernels
+} // pylith
+
+/// C++ unit testing for IsotropicLinearPoroelasticityBatched
+class pylith::fekernels::TestIsotropicLinearPoroelasticityBatched : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestIsotropicLinearPoroelasticityBatched);
+
+    CPPUNIT_TEST(testResidual2D);
+    CPPUNIT_TEST(testResidual3D);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test residual_quasistatic2D() against the pointwise f1u, f0p, f1p, and f0e kernels.
+    void testResidual2D(void);
+
+    /// Test residual_quasistatic3D() against the pointwise f1u, f0p, f1p, and f0e kernels.
+    void testResidual3D(void);
+
+}; // class TestIsotropicLinearPoroelasticityBatched
+
+#endif // pylith_fekernels_testisotropiclinearporoelasticitybatched_hh
+
+// End of file
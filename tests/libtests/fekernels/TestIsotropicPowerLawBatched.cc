@@ -0,0 +1,263 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestIsotropicPowerLawBatched.hh" // Implementation of class methods
+
+#include "pylith/fekernels/IsotropicPowerLawBatched.hh" // USES IsotropicPowerLawBatched
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw::powerLawAlpha
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <valarray> // USES std::valarray
+#include <cmath> // USES sin(), cos(), pow(), sqrt()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::fekernels::TestIsotropicPowerLawBatched);
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace fekernels {
+        namespace _TestIsotropicPowerLawBatched {
+            // More points than one SIMD lane block so the block sweep is exercised, and not a
+            // multiple of the block size.
+            const PylithInt numPoints = 2*pylith::fekernels::IsotropicPowerLawBatched::laneBlockSize + 7;
+            const PylithReal dt = 0.05;
+            const PylithReal powerLawRefStress = 1.0;
+            const PylithReal powerLawRefStrainRate = 0.5;
+
+            /// Nondimensional per-point state analogous to what deviatoricStress() forms from
+            /// the deviatoric strain and stress invariants.
+            struct PointState {
+                PylithReal ae;
+                PylithReal b;
+                PylithReal c;
+                PylithReal d;
+                PylithReal j2T;
+            };
+
+            inline
+            PointState pointState(const PylithInt q) {
+                const PylithReal powerLawAlpha = pylith::fekernels::IsotropicPowerLaw::powerLawAlpha;
+                const PylithReal timeFac = dt * (1.0 - powerLawAlpha);
+                const PylithReal strainInvar = 0.01 * (1.0 + 0.5*sin(0.4*q));
+                const PylithReal stressInvar = 0.02 * (1.0 + 0.3*cos(0.9*q));
+
+                PointState state;
+                state.ae = 0.5; // 1/(2*shearModulus), nondimensional shearModulus = 1.
+                state.b = strainInvar * strainInvar;
+                state.c = strainInvar * stressInvar * timeFac;
+                state.d = timeFac * stressInvar;
+                state.j2T = stressInvar;
+                return state;
+            } // pointState
+
+            /// Effective-stress equation zeroed by both the pointwise and batched solvers
+            /// (see IsotropicPowerLaw::_effectiveStressFn()).
+            inline
+            PylithReal effectiveStressFn(const PylithReal j2Tpdt,
+                                         const PointState& state,
+                                         const PylithReal powerLawExponent) {
+                const PylithReal powerLawAlpha = pylith::fekernels::IsotropicPowerLaw::powerLawAlpha;
+                const PylithReal j2Tau = (1.0 - powerLawAlpha) * state.j2T + powerLawAlpha * j2Tpdt;
+                const PylithReal gammaTau = powerLawRefStrainRate *
+                                            pow(j2Tau / powerLawRefStress, powerLawExponent - 1.0) / powerLawRefStress;
+                const PylithReal a = state.ae + powerLawAlpha * dt * gammaTau;
+                return a * a * j2Tpdt * j2Tpdt - state.b + state.c * gammaTau - state.d * state.d * gammaTau * gammaTau;
+            } // effectiveStressFn
+
+        } // _TestIsotropicPowerLawBatched
+    } // fekernels
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test effectiveStress() against the closed-form solution for a linear rheology (n=1).
+void
+pylith::fekernels::TestIsotropicPowerLawBatched::testEffectiveStressLinear(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicPowerLawBatched;
+
+    const PylithInt nq = data::numPoints;
+    std::valarray<PylithScalar> j2InitialGuess(nq);
+    std::valarray<PylithScalar> stressScale(1.0, nq);
+    std::valarray<PylithScalar> ae(nq);
+    std::valarray<PylithScalar> b(nq);
+    std::valarray<PylithScalar> c(nq);
+    std::valarray<PylithScalar> d(nq);
+    std::valarray<PylithScalar> j2T(nq);
+    std::valarray<PylithScalar> powerLawExponent(1.0, nq);
+    std::valarray<PylithScalar> powerLawRefStrainRate(data::powerLawRefStrainRate, nq);
+    std::valarray<PylithScalar> powerLawRefStress(data::powerLawRefStress, nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        const data::PointState state = data::pointState(q);
+        ae[q] = state.ae;
+        b[q] = state.b;
+        c[q] = state.c;
+        d[q] = state.d;
+        j2T[q] = state.j2T;
+        j2InitialGuess[q] = state.j2T;
+    } // for
+
+    IsotropicPowerLawBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.j2InitialGuess = &j2InitialGuess[0];
+    batch.stressScale = &stressScale[0];
+    batch.ae = &ae[0];
+    batch.b = &b[0];
+    batch.c = &c[0];
+    batch.d = &d[0];
+    batch.j2T = &j2T[0];
+    batch.powerLawExponent = &powerLawExponent[0];
+    batch.powerLawRefStrainRate = &powerLawRefStrainRate[0];
+    batch.powerLawRefStress = &powerLawRefStress[0];
+    batch.dt = data::dt;
+
+    std::valarray<PylithScalar> j2Tpdt(nq);
+    IsotropicPowerLawBatched::effectiveStress(batch, &j2Tpdt[0]);
+
+    // For n=1 the strain rate coefficient is independent of the stress, so the equation reduces
+    // to a*a*x*x = b - c*gamma + d*d*gamma*gamma with constant a and gamma.
+    const PylithReal powerLawAlpha = IsotropicPowerLaw::powerLawAlpha;
+    const PylithReal gamma = data::powerLawRefStrainRate / data::powerLawRefStress;
+    for (PylithInt q = 0; q < nq; ++q) {
+        const PylithReal a = ae[q] + powerLawAlpha * data::dt * gamma;
+        const PylithReal j2Expected = sqrt(b[q] - c[q]*gamma + d[q]*d[q]*gamma*gamma) / a;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(j2Expected, j2Tpdt[q], 1.0e-8*j2Expected);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testEffectiveStressLinear
+
+
+// ----------------------------------------------------------------------
+// Test that effectiveStress() zeroes the effective-stress equation for a heterogeneous block.
+void
+pylith::fekernels::TestIsotropicPowerLawBatched::testEffectiveStressResidual(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicPowerLawBatched;
+
+    const PylithInt nq = data::numPoints;
+    std::valarray<PylithScalar> j2InitialGuess(nq);
+    std::valarray<PylithScalar> stressScale(1.0, nq);
+    std::valarray<PylithScalar> ae(nq);
+    std::valarray<PylithScalar> b(nq);
+    std::valarray<PylithScalar> c(nq);
+    std::valarray<PylithScalar> d(nq);
+    std::valarray<PylithScalar> j2T(nq);
+    std::valarray<PylithScalar> powerLawExponent(nq);
+    std::valarray<PylithScalar> powerLawRefStrainRate(data::powerLawRefStrainRate, nq);
+    std::valarray<PylithScalar> powerLawRefStress(data::powerLawRefStress, nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        const data::PointState state = data::pointState(q);
+        ae[q] = state.ae;
+        b[q] = state.b;
+        c[q] = state.c;
+        d[q] = state.d;
+        j2T[q] = state.j2T;
+        j2InitialGuess[q] = state.j2T;
+        powerLawExponent[q] = 1.0 + (q % 4); // Mix of linear and nonlinear lanes in each block.
+    } // for
+
+    IsotropicPowerLawBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.j2InitialGuess = &j2InitialGuess[0];
+    batch.stressScale = &stressScale[0];
+    batch.ae = &ae[0];
+    batch.b = &b[0];
+    batch.c = &c[0];
+    batch.d = &d[0];
+    batch.j2T = &j2T[0];
+    batch.powerLawExponent = &powerLawExponent[0];
+    batch.powerLawRefStrainRate = &powerLawRefStrainRate[0];
+    batch.powerLawRefStress = &powerLawRefStress[0];
+    batch.dt = data::dt;
+
+    std::valarray<PylithScalar> j2Tpdt(nq);
+    IsotropicPowerLawBatched::effectiveStress(batch, &j2Tpdt[0]);
+
+    for (PylithInt q = 0; q < nq; ++q) {
+        const data::PointState state = data::pointState(q);
+        CPPUNIT_ASSERT(j2Tpdt[q] > 0.0);
+        const PylithReal residual = data::effectiveStressFn(j2Tpdt[q], state, powerLawExponent[q]);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, residual, 1.0e-14); // Solver targets |residual| < 1.0e-16.
+    } // for
+
+    PYLITH_METHOD_END;
+} // testEffectiveStressResidual
+
+
+// ----------------------------------------------------------------------
+// Test that points with zero deviatoric state get an effective stress of zero.
+void
+pylith::fekernels::TestIsotropicPowerLawBatched::testEffectiveStressInactive(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestIsotropicPowerLawBatched;
+
+    const PylithInt nq = data::numPoints;
+    std::valarray<PylithScalar> j2InitialGuess(nq);
+    std::valarray<PylithScalar> stressScale(1.0, nq);
+    std::valarray<PylithScalar> ae(0.5, nq);
+    std::valarray<PylithScalar> b(nq);
+    std::valarray<PylithScalar> c(nq);
+    std::valarray<PylithScalar> d(nq);
+    std::valarray<PylithScalar> j2T(nq);
+    std::valarray<PylithScalar> powerLawExponent(3.0, nq);
+    std::valarray<PylithScalar> powerLawRefStrainRate(data::powerLawRefStrainRate, nq);
+    std::valarray<PylithScalar> powerLawRefStress(data::powerLawRefStress, nq);
+    for (PylithInt q = 0; q < nq; ++q) {
+        const data::PointState state = data::pointState(q);
+        // Alternate active and inactive lanes so masking within a block is exercised.
+        const bool active = (0 == q % 2);
+        b[q] = active ? state.b : 0.0;
+        c[q] = active ? state.c : 0.0;
+        d[q] = active ? state.d : 0.0;
+        j2T[q] = state.j2T;
+        j2InitialGuess[q] = state.j2T;
+    } // for
+
+    IsotropicPowerLawBatched::Batch batch;
+    batch.numPoints = nq;
+    batch.j2InitialGuess = &j2InitialGuess[0];
+    batch.stressScale = &stressScale[0];
+    batch.ae = &ae[0];
+    batch.b = &b[0];
+    batch.c = &c[0];
+    batch.d = &d[0];
+    batch.j2T = &j2T[0];
+    batch.powerLawExponent = &powerLawExponent[0];
+    batch.powerLawRefStrainRate = &powerLawRefStrainRate[0];
+    batch.powerLawRefStress = &powerLawRefStress[0];
+    batch.dt = data::dt;
+
+    std::valarray<PylithScalar> j2Tpdt(nq);
+    IsotropicPowerLawBatched::effectiveStress(batch, &j2Tpdt[0]);
+
+    for (PylithInt q = 0; q < nq; ++q) {
+        if (0 == q % 2) {
+            CPPUNIT_ASSERT(j2Tpdt[q] > 0.0);
+        } else {
+            CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), j2Tpdt[q]);
+        } // if/else
+    } // for
+
+    PYLITH_METHOD_END;
+} // testEffectiveStressInactive
+
+
+// End of file
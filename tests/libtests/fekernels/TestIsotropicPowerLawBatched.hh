@@ -0,0 +1,66 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/fekernels/TestIsotropicPowerLawBatched.hh
+ *
+ * @brief C++ TestIsotropicPowerLawBatched object
+ *
+ * C++ unit testing for the batched (SoA) power-law effective-stress solve.
+ */
+
+#if !defined(pylith_fekernels_testisotropicpowerlawbatched_hh)
+#define pylith_fekernels_testisotropicpowerlawbatched_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicPowerLawBatched;
+    } // fekernels
+} // pylith
+
+/// C++ unit testing for IsotropicPowerLawBatched
+class pylith::fekernels::TestIsotropicPowerLawBatched : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestIsotropicPowerLawBatched);
+
+    CPPUNIT_TEST(testEffectiveStressLinear);
+    CPPUNIT_TEST(testEffectiveStressResidual);
+    CPPUNIT_TEST(testEffectiveStressInactive);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test effectiveStress() against the closed-form solution for a linear rheology (n=1).
+    void testEffectiveStressLinear(void);
+
+    /// Test that effectiveStress() zeroes the effective-stress equation for a heterogeneous block.
+    void testEffectiveStressResidual(void);
+
+    /// Test that points with zero deviatoric state get an effective stress of zero.
+    void testEffectiveStressInactive(void);
+
+}; // class TestIsotropicPowerLawBatched
+
+#endif // pylith_fekernels_testisotropicpowerlawbatched_hh
+
+// End of file
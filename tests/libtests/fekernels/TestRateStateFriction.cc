@@ -0,0 +1,253 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestRateStateFriction.hh" // Implementation of class methods
+
+#include "pylith/fekernels/RateStateFriction.hh" // USES RateStateFriction
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <valarray> // USES std::valarray
+#include <cmath> // USES log(), sin(), cos()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::fekernels::TestRateStateFriction);
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace fekernels {
+        namespace _TestRateStateFriction {
+            // Laboratory-scale rate-state parameters.
+            const PylithScalar refCoefficient = 0.6; ///< f0
+            const PylithScalar refSlipRate = 1.0e-6; ///< V0 (m/s)
+            const PylithScalar charDistance = 0.02; ///< L (m)
+            const PylithScalar parameterA = 0.010; ///< a
+            const PylithScalar parameterB = 0.015; ///< b
+        } // _TestRateStateFriction
+    } // fekernels
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test frictionCoefficient() against the unregularized law away from V = 0.
+void
+pylith::fekernels::TestRateStateFriction::testFrictionCoefficient(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestRateStateFriction;
+
+    // For V >> 2 V0 exp(-(f0 + b ln(V0 theta/L))/a), asinh(x) ~= ln(2x) and the regularized
+    // coefficient reduces to the standard law mu = f0 + a ln(V/V0) + b ln(V0 theta/L).
+    const PylithScalar slipRates[3] = { 0.5e-6, 1.0e-6, 2.0e-5 };
+    const PylithScalar states[3] = { 0.5e+4, 2.0e+4, 8.0e+4 };
+    for (int iRate = 0; iRate < 3; ++iRate) {
+        for (int iState = 0; iState < 3; ++iState) {
+            const PylithScalar slipRate = slipRates[iRate];
+            const PylithScalar state = states[iState];
+            const PylithScalar muExpected = data::refCoefficient
+                                            + data::parameterA * log(slipRate/data::refSlipRate)
+                                            + data::parameterB * log(data::refSlipRate*state/data::charDistance);
+            const PylithScalar mu = RateStateFriction::frictionCoefficient(
+                slipRate, state, data::refCoefficient, data::refSlipRate, data::charDistance,
+                data::parameterA, data::parameterB);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(muExpected, mu, 1.0e-10);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testFrictionCoefficient
+
+
+// ----------------------------------------------------------------------
+// Test frictionCoefficient() at steady state, mu_ss = f0 + (a-b) ln(V/V0).
+void
+pylith::fekernels::TestRateStateFriction::testFrictionCoefficientSteadyState(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestRateStateFriction;
+
+    // At steady state theta_ss = L/V, so mu_ss = f0 + (a-b) ln(V/V0); with b > a the fault is
+    // velocity weakening.
+    const PylithScalar slipRates[3] = { 0.2e-6, 1.0e-6, 5.0e-6 };
+    for (int iRate = 0; iRate < 3; ++iRate) {
+        const PylithScalar slipRate = slipRates[iRate];
+        const PylithScalar stateSteady = data::charDistance / slipRate;
+        const PylithScalar muExpected = data::refCoefficient
+                                        + (data::parameterA - data::parameterB) * log(slipRate/data::refSlipRate);
+        const PylithScalar mu = RateStateFriction::frictionCoefficient(
+            slipRate, stateSteady, data::refCoefficient, data::refSlipRate, data::charDistance,
+            data::parameterA, data::parameterB);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(muExpected, mu, 1.0e-10);
+    } // for
+
+    // Velocity weakening (b > a): steady-state friction decreases with slip rate.
+    const PylithScalar muSlow = RateStateFriction::frictionCoefficient(
+        0.2e-6, data::charDistance/0.2e-6, data::refCoefficient, data::refSlipRate,
+        data::charDistance, data::parameterA, data::parameterB);
+    const PylithScalar muFast = RateStateFriction::frictionCoefficient(
+        5.0e-6, data::charDistance/5.0e-6, data::refCoefficient, data::refSlipRate,
+        data::charDistance, data::parameterA, data::parameterB);
+    CPPUNIT_ASSERT(muFast < muSlow);
+
+    PYLITH_METHOD_END;
+} // testFrictionCoefficientSteadyState
+
+
+// ----------------------------------------------------------------------
+// Test regularized behavior of frictionCoefficient() as V -> 0.
+void
+pylith::fekernels::TestRateStateFriction::testFrictionCoefficientRegularized(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestRateStateFriction;
+
+    const PylithScalar state = 2.0e+4;
+
+    // The unregularized law diverges as V -> 0; the regularized form is finite, vanishes at
+    // V = 0, and decreases monotonically with decreasing slip rate.
+    const PylithScalar muZero = RateStateFriction::frictionCoefficient(
+        0.0, state, data::refCoefficient, data::refSlipRate, data::charDistance,
+        data::parameterA, data::parameterB);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, muZero, 1.0e-16);
+
+    PylithScalar muPrev = muZero;
+    for (PylithScalar slipRate = 1.0e-30; slipRate < 1.0e-6; slipRate *= 1.0e+3) {
+        const PylithScalar mu = RateStateFriction::frictionCoefficient(
+            slipRate, state, data::refCoefficient, data::refSlipRate, data::charDistance,
+            data::parameterA, data::parameterB);
+        CPPUNIT_ASSERT(mu > muPrev);
+        CPPUNIT_ASSERT(mu < 1.0); // Finite where the unregularized law is singular.
+        muPrev = mu;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testFrictionCoefficientRegularized
+
+
+// ----------------------------------------------------------------------
+// Test stateAgeing() against the exact solution of the ageing law.
+void
+pylith::fekernels::TestRateStateFriction::testStateAgeing(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestRateStateFriction;
+
+    const PylithScalar slipRate = 2.0e-6;
+    const PylithScalar stateSteady = data::charDistance / slipRate;
+    const PylithScalar state0 = 3.0 * stateSteady;
+    const PylithScalar dt = 0.4 * data::charDistance / slipRate;
+
+    // Exact solution for constant V: theta(t) = theta_ss + (theta_0 - theta_ss) exp(-V t/L).
+    const PylithScalar stateExpected = stateSteady + (state0 - stateSteady) * exp(-slipRate*dt/data::charDistance);
+    const PylithScalar state = RateStateFriction::stateAgeing(state0, slipRate, data::charDistance, dt);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(stateExpected, state, 1.0e-10*stateSteady);
+
+    // The exponential update is exact for constant V, so two half steps match one full step.
+    const PylithScalar stateHalf = RateStateFriction::stateAgeing(
+        RateStateFriction::stateAgeing(state0, slipRate, data::charDistance, 0.5*dt),
+        slipRate, data::charDistance, 0.5*dt);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(state, stateHalf, 1.0e-10*stateSteady);
+
+    // Steady state is a fixed point of the update.
+    const PylithScalar stateFixed = RateStateFriction::stateAgeing(stateSteady, slipRate, data::charDistance, dt);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(stateSteady, stateFixed, 1.0e-10*stateSteady);
+
+    // The state approaches steady state for a long step.
+    const PylithScalar stateLong = RateStateFriction::stateAgeing(state0, slipRate, data::charDistance, 1.0e+3*dt);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(stateSteady, stateLong, 1.0e-10*stateSteady);
+
+    PYLITH_METHOD_END;
+} // testStateAgeing
+
+
+// ----------------------------------------------------------------------
+// Test stateAgeing() for a locked patch (V -> 0).
+void
+pylith::fekernels::TestRateStateFriction::testStateAgeingLocked(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestRateStateFriction;
+
+    const PylithScalar state0 = 2.0e+4;
+    const PylithScalar dt = 1.0e+5;
+
+    // For V = 0 the ageing law reduces to dtheta/dt = 1; the state grows linearly with time.
+    const PylithScalar stateZero = RateStateFriction::stateAgeing(state0, 0.0, data::charDistance, dt);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(state0 + dt, stateZero, 1.0e-10*state0);
+
+    // A vanishing slip rate (V dt/L below the cutoff) takes the same branch.
+    const PylithScalar stateTiny = RateStateFriction::stateAgeing(state0, 1.0e-30, data::charDistance, dt);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(state0 + dt, stateTiny, 1.0e-10*state0);
+
+    PYLITH_METHOD_END;
+} // testStateAgeingLocked
+
+
+// ----------------------------------------------------------------------
+// Test that the batched kernels match the single-point kernels.
+void
+pylith::fekernels::TestRateStateFriction::testBatched(void) {
+    PYLITH_METHOD_BEGIN;
+    namespace data = _TestRateStateFriction;
+
+    const PylithInt numPoints = 23; // Not a multiple of any SIMD width.
+    const PylithScalar dt = 1.0e+3;
+
+    std::valarray<PylithScalar> slipRate(numPoints);
+    std::valarray<PylithScalar> state(numPoints);
+    std::valarray<PylithScalar> refCoefficient(data::refCoefficient, numPoints);
+    std::valarray<PylithScalar> refSlipRate(data::refSlipRate, numPoints);
+    std::valarray<PylithScalar> charDistance(data::charDistance, numPoints);
+    std::valarray<PylithScalar> parameterA(data::parameterA, numPoints);
+    std::valarray<PylithScalar> parameterB(data::parameterB, numPoints);
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        // Mix sliding and locked points so both ageing-law branches appear in one block.
+        slipRate[p] = (0 == p % 5) ? 0.0 : 1.0e-6 * (1.0 + 0.9*sin(0.7*p));
+        state[p] = 2.0e+4 * (1.0 + 0.5*cos(0.3*p));
+    } // for
+
+    RateStateFriction::Batch batch;
+    batch.numPoints = numPoints;
+    batch.slipRate = &slipRate[0];
+    batch.state = &state[0];
+    batch.refCoefficient = &refCoefficient[0];
+    batch.refSlipRate = &refSlipRate[0];
+    batch.charDistance = &charDistance[0];
+    batch.parameterA = &parameterA[0];
+    batch.parameterB = &parameterB[0];
+
+    std::valarray<PylithScalar> coefficient(numPoints);
+    RateStateFriction::frictionCoefficientBatched(batch, &coefficient[0]);
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        const PylithScalar coefficientE = RateStateFriction::frictionCoefficient(
+            slipRate[p], state[p], refCoefficient[p], refSlipRate[p], charDistance[p],
+            parameterA[p], parameterB[p]);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(coefficientE, coefficient[p], 1.0e-12);
+    } // for
+
+    std::valarray<PylithScalar> stateUpdated(numPoints);
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        stateUpdated[p] = state[p];
+    } // for
+    RateStateFriction::stateAgeingBatched(batch, dt, &stateUpdated[0]);
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        const PylithScalar stateE = RateStateFriction::stateAgeing(state[p], slipRate[p], charDistance[p], dt);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(stateE, stateUpdated[p], 1.0e-10*stateE);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testBatched
+
+
+// End of file
@@ -0,0 +1,78 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/fekernels/TestRateStateFriction.hh
+ *
+ * @brief C++ TestRateStateFriction object
+ *
+ * C++ unit testing for the closed-form rate-state friction and ageing-law kernels.
+ */
+
+#if !defined(pylith_fekernels_testratestatefriction_hh)
+#define pylith_fekernels_testratestatefriction_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestRateStateFriction;
+    } // fekernels
+} // pylith
+
+/// C++ unit testing for RateStateFriction
+class pylith::fekernels::TestRateStateFriction : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestRateStateFriction);
+
+    CPPUNIT_TEST(testFrictionCoefficient);
+    CPPUNIT_TEST(testFrictionCoefficientSteadyState);
+    CPPUNIT_TEST(testFrictionCoefficientRegularized);
+    CPPUNIT_TEST(testStateAgeing);
+    CPPUNIT_TEST(testStateAgeingLocked);
+    CPPUNIT_TEST(testBatched);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test frictionCoefficient() against the unregularized law away from V = 0.
+    void testFrictionCoefficient(void);
+
+    /// Test frictionCoefficient() at steady state, mu_ss = f0 + (a-b) ln(V/V0).
+    void testFrictionCoefficientSteadyState(void);
+
+    /// Test regularized behavior of frictionCoefficient() as V -> 0.
+    void testFrictionCoefficientRegularized(void);
+
+    /// Test stateAgeing() against the exact solution of the ageing law.
+    void testStateAgeing(void);
+
+    /// Test stateAgeing() for a locked patch (V -> 0).
+    void testStateAgeingLocked(void);
+
+    /// Test that the batched kernels match the single-point kernels.
+    void testBatched(void);
+
+}; // class TestRateStateFriction
+
+#endif // pylith_fekernels_testratestatefriction_hh
+
+// End of file
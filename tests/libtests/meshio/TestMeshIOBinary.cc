@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshIOBinary.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOBinary.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES JournalingComponent
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestMeshIOBinary::setUp(void) {
+    TestMeshIO::setUp();
+    _io = new MeshIOBinary();CPPUNIT_ASSERT(_io);
+    _data = NULL;
+
+    _io->PyreComponent::setIdentifier("TestMeshIOBinary");
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Deallocate testing data.
+void
+pylith::meshio::TestMeshIOBinary::tearDown(void) {
+    const char* journalName = _io->PyreComponent::getName();
+    pythia::journal::debug_t debug(journalName);
+    debug.deactivate(); // DEBUGGING
+
+    TestMeshIO::tearDown();
+
+    delete _io;_io = NULL;
+    delete _data;_data = NULL;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestMeshIOBinary::testConstructor(void) {
+    PYLITH_METHOD_BEGIN;
+
+    MeshIOBinary iohandler;
+
+    PYLITH_METHOD_END;
+} // testConstructor
+
+
+// ----------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestMeshIOBinary::testFilename(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+
+    const std::string& filename = "hi.bin";
+    _io->setFilename(filename.c_str());
+    CPPUNIT_ASSERT_EQUAL(filename, std::string(_io->getFilename()));
+
+    PYLITH_METHOD_END;
+} // testFilename
+
+
+// ----------------------------------------------------------------------
+// Test write() and read().
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+    CPPUNIT_ASSERT(_data);
+
+    TestMeshIO::_createMesh();CPPUNIT_ASSERT(_mesh);
+
+    // Write mesh
+    CPPUNIT_ASSERT(_data->filename);
+    _io->setFilename(_data->filename);
+    _io->write(_mesh);
+
+    // Read mesh
+    delete _mesh;_mesh = new pylith::topology::Mesh;
+    _io->read(_mesh);
+
+    // Make sure mesh matches data
+    TestMeshIO::_checkVals();
+
+    PYLITH_METHOD_END;
+} // testWriteRead
+
+
+// ----------------------------------------------------------------------
+// Get test data.
+pylith::meshio::TestMeshIO_Data*
+pylith::meshio::TestMeshIOBinary::_getData(void) {
+    return _data;
+} // _data
+
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::TestMeshIOBinary_Data::TestMeshIOBinary_Data(void) :
+    filename(NULL) {} // constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::TestMeshIOBinary_Data::~TestMeshIOBinary_Data(void) {}
+
+
+// End of file
@@ -0,0 +1,147 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshIOMemory.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOMemory.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES JournalingComponent
+
+#include <strings.h> // USES strcasecmp()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestMeshIOMemory::setUp(void) {
+    TestMeshIO::setUp();
+    _io = new MeshIOMemory();CPPUNIT_ASSERT(_io);
+    _data = NULL;
+
+    _io->PyreComponent::setIdentifier("TestMeshIOMemory");
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Deallocate testing data.
+void
+pylith::meshio::TestMeshIOMemory::tearDown(void) {
+    const char* journalName = _io->PyreComponent::getName();
+    pythia::journal::debug_t debug(journalName);
+    debug.deactivate(); // DEBUGGING
+
+    TestMeshIO::tearDown();
+
+    delete _io;_io = NULL;
+    delete _data;_data = NULL;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestMeshIOMemory::testConstructor(void) {
+    PYLITH_METHOD_BEGIN;
+
+    MeshIOMemory iohandler;
+
+    PYLITH_METHOD_END;
+} // testConstructor
+
+
+// ----------------------------------------------------------------------
+// Test read() with caller-provided arrays.
+void
+pylith::meshio::TestMeshIOMemory::testRead(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+    CPPUNIT_ASSERT(_data);
+
+    // Copy the test data onto the heap; cells may be reordered in place and
+    // adopted arrays are freed by the reader after read().
+    const int numCoords = _data->numVertices * _data->spaceDim;
+    PylithScalar* coordinates = new PylithScalar[numCoords];
+    for (int i = 0; i < numCoords; ++i) {
+        coordinates[i] = _data->vertices[i];
+    } // for
+    _io->setVertices(coordinates, _data->numVertices, _data->spaceDim, true);
+
+    const int numIndices = _data->numCells * _data->numCorners;
+    int* cells = new int[numIndices];
+    for (int i = 0; i < numIndices; ++i) {
+        cells[i] = _data->cells[i];
+    } // for
+    _io->setCells(cells, _data->numCells, _data->numCorners, _data->cellDim, true);
+
+    int* materialIds = new int[_data->numCells];
+    for (int i = 0; i < _data->numCells; ++i) {
+        materialIds[i] = _data->materialIds[i];
+    } // for
+    _io->setMaterialIds(materialIds, true);
+
+    for (int iGroup = 0, index = 0; iGroup < _data->numGroups; ++iGroup) {
+        const int numPoints = _data->groupSizes[iGroup];
+        int* points = new int[numPoints];
+        for (int i = 0; i < numPoints; ++i, ++index) {
+            points[i] = _data->groups[index];
+        } // for
+        const MeshIO::GroupPtType type = (0 == strcasecmp("cell", _data->groupTypes[iGroup])) ? MeshIO::CELL : MeshIO::VERTEX;
+        _io->addGroup(_data->groupNames[iGroup], type, points, numPoints, true);
+    } // for
+
+    // Read mesh
+    delete _mesh;_mesh = new pylith::topology::Mesh;
+    _io->read(_mesh);
+
+    // Make sure mesh matches data
+    TestMeshIO::_checkVals();
+
+    PYLITH_METHOD_END;
+} // testRead
+
+
+// ----------------------------------------------------------------------
+// Test read() without setting the mesh arrays.
+void
+pylith::meshio::TestMeshIOMemory::testReadError(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;
+    CPPUNIT_ASSERT_THROW(_io->read(_mesh), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testReadError
+
+
+// ----------------------------------------------------------------------
+// Get test data.
+pylith::meshio::TestMeshIO_Data*
+pylith::meshio::TestMeshIOMemory::_getData(void) {
+    return _data;
+} // _data
+
+
+// End of file
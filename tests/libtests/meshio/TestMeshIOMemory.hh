@@ -0,0 +1,86 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/meshio/TestMeshIOMemory.hh
+ *
+ * @brief C++ TestMeshIOMemory object
+ *
+ * C++ unit testing for MeshIOMemory.
+ */
+
+#if !defined(pylith_meshio_testmeshiomemory_hh)
+#define pylith_meshio_testmeshiomemory_hh
+
+// Include directives ---------------------------------------------------
+#include "TestMeshIO.hh"
+
+// Forward declarations -------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestMeshIOMemory;
+    } // meshio
+} // pylith
+
+// ======================================================================
+class pylith::meshio::TestMeshIOMemory : public TestMeshIO {
+
+    // CPPUNIT TEST SUITE ///////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestMeshIOMemory);
+
+    CPPUNIT_TEST(testConstructor);
+    CPPUNIT_TEST(testRead);
+    CPPUNIT_TEST(testReadError);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Deallocate testing data.
+    void tearDown(void);
+
+    /// Test constructor
+    void testConstructor(void);
+
+    /// Test read() with caller-provided arrays.
+    void testRead(void);
+
+    /// Test read() without setting the mesh arrays.
+    void testReadError(void);
+
+    /** Get test data.
+     *
+     * @returns Test data.
+     */
+    TestMeshIO_Data* _getData(void);
+
+    // PROTECTED METHODS ////////////////////////////////////////////////
+protected:
+
+    MeshIOMemory* _io; ///< Test subject.
+    TestMeshIO_Data* _data; ///< Data for tests.
+
+}; // class TestMeshIOMemory
+
+#endif // pylith_meshio_testmeshiomemory_hh
+
+// End of file
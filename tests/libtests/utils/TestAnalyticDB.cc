@@ -0,0 +1,243 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestAnalyticDB.hh" // Implementation of class methods
+
+#include "pylith/utils/AnalyticDB.hh" // USES AnalyticDB
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <algorithm> // USES std::max()
+#include <cmath> // USES fabs()
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::utils::TestAnalyticDB);
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        namespace _TestAnalyticDB {
+            static const size_t numValues = 3;
+            static const char* names[numValues] = { "density", "vs", "vp" };
+            static const char* units[numValues] = { "kg/m**3", "m/s", "km/s" };
+            static const char* expressions[numValues] = {
+                "2500.0",
+                "3000.0 - 0.2*z",
+                "5.2 + 0.1*x - 0.35*z",
+            };
+
+            static const size_t numLocs = 4;
+            static const double coords[numLocs*3] = {
+                0.0,    0.0,     0.0,
+                1.0e+3, -2.0e+3, -5.0e+3,
+                -4.0e+3, 3.0e+3, 1.0e+3,
+                2.5e+3, 1.5e+3, -8.0e+3,
+            };
+
+            static const double tolerance = 1.0e-6;
+
+            /** Compute expected values at a location, converted to SI units.
+             *
+             * @param[out] valuesE Expected values [numValues].
+             * @param[in] xyz Coordinates of location.
+             */
+            inline
+            void computeValues(double* valuesE,
+                               const double* xyz) {
+                valuesE[0] = 2500.0;
+                valuesE[1] = 3000.0 - 0.2*xyz[2];
+                valuesE[2] = (5.2 + 0.1*xyz[0] - 0.35*xyz[2]) * 1000.0; // km/s -> m/s
+            } // computeValues
+
+            /** Set data and coordinate system for database.
+             *
+             * @param[inout] db Analytic spatial database.
+             */
+            inline
+            void setupDB(AnalyticDB* db) {
+                spatialdata::geocoords::CSCart cs;
+                cs.setSpaceDim(3);
+                db->setCoordSys(cs);
+                db->setData(names, units, expressions, numValues);
+            } // setupDB
+
+        } // _TestAnalyticDB
+    } // utils
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Test constructor.
+void
+pylith::utils::TestAnalyticDB::testConstructor(void) {
+    AnalyticDB db;
+} // testConstructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test getNamesDBValues().
+void
+pylith::utils::TestAnalyticDB::testGetNamesDBValues(void) {
+    namespace data = _TestAnalyticDB;
+
+    AnalyticDB db;
+    data::setupDB(&db);
+
+    const char** valueNames = NULL;
+    size_t numValues = 0;
+    db.getNamesDBValues(&valueNames, &numValues);
+    CPPUNIT_ASSERT_EQUAL(data::numValues, numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+        CPPUNIT_ASSERT_EQUAL(std::string(data::names[i]), std::string(valueNames[i]));
+    } // for
+    delete[] valueNames;valueNames = NULL;
+} // testGetNamesDBValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Test query() against the expressions evaluated directly, including unit conversion.
+void
+pylith::utils::TestAnalyticDB::testQuery(void) {
+    namespace data = _TestAnalyticDB;
+
+    AnalyticDB db;
+    data::setupDB(&db);
+    db.open();
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(3);
+
+    double values[data::numValues];
+    double valuesE[data::numValues];
+    for (size_t iLoc = 0; iLoc < data::numLocs; ++iLoc) {
+        const double* xyz = &data::coords[iLoc*3];
+        const int flag = db.query(values, data::numValues, xyz, 3, &csQuery);
+        CPPUNIT_ASSERT_EQUAL(0, flag);
+
+        data::computeValues(valuesE, xyz);
+        for (size_t iVal = 0; iVal < data::numValues; ++iVal) {
+            const double valueTolerance = std::max(data::tolerance, fabs(valuesE[iVal])*data::tolerance);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[iVal], values[iVal], valueTolerance);
+        } // for
+    } // for
+
+    db.close();
+} // testQuery
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setQueryValues() with a reordered subset of the values.
+void
+pylith::utils::TestAnalyticDB::testSetQueryValues(void) {
+    namespace data = _TestAnalyticDB;
+
+    AnalyticDB db;
+    data::setupDB(&db);
+    db.open();
+
+    static const size_t numQueryValues = 2;
+    static const char* queryNames[numQueryValues] = { "vp", "density" };
+    db.setQueryValues(queryNames, numQueryValues);
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(3);
+
+    double values[numQueryValues];
+    double valuesE[data::numValues];
+    const double* xyz = &data::coords[3];
+    const int flag = db.query(values, numQueryValues, xyz, 3, &csQuery);
+    CPPUNIT_ASSERT_EQUAL(0, flag);
+
+    data::computeValues(valuesE, xyz);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[2], values[0], fabs(valuesE[2])*data::tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[0], values[1], fabs(valuesE[0])*data::tolerance);
+
+    db.close();
+} // testSetQueryValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Test queryMulti() against query() at each location.
+void
+pylith::utils::TestAnalyticDB::testQueryMulti(void) {
+    namespace data = _TestAnalyticDB;
+
+    AnalyticDB db;
+    data::setupDB(&db);
+    db.open();
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(3);
+
+    double valuesMulti[data::numLocs*data::numValues];
+    db.queryMulti(valuesMulti, data::numValues, data::coords, data::numLocs, 3, &csQuery);
+
+    double values[data::numValues];
+    for (size_t iLoc = 0; iLoc < data::numLocs; ++iLoc) {
+        const int flag = db.query(values, data::numValues, &data::coords[iLoc*3], 3, &csQuery);
+        CPPUNIT_ASSERT_EQUAL(0, flag);
+        for (size_t iVal = 0; iVal < data::numValues; ++iVal) {
+            CPPUNIT_ASSERT_EQUAL(values[iVal], valuesMulti[iLoc*data::numValues+iVal]);
+        } // for
+    } // for
+
+    db.close();
+} // testQueryMulti
+
+
+// ------------------------------------------------------------------------------------------------
+// Test errors for missing data, bad expressions, and unknown query values.
+void
+pylith::utils::TestAnalyticDB::testErrors(void) {
+    namespace data = _TestAnalyticDB;
+
+    { // No values.
+        AnalyticDB db;
+        CPPUNIT_ASSERT_THROW(db.open(), std::runtime_error);
+    } // No values.
+
+    { // No coordinate system.
+        AnalyticDB db;
+        db.setData(data::names, data::units, data::expressions, data::numValues);
+        CPPUNIT_ASSERT_THROW(db.open(), std::runtime_error);
+    } // No coordinate system.
+
+    { // Bad expression.
+        AnalyticDB db;
+        spatialdata::geocoords::CSCart cs;
+        cs.setSpaceDim(3);
+        db.setCoordSys(cs);
+        static const char* badExpressions[data::numValues] = { "2500.0", "3000.0 - 0.2*q", "5.2" };
+        db.setData(data::names, data::units, badExpressions, data::numValues);
+        CPPUNIT_ASSERT_THROW(db.open(), std::runtime_error);
+    } // Bad expression.
+
+    { // Unknown query value.
+        AnalyticDB db;
+        data::setupDB(&db);
+        db.open();
+        static const char* queryNames[1] = { "vfast" };
+        CPPUNIT_ASSERT_THROW(db.setQueryValues(queryNames, 1), std::out_of_range);
+        db.close();
+    } // Unknown query value.
+} // testErrors
+
+
+// End of file
@@ -0,0 +1,78 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/utils/TestAnalyticDB.hh
+ *
+ * @brief C++ TestAnalyticDB object
+ *
+ * C++ unit testing for AnalyticDB.
+ */
+
+#if !defined(pylith_utils_testanalyticdb_hh)
+#define pylith_utils_testanalyticdb_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace utils {
+        class TestAnalyticDB;
+    } // utils
+} // pylith
+
+/// C++ unit testing for AnalyticDB
+class pylith::utils::TestAnalyticDB : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestAnalyticDB);
+
+    CPPUNIT_TEST(testConstructor);
+    CPPUNIT_TEST(testGetNamesDBValues);
+    CPPUNIT_TEST(testQuery);
+    CPPUNIT_TEST(testSetQueryValues);
+    CPPUNIT_TEST(testQueryMulti);
+    CPPUNIT_TEST(testErrors);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test constructor.
+    void testConstructor(void);
+
+    /// Test getNamesDBValues().
+    void testGetNamesDBValues(void);
+
+    /// Test query() against the expressions evaluated directly, including unit conversion.
+    void testQuery(void);
+
+    /// Test setQueryValues() with a reordered subset of the values.
+    void testSetQueryValues(void);
+
+    /// Test queryMulti() against query() at each location.
+    void testQueryMulti(void);
+
+    /// Test errors for missing data, bad expressions, and unknown query values.
+    void testErrors(void);
+
+}; // class TestAnalyticDB
+
+#endif // pylith_utils_testanalyticdb_hh
+
+// End of file
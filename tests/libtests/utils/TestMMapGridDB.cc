@@ -0,0 +1,480 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMMapGridDB.hh" // Implementation of class methods
+
+#include "pylith/utils/MMapGridDB.hh" // USES MMapGridDB
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <algorithm> // USES std::max(), std::min()
+#include <cmath> // USES fabs()
+#include <cstdint> // USES int64_t
+#include <cstring> // USES memset(), strncpy()
+#include <fstream> // USES std::ofstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::utils::TestMMapGridDB);
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        namespace _TestMMapGridDB {
+            // Layout of binary grid file generated by pylith_convert_griddb.
+            static const char* magicV1 = "PyLithMMapGridDB v1\n";
+            static const char* magicV2 = "PyLithMMapGridDB v2\n";
+            static const size_t magicSize = 24;
+            static const size_t nameSize = 64;
+            static const size_t unitsSize = 32;
+            static const int64_t dtypeFloat64 = 0;
+            static const int64_t dtypeFloat32 = 1;
+
+            static const size_t spaceDim = 3;
+            static const size_t numValues = 2;
+            static const char* names[numValues] = { "density", "vs" };
+            static const char* units[numValues] = { "kg/m**3", "km/s" };
+            static const double scales[numValues] = { 1.0, 1000.0 };
+
+            static const size_t numX = 3;
+            static const size_t numY = 2;
+            static const size_t numZ = 2;
+            static const size_t numLocs = numX*numY*numZ;
+            static const double coordsX[numX] = { -2.0, 0.0, 1.0 };
+            static const double coordsY[numY] = { 0.0, 4.0 };
+            static const double coordsZ[numZ] = { -1.0, 3.0 };
+
+            // Raw (unscaled) values at the grid locations; location index is
+            // (iz*numY + iy)*numX + ix.
+            static const double values[numLocs*numValues] = {
+                2000.0, 1.00,
+                2010.0, 1.05,
+                2020.0, 1.10,
+                2030.0, 1.15,
+                2040.0, 1.20,
+                2050.0, 1.25,
+                2060.0, 1.30,
+                2070.0, 1.35,
+                2080.0, 1.40,
+                2090.0, 1.45,
+                2100.0, 1.50,
+                2110.0, 1.55,
+            };
+
+            static const double tolerance = 1.0e-12;
+
+            /** Write binary grid file.
+             *
+             * @param[in] filename Name of file to write.
+             * @param[in] version Version of binary layout (1 or 2).
+             * @param[in] dtypeFlag Storage dtype of values (version 2 only).
+             */
+            inline
+            void writeGridFile(const char* filename,
+                               const int version,
+                               const int64_t dtypeFlag =dtypeFloat64) {
+                std::ofstream fout(filename, std::ios::binary);
+                CPPUNIT_ASSERT(fout.is_open());
+
+                char magic[magicSize];
+                memset(magic, 0, magicSize);
+                strncpy(magic, (1 == version) ? magicV1 : magicV2, magicSize-1);
+                fout.write(magic, magicSize);
+
+                const int64_t header[6] = {
+                    int64_t(spaceDim), int64_t(numValues), int64_t(numX), int64_t(numY), int64_t(numZ), dtypeFlag,
+                };
+                fout.write((const char*)header, ((1 == version) ? 5 : 6) * sizeof(int64_t));
+
+                for (size_t i = 0; i < numValues; ++i) {
+                    char name[nameSize];
+                    memset(name, 0, nameSize);
+                    strncpy(name, names[i], nameSize-1);
+                    fout.write(name, nameSize);
+
+                    char valueUnits[unitsSize];
+                    memset(valueUnits, 0, unitsSize);
+                    strncpy(valueUnits, units[i], unitsSize-1);
+                    fout.write(valueUnits, unitsSize);
+                } // for
+
+                fout.write((const char*)coordsX, numX*sizeof(double));
+                fout.write((const char*)coordsY, numY*sizeof(double));
+                fout.write((const char*)coordsZ, numZ*sizeof(double));
+
+                if (dtypeFloat32 == dtypeFlag) {
+                    float valuesSingle[numLocs*numValues];
+                    for (size_t i = 0; i < numLocs*numValues; ++i) {
+                        valuesSingle[i] = float(values[i]);
+                    } // for
+                    fout.write((const char*)valuesSingle, numLocs*numValues*sizeof(float));
+                } else {
+                    fout.write((const char*)values, numLocs*numValues*sizeof(double));
+                } // if/else
+            } // writeGridFile
+
+            /** Find grid cell containing coordinate along one dimension (clamped to the grid).
+             *
+             * @param[out] index Index of grid point at lower edge of cell.
+             * @param[out] weight Interpolation weight toward grid point at upper edge of cell.
+             * @param[in] gridCoords Grid coordinates along dimension.
+             * @param[in] numGridCoords Number of grid coordinates along dimension.
+             * @param[in] x Coordinate of query location along dimension.
+             */
+            inline
+            void findCell(size_t* index,
+                          double* weight,
+                          const double* gridCoords,
+                          const size_t numGridCoords,
+                          const double x) {
+                if (x <= gridCoords[0]) {
+                    *index = 0;*weight = 0.0;
+                } else if (x >= gridCoords[numGridCoords-1]) {
+                    *index = numGridCoords-2;*weight = 1.0;
+                } else {
+                    size_t i = 0;
+                    while (x >= gridCoords[i+1]) { ++i; }
+                    *index = i;
+                    *weight = (x - gridCoords[i]) / (gridCoords[i+1] - gridCoords[i]);
+                } // if/else
+            } // findCell
+
+            /** Compute expected values at a location by trilinear interpolation, converted to
+             * SI units. Locations outside the grid are clamped to the grid boundary.
+             *
+             * @param[out] valuesE Expected values [numValues].
+             * @param[in] xyz Coordinates of location.
+             * @param[in] quantized Values stored quantized to single precision if true.
+             */
+            inline
+            void computeValues(double* valuesE,
+                               const double* xyz,
+                               const bool quantized =false) {
+                size_t index[3];
+                double weight[3];
+                findCell(&index[0], &weight[0], coordsX, numX, xyz[0]);
+                findCell(&index[1], &weight[1], coordsY, numY, xyz[1]);
+                findCell(&index[2], &weight[2], coordsZ, numZ, xyz[2]);
+
+                for (size_t iVal = 0; iVal < numValues; ++iVal) {
+                    valuesE[iVal] = 0.0;
+                } // for
+                for (size_t k = 0; k < 2; ++k) {
+                    for (size_t j = 0; j < 2; ++j) {
+                        for (size_t i = 0; i < 2; ++i) {
+                            const double cornerWeight =
+                                (i ? weight[0] : 1.0-weight[0]) *
+                                (j ? weight[1] : 1.0-weight[1]) *
+                                (k ? weight[2] : 1.0-weight[2]);
+                            const size_t loc = ((index[2]+k)*numY + index[1]+j)*numX + index[0]+i;
+                            for (size_t iVal = 0; iVal < numValues; ++iVal) {
+                                const double cornerValue = quantized ?
+                                                           double(float(values[loc*numValues+iVal])) :
+                                                           values[loc*numValues+iVal];
+                                valuesE[iVal] += cornerWeight * cornerValue;
+                            } // for
+                        } // for
+                    } // for
+                } // for
+                for (size_t iVal = 0; iVal < numValues; ++iVal) {
+                    valuesE[iVal] *= scales[iVal];
+                } // for
+            } // computeValues
+
+        } // _TestMMapGridDB
+    } // utils
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Test constructor.
+void
+pylith::utils::TestMMapGridDB::testConstructor(void) {
+    MMapGridDB db;
+} // testConstructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test getNamesDBValues().
+void
+pylith::utils::TestMMapGridDB::testGetNamesDBValues(void) {
+    namespace data = _TestMMapGridDB;
+
+    const char* filename = "mmapgrid_names.griddb";
+    data::writeGridFile(filename, 2);
+
+    MMapGridDB db;
+    db.setFilename(filename);
+    db.open();
+
+    const char** valueNames = NULL;
+    size_t numValues = 0;
+    db.getNamesDBValues(&valueNames, &numValues);
+    CPPUNIT_ASSERT_EQUAL(data::numValues, numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+        CPPUNIT_ASSERT_EQUAL(std::string(data::names[i]), std::string(valueNames[i]));
+    } // for
+    delete[] valueNames;valueNames = NULL;
+
+    db.close();
+} // testGetNamesDBValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Test query() of a version 1 grid file.
+void
+pylith::utils::TestMMapGridDB::testQueryV1(void) {
+    namespace data = _TestMMapGridDB;
+
+    const char* filename = "mmapgrid_v1.griddb";
+    data::writeGridFile(filename, 1);
+
+    MMapGridDB db;
+    db.setFilename(filename);
+    db.open();
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(data::spaceDim);
+
+    // Values at the grid locations are recovered exactly.
+    double values[data::numValues];
+    for (size_t iz = 0, iLoc = 0; iz < data::numZ; ++iz) {
+        for (size_t iy = 0; iy < data::numY; ++iy) {
+            for (size_t ix = 0; ix < data::numX; ++ix, ++iLoc) {
+                const double xyz[3] = { data::coordsX[ix], data::coordsY[iy], data::coordsZ[iz] };
+                const int flag = db.query(values, data::numValues, xyz, data::spaceDim, &csQuery);
+                CPPUNIT_ASSERT_EQUAL(0, flag);
+                for (size_t iVal = 0; iVal < data::numValues; ++iVal) {
+                    const double valueE = data::scales[iVal] * data::values[iLoc*data::numValues+iVal];
+                    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, values[iVal], fabs(valueE)*data::tolerance);
+                } // for
+            } // for
+        } // for
+    } // for
+
+    db.close();
+} // testQueryV1
+
+
+// ------------------------------------------------------------------------------------------------
+// Test query() of a version 2 grid file, including interpolation and clamping.
+void
+pylith::utils::TestMMapGridDB::testQueryV2(void) {
+    namespace data = _TestMMapGridDB;
+
+    const char* filename = "mmapgrid_v2.griddb";
+    data::writeGridFile(filename, 2, data::dtypeFloat64);
+
+    MMapGridDB db;
+    db.setFilename(filename);
+    db.open();
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(data::spaceDim);
+
+    static const size_t numQueryLocs = 4;
+    static const double queryCoords[numQueryLocs*3] = {
+        0.0, 4.0, -1.0, // grid location
+        0.5, 2.0, 1.0, // cell center
+        -1.3, 3.1, 2.2, // general location
+        -10.0, -5.0, 8.0, // outside grid; clamped to boundary
+    };
+
+    double values[data::numValues];
+    double valuesE[data::numValues];
+    for (size_t iLoc = 0; iLoc < numQueryLocs; ++iLoc) {
+        const double* xyz = &queryCoords[iLoc*3];
+        const int flag = db.query(values, data::numValues, xyz, data::spaceDim, &csQuery);
+        CPPUNIT_ASSERT_EQUAL(0, flag);
+
+        data::computeValues(valuesE, xyz);
+        for (size_t iVal = 0; iVal < data::numValues; ++iVal) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[iVal], values[iVal], fabs(valuesE[iVal])*data::tolerance);
+        } // for
+    } // for
+
+    db.close();
+} // testQueryV2
+
+
+// ------------------------------------------------------------------------------------------------
+// Test query() of a version 2 grid file with values quantized to single precision.
+void
+pylith::utils::TestMMapGridDB::testQueryFloat32(void) {
+    namespace data = _TestMMapGridDB;
+
+    const char* filename = "mmapgrid_float32.griddb";
+    data::writeGridFile(filename, 2, data::dtypeFloat32);
+
+    MMapGridDB db;
+    db.setFilename(filename);
+    db.open();
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(data::spaceDim);
+
+    static const size_t numQueryLocs = 4;
+    static const double queryCoords[numQueryLocs*3] = {
+        0.0, 4.0, -1.0, // grid location
+        0.5, 2.0, 1.0, // cell center
+        -1.3, 3.1, 2.2, // general location
+        -10.0, -5.0, 8.0, // outside grid; clamped to boundary
+    };
+
+    // The interpolation dequantizes the values to double precision, so queries match the
+    // reference interpolation of the quantized values to full precision.
+    double values[data::numValues];
+    double valuesE[data::numValues];
+    for (size_t iLoc = 0; iLoc < numQueryLocs; ++iLoc) {
+        const double* xyz = &queryCoords[iLoc*3];
+        const int flag = db.query(values, data::numValues, xyz, data::spaceDim, &csQuery);
+        CPPUNIT_ASSERT_EQUAL(0, flag);
+
+        data::computeValues(valuesE, xyz, true);
+        for (size_t iVal = 0; iVal < data::numValues; ++iVal) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[iVal], values[iVal], fabs(valuesE[iVal])*data::tolerance);
+        } // for
+    } // for
+
+    db.close();
+} // testQueryFloat32
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setQueryValues() with a reordered subset of the values.
+void
+pylith::utils::TestMMapGridDB::testSetQueryValues(void) {
+    namespace data = _TestMMapGridDB;
+
+    const char* filename = "mmapgrid_queryvals.griddb";
+    data::writeGridFile(filename, 2);
+
+    MMapGridDB db;
+    db.setFilename(filename);
+    db.open();
+
+    static const size_t numQueryValues = 2;
+    static const char* queryNames[numQueryValues] = { "vs", "density" };
+    db.setQueryValues(queryNames, numQueryValues);
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(data::spaceDim);
+
+    double values[numQueryValues];
+    double valuesE[data::numValues];
+    const double xyz[3] = { 0.5, 2.0, 1.0 };
+    const int flag = db.query(values, numQueryValues, xyz, data::spaceDim, &csQuery);
+    CPPUNIT_ASSERT_EQUAL(0, flag);
+
+    data::computeValues(valuesE, xyz);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[1], values[0], fabs(valuesE[1])*data::tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[0], values[1], fabs(valuesE[0])*data::tolerance);
+
+    db.close();
+} // testSetQueryValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Test queryMulti() against query() at each location.
+void
+pylith::utils::TestMMapGridDB::testQueryMulti(void) {
+    namespace data = _TestMMapGridDB;
+
+    const char* filename = "mmapgrid_multi.griddb";
+    data::writeGridFile(filename, 2);
+
+    MMapGridDB db;
+    db.setFilename(filename);
+    db.open();
+
+    spatialdata::geocoords::CSCart csQuery;
+    csQuery.setSpaceDim(data::spaceDim);
+
+    static const size_t numQueryLocs = 3;
+    static const double queryCoords[numQueryLocs*3] = {
+        -2.0, 0.0, -1.0,
+        0.5, 2.0, 1.0,
+        0.9, 3.7, -0.4,
+    };
+
+    double valuesMulti[numQueryLocs*data::numValues];
+    db.queryMulti(valuesMulti, data::numValues, queryCoords, numQueryLocs, data::spaceDim, &csQuery);
+
+    double values[data::numValues];
+    for (size_t iLoc = 0; iLoc < numQueryLocs; ++iLoc) {
+        const int flag = db.query(values, data::numValues, &queryCoords[iLoc*3], data::spaceDim, &csQuery);
+        CPPUNIT_ASSERT_EQUAL(0, flag);
+        for (size_t iVal = 0; iVal < data::numValues; ++iVal) {
+            CPPUNIT_ASSERT_EQUAL(values[iVal], valuesMulti[iLoc*data::numValues+iVal]);
+        } // for
+    } // for
+
+    db.close();
+} // testQueryMulti
+
+
+// ------------------------------------------------------------------------------------------------
+// Test errors for missing, foreign, and truncated grid files.
+void
+pylith::utils::TestMMapGridDB::testErrors(void) {
+    namespace data = _TestMMapGridDB;
+
+    { // No filename.
+        MMapGridDB db;
+        CPPUNIT_ASSERT_THROW(db.open(), std::runtime_error);
+    } // No filename.
+
+    { // Missing file.
+        MMapGridDB db;
+        db.setFilename("mmapgrid_missing.griddb");
+        CPPUNIT_ASSERT_THROW(db.open(), std::runtime_error);
+    } // Missing file.
+
+    { // Not a binary grid file.
+        const char* filename = "mmapgrid_foreign.griddb";
+        std::ofstream fout(filename, std::ios::binary);
+        fout << "#SPATIAL_GRID.ascii 1\n";
+        fout.close();
+
+        MMapGridDB db;
+        db.setFilename(filename);
+        CPPUNIT_ASSERT_THROW(db.open(), std::runtime_error);
+    } // Not a binary grid file.
+
+    { // Truncated file.
+        const char* filename = "mmapgrid_truncated.griddb";
+        data::writeGridFile(filename, 2);
+        std::ofstream fout(filename, std::ios::binary | std::ios::in);
+        fout.seekp(0, std::ios::beg);
+        char magic[data::magicSize];
+        memset(magic, 0, data::magicSize);
+        strncpy(magic, data::magicV2, data::magicSize-1);
+        fout.write(magic, data::magicSize);
+        const int64_t header[6] = { 3, 2, int64_t(data::numX), int64_t(data::numY), int64_t(data::numZ)+1, 0 };
+        fout.write((const char*)header, 6*sizeof(int64_t));
+        fout.close();
+
+        MMapGridDB db;
+        db.setFilename(filename);
+        CPPUNIT_ASSERT_THROW(db.open(), std::runtime_error);
+    } // Truncated file.
+} // testErrors
+
+
+// End of file
@@ -0,0 +1,87 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/utils/TestMMapGridDB.hh
+ *
+ * @brief C++ TestMMapGridDB object
+ *
+ * C++ unit testing for MMapGridDB. The tests write a binary grid file with the
+ * layout generated by `pylith_convert_griddb` and query the mapped grid.
+ */
+
+#if !defined(pylith_utils_testmmapgriddb_hh)
+#define pylith_utils_testmmapgriddb_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace utils {
+        class TestMMapGridDB;
+    } // utils
+} // pylith
+
+/// C++ unit testing for MMapGridDB
+class pylith::utils::TestMMapGridDB : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestMMapGridDB);
+
+    CPPUNIT_TEST(testConstructor);
+    CPPUNIT_TEST(testGetNamesDBValues);
+    CPPUNIT_TEST(testQueryV1);
+    CPPUNIT_TEST(testQueryV2);
+    CPPUNIT_TEST(testQueryFloat32);
+    CPPUNIT_TEST(testSetQueryValues);
+    CPPUNIT_TEST(testQueryMulti);
+    CPPUNIT_TEST(testErrors);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test constructor.
+    void testConstructor(void);
+
+    /// Test getNamesDBValues().
+    void testGetNamesDBValues(void);
+
+    /// Test query() of a version 1 grid file.
+    void testQueryV1(void);
+
+    /// Test query() of a version 2 grid file, including interpolation and clamping.
+    void testQueryV2(void);
+
+    /// Test query() of a version 2 grid file with values quantized to single precision.
+    void testQueryFloat32(void);
+
+    /// Test setQueryValues() with a reordered subset of the values.
+    void testSetQueryValues(void);
+
+    /// Test queryMulti() against query() at each location.
+    void testQueryMulti(void);
+
+    /// Test errors for missing, foreign, and truncated grid files.
+    void testErrors(void);
+
+}; // class TestMMapGridDB
+
+#endif // pylith_utils_testmmapgriddb_hh
+
+// End of file
@@ -0,0 +1,184 @@
+#!/usr/bin/env nemesis
+
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# Performance regression harness.
+#
+# Runs small/medium canonical problems (reusing the configurations in
+# examples/) with PETSc stage timing and memory capture, and compares
+# per-stage wall time and peak process memory against stored baselines
+# with tolerance bands. Baselines are machine specific; generate them on
+# the reference machine with --update-baselines before using the harness
+# to vet a release.
+#
+# Usage:
+#   run_perf.py                      # Run all benchmarks, compare against baselines.
+#   run_perf.py --sim=strikeslip-2d  # Run one benchmark.
+#   run_perf.py --update-baselines   # Regenerate baselines from this run.
+#   run_perf.py --tolerance=0.10     # Tighten the regression tolerance band.
+
+import argparse
+import json
+import os
+import pathlib
+import re
+import subprocess
+import sys
+
+
+class PerfRunnerApp():
+
+    # Benchmark name -> (directory relative to examples/, pylith arguments).
+    SIMS = {
+        'strikeslip-2d': ('strikeslip-2d', ['step01_slip.cfg']),
+        'strikeslip-2d-varslip': ('strikeslip-2d', ['step04_varslip.cfg']),
+        'subduction-2d-coseismic': ('subduction-2d', ['step01_coseismic.cfg']),
+        'subduction-2d-interseismic': ('subduction-2d', ['step02_interseismic.cfg']),
+    }
+
+    BASELINE_DIR = 'baselines'
+    RESULTS_FILENAME = 'perf_results.json'
+
+    def main(self):
+        """Application entry point.
+        """
+        args = self._parse_command_line()
+        if args.sim == 'all':
+            sims = self.SIMS
+        else:
+            sims = {args.sim: self.SIMS[args.sim]}
+
+        results = {}
+        for sim, (sim_dir, sim_args) in sims.items():
+            results[sim] = self._run_sim(sim, sim_dir, sim_args, args.nodes)
+
+        with open(self.RESULTS_FILENAME, 'w') as fout:
+            json.dump(results, fout, indent=4, sort_keys=True)
+
+        if args.update_baselines:
+            self._update_baselines(results)
+            return 0
+        return self._check_baselines(results, args.tolerance)
+
+    def _run_sim(self, sim, sim_dir, sim_args, nodes):
+        """Run one benchmark and extract per-stage time and peak memory.
+        """
+        perf_dir = pathlib.Path(__file__).parent.resolve()
+        examples_dir = perf_dir.parent.parent / 'examples' / sim_dir
+        log_filename = perf_dir / f"{sim}.log"
+        logview_filename = perf_dir / f"{sim}_logview.txt"
+
+        pylith_args = ['pylith'] + sim_args + [
+            f"--nodes={nodes}",
+            f"--petsc.log_view=:{logview_filename}",
+            "--petsc.memory_view",
+        ]
+        print(f"Running {' '.join(pylith_args)} in {examples_dir}...")
+        with open(log_filename, 'w') as log:
+            subprocess.run(pylith_args, cwd=examples_dir, stdout=log, stderr=log, check=True)
+
+        metrics = self._parse_stages(logview_filename)
+        metrics['memory_mb'] = self._parse_memory(log_filename)
+        return metrics
+
+    def _parse_stages(self, logview_filename):
+        """Extract per-stage wall time from a PETSc -log_view summary.
+
+        Stages correspond to the phases registered by PyLith (Meshing,
+        Setup, Finalize, ...) plus the PETSc Main Stage.
+        """
+        pattern = re.compile(r'^\s*\d+:\s+(.+?):\s+([0-9]+\.[0-9]+e[+-][0-9]+)\s')
+        metrics = {}
+        with open(logview_filename) as fin:
+            for line in fin:
+                match = pattern.match(line)
+                if match:
+                    stage = match.group(1).strip().lower().replace(' ', '_')
+                    metrics[f"time_{stage}"] = float(match.group(2))
+        if not metrics:
+            raise RuntimeError(f"Could not find stage summary in '{logview_filename}'.")
+        return metrics
+
+    def _parse_memory(self, log_filename):
+        """Extract peak process memory (MB) from PETSc -memory_view output.
+        """
+        pattern = re.compile(r'Maximum \(over computational time\) process memory:\s+total\s+([0-9]+\.[0-9]+e[+-][0-9]+)')
+        with open(log_filename) as fin:
+            for line in fin:
+                match = pattern.search(line)
+                if match:
+                    return float(match.group(1)) / 2**20
+        raise RuntimeError(f"Could not find memory summary in '{log_filename}'.")
+
+    def _update_baselines(self, results):
+        """Write baseline files from this run's results.
+        """
+        os.makedirs(self.BASELINE_DIR, exist_ok=True)
+        for sim, metrics in results.items():
+            filename = os.path.join(self.BASELINE_DIR, f"{sim}.json")
+            with open(filename, 'w') as fout:
+                json.dump(metrics, fout, indent=4, sort_keys=True)
+            print(f"Updated baseline '{filename}'.")
+
+    def _check_baselines(self, results, tolerance):
+        """Compare results against baselines; return nonzero if any metric regressed.
+        """
+        num_regressions = 0
+        for sim, metrics in results.items():
+            filename = os.path.join(self.BASELINE_DIR, f"{sim}.json")
+            if not os.path.isfile(filename):
+                print(f"SKIP {sim}: no baseline '{filename}' "
+                      "(generate with --update-baselines).")
+                continue
+            with open(filename) as fin:
+                baseline = json.load(fin)
+            for metric, value in sorted(metrics.items()):
+                if metric not in baseline:
+                    print(f"SKIP {sim}/{metric}: not in baseline.")
+                    continue
+                limit = baseline[metric] * (1.0 + tolerance)
+                status = 'OK'
+                if value > limit:
+                    status = 'FAIL'
+                    num_regressions += 1
+                print(f"{status:4s} {sim}/{metric}: {value:.4g} "
+                      f"(baseline {baseline[metric]:.4g}, limit {limit:.4g})")
+        if num_regressions > 0:
+            print(f"{num_regressions} metric(s) regressed beyond the "
+                  f"{100*tolerance:.0f}% tolerance band.")
+        return 1 if num_regressions > 0 else 0
+
+    def _parse_command_line(self):
+        """Parse command line arguments.
+        """
+        parser = argparse.ArgumentParser()
+        parser.add_argument('--sim', action='store', dest='sim', default='all',
+                            choices=['all'] + list(self.SIMS.keys()),
+                            help='Benchmark to run.')
+        parser.add_argument('--nodes', action='store', dest='nodes', type=int, default=1,
+                            help='Number of processes.')
+        parser.add_argument('--tolerance', action='store', dest='tolerance', type=float, default=0.20,
+                            help='Fractional slowdown allowed before a metric is flagged as a regression.')
+        parser.add_argument('--update-baselines', action='store_true', dest='update_baselines',
+                            help='Write baselines from this run instead of checking against them.')
+        return parser.parse_args()
+
+
+if __name__ == '__main__':
+    sys.exit(PerfRunnerApp().main())
+
+
+# End of file
@@ -0,0 +1,46 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+
+## @file tests/pytests/mpi/TestError.py
+
+## @brief Unit testing of MPI error functions.
+
+import unittest
+
+import pylith.mpi.mpi as mpi
+
+# ----------------------------------------------------------------------
+class TestError(unittest.TestCase):
+  """Unit testing of MPI error functions.
+  """
+
+
+  def test_gather_errors(self):
+    summary = mpi.gather_errors("Error ABC.", mpi.petsc_comm_self())
+    self.assertTrue("1 of 1 processes reported errors" in summary)
+    self.assertTrue("Error ABC." in summary)
+    return
+
+
+  def test_gather_errors_none(self):
+    summary = mpi.gather_errors("", mpi.petsc_comm_self())
+    self.assertTrue("0 of 1 processes reported errors" in summary)
+    return
+
+
+# End of file
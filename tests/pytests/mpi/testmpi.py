@@ -50,6 +50,9 @@ class TestApp(UnitTestApp):
     from TestReduce import TestReduce
     suite.addTest(unittest.makeSuite(TestReduce))
 
+    from TestError import TestError
+    suite.addTest(unittest.makeSuite(TestError))
+
     return suite
 
 